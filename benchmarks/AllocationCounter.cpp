@@ -0,0 +1,60 @@
+#include "AllocationCounter.h"
+
+#include <vector>
+
+namespace opcua::benchmarks {
+
+namespace {
+
+struct Record {
+    std::string title;
+    std::string name;
+    double nanoseconds;
+    AllocationCount count;
+};
+
+std::vector<Record> records;  // NOLINT
+
+}  // namespace
+
+void recordAllocations(
+    const std::string& title, const std::string& name, double nanoseconds, AllocationCount count
+) {
+    records.push_back({title, name, nanoseconds, count});
+}
+
+void printAllocations(std::ostream& os) {
+    os << "\n| allocations/op | bytes/op | benchmark\n";
+    os << "|---------------:|---------:|:----------\n";
+    for (const auto& record : records) {
+        os << "| " << record.count.allocations << " | " << record.count.bytes << " | `"
+           << record.title << ": " << record.name << "`\n";
+    }
+    if (!isNativeAllocationCounted()) {
+        os << "\nNative allocations are not counted, open62541 was compiled without "
+              "UA_ENABLE_MALLOC_SINGLETON\n";
+    }
+}
+
+void writeJson(std::ostream& os) {
+    os << "{\n";
+    os << "  \"benchmark\": \"micro\",\n";
+#ifdef UAPP_VERSION
+    os << "  \"version\": \"" << UAPP_VERSION << "\",\n";
+#endif
+    os << "  \"nativeAllocationsCounted\": " << (isNativeAllocationCounted() ? "true" : "false")
+       << ",\n";
+    os << "  \"results\": [";
+    for (size_t i = 0; i < records.size(); ++i) {
+        const auto& record = records[i];
+        os << (i == 0 ? "\n" : ",\n") << "    {"
+           << "\"title\": \"" << record.title << "\", "
+           << "\"name\": \"" << record.name << "\", "
+           << "\"nanosecondsPerOperation\": " << record.nanoseconds << ", "
+           << "\"allocations\": " << record.count.allocations << ", "
+           << "\"allocatedBytes\": " << record.count.bytes << "}";
+    }
+    os << "\n  ]\n}\n";
+}
+
+}  // namespace opcua::benchmarks
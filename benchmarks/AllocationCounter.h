@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <utility>  // forward
+
+#include <nanobench.h>
+
+#include "helper/AllocationCounter.h"  // shared with the unit tests
+
+namespace opcua::benchmarks {
+
+/// Record the median time and the allocations of a single iteration of a benchmark.
+void recordAllocations(
+    const std::string& title, const std::string& name, double nanoseconds, AllocationCount count
+);
+
+/// Print the recorded allocations per iteration as a markdown table.
+void printAllocations(std::ostream& os);
+
+/// Write the recorded results as JSON, the schema is stable to compare results across releases.
+void writeJson(std::ostream& os);
+
+/// Run a benchmark and record the allocations of a single (warm) iteration.
+template <typename Op>
+void run(ankerl::nanobench::Bench& bench, const std::string& name, Op&& op) {
+    bench.run(name, op);
+    const double nanoseconds =
+        bench.results().back().median(ankerl::nanobench::Result::Measure::elapsed) * 1e9;
+    const AllocationScope scope;
+    std::forward<Op>(op)();
+    const AllocationCount count{scope.getAllocations(), scope.getBytes()};
+    recordAllocations(bench.title(), name, nanoseconds, count);
+}
+
+}  // namespace opcua::benchmarks
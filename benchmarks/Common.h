@@ -0,0 +1,71 @@
+#pragma once
+
+#include <algorithm>  // min
+#include <cstdint>
+#include <ctime>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// helpers shared by the end-to-end benchmarks
+
+namespace opcua::benchmarks {
+
+/// Split a comma-separated list of command line arguments.
+inline std::vector<std::string> split(std::string_view list) {
+    std::vector<std::string> items;
+    std::stringstream ss{std::string(list)};
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        items.push_back(item);
+    }
+    return items;
+}
+
+/// Parse a comma-separated list of sizes, e.g. `1,100,1000`.
+inline std::vector<size_t> parseSizes(std::string_view list) {
+    std::vector<size_t> sizes;
+    for (const auto& item : split(list)) {
+        sizes.push_back(std::stoull(item));
+    }
+    return sizes;
+}
+
+/// Percentile (0...1) of sorted samples, 0 if empty.
+template <typename T>
+T getPercentile(const std::vector<T>& sorted, double percentile) {
+    if (sorted.empty()) {
+        return 0;
+    }
+    const auto index = std::min(
+        sorted.size() - 1, static_cast<size_t>(percentile * static_cast<double>(sorted.size()))
+    );
+    return sorted[index];
+}
+
+/// Processor time of the process (all threads) in seconds.
+inline double getCpuSeconds() {
+    return static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
+}
+
+/// Read a field of `/proc/self/status` in bytes, e.g. `VmRSS` or `VmHWM` (Linux only).
+inline uint64_t readStatusBytes(std::string_view field) {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, field.size(), field) == 0 && line.size() > field.size() &&
+            line[field.size()] == ':') {
+            return std::stoull(line.substr(field.size() + 1)) * 1024;  // kB
+        }
+    }
+    return 0;
+}
+
+/// Resident memory of the process in bytes, 0 if unknown (Linux only).
+inline uint64_t getResidentBytes() {
+    return readStatusBytes("VmRSS");
+}
+
+}  // namespace opcua::benchmarks
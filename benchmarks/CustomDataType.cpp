@@ -0,0 +1,278 @@
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <nanobench.h>
+
+#include "open62541pp/Client.h"
+#include "open62541pp/Config.h"
+#include "open62541pp/DataType.h"
+#include "open62541pp/DataTypeBuilder.h"
+#include "open62541pp/Encoding.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/open62541.h"
+#include "open62541pp/services/Attribute_highlevel.h"
+#include "open62541pp/services/NodeManagement.h"
+#include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/ExtensionObject.h"
+#include "open62541pp/types/Variant.h"
+
+#include "AllocationCounter.h"
+
+using namespace opcua;
+using ankerl::nanobench::doNotOptimizeAway;
+
+namespace opcua::benchmarks {
+
+// Same fields in different order: tightly packed (overlayable) and with padding (not overlayable)
+struct Packed {
+    double value;
+    int32_t id;
+    int32_t quality;
+};
+
+struct Padded {
+    int32_t id;
+    double value;
+    int32_t quality;
+};
+
+struct Optional {
+    int32_t id;
+    double* value;
+};
+
+enum class ChoiceSwitch : uint32_t { None = 0, Value = 1, Text = 2 };
+
+struct Choice {
+    ChoiceSwitch switchField;
+
+    union {
+        double value;
+        UA_String text;
+    } fields;
+};
+
+static const DataType& getPackedDataType() {
+    static const DataType dt =
+        DataTypeBuilder<Packed>::createStructure("Packed", {1, 5001}, {1, 5101})
+            .addField<&Packed::value>("value")
+            .addField<&Packed::id>("id")
+            .addField<&Packed::quality>("quality")
+            .build();
+    return dt;
+}
+
+static const DataType& getPaddedDataType() {
+    static const DataType dt =
+        DataTypeBuilder<Padded>::createStructure("Padded", {1, 5002}, {1, 5102})
+            .addField<&Padded::id>("id")
+            .addField<&Padded::value>("value")
+            .addField<&Padded::quality>("quality")
+            .build();
+    return dt;
+}
+
+static const DataType& getOptionalDataType() {
+    static const DataType dt =
+        DataTypeBuilder<Optional>::createStructure("Optional", {1, 5003}, {1, 5103})
+            .addField<&Optional::id>("id")
+            .addField<&Optional::value>("value")
+            .build();
+    return dt;
+}
+
+static const DataType& getChoiceDataType() {
+    static const DataType dt =
+        DataTypeBuilder<Choice>::createUnion("Choice", {1, 5004}, {1, 5104})
+            .addUnionField<&Choice::fields, double>("value")
+            .addUnionField<&Choice::fields, UA_String>("text", UA_TYPES[UA_TYPES_STRING])
+            .build();
+    return dt;
+}
+
+#if UAPP_OPEN62541_VER_GE(1, 3)
+
+static Span<const uint8_t> asBytes(const ByteString& bytes) {
+    return {bytes->data, bytes->length};
+}
+
+/// Encode/decode a custom type directly, wrapped in an ExtensionObject and in a Variant.
+/// Custom types are unknown to the decoder, ExtensionObjects are decoded on demand with
+/// ExtensionObject::getDecodedData.
+template <typename T>
+static void benchmarkScalar(
+    ankerl::nanobench::Bench& bench, const std::string& name, T value, const DataType& dataType
+) {
+    const auto encoded = encodeBinary(value, dataType);
+    run(bench, "encodeBinary(" + name + ")", [&] {
+        doNotOptimizeAway(encodeBinary(value, dataType));
+    });
+    run(bench, "decodeBinary(" + name + ")", [&] {
+        auto decoded = decodeBinary<T>(asBytes(encoded), dataType);
+        doNotOptimizeAway(decoded);
+        UA_clear(&decoded, dataType.handle());
+    });
+
+    const auto object = ExtensionObject::fromDecoded(&value, dataType);
+    const auto encodedObject = encodeBinary(object);
+    run(bench, "encodeBinary(ExtensionObject(" + name + "))", [&] {
+        doNotOptimizeAway(encodeBinary(object));
+    });
+    run(bench, "decodeBinary(ExtensionObject(" + name + "))", [&] {
+        auto decoded = decodeBinary<ExtensionObject>(asBytes(encodedObject));
+        doNotOptimizeAway(decoded.getDecodedData(dataType));
+    });
+
+    run(bench, "Variant(" + name + ") round trip", [&] {
+        const auto encodedVariant = encodeBinary(Variant::fromScalar(value, dataType));
+        auto decoded = decodeBinary<Variant>(asBytes(encodedVariant));
+        doNotOptimizeAway(decoded.getScalar<ExtensionObject>().getDecodedData(dataType));
+    });
+}
+
+/// Encode/decode an array of custom types in a Variant (array of ExtensionObjects).
+template <typename T>
+static void benchmarkArray(
+    ankerl::nanobench::Bench& bench,
+    const std::string& name,
+    const std::vector<T>& values,
+    const DataType& dataType
+) {
+    const auto variant = Variant::fromArray(values, dataType);
+    const auto encoded = encodeBinary(variant);
+    const auto suffix = name + "[" + std::to_string(values.size()) + "]";
+    run(bench, "encodeBinary(Variant(" + suffix + "))", [&] {
+        doNotOptimizeAway(encodeBinary(variant));
+    });
+    run(bench, "decodeBinary(Variant(" + suffix + "))", [&] {
+        auto decoded = decodeBinary<Variant>(asBytes(encoded));
+        for (auto& object : decoded.getArray<ExtensionObject>()) {
+            doNotOptimizeAway(object.getDecodedData(dataType));
+        }
+    });
+}
+
+/* ------------------------------------------ Loopback ------------------------------------------ */
+
+constexpr uint16_t loopbackPort = 4856;
+constexpr size_t loopbackArraySize = 1000;
+
+/// Server with custom data type arrays (ns=1;s=Packed, ns=1;s=Padded) in a background thread.
+class CustomDataTypeServer {
+public:
+    CustomDataTypeServer()
+        : server_(loopbackPort) {
+        server_.setLogger([](auto&&...) {});
+        server_.setCustomDataTypes({getPackedDataType(), getPaddedDataType()});
+        addArrayVariable(std::vector<Packed>(loopbackArraySize, {1.1, 1, 0}), getPackedDataType());
+        addArrayVariable(std::vector<Padded>(loopbackArraySize, {1, 1.1, 0}), getPaddedDataType());
+        server_.runIterate();
+        thread_ = std::thread([this] {
+            while (!stopFlag_) {
+                server_.runIterate();
+            }
+        });
+    }
+
+    ~CustomDataTypeServer() {
+        stopFlag_ = true;
+        thread_.join();
+    }
+
+    CustomDataTypeServer(const CustomDataTypeServer&) = delete;
+    CustomDataTypeServer(CustomDataTypeServer&&) = delete;
+    CustomDataTypeServer& operator=(const CustomDataTypeServer&) = delete;
+    CustomDataTypeServer& operator=(CustomDataTypeServer&&) = delete;
+
+private:
+    template <typename T>
+    void addArrayVariable(const std::vector<T>& values, const DataType& dataType) {
+        services::addDataType(
+            server_, DataTypeId::Structure, dataType.getTypeId(), dataType.getTypeName()
+        );
+        services::addVariable(
+            server_,
+            ObjectId::ObjectsFolder,
+            NodeId(1, dataType.getTypeName()),
+            dataType.getTypeName(),
+            VariableAttributes{}
+                .setDataType(dataType.getTypeId())
+                .setValueRank(ValueRank::OneDimension)
+                .setArrayDimensions({0})
+                .setValueArray(values, dataType)
+        );
+    }
+
+    Server server_;
+    std::atomic<bool> stopFlag_{false};
+    std::thread thread_;
+};
+
+/// Read arrays of custom types over loopback. The client decodes the arrays with the custom data
+/// types or forwards them as passthrough data types (decoded on demand).
+static void benchmarkLoopback(ankerl::nanobench::Bench& bench) {
+    const CustomDataTypeServer server;
+    const std::string url = "opc.tcp://localhost:" + std::to_string(loopbackPort);
+
+    Client client;
+    client.setLogger([](auto&&...) {});
+    client.setCustomDataTypes({getPackedDataType(), getPaddedDataType()});
+    client.connect(url);
+
+    Client passthroughClient;
+    passthroughClient.setLogger([](auto&&...) {});
+    passthroughClient.setPassthroughDataTypes({getPackedDataType(), getPaddedDataType()});
+    passthroughClient.connect(url);
+
+    for (const auto* dataType : {&getPackedDataType(), &getPaddedDataType()}) {
+        const NodeId id(1, dataType->getTypeName());
+        const auto suffix = std::string(dataType->getTypeName()) + "[" +
+                            std::to_string(loopbackArraySize) + "]";
+        run(bench, "read(" + suffix + ")", [&] {
+            doNotOptimizeAway(services::readValue(client, id));
+        });
+        run(bench, "read(" + suffix + ") passthrough", [&] {
+            doNotOptimizeAway(services::readValue(passthroughClient, id));
+        });
+        run(bench, "read(" + suffix + ") passthrough + getDecodedData", [&] {
+            auto value = services::readValue(passthroughClient, id);
+            for (auto& object : value.getArray<ExtensionObject>()) {
+                doNotOptimizeAway(object.getDecodedData(*dataType));
+            }
+        });
+    }
+
+    client.disconnect();
+    passthroughClient.disconnect();
+}
+
+#endif
+
+void benchmarkCustomDataType() {
+#if UAPP_OPEN62541_VER_GE(1, 3)
+    ankerl::nanobench::Bench bench;
+    bench.title("CustomDataType").warmup(100);
+
+    double optionalValue = 1.1;
+    Choice choice{};
+    choice.switchField = ChoiceSwitch::Value;
+    choice.fields.value = 1.1;  // NOLINT
+
+    benchmarkScalar(bench, "Packed", Packed{1.1, 1, 0}, getPackedDataType());
+    benchmarkScalar(bench, "Padded", Padded{1, 1.1, 0}, getPaddedDataType());
+    benchmarkScalar(bench, "Optional", Optional{1, &optionalValue}, getOptionalDataType());
+    benchmarkScalar(bench, "Optional(empty)", Optional{1, nullptr}, getOptionalDataType());
+    benchmarkScalar(bench, "Choice", choice, getChoiceDataType());
+
+    benchmarkArray(bench, "Packed", std::vector<Packed>(1000, {1.1, 1, 0}), getPackedDataType());
+    benchmarkArray(bench, "Padded", std::vector<Padded>(1000, {1, 1.1, 0}), getPaddedDataType());
+
+    bench.minEpochIterations(10);
+    benchmarkLoopback(bench);
+#endif
+}
+
+}  // namespace opcua::benchmarks
@@ -0,0 +1,59 @@
+#include <string>
+#include <utility>  // move
+
+#include <nanobench.h>
+
+#include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/Composed.h"
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/ExtensionObject.h"
+#include "open62541pp/types/NodeId.h"
+#include "open62541pp/types/Variant.h"
+
+#include "AllocationCounter.h"
+
+using namespace opcua;
+using ankerl::nanobench::doNotOptimizeAway;
+
+namespace opcua::benchmarks {
+
+template <typename T>
+static void benchmarkCopyMove(
+    ankerl::nanobench::Bench& bench, const std::string& name, const T& value
+) {
+    run(bench, name + " copy construct", [&] {
+        T copy(value);
+        doNotOptimizeAway(copy);
+    });
+    T target;
+    run(bench, name + " copy assign", [&] {
+        target = value;
+        doNotOptimizeAway(target);
+    });
+    T source(value);
+    run(bench, name + " move construct + assign", [&] {
+        T moved(std::move(source));
+        source = std::move(moved);
+        doNotOptimizeAway(source);
+    });
+}
+
+void benchmarkTypeWrapper() {
+    ankerl::nanobench::Bench bench;
+    bench.title("TypeWrapper").warmup(100);
+
+    benchmarkCopyMove(bench, "String", String("open62541pp"));
+    benchmarkCopyMove(bench, "NodeId", NodeId(1, "Demo.Static.Scalar.String"));
+    benchmarkCopyMove(bench, "DataValue", [] {
+        DataValue dv(Variant::fromScalar(String("open62541pp")));
+        dv.setSourceTimestamp(DateTime::now());
+        dv.setServerTimestamp(DateTime::now());
+        return dv;
+    }());
+    benchmarkCopyMove(bench, "ExtensionObject", [] {
+        const ReadValueId item(NodeId(1, "Demo.Static.Scalar.String"), AttributeId::Value);
+        return ExtensionObject::fromDecodedCopy(item);
+    }());
+}
+
+}  // namespace opcua::benchmarks
@@ -0,0 +1,115 @@
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <nanobench.h>
+
+#include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/Variant.h"
+
+#include "AllocationCounter.h"
+
+using namespace opcua;
+using ankerl::nanobench::doNotOptimizeAway;
+
+namespace opcua::benchmarks {
+
+static void benchmarkFromScalar(ankerl::nanobench::Bench& bench) {
+    int32_t value = 11;
+    String string("open62541pp");
+    std::string stdString("open62541pp");
+
+    run(bench, "fromScalar<Copy>(int32_t)", [&] {
+        doNotOptimizeAway(Variant::fromScalar<VariantPolicy::Copy>(value));
+    });
+    run(bench, "fromScalar<Reference>(int32_t)", [&] {
+        doNotOptimizeAway(Variant::fromScalar<VariantPolicy::Reference>(value));
+    });
+    run(bench, "fromScalar<ReferenceIfPossible>(int32_t)", [&] {
+        doNotOptimizeAway(Variant::fromScalar<VariantPolicy::ReferenceIfPossible>(value));
+    });
+    run(bench, "fromScalar<Copy>(String)", [&] {
+        doNotOptimizeAway(Variant::fromScalar<VariantPolicy::Copy>(string));
+    });
+    run(bench, "fromScalar<Reference>(String)", [&] {
+        doNotOptimizeAway(Variant::fromScalar<VariantPolicy::Reference>(string));
+    });
+    run(bench, "fromScalar<ReferenceIfPossible>(String)", [&] {
+        doNotOptimizeAway(Variant::fromScalar<VariantPolicy::ReferenceIfPossible>(string));
+    });
+    // conversion with TypeConverter, references are not possible
+    run(bench, "fromScalar<Copy>(std::string)", [&] {
+        doNotOptimizeAway(Variant::fromScalar<VariantPolicy::Copy>(stdString));
+    });
+    run(bench, "fromScalar<ReferenceIfPossible>(std::string)", [&] {
+        doNotOptimizeAway(Variant::fromScalar<VariantPolicy::ReferenceIfPossible>(stdString));
+    });
+}
+
+static void benchmarkFromArray(ankerl::nanobench::Bench& bench) {
+    std::vector<int32_t> values(1000, 11);
+    std::vector<String> strings(100, String("open62541pp"));
+    std::vector<std::string> stdStrings(100, "open62541pp");
+
+    run(bench, "fromArray<Copy>(int32_t[1000])", [&] {
+        doNotOptimizeAway(Variant::fromArray<VariantPolicy::Copy>(values));
+    });
+    run(bench, "fromArray<Reference>(int32_t[1000])", [&] {
+        doNotOptimizeAway(Variant::fromArray<VariantPolicy::Reference>(values));
+    });
+    run(bench, "fromArray<ReferenceIfPossible>(int32_t[1000])", [&] {
+        doNotOptimizeAway(Variant::fromArray<VariantPolicy::ReferenceIfPossible>(values));
+    });
+    run(bench, "fromArray<Copy>(String[100])", [&] {
+        doNotOptimizeAway(Variant::fromArray<VariantPolicy::Copy>(strings));
+    });
+    run(bench, "fromArray<Reference>(String[100])", [&] {
+        doNotOptimizeAway(Variant::fromArray<VariantPolicy::Reference>(strings));
+    });
+    run(bench, "fromArray<ReferenceIfPossible>(String[100])", [&] {
+        doNotOptimizeAway(Variant::fromArray<VariantPolicy::ReferenceIfPossible>(strings));
+    });
+    // conversion with TypeConverter, references are not possible
+    run(bench, "fromArray<Copy>(std::string[100])", [&] {
+        doNotOptimizeAway(Variant::fromArray<VariantPolicy::Copy>(stdStrings));
+    });
+    run(bench, "fromArray<ReferenceIfPossible>(std::string[100])", [&] {
+        doNotOptimizeAway(Variant::fromArray<VariantPolicy::ReferenceIfPossible>(stdStrings));
+    });
+}
+
+static void benchmarkCopy(ankerl::nanobench::Bench& bench) {
+    const auto scalarInt = Variant::fromScalar(int32_t{11});
+    const auto scalarString = Variant::fromScalar(String("open62541pp"));
+    const auto arrayInt = Variant::fromArray(std::vector<int32_t>(1000, 11));
+    const auto arrayString = Variant::fromArray(std::vector<String>(100, String("open62541pp")));
+
+    run(bench, "getScalarCopy<int32_t>", [&] {
+        doNotOptimizeAway(scalarInt.getScalarCopy<int32_t>());
+    });
+    run(bench, "getScalarCopy<String>", [&] {
+        doNotOptimizeAway(scalarString.getScalarCopy<String>());
+    });
+    run(bench, "getScalarCopy<std::string>", [&] {
+        doNotOptimizeAway(scalarString.getScalarCopy<std::string>());
+    });
+    run(bench, "getArrayCopy<int32_t>[1000]", [&] {
+        doNotOptimizeAway(arrayInt.getArrayCopy<int32_t>());
+    });
+    run(bench, "getArrayCopy<String>[100]", [&] {
+        doNotOptimizeAway(arrayString.getArrayCopy<String>());
+    });
+    run(bench, "getArrayCopy<std::string>[100]", [&] {
+        doNotOptimizeAway(arrayString.getArrayCopy<std::string>());
+    });
+}
+
+void benchmarkVariant() {
+    ankerl::nanobench::Bench bench;
+    bench.title("Variant").warmup(100);
+    benchmarkFromScalar(bench);
+    benchmarkFromArray(bench);
+    benchmarkCopy(bench);
+}
+
+}  // namespace opcua::benchmarks
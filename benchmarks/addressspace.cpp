@@ -0,0 +1,474 @@
+/**
+ * Benchmark of the address space construction and the startup of servers with large models.
+ *
+ * The model consists of objects with 9 double variables each (10 nodes per object), organized by
+ * the Objects folder. It is built with the different construction paths:
+ * - `node`: Node::addObject / Node::addVariable
+ * - `service`: services::addNode
+ * - `batch`: NodeBatch<Server>
+ * - `import`: importNodeSet of a generated NodeSet2 document (generation not measured)
+ *
+ * Reported are the wall time of the construction and of the server startup (first
+ * Server::runIterate), the peak resident memory during the construction and the resident memory
+ * per node. Additionally, the registration of a data source for all variables is measured with
+ * setVariableNodeValueBackend (per node) and the bulk overloads of setVariableNodeValueBackends.
+ * The wrapper overhead per variable is reported as the size of the node contexts (see
+ * MemoryCategory::NodeContext, only contexts of single registrations) and the size of a node
+ * context of the build profile (`default` or `low-memory`, see the CMake option UAPP_LOW_MEMORY).
+ * Resident memory is read from `/proc/self/status` (Linux only, 0 otherwise).
+ *
+ * Usage: addressspace [options]
+ *   --nodes <n,...>       Number of nodes of the model (default: 10000,100000,1000000)
+ *   --methods <m,...>     Construction paths: node, service, batch, import (default: all)
+ *   --json <file>         Write the results as JSON, `-` for stdout
+ */
+
+#include <algorithm>  // max
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "open62541pp/MemoryStatistics.h"
+#include "open62541pp/Node.h"
+#include "open62541pp/NodeBatch.h"
+#include "open62541pp/NodeSetImporter.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/ValueBackend.h"
+#include "open62541pp/detail/NodeContext.h"
+#include "open62541pp/open62541.h"
+#include "open62541pp/services/NodeManagement.h"
+
+#include "Common.h"
+
+using namespace opcua;
+using namespace opcua::benchmarks;
+using Clock = std::chrono::steady_clock;
+
+constexpr uint16_t port = 4852;
+constexpr uint16_t namespaceIndex = 1;
+constexpr size_t variablesPerObject = 9;
+
+enum class Method { Node, Service, Batch, Import };
+
+struct Options {
+    std::vector<size_t> nodes{10000, 100000, 1000000};
+    std::vector<Method> methods{Method::Node, Method::Service, Method::Batch, Method::Import};
+    std::string json;
+};
+
+struct ConstructionResult {
+    Method method{};
+    size_t nodes = 0;
+    double constructionSeconds = 0;
+    double startupSeconds = 0;
+    uint64_t peakResidentBytes = 0;
+    double residentBytesPerNode = 0;
+};
+
+struct RegistrationResult {
+    std::string_view method;
+    size_t variables = 0;
+    double seconds = 0;
+    double residentBytesPerVariable = 0;
+    double contextBytesPerVariable = 0;
+};
+
+#ifdef UAPP_LOW_MEMORY
+constexpr std::string_view profile = "low-memory";
+#else
+constexpr std::string_view profile = "default";
+#endif
+
+static std::string_view toString(Method method) {
+    switch (method) {
+    case Method::Node:
+        return "node";
+    case Method::Service:
+        return "service";
+    case Method::Batch:
+        return "batch";
+    case Method::Import:
+        return "import";
+    }
+    return "unknown";
+}
+
+static double getSeconds(Clock::time_point begin, Clock::time_point end) {
+    return std::chrono::duration<double>(end - begin).count();
+}
+
+/* ------------------------------------------- Memory ------------------------------------------- */
+
+static uint64_t getPeakResidentBytes() {
+    return readStatusBytes("VmHWM");
+}
+
+/// Reset the peak resident memory to the current resident memory (Linux >= 4.0).
+static void resetPeakResidentBytes() {
+    std::ofstream("/proc/self/clear_refs") << "5";
+}
+
+static double getBytesPer(uint64_t before, uint64_t after, size_t count) {
+    return after > before && count > 0
+        ? static_cast<double>(after - before) / static_cast<double>(count)
+        : 0;
+}
+
+/* -------------------------------------------- Model ------------------------------------------- */
+
+static size_t getObjectCount(size_t nodes) {
+    return std::max<size_t>(nodes / (1 + variablesPerObject), 1);
+}
+
+static uint32_t getObjectNumber(size_t object) {
+    return static_cast<uint32_t>(object * (1 + variablesPerObject) + 1);
+}
+
+static uint32_t getVariableNumber(size_t object, size_t variable) {
+    return static_cast<uint32_t>(getObjectNumber(object) + variable + 1);
+}
+
+static NodeId getObjectId(size_t object) {
+    return {namespaceIndex, getObjectNumber(object)};
+}
+
+static NodeId getVariableId(size_t object, size_t variable) {
+    return {namespaceIndex, getVariableNumber(object, variable)};
+}
+
+static VariableAttributes getVariableAttributes() {
+    return VariableAttributes{}
+        .setDataType<double>()
+        .setValueScalar(0.0)
+        .setAccessLevel(AccessLevel::CurrentRead | AccessLevel::CurrentWrite);
+}
+
+static void buildWithNode(Server& server, size_t nodes) {
+    auto objects = server.getObjectsNode();
+    const auto attributes = getVariableAttributes();
+    for (size_t o = 0; o < getObjectCount(nodes); ++o) {
+        auto object = objects.addObject(
+            getObjectId(o), "Object", {}, ObjectTypeId::BaseObjectType, ReferenceTypeId::Organizes
+        );
+        for (size_t v = 0; v < variablesPerObject; ++v) {
+            object.addVariable(getVariableId(o, v), "Variable", attributes);
+        }
+    }
+}
+
+static void buildWithService(Server& server, size_t nodes) {
+    const auto objectAttributes = ExtensionObject::fromDecodedCopy(ObjectAttributes{});
+    const auto variableAttributes = ExtensionObject::fromDecodedCopy(getVariableAttributes());
+    for (size_t o = 0; o < getObjectCount(nodes); ++o) {
+        services::addNode(
+            server,
+            NodeClass::Object,
+            ObjectId::ObjectsFolder,
+            getObjectId(o),
+            "Object",
+            objectAttributes,
+            ObjectTypeId::BaseObjectType,
+            ReferenceTypeId::Organizes
+        );
+        for (size_t v = 0; v < variablesPerObject; ++v) {
+            services::addNode(
+                server,
+                NodeClass::Variable,
+                getObjectId(o),
+                getVariableId(o, v),
+                "Variable",
+                variableAttributes,
+                VariableTypeId::BaseDataVariableType,
+                ReferenceTypeId::HasComponent
+            );
+        }
+    }
+}
+
+static void buildWithBatch(Server& server, size_t nodes) {
+    NodeBatch batch(server);
+    const auto attributes = getVariableAttributes();
+    for (size_t o = 0; o < getObjectCount(nodes); ++o) {
+        batch.addObject(
+            ObjectId::ObjectsFolder,
+            getObjectId(o),
+            "Object",
+            {},
+            ObjectTypeId::BaseObjectType,
+            ReferenceTypeId::Organizes
+        );
+        for (size_t v = 0; v < variablesPerObject; ++v) {
+            batch.addVariable(getObjectId(o), getVariableId(o, v), "Variable", attributes);
+        }
+    }
+    batch.commit();
+}
+
+static std::string generateNodeSet(size_t nodes) {
+    std::ostringstream xml;
+    xml << R"(<?xml version="1.0" encoding="utf-8"?>
+<UANodeSet xmlns="http://opcfoundation.org/UA/2011/03/UANodeSet.xsd"
+           xmlns:uax="http://opcfoundation.org/UA/2008/02/Types.xsd">
+  <NamespaceUris>
+    <Uri>http://open62541pp.github.io/benchmarks/addressspace/</Uri>
+  </NamespaceUris>
+  <Aliases>
+    <Alias Alias="Double">i=11</Alias>
+    <Alias Alias="Organizes">i=35</Alias>
+    <Alias Alias="HasComponent">i=47</Alias>
+    <Alias Alias="HasTypeDefinition">i=40</Alias>
+  </Aliases>
+)";
+    for (size_t o = 0; o < getObjectCount(nodes); ++o) {
+        const auto objectId = getObjectNumber(o);
+        xml << "  <UAObject NodeId=\"ns=1;i=" << objectId << "\" BrowseName=\"1:Object\">"
+            << "<DisplayName>Object</DisplayName><References>"
+            << "<Reference ReferenceType=\"Organizes\" IsForward=\"false\">i=85</Reference>"
+            << "<Reference ReferenceType=\"HasTypeDefinition\">i=58</Reference>"
+            << "</References></UAObject>\n";
+        for (size_t v = 0; v < variablesPerObject; ++v) {
+            xml << "  <UAVariable NodeId=\"ns=1;i=" << getVariableNumber(o, v)
+                << "\" BrowseName=\"1:Variable\" ParentNodeId=\"ns=1;i=" << objectId
+                << "\" DataType=\"Double\" AccessLevel=\"3\">"
+                << "<DisplayName>Variable</DisplayName><References>"
+                << "<Reference ReferenceType=\"HasTypeDefinition\">i=63</Reference>"
+                << "<Reference ReferenceType=\"HasComponent\" IsForward=\"false\">ns=1;i="
+                << objectId << "</Reference></References>"
+                << "<Value><uax:Double>0</uax:Double></Value></UAVariable>\n";
+        }
+    }
+    xml << "</UANodeSet>\n";
+    return xml.str();
+}
+
+static ConstructionResult runConstruction(Method method, size_t nodes) {
+    ConstructionResult result;
+    result.method = method;
+    result.nodes = getObjectCount(nodes) * (1 + variablesPerObject);
+
+    const auto xml = method == Method::Import ? generateNodeSet(nodes) : std::string{};
+    Server server(port);
+    server.setLogger([](auto&&...) {});
+
+    resetPeakResidentBytes();
+    const auto residentBefore = getResidentBytes();
+    const auto begin = Clock::now();
+    switch (method) {
+    case Method::Node:
+        buildWithNode(server, nodes);
+        break;
+    case Method::Service:
+        buildWithService(server, nodes);
+        break;
+    case Method::Batch:
+        buildWithBatch(server, nodes);
+        break;
+    case Method::Import: {
+        const auto imported = importNodeSet(server, xml);
+        if (!imported.errors.empty()) {
+            throw std::runtime_error("Import of the generated nodeset failed");
+        }
+        break;
+    }
+    }
+    const auto built = Clock::now();
+    const auto residentAfter = getResidentBytes();
+    result.peakResidentBytes = getPeakResidentBytes();
+    server.runIterate();  // startup
+    const auto started = Clock::now();
+
+    result.constructionSeconds = getSeconds(begin, built);
+    result.startupSeconds = getSeconds(built, started);
+    result.residentBytesPerNode = getBytesPer(residentBefore, residentAfter, result.nodes);
+    return result;
+}
+
+/* ---------------------------------------- Registration ---------------------------------------- */
+
+static ValueBackendDataSource createDataSource() {
+    ValueBackendDataSource backend;
+    backend.read = [](DataValue& value, const NumericRange& /*range*/, bool /*timestamp*/) {
+        value.setValue(Variant::fromScalar(1.0));
+        return StatusCode{};
+    };
+    return backend;
+}
+
+static RegistrationResult runRegistration(std::string_view method, size_t nodes) {
+    Server server(port);
+    server.setLogger([](auto&&...) {});
+    buildWithBatch(server, nodes);
+
+    std::vector<NodeId> ids;
+    for (size_t o = 0; o < getObjectCount(nodes); ++o) {
+        for (size_t v = 0; v < variablesPerObject; ++v) {
+            ids.push_back(getVariableId(o, v));
+        }
+    }
+
+    RegistrationResult result;
+    result.method = method;
+    result.variables = ids.size();
+    const auto residentBefore = getResidentBytes();
+    const auto begin = Clock::now();
+    if (method == "single") {
+        const auto backend = createDataSource();
+        for (const auto& id : ids) {
+            server.setVariableNodeValueBackend(id, backend);
+        }
+    } else if (method == "shared") {
+        server.setVariableNodeValueBackends(ids, createDataSource());
+    } else if (method == "factory") {
+        server.setVariableNodeValueBackends(ids, [](const NodeId& /*id*/) {
+            return createDataSource();
+        });
+    }
+    result.seconds = getSeconds(begin, Clock::now());
+    result.residentBytesPerVariable = getBytesPer(residentBefore, getResidentBytes(), ids.size());
+    const auto statistics = server.getMemoryStatistics();
+    if (const auto* contexts = statistics.findCategory(MemoryCategory::NodeContext)) {
+        result.contextBytesPerVariable =
+            static_cast<double>(contexts->currentBytes) / static_cast<double>(ids.size());
+    }
+    return result;
+}
+
+/* ------------------------------------------- Output ------------------------------------------- */
+
+static void printConstructionHeader(std::ostream& os) {
+    os << "| method  |   nodes | construction [s] | startup [s] | peak rss [MiB] | rss/node [B]\n";
+    os << "|---------|--------:|-----------------:|------------:|---------------:|------------:\n";
+}
+
+static void printConstruction(std::ostream& os, const ConstructionResult& result) {
+    os << std::fixed << std::setprecision(3) << "| " << std::left << std::setw(7)
+       << toString(result.method) << std::right << " | " << std::setw(7) << result.nodes << " | "
+       << std::setw(16) << result.constructionSeconds << " | " << std::setw(11)
+       << result.startupSeconds << " | " << std::setw(14)
+       << static_cast<double>(result.peakResidentBytes) / (1024.0 * 1024.0) << " | "
+       << std::setw(11) << result.residentBytesPerNode << "\n"
+       << std::flush;
+}
+
+static void printRegistrationHeader(std::ostream& os) {
+    os << "\n| registration | variables | time [s] | rss/variable [B] | context/variable [B]\n";
+    os << "|--------------|----------:|---------:|-----------------:|--------------------:\n";
+}
+
+static void printRegistration(std::ostream& os, const RegistrationResult& result) {
+    os << std::fixed << std::setprecision(3) << "| " << std::left << std::setw(12)
+       << result.method << std::right << " | " << std::setw(9) << result.variables << " | "
+       << std::setw(8) << result.seconds << " | " << std::setw(16)
+       << result.residentBytesPerVariable << " | " << std::setw(20)
+       << result.contextBytesPerVariable << "\n"
+       << std::flush;
+}
+
+/// Write the results as JSON, the schema is stable to compare results across releases.
+static void writeJson(
+    std::ostream& os,
+    const std::vector<ConstructionResult>& constructions,
+    const std::vector<RegistrationResult>& registrations
+) {
+    os << "{\n";
+    os << "  \"benchmark\": \"addressspace\",\n";
+    os << "  \"profile\": \"" << profile << "\",\n";
+    os << "  \"nodeContextBytes\": " << sizeof(detail::NodeContext) << ",\n";
+#ifdef UAPP_VERSION
+    os << "  \"version\": \"" << UAPP_VERSION << "\",\n";
+#endif
+#ifdef UA_OPEN62541_VERSION
+    os << "  \"open62541Version\": \"" << UA_OPEN62541_VERSION << "\",\n";
+#endif
+    os << "  \"construction\": [";
+    for (size_t i = 0; i < constructions.size(); ++i) {
+        const auto& result = constructions[i];
+        os << (i == 0 ? "\n" : ",\n") << "    {"
+           << "\"method\": \"" << toString(result.method) << "\", "
+           << "\"nodes\": " << result.nodes << ", "
+           << "\"constructionSeconds\": " << result.constructionSeconds << ", "
+           << "\"startupSeconds\": " << result.startupSeconds << ", "
+           << "\"peakResidentBytes\": " << result.peakResidentBytes << ", "
+           << "\"residentBytesPerNode\": " << result.residentBytesPerNode << "}";
+    }
+    os << "\n  ],\n";
+    os << "  \"registration\": [";
+    for (size_t i = 0; i < registrations.size(); ++i) {
+        const auto& result = registrations[i];
+        os << (i == 0 ? "\n" : ",\n") << "    {"
+           << "\"method\": \"" << result.method << "\", "
+           << "\"variables\": " << result.variables << ", "
+           << "\"seconds\": " << result.seconds << ", "
+           << "\"residentBytesPerVariable\": " << result.residentBytesPerVariable << ", "
+           << "\"contextBytesPerVariable\": " << result.contextBytesPerVariable << "}";
+    }
+    os << "\n  ]\n}\n";
+}
+
+/* ------------------------------------------- Options ------------------------------------------ */
+
+static Options parseOptions(int argc, char* argv[]) {  // NOLINT
+    Options options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const std::string_view key(argv[i]);  // NOLINT
+        const std::string value(argv[i + 1]);  // NOLINT
+        if (key == "--nodes") {
+            options.nodes.clear();
+            for (const auto& item : split(value)) {
+                options.nodes.push_back(std::stoull(item));
+            }
+        } else if (key == "--methods") {
+            options.methods.clear();
+            for (const auto& item : split(value)) {
+                for (auto method : {Method::Node, Method::Service, Method::Batch, Method::Import}) {
+                    if (item == toString(method)) {
+                        options.methods.push_back(method);
+                    }
+                }
+            }
+        } else if (key == "--json") {
+            options.json = value;
+        } else {
+            throw std::invalid_argument("Unknown option: " + std::string(key));
+        }
+    }
+    return options;
+}
+
+int main(int argc, char* argv[]) {
+    const auto options = parseOptions(argc, argv);
+    std::vector<ConstructionResult> constructions;
+    std::vector<RegistrationResult> registrations;
+    std::cout << "profile: " << profile << ", node context: " << sizeof(detail::NodeContext)
+              << " B\n\n";
+    printConstructionHeader(std::cout);
+    for (auto nodes : options.nodes) {
+        for (auto method : options.methods) {
+            constructions.push_back(runConstruction(method, nodes));
+            printConstruction(std::cout, constructions.back());
+        }
+    }
+    printRegistrationHeader(std::cout);
+    for (auto nodes : options.nodes) {
+        for (std::string_view method : {"single", "shared", "factory"}) {
+            registrations.push_back(runRegistration(method, nodes));
+            printRegistration(std::cout, registrations.back());
+        }
+    }
+    if (options.json == "-") {
+        writeJson(std::cout, constructions, registrations);
+    } else if (!options.json.empty()) {
+        std::ofstream file(options.json);
+        writeJson(file, constructions, registrations);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,460 @@
+/**
+ * Benchmark of browsing and crawling synthetic hierarchies on the server and the client.
+ *
+ * Hierarchies:
+ * - `wide`: folder with N variable children (default: 100000)
+ * - `deep`: chain of D objects (default: 20), each with F variable leaves (default: 5)
+ *
+ * Operations:
+ * - `browseAll`: all forward references of the root (client: Browse + BrowseNext)
+ * - `browseRecursive`: all hierarchical descendants of the root
+ * - `translateBrowsePath`: path from the root to the last node of the hierarchy
+ *
+ * Reported are the wall time, the issued requests (client metrics) and the transferred bytes per
+ * operation. The client is connected via a counting TCP relay to measure the bytes in both
+ * directions. Server-side operations are local calls, without requests and transferred bytes.
+ * The relay requires POSIX sockets.
+ *
+ * Usage: browse [options]
+ *   --width <n>           Children of the wide hierarchy (default: 100000)
+ *   --depth <n>           Depth of the deep hierarchy (default: 20)
+ *   --fanout <n>          Leaves per level of the deep hierarchy (default: 5)
+ *   --iterations <n>      Iterations of each operation (default: 5)
+ *   --json <file>         Write the results as JSON, `-` for stdout
+ */
+
+#include <algorithm>  // max
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "open62541pp/Client.h"
+#include "open62541pp/ClientMetrics.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/open62541.h"
+#include "open62541pp/services/NodeManagement.h"
+#include "open62541pp/services/View.h"
+
+using namespace opcua;
+using Clock = std::chrono::steady_clock;
+
+constexpr uint16_t serverPort = 4853;
+constexpr uint16_t relayPort = 4854;
+constexpr std::string_view relayUrl{"opc.tcp://localhost:4854"};
+constexpr uint16_t namespaceIndex = 1;
+
+struct Options {
+    size_t width = 100000;
+    size_t depth = 20;
+    size_t fanout = 5;
+    size_t iterations = 5;
+    std::string json;
+};
+
+struct Result {
+    std::string_view hierarchy;
+    std::string_view operation;
+    std::string_view connection;
+    size_t found = 0;  ///< References or nodes found per operation
+    double requests = 0;
+    double bytes = 0;
+    double milliseconds = 0;
+};
+
+/* ------------------------------------------- Relay -------------------------------------------- */
+
+/// TCP relay on the loopback interface, counting the forwarded bytes in both directions.
+class CountingRelay {
+public:
+    CountingRelay(uint16_t listenPort, uint16_t targetPort)
+        : listener_(::socket(AF_INET, SOCK_STREAM, 0)),
+          targetPort_(targetPort) {
+        const int reuse = 1;
+        ::setsockopt(listener_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+        const auto address = getLoopbackAddress(listenPort);
+        if (::bind(listener_, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 ||
+            ::listen(listener_, 4) != 0) {
+            ::close(listener_);
+            throw std::runtime_error("Relay can not listen on port " + std::to_string(listenPort));
+        }
+        acceptThread_ = std::thread([this] { acceptLoop(); });
+    }
+
+    ~CountingRelay() {
+        stop_ = true;
+        acceptThread_.join();
+        for (auto& thread : connections_) {
+            thread.join();
+        }
+        ::close(listener_);
+    }
+
+    CountingRelay(const CountingRelay&) = delete;
+    CountingRelay(CountingRelay&&) = delete;
+    CountingRelay& operator=(const CountingRelay&) = delete;
+    CountingRelay& operator=(CountingRelay&&) = delete;
+
+    /// Forwarded bytes in both directions.
+    uint64_t getBytes() const noexcept {
+        return bytes_.load(std::memory_order_relaxed);
+    }
+
+private:
+    static sockaddr_in getLoopbackAddress(uint16_t port) {
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(port);
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        return address;
+    }
+
+    void acceptLoop() {
+        while (!stop_) {
+            pollfd fd{listener_, POLLIN, 0};
+            if (::poll(&fd, 1, 100) <= 0) {
+                continue;
+            }
+            const int client = ::accept(listener_, nullptr, nullptr);
+            if (client < 0) {
+                continue;
+            }
+            const std::lock_guard lock(mutex_);
+            connections_.emplace_back([this, client] { forward(client); });
+        }
+    }
+
+    void forward(int client) {
+        const int target = ::socket(AF_INET, SOCK_STREAM, 0);
+        const auto address = getLoopbackAddress(targetPort_);
+        if (::connect(target, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+            ::close(target);
+            ::close(client);
+            return;
+        }
+        std::vector<char> buffer(65536);
+        pollfd fds[2] = {{client, POLLIN, 0}, {target, POLLIN, 0}};  // NOLINT
+        bool open = true;
+        while (open && !stop_) {
+            if (::poll(fds, 2, 100) <= 0) {
+                continue;
+            }
+            for (int i = 0; i < 2 && open; ++i) {
+                if ((fds[i].revents & (POLLIN | POLLHUP | POLLERR)) == 0) {  // NOLINT
+                    continue;
+                }
+                const auto received = ::recv(fds[i].fd, buffer.data(), buffer.size(), 0);  // NOLINT
+                open = received > 0 && sendAll(fds[1 - i].fd, buffer.data(), received);  // NOLINT
+                if (open) {
+                    bytes_.fetch_add(static_cast<uint64_t>(received), std::memory_order_relaxed);
+                }
+            }
+        }
+        ::close(target);
+        ::close(client);
+    }
+
+    static bool sendAll(int fd, const char* data, ssize_t size) {
+        while (size > 0) {
+            const auto sent = ::send(fd, data, static_cast<size_t>(size), MSG_NOSIGNAL);
+            if (sent <= 0) {
+                return false;
+            }
+            data += sent;  // NOLINT
+            size -= sent;
+        }
+        return true;
+    }
+
+    int listener_;
+    uint16_t targetPort_;
+    std::atomic<bool> stop_{false};
+    std::atomic<uint64_t> bytes_{0};
+    std::mutex mutex_;
+    std::vector<std::thread> connections_;  // guarded by mutex_
+    std::thread acceptThread_;
+};
+
+/* ----------------------------------------- Hierarchies ---------------------------------------- */
+
+struct Hierarchy {
+    std::string_view name;
+    NodeId root;
+    std::vector<QualifiedName> pathToLast;  ///< Browse path from the root to the last node
+};
+
+static Hierarchy buildWide(Server& server, size_t width) {
+    Hierarchy hierarchy{"wide", NodeId(namespaceIndex, 1), {}};
+    services::addFolder(server, ObjectId::ObjectsFolder, hierarchy.root, "Wide");
+    for (size_t i = 0; i < width; ++i) {
+        const auto name = "Child" + std::to_string(i);
+        services::addVariable(
+            server, hierarchy.root, NodeId(namespaceIndex, static_cast<uint32_t>(100 + i)), name
+        );
+        if (i + 1 == width) {
+            hierarchy.pathToLast.emplace_back(namespaceIndex, name);
+        }
+    }
+    return hierarchy;
+}
+
+static Hierarchy buildDeep(Server& server, size_t depth, size_t fanout, uint32_t firstId) {
+    Hierarchy hierarchy{"deep", NodeId(namespaceIndex, 2), {}};
+    services::addObject(server, ObjectId::ObjectsFolder, hierarchy.root, "Deep");
+    auto parent = hierarchy.root;
+    auto id = firstId;
+    for (size_t level = 1; level <= depth; ++level) {
+        const auto name = "Level" + std::to_string(level);
+        const NodeId levelId(namespaceIndex, id++);
+        services::addObject(server, parent, levelId, name);
+        hierarchy.pathToLast.emplace_back(namespaceIndex, name);
+        for (size_t leaf = 0; leaf < fanout; ++leaf) {
+            services::addVariable(
+                server, levelId, NodeId(namespaceIndex, id++), "Leaf" + std::to_string(leaf)
+            );
+        }
+        parent = levelId;
+    }
+    return hierarchy;
+}
+
+/* -------------------------------------------- Client ------------------------------------------ */
+
+static uint64_t getTotalRequests(Client& client) {
+    uint64_t requests = 0;
+    for (const auto& service : client.getMetrics().services) {
+        requests += service.requests;
+    }
+    return requests;
+}
+
+static BrowseDescription getForward(const NodeId& root, const NodeId& referenceType) {
+    return {root, BrowseDirection::Forward, referenceType};
+}
+
+static Result makeResult(
+    const Hierarchy& hierarchy, std::string_view operation, std::string_view connection
+) {
+    Result result;
+    result.hierarchy = hierarchy.name;
+    result.operation = operation;
+    result.connection = connection;
+    return result;
+}
+
+/// Run an operation `iterations` times and measure the mean wall time, requests and bytes.
+template <typename Connection>
+static Result measure(
+    const Options& options,
+    Connection& connection,
+    const CountingRelay* relay,
+    Result result,
+    const std::function<size_t()>& operation
+) {
+    constexpr bool isClient = std::is_same_v<Connection, Client>;
+    [[maybe_unused]] uint64_t requestsBefore = 0;
+    if constexpr (isClient) {
+        requestsBefore = getTotalRequests(connection);
+    }
+    const auto bytesBefore = relay != nullptr ? relay->getBytes() : 0;
+    const auto begin = Clock::now();
+    for (size_t i = 0; i < options.iterations; ++i) {
+        result.found = operation();
+    }
+    const auto end = Clock::now();
+    const auto iterations = static_cast<double>(options.iterations);
+    if constexpr (isClient) {
+        result.requests =
+            static_cast<double>(getTotalRequests(connection) - requestsBefore) / iterations;
+    }
+    if (relay != nullptr) {
+        result.bytes = static_cast<double>(relay->getBytes() - bytesBefore) / iterations;
+    }
+    result.milliseconds = std::chrono::duration<double, std::milli>(end - begin).count() /
+                          iterations;
+    return result;
+}
+
+static void runServer(
+    const Options& options, Server& server, const Hierarchy& h, std::vector<Result>& results
+) {
+    const auto base = [&](std::string_view operation) {
+        return makeResult(h, operation, "server");
+    };
+    results.push_back(measure(options, server, nullptr, base("browseAll"), [&] {
+        return services::browseAll(server, getForward(h.root, ReferenceTypeId::References)).size();
+    }));
+    results.push_back(measure(options, server, nullptr, base("browseRecursive"), [&] {
+        const auto bd = getForward(h.root, ReferenceTypeId::HierarchicalReferences);
+        return services::browseRecursive(server, bd).size();
+    }));
+    results.push_back(measure(options, server, nullptr, base("translateBrowsePath"), [&] {
+        return services::browseSimplifiedBrowsePath(server, h.root, h.pathToLast)
+            .getTargets()
+            .size();
+    }));
+}
+
+static void runClient(
+    const Options& options,
+    Client& client,
+    const CountingRelay& relay,
+    const Hierarchy& h,
+    std::vector<Result>& results
+) {
+    const auto base = [&](std::string_view operation) {
+        return makeResult(h, operation, "client");
+    };
+    results.push_back(measure(options, client, &relay, base("browseAll"), [&] {
+        return services::browseAll(client, getForward(h.root, ReferenceTypeId::References)).size();
+    }));
+    results.push_back(measure(options, client, &relay, base("browseRecursive"), [&] {
+        size_t references = 0;
+        services::browseRecursive(
+            client,
+            getForward(h.root, ReferenceTypeId::HierarchicalReferences),
+            [&](const NodeId& /*sourceId*/, const ReferenceDescription& /*reference*/) {
+                ++references;
+            }
+        );
+        return references;
+    }));
+    results.push_back(measure(options, client, &relay, base("translateBrowsePath"), [&] {
+        return services::browseSimplifiedBrowsePath(client, h.root, h.pathToLast)
+            .getTargets()
+            .size();
+    }));
+}
+
+/* ------------------------------------------- Output ------------------------------------------- */
+
+static void printResults(std::ostream& os, const std::vector<Result>& results) {
+    os << "| hierarchy | operation           | connection |   found | requests/op |    bytes/op |"
+          " time/op [ms]\n";
+    os << "|-----------|---------------------|------------|--------:|------------:|------------:|"
+          "------------:\n";
+    for (const auto& result : results) {
+        os << std::fixed << std::setprecision(2) << "| " << std::left << std::setw(9)
+           << result.hierarchy << " | " << std::setw(19) << result.operation << " | "
+           << std::setw(10) << result.connection << std::right << " | " << std::setw(7)
+           << result.found << " | " << std::setw(11) << result.requests << " | " << std::setw(11)
+           << result.bytes << " | " << std::setw(12) << result.milliseconds << "\n";
+    }
+}
+
+/// Write the results as JSON, the schema is stable to compare results across releases.
+static void writeJson(
+    std::ostream& os, const Options& options, const std::vector<Result>& results
+) {
+    os << "{\n";
+    os << "  \"benchmark\": \"browse\",\n";
+#ifdef UAPP_VERSION
+    os << "  \"version\": \"" << UAPP_VERSION << "\",\n";
+#endif
+#ifdef UA_OPEN62541_VERSION
+    os << "  \"open62541Version\": \"" << UA_OPEN62541_VERSION << "\",\n";
+#endif
+    os << "  \"width\": " << options.width << ",\n";
+    os << "  \"depth\": " << options.depth << ",\n";
+    os << "  \"fanout\": " << options.fanout << ",\n";
+    os << "  \"iterations\": " << options.iterations << ",\n";
+    os << "  \"results\": [";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& result = results[i];
+        os << (i == 0 ? "\n" : ",\n") << "    {"
+           << "\"hierarchy\": \"" << result.hierarchy << "\", "
+           << "\"operation\": \"" << result.operation << "\", "
+           << "\"connection\": \"" << result.connection << "\", "
+           << "\"found\": " << result.found << ", "
+           << "\"requestsPerOperation\": " << result.requests << ", "
+           << "\"bytesPerOperation\": " << result.bytes << ", "
+           << "\"millisecondsPerOperation\": " << result.milliseconds << "}";
+    }
+    os << "\n  ]\n}\n";
+}
+
+/* ------------------------------------------- Options ------------------------------------------ */
+
+static Options parseOptions(int argc, char* argv[]) {  // NOLINT
+    Options options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const std::string_view key(argv[i]);  // NOLINT
+        const std::string value(argv[i + 1]);  // NOLINT
+        if (key == "--width") {
+            options.width = std::stoull(value);
+        } else if (key == "--depth") {
+            options.depth = std::stoull(value);
+        } else if (key == "--fanout") {
+            options.fanout = std::stoull(value);
+        } else if (key == "--iterations") {
+            options.iterations = std::max<size_t>(std::stoull(value), 1);
+        } else if (key == "--json") {
+            options.json = value;
+        } else {
+            throw std::invalid_argument("Unknown option: " + std::string(key));
+        }
+    }
+    return options;
+}
+
+int main(int argc, char* argv[]) {
+    const auto options = parseOptions(argc, argv);
+    std::vector<Result> results;
+
+    Server server(serverPort);
+    server.setLogger([](auto&&...) {});
+    const auto wide = buildWide(server, options.width);
+    const auto deep = buildDeep(
+        server, options.depth, options.fanout, static_cast<uint32_t>(100 + options.width)
+    );
+
+    // server-side operations, before the server loop is started in the background thread
+    runServer(options, server, wide, results);
+    runServer(options, server, deep, results);
+
+    server.runIterate();
+    std::atomic<bool> stopFlag{false};
+    std::thread serverThread([&] {
+        while (!stopFlag) {
+            server.runIterate();
+        }
+    });
+    {
+        const CountingRelay relay(relayPort, serverPort);
+        Client client;
+        client.setLogger([](auto&&...) {});
+        client.setMetricsEnabled(true);
+        client.connect(relayUrl);
+        runClient(options, client, relay, wide, results);
+        runClient(options, client, relay, deep, results);
+        client.disconnect();
+    }
+    stopFlag = true;
+    serverThread.join();
+
+    printResults(std::cout, results);
+    if (options.json == "-") {
+        writeJson(std::cout, options, results);
+    } else if (!options.json.empty()) {
+        std::ofstream file(options.json);
+        writeJson(file, options, results);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,486 @@
+/**
+ * Concurrency stress benchmark of shared server access.
+ *
+ * M application threads call the server services (`services::readValue`, `services::writeValue`)
+ * or the Node<Server> API while the server loop runs in a background thread and K clients
+ * monitor all variables with a subscription. Reported are the operations per second, the scaling
+ * efficiency relative to the smallest thread count, the sampled p50/p99 latency of the operations
+ * and the consumed CPU cores. Lock contention (server mutex, ContextMap shards) shows up as
+ * scaling efficiency well below 100% with less CPU cores than threads.
+ *
+ * The values are verified during and after the run: every read must return an int64 value that
+ * was written by one of the application threads. The program exits with a failure if any
+ * operation failed, so a build with thread sanitizer (`UAPP_ENABLE_SANITIZER_THREAD`) doubles as
+ * correctness stress test.
+ *
+ * Concurrent server access requires open62541 with multithreading (UA_MULTITHREADING >= 100).
+ *
+ * Usage: concurrency [options]
+ *   --duration <seconds>      Measured duration of each case (default: 2)
+ *   --threads <m,...>         Number of application threads (default: 1,2,4,8)
+ *   --clients <k,...>         Number of subscribed clients (default: 0,4)
+ *   --nodes <n>               Number of variables (default: 100)
+ *   --operations <op,...>     Operations: read, write, node (default: all)
+ *   --json <file>             Write the results as JSON, `-` for stdout
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "open62541pp/Client.h"
+#include "open62541pp/Node.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/Subscription.h"
+#include "open62541pp/open62541.h"
+#include "open62541pp/services/Attribute_highlevel.h"
+#include "open62541pp/services/NodeManagement.h"
+
+#include "Common.h"
+
+#if UA_MULTITHREADING >= 100
+
+using namespace opcua;
+using namespace opcua::benchmarks;
+using Clock = std::chrono::steady_clock;
+
+constexpr uint16_t port = 4857;
+constexpr std::string_view serverUrl{"opc.tcp://localhost:4857"};
+constexpr uint16_t namespaceIndex = 1;
+constexpr size_t latencySampling = 16;  // record the latency of every 16th operation
+constexpr int threadShift = 40;  // written values: (thread + 1) << 40 | counter
+
+enum class Operation { Read, Write, Node };
+
+struct Options {
+    double duration = 2.0;
+    std::vector<size_t> threads{1, 2, 4, 8};
+    std::vector<size_t> clients{0, 4};
+    size_t nodes = 100;
+    std::vector<Operation> operations{Operation::Read, Operation::Write, Operation::Node};
+    std::string json;
+};
+
+struct Case {
+    Operation operation;
+    size_t threads;
+    size_t clients;
+};
+
+struct Result {
+    Case config;
+    uint64_t operations = 0;
+    uint64_t errors = 0;
+    uint64_t notifications = 0;
+    double seconds = 0;
+    double cpuSeconds = 0;
+    double efficiency = 0;  // relative to the smallest thread count
+    double p50Microseconds = 0;
+    double p99Microseconds = 0;
+};
+
+static std::string_view toString(Operation operation) {
+    switch (operation) {
+    case Operation::Read:
+        return "read";
+    case Operation::Write:
+        return "write";
+    case Operation::Node:
+        return "node";
+    }
+    return "unknown";
+}
+
+static NodeId getVariableId(size_t index) {
+    return {namespaceIndex, static_cast<uint32_t>(index + 1)};
+}
+
+/// Check if the value was written by one of the application threads (or is the initial value).
+static bool isValid(const Variant& value, size_t threads) {
+    if (!value.isScalar() || !value.isType<int64_t>()) {
+        return false;
+    }
+    const auto thread = value.getScalar<int64_t>() >> threadShift;
+    return thread >= 0 && static_cast<size_t>(thread) <= threads;
+}
+
+/* ------------------------------------------- Server ------------------------------------------- */
+
+/// Server with `nodes` int64 variables (ns=1;i=1..nodes) running in a background thread.
+class ConcurrencyServer {
+public:
+    explicit ConcurrencyServer(size_t nodes) : server_(port) {
+        server_.setLogger([](auto&&...) {});
+        for (size_t i = 0; i < nodes; ++i) {
+            services::addVariable(
+                server_,
+                ObjectId::ObjectsFolder,
+                getVariableId(i),
+                "Variable",
+                VariableAttributes{}
+                    .setDataType<int64_t>()
+                    .setValueScalar(int64_t{0})
+                    .setAccessLevel(AccessLevel::CurrentRead | AccessLevel::CurrentWrite)
+            );
+        }
+        server_.runIterate();
+        thread_ = std::thread([this] {
+            while (!stopFlag_) {
+                server_.runIterate();
+            }
+        });
+    }
+
+    ~ConcurrencyServer() {
+        stopFlag_ = true;
+        thread_.join();
+    }
+
+    ConcurrencyServer(const ConcurrencyServer&) = delete;
+    ConcurrencyServer(ConcurrencyServer&&) = delete;
+    ConcurrencyServer& operator=(const ConcurrencyServer&) = delete;
+    ConcurrencyServer& operator=(ConcurrencyServer&&) = delete;
+
+    Server& get() noexcept {
+        return server_;
+    }
+
+private:
+    Server server_;
+    std::atomic<bool> stopFlag_{false};
+    std::thread thread_;
+};
+
+/* ----------------------------------------- Subscribers ---------------------------------------- */
+
+/// Client monitoring all variables in a background thread.
+class Subscriber {
+public:
+    Subscriber(size_t nodes, std::atomic<uint64_t>& notifications)
+        : notifications_(notifications) {
+        client_.setLogger([](auto&&...) {});
+        client_.connect(serverUrl);
+        SubscriptionParameters subscriptionParameters{};
+        subscriptionParameters.publishingInterval = 50.0;
+        auto subscription = client_.createSubscription(
+            subscriptionParameters,
+            [this](uint32_t /*subId*/, Span<services::MonitoredItemNotification> items) {
+                notifications_.fetch_add(items.size(), std::memory_order_relaxed);
+            }
+        );
+        std::vector<ReadValueId> itemsToMonitor;
+        for (size_t i = 0; i < nodes; ++i) {
+            itemsToMonitor.emplace_back(getVariableId(i), AttributeId::Value);
+        }
+        MonitoringParameters monitoringParameters{};
+        monitoringParameters.samplingInterval = 10.0;
+        subscription.subscribeDataChangeMany(
+            itemsToMonitor, MonitoringMode::Reporting, monitoringParameters, {}
+        );
+        thread_ = std::thread([this] {
+            while (!stopFlag_) {
+                client_.runIterate(10);
+            }
+        });
+    }
+
+    ~Subscriber() {
+        stopFlag_ = true;
+        thread_.join();
+        client_.disconnect();
+    }
+
+    Subscriber(const Subscriber&) = delete;
+    Subscriber(Subscriber&&) = delete;
+    Subscriber& operator=(const Subscriber&) = delete;
+    Subscriber& operator=(Subscriber&&) = delete;
+
+private:
+    Client client_;
+    std::atomic<uint64_t>& notifications_;
+    std::atomic<bool> stopFlag_{false};
+    std::thread thread_;
+};
+
+/* ----------------------------------------- Application ---------------------------------------- */
+
+struct ThreadMeasurement {
+    uint64_t operations = 0;
+    uint64_t errors = 0;
+    std::vector<int64_t> latencies;  // ns, sampled
+};
+
+static bool execute(
+    Server& server, Operation operation, size_t thread, size_t threads, size_t nodes, int64_t i
+) {
+    const auto id = getVariableId(static_cast<size_t>(i) % nodes);
+    const int64_t value = (static_cast<int64_t>(thread + 1) << threadShift) | i;
+    switch (operation) {
+    case Operation::Read:
+        return isValid(services::readValue(server, id), threads);
+    case Operation::Write:
+        services::writeValue(server, id, Variant::fromScalar(value));
+        return true;
+    case Operation::Node: {
+        auto node = server.getNode(id);
+        node.writeValueScalar(value);
+        return isValid(node.readValue(), threads);
+    }
+    }
+    return false;
+}
+
+static void runThread(
+    Server& server,
+    const Case& config,
+    size_t thread,
+    size_t nodes,
+    Clock::time_point start,
+    Clock::time_point stop,
+    ThreadMeasurement& measurement
+) {
+    for (int64_t i = 0;; ++i) {
+        const auto begin = Clock::now();
+        if (begin >= stop) {
+            break;
+        }
+        bool good = false;
+        try {
+            good = execute(server, config.operation, thread, config.threads, nodes, i);
+        } catch (const std::exception&) {
+            good = false;
+        }
+        if (begin < start) {
+            continue;  // warmup
+        }
+        ++measurement.operations;
+        if (!good) {
+            ++measurement.errors;
+        }
+        if (static_cast<size_t>(i) % latencySampling == 0) {
+            measurement.latencies.push_back(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - begin)
+                    .count()
+            );
+        }
+    }
+}
+
+static Result runCase(ConcurrencyServer& server, const Case& config, const Options& options) {
+    std::atomic<uint64_t> notifications{0};
+    std::vector<std::unique_ptr<Subscriber>> subscribers;
+    for (size_t k = 0; k < config.clients; ++k) {
+        subscribers.push_back(std::make_unique<Subscriber>(options.nodes, notifications));
+    }
+
+    const auto warmup = std::chrono::milliseconds(200);
+    const auto start = Clock::now() + warmup;
+    const auto stop = start + std::chrono::duration_cast<Clock::duration>(
+                                  std::chrono::duration<double>(options.duration)
+                              );
+    std::vector<ThreadMeasurement> measurements(config.threads);
+    std::vector<std::thread> threads;
+    for (size_t m = 0; m < config.threads; ++m) {
+        threads.emplace_back([&, m] {
+            runThread(server.get(), config, m, options.nodes, start, stop, measurements[m]);
+        });
+    }
+    std::this_thread::sleep_until(start);
+    const auto notificationsBefore = notifications.load();
+    const auto cpuBefore = getCpuSeconds();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const auto cpuAfter = getCpuSeconds();
+
+    Result result;
+    result.config = config;
+    result.seconds = options.duration;
+    result.cpuSeconds = cpuAfter - cpuBefore;
+    result.notifications = notifications.load() - notificationsBefore;
+    std::vector<int64_t> latencies;
+    for (const auto& measurement : measurements) {
+        result.operations += measurement.operations;
+        result.errors += measurement.errors;
+        latencies.insert(
+            latencies.end(), measurement.latencies.begin(), measurement.latencies.end()
+        );
+    }
+    std::sort(latencies.begin(), latencies.end());
+    result.p50Microseconds = static_cast<double>(getPercentile(latencies, 0.50)) / 1000.0;
+    result.p99Microseconds = static_cast<double>(getPercentile(latencies, 0.99)) / 1000.0;
+
+    // verify the final values
+    for (size_t i = 0; i < options.nodes; ++i) {
+        if (!isValid(services::readValue(server.get(), getVariableId(i)), config.threads)) {
+            ++result.errors;
+        }
+    }
+    return result;
+}
+
+/* ------------------------------------------- Output ------------------------------------------- */
+
+static double getOperationsPerSecond(const Result& result) {
+    return result.seconds > 0 ? static_cast<double>(result.operations) / result.seconds : 0;
+}
+
+/// Scaling efficiency: throughput per thread relative to the case with the smallest thread count.
+static void computeEfficiency(std::vector<Result>& results) {
+    for (auto& result : results) {
+        const Result* baseline = nullptr;
+        for (const auto& other : results) {
+            if (other.config.operation == result.config.operation &&
+                other.config.clients == result.config.clients &&
+                (baseline == nullptr || other.config.threads < baseline->config.threads)) {
+                baseline = &other;
+            }
+        }
+        const auto baselinePerThread =
+            getOperationsPerSecond(*baseline) / static_cast<double>(baseline->config.threads);
+        if (baselinePerThread > 0) {
+            result.efficiency = getOperationsPerSecond(result) /
+                                (baselinePerThread * static_cast<double>(result.config.threads));
+        }
+    }
+}
+
+static void printHeader(std::ostream& os) {
+    os << "| operation | threads | clients |   operations/s | efficiency |  p50 [us] |"
+          "  p99 [us] | cpu cores | notifications/s | errors\n";
+    os << "|-----------|--------:|--------:|---------------:|-----------:|----------:|"
+          "----------:|----------:|----------------:|-------:\n";
+}
+
+static void printResult(std::ostream& os, const Result& result) {
+    const auto& c = result.config;
+    os << std::fixed << std::setprecision(1) << "| " << std::left << std::setw(9)
+       << toString(c.operation) << std::right << " | " << std::setw(7) << c.threads << " | "
+       << std::setw(7) << c.clients << " | " << std::setw(14) << getOperationsPerSecond(result)
+       << " | " << std::setw(9) << result.efficiency * 100 << "% | " << std::setw(9)
+       << result.p50Microseconds << " | " << std::setw(9) << result.p99Microseconds << " | "
+       << std::setw(9) << result.cpuSeconds / result.seconds << " | " << std::setw(15)
+       << static_cast<double>(result.notifications) / result.seconds << " | " << std::setw(6)
+       << result.errors << "\n"
+       << std::flush;
+}
+
+/// Write the results as JSON, the schema is stable to compare results across releases.
+static void writeJson(
+    std::ostream& os, const Options& options, const std::vector<Result>& results
+) {
+    os << "{\n";
+    os << "  \"benchmark\": \"concurrency\",\n";
+#ifdef UAPP_VERSION
+    os << "  \"version\": \"" << UAPP_VERSION << "\",\n";
+#endif
+#ifdef UA_OPEN62541_VERSION
+    os << "  \"open62541Version\": \"" << UA_OPEN62541_VERSION << "\",\n";
+#endif
+    os << "  \"durationSeconds\": " << options.duration << ",\n";
+    os << "  \"nodes\": " << options.nodes << ",\n";
+    os << "  \"results\": [";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& result = results[i];
+        const auto& c = result.config;
+        os << (i == 0 ? "\n" : ",\n") << "    {"
+           << "\"operation\": \"" << toString(c.operation) << "\", "
+           << "\"threads\": " << c.threads << ", "
+           << "\"clients\": " << c.clients << ", "
+           << "\"operations\": " << result.operations << ", "
+           << "\"errors\": " << result.errors << ", "
+           << "\"operationsPerSecond\": " << getOperationsPerSecond(result) << ", "
+           << "\"efficiency\": " << result.efficiency << ", "
+           << "\"latencyP50Microseconds\": " << result.p50Microseconds << ", "
+           << "\"latencyP99Microseconds\": " << result.p99Microseconds << ", "
+           << "\"cpuCores\": " << result.cpuSeconds / result.seconds << ", "
+           << "\"notificationsPerSecond\": "
+           << static_cast<double>(result.notifications) / result.seconds << "}";
+    }
+    os << "\n  ]\n}\n";
+}
+
+/* ------------------------------------------- Options ------------------------------------------ */
+
+static std::vector<Operation> parseOperations(std::string_view list) {
+    std::vector<Operation> operations;
+    for (const auto& item : split(list)) {
+        for (auto operation : {Operation::Read, Operation::Write, Operation::Node}) {
+            if (item == toString(operation)) {
+                operations.push_back(operation);
+            }
+        }
+    }
+    return operations;
+}
+
+static Options parseOptions(int argc, char* argv[]) {  // NOLINT
+    Options options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const std::string_view key(argv[i]);  // NOLINT
+        const std::string_view value(argv[i + 1]);  // NOLINT
+        if (key == "--duration") {
+            options.duration = std::stod(std::string(value));
+        } else if (key == "--threads") {
+            options.threads = parseSizes(value);
+        } else if (key == "--clients") {
+            options.clients = parseSizes(value);
+        } else if (key == "--nodes") {
+            options.nodes = std::stoull(std::string(value));
+        } else if (key == "--operations") {
+            options.operations = parseOperations(value);
+        } else if (key == "--json") {
+            options.json = value;
+        } else {
+            throw std::invalid_argument("Unknown option: " + std::string(key));
+        }
+    }
+    return options;
+}
+
+int main(int argc, char* argv[]) {
+    const auto options = parseOptions(argc, argv);
+    ConcurrencyServer server(options.nodes);
+    std::vector<Result> results;
+    printHeader(std::cout);
+    for (auto operation : options.operations) {
+        for (auto clients : options.clients) {
+            for (auto threads : options.threads) {
+                results.push_back(runCase(server, {operation, threads, clients}, options));
+                computeEfficiency(results);
+                printResult(std::cout, results.back());
+            }
+        }
+    }
+    if (options.json == "-") {
+        writeJson(std::cout, options, results);
+    } else if (!options.json.empty()) {
+        std::ofstream file(options.json);
+        writeJson(file, options, results);
+    }
+    const bool failed = std::any_of(results.begin(), results.end(), [](const auto& result) {
+        return result.errors > 0;
+    });
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+#else
+
+int main() {
+    std::cerr << "The concurrency benchmark requires open62541 with multithreading "
+                 "(UA_MULTITHREADING >= 100)\n";
+    return EXIT_FAILURE;
+}
+
+#endif
@@ -0,0 +1,444 @@
+/**
+ * End-to-end throughput and latency benchmark of a server and clients connected over loopback.
+ *
+ * Every case connects the clients to a local server with a number of ByteString variables and
+ * sends read or write requests for a fixed duration, one outstanding request per client.
+ * Reported are the requests and values per second and the p50/p99 latency of the requests.
+ *
+ * Usage: loopback [options]
+ *   --duration <seconds>      Measured duration of each case (default: 2)
+ *   --nodes <n,...>           Number of variables of the server (default: 1,1000,100000)
+ *   --payloads <bytes,...>    Payload sizes of the variables (default: 8,1024)
+ *   --batches <n,...>         Values per request (default: 1,100)
+ *   --clients <n,...>         Number of concurrent clients (default: 1)
+ *   --modes <mode,...>        Completion modes: sync, future, callback (default: all)
+ *   --json <file>             Write the results as JSON, `-` for stdout
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <future>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>  // forward
+#include <vector>
+
+#include "open62541pp/Client.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/async.h"
+#include "open62541pp/open62541.h"
+#include "open62541pp/services/Attribute.h"
+#include "open62541pp/services/NodeManagement.h"
+
+#include "Common.h"
+
+using namespace opcua;
+using namespace opcua::benchmarks;
+using Clock = std::chrono::steady_clock;
+
+constexpr uint16_t port = 4850;
+constexpr std::string_view serverUrl{"opc.tcp://localhost:4850"};
+constexpr uint16_t namespaceIndex = 1;
+constexpr size_t distinctBatches = 16;  // requests are prepared before the measurement
+
+enum class Operation { Read, Write };
+
+enum class Mode { Sync, Future, Callback };
+
+struct Options {
+    double duration = 2.0;
+    std::vector<size_t> nodes{1, 1000, 100000};
+    std::vector<size_t> payloads{8, 1024};
+    std::vector<size_t> batches{1, 100};
+    std::vector<size_t> clients{1};
+    std::vector<Mode> modes{Mode::Sync, Mode::Future, Mode::Callback};
+    std::string json;
+};
+
+struct Case {
+    Operation operation;
+    Mode mode;
+    size_t nodes;
+    size_t payload;
+    size_t batch;
+    size_t clients;
+};
+
+struct Result {
+    Case config;
+    uint64_t requests = 0;
+    uint64_t errors = 0;
+    double seconds = 0;
+    double p50Microseconds = 0;
+    double p99Microseconds = 0;
+};
+
+static std::string_view toString(Operation operation) {
+    return operation == Operation::Read ? "read" : "write";
+}
+
+static std::string_view toString(Mode mode) {
+    switch (mode) {
+    case Mode::Sync:
+        return "sync";
+    case Mode::Future:
+        return "future";
+    case Mode::Callback:
+        return "callback";
+    }
+    return "unknown";
+}
+
+/* ------------------------------------------- Server ------------------------------------------- */
+
+/// Server with `nodes` variables (ns=1;i=1..nodes) running in a background thread.
+class LoopbackServer {
+public:
+    LoopbackServer(size_t nodes, size_t payload) : server_(port) {
+        server_.setLogger([](auto&&...) {});
+        const ByteString value(std::string(payload, 'x'));
+        for (size_t i = 0; i < nodes; ++i) {
+            services::addVariable(
+                server_,
+                ObjectId::ObjectsFolder,
+                NodeId(namespaceIndex, static_cast<uint32_t>(i + 1)),
+                "Variable",
+                VariableAttributes{}
+                    .setDataType<ByteString>()
+                    .setValueScalar(value)
+                    .setAccessLevel(AccessLevel::CurrentRead | AccessLevel::CurrentWrite)
+            );
+        }
+        server_.runIterate();
+        thread_ = std::thread([this] {
+            while (!stopFlag_) {
+                server_.runIterate();
+            }
+        });
+    }
+
+    ~LoopbackServer() {
+        stopFlag_ = true;
+        thread_.join();
+    }
+
+    LoopbackServer(const LoopbackServer&) = delete;
+    LoopbackServer(LoopbackServer&&) = delete;
+    LoopbackServer& operator=(const LoopbackServer&) = delete;
+    LoopbackServer& operator=(LoopbackServer&&) = delete;
+
+private:
+    Server server_;
+    std::atomic<bool> stopFlag_{false};
+    std::thread thread_;
+};
+
+/* ------------------------------------------- Client ------------------------------------------- */
+
+static NodeId getVariableId(size_t index, size_t nodes) {
+    return {namespaceIndex, static_cast<uint32_t>(index % nodes + 1)};
+}
+
+static std::vector<std::vector<ReadValueId>> createReadBatches(const Case& config) {
+    std::vector<std::vector<ReadValueId>> batches(distinctBatches);
+    for (size_t b = 0; b < batches.size(); ++b) {
+        for (size_t i = 0; i < config.batch; ++i) {
+            batches[b].emplace_back(
+                getVariableId(b * config.batch + i, config.nodes), AttributeId::Value
+            );
+        }
+    }
+    return batches;
+}
+
+static std::vector<std::vector<WriteValue>> createWriteBatches(const Case& config) {
+    const ByteString payload(std::string(config.payload, 'y'));
+    std::vector<std::vector<WriteValue>> batches(distinctBatches);
+    for (size_t b = 0; b < batches.size(); ++b) {
+        for (size_t i = 0; i < config.batch; ++i) {
+            batches[b].emplace_back(
+                getVariableId(b * config.batch + i, config.nodes),
+                AttributeId::Value,
+                std::string_view{},
+                DataValue(Variant::fromScalar(payload))
+            );
+        }
+    }
+    return batches;
+}
+
+template <typename Future>
+static auto waitFor(Client& client, Future& future) {
+    while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+        client.runIterate(1);
+    }
+    return future.get();
+}
+
+static void waitFor(Client& client, const bool& done) {
+    while (!done) {
+        client.runIterate(1);
+    }
+}
+
+/// Send a request and wait for the response with the completion mode of the case.
+template <typename Item>
+static bool send(Client& client, Mode mode, const std::vector<Item>& batch) {
+    constexpr bool isRead = std::is_same_v<Item, ReadValueId>;
+    const auto check = [](const auto& response) {
+        return response.getResponseHeader().getServiceResult().isGood();
+    };
+    const auto sendAsync = [&](auto&& token) {
+        if constexpr (isRead) {
+            return services::readAsync(
+                client, batch, TimestampsToReturn::Neither, std::forward<decltype(token)>(token)
+            );
+        } else {
+            return services::writeAsync(client, batch, std::forward<decltype(token)>(token));
+        }
+    };
+    switch (mode) {
+    case Mode::Sync:
+        if constexpr (isRead) {
+            return check(services::read(client, batch));
+        } else {
+            return check(services::write(client, batch));
+        }
+    case Mode::Future: {
+        auto future = sendAsync(useFuture);
+        return check(waitFor(client, future));
+    }
+    case Mode::Callback: {
+        bool done = false;
+        bool good = false;
+        sendAsync([&](StatusCode code, auto& response) {
+            good = code.isGood() && check(response);
+            done = true;
+        });
+        waitFor(client, done);
+        return good;
+    }
+    }
+    return false;
+}
+
+struct ClientMeasurement {
+    std::vector<int64_t> latencies;  // ns
+    uint64_t errors = 0;
+};
+
+template <typename Item>
+static void runClient(
+    const Case& config,
+    const std::vector<std::vector<Item>>& batches,
+    Clock::time_point start,
+    Clock::time_point stop,
+    ClientMeasurement& measurement
+) {
+    Client client;
+    client.setLogger([](auto&&...) {});
+    client.connect(serverUrl);
+    for (size_t i = 0; Clock::now() < stop; ++i) {
+        const auto& batch = batches[i % batches.size()];
+        const auto begin = Clock::now();
+        bool good = false;
+        try {
+            good = send(client, config.mode, batch);
+        } catch (const std::exception&) {
+            good = false;
+        }
+        const auto end = Clock::now();
+        if (begin < start) {
+            continue;  // warmup
+        }
+        measurement.latencies.push_back(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count()
+        );
+        if (!good) {
+            ++measurement.errors;
+        }
+    }
+    client.disconnect();
+}
+
+static Result runCase(const Case& config, double duration) {
+    const auto readBatches = createReadBatches(config);
+    const auto writeBatches = createWriteBatches(config);
+    const auto warmup = std::chrono::milliseconds(200);
+    const auto start = Clock::now() + warmup;
+    const auto stop = start + std::chrono::duration_cast<Clock::duration>(
+                                  std::chrono::duration<double>(duration)
+                              );
+
+    std::vector<ClientMeasurement> measurements(config.clients);
+    std::vector<std::thread> threads;
+    for (auto& measurement : measurements) {
+        threads.emplace_back([&] {
+            if (config.operation == Operation::Read) {
+                runClient(config, readBatches, start, stop, measurement);
+            } else {
+                runClient(config, writeBatches, start, stop, measurement);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    Result result;
+    result.config = config;
+    std::vector<int64_t> latencies;
+    for (const auto& measurement : measurements) {
+        latencies.insert(
+            latencies.end(), measurement.latencies.begin(), measurement.latencies.end()
+        );
+        result.errors += measurement.errors;
+    }
+    std::sort(latencies.begin(), latencies.end());
+    result.requests = latencies.size();
+    result.seconds = duration;
+    result.p50Microseconds = static_cast<double>(getPercentile(latencies, 0.50)) / 1000.0;
+    result.p99Microseconds = static_cast<double>(getPercentile(latencies, 0.99)) / 1000.0;
+    return result;
+}
+
+/* ------------------------------------------- Output ------------------------------------------- */
+
+static double getRequestsPerSecond(const Result& result) {
+    return result.seconds > 0 ? static_cast<double>(result.requests) / result.seconds : 0;
+}
+
+static double getValuesPerSecond(const Result& result) {
+    return getRequestsPerSecond(result) * static_cast<double>(result.config.batch);
+}
+
+static void printHeader(std::ostream& os) {
+    os << "| operation | mode     |   nodes | payload | batch | clients |   requests/s |"
+          "     values/s |  p50 [us] |  p99 [us] | errors\n";
+    os << "|-----------|----------|--------:|--------:|------:|--------:|-------------:|"
+          "-------------:|----------:|----------:|-------:\n";
+}
+
+static void printResult(std::ostream& os, const Result& result) {
+    const auto& c = result.config;
+    os << std::fixed << std::setprecision(1) << "| " << std::left << std::setw(9)
+       << toString(c.operation) << " | " << std::setw(8) << toString(c.mode) << std::right
+       << " | " << std::setw(7) << c.nodes << " | " << std::setw(7) << c.payload << " | "
+       << std::setw(5) << c.batch << " | " << std::setw(7) << c.clients << " | " << std::setw(12)
+       << getRequestsPerSecond(result) << " | " << std::setw(12) << getValuesPerSecond(result)
+       << " | " << std::setw(9) << result.p50Microseconds << " | " << std::setw(9)
+       << result.p99Microseconds << " | " << std::setw(6) << result.errors << "\n"
+       << std::flush;
+}
+
+/// Write the results as JSON, the schema is stable to compare results across releases.
+static void writeJson(
+    std::ostream& os, const Options& options, const std::vector<Result>& results
+) {
+    os << "{\n";
+    os << "  \"benchmark\": \"loopback\",\n";
+#ifdef UAPP_VERSION
+    os << "  \"version\": \"" << UAPP_VERSION << "\",\n";
+#endif
+#ifdef UA_OPEN62541_VERSION
+    os << "  \"open62541Version\": \"" << UA_OPEN62541_VERSION << "\",\n";
+#endif
+    os << "  \"durationSeconds\": " << options.duration << ",\n";
+    os << "  \"results\": [";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& result = results[i];
+        const auto& c = result.config;
+        os << (i == 0 ? "\n" : ",\n") << "    {"
+           << "\"operation\": \"" << toString(c.operation) << "\", "
+           << "\"mode\": \"" << toString(c.mode) << "\", "
+           << "\"nodes\": " << c.nodes << ", "
+           << "\"payloadBytes\": " << c.payload << ", "
+           << "\"batchSize\": " << c.batch << ", "
+           << "\"clients\": " << c.clients << ", "
+           << "\"requests\": " << result.requests << ", "
+           << "\"errors\": " << result.errors << ", "
+           << "\"requestsPerSecond\": " << getRequestsPerSecond(result) << ", "
+           << "\"valuesPerSecond\": " << getValuesPerSecond(result) << ", "
+           << "\"latencyP50Microseconds\": " << result.p50Microseconds << ", "
+           << "\"latencyP99Microseconds\": " << result.p99Microseconds << "}";
+    }
+    os << "\n  ]\n}\n";
+}
+
+/* ------------------------------------------- Options ------------------------------------------ */
+
+static std::vector<Mode> parseModes(std::string_view list) {
+    std::vector<Mode> modes;
+    for (const auto& item : split(list)) {
+        for (auto mode : {Mode::Sync, Mode::Future, Mode::Callback}) {
+            if (item == toString(mode)) {
+                modes.push_back(mode);
+            }
+        }
+    }
+    return modes;
+}
+
+static Options parseOptions(int argc, char* argv[]) {  // NOLINT
+    Options options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const std::string_view key(argv[i]);  // NOLINT
+        const std::string_view value(argv[i + 1]);  // NOLINT
+        if (key == "--duration") {
+            options.duration = std::stod(std::string(value));
+        } else if (key == "--nodes") {
+            options.nodes = parseSizes(value);
+        } else if (key == "--payloads") {
+            options.payloads = parseSizes(value);
+        } else if (key == "--batches") {
+            options.batches = parseSizes(value);
+        } else if (key == "--clients") {
+            options.clients = parseSizes(value);
+        } else if (key == "--modes") {
+            options.modes = parseModes(value);
+        } else if (key == "--json") {
+            options.json = value;
+        } else {
+            throw std::invalid_argument("Unknown option: " + std::string(key));
+        }
+    }
+    return options;
+}
+
+int main(int argc, char* argv[]) {
+    const auto options = parseOptions(argc, argv);
+    std::vector<Result> results;
+    printHeader(std::cout);
+    for (auto nodes : options.nodes) {
+        for (auto payload : options.payloads) {
+            const LoopbackServer server(nodes, payload);
+            for (auto operation : {Operation::Read, Operation::Write}) {
+                for (auto mode : options.modes) {
+                    for (auto batch : options.batches) {
+                        for (auto clients : options.clients) {
+                            const Case config{operation, mode, nodes, payload, batch, clients};
+                            results.push_back(runCase(config, options.duration));
+                            printResult(std::cout, results.back());
+                        }
+                    }
+                }
+            }
+        }
+    }
+    if (options.json == "-") {
+        writeJson(std::cout, options, results);
+    } else if (!options.json.empty()) {
+        std::ofstream file(options.json);
+        writeJson(file, options, results);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,33 @@
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include <nanobench.h>
+
+#include <fstream>
+#include <iostream>
+#include <string_view>
+
+#include "AllocationCounter.h"
+
+namespace opcua::benchmarks {
+void benchmarkCustomDataType();
+void benchmarkTypeWrapper();
+void benchmarkVariant();
+}  // namespace opcua::benchmarks
+
+// Usage: benchmarks [--json <file>], write the results as JSON (`-` for stdout)
+int main(int argc, char* argv[]) {
+    using namespace opcua::benchmarks;
+    const std::string_view json = argc == 3 && std::string_view(argv[1]) == "--json"  // NOLINT
+        ? argv[2]  // NOLINT
+        : "";
+    benchmarkVariant();
+    benchmarkTypeWrapper();
+    benchmarkCustomDataType();
+    printAllocations(std::cout);
+    if (json == "-") {
+        writeJson(std::cout);
+    } else if (!json.empty()) {
+        std::ofstream file{std::string(json)};
+        writeJson(file);
+    }
+    return 0;
+}
@@ -0,0 +1,530 @@
+/**
+ * Benchmark of the costs of encrypted endpoints.
+ *
+ * The server is created with a generated certificate (`crypto::createCertificate`) and trusts the
+ * generated client certificate. For every security policy and message security mode the client
+ * connects and disconnects repeatedly and sends synchronous reads for a fixed duration.
+ * Reported are the secure channel establishment rate, the session activation rate (split by the
+ * client state callbacks `onConnected` and `onSessionActivated`), the connection rate and the read
+ * throughput and p50/p99 latency with signed and signed-and-encrypted messages.
+ *
+ * Usage: security [options]
+ *   --duration <seconds>      Measured read duration of each case (default: 2)
+ *   --connections <n>         Connect/disconnect cycles of each case (default: 50)
+ *   --payloads <bytes,...>    Payload sizes of the read variables (default: 8,1024,65536)
+ *   --policies <policy,...>   Security policies: none, basic256sha256, aes128sha256rsaoaep
+ *                             (default: all)
+ *   --modes <mode,...>        Message security modes of the secure policies: sign, encrypt
+ *                             (default: all)
+ *   --key-size <bits>         Key size of the generated certificates (default: 2048)
+ *   --json <file>             Write the results as JSON, `-` for stdout
+ */
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <numeric>  // accumulate
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "open62541pp/Client.h"
+#include "open62541pp/Config.h"
+#include "open62541pp/Crypto.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/open62541.h"
+#include "open62541pp/services/Attribute.h"
+#include "open62541pp/services/NodeManagement.h"
+
+#include "Common.h"
+
+#if defined(UA_ENABLE_ENCRYPTION) && defined(UAPP_CREATE_CERTIFICATE)
+
+using namespace opcua;
+using namespace opcua::benchmarks;
+using Clock = std::chrono::steady_clock;
+
+constexpr uint16_t port = 4855;
+constexpr std::string_view serverUrl{"opc.tcp://localhost:4855"};
+constexpr uint16_t namespaceIndex = 1;
+constexpr std::string_view clientApplicationUri{"urn:unconfigured:application"};  // default
+
+struct Policy {
+    std::string_view name;
+    std::string_view uri;
+};
+
+constexpr std::array<Policy, 3> allPolicies{{
+    {"none", "http://opcfoundation.org/UA/SecurityPolicy#None"},
+    {"basic256sha256", "http://opcfoundation.org/UA/SecurityPolicy#Basic256Sha256"},
+    {"aes128sha256rsaoaep", "http://opcfoundation.org/UA/SecurityPolicy#Aes128_Sha256_RsaOaep"},
+}};
+
+struct Options {
+    double duration = 2.0;
+    size_t connections = 50;
+    std::vector<size_t> payloads{8, 1024, 65536};
+    std::vector<Policy> policies{allPolicies.begin(), allPolicies.end()};
+    std::vector<MessageSecurityMode> modes{
+        MessageSecurityMode::Sign, MessageSecurityMode::SignAndEncrypt
+    };
+    size_t keySize = 2048;
+    std::string json;
+};
+
+struct Case {
+    Policy policy;
+    MessageSecurityMode mode;
+};
+
+struct HandshakeResult {
+    Case config;
+    size_t connections = 0;
+    uint64_t errors = 0;
+    double channelMilliseconds = 0;  // mean
+    double sessionMilliseconds = 0;  // mean
+    double connectMilliseconds = 0;  // mean
+    double connectP99Milliseconds = 0;
+};
+
+struct ReadResult {
+    Case config;
+    size_t payload = 0;
+    uint64_t requests = 0;
+    uint64_t errors = 0;
+    double seconds = 0;
+    double p50Microseconds = 0;
+    double p99Microseconds = 0;
+};
+
+static std::string_view toString(MessageSecurityMode mode) {
+    switch (mode) {
+    case MessageSecurityMode::None:
+        return "none";
+    case MessageSecurityMode::Sign:
+        return "sign";
+    case MessageSecurityMode::SignAndEncrypt:
+        return "encrypt";
+    default:
+        return "unknown";
+    }
+}
+
+/// Cases of the options, the policy `none` is only combined with the mode `none`.
+static std::vector<Case> createCases(const Options& options) {
+    std::vector<Case> cases;
+    for (const auto& policy : options.policies) {
+        if (policy.name == "none") {
+            cases.push_back({policy, MessageSecurityMode::None});
+            continue;
+        }
+        for (auto mode : options.modes) {
+            cases.push_back({policy, mode});
+        }
+    }
+    return cases;
+}
+
+/* ---------------------------------------- Certificates ---------------------------------------- */
+
+struct Certificates {
+    crypto::CreateCertificateResult server;
+    crypto::CreateCertificateResult client;
+};
+
+static Certificates createCertificates(size_t keySize) {
+    Certificates certificates;
+    certificates.server = crypto::createCertificate(
+        {String{"C=DE"}, String{"O=open62541pp"}, String{"CN=open62541ppServer@localhost"}},
+        {String{"DNS:localhost"}, String{"URI:urn:open62541.server.application"}},
+        keySize
+    );
+    certificates.client = crypto::createCertificate(
+        {String{"C=DE"}, String{"O=open62541pp"}, String{"CN=open62541ppClient@localhost"}},
+        {String{"DNS:localhost"}, String{std::string("URI:").append(clientApplicationUri)}},
+        keySize
+    );
+    return certificates;
+}
+
+/* ------------------------------------------- Server ------------------------------------------- */
+
+/// Encrypted server with a ByteString variable (ns=1;i=<payload>) per payload size running in a
+/// background thread.
+class SecureServer {
+public:
+    SecureServer(const Certificates& certificates, const std::vector<size_t>& payloads)
+        : server_(
+              port,
+              certificates.server.certificate,
+              certificates.server.privateKey,
+              {certificates.client.certificate},
+              {}
+          ) {
+        server_.setLogger([](auto&&...) {});
+        for (auto payload : payloads) {
+            services::addVariable(
+                server_,
+                ObjectId::ObjectsFolder,
+                NodeId(namespaceIndex, static_cast<uint32_t>(payload)),
+                "Variable",
+                VariableAttributes{}
+                    .setDataType<ByteString>()
+                    .setValueScalar(ByteString(std::string(payload, 'x')))
+            );
+        }
+        server_.runIterate();
+        thread_ = std::thread([this] {
+            while (!stopFlag_) {
+                server_.runIterate();
+            }
+        });
+    }
+
+    ~SecureServer() {
+        stopFlag_ = true;
+        thread_.join();
+    }
+
+    SecureServer(const SecureServer&) = delete;
+    SecureServer(SecureServer&&) = delete;
+    SecureServer& operator=(const SecureServer&) = delete;
+    SecureServer& operator=(SecureServer&&) = delete;
+
+private:
+    Server server_;
+    std::atomic<bool> stopFlag_{false};
+    std::thread thread_;
+};
+
+/* ------------------------------------------- Client ------------------------------------------- */
+
+/// Client with encryption that trusts the server certificate.
+class SecureClient : public Client {
+public:
+    SecureClient(const Certificates& certificates, const Case& config)
+        : Client(
+              certificates.client.certificate,
+              certificates.client.privateKey,
+              {certificates.server.certificate}
+          ) {
+        setLogger([](auto&&...) {});
+        setSecurityMode(config.mode);
+        // the security policy is not exposed by the Client API, set the native config
+        auto* native = UA_Client_getConfig(handle());
+        UA_String_clear(&native->securityPolicyUri);
+        native->securityPolicyUri = UA_String_fromChars(std::string(config.policy.uri).c_str());
+    }
+};
+
+static double toMilliseconds(Clock::duration duration) {
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+static double getMean(const std::vector<double>& values) {
+    if (values.empty()) {
+        return 0;
+    }
+    return std::accumulate(values.begin(), values.end(), 0.0) / static_cast<double>(values.size());
+}
+
+/// Connect and disconnect repeatedly. The connect time is split into the secure channel
+/// establishment (including the endpoint discovery) and the session creation and activation.
+static HandshakeResult runHandshake(
+    const Certificates& certificates, const Case& config, size_t connections
+) {
+    SecureClient client(certificates, config);
+    Clock::time_point channelTime;
+    Clock::time_point sessionTime;
+    client.onConnected([&] { channelTime = Clock::now(); });
+    client.onSessionActivated([&] { sessionTime = Clock::now(); });
+
+    HandshakeResult result;
+    result.config = config;
+    std::vector<double> channel;
+    std::vector<double> session;
+    std::vector<double> connect;
+    for (size_t i = 0; i < connections + 1; ++i) {
+        const auto begin = Clock::now();
+        try {
+            client.connect(serverUrl);
+        } catch (const std::exception&) {
+            ++result.errors;
+            continue;
+        }
+        const auto end = Clock::now();
+        client.disconnect();
+        if (i == 0) {
+            continue;  // warmup
+        }
+        connect.push_back(toMilliseconds(end - begin));
+        if (begin <= channelTime && channelTime <= sessionTime) {
+            channel.push_back(toMilliseconds(channelTime - begin));
+            session.push_back(toMilliseconds(sessionTime - channelTime));
+        }
+    }
+    std::sort(connect.begin(), connect.end());
+    result.connections = connect.size();
+    result.channelMilliseconds = getMean(channel);
+    result.sessionMilliseconds = getMean(session);
+    result.connectMilliseconds = getMean(connect);
+    result.connectP99Milliseconds = getPercentile(connect, 0.99);
+    return result;
+}
+
+/// Send synchronous reads of the payload variable for the given duration.
+static ReadResult runRead(
+    const Certificates& certificates, const Case& config, size_t payload, double duration
+) {
+    SecureClient client(certificates, config);
+    client.connect(serverUrl);
+    const std::vector<ReadValueId> nodesToRead{
+        {NodeId(namespaceIndex, static_cast<uint32_t>(payload)), AttributeId::Value}
+    };
+    const auto warmup = std::chrono::milliseconds(200);
+    const auto start = Clock::now() + warmup;
+    const auto stop = start + std::chrono::duration_cast<Clock::duration>(
+                                  std::chrono::duration<double>(duration)
+                              );
+
+    ReadResult result;
+    result.config = config;
+    result.payload = payload;
+    std::vector<int64_t> latencies;
+    while (Clock::now() < stop) {
+        const auto begin = Clock::now();
+        bool good = false;
+        try {
+            const auto response = services::read(client, nodesToRead);
+            good = response.getResponseHeader().getServiceResult().isGood();
+        } catch (const std::exception&) {
+            good = false;
+        }
+        const auto end = Clock::now();
+        if (begin < start) {
+            continue;  // warmup
+        }
+        latencies.push_back(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count()
+        );
+        if (!good) {
+            ++result.errors;
+        }
+    }
+    client.disconnect();
+
+    std::sort(latencies.begin(), latencies.end());
+    result.requests = latencies.size();
+    result.seconds = duration;
+    result.p50Microseconds = static_cast<double>(getPercentile(latencies, 0.50)) / 1000.0;
+    result.p99Microseconds = static_cast<double>(getPercentile(latencies, 0.99)) / 1000.0;
+    return result;
+}
+
+/* ------------------------------------------- Output ------------------------------------------- */
+
+static double getRate(double milliseconds) {
+    return milliseconds > 0 ? 1000.0 / milliseconds : 0;
+}
+
+static double getRequestsPerSecond(const ReadResult& result) {
+    return result.seconds > 0 ? static_cast<double>(result.requests) / result.seconds : 0;
+}
+
+static double getMegabytesPerSecond(const ReadResult& result) {
+    return getRequestsPerSecond(result) * static_cast<double>(result.payload) / 1e6;
+}
+
+static void printHandshakeHeader(std::ostream& os) {
+    os << "| policy              | mode    | channel [ms] |  channels/s | session [ms] |"
+          "  sessions/s | connect [ms] | p99 [ms] | connects/s | errors\n";
+    os << "|---------------------|---------|-------------:|------------:|-------------:|"
+          "------------:|-------------:|---------:|-----------:|-------:\n";
+}
+
+static void printHandshakeResult(std::ostream& os, const HandshakeResult& result) {
+    const auto& c = result.config;
+    os << std::fixed << std::setprecision(2) << "| " << std::left << std::setw(19)
+       << c.policy.name << " | " << std::setw(7) << toString(c.mode) << std::right << " | "
+       << std::setw(12) << result.channelMilliseconds << " | " << std::setw(11)
+       << getRate(result.channelMilliseconds) << " | " << std::setw(12)
+       << result.sessionMilliseconds << " | " << std::setw(11)
+       << getRate(result.sessionMilliseconds) << " | " << std::setw(12)
+       << result.connectMilliseconds << " | " << std::setw(8) << result.connectP99Milliseconds
+       << " | " << std::setw(10) << getRate(result.connectMilliseconds) << " | " << std::setw(6)
+       << result.errors << "\n"
+       << std::flush;
+}
+
+static void printReadHeader(std::ostream& os) {
+    os << "| policy              | mode    | payload |   requests/s |     MB/s |  p50 [us] |"
+          "  p99 [us] | errors\n";
+    os << "|---------------------|---------|--------:|-------------:|---------:|----------:|"
+          "----------:|-------:\n";
+}
+
+static void printReadResult(std::ostream& os, const ReadResult& result) {
+    const auto& c = result.config;
+    os << std::fixed << std::setprecision(1) << "| " << std::left << std::setw(19)
+       << c.policy.name << " | " << std::setw(7) << toString(c.mode) << std::right << " | "
+       << std::setw(7) << result.payload << " | " << std::setw(12) << getRequestsPerSecond(result)
+       << " | " << std::setw(8) << getMegabytesPerSecond(result) << " | " << std::setw(9)
+       << result.p50Microseconds << " | " << std::setw(9) << result.p99Microseconds << " | "
+       << std::setw(6) << result.errors << "\n"
+       << std::flush;
+}
+
+/// Write the results as JSON, the schema is stable to compare results across releases.
+static void writeJson(
+    std::ostream& os,
+    const Options& options,
+    const std::vector<HandshakeResult>& handshakes,
+    const std::vector<ReadResult>& reads
+) {
+    os << "{\n";
+    os << "  \"benchmark\": \"security\",\n";
+#ifdef UAPP_VERSION
+    os << "  \"version\": \"" << UAPP_VERSION << "\",\n";
+#endif
+#ifdef UA_OPEN62541_VERSION
+    os << "  \"open62541Version\": \"" << UA_OPEN62541_VERSION << "\",\n";
+#endif
+    os << "  \"durationSeconds\": " << options.duration << ",\n";
+    os << "  \"keySizeBits\": " << options.keySize << ",\n";
+    os << "  \"handshakes\": [";
+    for (size_t i = 0; i < handshakes.size(); ++i) {
+        const auto& result = handshakes[i];
+        const auto& c = result.config;
+        os << (i == 0 ? "\n" : ",\n") << "    {"
+           << "\"policy\": \"" << c.policy.name << "\", "
+           << "\"mode\": \"" << toString(c.mode) << "\", "
+           << "\"connections\": " << result.connections << ", "
+           << "\"errors\": " << result.errors << ", "
+           << "\"channelMilliseconds\": " << result.channelMilliseconds << ", "
+           << "\"channelsPerSecond\": " << getRate(result.channelMilliseconds) << ", "
+           << "\"sessionMilliseconds\": " << result.sessionMilliseconds << ", "
+           << "\"sessionsPerSecond\": " << getRate(result.sessionMilliseconds) << ", "
+           << "\"connectMilliseconds\": " << result.connectMilliseconds << ", "
+           << "\"connectP99Milliseconds\": " << result.connectP99Milliseconds << ", "
+           << "\"connectsPerSecond\": " << getRate(result.connectMilliseconds) << "}";
+    }
+    os << "\n  ],\n";
+    os << "  \"reads\": [";
+    for (size_t i = 0; i < reads.size(); ++i) {
+        const auto& result = reads[i];
+        const auto& c = result.config;
+        os << (i == 0 ? "\n" : ",\n") << "    {"
+           << "\"policy\": \"" << c.policy.name << "\", "
+           << "\"mode\": \"" << toString(c.mode) << "\", "
+           << "\"payloadBytes\": " << result.payload << ", "
+           << "\"requests\": " << result.requests << ", "
+           << "\"errors\": " << result.errors << ", "
+           << "\"requestsPerSecond\": " << getRequestsPerSecond(result) << ", "
+           << "\"megabytesPerSecond\": " << getMegabytesPerSecond(result) << ", "
+           << "\"latencyP50Microseconds\": " << result.p50Microseconds << ", "
+           << "\"latencyP99Microseconds\": " << result.p99Microseconds << "}";
+    }
+    os << "\n  ]\n}\n";
+}
+
+/* ------------------------------------------- Options ------------------------------------------ */
+
+static std::vector<Policy> parsePolicies(std::string_view list) {
+    std::vector<Policy> result;
+    for (const auto& item : split(list)) {
+        for (const auto& policy : allPolicies) {
+            if (item == policy.name) {
+                result.push_back(policy);
+            }
+        }
+    }
+    return result;
+}
+
+static std::vector<MessageSecurityMode> parseModes(std::string_view list) {
+    std::vector<MessageSecurityMode> modes;
+    for (const auto& item : split(list)) {
+        for (auto mode : {MessageSecurityMode::Sign, MessageSecurityMode::SignAndEncrypt}) {
+            if (item == toString(mode)) {
+                modes.push_back(mode);
+            }
+        }
+    }
+    return modes;
+}
+
+static Options parseOptions(int argc, char* argv[]) {  // NOLINT
+    Options options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const std::string_view key(argv[i]);  // NOLINT
+        const std::string_view value(argv[i + 1]);  // NOLINT
+        if (key == "--duration") {
+            options.duration = std::stod(std::string(value));
+        } else if (key == "--connections") {
+            options.connections = std::stoull(std::string(value));
+        } else if (key == "--payloads") {
+            options.payloads = parseSizes(value);
+        } else if (key == "--policies") {
+            options.policies = parsePolicies(value);
+        } else if (key == "--modes") {
+            options.modes = parseModes(value);
+        } else if (key == "--key-size") {
+            options.keySize = std::stoull(std::string(value));
+        } else if (key == "--json") {
+            options.json = value;
+        } else {
+            throw std::invalid_argument("Unknown option: " + std::string(key));
+        }
+    }
+    return options;
+}
+
+int main(int argc, char* argv[]) {
+    const auto options = parseOptions(argc, argv);
+    const auto certificates = createCertificates(options.keySize);
+    const auto cases = createCases(options);
+    const SecureServer server(certificates, options.payloads);
+
+    std::vector<HandshakeResult> handshakes;
+    printHandshakeHeader(std::cout);
+    for (const auto& config : cases) {
+        handshakes.push_back(runHandshake(certificates, config, options.connections));
+        printHandshakeResult(std::cout, handshakes.back());
+    }
+
+    std::vector<ReadResult> reads;
+    std::cout << "\n";
+    printReadHeader(std::cout);
+    for (const auto& config : cases) {
+        for (auto payload : options.payloads) {
+            reads.push_back(runRead(certificates, config, payload, options.duration));
+            printReadResult(std::cout, reads.back());
+        }
+    }
+
+    if (options.json == "-") {
+        writeJson(std::cout, options, handshakes, reads);
+    } else if (!options.json.empty()) {
+        std::ofstream file(options.json);
+        writeJson(file, options, handshakes, reads);
+    }
+    return EXIT_SUCCESS;
+}
+
+#else
+
+int main() {
+    std::cerr << "The security benchmark requires encryption (UA_ENABLE_ENCRYPTION) and "
+                 "certificate creation (open62541 >= v1.3 with OpenSSL/LibreSSL)\n";
+    return EXIT_FAILURE;
+}
+
+#endif
@@ -0,0 +1,394 @@
+/**
+ * Throughput benchmark of data change notifications of a server and a client connected over
+ * loopback.
+ *
+ * The server updates N variables at a fixed rate, the client monitors all variables with one
+ * subscription, either with a callback per monitored item or with batched delivery. Reported are
+ * the delivered notifications per second, the latency from the server write (SourceTimestamp) to
+ * the client callback, the CPU time per notification and the memory per monitored item.
+ * Server and client run in the same process, the CPU time and the resident memory include both.
+ * The memory per monitored item depends on the build profile (`default` or `low-memory`, see the
+ * CMake option UAPP_LOW_MEMORY), that is written to the JSON results.
+ *
+ * Usage: subscription [options]
+ *   --duration <seconds>           Measured duration of each case (default: 5)
+ *   --items <n,...>                Number of variables/monitored items (default: 1000,100000)
+ *   --rate <hz>                    Update rate of all variables (default: 10)
+ *   --publishing-interval <ms>     Publishing interval of the subscription (default: 100)
+ *   --sampling-interval <ms>       Sampling interval of the monitored items (default: 50)
+ *   --max-notifications <n>        Maximum notifications per publish (default: 10000)
+ *   --modes <mode,...>             Delivery modes: item, batch (default: all)
+ *   --json <file>                  Write the results as JSON, `-` for stdout
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "open62541pp/Client.h"
+#include "open62541pp/MemoryStatistics.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/Subscription.h"
+#include "open62541pp/open62541.h"
+#include "open62541pp/services/Attribute.h"
+#include "open62541pp/services/NodeManagement.h"
+
+#include "Common.h"
+
+using namespace opcua;
+using namespace opcua::benchmarks;
+using Clock = std::chrono::steady_clock;
+
+constexpr uint16_t port = 4851;
+constexpr std::string_view serverUrl{"opc.tcp://localhost:4851"};
+constexpr uint16_t namespaceIndex = 1;
+constexpr auto warmup = std::chrono::seconds(1);
+
+enum class Mode { Item, Batch };
+
+struct Options {
+    double duration = 5.0;
+    std::vector<size_t> items{1000, 100000};
+    double rate = 10.0;
+    double publishingInterval = 100.0;
+    double samplingInterval = 50.0;
+    uint32_t maxNotifications = 10000;
+    std::vector<Mode> modes{Mode::Item, Mode::Batch};
+    std::string json;
+};
+
+struct Result {
+    Mode mode{};
+    size_t items = 0;
+    size_t failedItems = 0;
+    double seconds = 0;
+    uint64_t notifications = 0;
+    uint64_t updates = 0;
+    double p50Milliseconds = 0;
+    double p99Milliseconds = 0;
+    double cpuMicrosecondsPerNotification = 0;
+    double contextBytesPerItem = 0;
+    double residentBytesPerItem = 0;
+};
+
+static std::string_view toString(Mode mode) {
+    return mode == Mode::Item ? "item" : "batch";
+}
+
+/* ------------------------------------------- Server ------------------------------------------- */
+
+/// Server with `items` variables (ns=1;i=1..items), updated at a fixed rate in a background
+/// thread. The updates are written with the SourceTimestamp of the write.
+class UpdatingServer {
+public:
+    UpdatingServer(size_t items, double rate) : server_(port), items_(items) {
+        server_.setLogger([](auto&&...) {});
+        for (size_t i = 0; i < items; ++i) {
+            services::addVariable(
+                server_,
+                ObjectId::ObjectsFolder,
+                NodeId(namespaceIndex, static_cast<uint32_t>(i + 1)),
+                "Variable",
+                VariableAttributes{}.setDataType<int64_t>().setValueScalar(int64_t{0})
+            );
+        }
+        server_.runIterate();
+        thread_ = std::thread([this, rate] {
+            const auto period = std::chrono::duration_cast<Clock::duration>(
+                std::chrono::duration<double>(1.0 / rate)
+            );
+            auto next = Clock::now();
+            int64_t counter = 0;
+            while (!stopFlag_) {
+                if (Clock::now() >= next) {
+                    update(++counter);
+                    next += period;
+                }
+                server_.runIterate();
+            }
+        });
+    }
+
+    ~UpdatingServer() {
+        stopFlag_ = true;
+        thread_.join();
+    }
+
+    UpdatingServer(const UpdatingServer&) = delete;
+    UpdatingServer(UpdatingServer&&) = delete;
+    UpdatingServer& operator=(const UpdatingServer&) = delete;
+    UpdatingServer& operator=(UpdatingServer&&) = delete;
+
+    /// Total number of written values.
+    uint64_t getUpdates() const noexcept {
+        return updates_.load(std::memory_order_relaxed);
+    }
+
+private:
+    void update(int64_t counter) {
+        for (size_t i = 0; i < items_; ++i) {
+            DataValue value(Variant::fromScalar(counter));
+            value.setSourceTimestamp(DateTime::now());
+            services::writeDataValue(
+                server_, NodeId(namespaceIndex, static_cast<uint32_t>(i + 1)), value
+            );
+        }
+        updates_.fetch_add(items_, std::memory_order_relaxed);
+    }
+
+    Server server_;
+    size_t items_;
+    std::atomic<uint64_t> updates_{0};
+    std::atomic<bool> stopFlag_{false};
+    std::thread thread_;
+};
+
+/* ------------------------------------------- Client ------------------------------------------- */
+
+/// Notification counter and latency samples of the measured period.
+struct NotificationRecorder {
+    bool measuring = false;
+    uint64_t notifications = 0;
+    std::vector<int64_t> latencies;  // 100 ns ticks of DateTime
+
+    void record(const DataValue& value) {
+        if (!measuring) {
+            return;
+        }
+        ++notifications;
+        latencies.push_back(DateTime::now().get() - value.getSourceTimestamp().get());
+    }
+};
+
+static Result runCase(const Options& options, Mode mode, size_t items) {
+    Result result;
+    result.mode = mode;
+    result.items = items;
+    result.seconds = options.duration;
+
+    const UpdatingServer server(items, options.rate);
+    Client client;
+    client.setLogger([](auto&&...) {});
+    client.setMemoryAccountingEnabled(true);
+    client.connect(serverUrl);
+
+    NotificationRecorder recorder;
+    SubscriptionParameters subscriptionParameters{};
+    subscriptionParameters.publishingInterval = options.publishingInterval;
+    subscriptionParameters.maxNotificationsPerPublish = options.maxNotifications;
+    auto subscription = mode == Mode::Batch
+        ? client.createSubscription(
+              subscriptionParameters,
+              [&](uint32_t /*subId*/, Span<services::MonitoredItemNotification> notifications) {
+                  for (const auto& notification : notifications) {
+                      recorder.record(notification.value);
+                  }
+              }
+          )
+        : client.createSubscription(subscriptionParameters);
+
+    std::vector<ReadValueId> itemsToMonitor;
+    itemsToMonitor.reserve(items);
+    for (size_t i = 0; i < items; ++i) {
+        itemsToMonitor.emplace_back(
+            NodeId(namespaceIndex, static_cast<uint32_t>(i + 1)), AttributeId::Value
+        );
+    }
+    MonitoringParameters monitoringParameters{};
+    monitoringParameters.samplingInterval = options.samplingInterval;
+    monitoringParameters.timestamps = TimestampsToReturn::Source;
+
+    const auto residentBefore = getResidentBytes();
+    DataChangeCallback<Client> onDataChange;
+    if (mode == Mode::Item) {
+        onDataChange = [&](const MonitoredItem<Client>& /*item*/, const DataValue& value) {
+            recorder.record(value);
+        };
+    }
+    const auto results = subscription.subscribeDataChangeMany(
+        itemsToMonitor, MonitoringMode::Reporting, monitoringParameters, onDataChange
+    );
+    const auto residentAfter = getResidentBytes();
+    result.failedItems = static_cast<size_t>(
+        std::count_if(results.begin(), results.end(), [](const auto& item) {
+            return item.statusCode.isBad();
+        })
+    );
+    const auto statistics = client.getMemoryStatistics();
+    if (const auto* contexts = statistics.findCategory(MemoryCategory::MonitoredItemContext)) {
+        result.contextBytesPerItem =
+            static_cast<double>(contexts->currentBytes) / static_cast<double>(items);
+    }
+    result.residentBytesPerItem =
+        static_cast<double>(residentAfter > residentBefore ? residentAfter - residentBefore : 0) /
+        static_cast<double>(items);
+
+    // warmup
+    const auto start = Clock::now() + warmup;
+    while (Clock::now() < start) {
+        client.runIterate(10);
+    }
+
+    // measurement
+    const auto stop = start + std::chrono::duration_cast<Clock::duration>(
+                                  std::chrono::duration<double>(options.duration)
+                              );
+    recorder.measuring = true;
+    const auto updatesBefore = server.getUpdates();
+    const auto cpuBefore = getCpuSeconds();
+    while (Clock::now() < stop) {
+        client.runIterate(10);
+    }
+    const auto cpuAfter = getCpuSeconds();
+    recorder.measuring = false;
+    result.updates = server.getUpdates() - updatesBefore;
+
+    result.notifications = recorder.notifications;
+    std::sort(recorder.latencies.begin(), recorder.latencies.end());
+    // 100 ns -> ms
+    result.p50Milliseconds = static_cast<double>(getPercentile(recorder.latencies, 0.50)) / 1e4;
+    result.p99Milliseconds = static_cast<double>(getPercentile(recorder.latencies, 0.99)) / 1e4;
+    if (result.notifications > 0) {
+        result.cpuMicrosecondsPerNotification =
+            (cpuAfter - cpuBefore) * 1e6 / static_cast<double>(result.notifications);
+    }
+    client.disconnect();
+    return result;
+}
+
+/* ------------------------------------------- Output ------------------------------------------- */
+
+static double getNotificationsPerSecond(const Result& result) {
+    return result.seconds > 0 ? static_cast<double>(result.notifications) / result.seconds : 0;
+}
+
+static void printHeader(std::ostream& os) {
+    os << "| mode  |   items | failed | notifications/s |  updates/s | p50 [ms] | p99 [ms] |"
+          " cpu/notification [us] | context/item [B] | rss/item [B]\n";
+    os << "|-------|--------:|-------:|----------------:|-----------:|---------:|---------:|"
+          "----------------------:|-----------------:|-------------:\n";
+}
+
+static void printResult(std::ostream& os, const Result& result) {
+    os << std::fixed << std::setprecision(2) << "| " << std::left << std::setw(5)
+       << toString(result.mode) << std::right << " | " << std::setw(7) << result.items << " | "
+       << std::setw(6) << result.failedItems << " | " << std::setw(15)
+       << getNotificationsPerSecond(result) << " | " << std::setw(10)
+       << static_cast<double>(result.updates) / result.seconds << " | " << std::setw(8)
+       << result.p50Milliseconds << " | " << std::setw(8) << result.p99Milliseconds << " | "
+       << std::setw(21) << result.cpuMicrosecondsPerNotification << " | " << std::setw(16)
+       << result.contextBytesPerItem << " | " << std::setw(12) << result.residentBytesPerItem
+       << "\n"
+       << std::flush;
+}
+
+/// Write the results as JSON, the schema is stable to compare results across releases.
+static void writeJson(
+    std::ostream& os, const Options& options, const std::vector<Result>& results
+) {
+    os << "{\n";
+    os << "  \"benchmark\": \"subscription\",\n";
+#ifdef UAPP_LOW_MEMORY
+    os << "  \"profile\": \"low-memory\",\n";
+#else
+    os << "  \"profile\": \"default\",\n";
+#endif
+#ifdef UAPP_VERSION
+    os << "  \"version\": \"" << UAPP_VERSION << "\",\n";
+#endif
+#ifdef UA_OPEN62541_VERSION
+    os << "  \"open62541Version\": \"" << UA_OPEN62541_VERSION << "\",\n";
+#endif
+    os << "  \"durationSeconds\": " << options.duration << ",\n";
+    os << "  \"updateRate\": " << options.rate << ",\n";
+    os << "  \"publishingInterval\": " << options.publishingInterval << ",\n";
+    os << "  \"samplingInterval\": " << options.samplingInterval << ",\n";
+    os << "  \"results\": [";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& result = results[i];
+        os << (i == 0 ? "\n" : ",\n") << "    {"
+           << "\"mode\": \"" << toString(result.mode) << "\", "
+           << "\"items\": " << result.items << ", "
+           << "\"failedItems\": " << result.failedItems << ", "
+           << "\"notifications\": " << result.notifications << ", "
+           << "\"notificationsPerSecond\": " << getNotificationsPerSecond(result) << ", "
+           << "\"updates\": " << result.updates << ", "
+           << "\"latencyP50Milliseconds\": " << result.p50Milliseconds << ", "
+           << "\"latencyP99Milliseconds\": " << result.p99Milliseconds << ", "
+           << "\"cpuMicrosecondsPerNotification\": " << result.cpuMicrosecondsPerNotification
+           << ", "
+           << "\"contextBytesPerItem\": " << result.contextBytesPerItem << ", "
+           << "\"residentBytesPerItem\": " << result.residentBytesPerItem << "}";
+    }
+    os << "\n  ]\n}\n";
+}
+
+/* ------------------------------------------- Options ------------------------------------------ */
+
+static Options parseOptions(int argc, char* argv[]) {  // NOLINT
+    Options options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const std::string_view key(argv[i]);  // NOLINT
+        const std::string value(argv[i + 1]);  // NOLINT
+        if (key == "--duration") {
+            options.duration = std::stod(value);
+        } else if (key == "--items") {
+            options.items.clear();
+            for (const auto& item : split(value)) {
+                options.items.push_back(std::stoull(item));
+            }
+        } else if (key == "--rate") {
+            options.rate = std::stod(value);
+        } else if (key == "--publishing-interval") {
+            options.publishingInterval = std::stod(value);
+        } else if (key == "--sampling-interval") {
+            options.samplingInterval = std::stod(value);
+        } else if (key == "--max-notifications") {
+            options.maxNotifications = static_cast<uint32_t>(std::stoul(value));
+        } else if (key == "--modes") {
+            options.modes.clear();
+            for (const auto& item : split(value)) {
+                if (item == toString(Mode::Item)) {
+                    options.modes.push_back(Mode::Item);
+                } else if (item == toString(Mode::Batch)) {
+                    options.modes.push_back(Mode::Batch);
+                }
+            }
+        } else if (key == "--json") {
+            options.json = value;
+        } else {
+            throw std::invalid_argument("Unknown option: " + std::string(key));
+        }
+    }
+    return options;
+}
+
+int main(int argc, char* argv[]) {
+    const auto options = parseOptions(argc, argv);
+    std::vector<Result> results;
+    printHeader(std::cout);
+    for (auto items : options.items) {
+        for (auto mode : options.modes) {
+            results.push_back(runCase(options, mode, items));
+            printResult(std::cout, results.back());
+        }
+    }
+    if (options.json == "-") {
+        writeJson(std::cout, options, results);
+    } else if (!options.json.empty()) {
+        std::ofstream file(options.json);
+        writeJson(file, options, results);
+    }
+    return EXIT_SUCCESS;
+}
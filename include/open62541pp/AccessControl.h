@@ -1,7 +1,10 @@
 #pragma once
 
+#include <atomic>
 #include <cstdint>
+#include <memory>
 #include <string>
+#include <utility>  // as_const, move
 #include <vector>
 
 #include "open62541pp/Bitmask.h"
@@ -13,6 +16,7 @@
 namespace opcua {
 
 // forward declare
+class CredentialStore;
 class DataValue;
 class DateTime;
 class ExtensionObject;
@@ -50,11 +54,22 @@ public:
 
     virtual ~AccessControlBase() = default;
 
-    AccessControlBase(const AccessControlBase&) = default;
-    AccessControlBase(AccessControlBase&&) noexcept = default;
+    AccessControlBase(const AccessControlBase& other) noexcept
+        : decisionCacheEnabled_(other.decisionCacheEnabled_),
+          decisionEpoch_(other.getDecisionEpoch()) {}
 
-    AccessControlBase& operator=(const AccessControlBase&) = default;
-    AccessControlBase& operator=(AccessControlBase&&) noexcept = default;
+    AccessControlBase(AccessControlBase&& other) noexcept
+        : AccessControlBase(std::as_const(other)) {}
+
+    AccessControlBase& operator=(const AccessControlBase& other) noexcept {
+        decisionCacheEnabled_ = other.decisionCacheEnabled_;
+        decisionEpoch_.store(other.getDecisionEpoch(), std::memory_order_release);
+        return *this;
+    }
+
+    AccessControlBase& operator=(AccessControlBase&& other) noexcept {
+        return *this = std::as_const(other);
+    }
 
     /**
      * Get available user token policies.
@@ -125,6 +140,37 @@ public:
         DateTime endTimestamp,
         bool isDeleteModified
     ) = 0;
+
+    /**
+     * Enable the cache of access decisions (disabled by default).
+     * If enabled, the results of getUserRightsMask, getUserAccessLevel and allowBrowseNode are
+     * cached per activated session and node, so the callbacks are invoked once per session and
+     * node. Enable the cache only if the decisions depend on the session and the node alone.
+     * The cache of a session is discarded when the session is (re)activated or closed, the caches
+     * of all sessions with invalidate.
+     */
+    void setDecisionCacheEnabled(bool enabled) noexcept {
+        decisionCacheEnabled_ = enabled;
+    }
+
+    bool isDecisionCacheEnabled() const noexcept {
+        return decisionCacheEnabled_;
+    }
+
+    /// Invalidate the cached access decisions of all sessions, e.g. after the rules changed.
+    /// Thread-safe, can be called while the server is running in another thread.
+    void invalidate() noexcept {
+        decisionEpoch_.fetch_add(1, std::memory_order_release);
+    }
+
+    /// Generation of the cached access decisions, incremented by invalidate.
+    uint64_t getDecisionEpoch() const noexcept {
+        return decisionEpoch_.load(std::memory_order_acquire);
+    }
+
+private:
+    bool decisionCacheEnabled_{false};
+    std::atomic<uint64_t> decisionEpoch_{0};
 };
 
 /* ----------------------------------- Default access control ----------------------------------- */
@@ -134,6 +180,8 @@ public:
  *
  * This class implements the same logic as @ref UA_AccessControl_default().
  * The log-in can be anonymous or username-password. A logged-in user has all access rights.
+ * Username-password logins are either compared with a list of plaintext logins or verified with a
+ * CredentialStore of salted password hashes.
  *
  * @warning Use less permissive access control in production!
  */
@@ -141,6 +189,13 @@ class AccessControlDefault : public AccessControlBase {
 public:
     explicit AccessControlDefault(bool allowAnonymous = true, std::vector<Login> logins = {});
 
+    /// Verify username-password logins with a credential store instead of the plaintext logins.
+    /// Must be set before the access control is applied with Server::setAccessControl.
+    /// Logins are verified synchronously in activateSession (see CredentialStore).
+    void setCredentialStore(std::shared_ptr<CredentialStore> credentials) noexcept {
+        credentials_ = std::move(credentials);
+    }
+
     std::vector<UserTokenPolicy> getUserTokenPolicies() override;
 
     StatusCode activateSession(
@@ -191,6 +246,7 @@ public:
 private:
     bool allowAnonymous_;
     std::vector<Login> logins_;
+    std::shared_ptr<CredentialStore> credentials_;
 };
 
 }  // namespace opcua
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "open62541pp/Common.h"  // NodeClass
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua {
+
+// forward declaration
+class Server;
+
+/**
+ * Secondary index of the server's address space for subtree, type definition and browse name
+ * queries.
+ *
+ * services::browseRecursive walks the graph on every call. The index walks the hierarchy below the
+ * root folder once and numbers the nodes in depth-first pre-order, so the subtree of a node is a
+ * contiguous range of positions. Nodes are additionally bucketed by type definition and browse
+ * name (sorted by position). Queries like "all variables of type AnalogItemType below Line3" are
+ * answered with a binary search in the bucket, in `O(log n + result)` instead of a traversal.
+ *
+ * Nodes with several hierarchical parents are indexed once, below the parent that is discovered
+ * first. Subtree queries follow this spanning tree.
+ *
+ * The index is maintained by the server: changes through the C++ API (NodeManagement services,
+ * NodeBatch, loadAddressSpace, browse name writes) mark the index as stale and the next query
+ * rebuilds it. Changes with the native API or by clients are not observed, call rebuild after such
+ * changes. Queries are thread-safe.
+ *
+ * @code
+ * auto& index = server.getAddressSpaceIndex();
+ * const auto analogItems = index.findByTypeDefinition(VariableTypeId::AnalogItemType, line3Id);
+ * @endcode
+ *
+ * @see Server::getAddressSpaceIndex
+ */
+class AddressSpaceIndex {
+public:
+    /**
+     * Build the index of the hierarchy below the root folder.
+     * @param server Server of the address space, must outlive the index
+     */
+    explicit AddressSpaceIndex(Server& server);
+
+    /// Rebuild the index, e.g. after changes with the native API.
+    void rebuild();
+
+    /// Number of indexed nodes.
+    size_t size() const;
+
+    /// Check if the node is indexed, i.e. part of the hierarchy below the root folder.
+    bool contains(const NodeId& id) const;
+
+    /// Check if the node is the root node or one of its descendants.
+    bool isInSubtree(const NodeId& id, const NodeId& rootId) const;
+
+    /**
+     * Get the root node and all its descendants in depth-first pre-order.
+     * @exception BadStatus (BadNodeIdUnknown) If the root node is not indexed
+     */
+    std::vector<NodeId> getSubtree(const NodeId& rootId) const;
+
+    /**
+     * Find objects and variables with the type definition in the subtree of a node.
+     * @param typeDefinition Object type or variable type
+     * @param rootId Root node of the subtree, the whole hierarchy by default
+     * @param includeSubtypes Include instances of subtypes of the type definition
+     * @return Node ids in depth-first pre-order
+     * @exception BadStatus (BadNodeIdUnknown) If the root node is not indexed
+     */
+    std::vector<NodeId> findByTypeDefinition(
+        const NodeId& typeDefinition,
+        const NodeId& rootId = ObjectId::RootFolder,
+        bool includeSubtypes = false
+    ) const;
+
+    /**
+     * Find nodes with the browse name in the subtree of a node.
+     * @param browseName Browse name
+     * @param rootId Root node of the subtree, the whole hierarchy by default
+     * @return Node ids in depth-first pre-order
+     * @exception BadStatus (BadNodeIdUnknown) If the root node is not indexed
+     */
+    std::vector<NodeId> findByBrowseName(
+        const QualifiedName& browseName, const NodeId& rootId = ObjectId::RootFolder
+    ) const;
+
+private:
+    struct Entry {
+        NodeId id;
+        NodeClass nodeClass;
+        uint32_t end;  // position past the last descendant
+    };
+
+    using Bucket = std::vector<uint32_t>;  // sorted positions
+
+    void update() const;
+    void build() const;
+    uint32_t getPosition(const NodeId& id) const;
+    void collect(const Bucket& bucket, uint32_t begin, uint32_t end, std::vector<uint32_t>& out)
+        const;
+    std::vector<NodeId> toNodeIds(const std::vector<uint32_t>& positions) const;
+
+    Server& server_;
+    mutable std::mutex mutex_;
+    mutable uint64_t generation_{0};
+    mutable std::vector<Entry> entries_;  // in depth-first pre-order
+    mutable std::unordered_map<NodeId, uint32_t> positions_;
+    mutable std::unordered_map<NodeId, Bucket> byTypeDefinition_;
+    mutable std::unordered_map<std::string, Bucket> byBrowseName_;  // key: "<ns>:<name>"
+};
+
+}  // namespace opcua
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "open62541pp/Common.h"  // NodeClass
+#include "open62541pp/Span.h"
+#include "open62541pp/types/Builtin.h"  // QualifiedName, LocalizedText
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/DateTime.h"
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua {
+
+// forward declaration
+class Server;
+
+/**
+ * Read-only snapshot of subtrees of the server's address space for concurrent readers.
+ *
+ * The snapshot is refreshed from the server thread and published as an immutable View. Views can
+ * be traversed from any thread without locking, and stay valid as long as they are referenced,
+ * even while the snapshot is refreshed.
+ *
+ * Nodes are shared copy-on-write between views: a refresh compares each node with the previous
+ * view (attributes, children and the stored value, read without copy) and only copies changed or
+ * new nodes. The node table of a view that is no longer referenced by any reader is reused as
+ * buffer of the next refresh.
+ * @code
+ * AddressSpaceSnapshot snapshot({ObjectId::ObjectsFolder});
+ * snapshot.refresh(server);  // server thread
+ *
+ * // analytic thread
+ * const auto view = snapshot.get();
+ * for (const auto& node : view->getNodes()) {
+ *     process(node->id, node->value);
+ * }
+ * @endcode
+ */
+class AddressSpaceSnapshot {
+public:
+    /// Immutable copy of a node.
+    struct Node {
+        NodeId id;
+        NodeClass nodeClass;
+        QualifiedName browseName;
+        LocalizedText displayName;
+        DataValue value;  ///< Stored value of variable nodes
+        std::vector<NodeId> children;  ///< Targets of hierarchical forward references
+    };
+
+    /// Immutable view of the snapshot.
+    class View {
+    public:
+        /// Find a node of the snapshot, `nullptr` if the node is not part of the snapshot.
+        const Node* find(const NodeId& id) const noexcept;
+
+        /// Root nodes of the subtrees.
+        Span<const NodeId> getRoots() const noexcept {
+            return roots_;
+        }
+
+        /// All nodes of the snapshot in breadth-first order.
+        const std::vector<std::shared_ptr<const Node>>& getNodes() const noexcept {
+            return nodes_;
+        }
+
+        size_t size() const noexcept {
+            return nodes_.size();
+        }
+
+        /// Time of the refresh.
+        const DateTime& getTimestamp() const noexcept {
+            return timestamp_;
+        }
+
+    private:
+        friend class AddressSpaceSnapshot;
+
+        void clear() noexcept;
+
+        std::vector<NodeId> roots_;
+        std::vector<std::shared_ptr<const Node>> nodes_;
+        std::unordered_map<NodeId, size_t> index_;
+        DateTime timestamp_;
+    };
+
+    /// Create an empty snapshot of the subtrees below `roots` (including the roots).
+    explicit AddressSpaceSnapshot(std::vector<NodeId> roots);
+
+    /**
+     * Refresh the snapshot and publish a new view.
+     * Must be called from the server thread (or before the server runs).
+     * Unknown root nodes are skipped.
+     * @return Number of copied (changed or new) nodes
+     */
+    size_t refresh(Server& server);
+
+    /// Get the current view (empty before the first refresh). Thread-safe.
+    std::shared_ptr<const View> get() const noexcept;
+
+private:
+    std::vector<NodeId> roots_;
+    std::shared_ptr<View> current_;  // accessed atomically
+    std::shared_ptr<View> spare_;  // unpublished buffer of the previous view
+};
+
+}  // namespace opcua
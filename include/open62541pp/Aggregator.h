@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "open62541pp/Common.h"  // TimestampsToReturn
+#include "open62541pp/Config.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/ValueStore.h"  // ValueSlot
+#include "open62541pp/WriteBatcher.h"
+#include "open62541pp/services/MonitoredItem.h"
+#include "open62541pp/services/Subscription.h"
+#include "open62541pp/types/Builtin.h"  // StatusCode
+#include "open62541pp/types/NodeId.h"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+namespace opcua {
+
+// forward declarations
+class Client;
+class Server;
+
+/**
+ * Options of Aggregator.
+ */
+struct AggregatorOptions {
+    /// Parameters of the subscription created per source.
+    services::SubscriptionParameters subscription{100.0};
+    /// Parameters of the monitored items of mirrored variables.
+    services::MonitoringParameters monitoring{TimestampsToReturn::Both, 100.0};
+    /// Options of the write batcher created per source.
+    WriteBatcherOptions writes;
+    /// Called with the downstream result of forwarded writes (in the source client's thread).
+    std::function<void(const NodeId& localId, StatusCode code)> onWriteResult;
+};
+
+/**
+ * Aggregate the variables of many downstream servers into a local server.
+ *
+ * Each source is a connected Client. Mirrored variables are created in the local server with
+ * remapped namespaces: the namespace of a remote node is mapped to the local namespace
+ * `<prefix><remote namespace URI>`, with the prefix of the source (the identifiers are kept).
+ * The values are monitored by one subscription per source with batched delivery and cached in
+ * ValueSlot instances. Upstream reads are served from the cache without downstream requests.
+ * Upstream writes are forwarded through a WriteBatcher of the source (write-behind, the upstream
+ * write completes immediately; the downstream result is reported with onWriteResult).
+ *
+ * Notifications are processed by the client loops, reads by the server loop. Neither side takes a
+ * lock, the server and the clients may run in different threads (e.g. with a Multiplexer). Add
+ * sources and mirror variables before the clients are run by other threads.
+ * The aggregator must be destroyed before the server and the clients. The destructor resets the
+ * data sources of the mirrored variables and deletes the subscriptions, stop the loops before.
+ * @code
+ * Aggregator aggregator(server);
+ * for (auto& plc : plcs) {  // connected clients
+ *     const auto source = aggregator.addSource(plc.client, plc.name + "/");
+ *     aggregator.mirror(source, ObjectId::ObjectsFolder, plc.variables);
+ * }
+ * @endcode
+ */
+class Aggregator {
+public:
+    explicit Aggregator(Server& server, AggregatorOptions options = {});
+    ~Aggregator();
+
+    Aggregator(const Aggregator&) = delete;
+    Aggregator(Aggregator&&) noexcept = delete;
+    Aggregator& operator=(const Aggregator&) = delete;
+    Aggregator& operator=(Aggregator&&) noexcept = delete;
+
+    /**
+     * Add a source server. The client must be connected.
+     * The namespaces of the source are registered in the local server and a subscription is
+     * created.
+     * @param client Connected client, must outlive the aggregator
+     * @param namespacePrefix Prefix of the local namespace URIs, unique per source
+     * @return Index of the source
+     */
+    size_t addSource(Client& client, std::string_view namespacePrefix);
+
+    /// Number of sources.
+    size_t getSourceCount() const noexcept {
+        return sources_.size();
+    }
+
+    /// Map a remote NodeId of a source to the local NodeId.
+    /// @exception BadStatus (BadNodeIdInvalid) If the namespace is unknown
+    NodeId getLocalId(size_t source, const NodeId& remoteId) const;
+
+    /**
+     * Mirror remote variables into the local server.
+     * The attributes are read with batched requests and the values are monitored with batched
+     * requests. Variables that can not be mirrored are skipped.
+     * @param source Index of the source
+     * @param parentId Local parent node
+     * @param remoteIds Remote variable nodes
+     * @return Local NodeIds, null for skipped variables
+     */
+    std::vector<NodeId> mirror(
+        size_t source, const NodeId& parentId, Span<const NodeId> remoteIds
+    );
+
+    /// Number of mirrored variables.
+    size_t size() const noexcept {
+        return slots_.size();
+    }
+
+private:
+    struct Source;
+
+    Server& server_;
+    AggregatorOptions options_;
+    std::vector<std::unique_ptr<Source>> sources_;
+    std::unordered_map<NodeId, std::unique_ptr<ValueSlot>> slots_;  // by local NodeId
+};
+
+}  // namespace opcua
+
+#endif
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <utility>  // move
+
+#include "open62541pp/types/Builtin.h"  // StatusCode
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua {
+
+// forward declaration
+class Server;
+
+/**
+ * Options of AsyncDataSource.
+ */
+struct AsyncDataSourceOptions {
+    /// Maximum age of the cached value. Younger values are served without a device read.
+    std::chrono::milliseconds maxAge{1000};
+    /// Maximum time a server read waits for a pending device read (0: never block the server loop).
+    std::chrono::milliseconds waitTimeout{0};
+    /// Time after which a pending device read is considered lost and a new one may be started.
+    std::chrono::milliseconds readTimeout{5000};
+};
+
+namespace detail {
+struct AsyncDataSourceState;
+}  // namespace detail
+
+/**
+ * Completion handle of an asynchronous device read.
+ * The handle can be copied and completed from any thread, only the first completion takes effect.
+ */
+class AsyncReadCompletion {
+public:
+    /// Complete the read with a value. Values without source timestamp are timestamped now.
+    void complete(DataValue value) const;
+
+    /// Complete the read with a failure status, e.g. `BadCommunicationError`.
+    void fail(StatusCode code) const;
+
+private:
+    friend class AsyncDataSource;
+
+    AsyncReadCompletion(std::shared_ptr<detail::AsyncDataSourceState> state, uint64_t requestId)
+        : state_(std::move(state)),
+          requestId_(requestId) {}
+
+    std::shared_ptr<detail::AsyncDataSourceState> state_;
+    uint64_t requestId_;
+};
+
+/**
+ * Data source for slow field devices (e.g. Modbus or serial), read asynchronously.
+ *
+ * Server reads never call into the device. They are served from a cache of the last device value.
+ * If the cached value is older than `maxAge`, a device read is started with the read function
+ * (one at a time) and completed later from any thread with the AsyncReadCompletion handle.
+ * Meanwhile, server reads wait at most `waitTimeout` for the completion and fall back to the cached
+ * value with status `UncertainLastUsableValue`. Reads before the first device value return
+ * `BadWaitingForInitialData`, or the status of the failed device read.
+ *
+ * The read function must not block, it should dispatch the device read to another thread (or an
+ * event loop). Numeric ranges are applied automatically, registered nodes are read-only.
+ * The data source must outlive the server.
+ * @code
+ * AsyncDataSource source([&](AsyncReadCompletion completion) {
+ *     pool.post([&device, completion] {
+ *         completion.complete(DataValue::fromScalar(device.read()));
+ *     });
+ * });
+ * source.registerNode(server, id);
+ * @endcode
+ *
+ * @note open62541 only supports asynchronous operations for method calls, not for reads. Server
+ * reads are therefore always answered within the current iteration of the server loop.
+ */
+class AsyncDataSource {
+public:
+    using ReadFunction = std::function<void(AsyncReadCompletion completion)>;
+
+    explicit AsyncDataSource(ReadFunction read, AsyncDataSourceOptions options = {});
+    ~AsyncDataSource();
+
+    AsyncDataSource(const AsyncDataSource&) = delete;
+    AsyncDataSource(AsyncDataSource&&) noexcept = delete;
+    AsyncDataSource& operator=(const AsyncDataSource&) = delete;
+    AsyncDataSource& operator=(AsyncDataSource&&) noexcept = delete;
+
+    /// Set the data source as value backend of a variable node.
+    /// @exception BadStatus If the value backend can not be set
+    void registerNode(Server& server, const NodeId& id);
+
+    /// Start a device read now, unless a read is pending (e.g. to prefetch the initial value).
+    void refresh();
+
+    /// Get the cached device value.
+    std::optional<DataValue> getCached() const;
+
+    const AsyncDataSourceOptions& getOptions() const noexcept {
+        return options_;
+    }
+
+private:
+    StatusCode read(DataValue& value, bool timestamp);
+    void start(uint64_t requestId);
+
+    ReadFunction read_;
+    AsyncDataSourceOptions options_;
+    std::shared_ptr<detail::AsyncDataSourceState> state_;
+};
+
+}  // namespace opcua
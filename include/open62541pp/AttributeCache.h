@@ -0,0 +1,156 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "open62541pp/Common.h"  // AttributeId
+#include "open62541pp/Config.h"
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua {
+
+// forward declarations
+class Client;
+template <typename T>
+class MonitoredItem;
+template <typename T>
+class Subscription;
+
+/**
+ * Options of AttributeCache.
+ */
+struct AttributeCacheOptions {
+    /// Maximum number of cached attributes, the least recently used entries are evicted first.
+    size_t capacity = 10000;
+    /// Time to live of cached attributes (0: no expiry).
+    std::chrono::milliseconds ttl{std::chrono::minutes(10)};
+    /// Cached attributes. The value attribute is not cached by default, add AttributeId::Value to
+    /// cache the values of rarely changing properties like `EngineeringUnits` as well.
+    std::vector<AttributeId> attributes{
+        AttributeId::NodeClass,
+        AttributeId::BrowseName,
+        AttributeId::DisplayName,
+        AttributeId::Description,
+        AttributeId::IsAbstract,
+        AttributeId::Symmetric,
+        AttributeId::InverseName,
+        AttributeId::DataType,
+        AttributeId::ValueRank,
+        AttributeId::ArrayDimensions,
+        AttributeId::AccessLevel,
+        AttributeId::MinimumSamplingInterval,
+        AttributeId::Historizing,
+        AttributeId::Executable,
+    };
+};
+
+/**
+ * Client-side cache of rarely changing node attributes.
+ *
+ * Enable the cache with Client::enableAttributeCache. Single attribute reads of the client
+ * (services::readAttribute and all high-level functions like services::readDisplayName or
+ * Node::readDataType) are served from the cache if the attribute is cached. Reads with timestamps
+ * (e.g. services::readDataValue) and the read service itself always go to the server.
+ *
+ * Entries are bounded by a capacity (LRU eviction) and a time to live. The cache is kept
+ * coherent by:
+ * - writes of the client (the written attributes are invalidated),
+ * - disconnect and reconnect (the cache is cleared),
+ * - ModelChangeEvents of the server with invalidateOnModelChange (the affected nodes are
+ *   invalidated).
+ *
+ * Changes by other clients are only observed after expiry or a ModelChangeEvent.
+ * The cache, like the client, is not thread-safe.
+ */
+class AttributeCache : public std::enable_shared_from_this<AttributeCache> {
+public:
+    explicit AttributeCache(AttributeCacheOptions options = {});
+
+    /// Check if the attribute is configured to be cached.
+    bool isCached(AttributeId attributeId) const noexcept;
+
+    /// Get a cached attribute.
+    /// @return Cached DataValue or `std::nullopt` if not cached or expired
+    std::optional<DataValue> get(const NodeId& id, AttributeId attributeId);
+
+    /// Insert or update a cached attribute, ignored if the attribute is not configured.
+    void put(const NodeId& id, AttributeId attributeId, const DataValue& value);
+
+    /// Remove all cached attributes of a node.
+    void invalidate(const NodeId& id) noexcept;
+    /// Remove a cached attribute of a node.
+    void invalidate(const NodeId& id, AttributeId attributeId) noexcept;
+
+    /// Remove all cached attributes.
+    void clear() noexcept;
+
+    /// Number of cached attributes.
+    size_t size() const noexcept {
+        return entries_.size();
+    }
+
+    /// Number of reads served from the cache.
+    size_t hits() const noexcept {
+        return hits_;
+    }
+
+    /// Number of cache misses (including expired entries).
+    size_t misses() const noexcept {
+        return misses_;
+    }
+
+    const AttributeCacheOptions& getOptions() const noexcept {
+        return options_;
+    }
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+    /**
+     * Invalidate affected nodes on ModelChangeEvents of the server.
+     * Creates an event monitored item for the Server object in the subscription. The nodes listed
+     * in the `Changes` field of `GeneralModelChangeEventType` and `SemanticChangeEventType` events
+     * are invalidated, the whole cache is cleared for events without `Changes`.
+     * The monitored item may outlive the cache.
+     */
+    MonitoredItem<Client> invalidateOnModelChange(Subscription<Client>& subscription);
+#endif
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Key {
+        NodeId id;
+        AttributeId attributeId;
+
+        bool operator==(const Key& other) const noexcept {
+            return attributeId == other.attributeId && id == other.id;
+        }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const noexcept;
+    };
+
+    struct Entry {
+        Key key;
+        DataValue value;
+        Clock::time_point expiry;
+    };
+
+    void erase(const Key& key) noexcept;
+
+    AttributeCacheOptions options_;
+    uint32_t attributeMask_{0};  // bit per AttributeId
+    std::list<Entry> entries_;  // most recently used first
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index_;
+    size_t hits_{0};
+    size_t misses_{0};
+};
+
+}  // namespace opcua
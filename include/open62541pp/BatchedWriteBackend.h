@@ -0,0 +1,140 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>  // move
+#include <vector>
+
+#include "open62541pp/Span.h"
+#include "open62541pp/open62541.h"
+#include "open62541pp/types/Builtin.h"  // NumericRangeDimension, StatusCode
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua {
+
+// forward declaration
+class Server;
+
+namespace detail {
+struct BatchedWriteState;
+}  // namespace detail
+
+/**
+ * Write of a node handed over to the device by BatchedWriteBackend.
+ */
+struct BatchedWrite {
+    uint64_t key;  ///< Key of the node
+    DataValue value;  ///< Written value
+    std::vector<NumericRangeDimension> range;  ///< Written subset, empty for the full value
+};
+
+/**
+ * Completion handle of an asynchronous batch write.
+ * The handle can be copied and completed from any thread, only the first completion takes effect.
+ */
+class BatchedWriteCompletion {
+public:
+    /// Complete the batch with the status codes of the writes (same order as the batch).
+    /// Missing status codes are treated as `BadInternalError`.
+    void complete(Span<const StatusCode> results) const;
+
+    /// Complete all writes of the batch with the same status, e.g. `BadCommunicationError`.
+    void fail(StatusCode code) const;
+
+private:
+    friend class BatchedWriteBackend;
+
+    BatchedWriteCompletion(std::shared_ptr<detail::BatchedWriteState> state, uint64_t batchId)
+        : state_(std::move(state)),
+          batchId_(batchId) {}
+
+    std::shared_ptr<detail::BatchedWriteState> state_;
+    uint64_t batchId_;
+};
+
+/**
+ * Value backend to write many nodes through to a device in batches.
+ *
+ * Data source writes are invoked per node and per write item, so a client writing `N` setpoints
+ * in one request would trigger `N` device transactions. The backend queues the writes of its nodes
+ * instead and hands them over to the write function as a single batch after the request is
+ * processed (in the next iteration of the server loop). The write function must not block, it
+ * should dispatch the device transaction to another thread and complete the batch later with the
+ * BatchedWriteCompletion handle.
+ *
+ * The nodes keep a shadow of the last written value (or the last device value set with setValue),
+ * that is served to readers. Writes are accepted when they are queued (write-behind): open62541
+ * answers write requests synchronously, the device results can not be returned to the client.
+ * Writes rejected by the device set their status code in the shadow value instead, unless the
+ * node has been written or updated meanwhile.
+ *
+ * The nodes are registered with Server::setVariableNodeValueBackends and identified by a user key
+ * (e.g. a register address). The backend must be destroyed before the server, the destructor
+ * resets the value backends of its nodes (reads fail with `BadInternalError` afterwards).
+ * @code
+ * BatchedWriteBackend backend(server, [&](auto writes, BatchedWriteCompletion completion) {
+ *     pool.post([&device, writes = std::move(writes), completion] {
+ *         completion.complete(device.writeMany(writes));
+ *     });
+ * });
+ * backend.registerNodes(ids, keys);
+ * @endcode
+ */
+class BatchedWriteBackend {
+public:
+    using WriteFunction =
+        std::function<void(std::vector<BatchedWrite> writes, BatchedWriteCompletion completion)>;
+
+    BatchedWriteBackend(Server& server, WriteFunction write);
+    ~BatchedWriteBackend();
+
+    BatchedWriteBackend(const BatchedWriteBackend&) = delete;
+    BatchedWriteBackend(BatchedWriteBackend&&) noexcept = delete;
+    BatchedWriteBackend& operator=(const BatchedWriteBackend&) = delete;
+    BatchedWriteBackend& operator=(BatchedWriteBackend&&) noexcept = delete;
+
+    /// Set the backend as value backend of variable nodes.
+    /// Nodes without value return `BadWaitingForInitialData` until they are written or updated.
+    /// @param ids Variable nodes
+    /// @param keys Keys of the nodes, same size as `ids`
+    /// @exception BadStatus If the value backends can not be set
+    void registerNodes(Span<const NodeId> ids, Span<const uint64_t> keys);
+
+    /// Update the shadow value of a node, e.g. with a value polled from the device.
+    /// Unknown keys are ignored.
+    void setValue(uint64_t key, DataValue value);
+
+    /// Hand over the queued writes now, without waiting for the server loop.
+    void flush();
+
+    /// Number of queued writes, that have not been handed over yet.
+    size_t getQueuedWrites() const;
+
+    /// Number of handed over batches, that have not been completed yet.
+    size_t getPendingBatches() const;
+
+    /// Value backend member of Server::setVariableNodeValueBackends.
+    StatusCode read(
+        uint64_t key, DataValue& value, Span<const NumericRangeDimension> range, bool timestamp
+    );
+
+    /// Value backend member of Server::setVariableNodeValueBackends.
+    StatusCode write(
+        uint64_t key, const DataValue& value, Span<const NumericRangeDimension> range
+    );
+
+private:
+    static void flushCallback(UA_Server* server, void* data) noexcept;
+    void scheduleFlush();
+
+    Server& server_;
+    WriteFunction write_;
+    std::shared_ptr<detail::BatchedWriteState> state_;
+    std::vector<NodeId> nodeIds_;  // registered nodes
+    uint64_t callbackId_{0};
+};
+
+}  // namespace opcua
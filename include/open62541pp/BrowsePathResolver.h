@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "open62541pp/Config.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/types/Builtin.h"  // QualifiedName
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua {
+
+// forward declarations
+class Client;
+template <typename T>
+class MonitoredItem;
+template <typename T>
+class Subscription;
+
+/**
+ * Resolve many browse paths with few TranslateBrowsePathsToNodeIds requests.
+ *
+ * Browse paths are resolved segment by segment. All paths are advanced one segment per round,
+ * the segments of all paths are sent with a single (chunked) TranslateBrowsePathsToNodeIds
+ * request. Common prefixes of the paths are resolved only once, e.g. the 50k paths
+ * `Objects/Line1/Motor3/Speed`, `Objects/Line1/Motor3/Torque`, ... require as many rounds as the
+ * longest path has segments and each segment (parent node and browse name) is requested only once.
+ *
+ * Resolved segments are cached in a trie of NodeIds: later paths with cached prefixes only send
+ * their remaining segments. Segments that can not be resolved are cached as well. Hierarchical
+ * references (including subtypes) are followed, the first target node of a segment is used.
+ *
+ * The cache is invalidated with invalidate(), e.g. after a reconnect, or automatically by
+ * ModelChangeEvents with invalidateOnModelChange.
+ * The resolver must not outlive the client and, like the client, is not thread-safe.
+ * @code
+ * BrowsePathResolver resolver(client);
+ * std::vector<std::vector<QualifiedName>> paths{
+ *     {{0, "Server"}, {0, "ServerStatus"}, {0, "State"}},
+ *     {{0, "Server"}, {0, "ServerStatus"}, {0, "CurrentTime"}},
+ * };
+ * const auto ids = resolver.resolvePaths(ObjectId::RootFolder, paths);
+ * @endcode
+ */
+class BrowsePathResolver {
+public:
+    explicit BrowsePathResolver(Client& client);
+
+    ~BrowsePathResolver();
+
+    BrowsePathResolver(const BrowsePathResolver&) = delete;
+    BrowsePathResolver(BrowsePathResolver&&) noexcept = default;
+    BrowsePathResolver& operator=(const BrowsePathResolver&) = delete;
+    BrowsePathResolver& operator=(BrowsePathResolver&&) noexcept = delete;
+
+    /**
+     * Resolve browse paths starting at the same origin node.
+     * @param origin Starting node of all browse paths
+     * @param browsePaths Browse paths, each given as a sequence of browse names
+     * @return Target NodeIds in the order of the browse paths, a null NodeId if a path can not be
+     *         resolved
+     * @exception BadStatus If a TranslateBrowsePathsToNodeIds request fails
+     */
+    std::vector<NodeId> resolvePaths(
+        const NodeId& origin, Span<const std::vector<QualifiedName>> browsePaths
+    );
+
+    /**
+     * Resolve a single browse path.
+     * @return Target NodeId or a null NodeId if the path can not be resolved
+     * @exception BadStatus If a TranslateBrowsePathsToNodeIds request fails
+     */
+    NodeId resolvePath(const NodeId& origin, Span<const QualifiedName> browsePath);
+
+    /// Clear all cached segments.
+    void invalidate() noexcept;
+
+    /// Number of cached segments.
+    size_t cachedSegments() const noexcept;
+
+    /// Number of TranslateBrowsePathsToNodeIds requests sent, excluding chunks.
+    size_t requestCount() const noexcept;
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+    /**
+     * Invalidate the cache on ModelChangeEvents of the server.
+     * Creates an event monitored item for the Server object in the subscription. The cache is
+     * cleared whenever a `BaseModelChangeEventType`, `GeneralModelChangeEventType` or
+     * `SemanticChangeEventType` event is received. The monitored item may outlive the resolver.
+     */
+    MonitoredItem<Client> invalidateOnModelChange(Subscription<Client>& subscription);
+#endif
+
+private:
+    struct Cache;
+
+    Client* client_;
+    std::shared_ptr<Cache> cache_;  // shared with the model change event callback
+};
+
+}  // namespace opcua
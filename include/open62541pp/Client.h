@@ -1,17 +1,26 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <future>
 #include <memory>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <utility>  // forward
 #include <vector>
 
+#include "open62541pp/AttributeCache.h"
+#include "open62541pp/ClientDiagnostics.h"
+#include "open62541pp/ClientMetrics.h"
 #include "open62541pp/Common.h"
 #include "open62541pp/Config.h"
 #include "open62541pp/Logger.h"
+#include "open62541pp/MemoryStatistics.h"
 #include "open62541pp/Span.h"
 #include "open62541pp/Subscription.h"
+#include "open62541pp/TransportSettings.h"
 #include "open62541pp/types/NodeId.h"
 
 // forward declaration open62541
@@ -23,9 +32,12 @@ namespace opcua {
 class ApplicationDescription;
 class ByteString;
 class Client;
+struct ConnectionCache;
 class DataType;
+class DataTypeRegistry;
 class EndpointDescription;
 struct Login;
+class NamespaceTable;
 template <typename ServerOrClient>
 class Node;
 
@@ -36,6 +48,31 @@ ClientContext& getContext(Client& client) noexcept;
 
 using StateCallback = std::function<void()>;
 
+/**
+ * Priority of async client requests, queued by the request scheduler.
+ * @see Client::setRequestWindow
+ */
+enum class RequestPriority : uint8_t {
+    High,
+    Normal,
+    Low,
+};
+
+/**
+ * Operation limits of a server (`Server/ServerCapabilities/OperationLimits`).
+ * A value of 0 indicates that there is no limit or the limit is unknown.
+ */
+struct OperationLimits {
+    uint32_t maxNodesPerRead = 0;
+    uint32_t maxNodesPerWrite = 0;
+    uint32_t maxNodesPerMethodCall = 0;
+    uint32_t maxNodesPerBrowse = 0;
+    uint32_t maxNodesPerTranslateBrowsePathsToNodeIds = 0;
+    uint32_t maxNodesPerNodeManagement = 0;
+    uint32_t maxMonitoredItemsPerCall = 0;
+    uint32_t maxNodesPerHistoryReadData = 0;
+};
+
 /**
  * High-level client class.
  *
@@ -93,8 +130,28 @@ public:
     std::vector<EndpointDescription> getEndpoints(std::string_view serverUrl);
 
     /// Set custom logging function.
+    /// Messages rejected by the filter are discarded before formatting.
     /// Does nothing if the passed function is empty or a nullptr.
-    void setLogger(Logger logger);
+    void setLogger(Logger logger, const LogFilter& filter = {});
+
+    /**
+     * Set custom logging function, called asynchronously from a background thread.
+     * Messages are formatted into fixed-size records (without allocations) and passed through a
+     * lock-free ring buffer. The logging function is therefore not called from the thread issuing
+     * the message and does not block it. Dropped messages are reported with a warning.
+     * Does nothing if the passed function is empty or a nullptr.
+     */
+    void setAsyncLogger(Logger logger, const AsyncLoggerOptions& options = {});
+
+    /**
+     * Set structured logging function, called with unformatted log records.
+     * The record references the format string and the arguments of the log call. Formatting is
+     * deferred to the consumer (LogRecord::format) or skipped, e.g. if the arguments are shipped
+     * in binary form. Replaces the (asynchronous) logging function set before.
+     * Messages rejected by the filter are discarded.
+     * Does nothing if the passed function is empty or a nullptr.
+     */
+    void setStructuredLogger(StructuredLogger logger, const LogFilter& filter = {});
 
     /// Set response timeout in milliseconds.
     void setTimeout(uint32_t milliseconds);
@@ -102,9 +159,96 @@ public:
     /// Set message security mode.
     void setSecurityMode(MessageSecurityMode mode);
 
+    /**
+     * Set buffer sizes and message limits of the transport.
+     * Must be called before connecting; the buffer sizes are negotiated with the server.
+     * @see TransportSettings::largePayload, TransportSettings::lowLatency
+     */
+    void setTransportSettings(const TransportSettings& settings);
+
+    /**
+     * Limit the number of async requests in flight (flow control).
+     * Requests exceeding the window are queued by priority and sent as soon as responses arrive.
+     * Submitting a request to a full queue throws a BadStatus with
+     * `UA_STATUSCODE_BADTOOMANYOPERATIONS` (back-pressure).
+     * Queued requests are sent immediately if the window is enlarged or disabled.
+     * @param maxInFlight Maximum number of requests in flight (0: unlimited, default)
+     * @param maxQueued Maximum number of queued requests (0: unlimited)
+     */
+    void setRequestWindow(size_t maxInFlight, size_t maxQueued = 0);
+    /// Set the priority of subsequent async requests (default: RequestPriority::Normal).
+    /// Queued requests with higher priority are sent first, e.g. keep-alive reads ahead of bulk
+    /// history reads.
+    void setRequestPriority(RequestPriority priority) noexcept;
+    /// Number of async requests in flight, tracked if a request window is set.
+    size_t getRequestsInFlight() const noexcept;
+    /// Number of async requests queued, waiting for a free slot in the request window.
+    size_t getRequestsQueued() const noexcept;
+
+    /**
+     * Enable or disable the collection of request metrics (disabled by default).
+     * Requests sent by open62541pp (sync and async) are timed from their initiation until the
+     * response or failure is processed, with latency histograms per service. Bad service results,
+     * timeouts and the requests in flight are counted. Requests sent internally by open62541 (e.g.
+     * session management and publish requests) are not recorded. Disabled metrics cost a single
+     * atomic load per request.
+     * @see ClientMetrics, toPrometheus
+     */
+    void setMetricsEnabled(bool enabled);
+    /// Check if the collection of metrics is enabled.
+    bool isMetricsEnabled();
+    /// Get a snapshot of the metrics.
+    ClientMetrics getMetrics();
+    /// Reset the counters and histograms. The requests in flight are kept.
+    void resetMetrics();
+    /// Set a tracer to create spans of requests (e.g. OpenTelemetry spans).
+    /// Pass `nullptr` to remove the tracer. Requests in flight keep the tracer of their initiation.
+    /// @see RequestTracer
+    void setRequestTracer(std::shared_ptr<RequestTracer> tracer);
+
+    /**
+     * Sample requests with diagnostics (disabled by default).
+     * Sampled requests (1 in N, or of specific services or nodes) ask the server to return
+     * diagnostics, which are delivered to the callback together with the service name and the
+     * response header. Requests that are not sampled are sent unchanged; disabled sampling costs
+     * a single atomic load per request. Pass an empty callback to disable the sampling.
+     * @see DiagnosticsSampling, RequestDiagnostics
+     */
+    void setDiagnosticsSampling(const DiagnosticsSampling& sampling, DiagnosticsCallback callback);
+
+    /**
+     * Enable or disable the accounting of native allocations and copies (disabled by default).
+     * The native accounting is process-wide and active while enabled by any server or client.
+     * Subscription and monitored item contexts are always counted.
+     * @see MemoryStatistics
+     */
+    void setMemoryAccountingEnabled(bool enabled);
+    /// Check if the accounting of native allocations is enabled by this client.
+    bool isMemoryAccountingEnabled();
+    /// Get a snapshot of the memory held or allocated by the client and the native allocations.
+    MemoryStatistics getMemoryStatistics();
+
     /// Set custom data types.
     /// All data types provided are automatically considered for decoding of received messages.
     void setCustomDataTypes(std::vector<DataType> dataTypes);
+    /// Set passthrough data types.
+    /// Passthrough data types are known to findDataType, but not decoded with received messages.
+    /// Their ExtensionObject bodies stay binary encoded and can be forwarded without a
+    /// decode/re-encode cycle. Use ExtensionObject::getDecodedData to decode them on demand.
+    /// Passing all custom data types enables the passthrough mode for the whole client.
+    /// @note Passthrough data types must not be used as members of decoded custom data types.
+    void setPassthroughDataTypes(std::vector<DataType> dataTypes);
+    /// Attach a shared registry of custom and passthrough data types.
+    /// The registry replaces the data types of setCustomDataTypes and setPassthroughDataTypes and
+    /// can be shared by many instances without copies of the data types and lookup indexes.
+    /// @see DataTypeRegistry
+    void setDataTypeRegistry(std::shared_ptr<const DataTypeRegistry> registry);
+    /// Get the registry of the custom data types, `nullptr` if no data types are set.
+    std::shared_ptr<const DataTypeRegistry> getDataTypeRegistry() const noexcept;
+    /// Find data type (custom or builtin) by its type id or binary encoding id.
+    /// Custom data types are indexed once by setCustomDataTypes, the lookup is in constant time.
+    /// @return Pointer to the data type or `nullptr` if not found
+    const UA_DataType* findDataType(const NodeId& id) const noexcept;
 
     /// Set a state callback that will be called after the client is connected.
     void onConnected(StateCallback callback);
@@ -128,6 +272,15 @@ public:
      */
     void connect(std::string_view endpointUrl, const Login& login);
 
+    /**
+     * Reconnect to the endpoint of the last connect call, e.g. after a transient network drop.
+     * The endpoint description of the last connection is reused, the endpoint discovery is
+     * skipped. If the session is still valid on the server, the session is reactivated and its
+     * subscriptions continue. Otherwise a new session is created.
+     * @exception BadStatus (BadInvalidState) If connect was not called before
+     */
+    void reconnect();
+
     /// Disconnect and close a connection to the server (async, without blocking).
     void disconnect() noexcept;
 
@@ -135,15 +288,83 @@ public:
     bool isConnected() noexcept;
 
     /// Get all defined namespaces.
+    /// @see getNamespaceTable
     std::vector<std::string> getNamespaceArray();
+    /// Get the cached namespace table of the server.
+    /// The namespace array is read once and cached until the client is disconnected or
+    /// reconnected. The table can also be seeded with a connection cache (setConnectionCache).
+    const NamespaceTable& getNamespaceTable();
+    /// Get the namespace index of the URI in constant time.
+    /// The namespace table is refreshed once if the URI is not found, namespaces might have been
+    /// added to the server.
+    /// @exception BadStatus (BadNotFound) If the namespace URI is unknown
+    uint16_t getNamespaceIndex(std::string_view uri);
+    /// Resolve an ExpandedNodeId with namespace URI (`nsu=`) to a NodeId of the server.
+    /// @exception BadStatus (BadNotFound) If the namespace URI is unknown
+    /// @exception BadStatus (BadNodeIdUnknown) If the ExpandedNodeId refers to another server
+    NodeId resolveNodeId(const ExpandedNodeId& id);
+
+    /// Get the connection data (endpoint, server certificate, namespaces) of the connected client.
+    /// @see ConnectionCache
+    ConnectionCache getConnectionCache();
+    /// Seed the client with cached connection data before connect to skip the endpoint discovery
+    /// and the read of the namespace array.
+    /// @see ConnectionCache
+    void setConnectionCache(const ConnectionCache& cache);
+
+    /// Get the operation limits of the connected server.
+    /// The limits are read once after connect and cached until the client is disconnected.
+    /// Large requests of the services read, write, browse, translateBrowsePathsToNodeIds and
+    /// addNodes are split automatically into chunks within these limits. Multiple chunks are sent
+    /// at a time and the results are reassembled in order.
+    const OperationLimits& getOperationLimits();
+
+    /// Enable the client-side attribute cache. An existing cache is replaced.
+    /// @see AttributeCache
+    AttributeCache& enableAttributeCache(AttributeCacheOptions options = {});
+    /// Disable and clear the attribute cache.
+    void disableAttributeCache() noexcept;
+    /// Get the attribute cache, `nullptr` if not enabled.
+    AttributeCache* getAttributeCache() noexcept;
+
+    /**
+     * Register nodes for efficient access (RegisterNodes service).
+     * The registered aliases (node ids) of the server are substituted transparently in read and
+     * write requests. The nodes are registered again after each Client::connect; until then the
+     * original node ids are used.
+     * Nodes are only registered with the server, if the client is connected.
+     */
+    void registerNodes(Span<const NodeId> ids);
+    /// Unregister nodes registered with registerNodes.
+    void unregisterNodes(Span<const NodeId> ids);
+    /// Get the registered alias of a node id or the node id itself, if not registered.
+    const NodeId& getRegisteredNodeId(const NodeId& id) const noexcept;
 
 #ifdef UA_ENABLE_SUBSCRIPTIONS
     /// Create a subscription to monitor data changes and events (default subscription parameters).
     Subscription<Client> createSubscription();
     /// Create a subscription to monitor data changes and events.
     Subscription<Client> createSubscription(SubscriptionParameters& parameters);
+    /// Create a subscription with batched delivery of data change notifications.
+    /// The notifications of all monitored items are delivered with one call per iteration.
+    /// @see services::createSubscription
+    Subscription<Client> createSubscription(
+        SubscriptionParameters& parameters, DataChangeBatchCallback onDataChangeBatch
+    );
     /// Get all active subscriptions
     std::vector<Subscription<Client>> getSubscriptions();
+
+    /**
+     * Enable the recovery of subscriptions lost with their session.
+     * Subscriptions and monitored items created afterwards are recorded. After a new session is
+     * activated (e.g. the server restarted), the lost subscriptions are recreated with their
+     * callbacks by the client's main loop, see services::recoverSubscriptions.
+     * The client object must outlive the recovery, as with submit.
+     * @param onRecovered Optional callback with the results (new identifiers) of the recovery
+     */
+    void enableSubscriptionRecovery(
+        std::function<void(Span<const RecoveredSubscription>)> onRecovered = {}
+    );
 #endif
 
     /**
@@ -156,10 +377,43 @@ public:
     /// Run the client's main loop by. This method will block until Client::stop is called.
     void run();
     /// Stop the client's main loop.
+    /// A background network thread is joined, its exception (if any) is rethrown.
     void stop();
     /// Check if the client's main loop is running.
     bool isRunning() const noexcept;
 
+    /**
+     * Run the client's main loop in a background network thread.
+     * Other threads must not use the client directly, but post tasks to the network thread with
+     * post or submit. Completion handlers are invoked on the network thread; use bindExecutor to
+     * forward them to another executor.
+     * Exceptions of the network loop (e.g. from callbacks) stop the thread and are rethrown by
+     * stop.
+     * @param timeoutMilliseconds Timeout of each iteration, maximum latency of posted tasks
+     */
+    void runInBackground(uint16_t timeoutMilliseconds = 10);
+    /// Check if the calling thread is the background network thread.
+    bool isNetworkThread() const noexcept;
+
+    /// Post a task to be executed by the client's main loop (thread-safe, lock-free).
+    /// Posted tasks are executed on the next iteration of runIterate, run or runInBackground.
+    void post(std::function<void()> task);
+
+    /**
+     * Submit a function to be invoked with the client by the client's main loop (thread-safe).
+     * Use it to initiate async services from any thread. The client object must outlive the task.
+     * @param func Callable with the signature `R(Client&)`
+     * @return Future of the function's result
+     */
+    template <typename Func>
+    auto submit(Func&& func) {
+        using Result = std::invoke_result_t<Func, Client&>;
+        auto task = std::make_shared<std::packaged_task<Result(Client&)>>(std::forward<Func>(func));
+        auto future = task->get_future();
+        post([task, this] { (*task)(*this); });
+        return future;
+    }
+
     Node<Client> getNode(NodeId id);
     Node<Client> getRootNode();
     Node<Client> getObjectsNode();
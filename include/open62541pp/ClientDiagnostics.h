@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "open62541pp/Span.h"
+#include "open62541pp/types/Builtin.h"  // DiagnosticInfo
+#include "open62541pp/types/Composed.h"  // ResponseHeader
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua {
+
+/**
+ * Sampling of requests with diagnostics.
+ * Sampled requests ask the server to return diagnostics (`returnDiagnostics` of the request
+ * header), which are delivered to the diagnostics callback. A request is sampled if any of the
+ * criteria matches.
+ * @see Client::setDiagnosticsSampling
+ */
+struct DiagnosticsSampling {
+    /// Sample every N-th request of all services (0 = disabled).
+    uint32_t interval = 0;
+    /// Sample all requests of these services, e.g. `Read` (names of ClientServiceMetrics).
+    std::vector<std::string> services;
+    /// Sample all requests referencing one of these nodes.
+    /// Supported are Read, Write, Browse, Call and CreateMonitoredItems requests.
+    std::vector<NodeId> nodes;
+    /// Diagnostics mask of sampled requests, default: all service and operation level diagnostics.
+    /// @see https://reference.opcfoundation.org/Core/Part4/v105/docs/7.33
+    uint32_t returnDiagnostics = 0x3FF;
+};
+
+/**
+ * Diagnostics returned by the server for a request.
+ * The references are only valid during the call of the diagnostics callback.
+ * @see DiagnosticsCallback
+ */
+struct RequestDiagnostics {
+    std::string_view service;  ///< Service name, e.g. `Read`
+    /// Response header with the service result, the service diagnostics and the string table
+    /// referenced by the diagnostics (symbolic id, namespace uri, localized text, locale).
+    const ResponseHeader& responseHeader;
+    /// Diagnostics of the operations, empty if not returned by the service.
+    Span<const DiagnosticInfo> operationDiagnostics;
+};
+
+/// Diagnostics callback, called by the thread processing the response (e.g. Client::runIterate).
+using DiagnosticsCallback = std::function<void(const RequestDiagnostics& diagnostics)>;
+
+}  // namespace opcua
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "open62541pp/ServerMetrics.h"  // LatencyHistogram
+#include "open62541pp/types/Builtin.h"  // StatusCode
+
+namespace opcua {
+
+/**
+ * Request metrics of a client service.
+ * Requests are timed from their initiation until the response (or failure) is processed by the
+ * client, including the time spent in the queue of the request window.
+ */
+struct ClientServiceMetrics {
+    std::string service;  ///< Service name, e.g. `Read` or `CreateMonitoredItems`
+    uint64_t requests = 0;  ///< Completed requests
+    uint64_t badStatus = 0;  ///< Requests completed with a bad service result, including timeouts
+    uint64_t timeouts = 0;  ///< Requests completed with `BadTimeout`
+    LatencyHistogram latency;
+};
+
+/**
+ * Snapshot of the client metrics.
+ * @see Client::setMetricsEnabled, Client::getMetrics
+ */
+struct ClientMetrics {
+    std::vector<ClientServiceMetrics> services;  ///< Services with recorded requests
+    uint64_t inFlight = 0;  ///< Requests in flight (sent or queued, not completed)
+    uint64_t maxInFlight = 0;  ///< Maximum of requests in flight since the last reset
+
+    /// Get the metrics of a service by name, `nullptr` if no request was recorded.
+    const ClientServiceMetrics* findService(std::string_view service) const noexcept {
+        for (const auto& item : services) {
+            if (item.service == service) {
+                return &item;
+            }
+        }
+        return nullptr;
+    }
+};
+
+/**
+ * Span of a client request.
+ * @see RequestTracer
+ */
+struct RequestSpan {
+    std::string_view service;  ///< Service name, e.g. `Read`
+    std::chrono::steady_clock::time_point start;
+    std::chrono::steady_clock::time_point end;  ///< Set at the end of the span
+    StatusCode status;  ///< Service result, set at the end of the span
+};
+
+/**
+ * Hooks to trace client requests with spans, e.g. OpenTelemetry spans.
+ * The tracer is independent of the metrics, requests are traced even if metrics are disabled.
+ * Both hooks are called synchronously: startSpan by the thread initiating the request, endSpan by
+ * the thread processing the response (e.g. Client::runIterate). Exceptions are caught and
+ * rethrown by the client's run loop.
+ * @see Client::setRequestTracer
+ */
+class RequestTracer {
+public:
+    virtual ~RequestTracer() = default;
+
+    /// Start the span of an initiated request.
+    /// @return Handle of the span passed to endSpan, e.g. a pointer to a span object
+    virtual void* startSpan(const RequestSpan& span) = 0;
+
+    /// End the span of a completed, failed or cancelled request.
+    virtual void endSpan(void* handle, const RequestSpan& span) = 0;
+};
+
+/**
+ * Format client metrics in the Prometheus text exposition format.
+ * Metric names are prefixed with `opcua_client_`, e.g. `opcua_client_requests_total`,
+ * `opcua_client_request_duration_seconds` and `opcua_client_requests_in_flight`.
+ * @see https://prometheus.io/docs/instrumenting/exposition_formats/
+ */
+std::string toPrometheus(const ClientMetrics& metrics);
+
+}  // namespace opcua
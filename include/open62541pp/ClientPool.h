@@ -0,0 +1,132 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>  // forward
+#include <vector>
+
+#include "open62541pp/Client.h"
+#include "open62541pp/Config.h"
+
+namespace opcua {
+
+/**
+ * Options of ClientPool.
+ */
+struct ClientPoolOptions {
+    /// Number of clients (sessions) per endpoint.
+    size_t clientsPerEndpoint = 1;
+    /// Minimum interval between reconnect attempts of a failed member.
+    std::chrono::milliseconds reconnectInterval{1000};
+};
+
+/**
+ * Pool of clients with sessions to one or more (e.g. redundant) endpoints.
+ *
+ * Requests are dispatched to the connected member with the least requests in flight. The pool
+ * enables the request tracking of its members with an unlimited request window
+ * (Client::setRequestWindow). Subscriptions are spread across the members by their number of
+ * subscriptions.
+ *
+ * Members are marked as failed by their `onDisconnected` state callback and reconnected by
+ * runIterate after the reconnect interval. The state callbacks `onConnected` and `onDisconnected`
+ * of the members are used by the pool and must not be replaced.
+ * The pool, like the client, is not thread-safe.
+ * @code
+ * ClientPool pool({"opc.tcp://server-a:4840", "opc.tcp://server-b:4840"}, {2});
+ * pool.connect();
+ * pool.dispatch([&](Client& client) {
+ *     services::readValueAsync(client, id, [](StatusCode code, Variant& value) {
+ *         // ...
+ *     });
+ * });
+ * pool.run();
+ * @endcode
+ */
+class ClientPool {
+public:
+    explicit ClientPool(std::vector<std::string> endpointUrls, ClientPoolOptions options = {});
+
+    ~ClientPool() = default;
+
+    ClientPool(const ClientPool&) = delete;
+    ClientPool(ClientPool&&) noexcept = delete;
+    ClientPool& operator=(const ClientPool&) = delete;
+    ClientPool& operator=(ClientPool&&) noexcept = delete;
+
+    /// Number of members.
+    size_t size() const noexcept {
+        return members_.size();
+    }
+
+    /// Get a member of the pool, e.g. to configure it before connect.
+    Client& getClient(size_t index) {
+        return members_.at(index).client;
+    }
+
+    /// Endpoint URL of a member.
+    const std::string& getEndpointUrl(size_t index) const {
+        return members_.at(index).endpointUrl;
+    }
+
+    /// Connect all members. Failed members are reconnected by runIterate.
+    /// @return Number of connected members
+    size_t connect();
+
+    /// Disconnect all members, failed members are not reconnected anymore.
+    void disconnect() noexcept;
+
+    /// Number of connected members.
+    size_t connectedCount() const noexcept;
+
+    /// Get the connected member with the least requests in flight.
+    /// @exception BadStatus (BadNotConnected) If no member is connected
+    Client& acquire();
+
+    /// Get the connected member with the least subscriptions.
+    /// @exception BadStatus (BadNotConnected) If no member is connected
+    Client& acquireForSubscription();
+
+    /**
+     * Invoke a function with the least-loaded member, e.g. to initiate an async service.
+     * @param func Callable with the signature `auto(Client&)`
+     */
+    template <typename Func>
+    decltype(auto) dispatch(Func&& func) {
+        return std::forward<Func>(func)(acquire());
+    }
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+    /// Create a subscription with the member with the least subscriptions.
+    Subscription<Client> createSubscription();
+    /// @copydoc createSubscription
+    Subscription<Client> createSubscription(SubscriptionParameters& parameters);
+#endif
+
+    /// Run a single iteration of all members and reconnect failed members.
+    /// @param timeoutMilliseconds Timeout of each member's runIterate call
+    void runIterate(uint16_t timeoutMilliseconds = 0);
+    /// Run the pool's main loop. This method will block until ClientPool::stop is called.
+    void run();
+    /// Stop the pool's main loop.
+    void stop() noexcept;
+
+private:
+    struct Member {
+        std::string endpointUrl;
+        Client client;
+        bool connected{false};
+        std::chrono::steady_clock::time_point lastAttempt{};
+    };
+
+    bool tryConnect(Member& member) noexcept;
+
+    ClientPoolOptions options_;
+    std::vector<Member> members_;
+    bool reconnect_{false};
+    bool running_{false};
+};
+
+}  // namespace opcua
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "open62541pp/Config.h"
+#include "open62541pp/Event.h"
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/types/Builtin.h"  // LocalizedText, StatusCode
+#include "open62541pp/types/NodeId.h"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+
+namespace opcua {
+
+// forward declaration
+class Server;
+
+/**
+ * State of an alarm condition.
+ * @see https://reference.opcfoundation.org/Core/Part9/v105/docs/5.8
+ */
+struct ConditionState {
+    bool active = false;
+    bool acked = true;
+    bool confirmed = true;
+    uint16_t severity = 0;
+
+    /// Conditions are retained (reported by refresh) while active, unacknowledged or unconfirmed.
+    bool isRetained() const noexcept {
+        return active || !acked || !confirmed;
+    }
+};
+
+/**
+ * Definition of an alarm condition.
+ */
+struct ConditionDefinition {
+    NodeId sourceId;
+    std::string sourceName;
+    std::string conditionName;
+};
+
+/**
+ * Server-side state engine of many alarm conditions.
+ *
+ * The states are kept in a compact array, indexed by the identifiers returned by addCondition.
+ * State transitions are reported as events of type `AlarmConditionType`. The condition nodes are
+ * materialized lazily with the first event of a condition (not linked in the address space) and
+ * reused with pre-resolved property nodes. The NodeId of a condition node is the `ConditionId` of
+ * its events (see getConditionId). The events carry the ActiveState, AckedState and
+ * ConfirmedState with their `Id` properties.
+ *
+ * Transitions follow the Alarms & Conditions state model: activation resets the acknowledged and
+ * confirmed states, acknowledge and confirm are only allowed once per activation. Single
+ * transitions throw on failure, bulk transitions return a status code per condition and emit all
+ * events in one pass.
+ *
+ * The store is not synchronized, transitions must be serialized with the server loop.
+ * @code
+ * ConditionStore store(server);
+ * const auto id = store.addCondition({sourceId, "Boiler", "HighTemperature"});
+ * store.setActive(id, true, 800, {"", "Temperature too high"});
+ * store.acknowledge(id);
+ * @endcode
+ */
+class ConditionStore {
+public:
+    /**
+     * Create an empty store.
+     * @param server Server instance
+     * @param originId Origin node of the emitted events (requires `EventNotifier` attribute)
+     */
+    explicit ConditionStore(Server& server, const NodeId& originId = ObjectId::Server);
+
+    ConditionStore(const ConditionStore&) = delete;
+    ConditionStore(ConditionStore&&) noexcept = delete;
+    ConditionStore& operator=(const ConditionStore&) = delete;
+    ConditionStore& operator=(ConditionStore&&) noexcept = delete;
+
+    /// Add a condition, initially inactive.
+    /// @return Identifier of the condition
+    uint32_t addCondition(const ConditionDefinition& definition);
+
+    /// Number of conditions.
+    size_t size() const noexcept {
+        return states_.size();
+    }
+
+    /// Get the state of a condition.
+    /// @exception BadStatus (BadInvalidArgument) If the identifier is unknown
+    ConditionState getState(uint32_t id) const;
+
+    /// Get the definition of a condition.
+    /// @exception BadStatus (BadInvalidArgument) If the identifier is unknown
+    const ConditionDefinition& getDefinition(uint32_t id) const;
+
+    /// Get the `ConditionId` of a condition, the NodeId of its condition node.
+    /// The condition node is materialized if no event of the condition was emitted yet.
+    /// @exception BadStatus (BadInvalidArgument) If the identifier is unknown
+    const NodeId& getConditionId(uint32_t id);
+
+    /**
+     * Activate or deactivate a condition and emit an event.
+     * Activation of an inactive condition resets the acknowledged and confirmed states.
+     * @param id Identifier of the condition
+     * @param active New active state
+     * @param severity Severity from 1 (lowest) to 1000 (highest)
+     * @param message Message of the event, the last message is kept if empty
+     * @exception BadStatus (BadInvalidArgument) If the identifier is unknown
+     */
+    void setActive(uint32_t id, bool active, uint16_t severity, const LocalizedText& message = {});
+
+    /// Activate or deactivate many conditions and emit their events in one pass.
+    /// @return Status codes in the order of `ids`
+    std::vector<StatusCode> setActive(
+        Span<const uint32_t> ids, bool active, uint16_t severity, const LocalizedText& message = {}
+    );
+
+    /**
+     * Acknowledge a condition and emit an event.
+     * @exception BadStatus (BadInvalidArgument) If the identifier is unknown
+     * @exception BadStatus (BadConditionBranchAlreadyAcked) If the condition is already acked
+     */
+    void acknowledge(uint32_t id);
+
+    /// Acknowledge many conditions and emit their events in one pass.
+    /// @return Status codes in the order of `ids`
+    std::vector<StatusCode> acknowledge(Span<const uint32_t> ids);
+
+    /**
+     * Confirm a condition and emit an event.
+     * @exception BadStatus (BadInvalidArgument) If the identifier is unknown
+     * @exception BadStatus (BadConditionBranchAlreadyConfirmed) If the condition is already
+     *            confirmed
+     */
+    void confirm(uint32_t id);
+
+    /// Confirm many conditions and emit their events in one pass.
+    /// @return Status codes in the order of `ids`
+    std::vector<StatusCode> confirm(Span<const uint32_t> ids);
+
+    /// Get the identifiers of all retained conditions.
+    std::vector<uint32_t> getRetained() const;
+
+    /**
+     * Emit the events of all retained conditions, e.g. on ConditionRefresh.
+     * The events are streamed from the state array without browsing the address space, bracketed
+     * by a `RefreshStartEventType` and a `RefreshEndEventType` event.
+     * @return Number of emitted condition events
+     */
+    size_t refresh();
+
+private:
+    StatusCode transitionActive(uint32_t id, bool active, uint16_t severity);
+    StatusCode transitionAcked(uint32_t id);
+    StatusCode transitionConfirmed(uint32_t id);
+    void checkId(uint32_t id) const;
+    Event& getEvent(uint32_t id);
+    void writeEvent(Event& event, uint32_t id);
+    void emit(Span<const uint32_t> ids);
+    void triggerRefreshEvent(std::optional<Event>& event, const NodeId& eventType);
+
+    Server& server_;
+    NodeId originId_;
+    std::vector<ConditionState> states_;  // hot data
+    std::vector<ConditionDefinition> definitions_;
+    std::vector<LocalizedText> messages_;
+    std::vector<std::unique_ptr<Event>> events_;  // condition nodes, created on first emission
+    std::optional<Event> refreshStartEvent_;
+    std::optional<Event> refreshEndEvent_;
+};
+
+}  // namespace opcua
+
+#endif
@@ -35,3 +35,19 @@
     (defined(UA_ENABLE_ENCRYPTION_OPENSSL) || defined(UA_ENABLE_ENCRYPTION_LIBRESSL))
 #define UAPP_CREATE_CERTIFICATE
 #endif
+
+// asymmetric decryption of the OpenSSL/LibreSSL security policies is thread-safe (mbedTLS is not)
+#if defined(UA_ENABLE_ENCRYPTION_OPENSSL) || defined(UA_ENABLE_ENCRYPTION_LIBRESSL)
+#define UAPP_HAS_CRYPTO_OFFLOAD
+#endif
+
+#if defined(UA_ENABLE_METHODCALLS) && defined(UA_MULTITHREADING) && UA_MULTITHREADING >= 100
+#define UAPP_HAS_ASYNC_OPERATIONS
+#endif
+
+// direct access to the node store of open62541 v1.2/v1.3 (changed in v1.4), not synchronized with
+// the server lock of UA_MULTITHREADING
+#if UAPP_OPEN62541_VER_GE(1, 2) && UAPP_OPEN62541_VER_LE(1, 3) &&                                 \
+    !(defined(UA_MULTITHREADING) && UA_MULTITHREADING >= 100)
+#define UAPP_HAS_BORROWED_NODESTORE
+#endif
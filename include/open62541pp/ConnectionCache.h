@@ -0,0 +1,56 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "open62541pp/types/Composed.h"
+
+namespace opcua {
+
+/**
+ * Connection data of a server, persisted to speed up the startup of short-lived clients.
+ *
+ * Get the cache of a connected client with Client::getConnectionCache and seed a new client with
+ * Client::setConnectionCache before connecting:
+ * - The cached endpoint description (including the server certificate) and user token policy
+ *   are used directly, the endpoint discovery (GetEndpoints service) is skipped.
+ * - The cached namespace array is returned by Client::getNamespaceArray without a read request.
+ *
+ * The cache is not validated. If the server configuration changed (e.g. a renewed certificate),
+ * connect fails; discard the cache and connect without it.
+ * @code
+ * Client client;
+ * if (auto cache = loadConnectionCache("server.cache")) {
+ *     client.setConnectionCache(*cache);
+ * }
+ * client.connect("opc.tcp://localhost:4840");
+ * saveConnectionCache("server.cache", client.getConnectionCache());
+ * @endcode
+ */
+struct ConnectionCache {
+    /// Endpoint URL passed to Client::connect.
+    std::string endpointUrl;
+    /// Selected endpoint description, including the server certificate.
+    EndpointDescription endpoint;
+    /// Selected user token policy of the endpoint.
+    UserTokenPolicy userTokenPolicy;
+    /// Namespace array of the server.
+    std::vector<std::string> namespaceArray;
+};
+
+/**
+ * Save the connection cache to a file in binary format.
+ * @note Requires binary encoding, only supported since open62541 v1.3
+ * @exception BadStatus If the encoding or writing of the file fails
+ */
+void saveConnectionCache(std::string_view path, const ConnectionCache& cache);
+
+/**
+ * Load the connection cache from a file.
+ * @return The connection cache or `std::nullopt` if the file does not exist or is invalid
+ */
+std::optional<ConnectionCache> loadConnectionCache(std::string_view path);
+
+}  // namespace opcua
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace opcua {
+
+/**
+ * Salted password hash, derived with PBKDF2-HMAC-SHA256.
+ * Hashes can be derived once (e.g. at deployment) and stored instead of plaintext passwords.
+ */
+struct PasswordHash {
+    std::array<uint8_t, 16> salt{};
+    std::array<uint8_t, 32> key{};
+    uint32_t iterations{0};
+
+    /**
+     * Derive the hash of a password with a random salt.
+     * @param password Plaintext password
+     * @param iterations KDF cost, the number of PBKDF2 iterations
+     */
+    static PasswordHash derive(std::string_view password, uint32_t iterations);
+
+    /// Check if the password matches the hash (constant-time comparison).
+    bool matches(std::string_view password) const;
+};
+
+/**
+ * Options of the CredentialStore.
+ */
+struct CredentialStoreOptions {
+    /// KDF cost of passwords added in plaintext.
+    uint32_t iterations = 10000;
+    /// Validity of successful verifications in the verification cache, zero to disable the cache.
+    std::chrono::steady_clock::duration cacheDuration = std::chrono::seconds(60);
+    /// Maximum number of cached verifications, the cache is cleared if exceeded.
+    size_t maxCacheSize = 65536;
+    /// Number of threads of the shared worker pool reserved for verifyAsync (at least one).
+    /// Further verifications are queued until a thread is available.
+    size_t asyncThreads = 2;
+};
+
+/**
+ * Thread-safe store of user credentials with salted password hashes.
+ *
+ * Passwords are only stored as PBKDF2 hashes. The key derivation is deliberately expensive, so
+ * successful verifications are kept in a short-lived verification cache: repeated logins of the
+ * same user (e.g. reconnect storms after a network outage) are verified with a single keyed
+ * SHA-256 digest instead of the full key derivation. The cache never stores plaintext passwords.
+ *
+ * Verifications can run concurrently and off the server loop with verifyAsync, e.g. to warm up
+ * the cache before clients reconnect. The asynchronous verifications run on a bounded worker pool
+ * (see CredentialStoreOptions::asyncThreads).
+ *
+ * Use the store with AccessControlDefault to authenticate username/password logins. The session
+ * activation of open62541 is synchronous, so AccessControlDefault calls verify on the server loop:
+ * logins served from the cache are cheap, all others block the server loop for one key derivation.
+ */
+class CredentialStore {
+public:
+    explicit CredentialStore(CredentialStoreOptions options = {});
+    /// Wait for pending verifications of verifyAsync.
+    ~CredentialStore();
+
+    CredentialStore(const CredentialStore&) = delete;
+    CredentialStore(CredentialStore&&) noexcept = delete;
+    CredentialStore& operator=(const CredentialStore&) = delete;
+    CredentialStore& operator=(CredentialStore&&) noexcept = delete;
+
+    /// Add or replace a user, the password is hashed with the configured KDF cost.
+    void addUser(std::string_view username, std::string_view password);
+
+    /// Add or replace a user with a pre-derived password hash.
+    void addUser(std::string_view username, const PasswordHash& hash);
+
+    /// Remove a user and its cached verifications.
+    void removeUser(std::string_view username);
+
+    /// Number of users.
+    size_t size() const;
+
+    /// Verify the credentials of a user.
+    /// Unknown users are rejected after a key derivation with the configured iterations, so the
+    /// duration does not reveal whether a user exists.
+    bool verify(std::string_view username, std::string_view password);
+
+    /// Verify the credentials of a user on the worker pool.
+    std::future<bool> verifyAsync(std::string username, std::string password);
+
+    /// Discard all cached verifications.
+    void clearCache();
+
+    /// Number of verifications served from the cache.
+    size_t getCacheHits() const;
+
+private:
+    using Digest = std::array<uint8_t, 32>;
+    using Clock = std::chrono::steady_clock;
+
+    struct CachedVerification {
+        Digest digest;
+        Clock::time_point expiry;
+    };
+
+    Digest getCacheDigest(std::string_view username, std::string_view password) const;
+
+    CredentialStoreOptions options_;
+    std::array<uint8_t, 32> cacheKey_{};  // random key of the cache digests
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, PasswordHash> users_;
+    std::unordered_map<std::string, CachedVerification> cache_;  // by username
+    size_t cacheHits_{0};
+    std::condition_variable pendingCv_;
+    size_t pending_{0};  // verifications of verifyAsync
+};
+
+}  // namespace opcua
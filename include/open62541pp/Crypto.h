@@ -1,6 +1,9 @@
 #pragma once
 
 #include <cstddef>
+#include <deque>
+#include <mutex>
+#include <vector>
 
 #include "open62541pp/Config.h"
 #include "open62541pp/Span.h"
@@ -50,6 +53,109 @@ CreateCertificateResult createCertificate(
     CertificateFormat certificateFormat = CertificateFormat::DER
 );
 
+/**
+ * Generate RSA private keys in parallel, independent of a certificate.
+ *
+ * The keys can be signed later with the overload of createCertificate taking a private key, e.g.
+ * to provision device identities from a pool of pre-generated keys (see PrivateKeyPool).
+ *
+ * @param count Number of keys
+ * @param keySizeBits Size of the generated keys in bits, e.g. 2048 or 4096
+ * @param keyFormat Format of the private keys, either DER or PEM
+ * @param threads Number of worker threads. If set to 0, the hardware concurrency is used.
+ *
+ * @exception CreateCertificateError
+ */
+std::vector<ByteString> generatePrivateKeys(
+    size_t count,
+    size_t keySizeBits = 2048,
+    CertificateFormat keyFormat = CertificateFormat::DER,
+    size_t threads = 0
+);
+
+/**
+ * Create a self-signed X.509 v3 certificate for an existing private key.
+ *
+ * The certificate has the same content as the certificates created by UA_CreateCertificate.
+ *
+ * @param subject Elements for the subject,
+ *        e.g. {"C=DE", "O=SampleOrganization", "CN=Open62541Server@localhost"}
+ * @param subjectAltName Elements for SubjectAltName,
+ *        e.g. {"DNS:localhost", "URI:urn:open62541.server.application"}
+ * @param privateKey RSA private key in `DER` or `PEM` encoded format
+ * @param certificateFormat Certificate format, either DER or PEM
+ *
+ * @exception CreateCertificateError
+ */
+ByteString createCertificate(
+    Span<const String> subject,
+    Span<const String> subjectAltName,
+    const ByteString& privateKey,
+    CertificateFormat certificateFormat = CertificateFormat::DER
+);
+
+/// Subject and SubjectAltName of a certificate to create with createCertificates.
+struct CertificateRequest {
+    std::vector<String> subject;
+    std::vector<String> subjectAltName;
+};
+
+/**
+ * Create self-signed X.509 v3 certificates in parallel.
+ *
+ * Keys and certificates are generated by a pool of worker threads, the results have the same
+ * order as the requests. Key generation dominates, see generatePrivateKeys to separate it.
+ *
+ * @param requests Subject and SubjectAltName of each certificate
+ * @param keySizeBits Size of the generated keys in bits, e.g. 2048 or 4096
+ * @param certificateFormat Format of the private keys and certificates, either DER or PEM
+ * @param threads Number of worker threads. If set to 0, the hardware concurrency is used.
+ *
+ * @exception CreateCertificateError
+ */
+std::vector<CreateCertificateResult> createCertificates(
+    Span<const CertificateRequest> requests,
+    size_t keySizeBits = 2048,
+    CertificateFormat certificateFormat = CertificateFormat::DER,
+    size_t threads = 0
+);
+
+/**
+ * Thread-safe pool of pre-generated private keys.
+ *
+ * The pool is filled in parallel ahead of time (e.g. idle time or startup) and keys are consumed
+ * on demand when new devices are onboarded. An empty pool generates the key synchronously.
+ */
+class PrivateKeyPool {
+public:
+    explicit PrivateKeyPool(
+        size_t keySizeBits = 2048, CertificateFormat keyFormat = CertificateFormat::DER
+    );
+
+    /// Generate keys in parallel until the pool contains `targetSize` keys.
+    /// @param threads Number of worker threads. If set to 0, the hardware concurrency is used.
+    void fill(size_t targetSize, size_t threads = 0);
+
+    /// Take a key from the pool, generate one if the pool is empty.
+    ByteString acquire();
+
+    /// Create a self-signed certificate with a key from the pool.
+    CreateCertificateResult createCertificate(
+        Span<const String> subject,
+        Span<const String> subjectAltName,
+        CertificateFormat certificateFormat = CertificateFormat::DER
+    );
+
+    /// Number of available keys.
+    size_t size() const;
+
+private:
+    size_t keySizeBits_;
+    CertificateFormat keyFormat_;
+    mutable std::mutex mutex_;
+    std::deque<ByteString> keys_;
+};
+
 #endif  // ifdef UAPP_CREATE_CERTIFICATE
 
 }  // namespace opcua::crypto
@@ -2,14 +2,17 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <functional>  // invoke
+#include <mutex>  // call_once, once_flag
+#include <optional>
 #include <type_traits>
-#include <utility>  // move
+#include <utility>  // forward, move
 #include <vector>
 
 #include "open62541pp/DataType.h"
-#include "open62541pp/TypeRegistry.h"  // getDataType
 #include "open62541pp/detail/helper.h"
 #include "open62541pp/detail/traits.h"
+#include "open62541pp/typeregistry/Builtin.h"  // getDataType
 #include "open62541pp/types/NodeId.h"
 
 namespace opcua {
@@ -39,8 +42,11 @@ struct TagDataTypeUnion;
 /**
  * Builder to create DataType definitions of custom types.
  *
- * The attributes `memSize`, `padding`, `pointerFree`, `isArray` and `isOptional` are automatically
- * deduced from the types itself.
+ * The attributes `memSize`, `padding`, `pointerFree`, `overlayable`, `isArray` and `isOptional` are
+ * automatically deduced from the types itself.
+ * Structures are marked as `overlayable` if they are tightly packed (no padding) and all members
+ * are overlayable (numeric types, if the platform's endianness matches the binary encoding).
+ * Arrays of overlayable structures are encoded and decoded with a single memcpy.
  */
 template <typename T, typename Tag = detail::TagDataTypeAny, typename U = struct DeferT>
 class DataTypeBuilder {
@@ -141,10 +147,25 @@ private:
     explicit DataTypeBuilder(DataType dataType)
         : dataType_(std::move(dataType)) {}
 
+    bool isOverlayable() const noexcept {
+        if (dataType_.getTypeKind() != UA_DATATYPEKIND_STRUCTURE || fields_.empty()) {
+            return false;
+        }
+        size_t memSize = 0;
+        for (const auto& field : fields_) {
+            if (!field.overlayable || field.dataTypeMember.padding != 0) {
+                return false;
+            }
+            memSize += field.memSize;
+        }
+        return memSize == sizeof(T);
+    }
+
     struct Field {
         size_t memSize;
         size_t offset;
         DataTypeMember dataTypeMember;
+        bool overlayable;  // fixed-size member with identical memory and binary layout
     };
 
     DataType dataType_;
@@ -226,6 +247,7 @@ auto& DataTypeBuilder<T, Tag, U>::addField(const char* fieldName, const UA_DataT
             false,
             std::is_pointer_v<TMember>
         ),
+        !std::is_pointer_v<TMember> && fieldType.overlayable,
     });
     return *this;
 }
@@ -258,6 +280,7 @@ auto& DataTypeBuilder<T, Tag, U>::addField(const char* fieldName, const UA_DataT
             true,
             false
         ),
+        false,
     });
     return *this;
 }
@@ -290,6 +313,7 @@ auto& DataTypeBuilder<T, Tag, U>::addUnionField(
             false,
             std::is_pointer_v<TField>
         ),
+        false,
     });
     return *this;
 }
@@ -312,6 +336,8 @@ template <typename T, typename Tag, typename U>
                 );
             }
         }
+        // overlayable if the memory layout equals the binary encoding (enables memcpy coding)
+        dataType_.setOverlayable(isOverlayable());
     }
     // generate and set members array
     std::vector<DataTypeMember> dataTypeMembers(fields_.size());
@@ -322,4 +348,47 @@ template <typename T, typename Tag, typename U>
     return dataType_;
 }
 
+namespace detail {
+
+template <typename T>
+struct DataTypeOnce {
+    static inline std::once_flag flag;
+    static inline std::optional<DataType> dataType;
+};
+
+}  // namespace detail
+
+/**
+ * Build the DataType of the type `T` only once and keep it in static storage.
+ *
+ * The build function is invoked by the first call for `T` only (thread-safe), subsequent calls
+ * return the same DataType without rebuilding or allocating. The storage is bound to the type `T`,
+ * not to the build function: all calls for the same type share one DataType, even with different
+ * lambda expressions (e.g. in several translation units). Useful for TypeRegistry specializations:
+ * @code
+ * template <>
+ * struct TypeRegistry<Point> {
+ *     static const UA_DataType& getDataType() {
+ *         return buildDataTypeOnce<Point>([] {
+ *             return DataTypeBuilder<Point>::createStructure("Point", {1, 1001}, {1, 1})
+ *                 .addField<&Point::x>("x")
+ *                 .addField<&Point::y>("y")
+ *                 .build();
+ *         });
+ *     }
+ * };
+ * @endcode
+ */
+template <typename T, typename BuildFunc>
+const DataType& buildDataTypeOnce(BuildFunc&& build) {
+    static_assert(
+        std::is_invocable_r_v<DataType, BuildFunc>, "The build function must return a DataType"
+    );
+    using Storage = detail::DataTypeOnce<T>;
+    std::call_once(Storage::flag, [&] {
+        Storage::dataType.emplace(std::invoke(std::forward<BuildFunc>(build)));
+    });
+    return *Storage::dataType;
+}
+
 }  // namespace opcua
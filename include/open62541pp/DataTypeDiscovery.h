@@ -0,0 +1,94 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "open62541pp/DataTypeRegistry.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/types/NodeId.h"
+#include "open62541pp/types/Variant.h"
+
+namespace opcua {
+
+// forward declaration
+class Client;
+
+/**
+ * Data type definition of a server node.
+ */
+struct DiscoveredDataType {
+    /// NodeId of the DataType node.
+    NodeId typeId;
+    /// Name of the data type (BrowseName).
+    std::string name;
+    /// Value of the DataTypeDefinition attribute, `UA_StructureDefinition` or `UA_EnumDefinition`.
+    Variant definition;
+};
+
+/**
+ * Options of discoverDataTypes.
+ */
+struct DataTypeDiscoveryOptions {
+    /// Directory of the cached data type definitions, empty to disable the cache.
+    /// The directory must exist.
+    std::string cacheDirectory;
+};
+
+/**
+ * Read the data type definitions of a namespace from the server.
+ *
+ * The subtypes of `Structure` and `Enumeration` are browsed recursively. The DataTypeDefinition
+ * attributes of all concrete data types of the namespace are read in a single request.
+ * Fields with data types without definition are resolved to their builtin supertype (e.g. a
+ * subtype of `Double`, abstract structures to `ExtensionObject` and abstract numbers to
+ * `Variant`).
+ *
+ * The client is iterated until all nodes are browsed, see services::browseRecursive.
+ * @note Only supported since open62541 v1.3
+ * @exception BadStatus (BadNotFound) If the namespace URI is unknown
+ * @exception BadStatus If a service request failed
+ */
+std::vector<DiscoveredDataType> readDataTypeDefinitions(
+    Client& client, std::string_view namespaceUri
+);
+
+/**
+ * Create data type descriptions from data type definitions.
+ *
+ * The memory layout of the structures is deduced from the fields: members are aligned to their
+ * natural alignment (8 bytes for pointers and types with pointers), arrays are stored as size and
+ * pointer, optional fields as pointers. The decoded objects can be accessed generically with the
+ * members of the data types.
+ * Definitions, that can not be described by open62541 (e.g. structures with subtyped values or
+ * fields with unknown data types), are skipped together with their dependent data types.
+ * @note Only supported since open62541 v1.3
+ */
+std::shared_ptr<const DataTypeRegistry> createDataTypeRegistry(
+    Span<const DiscoveredDataType> dataTypes
+);
+
+/**
+ * Discover the custom data types of namespaces at runtime.
+ *
+ * Call this function after connect, the registry is attached with Client::setDataTypeRegistry:
+ * @code
+ * client.connect("opc.tcp://localhost:4840");
+ * client.setDataTypeRegistry(discoverDataTypes(client, {"http://example.org/types/"}, {"cache"}));
+ * @endcode
+ *
+ * If a cache directory is set, the definitions of each namespace are stored in a file keyed by
+ * the namespace URI and its version (NamespaceVersion property of the namespace metadata).
+ * Later connections load the cached definitions without discovery. Namespaces without version are
+ * not cached. Namespace indexes of cached definitions are mapped to the current namespace array.
+ * @see readDataTypeDefinitions
+ * @see createDataTypeRegistry
+ */
+std::shared_ptr<const DataTypeRegistry> discoverDataTypes(
+    Client& client,
+    Span<const std::string> namespaceUris,
+    const DataTypeDiscoveryOptions& options = {}
+);
+
+}  // namespace opcua
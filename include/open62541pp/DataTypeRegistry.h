@@ -0,0 +1,103 @@
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "open62541pp/DataType.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/open62541.h"
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua {
+
+/**
+ * Immutable set of custom data types, that can be shared by many Server and Client instances.
+ *
+ * Server::setCustomDataTypes and Client::setCustomDataTypes store and index the data types per
+ * instance. A registry holds the data types, the native data type array for the decoder of
+ * open62541 and the lookup index once. Instances attached with `setDataTypeRegistry` keep a
+ * reference to the registry, the registry is destroyed with the last reference.
+ * @code
+ * auto registry = std::make_shared<const DataTypeRegistry>(dataTypes);
+ * for (auto& client : clients) {
+ *     client.setDataTypeRegistry(registry);
+ * }
+ * @endcode
+ * @note Data types referenced as members of other data types must be part of the same registry.
+ */
+class DataTypeRegistry {
+    struct ComposeTag {};
+
+public:
+    /**
+     * @param dataTypes Custom data types, passed to the decoder of open62541
+     * @param passthroughDataTypes Passthrough data types, only indexed for lookup
+     *        (see Server::setPassthroughDataTypes)
+     */
+    explicit DataTypeRegistry(
+        std::vector<DataType> dataTypes, std::vector<DataType> passthroughDataTypes = {}
+    );
+
+    /**
+     * Compose a registry of the custom data types of one registry and the passthrough data types
+     * of another registry.
+     * The data types are not copied, the composed registry keeps both registries alive. Data types
+     * of registries created by `createDataTypeRegistry` reference names and member types owned by
+     * the registry and must not outlive it.
+     * @param dataTypesSource Registry of the custom data types, may be `nullptr`
+     * @param passthroughSource Registry of the passthrough data types, may be `nullptr`
+     */
+    static std::shared_ptr<const DataTypeRegistry> compose(
+        std::shared_ptr<const DataTypeRegistry> dataTypesSource,
+        std::shared_ptr<const DataTypeRegistry> passthroughSource
+    );
+
+    DataTypeRegistry(const DataTypeRegistry&) = delete;
+    DataTypeRegistry(DataTypeRegistry&&) noexcept = delete;
+    DataTypeRegistry& operator=(const DataTypeRegistry&) = delete;
+    DataTypeRegistry& operator=(DataTypeRegistry&&) noexcept = delete;
+
+    ~DataTypeRegistry() = default;
+
+    /// Custom data types.
+    Span<const DataType> getDataTypes() const noexcept {
+        return dataTypesView_;
+    }
+
+    /// Passthrough data types.
+    Span<const DataType> getPassthroughDataTypes() const noexcept {
+        return passthroughView_;
+    }
+
+    /// Native data type array for the `customDataTypes` of the server or client config.
+    const UA_DataTypeArray* array() const noexcept {
+        return &array_;
+    }
+
+    /// Find custom or passthrough data type by its type id or binary encoding id in constant time.
+    /// @return Pointer to the data type or `nullptr` if not found (builtin types are not included)
+    const UA_DataType* find(const NodeId& id) const noexcept;
+
+    /// @private
+    DataTypeRegistry(
+        ComposeTag,
+        std::shared_ptr<const DataTypeRegistry> dataTypesSource,
+        std::shared_ptr<const DataTypeRegistry> passthroughSource
+    );
+
+private:
+    void buildIndex();
+
+    std::vector<DataType> dataTypes_;
+    std::vector<DataType> passthroughDataTypes_;
+    // owners of the data types of composed registries
+    std::shared_ptr<const DataTypeRegistry> dataTypesOwner_;
+    std::shared_ptr<const DataTypeRegistry> passthroughOwner_;
+    Span<const DataType> dataTypesView_;  // references dataTypes_ or dataTypesOwner_
+    Span<const DataType> passthroughView_;  // references passthroughDataTypes_ or passthroughOwner_
+    UA_DataTypeArray array_;  // references dataTypesView_
+    std::unordered_map<NodeId, const UA_DataType*> index_;
+};
+
+}  // namespace opcua
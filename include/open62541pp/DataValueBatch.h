@@ -0,0 +1,139 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>  // memcpy
+#include <memory>
+#include <utility>  // move
+
+#include "open62541pp/Common.h"  // AttributeId
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/TypeWrapper.h"
+#include "open62541pp/detail/helper.h"  // isPointerFree
+#include "open62541pp/open62541.h"
+#include "open62541pp/typeregistry/Builtin.h"
+#include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/Composed.h"
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/DateTime.h"
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua {
+
+/**
+ * Batch of write values built from columnar input.
+ *
+ * All write value headers and scalar payloads are stored in a single contiguous allocation,
+ * instead of one allocation per Variant and DataValue. The batch can be passed to
+ * `services::write` as `Span<const WriteValue>` directly.
+ * The node ids are referenced and must outlive the batch.
+ * @code
+ * std::vector<NodeId> ids = ...;
+ * std::vector<double> values = ...;
+ * std::vector<DateTime> timestamps = ...;
+ * const auto batch = DataValueBatch::create<double>(ids, values, timestamps);
+ * services::write(client, batch.writeValues());
+ * @endcode
+ */
+class DataValueBatch {
+public:
+    /**
+     * Create batch from columns of equal size.
+     * Source timestamps and status codes are optional (empty span).
+     * @tparam T Pointer-free native type of the values, e.g. `double` or `int32_t`
+     * @exception BadStatus (BadInvalidArgument) If the column sizes do not match
+     */
+    template <typename T>
+    [[nodiscard]] static DataValueBatch create(
+        Span<const NodeId> ids,
+        Span<const T> values,
+        Span<const DateTime> sourceTimestamps = {},
+        Span<const StatusCode> statuses = {},
+        AttributeId attributeId = AttributeId::Value
+    );
+
+    /// Number of values.
+    size_t size() const noexcept {
+        return size_;
+    }
+
+    bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    /// Get write values.
+    Span<const WriteValue> writeValues() const noexcept {
+        return {asWrapper<WriteValue>(headers()), size_};
+    }
+
+    /// Get data value by index.
+    const DataValue& operator[](size_t index) const noexcept {
+        return asWrapper<DataValue>(headers()[index].value);  // NOLINT
+    }
+
+private:
+    DataValueBatch(std::unique_ptr<std::byte[]> storage, size_t size) noexcept  // NOLINT
+        : storage_(std::move(storage)),
+          size_(size) {}
+
+    const UA_WriteValue* headers() const noexcept {
+        return static_cast<const UA_WriteValue*>(static_cast<const void*>(storage_.get()));
+    }
+
+    // headers and payloads are not owned by the UA_WriteValue objects and must not be cleared
+    std::unique_ptr<std::byte[]> storage_;  // NOLINT
+    size_t size_;
+};
+
+template <typename T>
+DataValueBatch DataValueBatch::create(
+    Span<const NodeId> ids,
+    Span<const T> values,
+    Span<const DateTime> sourceTimestamps,
+    Span<const StatusCode> statuses,
+    AttributeId attributeId
+) {
+    static_assert(
+        detail::isRegisteredType<T> && detail::isPointerFree<T>,
+        "DataValueBatch requires pointer-free native value types"
+    );
+    const size_t size = ids.size();
+    if (values.size() != size || (!sourceTimestamps.empty() && sourceTimestamps.size() != size) ||
+        (!statuses.empty() && statuses.size() != size)) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+    }
+
+    // layout: [UA_WriteValue x size][padding][T x size]
+    const size_t headersSize = size * sizeof(UA_WriteValue);
+    const size_t payloadOffset = (headersSize + alignof(T) - 1) / alignof(T) * alignof(T);
+    auto storage = std::make_unique<std::byte[]>(payloadOffset + size * sizeof(T));  // NOLINT
+    auto* headers = static_cast<UA_WriteValue*>(static_cast<void*>(storage.get()));
+    auto* payloads = static_cast<T*>(static_cast<void*>(storage.get() + payloadOffset));  // NOLINT
+    if (size > 0) {
+        std::memcpy(payloads, values.data(), size * sizeof(T));
+    }
+
+    const auto& dataType = getDataType<T>();
+    for (size_t i = 0; i < size; ++i) {
+        UA_WriteValue& item = headers[i];  // NOLINT
+        item = {};
+        item.nodeId = *ids[i].handle();  // shallow copy, referenced
+        item.attributeId = static_cast<uint32_t>(attributeId);
+        item.value.hasValue = true;
+        item.value.value.type = &dataType;
+        item.value.value.storageType = UA_VARIANT_DATA_NODELETE;
+        item.value.value.data = &payloads[i];  // NOLINT
+        if (!sourceTimestamps.empty()) {
+            item.value.hasSourceTimestamp = true;
+            item.value.sourceTimestamp = sourceTimestamps[i].get();
+        }
+        if (!statuses.empty()) {
+            item.value.hasStatus = true;
+            item.value.status = statuses[i].get();
+        }
+    }
+    return {std::move(storage), size};
+}
+
+}  // namespace opcua
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <unordered_map>
+
+#include "open62541pp/Span.h"
+#include "open62541pp/types/Builtin.h"  // StatusCode
+#include "open62541pp/types/Composed.h"  // DeadbandType
+#include "open62541pp/types/NodeId.h"
+#include "open62541pp/types/Variant.h"
+
+namespace opcua {
+
+// forward declaration
+class Server;
+
+/**
+ * Server-local writer that drops redundant writes of numeric values at the source.
+ *
+ * Each configured node has a deadband, which is checked before the value is written to the node
+ * store (similar to a DataChangeFilter, but for all readers). The check is a direct numeric
+ * compare with the last written value, without a deep Variant comparison:
+ * - `DeadbandType::None`: writes of an equal value are dropped
+ * - `DeadbandType::Absolute`: writes are dropped if `|value - last| <= deadband`
+ * - `DeadbandType::Percent`: writes are dropped if `|value - last| <= deadband / 100 * range`,
+ *   with the range `high - low` of the node's `EURange` property
+ *
+ * Only numeric scalars are filtered, other values and writes to nodes without a deadband are
+ * always written. The last value is only updated by written values, so slow drifts are not lost.
+ * @code
+ * DeadbandWriter writer(server);
+ * writer.setDeadband(id, DeadbandType::Absolute, 0.5);
+ * writer.writeValue(id, Variant::fromScalar(20.1));  // written
+ * writer.writeValue(id, Variant::fromScalar(20.3));  // dropped
+ * @endcode
+ */
+class DeadbandWriter {
+public:
+    explicit DeadbandWriter(Server& server)
+        : server_(server) {}
+
+    /**
+     * Set the deadband of a node.
+     * @param id Variable node
+     * @param type Deadband type
+     * @param deadband Absolute value or percentage of the range
+     * @param range Range (`high - low`) for percent deadbands, read from the node's `EURange`
+     *              property if not specified
+     * @exception BadStatus (BadDeadbandFilterInvalid) If the range of a percent deadband is not
+     *            specified and the node has no `EURange` property
+     */
+    void setDeadband(
+        const NodeId& id,
+        DeadbandType type,
+        double deadband = 0.0,
+        std::optional<double> range = std::nullopt
+    );
+
+    /// Remove the deadband of a node, all following writes are passed through.
+    void removeDeadband(const NodeId& id) noexcept;
+
+    /**
+     * Write the value of a node, unless it is within the deadband of the last written value.
+     * @return True if the value was written, false if it was dropped
+     * @exception BadStatus If the write failed
+     */
+    bool writeValue(const NodeId& id, const Variant& value);
+
+    /**
+     * Write the values of many nodes, values within the deadbands are dropped.
+     * Failed writes do not abort the batch (see services::writeValues).
+     * @return Number of written values
+     * @exception BadStatus (BadInvalidArgument) If the sizes of `ids` and `values` differ
+     */
+    size_t writeValues(Span<const NodeId> ids, Span<const Variant> values);
+
+    /// Number of dropped writes.
+    size_t getDroppedCount() const noexcept {
+        return dropped_;
+    }
+
+private:
+    struct Filter {
+        DeadbandType type;
+        double threshold;
+        std::optional<double> last;
+    };
+
+    /// Check a value against the deadband, returns `false` if the write should be dropped.
+    /// The filter and the numeric value are returned to update the last value after the write.
+    bool accept(const NodeId& id, const Variant& value, Filter*& filter, double& number);
+    StatusCode write(const NodeId& id, const Variant& value);
+
+    Server& server_;
+    std::unordered_map<NodeId, Filter> filters_;
+    size_t dropped_{0};
+};
+
+}  // namespace opcua
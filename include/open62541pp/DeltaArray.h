@@ -0,0 +1,170 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>  // forward, move
+
+#include "open62541pp/Config.h"
+#include "open62541pp/DataType.h"
+#include "open62541pp/Subscription.h"  // DataChangeCallback
+#include "open62541pp/TypeWrapper.h"  // asWrapper
+#include "open62541pp/open62541.h"
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/NodeId.h"
+#include "open62541pp/types/Variant.h"
+
+namespace opcua {
+
+// forward declaration
+template <typename T>
+class MonitoredItem;
+
+/**
+ * Native layout of the companion structure to transport arrays as keyframes and deltas.
+ *
+ * Keyframes contain the full array in `values`. Delta frames contain the changed index ranges as
+ * pairs of first index and count in `ranges` and the values of all ranges concatenated in
+ * `values`. The structure type is created with createDeltaArrayFrameDataType and must be
+ * registered as custom data type on the server and the client (setCustomDataTypes).
+ */
+struct DeltaArrayFrame {
+    uint32_t sequenceNumber;  ///< Incremented per frame, gaps invalidate the reconstruction
+    bool keyframe;
+    uint32_t arrayLength;  ///< Length of the full array
+    size_t rangesSize;
+    uint32_t* ranges;
+    UA_Variant values;
+};
+
+/**
+ * Create the data type of DeltaArrayFrame.
+ * @param typeId NodeId of the type
+ * @param binaryEncodingId NodeId of data type when encoded as binary
+ */
+DataType createDeltaArrayFrameDataType(NodeId typeId, NodeId binaryEncodingId);
+
+/**
+ * Options of DeltaArrayEncoder.
+ */
+struct DeltaArrayOptions {
+    /// Maximum number of delta frames between two keyframes.
+    uint32_t keyframeInterval = 50;
+    /// Send a keyframe instead of a delta if more than this ratio of the elements changed.
+    double maxDeltaRatio = 0.5;
+    /// Merge changed ranges separated by at most this number of unchanged elements.
+    uint32_t mergeGap = 4;
+};
+
+/**
+ * Server-side encoder of arrays to keyframes and deltas.
+ *
+ * Large arrays (e.g. spectra) that change slowly are written to a variable as DeltaArrayFrame
+ * instead of the full array. Each frame is compared element-wise with the previous array, only
+ * the changed index ranges are transported. Keyframes with the full array are sent periodically,
+ * on changes of the array length or data type and if a delta would not be smaller.
+ * Only arrays of pointer-free types (numeric types) are supported.
+ *
+ * The variable must have the data type `BaseDataType` or the frame type. Monitored items of the
+ * variable should not drop frames (sampling interval and queue size); clients wait for the next
+ * keyframe after a missing frame.
+ * @code
+ * server.setCustomDataTypes({frameType});
+ * DeltaArrayEncoder encoder(*server.findDataType(frameType.getTypeId()));
+ * services::writeValue(server, id, encoder.encode(Variant::fromArray(spectrum)));
+ * @endcode
+ */
+class DeltaArrayEncoder {
+public:
+    /// @param frameType Data type of DeltaArrayFrame, must outlive the encoder and the frames
+    explicit DeltaArrayEncoder(const UA_DataType& frameType, DeltaArrayOptions options = {})
+        : frameType_(&frameType),
+          options_(options) {}
+
+    /**
+     * Encode the next frame of an array.
+     * @return Variant with a DeltaArrayFrame scalar
+     * @exception BadStatus (BadTypeMismatch) If the value is not an array of a pointer-free type
+     */
+    Variant encode(const Variant& array);
+
+    /// Send the next frame as keyframe, e.g. when a new client subscribes.
+    void forceKeyframe() noexcept {
+        forceKeyframe_ = true;
+    }
+
+    const DeltaArrayOptions& getOptions() const noexcept {
+        return options_;
+    }
+
+private:
+    const UA_DataType* frameType_;
+    DeltaArrayOptions options_;
+    Variant last_;
+    uint32_t sequenceNumber_{0};
+    uint32_t framesSinceKeyframe_{0};
+    bool forceKeyframe_{true};
+};
+
+/**
+ * Client-side decoder to reconstruct arrays from keyframes and deltas of DeltaArrayEncoder.
+ */
+class DeltaArrayDecoder {
+public:
+    /// @param frameTypeId NodeId of the frame type (DataType::getTypeId)
+    explicit DeltaArrayDecoder(NodeId frameTypeId)
+        : frameTypeId_(std::move(frameTypeId)) {}
+
+    /**
+     * Apply a frame to the reconstructed array.
+     * Delta frames are ignored until the first keyframe and after missing frames.
+     * @return `true` if the reconstructed array is valid
+     * @exception BadStatus (BadTypeMismatch) If the value is not a DeltaArrayFrame scalar or the
+     *                                          values of a keyframe are not of a pointer-free type
+     */
+    bool decode(const Variant& frame);
+
+    /// Get the reconstructed array, valid if the last decode returned `true`.
+    const Variant& getArray() const noexcept {
+        return array_;
+    }
+
+    /// Discard the reconstructed array and wait for the next keyframe.
+    void reset() noexcept {
+        valid_ = false;
+    }
+
+private:
+    NodeId frameTypeId_;
+    Variant array_;
+    uint32_t nextSequenceNumber_{0};
+    bool valid_{false};
+};
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+/**
+ * Create a data change notification callback that reconstructs arrays from DeltaArrayFrame values
+ * and invokes `func(item, const DataValue& value)` with the full array.
+ * Notifications are dropped until the array is valid (first keyframe).
+ * @param frameTypeId NodeId of the frame type, registered as custom data type of the client
+ * @tparam T Server or Client
+ */
+template <typename T, typename Func>
+DataChangeCallback<T> withDeltaDecoding(NodeId frameTypeId, Func&& func) {
+    auto decoder = std::make_shared<DeltaArrayDecoder>(std::move(frameTypeId));
+    return [decoder = std::move(decoder), func = std::forward<Func>(func)](
+               const MonitoredItem<T>& item, const DataValue& dv
+           ) {
+        if (!decoder->decode(dv.getValue())) {
+            return;
+        }
+        // shallow copy with the reconstructed array, owned by the decoder
+        UA_DataValue native = *dv.handle();
+        native.value = *decoder->getArray().handle();
+        native.value.storageType = UA_VARIANT_DATA_NODELETE;
+        func(item, *asWrapper<DataValue>(&native));
+    };
+}
+#endif
+
+}  // namespace opcua
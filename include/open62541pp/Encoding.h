@@ -0,0 +1,207 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "open62541pp/Span.h"
+#include "open62541pp/open62541.h"
+#include "open62541pp/typeregistry/Builtin.h"
+#include "open62541pp/types/Builtin.h"
+
+namespace opcua {
+
+/* ----------------------------------------- Internals ------------------------------------------ */
+
+namespace detail {
+
+ByteString encodeBinary(const void* src, const UA_DataType& type);
+Span<uint8_t> encodeBinary(const void* src, const UA_DataType& type, Span<uint8_t> buffer);
+size_t decodeBinary(Span<const uint8_t> data, void* dst, const UA_DataType& type);
+size_t calcSizeBinary(const void* src, const UA_DataType& type);
+
+}  // namespace detail
+
+/* -------------------------------------- Binary encoding --------------------------------------- */
+
+/**
+ * @defgroup Encoding Binary encoding
+ * Encode and decode types in the OPC UA binary format, independent of a server or client.
+ * Native types, TypeWrapper types and custom types (e.g. built with DataTypeBuilder) are supported.
+ * @note Only supported since open62541 v1.3
+ * @{
+ */
+
+/// Encode object in binary format.
+/// @exception BadStatus If the encoding fails
+template <typename T>
+[[nodiscard]] ByteString encodeBinary(const T& value, const UA_DataType& dataType) {
+    return detail::encodeBinary(&value, dataType);
+}
+
+/// @copydoc encodeBinary(const T&, const UA_DataType&)
+template <typename T>
+[[nodiscard]] ByteString encodeBinary(const T& value) {
+    return encodeBinary(value, getDataType<T>());
+}
+
+/// Encode object in binary format into a caller-provided buffer.
+/// @return The used part of the buffer
+/// @exception BadStatus If the encoding fails or the buffer is too small
+template <typename T>
+Span<uint8_t> encodeBinary(const T& value, const UA_DataType& dataType, Span<uint8_t> buffer) {
+    return detail::encodeBinary(&value, dataType, buffer);
+}
+
+/// @copydoc encodeBinary(const T&, const UA_DataType&, Span<uint8_t>)
+template <typename T>
+Span<uint8_t> encodeBinary(const T& value, Span<uint8_t> buffer) {
+    return encodeBinary(value, getDataType<T>(), buffer);
+}
+
+/// Decode object from binary format.
+/// @exception BadStatus If the decoding fails
+template <typename T>
+[[nodiscard]] T decodeBinary(Span<const uint8_t> data, const UA_DataType& dataType) {
+    T result{};
+    detail::decodeBinary(data, &result, dataType);
+    return result;
+}
+
+/// @copydoc decodeBinary(Span<const uint8_t>, const UA_DataType&)
+template <typename T>
+[[nodiscard]] T decodeBinary(Span<const uint8_t> data) {
+    return decodeBinary<T>(data, getDataType<T>());
+}
+
+/// Calculate the size of the object in binary format.
+/// @exception BadStatus If not supported by the open62541 version
+template <typename T>
+[[nodiscard]] size_t calcSizeBinary(const T& value, const UA_DataType& dataType) {
+    return detail::calcSizeBinary(&value, dataType);
+}
+
+/// @copydoc calcSizeBinary(const T&, const UA_DataType&)
+template <typename T>
+[[nodiscard]] size_t calcSizeBinary(const T& value) {
+    return calcSizeBinary(value, getDataType<T>());
+}
+
+/**
+ * Encoder to append many objects in binary format to a single, reusable buffer.
+ *
+ * The buffer grows geometrically and is kept by clear(). After warm-up, no further allocations
+ * are required to encode batches of similar size.
+ * @code
+ * BatchEncoder encoder;
+ * for (const auto& dv : values) {
+ *     encoder.append(dv);
+ * }
+ * send(encoder.data());
+ * encoder.clear();
+ * @endcode
+ */
+class BatchEncoder {
+public:
+    /// Create encoder with an initial buffer capacity in bytes.
+    explicit BatchEncoder(size_t capacity = 0);
+
+    /// Append object in binary format.
+    /// @exception BadStatus If the encoding fails
+    template <typename T>
+    void append(const T& value, const UA_DataType& dataType) {
+        appendImpl(&value, dataType);
+    }
+
+    /// @copydoc append(const T&, const UA_DataType&)
+    template <typename T>
+    void append(const T& value) {
+        append(value, getDataType<T>());
+    }
+
+    /// Get the encoded data.
+    Span<const uint8_t> data() const noexcept {
+        return {buffer_->data, size_};
+    }
+
+    /// Number of encoded bytes.
+    size_t size() const noexcept {
+        return size_;
+    }
+
+    /// Capacity of the buffer in bytes.
+    size_t capacity() const noexcept {
+        return buffer_->length;
+    }
+
+    /// Reserve buffer capacity in bytes.
+    void reserve(size_t capacity);
+
+    /// Discard the encoded data, the buffer is kept for reuse.
+    void clear() noexcept {
+        size_ = 0;
+    }
+
+private:
+    void appendImpl(const void* src, const UA_DataType& type);
+
+    ByteString buffer_;
+    size_t size_{0};
+};
+
+/**
+ * Incremental decoder for a stream of binary encoded objects received in chunks.
+ *
+ * Chunks are buffered with append() until a complete object can be decoded with next().
+ * Consumed bytes are discarded.
+ * @code
+ * BinaryDecoder decoder;
+ * decoder.append(chunk);
+ * while (auto value = decoder.next<DataValue>()) {
+ *     // ...
+ * }
+ * @endcode
+ */
+class BinaryDecoder {
+public:
+    /// Append chunk of encoded data.
+    void append(Span<const uint8_t> chunk);
+
+    /// Decode the next object.
+    /// @return The decoded object or `std::nullopt` if the buffered data is incomplete
+    template <typename T>
+    std::optional<T> next(const UA_DataType& dataType);
+
+    /// @copydoc next(const UA_DataType&)
+    template <typename T>
+    std::optional<T> next() {
+        return next<T>(getDataType<T>());
+    }
+
+    /// Number of buffered bytes not decoded yet.
+    size_t available() const noexcept {
+        return buffer_.size() - offset_;
+    }
+
+private:
+    bool decodeNext(void* dst, const UA_DataType& dataType) noexcept;
+
+    std::vector<uint8_t> buffer_;
+    size_t offset_{0};
+};
+
+template <typename T>
+std::optional<T> BinaryDecoder::next(const UA_DataType& dataType) {
+    T result{};
+    if (!decodeNext(&result, dataType)) {
+        return std::nullopt;
+    }
+    return result;
+}
+
+/**
+ * @}
+ */
+
+}  // namespace opcua
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "open62541pp/Span.h"
+#include "open62541pp/types/Builtin.h"  // StatusCode
+#include "open62541pp/types/Composed.h"  // EndpointDescription
+
+namespace opcua {
+
+/**
+ * Options of EndpointDiscovery.
+ */
+struct EndpointDiscoveryOptions {
+    /// Maximum number of concurrent probes (worker threads).
+    size_t maxConcurrentProbes = 32;
+    /// Timeout of a single probe (connect and GetEndpoints request).
+    std::chrono::milliseconds probeTimeout{2000};
+    /// Time to live of cached endpoint lists (0: no caching).
+    std::chrono::milliseconds cacheTtl{std::chrono::minutes(5)};
+};
+
+/**
+ * Result of a single endpoint probe.
+ */
+struct EndpointDiscoveryResult {
+    /// Probed endpoint URL.
+    std::string endpointUrl;
+    /// Status of the probe, e.g. `BadTimeout` or `BadConnectionRejected` if the server is down.
+    StatusCode status;
+    /// Endpoints of the server, empty if the probe failed.
+    std::vector<EndpointDescription> endpoints;
+    /// True if the result was served from the cache without probing the server.
+    bool cached = false;
+};
+
+/**
+ * Probe the endpoints (GetEndpoints service) of many servers concurrently.
+ *
+ * Each probe uses its own short-lived client, up to `maxConcurrentProbes` probes run in parallel
+ * on worker threads. Results are delivered on the calling thread as they arrive. Successful
+ * results are cached for `cacheTtl`, cached URLs are not probed again until the entry expires.
+ * Failed probes are not cached.
+ * @code
+ * EndpointDiscovery discovery({64, std::chrono::milliseconds(500)});
+ * discovery.scan(urls, [](EndpointDiscoveryResult& result) {
+ *     if (result.status.isGood()) {
+ *         // ...
+ *     }
+ * });
+ * @endcode
+ */
+class EndpointDiscovery {
+public:
+    using Callback = std::function<void(EndpointDiscoveryResult& result)>;
+
+    explicit EndpointDiscovery(EndpointDiscoveryOptions options = {});
+
+    /**
+     * Probe the endpoint URLs and invoke the callback for each result as it arrives.
+     * Blocks until all URLs are probed. Duplicate URLs are probed once.
+     * Cached results are delivered first, probes follow in the order of completion.
+     * @param endpointUrls Discovery URLs of the servers
+     * @param callback Callback invoked on the calling thread for each URL
+     */
+    void scan(Span<const std::string> endpointUrls, const Callback& callback);
+
+    /**
+     * Probe the endpoint URLs and collect all results.
+     * @copydetails scan
+     * @return Results in the order of completion
+     */
+    std::vector<EndpointDiscoveryResult> scan(Span<const std::string> endpointUrls);
+
+    /// Get the cached (not expired) endpoint list of the URL.
+    std::optional<std::vector<EndpointDescription>> getCached(const std::string& endpointUrl
+    ) const;
+
+    /// Clear the cached endpoint lists.
+    void clearCache() noexcept {
+        cache_.clear();
+    }
+
+    const EndpointDiscoveryOptions& getOptions() const noexcept {
+        return options_;
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct CacheEntry {
+        std::vector<EndpointDescription> endpoints;
+        Clock::time_point expiry;
+    };
+
+    EndpointDiscoveryOptions options_;
+    std::unordered_map<std::string, CacheEntry> cache_;
+};
+
+}  // namespace opcua
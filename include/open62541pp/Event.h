@@ -1,9 +1,13 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <string_view>
+#include <utility>  // pair
+#include <vector>
 
 #include "open62541pp/NodeIds.h"
+#include "open62541pp/Span.h"
 #include "open62541pp/types/Builtin.h"
 #include "open62541pp/types/NodeId.h"
 
@@ -55,16 +59,51 @@ public:
     Event& writeMessage(const LocalizedText& message);
 
     /// Set arbitrary properties of the event (for custom event types).
+    /// The property node is resolved once, subsequent writes update the value in place.
     Event& writeProperty(const QualifiedName& propertyName, const Variant& value);
 
+    /// Set a nested property of the event, e.g. `{{0, "ActiveState"}, {0, "Id"}}`.
+    /// The property node is resolved once, subsequent writes update the value in place.
+    Event& writeNestedProperty(Span<const QualifiedName> propertyPath, const Variant& value);
+
     /// Trigger the event.
+    /// The node representation is kept and can be reused for further events.
     /// @param originId Origin node of the event (requires `EventNotifier` attribute)
     /// @return Unique `EventId` generated by server
     ByteString trigger(const NodeId& originId = ObjectId::Server);
 
+    /**
+     * Trigger many events in one pass with the same node representation.
+     * Before each trigger, `update(event, index)` is invoked to write the fields of the event.
+     * @code
+     * event.triggerMany(alarms.size(), [&](Event& e, size_t i) {
+     *     e.writeSeverity(alarms[i].severity).writeMessage(alarms[i].message);
+     * });
+     * @endcode
+     * @param count Number of events
+     * @param update Callback to write the fields of the i-th event
+     * @param originId Origin node of the events (requires `EventNotifier` attribute)
+     * @return Unique `EventId` generated by server for each event
+     */
+    template <typename Func>
+    std::vector<ByteString> triggerMany(
+        size_t count, Func&& update, const NodeId& originId = ObjectId::Server
+    ) {
+        std::vector<ByteString> eventIds;
+        eventIds.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            update(*this, i);
+            eventIds.push_back(trigger(originId));
+        }
+        return eventIds;
+    }
+
 private:
+    const NodeId& getPropertyId(Span<const QualifiedName> propertyPath);
+
     Server& connection_;
     NodeId id_;
+    std::vector<std::pair<std::vector<QualifiedName>, NodeId>> propertyIds_;  // resolved nodes
 };
 
 bool operator==(const Event& lhs, const Event& rhs) noexcept;
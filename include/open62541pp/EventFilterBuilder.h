@@ -0,0 +1,223 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>  // less
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>  // forward, move
+#include <vector>
+
+#include "open62541pp/Common.h"  // AttributeId
+#include "open62541pp/Config.h"
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/Subscription.h"  // EventCallback
+#include "open62541pp/TypeConverter.h"
+#include "open62541pp/typeregistry/Builtin.h"
+#include "open62541pp/types/Composed.h"
+#include "open62541pp/types/NodeId.h"
+#include "open62541pp/types/Variant.h"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+namespace opcua {
+
+// forward declarations
+template <typename T>
+class MonitoredItem;
+
+/**
+ * Typed handle of a selected event field.
+ * The handle stores the pre-resolved index of the select clause, returned by
+ * EventFilterBuilder::select.
+ * @tparam T Type of the field value
+ */
+template <typename T>
+struct EventField {
+    size_t index;
+};
+
+/**
+ * Map of event field names to the indices of their select clauses.
+ */
+class EventFieldMap {
+public:
+    /// Get the select clause index of a field.
+    std::optional<size_t> find(std::string_view name) const;
+
+    /// Get the field names in the order of the select clauses.
+    Span<const std::string> getNames() const noexcept {
+        return names_;
+    }
+
+    /// Number of fields.
+    size_t size() const noexcept {
+        return names_.size();
+    }
+
+private:
+    friend class EventFilterBuilder;
+
+    std::vector<std::string> names_;
+    std::map<std::string, size_t, std::less<>> indices_;  // heterogeneous lookup by string_view
+};
+
+/**
+ * View of the fields of an event notification with named and typed access.
+ *
+ * Access by EventField handles is a plain index lookup; access by name requires a map lookup and
+ * should be avoided in hot paths. Missing fields (e.g. if the server returns less fields than
+ * selected) are returned as empty variants.
+ * The view references the field map and the event fields, it must not outlive them.
+ */
+class EventView {
+public:
+    EventView(const EventFieldMap& fields, Span<const Variant> eventFields) noexcept
+        : fields_(&fields),
+          eventFields_(eventFields) {}
+
+    /// Get all event fields in the order of the select clauses.
+    Span<const Variant> getEventFields() const noexcept {
+        return eventFields_;
+    }
+
+    /// Number of event fields.
+    size_t size() const noexcept {
+        return eventFields_.size();
+    }
+
+    /// Get field by select clause index.
+    const Variant& operator[](size_t index) const noexcept;
+
+    /// Get field by handle.
+    template <typename T>
+    const Variant& operator[](EventField<T> field) const noexcept {
+        return (*this)[field.index];
+    }
+
+    /// Get field by name.
+    const Variant& operator[](std::string_view name) const;
+
+    /// Get scalar field value by handle.
+    /// @return Value or `std::nullopt` if the field is missing, not a scalar or not of type `T`
+    template <typename T>
+    std::optional<T> get(EventField<T> field) const {
+        return toOptional<T>((*this)[field.index]);
+    }
+
+    /// Get scalar field value by name.
+    /// @copydetails get(EventField<T>) const
+    template <typename T>
+    std::optional<T> get(std::string_view name) const {
+        return toOptional<T>((*this)[name]);
+    }
+
+private:
+    template <typename T>
+    static std::optional<T> toOptional(const Variant& var) {
+        if constexpr (std::is_same_v<T, Variant>) {
+            if (var.isEmpty()) {
+                return std::nullopt;
+            }
+            return var;
+        } else if constexpr (detail::isRegisteredType<T>) {
+            if (var.isScalar() && var.isType<T>()) {
+                return var.getScalar<T>();
+            }
+            return std::nullopt;
+        } else {
+            if (var.isScalar() && var.isType<typename TypeConverter<T>::NativeType>()) {
+                return var.getScalarCopy<T>();
+            }
+            return std::nullopt;
+        }
+    }
+
+    const EventFieldMap* fields_;
+    Span<const Variant> eventFields_;
+};
+
+/**
+ * Builder of event filters with named select clauses.
+ *
+ * The indices of the select clauses are resolved once when the fields are selected. The returned
+ * EventField handles and the EventFieldMap give direct access to the fields of event notifications
+ * without comparing the field names per event.
+ * @code
+ * EventFilterBuilder builder;
+ * const auto severity = builder.select<uint16_t>("Severity");
+ * const auto message = builder.select<LocalizedText>("Message");
+ * sub.subscribeEvent(
+ *     ObjectId::Server,
+ *     builder.build(),
+ *     withEventView<Client>(builder.getFieldMap(), [=](const auto& item, const EventView& event) {
+ *         const auto value = event.get(severity).value_or(0);
+ *     })
+ * );
+ * @endcode
+ */
+class EventFilterBuilder {
+public:
+    /**
+     * Select a field by its browse path relative to the event type.
+     * @param name Field name, a `/`-separated browse path of namespace zero browse names,
+     *             e.g. `Severity` or `EnabledState/Id`
+     * @param typeDefinitionId Event type of the field
+     * @exception BadStatus (BadInvalidArgument) If the name is empty or already selected
+     */
+    template <typename T = Variant>
+    EventField<T> select(
+        std::string_view name, const NodeId& typeDefinitionId = ObjectTypeId::BaseEventType
+    ) {
+        return {add(name, typeDefinitionId)};
+    }
+
+    /**
+     * Select a field by a custom select clause.
+     * @param name Unique field name
+     * @param selectClause Select clause of the field, e.g. with a browse path of another namespace
+     * @exception BadStatus (BadInvalidArgument) If the name is empty or already selected
+     */
+    template <typename T = Variant>
+    EventField<T> select(std::string_view name, SimpleAttributeOperand selectClause) {
+        return {add(name, std::move(selectClause))};
+    }
+
+    /// Set the where clause of the filter.
+    EventFilterBuilder& where(ContentFilter whereClause);
+
+    /// Create the event filter.
+    EventFilter build() const;
+
+    /// Get the map of the selected fields.
+    const EventFieldMap& getFieldMap() const noexcept {
+        return fields_;
+    }
+
+private:
+    size_t add(std::string_view name, const NodeId& typeDefinitionId);
+    size_t add(std::string_view name, SimpleAttributeOperand selectClause);
+
+    std::vector<SimpleAttributeOperand> selectClauses_;
+    ContentFilter whereClause_;
+    EventFieldMap fields_;
+};
+
+/**
+ * Create an event notification callback that invokes `func(item, const EventView& event)`.
+ * The field map is copied into the callback.
+ * @tparam T Server or Client
+ */
+template <typename T, typename Func>
+EventCallback<T> withEventView(EventFieldMap fields, Func&& func) {
+    return [fields = std::move(fields), func = std::forward<Func>(func)](
+               const MonitoredItem<T>& item, Span<const Variant> eventFields
+           ) { func(item, EventView(fields, eventFields)); };
+}
+
+}  // namespace opcua
+
+#endif
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "open62541pp/Config.h"
+#include "open62541pp/Event.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/types/Composed.h"  // EventFilter, FilterOperator
+#include "open62541pp/types/NodeId.h"
+#include "open62541pp/types/Variant.h"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+
+namespace opcua {
+
+// forward declaration
+class Server;
+
+/**
+ * Compiled event filters of many subscribers, evaluated once per distinct filter.
+ *
+ * Servers that fan out events to many subscribers (e.g. clients filtering alarms by severity and
+ * source) would otherwise interpret the same where clause for every subscriber and every event.
+ * The set deduplicates identical filters (by their binary encoding) and compiles each distinct
+ * where clause into a compact postfix program. The operands and select clauses of all filters are
+ * merged into distinct fields, that are read once per event. The browse paths of the fields are
+ * resolved once per event node and reused for subsequent triggers (Event objects keep their node,
+ * see Event::triggerMany).
+ *
+ * Supported operands are SimpleAttributeOperand, LiteralOperand and ElementOperand. Comparisons
+ * follow the semantics of the local Query service (services::queryFirst), e.g. NULL operands
+ * evaluate to NULL and NULL results do not match.
+ *
+ * The filters of the monitored items created by open62541 are evaluated inside the stack, the set
+ * is meant for application-side fan-out. The set is not synchronized.
+ * @code
+ * EventFilterSet filters(server);
+ * const auto filterId = filters.add(filter);  // identical filters share the same id
+ * subscribers[filterId].push_back(session);
+ * filters.evaluate(event, [&](size_t filterId, Span<const Variant> eventFields) {
+ *     for (auto& session : subscribers[filterId]) {
+ *         session.notify(eventFields);
+ *     }
+ * });
+ * @endcode
+ */
+class EventFilterSet {
+public:
+    /// Callback of matching filters with the values of their select clauses.
+    using MatchCallback = std::function<void(size_t filterId, Span<const Variant> eventFields)>;
+
+    explicit EventFilterSet(Server& server);
+
+    EventFilterSet(const EventFilterSet&) = delete;
+    EventFilterSet(EventFilterSet&&) noexcept = delete;
+    EventFilterSet& operator=(const EventFilterSet&) = delete;
+    EventFilterSet& operator=(EventFilterSet&&) noexcept = delete;
+
+    /**
+     * Compile and add a filter.
+     * Identical filters are added only once and reference counted.
+     * @return Identifier of the distinct filter
+     * @exception BadStatus (BadEventFilterInvalid) If the filter has no select clauses
+     * @exception BadStatus (BadFilterOperatorUnsupported, BadFilterOperandCountMismatch,
+     *            BadFilterOperandInvalid) If the where clause is invalid
+     */
+    size_t add(const EventFilter& filter);
+
+    /// Release a filter added with add, the filter is removed with its last reference.
+    /// @exception BadStatus (BadInvalidArgument) If the identifier is unknown
+    void remove(size_t filterId);
+
+    /// Number of distinct filters.
+    size_t size() const noexcept {
+        return size_;
+    }
+
+    /// Number of distinct fields (select clauses and where clause operands) read per event.
+    size_t getFieldCount() const noexcept;
+
+    /**
+     * Evaluate all filters for a triggered event.
+     * @param eventId Node of the event, e.g. Event::getNodeId
+     * @param onMatch Invoked for each matching filter
+     * @return Number of matching filters
+     */
+    size_t evaluate(const NodeId& eventId, const MatchCallback& onMatch);
+
+    /// @copydoc evaluate(const NodeId&, const MatchCallback&)
+    size_t evaluate(const Event& event, const MatchCallback& onMatch) {
+        return evaluate(event.getNodeId(), onMatch);
+    }
+
+private:
+    struct Instruction {
+        enum class Kind : uint8_t { Field, Literal, Operator };
+
+        Kind kind;
+        FilterOperator filterOperator;  // of Kind::Operator
+        uint32_t arg;  // field index, literal index or operand count
+    };
+
+    struct Filter {
+        std::string key;  // binary encoding
+        size_t refCount = 0;
+        std::vector<uint32_t> select;  // field indices of the select clauses
+        std::vector<Instruction> program;  // where clause in postfix notation, empty matches all
+        std::vector<Variant> literals;
+    };
+
+    struct Field {
+        SimpleAttributeOperand operand;
+        size_t refCount = 0;
+    };
+
+    struct EventNode {
+        NodeId typeDefinition;
+        std::vector<std::optional<NodeId>> targets;  // resolved fields
+    };
+
+    uint32_t addField(const SimpleAttributeOperand& operand);
+    void compile(Filter& filter, Span<const ContentFilterElement> elements, size_t index);
+    EventNode& resolve(const NodeId& eventId);
+    bool matches(const Filter& filter, const NodeId& typeDefinition);
+    std::optional<bool> apply(
+        FilterOperator filterOperator,
+        Span<const Variant* const> operands,
+        const NodeId& typeDefinition
+    ) const;
+
+    Server& server_;
+    std::vector<Filter> filters_;  // indexed by filter id, free slots have no references
+    std::unordered_map<std::string, size_t> filterIds_;
+    size_t size_{0};
+    std::vector<Field> fields_;
+    std::unordered_map<std::string, uint32_t> fieldIds_;
+    std::unordered_map<NodeId, EventNode> eventNodes_;
+    std::vector<Variant> values_;  // field values of the current event
+    std::vector<const Variant*> stack_;
+    std::vector<Variant> selected_;
+};
+
+}  // namespace opcua
+
+#endif
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "open62541pp/Config.h"
+#include "open62541pp/open62541.h"
+#include "open62541pp/types/Builtin.h"  // StatusCode
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/DateTime.h"
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua {
+
+// forward declaration
+class Server;
+
+/**
+ * Options of a history ring buffer.
+ */
+struct HistoryOptions {
+    /// Maximum number of samples, the oldest samples are overwritten.
+    size_t capacity{10000};
+    /// Memory-mapped file of the buffer, the samples survive restarts (empty: in-memory buffer).
+    /// An existing file is reopened if its capacity matches.
+    std::string path;
+    /// Maximum number of values per HistoryRead response, more values are returned with
+    /// continuation points.
+    size_t maxResponseSize{1000};
+};
+
+/**
+ * Ring buffer of historical samples of a variable node, ordered by timestamp.
+ *
+ * Samples are stored in a columnar layout with fixed-size columns for the timestamps, status codes
+ * and values. Time ranges are found by binary search over the timestamp column. Only scalar values
+ * of fixed-size builtin types (e.g. Boolean, integers, Float, Double, DateTime) are supported, the
+ * value type is fixed by the first sample. Bad samples are stored without value.
+ *
+ * The buffer either lives in memory or in a memory-mapped file (POSIX only), which keeps the
+ * samples across restarts.
+ */
+class HistoryRingBuffer {
+public:
+    /// Create an in-memory buffer or open/create a memory-mapped file.
+    /// @exception BadStatus (BadInvalidArgument) If the capacity is 0
+    /// @exception BadStatus (BadInvalidState) If an existing file has another capacity
+    /// @exception BadStatus (BadNotSupported) If memory-mapped files are not supported
+    /// @exception BadStatus (BadResourceUnavailable) If the file can not be mapped
+    explicit HistoryRingBuffer(size_t capacity, const std::string& path = {});
+    ~HistoryRingBuffer();
+
+    HistoryRingBuffer(const HistoryRingBuffer&) = delete;
+    HistoryRingBuffer(HistoryRingBuffer&&) noexcept = delete;
+    HistoryRingBuffer& operator=(const HistoryRingBuffer&) = delete;
+    HistoryRingBuffer& operator=(HistoryRingBuffer&&) noexcept = delete;
+
+    /**
+     * Insert a sample, samples are kept in timestamp order.
+     * The source timestamp is used, or the server timestamp (or the current time) if no source
+     * timestamp is set.
+     * Appending samples in timestamp order is O(1), older samples are inserted in O(n).
+     * @param replace Replace a sample with the same timestamp
+     * @return `BadTypeMismatch` for unsupported values, `BadEntryExists` if a sample with the same
+     *         timestamp exists and `replace` is `false`
+     */
+    StatusCode insert(const DataValue& value, bool replace = false);
+
+    /// Replace the sample with the same timestamp.
+    /// @return `BadNoEntryExists` if no sample with the timestamp exists
+    StatusCode replace(const DataValue& value);
+
+    /// Remove all samples within the time range `[start, end)`.
+    /// @return Number of removed samples
+    size_t remove(DateTime start, DateTime end) noexcept;
+
+    /// Remove all samples.
+    void clear() noexcept;
+
+    /// Number of samples.
+    size_t size() const noexcept;
+
+    size_t capacity() const noexcept;
+
+    /// Timestamp of the sample at `index` (oldest first).
+    DateTime getTimestamp(size_t index) const noexcept;
+
+    /// Sample at `index` (oldest first) with value, status and source timestamp.
+    DataValue getDataValue(size_t index) const;
+
+    /// Set a native DataValue to the sample at `index`, without allocation for the value.
+    /// @param dv Previously cleared or uninitialized DataValue
+    void getDataValue(size_t index, UA_DataValue& dv) const noexcept;
+
+    /// Index of the first sample with a timestamp `>= timestamp` (or size()).
+    size_t lowerBound(DateTime timestamp) const noexcept;
+
+    /// Index of the first sample with a timestamp `> timestamp` (or size()).
+    size_t upperBound(DateTime timestamp) const noexcept;
+
+    /// Value type of the samples, `nullptr` if no sample was stored yet.
+    const UA_DataType* getDataType() const noexcept;
+
+    /// Flush a memory-mapped file to disk.
+    void flush() noexcept;
+
+private:
+    struct Header;
+
+    size_t physical(size_t index) const noexcept;
+    void write(
+        size_t index, int64_t timestamp, StatusCode status, const UA_Variant& value
+    ) noexcept;
+    void move(size_t from, size_t to) noexcept;
+
+    std::unique_ptr<uint8_t[]> memory_;  // NOLINT, in-memory buffer
+    void* mapping_{nullptr};  // memory-mapped file
+    size_t mappingSize_{0};
+    Header* header_{nullptr};
+    int64_t* timestamps_{nullptr};
+    uint32_t* status_{nullptr};
+    uint64_t* values_{nullptr};
+};
+
+/**
+ * History backend for variable nodes, storing samples in per-node ring buffers.
+ *
+ * Registered nodes are historized by the server: each value written to the node is stored in the
+ * node's HistoryRingBuffer. HistoryRead requests for raw data are served from the buffers, also
+ * with bounds, reverse time order and continuation points. History updates (insert, replace,
+ * update and delete raw) are applied to the buffers.
+ *
+ * The backend installs the default history database of open62541 on first registration
+ * (open62541 must be built with `UA_ENABLE_HISTORIZING`). The backend must be used from the server
+ * thread (or before the server runs) and must outlive the server.
+ * @code
+ * HistoryBackend history;
+ * history.registerNode(server, id, {10000, "/var/lib/opcua/temperature.hist"});
+ * @endcode
+ *
+ * @note The default history database of open62541 only supports raw reads, processed (aggregate)
+ * reads are answered with `BadHistoryOperationUnsupported`. Samples only have source timestamps,
+ * reads must request `TimestampsToReturn::Source`.
+ */
+class HistoryBackend {
+public:
+    HistoryBackend() = default;
+    ~HistoryBackend() = default;
+
+    HistoryBackend(const HistoryBackend&) = delete;
+    HistoryBackend(HistoryBackend&&) noexcept = delete;
+    HistoryBackend& operator=(const HistoryBackend&) = delete;
+    HistoryBackend& operator=(HistoryBackend&&) noexcept = delete;
+
+    /**
+     * Enable history of a variable node.
+     * The `Historizing` attribute and the `HistoryRead` access level of the node are set.
+     * @return Ring buffer of the node, stable for the lifetime of the backend
+     * @exception BadStatus (BadNotSupported) If open62541 is built without historizing
+     * @exception BadStatus (BadInvalidState) If another history database is configured
+     * @exception BadStatus If the ring buffer can not be created or the node can not be registered
+     */
+    HistoryRingBuffer& registerNode(
+        Server& server, const NodeId& id, const HistoryOptions& options
+    );
+
+    /// Get the ring buffer of a registered node.
+    /// @exception BadStatus (BadNodeIdUnknown) If the node is not registered
+    HistoryRingBuffer& getBuffer(const NodeId& id);
+
+    /// Number of registered nodes.
+    size_t size() const noexcept {
+        return buffers_.size();
+    }
+
+private:
+    friend struct HistoryBackendCallbacks;
+
+    HistoryRingBuffer* findBuffer(const UA_NodeId* id) noexcept;
+
+    std::unordered_map<NodeId, std::unique_ptr<HistoryRingBuffer>> buffers_;
+    DataValue scratch_;  // returned by the getDataValue callback
+};
+
+}  // namespace opcua
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "open62541pp/Common.h"  // MonitoringMode
+#include "open62541pp/Config.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/Subscription.h"
+#include "open62541pp/services/MonitoredItem.h"
+#include "open62541pp/services/Subscription.h"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+namespace opcua {
+
+// forward declarations
+class Client;
+class ReadValueId;
+
+/**
+ * Options of HotStandby.
+ */
+struct HotStandbyOptions {
+    /// Parameters of the subscriptions on both servers.
+    /// The keep-alive period (`publishingInterval * maxKeepAliveCount`) bounds the failover time.
+    SubscriptionParameters parameters{};
+    /// Monitoring mode of the standby items on the secondary server.
+    /// `Sampling` keeps the server-side queues filled, so the latest values are reported right
+    /// after the failover. `Disabled` saves resources of the secondary server.
+    MonitoringMode standbyMode = MonitoringMode::Sampling;
+};
+
+/**
+ * Hot-standby data change subscriptions for a redundant server pair.
+ *
+ * The monitored items are created on both servers: in reporting mode on the primary server and in
+ * standby mode (sampling or disabled) on the secondary server. If the keep-alive of the primary
+ * subscription fails or the primary client is disconnected, all standby items are switched to
+ * reporting with one batched SetMonitoringMode request. The callbacks are shared by both servers
+ * and only receive notifications of the active server, so the failover is transparent to the
+ * DataChangeCallback consumers (except the connection of the MonitoredItem handles).
+ *
+ * Both clients must be connected and run (e.g. Client::runIterate) by the application. The
+ * failover is detected by check(), which should be called after each iteration of the clients.
+ * There is no automatic failback to the primary server.
+ * @code
+ * HotStandbyOptions options;
+ * options.parameters.publishingInterval = 25.0;
+ * options.parameters.maxKeepAliveCount = 3;  // failover after ~75 ms without keep-alive
+ * HotStandby standby(primary, secondary, options);
+ * standby.subscribeDataChange(items, {}, onDataChange);
+ * while (true) {
+ *     primary.runIterate(10);
+ *     secondary.runIterate(10);
+ *     standby.check();
+ * }
+ * @endcode
+ */
+class HotStandby {
+public:
+    HotStandby(Client& primary, Client& secondary, HotStandbyOptions options = {});
+
+    /// Delete the subscriptions, errors of failed connections are ignored.
+    ~HotStandby();
+
+    HotStandby(const HotStandby&) = delete;
+    HotStandby(HotStandby&&) noexcept = delete;
+    HotStandby& operator=(const HotStandby&) = delete;
+    HotStandby& operator=(HotStandby&&) noexcept = delete;
+
+    /**
+     * Create monitored items for data change notifications on both servers.
+     * The subscriptions are created with the first items.
+     * @param itemsToMonitor Items to monitor
+     * @param parameters Monitoring parameters of all items
+     * @param onDataChange Invoked with the notifications of the active server
+     * @returns Per-item results of the active server
+     * @exception BadStatus If the subscriptions can not be created
+     */
+    std::vector<MonitoredItemResult> subscribeDataChange(
+        Span<const ReadValueId> itemsToMonitor,
+        const MonitoringParameters& parameters,
+        DataChangeCallback<Client> onDataChange
+    );
+
+    /// Fail over to the secondary server if the keep-alive of the primary subscription failed or
+    /// the primary client is disconnected.
+    /// @returns `true` if the failover was performed by this call
+    bool check();
+
+    /// Switch the standby items of the secondary server to reporting. The items of the primary
+    /// server are kept (to not block on an unreachable server), their notifications are dropped.
+    /// Subsequent calls have no effect after a successful failover.
+    /// @exception BadStatus If the monitoring mode of the secondary items can not be set, the
+    ///            primary server stays active and the failover can be retried
+    void failover();
+
+    /// Check if the secondary server is active.
+    bool isFailedOver() const noexcept {
+        return failedOver_.load(std::memory_order_acquire);
+    }
+
+    /// Get the client of the active server.
+    Client& getActiveClient() noexcept {
+        return isFailedOver() ? secondary_.client : primary_.client;
+    }
+
+private:
+    struct Side {
+        Client& client;
+        uint32_t subscriptionId{0};
+        std::vector<uint32_t> monitoredItemIds;
+    };
+
+    std::vector<MonitoredItemResult> subscribe(
+        Side& side,
+        Span<const ReadValueId> itemsToMonitor,
+        MonitoringMode monitoringMode,
+        const MonitoringParameters& parameters,
+        DataChangeCallback<Client> onDataChange
+    );
+    bool isPrimaryAlive();
+
+    HotStandbyOptions options_;
+    Side primary_;
+    Side secondary_;
+    std::atomic<bool> failedOver_{false};
+};
+
+}  // namespace opcua
+
+#endif
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include "open62541pp/Common.h"  // NodeClass
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/ExtensionObject.h"
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua {
+
+// forward declaration
+class Server;
+struct ValueBackendDataSource;
+
+/**
+ * Pre-computed instance declarations of an object type to create many instances in bulk.
+ *
+ * Creating an object with `addObject` walks the type definition and copies every mandatory child
+ * for each instance. The template walks the type definition (including the instance declarations
+ * inherited from supertypes) only once and stores the flattened list of mandatory children with
+ * their attributes, type definitions and reference types. instantiate() stamps out instances in
+ * bulk: all nodes of all instances are inserted in a single pass with deferred type checks, like
+ * NodeBatch. Method declarations are referenced, not copied.
+ *
+ * The node ids of the children are generated from the instance's node id:
+ * - String node ids: `<instance id>.<browse name>.<browse name>...` (browse path of the child)
+ * - Numeric node ids: `<instance id> + 1 + child index`, reserve `getChildCount() + 1`
+ *   consecutive ids per instance
+ *
+ * The template is a snapshot, changes of the object type are not reflected. Templates can be
+ * created explicitly or cached per object type with Server::getInstantiationTemplate.
+ *
+ * @code
+ * auto& motorTemplate = server.getInstantiationTemplate({1, "MotorType"});
+ * std::vector<NodeId> ids;
+ * std::vector<QualifiedName> names;
+ * // ...
+ * const auto variables = motorTemplate.instantiate(ObjectId::ObjectsFolder, ids, names);
+ * server.setVariableNodeValueBackends(variables, keys, driver);
+ * @endcode
+ */
+class InstantiationTemplate {
+public:
+    /// Instance declaration of the object type.
+    struct Child {
+        size_t parent;  ///< Index of the parent child, `npos` for children of the instance
+        NodeId referenceType;  ///< Reference type from the parent
+        NodeClass nodeClass;
+        QualifiedName browseName;
+        NodeId declarationId;  ///< Node id of the instance declaration
+        NodeId typeDefinition;  ///< Type definition of objects and variables
+        ExtensionObject attributes;  ///< Decoded node attributes
+    };
+
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    /**
+     * Walk the object type and collect its mandatory instance declarations.
+     * @param server Server of the object type, must outlive the template
+     * @param objectType Object type to instantiate
+     * @exception BadStatus (BadNodeIdUnknown) If the object type does not exist
+     * @exception BadStatus (BadNodeClassInvalid) If the node is not an object type
+     */
+    InstantiationTemplate(Server& server, const NodeId& objectType);
+
+    /// Get the object type.
+    const NodeId& getObjectType() const noexcept {
+        return objectType_;
+    }
+
+    /// Number of copied children per instance (without method declarations).
+    size_t getChildCount() const noexcept {
+        return children_.size();
+    }
+
+    /// Get the flattened instance declarations, parents precede their children.
+    Span<const Child> getChildren() const noexcept {
+        return children_;
+    }
+
+    /// Find the index of a child by its browse path relative to the instance.
+    std::optional<size_t> findChild(Span<const QualifiedName> browsePath) const;
+
+    /**
+     * Generate the node id of a child of an instance.
+     * @exception BadStatus (BadNodeIdInvalid) If the instance id is neither numeric nor a string
+     */
+    NodeId getChildId(const NodeId& instanceId, size_t index) const;
+
+    /**
+     * Create instances of the object type in bulk.
+     * @param parentId Parent node of the instances
+     * @param ids Node ids of the instances
+     * @param browseNames Browse names of the instances (also used as display names), same size
+     *        as `ids`
+     * @param referenceType Hierarchical reference type from the parent to the instances
+     * @return Node ids of the created variables in instance order, e.g. to attach data sources
+     * @exception BadStatus (BadInvalidArgument) If the sizes of `ids` and `browseNames` differ
+     * @exception BadStatus If a node can not be added (status code of the first failure). The
+     *            nodes of the other instances remain.
+     */
+    std::vector<NodeId> instantiate(
+        const NodeId& parentId,
+        Span<const NodeId> ids,
+        Span<const QualifiedName> browseNames,
+        const NodeId& referenceType = ReferenceTypeId::HasComponent
+    );
+
+    /**
+     * Create instances of the object type in bulk and attach a shared data source backend to all
+     * variables of the instances.
+     * @copydetails instantiate(const NodeId&, Span<const NodeId>, Span<const QualifiedName>,
+     *              const NodeId&)
+     * @param backend Data source backend, shared by all variables (see
+     *        Server::setVariableNodeValueBackends)
+     */
+    std::vector<NodeId> instantiate(
+        const NodeId& parentId,
+        Span<const NodeId> ids,
+        Span<const QualifiedName> browseNames,
+        ValueBackendDataSource backend,
+        const NodeId& referenceType = ReferenceTypeId::HasComponent
+    );
+
+private:
+    struct MethodReference {
+        size_t parent;
+        NodeId referenceType;
+        NodeId methodId;
+    };
+
+    void collectChildren(const NodeId& declarationId, size_t parent);
+
+    Server& server_;
+    NodeId objectType_;
+    std::vector<Child> children_;
+    std::vector<MethodReference> methods_;
+    std::vector<std::vector<QualifiedName>> paths_;  // browse paths of the children
+};
+
+}  // namespace opcua
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include "open62541pp/Span.h"
+#include "open62541pp/open62541.h"
+#include "open62541pp/typeregistry/Builtin.h"
+
+namespace opcua {
+
+/**
+ * Options of the JSON encoding.
+ */
+struct JsonEncodingOptions {
+    /// Encode in the reversible form of the OPC UA JSON encoding (Part 6, 5.4).
+    /// Variants are encoded as `{"Type":...,"Body":...}`, extension objects with their `TypeId`.
+    /// The non-reversible form encodes the plain values, status codes with their symbol.
+    bool reversible = true;
+};
+
+/* ----------------------------------------- Internals ------------------------------------------ */
+
+namespace detail {
+
+std::string encodeJson(
+    const void* src, const UA_DataType& type, const JsonEncodingOptions& options
+);
+Span<char> encodeJson(
+    const void* src, const UA_DataType& type, Span<char> buffer, const JsonEncodingOptions& options
+);
+
+}  // namespace detail
+
+/* --------------------------------------- JSON encoding ---------------------------------------- */
+
+/**
+ * @defgroup JsonEncoding JSON encoding
+ * Encode types in the OPC UA JSON format, independent of a server or client.
+ *
+ * The encoder is implemented in open62541++ and does not require `UA_ENABLE_JSON_ENCODING`.
+ * Values are written directly into the output buffer, numbers are formatted with `std::to_chars`.
+ * Native types, TypeWrapper types and custom types (e.g. built with DataTypeBuilder) are supported.
+ * Structures are encoded as objects with their member names, which requires
+ * `UA_ENABLE_TYPEDESCRIPTION`. Multi-dimensional variants are encoded as flat arrays with their
+ * dimensions (reversible form only).
+ * @{
+ */
+
+/// Encode object in JSON format.
+/// @exception BadStatus If the encoding fails
+template <typename T>
+[[nodiscard]] std::string encodeJson(
+    const T& value, const UA_DataType& dataType, const JsonEncodingOptions& options = {}
+) {
+    return detail::encodeJson(&value, dataType, options);
+}
+
+/// @copydoc encodeJson(const T&, const UA_DataType&, const JsonEncodingOptions&)
+template <typename T>
+[[nodiscard]] std::string encodeJson(const T& value, const JsonEncodingOptions& options = {}) {
+    return encodeJson(value, getDataType<T>(), options);
+}
+
+/// Encode object in JSON format into a caller-provided buffer.
+/// @return The used part of the buffer
+/// @exception BadStatus (BadEncodingLimitsExceeded) If the buffer is too small
+/// @exception BadStatus If the encoding fails
+template <typename T>
+Span<char> encodeJson(
+    const T& value,
+    const UA_DataType& dataType,
+    Span<char> buffer,
+    const JsonEncodingOptions& options = {}
+) {
+    return detail::encodeJson(&value, dataType, buffer, options);
+}
+
+/// @copydoc encodeJson(const T&, const UA_DataType&, Span<char>, const JsonEncodingOptions&)
+template <typename T>
+Span<char> encodeJson(const T& value, Span<char> buffer, const JsonEncodingOptions& options = {}) {
+    return encodeJson(value, getDataType<T>(), buffer, options);
+}
+
+/**
+ * Encoder to append many objects in JSON format to a single, reusable buffer.
+ *
+ * Each object is written as a single line (JSON Lines), e.g. to export batches of DataValues.
+ * The buffer grows geometrically and is kept by clear(). After warm-up, no further allocations
+ * are required to encode batches of similar size.
+ * @code
+ * JsonEncoder encoder;
+ * for (const auto& dv : values) {
+ *     encoder.append(dv);
+ * }
+ * write(encoder.data());
+ * encoder.clear();
+ * @endcode
+ */
+class JsonEncoder {
+public:
+    /// Create encoder with an initial buffer capacity in bytes.
+    explicit JsonEncoder(JsonEncodingOptions options = {}, size_t capacity = 0);
+
+    /// Append object in JSON format, terminated by a newline.
+    /// If the encoding fails, the previously appended objects are kept.
+    /// @exception BadStatus If the encoding fails
+    template <typename T>
+    void append(const T& value, const UA_DataType& dataType) {
+        appendImpl(&value, dataType);
+    }
+
+    /// @copydoc append(const T&, const UA_DataType&)
+    template <typename T>
+    void append(const T& value) {
+        append(value, getDataType<T>());
+    }
+
+    /// Get the encoded data.
+    std::string_view data() const noexcept {
+        return {buffer_.data(), size_};
+    }
+
+    /// Number of encoded bytes.
+    size_t size() const noexcept {
+        return size_;
+    }
+
+    /// Capacity of the buffer in bytes.
+    size_t capacity() const noexcept {
+        return buffer_.size();
+    }
+
+    /// Reserve buffer capacity in bytes.
+    void reserve(size_t capacity);
+
+    /// Discard the encoded data, the buffer is kept for reuse.
+    void clear() noexcept {
+        size_ = 0;
+    }
+
+private:
+    void appendImpl(const void* src, const UA_DataType& type);
+
+    JsonEncodingOptions options_;
+    std::string buffer_;
+    size_t size_{0};
+};
+
+/**
+ * @}
+ */
+
+}  // namespace opcua
@@ -1,6 +1,10 @@
 #pragma once
 
+#include <cstdarg>  // va_list
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <string>
 #include <string_view>
 
 // forward declare
@@ -43,6 +47,119 @@ enum class LogCategory {
 /// Log function signature.
 using Logger = std::function<void(LogLevel, LogCategory, std::string_view msg)>;
 
+/**
+ * Unformatted log record of a structured logger.
+ * The record references the printf-style format string and the arguments of the log call, the
+ * message is only formatted on demand. Both are valid during the call of the structured logger
+ * only; consumers that defer the formatting must copy the format string and the arguments, e.g.
+ * into a binary-packed record.
+ * @see StructuredLogger
+ */
+class LogRecord {
+public:
+    LogRecord(LogLevel level, LogCategory category, const char* format, va_list args) noexcept
+        : level_(level),
+          category_(category),
+          format_(format) {
+        va_copy(args_, args);  // NOLINT
+    }
+
+    ~LogRecord() {
+        va_end(args_);  // NOLINT
+    }
+
+    LogRecord(const LogRecord&) = delete;
+    LogRecord(LogRecord&&) noexcept = delete;
+    LogRecord& operator=(const LogRecord&) = delete;
+    LogRecord& operator=(LogRecord&&) noexcept = delete;
+
+    LogLevel getLevel() const noexcept {
+        return level_;
+    }
+
+    LogCategory getCategory() const noexcept {
+        return category_;
+    }
+
+    /// Get the printf-style format string.
+    const char* getFormat() const noexcept {
+        return format_;
+    }
+
+    /// Copy the arguments of the format string, `dst` must be released with `va_end`.
+    void copyArgs(va_list& dst) const noexcept {
+        va_copy(dst, args_);  // NOLINT
+    }
+
+    /// Format the message into a buffer, truncated to `size - 1` characters.
+    /// @return Length of the full message, negative if the formatting failed
+    int formatTo(char* buffer, size_t size) const noexcept;
+
+    /// Format the message.
+    std::string format() const;
+
+private:
+    LogLevel level_;
+    LogCategory category_;
+    const char* format_;
+    mutable va_list args_{};
+};
+
+/// Structured log function signature, called synchronously with the unformatted record.
+using StructuredLogger = std::function<void(const LogRecord& record)>;
+
+// Compile-time minimum log level (0 = trace, 1 = debug, ..., 5 = fatal).
+// Defined by the CMake option UAPP_LOG_LEVEL_MIN.
+#ifndef UAPP_LOG_LEVEL_MIN
+#define UAPP_LOG_LEVEL_MIN 0
+#endif
+
+/// Compile-time minimum log level, messages below are discarded without formatting.
+inline constexpr LogLevel logLevelMin = static_cast<LogLevel>(UAPP_LOG_LEVEL_MIN);
+
+/// Bit mask of log categories.
+using LogCategoryMask = uint32_t;
+
+/// Mask with all log categories.
+inline constexpr LogCategoryMask logCategoryAll = ~LogCategoryMask{0};
+
+/// Get bit mask of a log category, masks can be combined with `|`.
+constexpr LogCategoryMask logCategoryMask(LogCategory category) noexcept {
+    return LogCategoryMask{1} << static_cast<uint32_t>(category);
+}
+
+/**
+ * Filter of log messages, applied before messages are formatted.
+ * @see Server::setLogger, Client::setLogger
+ */
+struct LogFilter {
+    /// Messages below this level are discarded.
+    LogLevel minLevel = LogLevel::Trace;
+    /// Messages of categories not in the mask are discarded.
+    LogCategoryMask categories = logCategoryAll;
+
+    /// Check if a message passes the filter and the compile-time minimum log level.
+    constexpr bool accepts(LogLevel level, LogCategory category) const noexcept {
+        return level >= logLevelMin && level >= minLevel &&
+               (categories & logCategoryMask(category)) != 0;
+    }
+};
+
+/**
+ * Options of asynchronous logging.
+ * @see Server::setAsyncLogger, Client::setAsyncLogger
+ */
+struct AsyncLoggerOptions {
+    /// Messages are truncated to this length (fixed-size records without allocations).
+    static constexpr size_t maxMessageLength = 511;
+
+    /// Number of records in the ring buffer (rounded up to the next power of two).
+    /// Messages are dropped if the ring buffer is full.
+    size_t capacity = 1024;
+    /// Filter applied before formatting.
+    LogFilter filter{};
+};
+
 /// Generate log message with client's logger.
 void log(UA_Client* client, LogLevel level, LogCategory category, std::string_view msg);
 
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "open62541pp/open62541.h"
+
+namespace opcua {
+
+/**
+ * Bump allocator to group many small allocations and release them at once.
+ *
+ * Memory is taken from chunks of a fixed size (larger requests get their own chunk).
+ * Single blocks are never freed, all memory is released by release() or on destruction.
+ * This avoids heap fragmentation caused by deep copies of large responses, e.g. of
+ * `ReadResponse` or `BrowseResult` objects.
+ *
+ * Use MemoryArenaScope to route the allocations of open62541 (`UA_malloc`, ...) and thereby all
+ * deep copies of TypeWrapper objects into the arena.
+ */
+class MemoryArena {
+public:
+    /// Create arena with a given chunk size in bytes.
+    explicit MemoryArena(size_t chunkSize = 64 * 1024);
+
+    ~MemoryArena() = default;
+
+    MemoryArena(const MemoryArena&) = delete;
+    MemoryArena(MemoryArena&&) noexcept = default;
+    MemoryArena& operator=(const MemoryArena&) = delete;
+    MemoryArena& operator=(MemoryArena&&) noexcept = default;
+
+    /// Allocate a block of `size` bytes (aligned to `std::max_align_t`).
+    /// @exception std::bad_alloc If the memory could not be allocated
+    [[nodiscard]] void* allocate(size_t size);
+
+    /// Resize a block previously allocated from the arena (contents are copied).
+    /// @exception std::bad_alloc If the memory could not be allocated
+    [[nodiscard]] void* reallocate(void* ptr, size_t size);
+
+    /// Check if the pointer was allocated from this arena.
+    bool owns(const void* ptr) const noexcept;
+
+    /// Release all blocks at once. The first chunk is kept for reuse.
+    void release() noexcept;
+
+    /// Number of bytes handed out since construction or the last release().
+    size_t bytesAllocated() const noexcept {
+        return bytesAllocated_;
+    }
+
+private:
+    struct Chunk {
+        std::unique_ptr<std::byte[]> data;  // NOLINT
+        size_t size;
+        size_t used;
+    };
+
+    Chunk& chunkFor(size_t size);
+
+    size_t chunkSize_;
+    size_t bytesAllocated_{0};
+    std::vector<Chunk> chunks_;
+};
+
+#ifdef UA_ENABLE_MALLOC_SINGLETON
+/**
+ * Scope guard to redirect all open62541 allocations of the current thread into a MemoryArena.
+ *
+ * Requires open62541 to be compiled with `UA_ENABLE_MALLOC_SINGLETON`.
+ * Blocks allocated before the scope are freed with the previous allocator, blocks allocated within
+ * the scope are released by the arena. Objects allocated within the scope must not be destroyed
+ * after the scope has ended, unless the arena is still alive and they are not cleared:
+ * @code
+ * MemoryArena arena;
+ * {
+ *     MemoryArenaScope scope(arena);
+ *     ReadResponse copy = response;  // deep copy into arena
+ *     // ...
+ * }  // copy is destroyed before the scope ends
+ * arena.release();
+ * @endcode
+ */
+class MemoryArenaScope {
+public:
+    explicit MemoryArenaScope(MemoryArena& arena) noexcept;
+    ~MemoryArenaScope();
+
+    MemoryArenaScope(const MemoryArenaScope&) = delete;
+    MemoryArenaScope(MemoryArenaScope&&) noexcept = delete;
+    MemoryArenaScope& operator=(const MemoryArenaScope&) = delete;
+    MemoryArenaScope& operator=(MemoryArenaScope&&) noexcept = delete;
+
+private:
+    static void* mallocImpl(size_t size) noexcept;
+    static void freeImpl(void* ptr) noexcept;
+    static void* callocImpl(size_t count, size_t size) noexcept;
+    static void* reallocImpl(void* ptr, size_t size) noexcept;
+    static const MemoryArenaScope* findOwner(const void* ptr) noexcept;
+    static const MemoryArenaScope& outermost() noexcept;
+
+    MemoryArena& arena_;
+    MemoryArenaScope* previousScope_;
+    void* (*previousMalloc_)(size_t);
+    void (*previousFree_)(void*);
+    void* (*previousCalloc_)(size_t, size_t);
+    void* (*previousRealloc_)(void*, size_t);
+};
+#endif
+
+}  // namespace opcua
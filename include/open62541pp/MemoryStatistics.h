@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace opcua {
+
+/// Category of memory held or allocated by open62541pp.
+/// @see MemoryStatistics
+enum class MemoryCategory : uint8_t {
+    NativeAllocation,  ///< Native objects and arrays allocated with `UA_new`/`UA_Array_new`
+    NativeCopy,  ///< Deep copies of native objects and arrays, e.g. Variants passed to callbacks
+    NodeContext,  ///< Node contexts of the server (callbacks, data sources, value callbacks)
+    SubscriptionContext,  ///< Subscription contexts of the client
+    MonitoredItemContext,  ///< Monitored item contexts of the server and the client
+};
+
+/// Get the name of a memory category, e.g. `NodeContext`.
+std::string_view getMemoryCategoryName(MemoryCategory category) noexcept;
+
+/**
+ * Memory statistics of a category.
+ *
+ * Contexts are counted by the context maps of the server/client: every context object owned by
+ * the map is counted, including stale contexts not reclaimed yet and recycled contexts kept for
+ * reuse. Only the size of the context objects is accounted (`sizeof`), not memory owned by their
+ * members like callbacks.
+ *
+ * Native allocations and copies are counted process-wide while the accounting is enabled by any
+ * server or client. Native memory is released by open62541 functions, so only totals are
+ * recorded; `objects`, `currentBytes` and `peakBytes` are zero. The bytes of deep copies are
+ * estimated with the binary encoding size.
+ */
+struct MemoryCategoryStatistics {
+    MemoryCategory category{};
+    uint64_t allocations = 0;  ///< Total number of allocations
+    uint64_t allocatedBytes = 0;  ///< Total bytes allocated
+    uint64_t objects = 0;  ///< Objects currently held
+    uint64_t currentBytes = 0;  ///< Bytes currently held
+    uint64_t peakBytes = 0;  ///< High-water mark of currentBytes
+};
+
+/**
+ * Snapshot of the memory held or allocated by open62541pp, broken down per category.
+ * @see Server::getMemoryStatistics, Client::getMemoryStatistics
+ */
+struct MemoryStatistics {
+    std::vector<MemoryCategoryStatistics> categories;
+
+    /// Get the statistics of a category, `nullptr` if the category is not used.
+    const MemoryCategoryStatistics* findCategory(MemoryCategory category) const noexcept {
+        for (const auto& item : categories) {
+            if (item.category == category) {
+                return &item;
+            }
+        }
+        return nullptr;
+    }
+
+    /// Sum of the bytes currently held by all categories.
+    uint64_t currentBytes() const noexcept {
+        uint64_t sum = 0;
+        for (const auto& item : categories) {
+            sum += item.currentBytes;
+        }
+        return sum;
+    }
+};
+
+}  // namespace opcua
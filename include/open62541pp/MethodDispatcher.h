@@ -0,0 +1,104 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "open62541pp/Config.h"
+#include "open62541pp/types/Composed.h"  // CallMethodRequest
+#include "open62541pp/types/NodeId.h"
+
+#ifdef UAPP_HAS_ASYNC_OPERATIONS
+
+namespace opcua {
+
+// forward declaration
+class Server;
+
+/**
+ * Worker pool to execute method callbacks off the server loop.
+ *
+ * Calls of dispatched methods are queued by the server as async operations (open62541 must be
+ * built with `UA_MULTITHREADING >= 100`). The worker threads execute the method callbacks
+ * (services::addMethod) and hand the results back to the server, which sends the responses
+ * asynchronously. The output arguments are written in place by the callback (`Span<Variant>`),
+ * without intermediate copies in the dispatcher. Other services are processed by the server loop
+ * while methods are running.
+ *
+ * The number of concurrent calls can be limited per method, excess calls are deferred until a
+ * running call of the same method completes. Calls are answered with `BadTimeout` by the server if
+ * they are not completed within the server's async operation timeout.
+ *
+ * Only one dispatcher per server is allowed. The dispatcher must be destroyed before the server.
+ * @code
+ * MethodDispatcher dispatcher(server, 8);
+ * dispatcher.dispatch(exportId, 1);  // one export at a time
+ * dispatcher.dispatch(validateId);
+ * server.run();
+ * @endcode
+ */
+class MethodDispatcher {
+public:
+    /// Start the worker threads.
+    /// @exception BadStatus (BadInvalidState) If the server has a dispatcher already
+    explicit MethodDispatcher(Server& server, size_t threadCount = 4);
+    /// Stop the worker threads. Deferred calls are answered with `BadShutdown`.
+    ~MethodDispatcher();
+
+    MethodDispatcher(const MethodDispatcher&) = delete;
+    MethodDispatcher(MethodDispatcher&&) noexcept = delete;
+    MethodDispatcher& operator=(const MethodDispatcher&) = delete;
+    MethodDispatcher& operator=(MethodDispatcher&&) noexcept = delete;
+
+    /**
+     * Execute calls of the method on the worker pool.
+     * @param methodId Method node with a callback
+     * @param maxConcurrency Maximum number of concurrent calls of the method (0: unlimited)
+     * @exception BadStatus If the method node does not exist
+     */
+    void dispatch(const NodeId& methodId, size_t maxConcurrency = 0);
+
+    /// Number of worker threads.
+    size_t getThreadCount() const noexcept {
+        return threads_.size();
+    }
+
+    /// Number of calls deferred by the concurrency limits.
+    size_t getDeferredCount() const;
+
+private:
+    struct Call {
+        CallMethodRequest request;
+        void* context;
+    };
+
+    struct Method {
+        size_t maxConcurrency = 0;
+        size_t running = 0;
+        std::deque<Call> deferred;
+    };
+
+    static void notify(UA_Server* server) noexcept;  // asyncOperationNotifyCallback
+
+    void work();
+    bool takeDeferred(Call& call);
+    bool acquire(Call& call);
+    void release(const NodeId& methodId);
+    void execute(Call& call);
+
+    Server& server_;
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    bool stop_ = false;
+    size_t notifications_ = 0;
+    std::unordered_map<NodeId, Method> methods_;
+    std::vector<std::thread> threads_;
+};
+
+}  // namespace opcua
+
+#endif
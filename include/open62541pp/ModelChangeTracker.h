@@ -0,0 +1,158 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "open62541pp/Config.h"
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/services/View.h"  // BrowseRecursiveCallback, BrowseRecursiveOptions
+#include "open62541pp/types/NodeId.h"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+
+namespace opcua {
+
+// forward declarations
+class BrowsePathResolver;
+class Client;
+template <typename T>
+class MonitoredItem;
+template <typename T>
+class Subscription;
+
+/**
+ * Verbs of a model change (bits of the `ModelChangeStructureVerbMask`).
+ * @see https://reference.opcfoundation.org/Core/Part5/v105/docs/6.4.32
+ */
+enum class ModelChangeVerb : uint8_t {
+    // clang-format off
+    NodeAdded        = 1,
+    NodeDeleted      = 2,
+    ReferenceAdded   = 4,
+    ReferenceDeleted = 8,
+    DataTypeChanged  = 16,
+    // clang-format on
+};
+
+/// Decoded entry of the `Changes` field of a `GeneralModelChangeEventType` event.
+struct ModelChange {
+    NodeId affected;
+    NodeId affectedType;
+    uint8_t verb = 0;  ///< Combination of ModelChangeVerb bits
+
+    bool has(ModelChangeVerb verb) const noexcept {
+        return (this->verb & static_cast<uint8_t>(verb)) != 0;
+    }
+};
+
+/// Callbacks to apply the model changes of ModelChangeTracker::update to a client-side mirror.
+struct ModelChangeHandler {
+    /// The subtree below the node is stale and browsed again, drop its references in the mirror.
+    std::function<void(const NodeId& id)> onSubtreeChanged;
+    /// Reference of a browsed subtree (see services::browseRecursive).
+    services::BrowseRecursiveCallback onReference;
+    /// The node was deleted.
+    std::function<void(const NodeId& id)> onNodeDeleted;
+};
+
+/**
+ * Incremental updates of a client-side mirror of the server's address space.
+ *
+ * Instead of periodic full browses of the mirrored subtrees, the tracker subscribes to the
+ * ModelChangeEvents of the server (subscribe) and queues the affected nodes and verbs of the
+ * `Changes` field of `GeneralModelChangeEventType` events. Each update then:
+ * - invalidates the affected nodes in the attribute cache of the client
+ *   (Client::enableAttributeCache),
+ * - clears the browse path resolvers added with addBrowsePathResolver,
+ * - unregisters deleted nodes, that were registered with Client::registerNodes,
+ * - browses the subtrees of added nodes and of the source nodes of added or deleted references
+ *   again with the parallel crawler of services::browseRecursive (hierarchical references).
+ *
+ * Subtrees are browsed at most once per update. Events without decodable changes (e.g.
+ * `BaseModelChangeEventType` events) mark the complete mirror as stale, the roots are browsed
+ * again. Updates run the client (Client::runIterate), call update from the thread that runs the
+ * client and never from a callback of the client.
+ *
+ * The tracker must not outlive the client and, like the client, is not thread-safe. The monitored
+ * item may outlive the tracker.
+ * @code
+ * ModelChangeTracker tracker(client, {ObjectId::ObjectsFolder});
+ * auto sub = client.createSubscription();
+ * tracker.subscribe(sub);
+ * ModelChangeHandler handler;
+ * handler.onSubtreeChanged = [&](const NodeId& id) { mirror.dropChildren(id); };
+ * handler.onReference = [&](const NodeId& sourceId, const ReferenceDescription& ref) {
+ *     mirror.add(sourceId, ref);
+ * };
+ * handler.onNodeDeleted = [&](const NodeId& id) { mirror.remove(id); };
+ * tracker.update(handler);  // initial browse of the roots
+ * while (running) {
+ *     client.runIterate(100);
+ *     tracker.update(handler);  // no requests without pending changes
+ * }
+ * @endcode
+ */
+class ModelChangeTracker {
+public:
+    /**
+     * Create a tracker for the subtrees below `roots` (including the roots).
+     * The mirror is stale initially, the first update browses all roots.
+     * @param client Client of the mirror
+     * @param roots Root nodes of the mirrored subtrees
+     * @param options Concurrency options of the crawler
+     */
+    explicit ModelChangeTracker(
+        Client& client,
+        std::vector<NodeId> roots = {ObjectId::ObjectsFolder},
+        services::BrowseRecursiveOptions options = {}
+    );
+
+    ModelChangeTracker(const ModelChangeTracker&) = delete;
+    ModelChangeTracker(ModelChangeTracker&&) noexcept = delete;
+    ModelChangeTracker& operator=(const ModelChangeTracker&) = delete;
+    ModelChangeTracker& operator=(ModelChangeTracker&&) noexcept = delete;
+
+    /**
+     * Track the ModelChangeEvents of the server.
+     * Creates an event monitored item for the Server object in the subscription.
+     */
+    MonitoredItem<Client> subscribe(Subscription<Client>& subscription);
+
+    /// Clear the cache of the resolver with every structural change.
+    /// The resolver must outlive the tracker.
+    void addBrowsePathResolver(BrowsePathResolver& resolver);
+
+    /// Mark the complete mirror as stale, e.g. after a reconnect with lost events.
+    void invalidate() noexcept;
+
+    /// Queued changes, applied with the next update.
+    Span<const ModelChange> getPendingChanges() const noexcept;
+
+    /// Check if the complete mirror is stale.
+    bool isStale() const noexcept;
+
+    /**
+     * Apply the queued changes.
+     * @return Number of browsed nodes, including the roots of the subtrees
+     * @exception BadStatus If a Browse request failed, the changes stay queued and the complete
+     *            mirror is marked as stale
+     */
+    size_t update(const ModelChangeHandler& handler);
+
+private:
+    struct State;
+
+    Client* client_;
+    std::vector<NodeId> roots_;
+    services::BrowseRecursiveOptions options_;
+    std::vector<BrowsePathResolver*> resolvers_;
+    std::shared_ptr<State> state_;  // shared with the event callback
+};
+
+}  // namespace opcua
+
+#endif
@@ -4,6 +4,7 @@
 
 #include "open62541pp/Common.h"
 #include "open62541pp/Config.h"
+#include "open62541pp/SubscriptionStatistics.h"
 #include "open62541pp/services/MonitoredItem.h"
 
 #ifdef UA_ENABLE_SUBSCRIPTIONS
@@ -55,6 +56,18 @@ public:
     /// Get the monitored AttributeId.
     AttributeId getAttributeId() const;
 
+    /// Get the dense client-side handle of this monitored item.
+    /// Handles are in the range [0, number of monitored items) and reused after deletion, so they
+    /// can be used as indices of flat arrays, e.g. to map notifications to application data.
+    /// @note Not implemented for Server.
+    /// @see services::MonitoredItemResult::clientHandle
+    uint32_t getClientHandle() const;
+
+    /// Get the health statistics of this monitored item (notifications, overflows, latency).
+    /// @note Not implemented for Server.
+    /// @see MonitoredItemStatistics
+    MonitoredItemStatistics getStatistics() const;
+
     /// Modify this monitored item.
     /// @note Not implemented for Server.
     /// @see services::modifyMonitoredItem
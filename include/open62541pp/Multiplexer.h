@@ -0,0 +1,134 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace opcua {
+
+// forward declaration
+class Client;
+class Server;
+
+/**
+ * Options of Multiplexer.
+ */
+struct MultiplexerOptions {
+    /// Number of worker threads shared by all instances.
+    size_t threads = 2;
+    /// Maximum interval between two iterations of an instance.
+    /// Bounds the latency of network events, which are polled (non-blocking) by each iteration.
+    std::chrono::milliseconds maxInterval{10};
+    /// Called with exceptions thrown by an iteration (from a worker thread).
+    /// The instance stays scheduled. Exceptions are discarded if not set.
+    std::function<void(std::exception_ptr)> onException;
+};
+
+/**
+ * Drive many Server and Client instances from a small, fixed pool of worker threads.
+ *
+ * Instead of one blocking `run()` thread per instance, the multiplexer schedules the non-blocking
+ * `runIterate` of each instance: servers are iterated again after the wait interval returned by
+ * Server::runIterate, clients after the maximum interval; both at least every
+ * MultiplexerOptions::maxInterval to poll their sockets. Waiting instances are entries in a timer
+ * queue and occupy no thread. An instance is never iterated by two threads at the same time, but
+ * consecutive iterations may run on different worker threads.
+ *
+ * The instances must outlive their registration; remove them (or destroy the multiplexer) before
+ * they are destroyed. Use wake to iterate an instance immediately, e.g. after posting work.
+ * @code
+ * std::vector<std::unique_ptr<Server>> devices;  // e.g. 40 virtual devices
+ * Multiplexer multiplexer({4});
+ * for (uint16_t port = 4840; port < 4880; ++port) {
+ *     multiplexer.add(*devices.emplace_back(std::make_unique<Server>(port)));
+ * }
+ * @endcode
+ */
+class Multiplexer {
+public:
+    explicit Multiplexer(MultiplexerOptions options = {});
+
+    /// Stop and join the worker threads. The instances are not stopped.
+    ~Multiplexer();
+
+    Multiplexer(const Multiplexer&) = delete;
+    Multiplexer(Multiplexer&&) noexcept = delete;
+    Multiplexer& operator=(const Multiplexer&) = delete;
+    Multiplexer& operator=(Multiplexer&&) noexcept = delete;
+
+    /// Add a server, the first iteration starts it (Server::runIterate).
+    /// Do not call Server::run of multiplexed servers.
+    void add(Server& server);
+    /// Add a connected client.
+    /// Do not call Client::run or Client::runInBackground of multiplexed clients.
+    void add(Client& client);
+
+    /// Remove a server. Blocks until a running iteration of the server is completed, unless called
+    /// from within the iteration (e.g. a callback of the server).
+    void remove(Server& server);
+    /// Remove a client.
+    /// Blocks until a running iteration of the client is completed, unless called from within the
+    /// iteration (e.g. a callback of the client).
+    void remove(Client& client);
+
+    /// Iterate an instance as soon as possible.
+    void wake(Server& server);
+    /// @copydoc wake(Server&)
+    void wake(Client& client);
+
+    /// Number of registered instances.
+    size_t size() const;
+
+    /// Number of worker threads.
+    size_t threadCount() const noexcept {
+        return threads_.size();
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Entry {
+        const void* instance{};
+        std::function<Clock::duration()> iterate;  // returns the wait interval
+        uint64_t generation{0};  // invalidates outdated schedules
+        bool busy{false};
+        bool removed{false};
+        std::thread::id worker;
+    };
+
+    struct Schedule {
+        Clock::time_point due;
+        Entry* entry;
+        uint64_t generation;
+
+        bool operator>(const Schedule& other) const noexcept {
+            return due > other.due;
+        }
+    };
+
+    void add(const void* instance, std::function<Clock::duration()> iterate);
+    void remove(const void* instance);
+    void wake(const void* instance);
+    void schedule(Entry& entry, Clock::time_point due);
+    void erase(Entry& entry);
+    void work();
+
+    MultiplexerOptions options_;
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;  // schedule changed or stop
+    std::condition_variable idle_;  // iteration completed
+    bool stop_{false};
+    std::unordered_map<const void*, std::unique_ptr<Entry>> entries_;
+    std::vector<Schedule> queue_;  // min-heap by due time
+    std::vector<std::thread> threads_;
+};
+
+}  // namespace opcua
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua {
+
+/**
+ * Immutable table of namespace URIs with constant time lookup of namespace indices.
+ *
+ * Get the cached table of a server or client with Server::getNamespaceTable or
+ * Client::getNamespaceTable. Namespaces of a server are only appended, never removed. Indices found
+ * in a table therefore stay valid until the client connects to another server (or a restarted
+ * server).
+ */
+class NamespaceTable {
+public:
+    NamespaceTable() = default;
+
+    /// Create table from the namespace array (`Server_NamespaceArray`).
+    explicit NamespaceTable(std::vector<std::string> uris);
+
+    ~NamespaceTable() = default;
+
+    NamespaceTable(const NamespaceTable& other);
+    NamespaceTable(NamespaceTable&& other) noexcept = default;
+    NamespaceTable& operator=(const NamespaceTable& other);
+    NamespaceTable& operator=(NamespaceTable&& other) noexcept = default;
+
+    /// Number of namespaces.
+    size_t size() const noexcept {
+        return uris_.size();
+    }
+
+    bool empty() const noexcept {
+        return uris_.empty();
+    }
+
+    /// Get all namespace URIs, ordered by namespace index.
+    const std::vector<std::string>& getUris() const noexcept {
+        return uris_;
+    }
+
+    /// Get the namespace URI of the index.
+    /// @exception std::out_of_range If the index is unknown
+    const std::string& getUri(uint16_t namespaceIndex) const {
+        return uris_.at(namespaceIndex);
+    }
+
+    /// Find the namespace index of the URI.
+    /// @return Namespace index or `std::nullopt` if the URI is unknown
+    std::optional<uint16_t> find(std::string_view uri) const noexcept;
+
+    /// Resolve a local ExpandedNodeId with namespace URI (`nsu=`) to a NodeId.
+    /// ExpandedNodeIds without namespace URI are returned as is.
+    /// @return NodeId or `std::nullopt` if the URI is unknown or the node id is not local
+    std::optional<NodeId> resolve(const ExpandedNodeId& id) const;
+
+private:
+    void buildIndex();
+
+    std::vector<std::string> uris_;
+    std::unordered_map<std::string_view, uint16_t> index_;  // views of uris_
+};
+
+}  // namespace opcua
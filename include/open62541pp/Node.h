@@ -2,7 +2,8 @@
 
 #include <cstdint>
 #include <string_view>
-#include <utility>  // move
+#include <type_traits>  // enable_if_t, is_function_v
+#include <utility>  // forward, move, pair
 #include <vector>
 
 #include "open62541pp/Bitmask.h"
@@ -10,13 +11,13 @@
 #include "open62541pp/Config.h"
 #include "open62541pp/NodeIds.h"
 #include "open62541pp/Span.h"
-#include "open62541pp/TypeRegistry.h"  // getDataType
 #include "open62541pp/TypeWrapper.h"  // asWrapper
 #include "open62541pp/open62541.h"
 #include "open62541pp/services/Attribute.h"
 #include "open62541pp/services/Method.h"
 #include "open62541pp/services/NodeManagement.h"
 #include "open62541pp/services/View.h"
+#include "open62541pp/typeregistry/Builtin.h"  // getDataType
 #include "open62541pp/types/Builtin.h"
 #include "open62541pp/types/Composed.h"
 #include "open62541pp/types/DataValue.h"
@@ -145,6 +146,36 @@ public:
         );
         return {connection_, resultingId};
     }
+
+    /// Add method with a typed callback.
+    /// The arguments are derived from the signature, e.g. `double(int32_t, std::string_view)`.
+    /// @see services::addMethod
+    template <
+        typename Signature,
+        typename F,
+        typename = std::enable_if_t<std::is_function_v<Signature>>>
+    Node addMethod(
+        const NodeId& id,
+        std::string_view browseName,
+        F&& callback,
+        Span<const std::string_view> inputNames = {},
+        std::string_view outputName = "result",
+        const MethodAttributes& attributes = {},
+        const NodeId& referenceType = ReferenceTypeId::HasComponent
+    ) {
+        NodeId resultingId = services::addMethod<Signature>(
+            connection_,
+            nodeId_,
+            id,
+            browseName,
+            std::forward<F>(callback),
+            inputNames,
+            outputName,
+            attributes,
+            referenceType
+        );
+        return {connection_, resultingId};
+    }
 #endif
 
     /// @copydoc services::addObjectType
@@ -302,6 +333,31 @@ public:
         return browseReferencedNodes(BrowseDirection::Forward, referenceType, true, nodeClassMask);
     }
 
+    /// Browse child nodes together with their attributes (only local nodes).
+    /// The node class, browse name and display name are part of the browse results, additional
+    /// attributes of all children are fetched with a single Read request.
+    /// @see services::browseWithAttributes
+    std::vector<std::pair<Node, services::BrowsedNode>> browseChildrenWith(
+        Span<const AttributeId> attributeIds,
+        const NodeId& referenceType = ReferenceTypeId::HierarchicalReferences,
+        Bitmask<NodeClass> nodeClassMask = NodeClass::Unspecified
+    ) {
+        auto browsed = services::browseWithAttributes(
+            connection_,
+            BrowseDescription(
+                nodeId_, BrowseDirection::Forward, referenceType, true, nodeClassMask
+            ),
+            attributeIds
+        );
+        std::vector<std::pair<Node, services::BrowsedNode>> children;
+        children.reserve(browsed.size());
+        for (auto&& child : browsed) {
+            Node node(connection_, child.attributes.nodeId);
+            children.emplace_back(std::move(node), std::move(child));
+        }
+        return children;
+    }
+
     /// Browse child node specified by its relative path from this node (only local nodes).
     /// The relative path is specified using browse names.
     /// @exception BadStatus (BadNoMatch) If path not found
@@ -462,6 +518,12 @@ public:
         return services::readUserExecutable(connection_, nodeId_);
     }
 
+    /// Read multiple attributes in a single request.
+    /// @see services::readAttributes
+    services::NodeAttributesSnapshot readAttributes(Span<const AttributeId> attributeIds) {
+        return services::readAttributes(connection_, nodeId_, attributeIds);
+    }
+
     /// Read the value of an object property.
     /// @param propertyName Browse name of the property (variable node)
     Variant readObjectProperty(const QualifiedName& propertyName) {
@@ -0,0 +1,217 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string_view>
+#include <utility>  // move
+#include <vector>
+
+#include "open62541pp/Common.h"  // NodeClass
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/Composed.h"
+#include "open62541pp/types/ExtensionObject.h"
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua {
+
+// forward declaration
+class Client;
+class Server;
+
+/**
+ * Options of NodeBatch.
+ */
+struct NodeBatchOptions {
+    /// Let the server assign the node ids (client only).
+    /// The node ids passed to the batch are local handles to refer to nodes of the batch, e.g. as
+    /// parent or in references. Only their namespace index is requested (`ns=<index>;i=0`).
+    bool assignNodeIds = false;
+};
+
+/**
+ * Builder to add many nodes and references in a single operation.
+ *
+ * Folders, objects, variables and references are collected in the batch and added with commit().
+ * Nodes of the batch may be added in any order, e.g. children before their parents. With
+ * `NodeBatch<Server>`, all nodes are added first with deferred type checks
+ * (`UA_Server_addNode_begin`), then the references are inserted and finally the constraints are
+ * validated once for all nodes (`UA_Server_addNode_finish`, types first). If any node or
+ * reference can not be added, the batch is rolled back: all nodes and references added by the
+ * batch are removed again.
+ *
+ * With `NodeBatch<Client>`, the nodes are added with AddNodes requests level by level: nodes
+ * whose parent is part of the batch are sent after the response of their parent, with the node id
+ * the server returned for the parent. Each level is split into chunks by the server's operation
+ * limit `MaxNodesPerNodeManagement` (1000 nodes if unlimited), up to four chunks are sent at a
+ * time. References are added last with AddReferences requests. Nodes added before a failure are
+ * not removed.
+ *
+ * @code
+ * NodeBatch batch(server);
+ * batch.addFolder(ObjectId::ObjectsFolder, {1, 1000}, "Devices")
+ *     .addObject({1, 1000}, {1, 1001}, "Device")
+ *     .addVariable({1, 1001}, {1, 1002}, "Temperature");
+ * batch.commit();
+ * @endcode
+ *
+ * @tparam ServerOrClient Server or Client
+ */
+template <typename ServerOrClient>
+class NodeBatch {
+public:
+    /// Create an empty batch for the server/client.
+    explicit NodeBatch(ServerOrClient& connection, NodeBatchOptions options = {})
+        : connection_(connection),
+          options_(options) {}
+
+    /// Add folder (object of type `FolderType`).
+    NodeBatch& addFolder(
+        const NodeId& parentId,
+        const NodeId& id,
+        std::string_view browseName,
+        const ObjectAttributes& attributes = {},
+        const NodeId& referenceType = ReferenceTypeId::HasComponent
+    ) {
+        return addObject(
+            parentId, id, browseName, attributes, ObjectTypeId::FolderType, referenceType
+        );
+    }
+
+    /// Add object.
+    NodeBatch& addObject(
+        const NodeId& parentId,
+        const NodeId& id,
+        std::string_view browseName,
+        const ObjectAttributes& attributes = {},
+        const NodeId& objectType = ObjectTypeId::BaseObjectType,
+        const NodeId& referenceType = ReferenceTypeId::HasComponent
+    ) {
+        return addNode(
+            NodeClass::Object,
+            parentId,
+            id,
+            browseName,
+            ExtensionObject::fromDecodedCopy(attributes),
+            objectType,
+            referenceType
+        );
+    }
+
+    /// Add variable.
+    NodeBatch& addVariable(
+        const NodeId& parentId,
+        const NodeId& id,
+        std::string_view browseName,
+        const VariableAttributes& attributes = {},
+        const NodeId& variableType = VariableTypeId::BaseDataVariableType,
+        const NodeId& referenceType = ReferenceTypeId::HasComponent
+    ) {
+        return addNode(
+            NodeClass::Variable,
+            parentId,
+            id,
+            browseName,
+            ExtensionObject::fromDecodedCopy(attributes),
+            variableType,
+            referenceType
+        );
+    }
+
+    /// Add reference, source and target may be nodes of the batch or existing nodes.
+    NodeBatch& addReference(
+        const NodeId& sourceId,
+        const NodeId& targetId,
+        const NodeId& referenceType,
+        bool forward = true
+    ) {
+        references_.emplace_back(
+            sourceId,
+            referenceType,
+            forward,
+            std::string_view{},
+            ExpandedNodeId(targetId),
+            NodeClass::Unspecified
+        );
+        return *this;
+    }
+
+    /**
+     * Add all collected nodes and references.
+     * The batch is empty afterwards, even if the commit failed.
+     * @return Node ids of the added nodes, in the order the nodes were added to the batch
+     * @exception BadStatus (BadNodeIdInvalid) If a node of the batch has no node id
+     * @exception BadStatus (BadNotSupported) If `assignNodeIds` is used with `NodeBatch<Server>`
+     * @exception BadStatus If a node or reference can not be added. The status code of the first
+     *            failure is thrown (after the rollback with `NodeBatch<Server>`).
+     */
+    std::vector<NodeId> commit();
+
+    /**
+     * Asynchronously add all collected nodes and references (client only).
+     * The requests are sent and processed in the client's event loop, use this function with a
+     * client running in a background network thread.
+     * @copydetails commit
+     * @param onComplete Callback invoked once with the status of the first failure (or good) and
+     *        the node ids of the added nodes (null if not added)
+     */
+    void commitAsync(std::function<void(StatusCode status, std::vector<NodeId>& ids)> onComplete);
+
+    /// Number of collected nodes.
+    size_t nodeCount() const noexcept {
+        return nodes_.size();
+    }
+
+    /// Number of collected references (besides the parent references of the nodes).
+    size_t referenceCount() const noexcept {
+        return references_.size();
+    }
+
+    /// Discard all collected nodes and references.
+    void clear() noexcept {
+        nodes_.clear();
+        references_.clear();
+    }
+
+private:
+    NodeBatch& addNode(
+        NodeClass nodeClass,
+        const NodeId& parentId,
+        const NodeId& id,
+        std::string_view browseName,
+        ExtensionObject attributes,
+        const NodeId& typeDefinition,
+        const NodeId& referenceType
+    ) {
+        nodes_.emplace_back(
+            ExpandedNodeId(parentId),
+            referenceType,
+            ExpandedNodeId(id),
+            QualifiedName(id.getNamespaceIndex(), browseName),
+            nodeClass,
+            std::move(attributes),
+            ExpandedNodeId(typeDefinition)
+        );
+        return *this;
+    }
+
+    ServerOrClient& connection_;
+    NodeBatchOptions options_;
+    std::vector<AddNodesItem> nodes_;
+    std::vector<AddReferencesItem> references_;
+};
+
+/* ---------------------------------------------------------------------------------------------- */
+
+template <>
+std::vector<NodeId> NodeBatch<Server>::commit();
+
+template <>
+std::vector<NodeId> NodeBatch<Client>::commit();
+
+template <>
+void NodeBatch<Client>::commitAsync(
+    std::function<void(StatusCode status, std::vector<NodeId>& ids)> onComplete
+);
+
+}  // namespace opcua
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>  // hash
+#include <mutex>
+#include <string_view>
+#include <unordered_set>
+
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua {
+
+/**
+ * Handle to a NodeId interned by a NodeIdPool.
+ *
+ * The handle is a trivially copyable pointer to the pooled NodeId with a cached hash value.
+ * It can be passed to every function expecting a `const NodeId&` without copy.
+ * The handle must not outlive its pool.
+ */
+class InternedNodeId {
+public:
+    /// Get the interned NodeId.
+    const NodeId& get() const noexcept {
+        return *id_;
+    }
+
+    /// Implicit conversion to NodeId.
+    operator const NodeId&() const noexcept {  // NOLINT, implicit wanted
+        return *id_;
+    }
+
+    /// Return the cached NodeId::hash value.
+    uint32_t hash() const noexcept {
+        return hash_;
+    }
+
+    /// Handles of the same pool are compared by address, others by value.
+    friend bool operator==(InternedNodeId lhs, InternedNodeId rhs) noexcept {
+        return lhs.id_ == rhs.id_ || (lhs.hash_ == rhs.hash_ && *lhs.id_ == *rhs.id_);
+    }
+
+    friend bool operator!=(InternedNodeId lhs, InternedNodeId rhs) noexcept {
+        return !(lhs == rhs);
+    }
+
+private:
+    friend class NodeIdPool;
+
+    InternedNodeId(const NodeId& id, uint32_t hash) noexcept
+        : id_(&id),
+          hash_(hash) {}
+
+    const NodeId* id_;
+    uint32_t hash_;
+};
+
+/**
+ * Pool of unique NodeIds.
+ *
+ * Equal NodeIds are stored only once, all handles share the same immutable identifier buffer.
+ * Useful for large address spaces with many string identified nodes, that are frequently copied,
+ * compared and hashed. Interning is thread-safe. Pooled NodeIds are never removed.
+ */
+class NodeIdPool {
+public:
+    /// Intern NodeId, a copy is only created if it is not pooled yet.
+    InternedNodeId intern(const NodeId& id);
+
+    /// Intern NodeId with String identifier, a copy is only created if it is not pooled yet.
+    InternedNodeId intern(uint16_t namespaceIndex, std::string_view identifier);
+
+    /// Number of pooled NodeIds.
+    size_t size() const;
+
+private:
+    mutable std::mutex mutex_;
+    std::unordered_set<NodeId> ids_;
+};
+
+}  // namespace opcua
+
+/* ---------------------------------- std::hash specializations --------------------------------- */
+
+template <>
+struct std::hash<opcua::InternedNodeId> {
+    std::size_t operator()(const opcua::InternedNodeId& id) const noexcept {
+        return id.hash();
+    }
+};
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <utility>  // pair
+#include <vector>
+
+#include "open62541pp/types/Builtin.h"  // StatusCode, fs
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua {
+
+// forward declaration
+class Server;
+
+/**
+ * Result of importNodeSet.
+ */
+struct NodeSetImportResult {
+    /// Number of added nodes.
+    size_t nodes{0};
+    /// Number of added references, besides the parent and type definition references.
+    size_t references{0};
+    /// Nodes that could not be added (or finished) and values that could not be decoded.
+    /// Nodes with undecodable values (`BadDataEncodingUnsupported`) are added without value.
+    std::vector<std::pair<NodeId, StatusCode>> errors;
+};
+
+/**
+ * Import an information model from a NodeSet2 XML document at runtime.
+ *
+ * The document is parsed with a streaming XML reader, without building a document tree. Namespace
+ * URIs of the nodeset are registered and the namespace indices of the nodeset are mapped to the
+ * server's indices, aliases are resolved while parsing. Parent, type definition and other
+ * references are resolved in a second pass over all parsed nodes.
+ *
+ * The nodes are inserted in bulk in dependency order (parents, types and reference types first):
+ * first all nodes are added with their hierarchical parent reference and type definition
+ * (`UA_Server_addNode_begin`), then the remaining references are added. Type checks, constructors
+ * and the instantiation of mandatory children are deferred until all nodes and references exist
+ * (`UA_Server_addNode_finish`).
+ *
+ * Supported values are scalars and arrays (`ListOf...`) of builtin types, enumerations and
+ * extension objects with a structure body of the types known by open62541 (e.g. `Argument`,
+ * `Range`, `EUInformation`). Structure bodies require open62541 built with
+ * `UA_ENABLE_TYPEDESCRIPTION`.
+ *
+ * @param server Instance of type Server
+ * @param xml NodeSet2 XML document
+ * @exception BadStatus (BadDecodingError) If the document is not a well-formed NodeSet2 document
+ * @note Nodes already existing in the server are reported with `BadNodeIdExists`, their references
+ * are added anyway.
+ */
+NodeSetImportResult importNodeSet(Server& server, std::string_view xml);
+
+/**
+ * Import an information model from a NodeSet2 XML file at runtime.
+ * @copydetails importNodeSet
+ * @param filepath Path of the NodeSet2 XML file
+ * @exception BadStatus (BadResourceUnavailable) If the file can not be read
+ */
+NodeSetImportResult importNodeSetFile(Server& server, const fs::path& filepath);
+
+}  // namespace opcua
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstdint>
+
+#include "open62541pp/Bitmask.h"
+#include "open62541pp/Common.h"
+#include "open62541pp/Config.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/NodeId.h"
+#include "open62541pp/types/Variant.h"
+
+#ifdef UAPP_HAS_BORROWED_NODESTORE
+
+namespace opcua {
+
+// forward declaration
+class Server;
+
+/**
+ * Read-only view of a node of the server's node store (server only).
+ *
+ * The node is looked up once in the node store (`UA_Nodestore::getNode`) and borrowed for the
+ * lifetime of the view. All attributes are returned as references into the native node without
+ * copy and without the service layer, that creates a Read request per attribute. Use the view
+ * for in-process logic that evaluates many attributes of a node.
+ *
+ * The view must not outlive the server. Writes to the node (e.g. with Node::writeDisplayName)
+ * replace the stored node, the view still refers to the borrowed version. Keep views short-lived
+ * and do not write to the node while a view exists.
+ *
+ * Attributes that are not defined for the node class throw BadStatus (BadAttributeIdInvalid).
+ *
+ * @note Only available with open62541 v1.2/v1.3 without `UA_MULTITHREADING`
+ *       (`UAPP_HAS_BORROWED_NODESTORE`), the node store API changed in v1.4.
+ *
+ * @code
+ * NodeView view(server, {1, 1000});
+ * if (view.getNodeClass() == NodeClass::Variable && view.getDataType() == DataTypeId::Double) {
+ *     std::cout << view.getDisplayName().getText() << std::endl;
+ * }
+ * @endcode
+ */
+class NodeView {
+public:
+    /**
+     * Look up and borrow the node.
+     * @exception BadStatus (BadNodeIdUnknown) If the node does not exist
+     */
+    NodeView(Server& server, const NodeId& id);
+
+    ~NodeView();
+
+    NodeView(const NodeView&) = delete;
+    NodeView(NodeView&& other) noexcept;
+    NodeView& operator=(const NodeView&) = delete;
+    NodeView& operator=(NodeView&& other) noexcept;
+
+    /// @copydoc AttributeId::NodeId
+    const NodeId& getNodeId() const noexcept;
+    /// @copydoc AttributeId::NodeClass
+    NodeClass getNodeClass() const noexcept;
+    /// @copydoc AttributeId::BrowseName
+    const QualifiedName& getBrowseName() const noexcept;
+    /// @copydoc AttributeId::DisplayName
+    const LocalizedText& getDisplayName() const noexcept;
+    /// @copydoc AttributeId::Description
+    const LocalizedText& getDescription() const noexcept;
+    /// @copydoc AttributeId::WriteMask
+    Bitmask<WriteMask> getWriteMask() const noexcept;
+
+    /// @copydoc AttributeId::IsAbstract
+    bool getIsAbstract() const;
+    /// @copydoc AttributeId::Symmetric
+    bool getSymmetric() const;
+    /// @copydoc AttributeId::InverseName
+    const LocalizedText& getInverseName() const;
+    /// @copydoc AttributeId::ContainsNoLoops
+    bool getContainsNoLoops() const;
+    /// @copydoc AttributeId::EventNotifier
+    Bitmask<EventNotifier> getEventNotifier() const;
+
+    /**
+     * @copydoc AttributeId::Value
+     * Only stored values are accessible, values of data sources and variables with value
+     * callbacks (`onBeforeRead`) throw BadStatus (BadNotReadable). Use services::readValue
+     * instead.
+     */
+    const Variant& getValue() const;
+    /// @copydoc AttributeId::DataType
+    const NodeId& getDataType() const;
+    /// @copydoc AttributeId::ValueRank
+    ValueRank getValueRank() const;
+    /// @copydoc AttributeId::ArrayDimensions
+    Span<const uint32_t> getArrayDimensions() const;
+    /// @copydoc AttributeId::AccessLevel
+    Bitmask<AccessLevel> getAccessLevel() const;
+    /// @copydoc AttributeId::MinimumSamplingInterval
+    double getMinimumSamplingInterval() const;
+    /// @copydoc AttributeId::Historizing
+    bool getHistorizing() const;
+
+    /// @copydoc AttributeId::Executable
+    bool getExecutable() const;
+
+private:
+    void release() noexcept;
+
+    Server* server_;
+    const void* node_;  // const UA_Node*
+};
+
+}  // namespace opcua
+
+#endif
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+
+#include "open62541pp/Config.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/detail/BoundedQueue.h"
+#include "open62541pp/services/Subscription.h"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+namespace opcua {
+
+/**
+ * Behaviour of the NotificationQueue if the queue is full.
+ */
+enum class QueueOverflow {
+    DropOldest,  ///< Discard the oldest queued notification
+    DropNewest,  ///< Discard the new notification
+    Block,  ///< Wait until the consumer pops a notification (blocks the client loop)
+};
+
+/**
+ * Bounded, lock-free queue to hand over data change notifications to a consumer thread.
+ *
+ * The queue is used as the batched data change callback of a subscription (see sink).
+ * Notifications are moved into preallocated slots without copying the values; the client loop is
+ * never blocked by the consumer (except with QueueOverflow::Block).
+ * The producer is the thread running the client loop, a single consumer thread drains the queue.
+ * The queue must outlive the subscription.
+ * @code
+ * NotificationQueue queue(10000, QueueOverflow::DropOldest);
+ * auto sub = client.createSubscription(parameters, queue.sink());
+ * ...
+ * // consumer thread
+ * queue.drain([](services::MonitoredItemNotification& notification) { ... });
+ * @endcode
+ */
+class NotificationQueue {
+public:
+    using Notification = services::MonitoredItemNotification;
+
+    /// Create queue with at least `capacity` slots (rounded up to the next power of two).
+    explicit NotificationQueue(size_t capacity, QueueOverflow overflow = QueueOverflow::DropNewest);
+
+    /// Get batched data change callback that moves the notifications into the queue.
+    services::DataChangeBatchCallback sink();
+
+    /// Push notification (producer thread only).
+    /// @return `false` if a notification was dropped
+    bool push(Notification& notification);
+
+    /// Pop notification (consumer thread only).
+    std::optional<Notification> pop();
+
+    /// Pop up to `maxCount` notifications and invoke `func(notification)` for each of them
+    /// (consumer thread only).
+    /// @return Number of popped notifications
+    template <typename Func>
+    size_t drain(Func&& func, size_t maxCount = std::numeric_limits<size_t>::max()) {
+        size_t count = 0;
+        while (count < maxCount) {
+            auto notification = queue_.tryPop();
+            if (!notification.has_value()) {
+                break;
+            }
+            func(*notification);
+            ++count;
+        }
+        return count;
+    }
+
+    /// Maximum number of queued notifications.
+    size_t capacity() const noexcept {
+        return queue_.capacity();
+    }
+
+    /// Approximate number of queued notifications.
+    size_t size() const noexcept {
+        return queue_.size();
+    }
+
+    /// Number of dropped notifications due to overflows.
+    size_t droppedCount() const noexcept {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+private:
+    detail::BoundedQueue<Notification> queue_;
+    QueueOverflow overflow_;
+    std::atomic<size_t> dropped_{0};
+};
+
+}  // namespace opcua
+
+#endif
@@ -0,0 +1,157 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+#include "open62541pp/Config.h"
+#include "open62541pp/Subscription.h"  // DataChangeCallback, DataChangeBatchCallback
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+namespace opcua {
+
+// forward declarations
+class Client;
+class DataValue;
+
+namespace detail {
+struct RecordingHeader;
+}  // namespace detail
+
+/**
+ * Recorder of data change notifications into an append-only, memory-mapped file.
+ *
+ * Each notification is stored with its subscription and monitored item identifiers and the
+ * receive time as a binary encoded DataValue. The values are encoded directly into the mapping,
+ * the file grows geometrically. The header (size and number of records) is updated after each
+ * record, so the recording stays readable if the process crashes.
+ *
+ * Install the recorder by wrapping the callbacks of the monitored items:
+ * @code
+ * NotificationRecorder recorder("notifications.rec");
+ * auto onDataChange = [](const MonitoredItem<Client>& item, const DataValue& dv) {
+ *     // ...
+ * };
+ * sub.subscribeDataChange(id, AttributeId::Value, recorder.wrap(onDataChange));
+ * @endcode
+ * The recorder must outlive the subscriptions. Recordings are replayed with NotificationReplayer.
+ *
+ * @note Binary encoding is only supported since open62541 v1.3.
+ * @note Memory-mapped files are only supported on POSIX systems.
+ */
+class NotificationRecorder {
+public:
+    /// Create a recording or reopen an existing recording to append notifications.
+    /// @param path File of the recording
+    /// @param capacity Initial file size in bytes
+    /// @exception BadStatus (BadInvalidState) If an existing file is not a valid recording
+    /// @exception BadStatus (BadNotSupported) If memory-mapped files are not supported
+    /// @exception BadStatus (BadResourceUnavailable) If the file can not be mapped
+    explicit NotificationRecorder(const std::string& path, size_t capacity = 16 * 1024 * 1024);
+
+    /// Close the recording, the file is truncated to the recorded size.
+    ~NotificationRecorder();
+
+    NotificationRecorder(const NotificationRecorder&) = delete;
+    NotificationRecorder(NotificationRecorder&&) noexcept = delete;
+    NotificationRecorder& operator=(const NotificationRecorder&) = delete;
+    NotificationRecorder& operator=(NotificationRecorder&&) noexcept = delete;
+
+    /// Append a notification, thread-safe.
+    /// @exception BadStatus If the value can not be encoded or the file can not be grown
+    void record(uint32_t subscriptionId, uint32_t monitoredItemId, const DataValue& value);
+
+    /// Wrap a data change callback to record the notifications before they are forwarded.
+    /// @param callback Forwarded callback (optional)
+    DataChangeCallback<Client> wrap(DataChangeCallback<Client> callback = {});
+
+    /// Wrap a batched data change callback to record the notifications before they are forwarded.
+    /// @param callback Forwarded callback (optional)
+    DataChangeBatchCallback wrapBatch(DataChangeBatchCallback callback = {});
+
+    /// Number of recorded notifications.
+    size_t count() const;
+
+    /// Size of the recording in bytes.
+    size_t size() const;
+
+    /// Flush the recording to disk.
+    void flush();
+
+private:
+    void recordImpl(uint32_t subscriptionId, uint32_t monitoredItemId, const DataValue& value);
+    void resize(size_t size);
+    void close() noexcept;
+
+    mutable std::mutex mutex_;
+    int fd_{-1};
+    void* mapping_{nullptr};
+    size_t mappingSize_{0};
+    detail::RecordingHeader* header_{nullptr};
+    bool owned_{false};  // header written or validated, the file is truncated on close
+};
+
+/**
+ * Options of NotificationReplayer::replay.
+ */
+struct ReplayOptions {
+    /// Replay speed relative to the recorded timing, e.g. `1.0` for the original timing and `10.0`
+    /// for a ten times faster replay. A speed of `0` replays the notifications as fast as possible.
+    double speed = 0.0;
+};
+
+/**
+ * Replayer of recordings of NotificationRecorder.
+ *
+ * The recording is memory-mapped read-only and the notifications are fed back through the
+ * DataChangeCallback API. The callbacks receive MonitoredItem handles with the recorded
+ * subscription and monitored item identifiers of the given client; the client does not need to be
+ * connected unless the handles are used to call services.
+ * A single DataValue is reused for all notifications.
+ * @code
+ * NotificationReplayer replayer("notifications.rec");
+ * replayer.replay(client, [](const MonitoredItem<Client>& item, const DataValue& dv) {
+ *     // ...
+ * }, {1.0});
+ * @endcode
+ *
+ * @note Binary decoding is only supported since open62541 v1.3.
+ * @note Memory-mapped files are only supported on POSIX systems.
+ */
+class NotificationReplayer {
+public:
+    /// Open a recording.
+    /// @exception BadStatus (BadInvalidState) If the file is not a valid recording
+    /// @exception BadStatus (BadNotSupported) If memory-mapped files are not supported
+    /// @exception BadStatus (BadResourceUnavailable) If the file can not be opened or mapped
+    explicit NotificationReplayer(const std::string& path);
+    ~NotificationReplayer();
+
+    NotificationReplayer(const NotificationReplayer&) = delete;
+    NotificationReplayer(NotificationReplayer&&) noexcept = delete;
+    NotificationReplayer& operator=(const NotificationReplayer&) = delete;
+    NotificationReplayer& operator=(NotificationReplayer&&) noexcept = delete;
+
+    /// Number of recorded notifications.
+    size_t count() const noexcept;
+
+    /// Replay all notifications in recorded order, blocks until the replay is finished.
+    /// @return Number of replayed notifications
+    /// @exception BadStatus If a notification can not be decoded
+    size_t replay(
+        Client& client,
+        const DataChangeCallback<Client>& callback,
+        const ReplayOptions& options = {}
+    ) const;
+
+private:
+    void* mapping_{nullptr};
+    size_t mappingSize_{0};
+    const detail::RecordingHeader* header_{nullptr};
+};
+
+}  // namespace opcua
+
+#endif
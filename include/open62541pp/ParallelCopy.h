@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+
+namespace opcua {
+
+/**
+ * Copy and clear large arrays of structured types in parallel (process-wide, disabled by default).
+ *
+ * Deep copies and destruction of huge objects, e.g. a ReadResponse with millions of DataValues, a
+ * BrowseResult with millions of references or a Variant array of structures, run in the calling
+ * thread and may block the event loop for hundreds of milliseconds. With parallel copy enabled,
+ * arrays with at least `minElements` elements are split into chunks, that are processed by a
+ * worker pool and the calling thread. This applies to the deep copies and destruction of wrapper
+ * types (TypeWrapper), their array members, Variant arrays (Variant::setArrayCopy) and data values.
+ * Arrays of pointer-free types (e.g. numbers) are copied with memcpy and not affected.
+ *
+ * The worker pool is shared with the crypto offload (Server::setAsymmetricCryptoOffload) and grows
+ * to the largest requested size.
+ * @param threads Number of worker threads, 0 disables the parallel copy
+ * @param minElements Minimum number of array elements that are processed in parallel
+ */
+void setParallelCopy(size_t threads, size_t minElements = 10000);
+
+}  // namespace opcua
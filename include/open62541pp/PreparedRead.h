@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "open62541pp/Common.h"  // TimestampsToReturn
+#include "open62541pp/Span.h"
+#include "open62541pp/open62541.h"
+#include "open62541pp/types/Composed.h"
+#include "open62541pp/types/DataValue.h"
+
+namespace opcua {
+
+// forward declaration
+class Client;
+
+/**
+ * Prepared read request for cyclic reads of the same items.
+ *
+ * The request is built once from the items and sent with services::read on each execute (split
+ * into chunks if it exceeds the server's operation limit `MaxNodesPerRead`). The results are kept
+ * in a stable array: if a value has the same pointer-free type and array length as in the
+ * previous cycle, the new data is copied into the existing buffer. Otherwise the decoded value
+ * is moved into the array. Pointers to the results and their data remain valid across cycles
+ * with stable types.
+ * @code
+ * PreparedRead read(client, items);  // 5k items
+ * while (running) {
+ *     read.execute();
+ *     process(read.results());
+ *     std::this_thread::sleep_for(100ms);
+ * }
+ * @endcode
+ */
+class PreparedRead {
+public:
+    /**
+     * @param client Connected client, must outlive the prepared read
+     * @param items Items to read, copied once
+     * @param timestamps Timestamps to return
+     */
+    PreparedRead(
+        Client& client,
+        Span<const ReadValueId> items,
+        TimestampsToReturn timestamps = TimestampsToReturn::Neither
+    );
+
+    PreparedRead(const PreparedRead&) = delete;
+    PreparedRead(PreparedRead&&) noexcept = delete;
+    PreparedRead& operator=(const PreparedRead&) = delete;
+    PreparedRead& operator=(PreparedRead&&) noexcept = delete;
+
+    ~PreparedRead() = default;
+
+    /**
+     * Send the request and refresh the results.
+     * Bad status codes of single items are stored in the results.
+     * @exception BadStatus If the service failed, the results of the previous cycle are kept
+     */
+    void execute();
+
+    /// Number of items.
+    size_t size() const noexcept {
+        return items_.size();
+    }
+
+    /// Results of the last execution, in the order of the items.
+    Span<const DataValue> results() const noexcept {
+        return results_;
+    }
+
+    /// Get result by index.
+    const DataValue& operator[](size_t index) const noexcept {
+        return results_[index];
+    }
+
+    /// Number of results of the last execution that were refreshed in place (without moving).
+    size_t getInPlaceCount() const noexcept {
+        return inPlaceCount_;
+    }
+
+private:
+    Client& client_;
+    std::vector<ReadValueId> items_;
+    UA_ReadRequest request_{};  // references items_
+    std::vector<DataValue> results_;
+    size_t inPlaceCount_{0};
+};
+
+}  // namespace opcua
@@ -0,0 +1,299 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>  // move
+#include <vector>
+
+#include "open62541pp/Config.h"
+#include "open62541pp/typeregistry/Builtin.h"
+#include "open62541pp/types/NodeId.h"
+
+#ifdef UA_ENABLE_PUBSUB
+
+namespace opcua {
+
+// forward declaration
+class Server;
+class ValueSlot;
+
+/// Transport protocol mapping of a PubSub connection.
+enum class PubSubTransport {
+    /// UDP multicast/unicast with UADP encoding, address `opc.udp://<host>:<port>/`.
+    UdpUadp,
+    /// Ethernet with UADP encoding, address `opc.eth://<mac>[:<vid>.<pcp>]`.
+    /// Requires open62541 built with `UA_ENABLE_PUBSUB_ETH_UADP`.
+    EthernetUadp,
+};
+
+/// PubSub connection configuration.
+struct PubSubConnectionConfig {
+    std::string name;
+    PubSubTransport transport = PubSubTransport::UdpUadp;
+    std::string address;  ///< Network address, e.g. `opc.udp://224.0.0.22:4840/`
+    std::string networkInterface;  ///< Network interface (optional), e.g. `eth0`
+    uint16_t publisherId = 0;
+};
+
+/// Writer group configuration.
+struct WriterGroupConfig {
+    std::string name;
+    uint16_t writerGroupId = 0;
+    double publishingInterval = 1.0;  ///< Publishing interval in milliseconds
+
+    /**
+     * Fixed-size message layout with precomputed offsets (`UA_PUBSUB_RT_FIXED_SIZE`).
+     * The network message is encoded once when the group is started, every publish cycle only
+     * copies the field values into the encoded message, without Variant construction and
+     * encoding. All fields must be variable nodes with a ValueBackendExternal and a fixed-size
+     * data type (no strings, arrays or structures with variable length).
+     */
+    bool fixedSize = true;
+};
+
+/// Data set writer configuration, the published data set is created with the writer.
+struct DataSetWriterConfig {
+    std::string name;
+    uint16_t dataSetWriterId = 0;
+    std::vector<NodeId> fields;  ///< Published variable nodes, in order of the message layout
+};
+
+/// Reader group configuration.
+/// Reader groups decode fixed-size message layouts (`UA_PUBSUB_RT_FIXED_SIZE`) with precomputed
+/// offsets, the publishers must use fixed-size layouts as well (WriterGroupConfig::fixedSize).
+struct ReaderGroupConfig {
+    std::string name;
+};
+
+/**
+ * Field of a received data set with a fixed layout.
+ * The value is decoded directly into the target memory, without Variant construction and without
+ * writes to the address space.
+ */
+struct DataSetReaderField {
+    /// Decode into user memory, e.g. a member of a struct.
+    /// The memory must outlive the server (or the reader).
+    /// @param target Value in user memory
+    /// @param targetNodeId Optional variable node, bound to the target memory (external backend)
+    template <typename T>
+    static DataSetReaderField bind(T& target, NodeId targetNodeId = {}) {
+        return {&getDataType<T>(), &target, nullptr, std::move(targetNodeId)};
+    }
+
+    /// Decode into an internal buffer and publish the value to a slot of a ValueStore after every
+    /// received message.
+    static DataSetReaderField publish(const UA_DataType& dataType, ValueSlot& slot) {
+        return {&dataType, nullptr, &slot, {}};
+    }
+
+    const UA_DataType* dataType = nullptr;
+    void* target = nullptr;  ///< Target memory, an internal buffer is used if `nullptr`
+    ValueSlot* slot = nullptr;  ///< Slot to publish the value to (optional)
+    NodeId targetNodeId;  ///< Variable node bound to the target (optional)
+};
+
+/// Data set reader configuration.
+/// The reader receives the data set of the writer identified by publisher, writer group and data
+/// set writer id. The fields must match the published fields in order and data type.
+struct DataSetReaderConfig {
+    std::string name;
+    uint16_t publisherId = 0;
+    uint16_t writerGroupId = 0;
+    uint16_t dataSetWriterId = 0;
+    std::vector<DataSetReaderField> fields;
+
+    /// Called once per received message after all fields are decoded (in the server loop).
+    /// Replaces per-field value callbacks, e.g. to process the decoded struct as a whole.
+    std::function<void()> onMessage;
+};
+
+/**
+ * Data set writer of a writer group.
+ * Each writer publishes its own data set (published items) of variable nodes.
+ */
+class DataSetWriter {
+public:
+    DataSetWriter(Server& server, NodeId id, NodeId publishedDataSetId) noexcept;
+
+    Server& getServer() noexcept {
+        return *server_;
+    }
+
+    /// Get the identifier of the data set writer.
+    const NodeId& getId() const noexcept {
+        return id_;
+    }
+
+    /// Get the identifier of the published data set.
+    const NodeId& getPublishedDataSetId() const noexcept {
+        return publishedDataSetId_;
+    }
+
+    /// Remove the data set writer and its published data set.
+    /// The writer group must be stopped.
+    void remove();
+
+private:
+    Server* server_;
+    NodeId id_;
+    NodeId publishedDataSetId_;
+};
+
+/**
+ * Writer group of a PubSub connection.
+ * The data set writers are added while the group is stopped. Starting the group freezes the
+ * configuration; with WriterGroupConfig::fixedSize the message layout is precomputed.
+ */
+class WriterGroup {
+public:
+    WriterGroup(Server& server, NodeId id) noexcept;
+
+    Server& getServer() noexcept {
+        return *server_;
+    }
+
+    /// Get the identifier of the writer group.
+    const NodeId& getId() const noexcept {
+        return id_;
+    }
+
+    /// Add a data set writer with a new published data set of the configured fields.
+    /// @exception BadStatus If a field is not a variable node or the group is started
+    DataSetWriter addDataSetWriter(const DataSetWriterConfig& config);
+
+    /// Freeze the configuration and start publishing.
+    /// @exception BadStatus If a field of a fixed-size group has no ValueBackendExternal
+    void start();
+    /// Stop publishing and unfreeze the configuration.
+    void stop();
+
+    /// Remove the writer group and its data set writers.
+    void remove();
+
+private:
+    Server* server_;
+    NodeId id_;
+};
+
+/// Data set reader of a reader group.
+class DataSetReader {
+public:
+    DataSetReader(Server& server, NodeId id) noexcept;
+
+    Server& getServer() noexcept {
+        return *server_;
+    }
+
+    /// Get the identifier of the data set reader.
+    const NodeId& getId() const noexcept {
+        return id_;
+    }
+
+    /// Remove the data set reader. The reader group must be stopped.
+    void remove();
+
+private:
+    Server* server_;
+    NodeId id_;
+};
+
+/**
+ * Reader group of a PubSub connection.
+ * The data set readers are added while the group is stopped. Starting the group freezes the
+ * configuration and precomputes the offsets of the message layout.
+ */
+class ReaderGroup {
+public:
+    ReaderGroup(Server& server, NodeId id) noexcept;
+
+    Server& getServer() noexcept {
+        return *server_;
+    }
+
+    /// Get the identifier of the reader group.
+    const NodeId& getId() const noexcept {
+        return id_;
+    }
+
+    /**
+     * Add a data set reader with fields decoded directly into user memory or ValueStore slots.
+     * open62541 v1.3 supports a single data set reader per fixed-size reader group, add a reader
+     * group per subscribed writer group.
+     * @exception BadStatus If a field has no data type, a target node is not a variable node or
+     *            the group is started
+     */
+    DataSetReader addDataSetReader(const DataSetReaderConfig& config);
+
+    /// Freeze the configuration and start receiving.
+    void start();
+    /// Stop receiving and unfreeze the configuration.
+    void stop();
+
+    /// Remove the reader group and its data set readers.
+    void remove();
+
+private:
+    Server* server_;
+    NodeId id_;
+};
+
+/**
+ * PubSub connection to publish and receive data sets.
+ *
+ * Realtime publishers with fixed-size messages bind the published variables to user memory with
+ * ValueBackendExternal, each publish cycle only patches the values into the pre-encoded message:
+ * @code
+ * double position = 0.0;
+ * ValueBackendExternal backend(position);
+ * server.setVariableNodeValueBackend(positionId, backend);
+ *
+ * auto connection = server.addPubSubConnection({"Motion", PubSubTransport::UdpUadp,
+ *                                               "opc.udp://224.0.0.22:4840/", "", 1});
+ * auto group = connection.addWriterGroup({"Axes", 100, 1.0, true});  // 1 kHz
+ * group.addDataSetWriter({"Axis 1", 1, {positionId}});
+ * group.start();
+ * @endcode
+ *
+ * Subscribers decode received messages with fixed layouts directly into user memory and process
+ * each message with a single callback:
+ * @code
+ * struct Axis { double position; float velocity; } axis{};
+ * auto readers = connection.addReaderGroup({"Axes"});
+ * readers.addDataSetReader({"Axis 1", 1, 100, 1,
+ *                           {DataSetReaderField::bind(axis.position),
+ *                            DataSetReaderField::bind(axis.velocity)},
+ *                           [&] { control(axis); }});
+ * readers.start();
+ * @endcode
+ */
+class PubSubConnection {
+public:
+    PubSubConnection(Server& server, NodeId id) noexcept;
+
+    Server& getServer() noexcept {
+        return *server_;
+    }
+
+    /// Get the identifier of the connection.
+    const NodeId& getId() const noexcept {
+        return id_;
+    }
+
+    /// Add a writer group (stopped).
+    WriterGroup addWriterGroup(const WriterGroupConfig& config);
+
+    /// Add a reader group (stopped).
+    ReaderGroup addReaderGroup(const ReaderGroupConfig& config);
+
+    /// Remove the connection with all writer and reader groups.
+    void remove();
+
+private:
+    Server* server_;
+    NodeId id_;
+};
+
+}  // namespace opcua
+
+#endif
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>  // forward
+#include <vector>
+
+#include "open62541pp/Common.h"  // AttributeId, TimestampsToReturn
+#include "open62541pp/async.h"
+#include "open62541pp/open62541.h"
+#include "open62541pp/types/Builtin.h"  // StatusCode
+#include "open62541pp/types/Composed.h"  // ReadValueId
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua {
+
+// forward declaration
+class Client;
+
+/**
+ * Options of ReadCoalescer.
+ */
+struct ReadCoalescerOptions {
+    /// Time window to collect reads, starting with the first read of a batch.
+    std::chrono::milliseconds window{1};
+    /// Maximum number of reads per batch, flush immediately if reached (0: unlimited).
+    size_t maxBatchSize = 0;
+    /// Timestamps to return for all coalesced reads.
+    TimestampsToReturn timestamps = TimestampsToReturn::Neither;
+};
+
+/**
+ * Coalesce single-node reads of a client into batched read requests.
+ *
+ * Reads issued with readAttributeAsync within a time window (or until the maximum batch size is
+ * reached) are collected and sent with a single ReadRequest. The ReadResponse is split up again and
+ * each completion handler is invoked with its own DataValue and per-item status code.
+ * Batches are split into multiple requests to respect the server's `MaxNodesPerRead` limit.
+ *
+ * Pending reads are sent by Client::runIterate when the window has elapsed or explicitly with
+ * flush(). The coalescer must not outlive the client and, like the client, is not thread-safe.
+ * @code
+ * ReadCoalescer coalescer(client, {std::chrono::milliseconds(5), 500});
+ * for (const auto& id : ids) {
+ *     coalescer.readAttributeAsync(id, AttributeId::Value, [](StatusCode code, DataValue& dv) {
+ *         // ...
+ *     });
+ * }
+ * client.run();
+ * @endcode
+ */
+class ReadCoalescer {
+public:
+    /// Create coalescer for the client.
+    /// The server's `MaxNodesPerRead` operation limit is read once (if the client is connected).
+    explicit ReadCoalescer(Client& client, ReadCoalescerOptions options = {});
+
+    ~ReadCoalescer();
+
+    ReadCoalescer(const ReadCoalescer&) = delete;
+    ReadCoalescer(ReadCoalescer&&) noexcept = delete;
+    ReadCoalescer& operator=(const ReadCoalescer&) = delete;
+    ReadCoalescer& operator=(ReadCoalescer&&) noexcept = delete;
+
+    /**
+     * Asynchronously read node attribute, coalesced with other reads.
+     * @param id Node to read
+     * @param attributeId Attribute to read
+     * @param token @completiontoken{void(opcua::StatusCode, opcua::DataValue&)}
+     */
+    template <typename CompletionToken = DefaultCompletionToken>
+    auto readAttributeAsync(
+        const NodeId& id,
+        AttributeId attributeId,
+        CompletionToken&& token = DefaultCompletionToken()
+    ) {
+        return asyncInitiate<DataValue>(
+            [&](auto&& handler) {
+                add(id, attributeId, wrapHandler(std::forward<decltype(handler)>(handler)));
+            },
+            std::forward<CompletionToken>(token)
+        );
+    }
+
+    /// Send all pending reads immediately.
+    void flush();
+
+    /// Number of pending reads, that are not sent yet.
+    size_t pending() const noexcept {
+        return handlers_.size();
+    }
+
+    /// Maximum number of nodes per read request (server's operation limit, 0: unlimited).
+    uint32_t getMaxNodesPerRead() const noexcept {
+        return maxNodesPerRead_;
+    }
+
+private:
+    using Handler = std::function<void(StatusCode, DataValue&)>;
+
+    template <typename CompletionHandler>
+    static Handler wrapHandler(CompletionHandler&& handler) {
+        // std::function requires copyable callables, completion handlers might be move-only
+        auto ptr = std::make_shared<std::decay_t<CompletionHandler>>(
+            std::forward<CompletionHandler>(handler)
+        );
+        return [ptr](StatusCode code, DataValue& value) { std::invoke(*ptr, code, value); };
+    }
+
+    void add(const NodeId& id, AttributeId attributeId, Handler&& handler);
+    void scheduleFlush();
+    void cancelFlush() noexcept;
+    static void flushCallback(UA_Client* client, void* data);
+
+    Client& client_;
+    ReadCoalescerOptions options_;
+    uint32_t maxNodesPerRead_{0};
+    uint64_t callbackId_{0};
+    std::vector<ReadValueId> items_;
+    std::vector<Handler> handlers_;
+};
+
+}  // namespace opcua
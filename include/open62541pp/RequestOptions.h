@@ -0,0 +1,129 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>  // exchange, forward, move
+
+namespace opcua {
+
+/**
+ * Token to cancel outstanding async client requests.
+ *
+ * Requests are bound to the token with the completion token wrapper withRequestOptions.
+ * CancellationToken::cancel calls the Cancel service for all outstanding requests bound to the
+ * token and completes them immediately with the status code `BadRequestCancelledByClient`. The
+ * completion handler (and its captured state) is released early, late responses of the server
+ * are discarded. Requests bound to a cancelled token are completed without being sent.
+ *
+ * Copies of the token share their state. The token is not thread-safe, cancel it from the
+ * client's thread (e.g. with Client::post if the client runs a background network thread).
+ */
+class CancellationToken {
+public:
+    CancellationToken()
+        : state_(std::make_shared<State>()) {}
+
+    /// Cancel all outstanding requests bound to the token.
+    void cancel() {
+        state_->cancelled = true;
+        auto handlers = std::exchange(state_->handlers, {});
+        for (auto& [id, handler] : handlers) {
+            handler();
+        }
+    }
+
+    bool isCancelled() const noexcept {
+        return state_->cancelled;
+    }
+
+    /// Reset the cancelled state, e.g. to reuse the token for new requests.
+    void reset() noexcept {
+        state_->cancelled = false;
+    }
+
+    /// Number of outstanding requests bound to the token.
+    size_t outstanding() const noexcept {
+        return state_->handlers.size();
+    }
+
+    /// @private
+    size_t registerHandler(std::function<void()> handler) {
+        const size_t id = ++state_->lastId;
+        state_->handlers.emplace(id, std::move(handler));
+        return id;
+    }
+
+    /// @private
+    void unregisterHandler(size_t id) noexcept {
+        state_->handlers.erase(id);
+    }
+
+private:
+    struct State {
+        bool cancelled{false};
+        size_t lastId{0};
+        std::map<size_t, std::function<void()>> handlers;
+    };
+
+    std::shared_ptr<State> state_;
+};
+
+/**
+ * Options of a single async client request.
+ */
+struct RequestOptions {
+    /// Timeout of the request, mapped to `RequestHeader.timeoutHint` and the client-side deadline
+    /// of the async request. The client's timeout (Client::setTimeout) is used if zero.
+    std::chrono::milliseconds timeout{0};
+    /// Token to cancel the request.
+    std::optional<CancellationToken> cancellation{};
+};
+
+/**
+ * Completion token wrapper to pass RequestOptions to an async client service.
+ * @see withRequestOptions
+ */
+template <typename CompletionToken>
+struct WithRequestOptions {
+    RequestOptions options;
+    CompletionToken token;
+};
+
+/**
+ * Pass RequestOptions to an async client service.
+ * The wrapped completion token defines the completion of the operation as usual.
+ * @code
+ * CancellationToken cancellation;
+ * auto future = services::readValueAsync(
+ *     client, id, withRequestOptions({std::chrono::milliseconds(200), cancellation}, useFuture)
+ * );
+ * // ...
+ * cancellation.cancel();
+ * @endcode
+ */
+template <typename CompletionToken>
+auto withRequestOptions(RequestOptions options, CompletionToken&& token) {
+    return WithRequestOptions<std::decay_t<CompletionToken>>{
+        std::move(options), std::forward<CompletionToken>(token)
+    };
+}
+
+namespace detail {
+
+template <typename T>
+struct IsWithRequestOptions : std::false_type {};
+
+template <typename CompletionToken>
+struct IsWithRequestOptions<WithRequestOptions<CompletionToken>> : std::true_type {};
+
+template <typename T>
+constexpr bool isWithRequestOptions = IsWithRequestOptions<std::decay_t<T>>::value;
+
+}  // namespace detail
+
+}  // namespace opcua
@@ -0,0 +1,226 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "open62541pp/Bitmask.h"
+#include "open62541pp/Common.h"
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/TypeWrapper.h"
+#include "open62541pp/open62541.h"
+#include "open62541pp/types/Composed.h"
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/NodeId.h"
+#include "open62541pp/types/Variant.h"
+
+namespace opcua {
+
+namespace detail {
+
+/**
+ * Request with a contiguous array of native items, that reference the data of the caller.
+ * Items are shallow copies: node ids, values and arguments are borrowed, not deep-copied. The
+ * referenced objects must outlive the view (and all requests sent with it).
+ */
+template <typename Request, typename Item, auto SizeMember, auto ItemsMember>
+class RequestView {
+public:
+    using NativeRequest = typename Request::NativeType;
+    using NativeItem = typename Item::NativeType;
+
+    size_t size() const noexcept {
+        return items_.size();
+    }
+
+    bool empty() const noexcept {
+        return items_.empty();
+    }
+
+    void reserve(size_t capacity) {
+        items_.reserve(capacity);
+    }
+
+    /// Remove all items, the capacity is kept for the next request.
+    void clear() noexcept {
+        items_.clear();
+    }
+
+    /// Borrowed items, e.g. as input of batch services. Valid until the view is modified.
+    Span<const Item> items() const noexcept {
+        return {asWrapper<Item>(items_.data()), items_.size()};
+    }
+
+    /// Borrowed request for the services. Valid until the view is modified.
+    const Request& request() const noexcept {
+        request_.*SizeMember = items_.size();
+        // NOLINTNEXTLINE, request object won't be modified
+        request_.*ItemsMember = const_cast<NativeItem*>(items_.data());
+        return asWrapper<Request>(request_);
+    }
+
+protected:
+    NativeItem& emplace() {
+        return items_.emplace_back();
+    }
+
+    NativeRequest& native() noexcept {
+        return request_;
+    }
+
+private:
+    std::vector<NativeItem> items_;
+    mutable NativeRequest request_{};
+};
+
+}  // namespace detail
+
+/**
+ * Read request builder without per-item deep copies.
+ * Node ids and index ranges are borrowed and must outlive the view.
+ * @code
+ * ReadRequestView view;
+ * view.reserve(ids.size());
+ * for (const auto& id : ids) {
+ *     view.add(id);
+ * }
+ * auto response = services::read(client, view.request());
+ * @endcode
+ */
+class ReadRequestView : public detail::RequestView<
+                            ReadRequest,
+                            ReadValueId,
+                            &UA_ReadRequest::nodesToReadSize,
+                            &UA_ReadRequest::nodesToRead> {
+public:
+    explicit ReadRequestView(TimestampsToReturn timestamps = TimestampsToReturn::Neither) {
+        native().timestampsToReturn = static_cast<UA_TimestampsToReturn>(timestamps);
+    }
+
+    /// Add a node attribute to read.
+    ReadRequestView& add(const NodeId& id, AttributeId attributeId = AttributeId::Value) {
+        auto& item = emplace();
+        item.nodeId = *id.handle();
+        item.attributeId = static_cast<uint32_t>(attributeId);
+        return *this;
+    }
+
+    /// Add a read item (shallow copy).
+    ReadRequestView& add(const ReadValueId& item) {
+        emplace() = *item.handle();
+        return *this;
+    }
+};
+
+/**
+ * Write request builder without per-item deep copies.
+ * Node ids and values are borrowed and must outlive the view.
+ */
+class WriteRequestView : public detail::RequestView<
+                             WriteRequest,
+                             WriteValue,
+                             &UA_WriteRequest::nodesToWriteSize,
+                             &UA_WriteRequest::nodesToWrite> {
+public:
+    /// Add a node attribute to write.
+    WriteRequestView& add(const NodeId& id, AttributeId attributeId, const DataValue& value) {
+        auto& item = emplace();
+        item.nodeId = *id.handle();
+        item.attributeId = static_cast<uint32_t>(attributeId);
+        item.value = *value.handle();
+        item.value.hasValue = true;
+        return *this;
+    }
+
+    /// Add a value to write to the AttributeId::Value attribute.
+    WriteRequestView& add(const NodeId& id, const Variant& value) {
+        auto& item = emplace();
+        item.nodeId = *id.handle();
+        item.attributeId = UA_ATTRIBUTEID_VALUE;
+        item.value.value = *value.handle();
+        item.value.hasValue = true;
+        return *this;
+    }
+
+    /// Add a write item (shallow copy).
+    WriteRequestView& add(const WriteValue& item) {
+        emplace() = *item.handle();
+        return *this;
+    }
+};
+
+/**
+ * Browse request builder without per-item deep copies.
+ * Node ids are borrowed and must outlive the view.
+ */
+class BrowseRequestView : public detail::RequestView<
+                              BrowseRequest,
+                              BrowseDescription,
+                              &UA_BrowseRequest::nodesToBrowseSize,
+                              &UA_BrowseRequest::nodesToBrowse> {
+public:
+    explicit BrowseRequestView(uint32_t maxReferences = 0) {
+        native().requestedMaxReferencesPerNode = maxReferences;
+    }
+
+    /// Add a node to browse, the (numeric) reference type is stored by value.
+    BrowseRequestView& add(
+        const NodeId& id,
+        BrowseDirection browseDirection,
+        ReferenceTypeId referenceType = ReferenceTypeId::References,
+        bool includeSubtypes = true,
+        Bitmask<NodeClass> nodeClassMask = NodeClass::Unspecified,
+        Bitmask<BrowseResultMask> resultMask = BrowseResultMask::All
+    ) {
+        auto& item = emplace();
+        item.nodeId = *id.handle();
+        item.browseDirection = static_cast<UA_BrowseDirection>(browseDirection);
+        item.referenceTypeId = UA_NODEID_NUMERIC(0, static_cast<uint32_t>(referenceType));
+        item.includeSubtypes = includeSubtypes;
+        item.nodeClassMask = nodeClassMask.get();
+        item.resultMask = resultMask.get();
+        return *this;
+    }
+
+    /// Add a browse description (shallow copy).
+    BrowseRequestView& add(const BrowseDescription& item) {
+        emplace() = *item.handle();
+        return *this;
+    }
+};
+
+#ifdef UA_ENABLE_METHODCALLS
+/**
+ * Call request builder without per-item deep copies.
+ * Node ids and input arguments are borrowed and must outlive the view.
+ * Pass the items to services::callMany.
+ */
+class CallRequestView : public detail::RequestView<
+                            CallRequest,
+                            CallMethodRequest,
+                            &UA_CallRequest::methodsToCallSize,
+                            &UA_CallRequest::methodsToCall> {
+public:
+    /// Add a method call.
+    CallRequestView& add(
+        const NodeId& objectId, const NodeId& methodId, Span<const Variant> inputArguments
+    ) {
+        auto& item = emplace();
+        item.objectId = *objectId.handle();
+        item.methodId = *methodId.handle();
+        item.inputArgumentsSize = inputArguments.size();
+        // NOLINTNEXTLINE, request object won't be modified
+        item.inputArguments = const_cast<UA_Variant*>(asNative(inputArguments.data()));
+        return *this;
+    }
+
+    /// Add a method call item (shallow copy).
+    CallRequestView& add(const CallMethodRequest& item) {
+        emplace() = *item.handle();
+        return *this;
+    }
+};
+#endif
+
+}  // namespace opcua
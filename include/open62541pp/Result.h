@@ -0,0 +1,166 @@
+#pragma once
+
+#include <cassert>
+#include <type_traits>
+#include <utility>  // forward, move
+
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/types/Builtin.h"  // StatusCode
+
+namespace opcua {
+
+/**
+ * Represents a bad result stored in `Result`.
+ */
+class BadResult {
+public:
+    constexpr explicit BadResult(StatusCode code) noexcept
+        : code_(code) {
+        assert(code.isBad());
+    }
+
+    constexpr StatusCode code() const noexcept {
+        return code_;
+    }
+
+private:
+    StatusCode code_;
+};
+
+/**
+ * Result encapsulates a result value and a status code.
+ * A result may contain just an error status code, just the return value or both.
+ * Unlike the BadStatus exception, a bad status code is returned without stack unwinding. The
+ * `try*` service functions (e.g. services::tryReadValue) return results for loops where bad
+ * status codes are routine.
+ */
+template <typename T>
+class Result {
+public:
+    constexpr Result() noexcept(std::is_nothrow_default_constructible_v<T>) = default;
+
+    // NOLINTNEXTLINE, implicit wanted
+    constexpr Result(const T& value) noexcept(std::is_nothrow_copy_constructible_v<T>)
+        : value_(value) {}
+
+    // NOLINTNEXTLINE, implicit wanted
+    constexpr Result(T&& value) noexcept(std::is_nothrow_move_constructible_v<T>)
+        : value_(std::move(value)) {}
+
+    // NOLINTNEXTLINE, implicit wanted
+    constexpr Result(BadResult error) noexcept
+        : code_(error.code()) {}
+
+    constexpr Result(
+        StatusCode code, const T& value
+    ) noexcept(std::is_nothrow_copy_constructible_v<T>)
+        : code_(code),
+          value_(value) {}
+
+    constexpr Result(StatusCode code, T&& value) noexcept(std::is_nothrow_move_constructible_v<T>)
+        : code_(code),
+          value_(std::move(value)) {}
+
+    constexpr const T* operator->() const noexcept {
+        return &value_;
+    }
+
+    constexpr T* operator->() noexcept {
+        return &value_;
+    }
+
+    constexpr const T& operator*() const& noexcept {
+        return value_;
+    }
+
+    constexpr T& operator*() & noexcept {
+        return value_;
+    }
+
+    constexpr const T&& operator*() const&& noexcept {
+        return std::move(value_);
+    }
+
+    constexpr T&& operator*() && noexcept {
+        return std::move(value_);
+    }
+
+    constexpr StatusCode code() const noexcept {
+        return code_;
+    }
+
+    constexpr const T& value() const& {
+        checkIsBad();
+        return **this;
+    }
+
+    constexpr T& value() & {
+        checkIsBad();
+        return **this;
+    }
+
+    constexpr const T&& value() const&& {
+        checkIsBad();
+        return std::move(**this);
+    }
+
+    constexpr T&& value() && {
+        checkIsBad();
+        return std::move(**this);
+    }
+
+    template <typename U>
+    constexpr T valueOr(U&& defaultValue) const& {
+        return !isBad() ? **this : static_cast<T>(std::forward<U>(defaultValue));
+    }
+
+    template <typename U>
+    constexpr T valueOr(U&& defaultValue) && {
+        return !isBad() ? std::move(**this) : static_cast<T>(std::forward<U>(defaultValue));
+    }
+
+private:
+    constexpr bool isBad() const noexcept {
+        return code().isBad();
+    }
+
+    constexpr void checkIsBad() const {
+        code().throwIfBad();
+    }
+
+    StatusCode code_{};
+    T value_{};
+};
+
+template <>
+class Result<void> {
+public:
+    constexpr Result() noexcept = default;
+
+    // NOLINTNEXTLINE, implicit wanted
+    constexpr Result(BadResult error) noexcept
+        : code_(error.code()) {}
+
+    constexpr const void* operator->() const noexcept {
+        return nullptr;
+    }
+
+    constexpr void* operator->() noexcept {
+        return nullptr;
+    }
+
+    constexpr void operator*() const noexcept {}
+
+    constexpr StatusCode code() const noexcept {
+        return code_;
+    }
+
+    constexpr void value() const {
+        code().throwIfBad();
+    }
+
+private:
+    StatusCode code_{};
+};
+
+}  // namespace opcua
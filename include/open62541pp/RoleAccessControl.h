@@ -0,0 +1,188 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "open62541pp/AccessControl.h"
+#include "open62541pp/Bitmask.h"
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua {
+
+// forward declaration
+class Server;
+
+/**
+ * Permissions granted to roles by RoleAccessControl.
+ */
+enum class Permission : uint8_t {
+    // clang-format off
+    None   = 0,
+    Browse = 1U << 0U,  ///< Browse the node
+    Read   = 1U << 1U,  ///< Read the value and history of variables
+    Write  = 1U << 2U,  ///< Write attributes, values and history, add and delete nodes below
+    Call   = 1U << 3U,  ///< Call methods
+    All    = Browse | Read | Write | Call,
+    // clang-format on
+};
+
+template <>
+struct IsBitmaskEnum<Permission> : std::true_type {};
+
+/// Set of roles, one bit per role (up to 64 roles).
+using RoleMask = uint64_t;
+
+/// Role mask of the role with the given index.
+constexpr RoleMask role(unsigned index) noexcept {
+    return RoleMask{1} << index;
+}
+
+/**
+ * Login credentials with the roles of the user.
+ */
+struct RoleLogin {
+    Login login;
+    RoleMask roles;
+};
+
+/**
+ * Role-based access control with rules compiled into per-node permission masks.
+ *
+ * Rules grant permissions to roles for all nodes of a namespace (allowNamespace) or for subtrees
+ * of hierarchical references (allowSubtree). compile resolves the rules once for the address space
+ * and stores the granted roles per permission of each node in a compact table: nodes reference
+ * one of few distinct permission sets by a 16 bit index, numeric node ids are indexed directly.
+ * The callbacks only look up the node's permission set and check the roles of the session with a
+ * single AND, without evaluating rules.
+ *
+ * Users are authenticated like AccessControlDefault. Anonymous sessions get the anonymous roles.
+ * Nodes added after compile only get the permissions of their namespace until compile is called
+ * again. Compile and the rule setters must not be called while the server runs concurrently.
+ * @code
+ * constexpr RoleMask operators = role(0);
+ * constexpr RoleMask engineers = role(1);
+ * RoleAccessControl ac(false, {{{"bob", "secret"}, operators | engineers}});
+ * ac.allowNamespace(operators | engineers, 0, Permission::Browse | Permission::Read);
+ * ac.allowSubtree(engineers, plantId, Permission::All);
+ * server.setAccessControl(ac);
+ * ac.compile(server);
+ * @endcode
+ */
+class RoleAccessControl : public AccessControlDefault {
+public:
+    explicit RoleAccessControl(bool allowAnonymous = true, std::vector<RoleLogin> logins = {});
+
+    /// Set the roles of anonymous sessions (default: no roles).
+    void setAnonymousRoles(RoleMask roles) noexcept {
+        anonymousRoles_ = roles;
+    }
+
+    /// Grant permissions to roles for all nodes of a namespace.
+    void allowNamespace(RoleMask roles, uint16_t namespaceIndex, Bitmask<Permission> permissions);
+
+    /// Grant permissions to roles for a node and its descendants of hierarchical references.
+    void allowSubtree(RoleMask roles, const NodeId& rootId, Bitmask<Permission> permissions);
+
+    /**
+     * Compile the rules into the permission table of the nodes.
+     * Must be called after the address space is built and after the rules changed.
+     * Invalidates the cached access decisions of all sessions.
+     * @exception BadStatus If a subtree can not be browsed
+     * @exception BadStatus (BadOutOfRange) If the rules result in more than 65535 permission sets
+     */
+    void compile(Server& server);
+
+    /// Get the roles of an activated session.
+    RoleMask getSessionRoles(const Session& session) const noexcept;
+
+    /// Get the roles that are granted a permission on the node (compiled).
+    RoleMask getGrantedRoles(const NodeId& nodeId, Permission permission) const noexcept;
+
+    StatusCode activateSession(
+        Session& session,
+        const EndpointDescription& endpointDescription,
+        const ByteString& secureChannelRemoteCertificate,
+        const ExtensionObject& userIdentityToken
+    ) override;
+
+    void closeSession(Session& session) override;
+
+    Bitmask<WriteMask> getUserRightsMask(Session& session, const NodeId& nodeId) override;
+
+    Bitmask<AccessLevel> getUserAccessLevel(Session& session, const NodeId& nodeId) override;
+
+    bool getUserExecutable(Session& session, const NodeId& methodId) override;
+
+    bool getUserExecutableOnObject(Session& session, const NodeId& methodId, const NodeId& objectId)
+        override;
+
+    bool allowAddNode(Session& session, const AddNodesItem& item) override;
+
+    bool allowAddReference(Session& session, const AddReferencesItem& item) override;
+
+    bool allowDeleteNode(Session& session, const DeleteNodesItem& item) override;
+
+    bool allowDeleteReference(Session& session, const DeleteReferencesItem& item) override;
+
+    bool allowBrowseNode(Session& session, const NodeId& nodeId) override;
+
+    bool allowHistoryUpdate(
+        Session& session,
+        const NodeId& nodeId,
+        PerformUpdateType performInsertReplace,
+        const DataValue& value
+    ) override;
+
+    bool allowHistoryDelete(
+        Session& session,
+        const NodeId& nodeId,
+        DateTime startTimestamp,
+        DateTime endTimestamp,
+        bool isDeleteModified
+    ) override;
+
+private:
+    /// Granted roles per permission.
+    struct PermissionSet {
+        RoleMask browse{0};
+        RoleMask read{0};
+        RoleMask write{0};
+        RoleMask call{0};
+
+        void grant(RoleMask roles, Bitmask<Permission> permissions) noexcept;
+        RoleMask get(Permission permission) const noexcept;
+        bool operator==(const PermissionSet& other) const noexcept;
+    };
+
+    struct Rule {
+        RoleMask roles;
+        NodeId rootId;
+        Bitmask<Permission> permissions;
+    };
+
+    using SetIndex = uint16_t;
+    static constexpr SetIndex noSet = 0xFFFF;
+
+    SetIndex intern(const PermissionSet& set);
+    void assign(const NodeId& id, SetIndex index);
+    const PermissionSet& lookup(const NodeId& id) const noexcept;
+    bool isGranted(Session& session, const NodeId& id, Permission permission) const noexcept;
+
+    std::vector<RoleLogin> roleLogins_;
+    RoleMask anonymousRoles_{0};
+    std::vector<PermissionSet> namespaceRules_;  // by namespace index
+    std::vector<Rule> subtreeRules_;
+
+    // compiled
+    std::vector<PermissionSet> sets_;  // distinct permission sets
+    std::vector<SetIndex> namespaceSets_;  // by namespace index
+    std::vector<std::vector<SetIndex>> numericSets_;  // by namespace index and numeric id
+    std::unordered_map<NodeId, SetIndex> otherSets_;  // non-numeric or sparse node ids
+
+    std::unordered_map<NodeId, RoleMask> sessionRoles_;
+};
+
+}  // namespace opcua
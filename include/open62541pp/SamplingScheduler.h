@@ -0,0 +1,160 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include "open62541pp/Span.h"
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/DateTime.h"
+#include "open62541pp/types/NodeId.h"
+
+// forward declaration open62541
+struct UA_Server;
+
+namespace opcua {
+
+// forward declaration
+class Server;
+
+/**
+ * Scheduler to update the values of many variable nodes periodically in the server loop.
+ *
+ * Nodes are registered in sampling groups with an interval and a bulk provider function. The
+ * provider is called once per interval with all nodes of the group and fills their values, which
+ * are written in one batch. All groups are driven by a single repeated callback of the server
+ * (the tick) and kept in a timing wheel, so each tick only visits the groups due in this tick.
+ * Groups with the same interval are aligned and sampled in the same tick; values without source
+ * timestamp get the same timestamp per tick.
+ *
+ * Groups due in the same tick are sampled in order of their priority (highest first, like the
+ * priority of SubscriptionParameters). With a tick budget, groups left when the budget is exceeded
+ * are deferred to the next tick, so critical groups are not delayed by bulk groups under load.
+ *
+ * The scheduler must be used from the server thread (or before the server runs) and must be
+ * destroyed before the server. Exceptions of providers are rethrown by Server::runIterate.
+ * @code
+ * SamplingScheduler scheduler(server);
+ * scheduler.addGroup(std::chrono::milliseconds(100), ids, [&](auto ids, auto values) {
+ *     for (size_t i = 0; i < ids.size(); ++i) {
+ *         values[i].getValue().setScalarCopy(plc.read(ids[i]));
+ *     }
+ * });
+ * server.run();
+ * @endcode
+ */
+class SamplingScheduler {
+public:
+    using GroupId = uint32_t;
+
+    /**
+     * Bulk provider of a sampling group.
+     * @param ids Nodes of the group
+     * @param values Values of the nodes to fill, reused between calls
+     */
+    using Provider = std::function<void(Span<const NodeId> ids, Span<DataValue> values)>;
+
+    /**
+     * Create the scheduler and its repeated server callback.
+     * @param server Server instance
+     * @param resolution Interval of the tick, sampling intervals are rounded up to multiples
+     * @param wheelSize Number of slots of the timing wheel
+     */
+    explicit SamplingScheduler(
+        Server& server,
+        std::chrono::milliseconds resolution = std::chrono::milliseconds(10),
+        size_t wheelSize = 256
+    );
+    ~SamplingScheduler();
+
+    SamplingScheduler(const SamplingScheduler&) = delete;
+    SamplingScheduler(SamplingScheduler&&) noexcept = delete;
+    SamplingScheduler& operator=(const SamplingScheduler&) = delete;
+    SamplingScheduler& operator=(SamplingScheduler&&) noexcept = delete;
+
+    /**
+     * Add a sampling group.
+     * @param interval Sampling interval, rounded up to a multiple of the resolution
+     * @param ids Variable nodes of the group
+     * @param provider Bulk provider function to fill the values
+     * @param priority Relative priority of the group, higher priorities are sampled first
+     * @return Group id to remove the group
+     */
+    GroupId addGroup(
+        std::chrono::milliseconds interval,
+        Span<const NodeId> ids,
+        Provider provider,
+        uint8_t priority = 0
+    );
+
+    /// Remove a sampling group. Unknown ids are ignored.
+    /// Providers can remove groups (including their own), the removal is deferred until the
+    /// providers of the tick are called.
+    void removeGroup(GroupId id) noexcept;
+
+    /// Number of sampling groups.
+    size_t size() const noexcept {
+        return groups_.size() - removedCount_;
+    }
+
+    std::chrono::milliseconds getResolution() const noexcept {
+        return resolution_;
+    }
+
+    /**
+     * Set the time budget for sampling per tick, zero (default) for no budget.
+     * Groups left when the budget is exceeded are deferred to the next tick, ahead of the groups
+     * of the same priority due in that tick. At least one group is sampled per tick. Deferred
+     * groups are sampled once, even if they are due again meanwhile.
+     */
+    void setTickBudget(std::chrono::steady_clock::duration budget) noexcept {
+        tickBudget_ = budget;
+    }
+
+    std::chrono::steady_clock::duration getTickBudget() const noexcept {
+        return tickBudget_;
+    }
+
+    /// Number of groups deferred because of an exceeded tick budget (total since creation).
+    uint64_t getDeferredCount() const noexcept {
+        return deferredCount_;
+    }
+
+private:
+    struct Group {
+        uint64_t intervalTicks;
+        uint64_t nextTick;
+        std::vector<NodeId> ids;
+        std::vector<DataValue> values;
+        Provider provider;
+        uint8_t priority;
+        bool deferred = false;
+        bool removed = false;  // removed while the providers are called
+    };
+
+    static void onTick(UA_Server* server, void* data) noexcept;
+    void tick();
+    void schedule(GroupId id, uint64_t tick);
+    void sample(Group& group, DateTime timestamp);
+    void eraseRemoved() noexcept;
+
+    Server& server_;
+    std::chrono::milliseconds resolution_;
+    uint64_t callbackId_{0};
+    uint64_t tick_{0};
+    GroupId nextId_{0};
+    std::unordered_map<GroupId, Group> groups_;
+    std::vector<std::vector<GroupId>> wheel_;
+    std::vector<GroupId> due_;
+    std::vector<GroupId> ready_;  // due or deferred groups of the current tick
+    std::vector<GroupId> deferred_;  // to be sampled in the next tick
+    std::chrono::steady_clock::duration tickBudget_{};
+    uint64_t deferredCount_{0};
+    bool dispatching_{false};
+    size_t removedCount_{0};
+};
+
+}  // namespace opcua
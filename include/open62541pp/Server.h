@@ -1,16 +1,27 @@
 #pragma once
 
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <utility>  // pair
 #include <vector>
 
 #include "open62541pp/Config.h"
 #include "open62541pp/Logger.h"
+#include "open62541pp/MemoryStatistics.h"
 #include "open62541pp/NodeIds.h"
+#include "open62541pp/ServerMetrics.h"
 #include "open62541pp/Span.h"
 #include "open62541pp/Subscription.h"
+#include "open62541pp/TransportSettings.h"
+#include "open62541pp/detail/DataSourceBinding.h"
+#include "open62541pp/types/Builtin.h"  // StatusCode, fs
+#include "open62541pp/types/DataValue.h"
 #include "open62541pp/types/NodeId.h"
 
 // forward declaration open62541
@@ -20,26 +31,67 @@ namespace opcua {
 
 // forward declaration
 class AccessControlBase;
+class AddressSpaceIndex;
 class ByteString;
+class CustomAccessControl;
 class DataType;
+class DataTypeRegistry;
 class Event;
+class InstantiationTemplate;
+class NamespaceTable;
 template <typename ServerOrClient>
 class Node;
+class PubSubConnection;
+struct PubSubConnectionConfig;
 class Server;
 class Session;
 struct ValueBackendDataSource;
+class ValueBackendExternal;
 struct ValueCallback;
 
 namespace detail {
 class ServerContext;
 ServerContext& getContext(Server& server) noexcept;
+CustomAccessControl& getCustomAccessControl(Server& server) noexcept;
 }  // namespace detail
 
+/**
+ * Notification of a written variable value.
+ * @see Server::addWriteNotificationCallback
+ */
+struct WriteNotification {
+    NodeId id;
+    DataValue value;
+};
+
+/**
+ * Result of Server::loadAddressSpace.
+ */
+struct AddressSpaceLoadResult {
+    /// Number of added nodes.
+    size_t nodes{0};
+    /// Number of added references, besides the parent and type definition references.
+    size_t references{0};
+    /// Nodes or references that could not be added.
+    std::vector<std::pair<NodeId, StatusCode>> errors;
+    /// Nodes that were bound to keyed backends (see Server::setVariableNodeValueBackends) when the
+    /// address space was saved. Rebind them with their keys.
+    std::vector<NodeId> keyedIds;
+    /// Keys of `keyedIds`.
+    std::vector<uint64_t> keys;
+};
+
 /**
  * High-level server class.
  *
  * Exposes the most common functionality. Use the handle() method to get access the underlying
  * UA_Server instance and use the full power of open6254.
+ *
+ * Threading: open62541 processes network I/O and services in a single server loop (run or
+ * runIterate). If open62541 is built with `UA_MULTITHREADING >= 100`, the server API is thread-safe
+ * and can be used concurrently with the server loop, e.g. to write values or register backends.
+ * The internal context of the C++ layer is thread-safe as well. Slow callbacks can be executed off
+ * the server loop with MethodDispatcher (method callbacks) and AsyncDataSource (data sources).
  */
 class Server {
 public:
@@ -87,14 +139,94 @@ public:
 #endif
 
     /// Set custom logging function.
+    /// Messages rejected by the filter are discarded before formatting.
     /// Does nothing if the passed function is empty or a nullptr.
-    void setLogger(Logger logger);
+    void setLogger(Logger logger, const LogFilter& filter = {});
+
+    /**
+     * Set custom logging function, called asynchronously from a background thread.
+     * Messages are formatted into fixed-size records (without allocations) and passed through a
+     * lock-free ring buffer. The logging function is therefore not called from the thread issuing
+     * the message and does not block it. Dropped messages are reported with a warning.
+     * Does nothing if the passed function is empty or a nullptr.
+     */
+    void setAsyncLogger(Logger logger, const AsyncLoggerOptions& options = {});
+
+    /**
+     * Set structured logging function, called with unformatted log records.
+     * The record references the format string and the arguments of the log call. Formatting is
+     * deferred to the consumer (LogRecord::format) or skipped, e.g. if the arguments are shipped
+     * in binary form. Replaces the (asynchronous) logging function set before.
+     * Messages rejected by the filter are discarded.
+     * Does nothing if the passed function is empty or a nullptr.
+     */
+    void setStructuredLogger(StructuredLogger logger, const LogFilter& filter = {});
 
     /// Set custom access control.
     void setAccessControl(AccessControlBase& accessControl);
     /// Set custom access control (transfer ownership to Server).
     void setAccessControl(std::unique_ptr<AccessControlBase> accessControl);
 
+#ifdef UA_ENABLE_ENCRYPTION
+    /**
+     * Cache successful certificate validations of encrypted endpoints.
+     * Reconnect storms of many clients with the same certificates skip the repeated chain
+     * validation. Rejected certificates are not cached. The cache is invalidated by setTrustList.
+     * A zero TTL disables the cache.
+     * @param ttl Time until a cached validation expires
+     * @param maxEntries Maximum number of cached certificates, the oldest are evicted first
+     */
+    void setCertificateValidationCache(std::chrono::seconds ttl, size_t maxEntries = 10000);
+
+    /**
+     * Replace the certificate lists at runtime (thread-safe).
+     * Only the certificate verification is reinitialized, not the server config.
+     * New secure channels are validated with the new lists, established channels are unaffected.
+     * If the lists are invalid (e.g. malformed `DER`), the current lists stay active.
+     * @param trustList List of trusted certificates in `DER` encoded format
+     * @param issuerList List of issuer certificates (i.e. CAs) in `DER` encoded format
+     * @param revocationList Certificate revocation lists (CRL) in `DER` encoded format
+     */
+    void setTrustList(
+        Span<const ByteString> trustList,
+        Span<const ByteString> issuerList,
+        Span<const ByteString> revocationList = {}
+    );
+#endif
+
+#ifdef UAPP_HAS_CRYPTO_OFFLOAD
+    /**
+     * Decrypt asymmetrically encrypted messages on a worker pool.
+     * OpenSecureChannel requests and encrypted user identity tokens consist of independent RSA
+     * blocks, which are decrypted in parallel. The handshake still completes within the server
+     * loop, but blocks it for roughly one private key operation instead of one per block.
+     * The worker pool is shared by all servers and grows to the largest requested size.
+     * Must be called before the server is started.
+     * @note Only available with OpenSSL/LibreSSL (thread-safe decryption)
+     * @param threads Number of worker threads, 0 restores the inline decryption
+     */
+    void setAsymmetricCryptoOffload(size_t threads);
+#endif
+
+#ifdef UA_ENABLE_WEBSOCKET_SERVER
+    /**
+     * Add a WebSocket endpoint in addition to the TCP endpoint.
+     * Clients behind HTTP proxies connect with `opc.ws://host:port` (or `opc.wss://host:port` if a
+     * certificate and private key are passed). The connection is kept open for the lifetime of the
+     * secure channel, like a TCP connection.
+     * Must be called before the server is started.
+     * @note Requires open62541 built with `UA_ENABLE_WEBSOCKET_SERVER` (libwebsockets).
+     *       The open62541 client has no WebSocket transport.
+     * @param port Port of the WebSocket endpoint
+     * @param certificate Server certificate in `DER` encoded format for TLS (`opc.wss`)
+     * @param privateKey Private key in `DER` encoded format for TLS (`opc.wss`)
+     * @exception BadStatus (BadNotSupported) If TLS is not supported by the open62541 version
+     */
+    void addWebSocketEndpoint(
+        uint16_t port, const ByteString& certificate = {}, const ByteString& privateKey = {}
+    );
+#endif
+
     /// Set custom hostname, default: system's host name.
     void setCustomHostname(std::string_view hostname);
     /// Set application name, default: `open62541-based OPC UA Application`.
@@ -104,23 +236,190 @@ public:
     /// Set product URI, default: `http://open62541.org`.
     void setProductUri(std::string_view uri);
 
+    /**
+     * Set buffer sizes and message limits of the transport, applied to all new connections.
+     * Must be called before the server is started.
+     * @note Since open62541 v1.4, a single chunk size is configured for sent and received chunks
+     *       (the larger of both buffer sizes).
+     * @see TransportSettings::largePayload, TransportSettings::lowLatency
+     */
+    void setTransportSettings(const TransportSettings& settings);
+
     /// Get active client session.
     std::vector<Session> getSessions() const;
 
+    /// Invoke `func(Session&)` for each active client session (without copies).
+    void forEachSession(const std::function<void(Session&)>& func);
+
+    /**
+     * Get the client session of the callback that is currently invoked on this thread.
+     * Available in value callbacks, data sources, method callbacks and access control callbacks of
+     * sessions activated with a custom access control (see setAccessControl).
+     * The lookup is in constant time, e.g. to get session contexts with Session::getContext.
+     * @return Pointer to the session or `nullptr` outside of callbacks or for internal access
+     */
+    Session* getCurrentSession() noexcept;
+
     /// Get all defined namespaces.
+    /// @see getNamespaceTable
     std::vector<std::string> getNamespaceArray();
+    /// Get a copy of the cached namespace table (thread-safe).
+    /// The table is refreshed after namespaces are registered with registerNamespace.
+    NamespaceTable getNamespaceTable();
+    /// Get the namespace index of the URI in constant time.
+    /// The namespace table is refreshed once if the URI is not found, e.g. namespaces added with
+    /// the native API.
+    /// @exception BadStatus (BadNotFound) If the namespace URI is unknown
+    uint16_t getNamespaceIndex(std::string_view uri);
+    /// Resolve an ExpandedNodeId with namespace URI (`nsu=`) to a NodeId of the server.
+    /// @exception BadStatus (BadNotFound) If the namespace URI is unknown
+    /// @exception BadStatus (BadNodeIdUnknown) If the ExpandedNodeId refers to another server
+    NodeId resolveNodeId(const ExpandedNodeId& id);
     /// Register namespace. The new namespace index will be returned.
     [[nodiscard]] uint16_t registerNamespace(std::string_view uri);
 
     /// Set custom data types.
     /// All data types provided are automatically considered for decoding of received messages.
     void setCustomDataTypes(std::vector<DataType> dataTypes);
+    /// Set passthrough data types.
+    /// Passthrough data types are known to findDataType, but not decoded with received messages.
+    /// Their ExtensionObject bodies stay binary encoded and can be forwarded without a
+    /// decode/re-encode cycle. Use ExtensionObject::getDecodedData to decode them on demand.
+    /// Passing all custom data types enables the passthrough mode for the whole server.
+    /// @note Passthrough data types must not be used as members of decoded custom data types.
+    void setPassthroughDataTypes(std::vector<DataType> dataTypes);
+    /// Attach a shared registry of custom and passthrough data types.
+    /// The registry replaces the data types of setCustomDataTypes and setPassthroughDataTypes and
+    /// can be shared by many instances without copies of the data types and lookup indexes.
+    /// @see DataTypeRegistry
+    void setDataTypeRegistry(std::shared_ptr<const DataTypeRegistry> registry);
+    /// Get the registry of the custom data types, `nullptr` if no data types are set.
+    std::shared_ptr<const DataTypeRegistry> getDataTypeRegistry() const noexcept;
+    /// Find data type (custom or builtin) by its type id or binary encoding id.
+    /// Custom data types are indexed once by setCustomDataTypes, the lookup is in constant time.
+    /// @return Pointer to the data type or `nullptr` if not found
+    const UA_DataType* findDataType(const NodeId& id) const noexcept;
 
     /// Set value callbacks to execute before every read and after every write operation.
+    /// Only the native hooks of non-empty callbacks are installed.
+    /// @exception BadStatus (BadInvalidState) If the node is bound to a backend object
     void setVariableNodeValueCallback(const NodeId& id, ValueCallback callback);
+
+    /**
+     * Add a callback to receive the written values of many variable nodes in batches.
+     * Writes are collected and delivered once per iteration of the server loop, after the
+     * iteration. Instead of one `onAfterWrite` call per node, the callback receives all
+     * notifications of the iteration in the order of the writes. Local writes outside of the
+     * server loop are delivered after the next iteration.
+     *
+     * The `onAfterWrite` value callback of the nodes is replaced, `onBeforeRead` is kept.
+     * @param ids Variable nodes
+     * @param callback Callback invoked in the server loop with the notifications
+     * @exception BadStatus (BadInvalidState) If a node is bound to a backend object
+     */
+    void addWriteNotificationCallback(
+        Span<const NodeId> ids,
+        std::function<void(Span<const WriteNotification> notifications)> callback
+    );
     /// Set data source backend for variable node.
+    /// @exception BadStatus (BadInvalidState) If the node is bound to a backend object or a bulk
+    ///            registration of setVariableNodeValueBackends
     void setVariableNodeValueBackend(const NodeId& id, ValueBackendDataSource backend);
 
+#if UAPP_OPEN62541_VER_GE(1, 2)
+    /// Set external value backend for variable node, the value is read directly from user memory.
+    /// The backend is not copied and must outlive the server (or the node).
+    void setVariableNodeValueBackend(const NodeId& id, ValueBackendExternal& backend);
+#endif
+
+    /**
+     * Set the same data source backend for many variable nodes.
+     * All nodes share a single copy of the backend and a single internal node context, which is
+     * released with the server. The nodes can not be bound to other backends or callbacks later.
+     * @exception BadStatus (BadInvalidState) If a node is already bound to a backend object or a
+     *            bulk registration
+     * @exception BadStatus If a node does not exist or is not a variable node. Backends of the
+     *            preceding nodes remain set.
+     */
+    void setVariableNodeValueBackends(Span<const NodeId> ids, ValueBackendDataSource backend);
+
+    /**
+     * Set data source backends for many variable nodes, created by a factory function.
+     * The internal node contexts of all nodes are allocated in a single contiguous block, which is
+     * released with the server. This avoids the per-node allocation and context map lookup of
+     * setVariableNodeValueBackend and speeds up the registration of large address spaces.
+     * The nodes can not be bound to other backends or callbacks later.
+     * @exception BadStatus (BadInvalidState) If a node is already bound to a backend object or a
+     *            bulk registration
+     * @exception BadStatus If a node does not exist or is not a variable node. Backends of the
+     *            preceding nodes remain set.
+     */
+    void setVariableNodeValueBackends(
+        Span<const NodeId> ids,
+        const std::function<ValueBackendDataSource(const NodeId& id)>& factory
+    );
+
+    /**
+     * Set a backend object as data source of a variable node.
+     * The member functions of the backend are bound directly to the native data source callbacks,
+     * without `std::function` indirection and without copy of the numeric range.
+     * Required member functions of the backend (returning `StatusCode`):
+     * - `read(DataValue& value, Span<const NumericRangeDimension> range, bool timestamp)`
+     * - `write(const DataValue& value, Span<const NumericRangeDimension> range)`
+     *   (optional, the node is not writable without `write`)
+     *
+     * The semantics equal ValueBackendDataSource::read and ValueBackendDataSource::write.
+     * Exceptions are caught and converted to status codes, unless the members are `noexcept`.
+     * The backend is not copied and must outlive the server (or the node).
+     * Value callbacks and write notifications can not be added to the node.
+     * @exception BadStatus (BadInvalidState) If the node is already bound to a backend object
+     */
+    template <
+        typename Backend,
+        typename = std::enable_if_t<detail::HasDataSourceRead<Backend>::value>>
+    void setVariableNodeValueBackend(const NodeId& id, Backend& backend) {
+        setVariableNodeDataSource(id, detail::DataSourceBinding<Backend>::create(), &backend);
+    }
+
+    /**
+     * Set a backend object as data source of many variable nodes, identified by a user key.
+     * Instead of a full node context, each node only stores a compact context of the backend
+     * pointer and its key (e.g. a tag handle of the driver). The contexts of all nodes are
+     * allocated in a single contiguous block.
+     * The key of the node is passed as first argument to the member functions of the backend:
+     * - `read(uint64_t key, DataValue& value, Span<const NumericRangeDimension> range, bool ts)`
+     * - `write(uint64_t key, const DataValue& value, Span<const NumericRangeDimension> range)`
+     *   (optional, the nodes are not writable without `write`)
+     *
+     * Otherwise the semantics equal the single node overload of setVariableNodeValueBackend.
+     * @param ids Variable nodes
+     * @param keys Keys of the nodes, same size as `ids`
+     * @param backend Backend object, not copied and must outlive the server
+     * @exception BadStatus (BadInvalidArgument) If the sizes of `ids` and `keys` differ
+     * @exception BadStatus (BadInvalidState) If a node is already bound to a backend object
+     * @exception BadStatus If a node does not exist or is not a variable node. Backends of the
+     *            preceding nodes remain set.
+     */
+    template <
+        typename Backend,
+        typename = std::enable_if_t<detail::HasKeyedDataSourceRead<Backend>::value>>
+    void setVariableNodeValueBackends(
+        Span<const NodeId> ids, Span<const uint64_t> keys, Backend& backend
+    ) {
+        setVariableNodeDataSources(
+            ids, keys, detail::KeyedDataSourceBinding<Backend>::create(), &backend
+        );
+    }
+
+#ifdef UA_ENABLE_PUBSUB
+    /**
+     * Add a PubSub connection to publish data sets (UDP or Ethernet with UADP encoding).
+     * Writer groups and data set writers are added to the returned connection.
+     * @see PubSubConnection
+     */
+    PubSubConnection addPubSubConnection(const PubSubConnectionConfig& config);
+#endif
+
 #ifdef UA_ENABLE_SUBSCRIPTIONS
     /// Create a (pseudo) subscription to monitor local data changes and events.
     Subscription<Server> createSubscription() noexcept;
@@ -131,6 +430,135 @@ public:
     Event createEvent(const NodeId& eventType = ObjectTypeId::BaseEventType);
 #endif
 
+    /**
+     * Save all nodes outside of namespace zero in a binary snapshot file.
+     *
+     * The nodes are collected from the hierarchy below the root folder. Each node is stored as a
+     * compact record with its binary encoded attributes (including the current value) and all
+     * its references. The namespace URIs are stored as well, so snapshots can be loaded into
+     * servers with other namespace indices. Keys of nodes bound to keyed backends are stored
+     * instead of their values.
+     *
+     * Callbacks (value callbacks, data sources, method callbacks) and node contexts can not be
+     * serialized, they must be set again after loading.
+     * @param filepath Path of the snapshot file, an existing file is replaced
+     * @exception BadStatus (BadResourceUnavailable) If the file can not be written
+     * @exception BadStatus (BadNotSupported) If the binary encoding is not supported
+     *            (open62541 < v1.3)
+     */
+    void saveAddressSpace(const fs::path& filepath);
+
+    /**
+     * Load nodes from a binary snapshot file created with saveAddressSpace.
+     *
+     * The file is memory-mapped (POSIX) and the records are decoded directly from the mapping.
+     * Instead of calling addNode per node, the nodes are inserted in bulk: all nodes are added
+     * first with deferred type checks, then the remaining references, and finally the nodes are
+     * finished in dependency order (types first).
+     * @param filepath Path of the snapshot file
+     * @return Number of added nodes and references, errors and keyed bindings to restore
+     * @exception BadStatus (BadResourceUnavailable) If the file can not be read
+     * @exception BadStatus (BadDecodingError) If the file is not a valid snapshot
+     * @exception BadStatus (BadNotSupported) If the binary encoding is not supported
+     *            (open62541 < v1.3)
+     */
+    AddressSpaceLoadResult loadAddressSpace(const fs::path& filepath);
+
+    /**
+     * Get the cached instantiation template of an object type.
+     * The template is created on first use and kept for the lifetime of the server. Changes of
+     * the object type after the first call are not reflected.
+     * @exception BadStatus (BadNodeIdUnknown) If the object type does not exist
+     * @exception BadStatus (BadNodeClassInvalid) If the node is not an object type
+     * @see InstantiationTemplate
+     */
+    InstantiationTemplate& getInstantiationTemplate(const NodeId& objectType);
+
+    /**
+     * Enable or disable the cache of local browse results.
+     * Complete results of services::browse (and browseAll, Node::browseReferences, ...) with this
+     * server are cached per node, browse direction, reference type, node class mask and result
+     * mask. Browses with a limit of references per node are paged from the cached result.
+     *
+     * The cache is invalidated by the NodeManagement services of this server and of clients
+     * (add/delete nodes and references), by NodeBatch, loadAddressSpace and by writes of the
+     * browse name or display name with services::writeAttribute. Changes with the native API are
+     * not observed, call invalidateBrowseCache after such changes.
+     * Browse requests of clients are not served from the cache.
+     * @param enabled Enable or disable the cache, cached results are discarded in either case
+     * @param capacity Maximum number of cached results, the cache is cleared if exceeded
+     */
+    void setBrowseCacheEnabled(bool enabled, size_t capacity = 1024);
+    /// Discard all cached browse results.
+    void invalidateBrowseCache();
+
+    /**
+     * Set the maximum number of open browse continuation points per session.
+     * Local browses with a limit of references per node (services::browse with this server)
+     * keep the complete references and a cursor to the next reference, so every
+     * services::browseNext costs `O(page size)` instead of browsing the node again. The
+     * continuation points are bound to the current session (see getCurrentSession) or to the
+     * server itself outside of session callbacks, and released if the session is closed.
+     * Further browses fail with `BadNoContinuationPoints` if the limit is reached.
+     * Browse requests of clients are handled by open62541 and not affected.
+     * @param maxPerSession Maximum number of continuation points per session (default: 5)
+     */
+    void setMaxBrowseContinuationPoints(size_t maxPerSession);
+
+    /**
+     * Get the index of the address space for subtree, type definition and browse name queries.
+     * The index is created on first use and kept up to date with changes through the C++ API.
+     * @see AddressSpaceIndex
+     */
+    AddressSpaceIndex& getAddressSpaceIndex();
+
+    /**
+     * Enable or disable the collection of metrics (disabled by default).
+     * Local service requests (Read, Write, Browse and Call with the C++ API of this server) are
+     * counted and timed, as well as data source and method callbacks. Requests of clients are
+     * counted per session and service from the session diagnostics of open62541 (requires
+     * `UA_ENABLE_DIAGNOSTICS`). Disabled metrics cost a single atomic load per request/callback.
+     * @see ServerMetrics, toPrometheus
+     */
+    void setMetricsEnabled(bool enabled);
+    /// Check if the collection of metrics is enabled.
+    bool isMetricsEnabled();
+    /// Get a snapshot of the metrics.
+    ServerMetrics getMetrics();
+    /// Reset the counters and histograms of local requests and callbacks.
+    void resetMetrics();
+
+    /**
+     * Set the limits of the admission control to shed load early during overload.
+     * Data source reads/writes and method calls beyond the limits fail fast with
+     * `BadTooManyOperations` or `BadResourceUnavailable`, the rejections are counted in
+     * ServerMetrics::admission. All limits are disabled by default.
+     * @see AdmissionLimits
+     */
+    void setAdmissionLimits(const AdmissionLimits& limits);
+    /// Get the limits of the admission control.
+    AdmissionLimits getAdmissionLimits();
+
+    /**
+     * Set a trace callback for the spans of the server loop and the instrumented hot paths (see
+     * ServerTracepoint). Pass an empty function to disable tracing. Tracing is independent of the
+     * metrics; disabled tracing costs a single atomic load per tracepoint.
+     * @see ServerTraceEvent
+     */
+    void setTraceCallback(ServerTraceCallback callback);
+
+    /**
+     * Enable or disable the accounting of native allocations and copies (disabled by default).
+     * The native accounting is process-wide and active while enabled by any server or client.
+     * Node and monitored item contexts are always counted.
+     * @see MemoryStatistics
+     */
+    void setMemoryAccountingEnabled(bool enabled);
+    /// Check if the accounting of native allocations is enabled by this server.
+    bool isMemoryAccountingEnabled();
+    /// Get a snapshot of the memory held or allocated by the server and the native allocations.
+    MemoryStatistics getMemoryStatistics();
+
     /// Run a single iteration of the server's main loop.
     /// @returns Maximum wait period until next Server::runIterate call (in ms)
     uint16_t runIterate();
@@ -152,6 +580,18 @@ public:
 
 private:
     friend detail::ServerContext& detail::getContext(Server& server) noexcept;
+    friend CustomAccessControl& detail::getCustomAccessControl(Server& server) noexcept;
+
+    void setVariableNodeDataSource(
+        const NodeId& id, const UA_DataSource& dataSource, void* context
+    );
+
+    void setVariableNodeDataSources(
+        Span<const NodeId> ids,
+        Span<const uint64_t> keys,
+        const UA_DataSource& dataSource,
+        void* backend
+    );
 
     class Connection;
     std::shared_ptr<Connection> connection_;
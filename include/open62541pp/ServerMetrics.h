@@ -0,0 +1,176 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua {
+
+/**
+ * Services with request metrics.
+ * @see ServerMetrics
+ */
+enum class MetricsService : uint8_t {
+    Read,
+    Write,
+    Browse,
+    Call,
+    Publish,
+};
+
+/**
+ * User callbacks with duration metrics.
+ * @see ServerMetrics
+ */
+enum class MetricsCallback : uint8_t {
+    DataSourceRead,  ///< Read callback of data sources (ValueBackendDataSource, bound backends)
+    DataSourceWrite,  ///< Write callback of data sources (ValueBackendDataSource, bound backends)
+    Method,  ///< Method callback
+};
+
+/**
+ * Latency histogram with fixed buckets.
+ * The bucket counts are not cumulative, the last bucket counts all durations above the last bound.
+ */
+struct LatencyHistogram {
+    /// Upper bounds of the buckets in seconds.
+    static constexpr std::array<double, 13> bounds{
+        10e-6, 50e-6, 100e-6, 500e-6, 1e-3, 5e-3, 10e-3, 50e-3, 100e-3, 500e-3, 1.0, 5.0, 10.0
+    };
+
+    std::array<uint64_t, bounds.size() + 1> buckets{};
+    uint64_t count = 0;  ///< Number of recorded durations
+    double sum = 0;  ///< Sum of all recorded durations in seconds
+};
+
+/**
+ * Request metrics of a service.
+ * Local requests are calls with the C++ API of the server (e.g. services::read with a server
+ * instance), timed by open62541pp. Remote requests of clients are processed by open62541, their
+ * counts are taken from the session diagnostics (requires `UA_ENABLE_DIAGNOSTICS`) and only cover
+ * the open sessions. The latency histogram covers local requests only.
+ */
+struct ServiceMetrics {
+    uint64_t requests = 0;  ///< Local requests
+    uint64_t errors = 0;  ///< Failed local requests
+    uint64_t remoteRequests = 0;  ///< Requests of open client sessions
+    uint64_t remoteErrors = 0;  ///< Failed requests of open client sessions
+    LatencyHistogram latency;  ///< Latency of local requests
+};
+
+/**
+ * Metrics of a client session, taken from the session diagnostics of open62541.
+ */
+struct SessionMetrics {
+    NodeId sessionId;
+    std::string sessionName;
+    uint64_t requests = 0;  ///< Total requests of the session
+    uint64_t errors = 0;  ///< Failed requests of the session
+    uint32_t subscriptions = 0;  ///< Current subscriptions
+    uint32_t monitoredItems = 0;  ///< Current monitored items
+    uint32_t publishRequestsQueued = 0;  ///< Publish requests queued for notifications
+};
+
+/**
+ * Limits of the admission control to shed load early during overload.
+ *
+ * The operations of clients (data source reads and writes, method calls) are counted per server
+ * iteration. open62541 processes the requests received in an iteration synchronously, so the
+ * operations per iteration bound the in-flight work of a session. Rejected operations fail fast
+ * with a status code instead of invoking the callbacks and building large responses.
+ * @see Server::setAdmissionLimits
+ */
+struct AdmissionLimits {
+    /// Maximum operations of a session per server iteration, further operations of the session
+    /// fail with `BadTooManyOperations`. Local calls without session are not limited.
+    /// 0 for no limit.
+    size_t maxOperationsPerSession = 0;
+    /// Maximum data source reads per server iteration, including the sampling of monitored items.
+    /// Further reads of the iteration fail with `BadResourceUnavailable`. 0 for no limit.
+    size_t maxReadsPerIteration = 0;
+    /// Maximum queue size of monitored items and maximum retransmission queue size of
+    /// subscriptions, to bound the memory of queued notifications. Requested queue sizes are
+    /// revised to the limit. 0 keeps the configuration of open62541.
+    uint32_t maxNotificationQueueSize = 0;
+};
+
+/**
+ * Operations rejected by the admission control.
+ * @see AdmissionLimits
+ */
+struct AdmissionMetrics {
+    uint64_t rejectedOperations = 0;  ///< Rejected by AdmissionLimits::maxOperationsPerSession
+    uint64_t rejectedReads = 0;  ///< Rejected by AdmissionLimits::maxReadsPerIteration
+};
+
+/**
+ * Snapshot of the server metrics.
+ * @see Server::setMetricsEnabled, Server::getMetrics
+ */
+struct ServerMetrics {
+    std::array<ServiceMetrics, 5> services{};  ///< Indexed by MetricsService
+    std::array<LatencyHistogram, 3> callbacks{};  ///< Indexed by MetricsCallback
+    std::vector<SessionMetrics> sessions;
+    AdmissionMetrics admission;
+
+    const ServiceMetrics& getService(MetricsService service) const noexcept {
+        return services[static_cast<size_t>(service)];
+    }
+
+    const LatencyHistogram& getCallback(MetricsCallback callback) const noexcept {
+        return callbacks[static_cast<size_t>(callback)];
+    }
+};
+
+/**
+ * Tracepoints of the server.
+ * @see Server::setTraceCallback
+ */
+enum class ServerTracepoint : uint8_t {
+    /// Iteration of the run loop (Server::run, Server::runIterate). Network receive and the
+    /// dispatch of client requests are processed by open62541 within the iteration.
+    Iteration,
+    NotificationDelivery,  ///< Delivery of buffered write and data change notifications
+    Service,  ///< Local service request, see ServerTraceEvent::service
+    DataSourceRead,  ///< Read callback of data sources (ValueBackendDataSource, bound backends)
+    DataSourceWrite,  ///< Write callback of data sources (ValueBackendDataSource, bound backends)
+    Method,  ///< Method callback
+    ExceptionRethrow,  ///< Rethrow of an exception caught in a callback (zero duration)
+};
+
+/**
+ * Completed span of a tracepoint.
+ */
+struct ServerTraceEvent {
+    ServerTracepoint tracepoint;
+    MetricsService service;  ///< Service of ServerTracepoint::Service, undefined otherwise
+    std::chrono::steady_clock::time_point start;
+    std::chrono::nanoseconds duration;
+};
+
+/**
+ * Trace callback, invoked synchronously at the end of each span.
+ * The callback is invoked from the thread executing the span and must be cheap; e.g. store the
+ * events in a ring buffer or emit USDT/LTTng probes. Exceptions are rethrown by the run loop.
+ */
+using ServerTraceCallback = std::function<void(const ServerTraceEvent& event)>;
+
+/**
+ * Format server metrics in the Prometheus text exposition format.
+ * Metric names are prefixed with `opcua_server_`, e.g. `opcua_server_service_requests_total`,
+ * `opcua_server_service_duration_seconds`, `opcua_server_callback_duration_seconds`,
+ * `opcua_server_session_publish_requests_queued` and `opcua_server_admission_rejected_total`.
+ * The `*_total` counters of the services cover local requests; the requests of remote clients are
+ * exported as gauges (`opcua_server_service_session_requests`), because they only cover the open
+ * sessions and decrease when sessions are closed.
+ * @see https://prometheus.io/docs/instrumenting/exposition_formats/
+ */
+std::string toPrometheus(const ServerMetrics& metrics);
+
+}  // namespace opcua
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <cstddef>
+#include <memory>
+#include <utility>  // move
+
 #include <open62541pp/types/NodeId.h>
 
 namespace opcua {
@@ -9,6 +13,33 @@ class QualifiedName;
 class Server;
 class Variant;
 
+namespace detail {
+size_t allocateSessionSlot() noexcept;
+}  // namespace detail
+
+/**
+ * Typed key of a per-session context slot.
+ *
+ * Each slot object reserves a unique index at construction. Slots should be created once, e.g. as
+ * static or long-lived objects, and shared by all sessions.
+ * @tparam T Type of the context object
+ * @see Session::setContext, Session::getContext
+ */
+template <typename T>
+class SessionSlot {
+public:
+    SessionSlot() noexcept
+        : index_(detail::allocateSessionSlot()) {}
+
+    /// Get the index of the slot.
+    size_t getIndex() const noexcept {
+        return index_;
+    }
+
+private:
+    size_t index_;
+};
+
 /**
  * High-level session class to manage client sessions.
  *
@@ -42,11 +73,32 @@ public:
     /// @note Only supported since open62541 v1.3
     void deleteSessionAttribute(const QualifiedName& key);
 
+    /**
+     * Attach a C++ context object to the session slot, e.g. in AccessControlBase::activateSession.
+     * The context is stored with the activated session and released when the session is closed.
+     * Unlike session attributes, contexts are accessed by index without string keys.
+     * @exception BadStatus (BadSessionIdInvalid) If the session is not activated
+     */
+    template <typename T>
+    void setContext(const SessionSlot<T>& slot, std::shared_ptr<T> context) {
+        setSlot(slot.getIndex(), std::move(context));
+    }
+
+    /// Get the context object of a session slot.
+    /// @return Pointer to the context or `nullptr` if the slot is empty or the session is unknown
+    template <typename T>
+    T* getContext(const SessionSlot<T>& slot) const noexcept {
+        return static_cast<T*>(getSlot(slot.getIndex()));
+    }
+
     /// Manually close this session.
     /// @note Only supported since open62541 v1.3
     void close();
 
 private:
+    void setSlot(size_t index, std::shared_ptr<void> context);
+    void* getSlot(size_t index) const noexcept;
+
     Server& connection_;
     NodeId sessionId_;
 };
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <utility>  // forward, move
+#include <vector>
+
+#include "open62541pp/Common.h"  // TimestampsToReturn
+#include "open62541pp/Span.h"
+#include "open62541pp/types/Composed.h"
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua {
+
+// forward declaration
+class Server;
+
+/**
+ * Options of ShardedServer.
+ */
+struct ShardedServerOptions {
+    /// Number of shards, each with its own node store and worker thread.
+    size_t shards = 2;
+    /// Port of the endpoint (front server).
+    uint16_t port = 4840;
+};
+
+/**
+ * Server facade with the address space partitioned by namespace across several shards.
+ *
+ * Each shard is an internal Server instance (without endpoint) with its own node store, owned by a
+ * dedicated worker thread. Read, Write and Browse items of the batch functions are routed by the
+ * namespace index of their NodeId, executed by the shard workers in parallel and merged in the
+ * order of the request. Application code builds the model of a shard with the existing API against
+ * `Server&` inside execute.
+ *
+ * A single endpoint is provided by the front server (getServer). Variables of the shards are
+ * published at the endpoint with expose; reads and writes of clients are forwarded to the shard.
+ * Namespaces that are not assigned to a shard, including namespace 0, are routed to shard 0.
+ *
+ * Register all namespaces before the shards are used concurrently. Run the front server as usual.
+ * @code
+ * ShardedServer sharded({4});
+ * for (size_t shard = 0; shard < 4; ++shard) {
+ *     const auto ns = sharded.registerNamespace("urn:line" + std::to_string(shard), shard);
+ *     sharded.execute(shard, [&](Server& server) { buildModel(server, ns); });
+ * }
+ * auto values = sharded.read(items);  // items of all lines, read in parallel
+ * @endcode
+ */
+class ShardedServer {
+public:
+    explicit ShardedServer(ShardedServerOptions options = {});
+
+    /// Stop the shard workers.
+    ~ShardedServer();
+
+    ShardedServer(const ShardedServer&) = delete;
+    ShardedServer(ShardedServer&&) noexcept = delete;
+    ShardedServer& operator=(const ShardedServer&) = delete;
+    ShardedServer& operator=(ShardedServer&&) noexcept = delete;
+
+    /// Get the front server with the endpoint.
+    Server& getServer() noexcept {
+        return *front_;
+    }
+
+    /// Number of shards.
+    size_t getShardCount() const noexcept {
+        return shards_.size();
+    }
+
+    /// Get the index of the shard that owns a node (by namespace index).
+    size_t getShardIndex(const NodeId& id) const noexcept;
+
+    /**
+     * Register a namespace in the front server and all shards (same index everywhere) and assign
+     * it to a shard.
+     * @return Namespace index
+     * @exception BadStatus (BadInvalidArgument) If the shard index is out of range
+     */
+    uint16_t registerNamespace(std::string_view uri, size_t shard);
+
+    /**
+     * Execute a function with the Server of a shard on its worker thread and wait for the result.
+     * Exceptions are propagated to the caller. Must not be called from a shard worker.
+     * @param func Callable with the signature `auto(Server&)`
+     */
+    template <typename Func>
+    auto execute(size_t shard, Func&& func) -> std::invoke_result_t<Func, Server&> {
+        using Result = std::invoke_result_t<Func, Server&>;
+        auto task = std::make_shared<std::packaged_task<Result()>>(
+            [this, shard, f = std::forward<Func>(func)]() mutable { return f(getShard(shard)); }
+        );
+        auto future = task->get_future();
+        post(shard, [task] { (*task)(); });
+        return future.get();
+    }
+
+    /// Read attributes, the items are processed in parallel by the shards.
+    std::vector<DataValue> read(
+        Span<const ReadValueId> items, TimestampsToReturn timestamps = TimestampsToReturn::Neither
+    );
+
+    /// Write attributes, the items are processed in parallel by the shards.
+    std::vector<StatusCode> write(Span<const WriteValue> items);
+
+    /// Browse references, the items are processed in parallel by the shards.
+    std::vector<BrowseResult> browse(
+        Span<const BrowseDescription> items, uint32_t maxReferences = 0
+    );
+
+    /**
+     * Publish a variable of a shard at the endpoint.
+     * A variable node with the same NodeId, browse name and type attributes is added to the front
+     * server below the parent node. Reads and writes of the node are forwarded to the shard.
+     * @exception BadStatus If the variable does not exist in the shard or can not be added
+     */
+    void expose(const NodeId& parentId, const NodeId& id);
+
+private:
+    struct Shard;
+
+    Server& getShard(size_t index);
+    void post(size_t shard, std::function<void()> task);
+
+    template <typename Item, typename Result, typename Process>
+    std::vector<Result> dispatch(Span<const Item> items, Process&& process);
+
+    std::unique_ptr<Server> front_;
+    std::vector<std::unique_ptr<Shard>> shards_;
+    std::vector<size_t> namespaceShards_;  // shard index by namespace index
+};
+
+}  // namespace opcua
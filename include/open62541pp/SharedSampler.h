@@ -0,0 +1,98 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+
+#include "open62541pp/ValueBackend.h"
+#include "open62541pp/types/Builtin.h"  // StatusCode
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua {
+
+// forward declaration
+class Server;
+
+/**
+ * Sharing of data source samples between the monitored items of a node.
+ *
+ * Monitored items sample their node independently, so `N` monitored items of the same node with
+ * the same sampling interval (e.g. of many clients) call the data source `N` times per interval.
+ * Registered nodes are read through the sampler, which reads the data source once and serves the
+ * sample to all reads within the maximum age. Each read returns a copy of the shared sample,
+ * numeric ranges are extracted from the copy.
+ *
+ * open62541 samples monitored items with the same sampling interval in the same cycle, so a
+ * maximum age well below the shortest sampling interval shares one sample per interval without
+ * delaying changes. Writes to the node discard the shared sample.
+ *
+ * The sampler must be used from the server thread (or before the server runs) and must outlive
+ * the server.
+ * @code
+ * SharedSampler sampler(std::chrono::milliseconds(5));
+ * sampler.registerNode(server, id, std::move(plcDataSource));
+ * @endcode
+ */
+class SharedSampler {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// @param maxAge Maximum age of a shared sample (exclusive), zero disables the sharing
+    explicit SharedSampler(Clock::duration maxAge = std::chrono::milliseconds(5)) noexcept
+        : maxAge_(maxAge) {}
+
+    ~SharedSampler() = default;
+
+    SharedSampler(const SharedSampler&) = delete;
+    SharedSampler(SharedSampler&&) noexcept = delete;
+    SharedSampler& operator=(const SharedSampler&) = delete;
+    SharedSampler& operator=(SharedSampler&&) noexcept = delete;
+
+    /**
+     * Register a variable node and set the sampler as its value backend.
+     * @param server Server instance
+     * @param id Variable node
+     * @param source Data source of the node, always read with an empty range and source timestamp
+     * @exception BadStatus If the value backend can not be set
+     */
+    void registerNode(Server& server, const NodeId& id, ValueBackendDataSource source);
+
+    /// Discard the shared sample of a node, the next read calls the data source.
+    /// Unknown nodes are ignored.
+    void invalidate(const NodeId& id) noexcept;
+
+    /// Number of registered nodes.
+    size_t size() const noexcept {
+        return entries_.size();
+    }
+
+    /// Number of data source reads.
+    uint64_t getSourceReads() const noexcept {
+        return sourceReads_;
+    }
+
+    /// Number of reads served from a shared sample.
+    uint64_t getSharedReads() const noexcept {
+        return sharedReads_;
+    }
+
+private:
+    struct Entry {
+        ValueBackendDataSource source;
+        DataValue sample;
+        Clock::time_point sampledAt;
+        bool valid{false};
+    };
+
+    StatusCode read(Entry& entry, DataValue& value, bool timestamp);
+
+    Clock::duration maxAge_;
+    uint64_t sourceReads_{0};
+    uint64_t sharedReads_{0};
+    std::unordered_map<NodeId, std::unique_ptr<Entry>> entries_;
+};
+
+}  // namespace opcua
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+
+#include "open62541pp/Span.h"
+#include "open62541pp/types/Builtin.h"  // ByteString
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua {
+
+// forward declaration
+class Server;
+
+/**
+ * Value backend for variable nodes with rarely changing values (e.g. configuration arrays or large
+ * string tables).
+ *
+ * Registered nodes keep their value in the cache, which is installed as data source backend
+ * (Server::setVariableNodeValueBackend). Reads return a deep copy of the cached value, the server
+ * might still use it while writes or setValue replace the cached value. Numeric ranges are
+ * extracted from the copy. Writes replace the cached value and invalidate its cached binary
+ * encoding.
+ *
+ * The binary encoding of the value (Variant) is created on demand by getEncoded and kept until the
+ * next write, e.g. to forward the value over other transports without re-encoding it.
+ *
+ * The cache must be used from the server thread (or before the server runs) and must outlive the
+ * server.
+ * @code
+ * StaticValueCache cache;
+ * cache.registerNode(server, tableId);  // takes the current value of the node
+ * @endcode
+ *
+ * @note open62541 encodes read responses internally, cached encodings can not be spliced into
+ * responses.
+ */
+class StaticValueCache {
+public:
+    StaticValueCache() = default;
+    ~StaticValueCache() = default;
+
+    StaticValueCache(const StaticValueCache&) = delete;
+    StaticValueCache(StaticValueCache&&) noexcept = delete;
+    StaticValueCache& operator=(const StaticValueCache&) = delete;
+    StaticValueCache& operator=(StaticValueCache&&) noexcept = delete;
+
+    /**
+     * Register a variable node and set the cache as its value backend.
+     * The current value of the node is taken as initial cached value.
+     * @exception BadStatus If the value can not be read or the value backend can not be set
+     */
+    void registerNode(Server& server, const NodeId& id);
+
+    /// Set the cached value of a registered node, invalidates the cached encoding.
+    /// @exception BadStatus (BadNodeIdUnknown) If the node is not registered
+    void setValue(const NodeId& id, DataValue value);
+
+    /// Get the cached value of a registered node.
+    /// @exception BadStatus (BadNodeIdUnknown) If the node is not registered
+    const DataValue& getValue(const NodeId& id) const;
+
+    /**
+     * Get the binary encoding of the cached value (Variant), encoded on first use after a change.
+     * The returned view is valid until the next write of the node.
+     * @exception BadStatus (BadNodeIdUnknown) If the node is not registered
+     * @exception BadStatus If the encoding fails
+     */
+    Span<const uint8_t> getEncoded(const NodeId& id);
+
+    /// Number of registered nodes.
+    size_t size() const noexcept {
+        return entries_.size();
+    }
+
+private:
+    struct Entry {
+        DataValue value;
+        ByteString encoded;
+        bool encodedValid{false};
+    };
+
+    Entry& getEntry(const NodeId& id) const;
+
+    std::unordered_map<NodeId, std::unique_ptr<Entry>> entries_;
+};
+
+}  // namespace opcua
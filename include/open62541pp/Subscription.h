@@ -7,6 +7,7 @@
 #include "open62541pp/Common.h"
 #include "open62541pp/Config.h"
 #include "open62541pp/MonitoredItem.h"
+#include "open62541pp/SubscriptionStatistics.h"
 #include "open62541pp/services/MonitoredItem.h"
 #include "open62541pp/services/Subscription.h"
 #include "open62541pp/types/NodeId.h"
@@ -19,6 +20,7 @@ namespace opcua {
 class Client;
 class DataValue;
 class EventFilter;
+class ReadValueId;
 class Server;
 template <typename T>
 class Span;
@@ -26,6 +28,9 @@ class Variant;
 
 using SubscriptionParameters = services::SubscriptionParameters;
 using MonitoringParameters = services::MonitoringParameters;
+using MonitoredItemResult = services::MonitoredItemResult;
+using RecoveredSubscription = services::RecoveredSubscription;
+using DataChangeBatchCallback = services::DataChangeBatchCallback;
 
 /// Data change notification callback.
 /// @tparam T Server or Client
@@ -71,6 +76,13 @@ public:
     /// Get all local monitored items.
     std::vector<MonitoredItem<ServerOrClient>> getMonitoredItems();
 
+    /// Get the health statistics of this subscription.
+    /// The counters are recorded lock-free by the notification callbacks and can be read from any
+    /// thread.
+    /// @note Not implemented for Server.
+    /// @see SubscriptionStatistics
+    SubscriptionStatistics getStatistics() const;
+
     /// Modify this subscription.
     /// @note Not implemented for Server.
     /// @see services::modifySubscription
@@ -99,6 +111,18 @@ public:
         DataChangeCallback<ServerOrClient> onDataChange
     );
 
+    /// Create many monitored items for data change notifications with batched requests.
+    /// The items share the monitoring mode, the requested parameters and the callback.
+    /// @returns Per-item results in the order of `itemsToMonitor`
+    /// @note Not implemented for Server.
+    /// @see services::createMonitoredItemsDataChange
+    std::vector<MonitoredItemResult> subscribeDataChangeMany(
+        Span<const ReadValueId> itemsToMonitor,
+        MonitoringMode monitoringMode,
+        const MonitoringParameters& parameters,
+        DataChangeCallback<ServerOrClient> onDataChange
+    );
+
     /// Create a monitored item for event notifications (default settings).
     /// The monitoring mode is set to MonitoringMode::Reporting and the default open62541
     /// MonitoringParameters are used.
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <utility>  // pair
+#include <vector>
+
+#include "open62541pp/Common.h"
+#include "open62541pp/Config.h"
+#include "open62541pp/Subscription.h"
+#include "open62541pp/services/MonitoredItem.h"
+#include "open62541pp/services/Subscription.h"
+#include "open62541pp/types/Composed.h"  // ReadValueId
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+namespace opcua {
+
+// forward declarations
+class Client;
+class DataValue;
+
+/**
+ * Group of client subscriptions that spreads monitored items over multiple subscriptions.
+ *
+ * Large subscriptions lead to huge publish responses and head-of-line blocking. The group assigns
+ * monitored items to subscriptions by their requested sampling interval and priority (one set of
+ * subscriptions per combination) with at most `maxItemsPerSubscription` items per subscription.
+ * The publishing interval of the subscriptions is set to the sampling interval of their items.
+ *
+ * Items are identified by group-assigned identifiers, that stay valid if items are moved to other
+ * subscriptions by rebalance.
+ * @code
+ * SubscriptionGroup group(client, 1000);
+ * MonitoringParameters parameters{};
+ * const auto id = group.subscribeDataChange(
+ *     {nodeId, AttributeId::Value}, parameters, [](uint32_t itemId, const DataValue& value) {}
+ * );
+ * group.unsubscribe(id);
+ * @endcode
+ */
+class SubscriptionGroup {
+public:
+    /// Data change notification callback with the group-assigned item identifier.
+    using DataChangeCallback = std::function<void(uint32_t itemId, const DataValue& value)>;
+
+    /**
+     * Create an empty group.
+     * @param client Connected client
+     * @param maxItemsPerSubscription Maximum number of monitored items per subscription
+     * @param parameters Parameters of created subscriptions, the publishing interval is replaced
+     *                   by the sampling interval of the items (if positive)
+     */
+    explicit SubscriptionGroup(
+        Client& client,
+        size_t maxItemsPerSubscription = 1000,
+        SubscriptionParameters parameters = {}
+    );
+
+    /// Delete all subscriptions of the group.
+    ~SubscriptionGroup();
+
+    SubscriptionGroup(const SubscriptionGroup&) = delete;
+    SubscriptionGroup(SubscriptionGroup&&) noexcept = delete;
+    SubscriptionGroup& operator=(const SubscriptionGroup&) = delete;
+    SubscriptionGroup& operator=(SubscriptionGroup&&) noexcept = delete;
+
+    /**
+     * Create a monitored item for data change notifications in a subscription of the group.
+     * @param itemToMonitor Item to monitor
+     * @param parameters Monitoring parameters, may be revised by server
+     * @param onDataChange Invoked when the monitored item is changed
+     * @param priority Relative priority of the subscription of the item
+     * @param monitoringMode Monitoring mode
+     * @returns Group-assigned identifier of the item
+     */
+    uint32_t subscribeDataChange(
+        const ReadValueId& itemToMonitor,
+        MonitoringParameters& parameters,
+        DataChangeCallback onDataChange,
+        uint8_t priority = 0,
+        MonitoringMode monitoringMode = MonitoringMode::Reporting
+    );
+
+    /// Delete a monitored item of the group.
+    /// Subscriptions without monitored items are deleted.
+    /// @exception BadStatus (BadMonitoredItemIdInvalid) If the item is not part of the group
+    void unsubscribe(uint32_t itemId);
+
+    /**
+     * Move items to fill up the subscriptions and delete the emptied subscriptions.
+     * Items are moved (deleted and created again) from the least filled subscriptions, until each
+     * combination of sampling interval and priority uses the minimum number of subscriptions.
+     * @returns Number of moved items
+     */
+    size_t rebalance();
+
+    /// Get the current monitored item of a group item.
+    /// @exception BadStatus (BadMonitoredItemIdInvalid) If the item is not part of the group
+    MonitoredItem<Client> getMonitoredItem(uint32_t itemId);
+
+    /// Get all subscriptions of the group.
+    std::vector<Subscription<Client>> getSubscriptions();
+
+    /// Number of items of the group.
+    size_t size() const noexcept {
+        return items_.size();
+    }
+
+private:
+    using BucketKey = std::pair<double, uint8_t>;  // sampling interval, priority
+
+    struct Item {
+        ReadValueId itemToMonitor;
+        MonitoringMode monitoringMode;
+        MonitoringParameters parameters;
+        std::shared_ptr<DataChangeCallback> callback;
+        BucketKey key;
+        uint32_t subscriptionId;
+        uint32_t monitoredItemId;
+    };
+
+    struct Shard {
+        uint32_t subscriptionId;
+        size_t count;
+    };
+
+    Shard& acquireShard(const BucketKey& key);
+    void releaseShard(const BucketKey& key, uint32_t subscriptionId);
+    void createMonitoredItem(uint32_t itemId, Item& item);
+
+    Client& client_;
+    size_t maxItemsPerSubscription_;
+    SubscriptionParameters parameters_;
+    std::map<BucketKey, std::vector<Shard>> buckets_;
+    std::unordered_map<uint32_t, Item> items_;
+    uint32_t nextItemId_{1};
+};
+
+}  // namespace opcua
+
+#endif
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#include "open62541pp/ServerMetrics.h"  // LatencyHistogram
+
+namespace opcua {
+
+/**
+ * Health statistics of a client monitored item, recorded when notifications are received.
+ * The latency is measured from the SourceTimestamp of data changes to the receipt by the client
+ * and includes the clock offset between the data source and the client. Negative latencies are
+ * clamped to zero.
+ * @see MonitoredItem::getStatistics
+ */
+struct MonitoredItemStatistics {
+    uint64_t notifications = 0;  ///< Data change or event notifications received
+    uint64_t overflows = 0;  ///< Data changes with the overflow bit (queue overflow on the server)
+    uint64_t latencyCount = 0;  ///< Data changes with SourceTimestamp
+    std::chrono::nanoseconds latencySum{0};  ///< Sum of the latencies, divide by latencyCount
+    std::chrono::nanoseconds latencyMax{0};  ///< Maximum latency
+};
+
+/**
+ * Health statistics of a client subscription, recorded when notifications are received.
+ * @see Subscription::getStatistics
+ */
+struct SubscriptionStatistics {
+    uint64_t notifications = 0;  ///< Notifications of all monitored items
+    uint64_t overflows = 0;  ///< Data changes with the overflow bit of all monitored items
+    uint64_t statusChanges = 0;  ///< StatusChangeNotifications, e.g. `BadTimeout`
+    /// Intervals without publish response (not even a keep-alive) within the keep-alive time
+    uint64_t inactivityTimeouts = 0;
+    LatencyHistogram latency;  ///< Latency from SourceTimestamp to receipt of all data changes
+};
+
+}  // namespace opcua
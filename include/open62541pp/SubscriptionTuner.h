@@ -0,0 +1,139 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+#include "open62541pp/Config.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/Subscription.h"
+#include "open62541pp/services/MonitoredItem.h"
+#include "open62541pp/services/Subscription.h"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+namespace opcua {
+
+// forward declarations
+class Client;
+class DataValue;
+
+/**
+ * Bounds and targets of the SubscriptionTuner.
+ * Intervals and latencies are given in milliseconds.
+ */
+struct SubscriptionTuning {
+    double minPublishingInterval = 50.0;
+    double maxPublishingInterval = 5000.0;
+    uint32_t minQueueSize = 1;
+    uint32_t maxQueueSize = 100;
+    /// Bounds of `maxNotificationsPerPublish`, the limit is not tuned if the upper bound is `0`.
+    uint32_t minNotificationsPerPublish = 100;
+    uint32_t maxNotificationsPerPublish = 0;
+    /// Target latency between the server timestamps of the values and their reception.
+    double targetLatency = 1000.0;
+};
+
+/**
+ * Load statistics of a subscription since the last adjustment.
+ */
+struct SubscriptionStatistics {
+    size_t notificationCount = 0;
+    double notificationRate = 0.0;  ///< Notifications per second
+    double meanLatency = 0.0;  ///< Mean latency in milliseconds, `0` without timestamps
+    size_t overflowCount = 0;  ///< Notifications with the overflow bit set
+};
+
+/**
+ * Controller to adapt the parameters of a client subscription and its monitored items to the
+ * observed load.
+ *
+ * The notifications are passed to observe, e.g. from the (batched) data change callbacks. Each
+ * call of adjust evaluates the statistics since the last call and modifies the parameters within
+ * the bounds of SubscriptionTuning:
+ * - The queue size of monitored items with queue overflows (overflow bit of the value's status
+ *   code) is doubled. Only monitored items registered with addMonitoredItem are tuned.
+ * - The publishing interval is halved if queues overflowed or the mean latency exceeds the target
+ *   latency, and increased by 50 % if the mean latency is below half of the target latency
+ *   (less publish responses with more notifications).
+ * - `maxNotificationsPerPublish` is set to twice the expected notifications per publish (optional)
+ *
+ * Call adjust periodically, e.g. every few seconds, from the thread running the client loop.
+ * @code
+ * SubscriptionParameters parameters{};
+ * auto sub = client.createSubscription(parameters);
+ * SubscriptionTuner tuner(sub, parameters);
+ * MonitoringParameters monitoringParameters{};
+ * auto mon = sub.subscribeDataChange(id, AttributeId::Value, MonitoringMode::Reporting,
+ *     monitoringParameters, [&](const auto& item, const DataValue& value) {
+ *         tuner.observe(item.getMonitoredItemId(), value);
+ *     });
+ * tuner.addMonitoredItem(mon.getMonitoredItemId(), monitoringParameters);
+ * @endcode
+ */
+class SubscriptionTuner {
+public:
+    /// Create tuner of a subscription with its current (revised) parameters.
+    SubscriptionTuner(
+        Subscription<Client> subscription,
+        const SubscriptionParameters& parameters,
+        SubscriptionTuning tuning = {}
+    );
+
+    /// Register a monitored item (with its current parameters) to tune its queue size.
+    void addMonitoredItem(uint32_t monitoredItemId, const MonitoringParameters& parameters);
+    /// Unregister a monitored item.
+    void removeMonitoredItem(uint32_t monitoredItemId);
+
+    /// Record a data change notification.
+    void observe(uint32_t monitoredItemId, const DataValue& value);
+    /// Record batched data change notifications.
+    void observe(Span<const services::MonitoredItemNotification> notifications);
+
+    /// Get the statistics since the last adjustment.
+    SubscriptionStatistics getStatistics() const;
+
+    /**
+     * Evaluate the statistics since the last call and modify the parameters if required.
+     * @return `true` if parameters of the subscription or monitored items were modified
+     * @exception BadStatus If the modification of parameters failed
+     */
+    bool adjust();
+
+    /// Get the current (revised) subscription parameters.
+    const SubscriptionParameters& getParameters() const noexcept {
+        return parameters_;
+    }
+
+    /// Get the current (revised) monitoring parameters of a registered monitored item.
+    /// @exception BadStatus (BadMonitoredItemIdInvalid) If the item is not registered
+    MonitoringParameters getMonitoringParameters(uint32_t monitoredItemId) const;
+
+private:
+    struct Item {
+        MonitoringParameters parameters;
+        bool overflow = false;
+    };
+
+    void observeLocked(uint32_t monitoredItemId, const DataValue& value, int64_t now);
+    SubscriptionStatistics getStatisticsLocked() const;
+    void resetLocked();
+
+    Subscription<Client> subscription_;
+    SubscriptionParameters parameters_;
+    SubscriptionTuning tuning_;
+
+    mutable std::mutex mutex_;
+    std::unordered_map<uint32_t, Item> items_;
+    std::chrono::steady_clock::time_point since_;
+    size_t notificationCount_{0};
+    size_t latencyCount_{0};
+    double latencySum_{0.0};
+    size_t overflowCount_{0};
+};
+
+}  // namespace opcua
+
+#endif
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+
+namespace opcua {
+
+/**
+ * Settings of the OPC UA TCP transport (UA Connection Protocol) of a Server or Client.
+ *
+ * The buffer sizes limit the size of a single message chunk and are negotiated with the peer in
+ * the Hello/Acknowledge handshake (the smaller values of both sides apply). Messages larger than a
+ * chunk are split into several chunks, up to the maximum chunk count and message size.
+ * The defaults match the defaults of open62541.
+ * @note TCP_NODELAY is always enabled by open62541.
+ * @see https://reference.opcfoundation.org/Core/Part6/v105/docs/7.1.2.3
+ */
+struct TransportSettings {
+    /// Maximum size of sent message chunks in bytes.
+    uint32_t sendBufferSize = 65535;
+    /// Maximum size of received message chunks in bytes.
+    uint32_t recvBufferSize = 65535;
+    /// Maximum size of a received message in bytes, 0 for no limit.
+    uint32_t maxMessageSize = 0;
+    /// Maximum number of chunks of a received message, 0 for no limit.
+    uint32_t maxChunkCount = 0;
+
+    /**
+     * Preset for large payloads, e.g. reads of large arrays or history data.
+     * Large chunks reduce the number of chunks, headers and receive calls per message; the
+     * message size and chunk count are not limited.
+     */
+    static constexpr TransportSettings largePayload() noexcept {
+        return {1U << 20U, 1U << 20U, 0, 0};
+    }
+
+    /**
+     * Preset for low latency with small messages.
+     * Every message must fit into a single chunk of the default size. Oversized messages are
+     * rejected immediately instead of occupying the connection with many chunks (head-of-line
+     * blocking of the following requests).
+     */
+    static constexpr TransportSettings lowLatency() noexcept {
+        return {65535, 65535, 65535, 1};
+    }
+};
+
+}  // namespace opcua
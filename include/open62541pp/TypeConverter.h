@@ -7,6 +7,7 @@
 #include <type_traits>
 
 #include "open62541pp/Common.h"  // TypeIndex
+#include "open62541pp/Span.h"
 #include "open62541pp/open62541.h"
 #include "open62541pp/types/Builtin.h"
 #include "open62541pp/types/DateTime.h"
@@ -44,6 +45,14 @@ struct [[deprecated(
  * Native types can be both `UA_*` types and wrapper classes (like `UA_Guid` and `Guid`).
  * The `TypeConverter` is mainly used within the `Variant` class to set/get non-native types.
  *
+ * Optionally, a static `toNativeView(const T&)` function can be provided, that returns a native
+ * object referencing the data of `T` without copy. It is used by BorrowedVariant.
+ *
+ * Arrays are converted element by element. For large arrays, the static functions
+ * `toNativeArray(const T* src, size_t size, NativeType* dst)` and
+ * `fromNativeArray(const NativeType* src, size_t size, T* dst)` can be provided to convert
+ * contiguous arrays in one go. They are preferred by `Variant` if available.
+ *
  * Template specializations can be added for conversions of arbitrary types:
  * @code
  * namespace ::opcua {
@@ -78,6 +87,49 @@ struct IsConvertibleType<T, std::void_t<decltype(TypeConverter<T>{})>> : std::tr
 template <typename T>
 inline constexpr bool isConvertibleType = IsConvertibleType<T>::value;
 
+/// Check if `TypeConverter<T>` provides a `toNativeView` function to reference `T` without copy.
+template <typename T, typename = void>
+struct IsBorrowableType : std::false_type {};
+
+template <typename T>
+struct IsBorrowableType<
+    T,
+    std::void_t<decltype(TypeConverter<T>::toNativeView(std::declval<const T&>()))>>
+    : std::true_type {};
+
+template <typename T>
+inline constexpr bool isBorrowableType = IsBorrowableType<T>::value;
+
+/// Check if `TypeConverter<T>` provides a `toNativeArray` function for bulk conversion.
+template <typename T, typename = void>
+struct HasToNativeArray : std::false_type {};
+
+template <typename T>
+struct HasToNativeArray<
+    T,
+    std::void_t<decltype(TypeConverter<T>::toNativeArray(
+        std::declval<const T*>(),
+        size_t{},
+        std::declval<typename TypeConverter<T>::NativeType*>()
+    ))>> : std::true_type {};
+
+template <typename T>
+inline constexpr bool hasToNativeArray = HasToNativeArray<T>::value;
+
+/// Check if `TypeConverter<T>` provides a `fromNativeArray` function for bulk conversion.
+template <typename T, typename = void>
+struct HasFromNativeArray : std::false_type {};
+
+template <typename T>
+struct HasFromNativeArray<
+    T,
+    std::void_t<decltype(TypeConverter<T>::fromNativeArray(
+        std::declval<const typename TypeConverter<T>::NativeType*>(), size_t{}, std::declval<T*>()
+    ))>> : std::true_type {};
+
+template <typename T>
+inline constexpr bool hasFromNativeArray = HasFromNativeArray<T>::value;
+
 }  // namespace detail
 
 /* ---------------------------------- Template specializations ---------------------------------- */
@@ -94,20 +146,30 @@ struct TypeConverter<std::string_view> {
     static void toNative(std::string_view src, NativeType& dst) {
         dst = String(src);
     }
+
+    static UA_String toNativeView(std::string_view src) noexcept {
+        return detail::toNativeString(src);
+    }
 };
 
-template <>
-struct TypeConverter<std::string> {
-    using ValueType = std::string;
+/// Conversion of strings with any allocator, e.g. `std::string` and `std::pmr::string`.
+/// The allocator of the destination string is kept.
+template <typename Allocator>
+struct TypeConverter<std::basic_string<char, std::char_traits<char>, Allocator>> {
+    using ValueType = std::basic_string<char, std::char_traits<char>, Allocator>;
     using NativeType = String;
 
     static void fromNative(const NativeType& src, ValueType& dst) {
-        dst = src.get();
+        dst.assign(src.get());
     }
 
     static void toNative(const ValueType& src, NativeType& dst) {
         dst = String(src);
     }
+
+    static UA_String toNativeView(const ValueType& src) noexcept {
+        return detail::toNativeString(src);
+    }
 };
 
 template <>
@@ -118,6 +180,10 @@ struct TypeConverter<const char*> {
     static void toNative(const char* src, NativeType& dst) {
         dst = String(src);
     }
+
+    static UA_String toNativeView(const char* src) noexcept {
+        return detail::toNativeString(src);
+    }
 };
 
 template <size_t N>
@@ -142,6 +208,14 @@ struct TypeConverter<std::chrono::time_point<Clock, Duration>> {
     static void toNative(const ValueType& src, NativeType& dst) {
         dst = DateTime::fromTimePoint(src);
     }
+
+    static void fromNativeArray(const NativeType* src, size_t size, ValueType* dst) noexcept {
+        DateTime::toTimePoints(Span<const NativeType>(src, size), dst);
+    }
+
+    static void toNativeArray(const ValueType* src, size_t size, NativeType* dst) noexcept {
+        DateTime::fromTimePoints(Span<const ValueType>(src, size), dst);
+    }
 };
 
 }  // namespace opcua
@@ -0,0 +1,37 @@
+#pragma once
+
+// lightweight forward declarations of the type registry without the open62541 headers and the
+// template specializations of the native types
+
+struct UA_DataType;
+
+namespace opcua {
+
+/**
+ * Type registry.
+ *
+ * The type registry is used to derive the corresponding `UA_DataType` object from template types.
+ * The template specializations for the native types are split into headers per type family
+ * (`open62541pp/typeregistry/<Family>.h`). Include `open62541pp/TypeRegistry.h` for all of them.
+ *
+ * Custom data types can be registered with template specializations:
+ * @code
+ * namespace ::opcua {
+ * template <>
+ * struct TypeRegistry<MyCustomType> {
+ *     static const UA_DataType& getDataType() noexcept {
+ *         // ...
+ *     }
+ * };
+ * }
+ * @endcode
+ */
+template <typename T, typename Enabled = void>
+struct TypeRegistry;
+
+/// Get the data type of a registered template type.
+/// Resolves to a constant address (e.g. `&UA_TYPES[N]`) for native types and TypeWrapper types.
+template <typename T>
+constexpr const UA_DataType& getDataType() noexcept;
+
+}  // namespace opcua
@@ -4,731 +4,8 @@
 
 #pragma once
 
-#include "open62541pp/TypeRegistry.h"
-#include "open62541pp/open62541.h"
-
-namespace opcua {
-
-// clang-format off
-
-#ifdef UA_TYPES_ACTIVATESESSIONREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_ActivateSessionRequest, UA_TYPES_ACTIVATESESSIONREQUEST)
-#endif
-#ifdef UA_TYPES_ACTIVATESESSIONRESPONSE
-UAPP_TYPEREGISTRY_NATIVE(UA_ActivateSessionResponse, UA_TYPES_ACTIVATESESSIONRESPONSE)
-#endif
-#ifdef UA_TYPES_ADDNODESITEM
-UAPP_TYPEREGISTRY_NATIVE(UA_AddNodesItem, UA_TYPES_ADDNODESITEM)
-#endif
-#ifdef UA_TYPES_ADDNODESREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_AddNodesRequest, UA_TYPES_ADDNODESREQUEST)
-#endif
-#ifdef UA_TYPES_ADDNODESRESPONSE
-UAPP_TYPEREGISTRY_NATIVE(UA_AddNodesResponse, UA_TYPES_ADDNODESRESPONSE)
-#endif
-#ifdef UA_TYPES_ADDNODESRESULT
-UAPP_TYPEREGISTRY_NATIVE(UA_AddNodesResult, UA_TYPES_ADDNODESRESULT)
-#endif
-#ifdef UA_TYPES_ADDREFERENCESITEM
-UAPP_TYPEREGISTRY_NATIVE(UA_AddReferencesItem, UA_TYPES_ADDREFERENCESITEM)
-#endif
-#ifdef UA_TYPES_ADDREFERENCESREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_AddReferencesRequest, UA_TYPES_ADDREFERENCESREQUEST)
-#endif
-#ifdef UA_TYPES_ADDREFERENCESRESPONSE
-UAPP_TYPEREGISTRY_NATIVE(UA_AddReferencesResponse, UA_TYPES_ADDREFERENCESRESPONSE)
-#endif
-#ifdef UA_TYPES_AGGREGATECONFIGURATION
-UAPP_TYPEREGISTRY_NATIVE(UA_AggregateConfiguration, UA_TYPES_AGGREGATECONFIGURATION)
-#endif
-#ifdef UA_TYPES_AGGREGATEFILTER
-UAPP_TYPEREGISTRY_NATIVE(UA_AggregateFilter, UA_TYPES_AGGREGATEFILTER)
-#endif
-#ifdef UA_TYPES_ANONYMOUSIDENTITYTOKEN
-UAPP_TYPEREGISTRY_NATIVE(UA_AnonymousIdentityToken, UA_TYPES_ANONYMOUSIDENTITYTOKEN)
-#endif
-#ifdef UA_TYPES_APPLICATIONDESCRIPTION
-UAPP_TYPEREGISTRY_NATIVE(UA_ApplicationDescription, UA_TYPES_APPLICATIONDESCRIPTION)
-#endif
-#ifdef UA_TYPES_APPLICATIONTYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_ApplicationType, UA_TYPES_APPLICATIONTYPE)
-#endif
-#ifdef UA_TYPES_ARGUMENT
-UAPP_TYPEREGISTRY_NATIVE(UA_Argument, UA_TYPES_ARGUMENT)
-#endif
-#ifdef UA_TYPES_ATTRIBUTEOPERAND
-UAPP_TYPEREGISTRY_NATIVE(UA_AttributeOperand, UA_TYPES_ATTRIBUTEOPERAND)
-#endif
-#ifdef UA_TYPES_AXISINFORMATION
-UAPP_TYPEREGISTRY_NATIVE(UA_AxisInformation, UA_TYPES_AXISINFORMATION)
-#endif
-#ifdef UA_TYPES_AXISSCALEENUMERATION
-UAPP_TYPEREGISTRY_NATIVE(UA_AxisScaleEnumeration, UA_TYPES_AXISSCALEENUMERATION)
-#endif
-#ifdef UA_TYPES_BROKERCONNECTIONTRANSPORTDATATYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_BrokerConnectionTransportDataType, UA_TYPES_BROKERCONNECTIONTRANSPORTDATATYPE)
-#endif
-#ifdef UA_TYPES_BROKERDATASETREADERTRANSPORTDATATYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_BrokerDataSetReaderTransportDataType, UA_TYPES_BROKERDATASETREADERTRANSPORTDATATYPE)
-#endif
-#ifdef UA_TYPES_BROKERDATASETWRITERTRANSPORTDATATYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_BrokerDataSetWriterTransportDataType, UA_TYPES_BROKERDATASETWRITERTRANSPORTDATATYPE)
-#endif
-#ifdef UA_TYPES_BROKERTRANSPORTQUALITYOFSERVICE
-UAPP_TYPEREGISTRY_NATIVE(UA_BrokerTransportQualityOfService, UA_TYPES_BROKERTRANSPORTQUALITYOFSERVICE)
-#endif
-#ifdef UA_TYPES_BROKERWRITERGROUPTRANSPORTDATATYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_BrokerWriterGroupTransportDataType, UA_TYPES_BROKERWRITERGROUPTRANSPORTDATATYPE)
-#endif
-#ifdef UA_TYPES_BROKERWRITERGROUPTRANSPORTTYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_BrokerWriterGroupTransportType, UA_TYPES_BROKERWRITERGROUPTRANSPORTTYPE)
-#endif
-#ifdef UA_TYPES_BROWSEDESCRIPTION
-UAPP_TYPEREGISTRY_NATIVE(UA_BrowseDescription, UA_TYPES_BROWSEDESCRIPTION)
-#endif
-#ifdef UA_TYPES_BROWSEDIRECTION
-UAPP_TYPEREGISTRY_NATIVE(UA_BrowseDirection, UA_TYPES_BROWSEDIRECTION)
-#endif
-#ifdef UA_TYPES_BROWSENEXTREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_BrowseNextRequest, UA_TYPES_BROWSENEXTREQUEST)
-#endif
-#ifdef UA_TYPES_BROWSENEXTRESPONSE
-UAPP_TYPEREGISTRY_NATIVE(UA_BrowseNextResponse, UA_TYPES_BROWSENEXTRESPONSE)
-#endif
-#ifdef UA_TYPES_BROWSEPATH
-UAPP_TYPEREGISTRY_NATIVE(UA_BrowsePath, UA_TYPES_BROWSEPATH)
-#endif
-#ifdef UA_TYPES_BROWSEPATHRESULT
-UAPP_TYPEREGISTRY_NATIVE(UA_BrowsePathResult, UA_TYPES_BROWSEPATHRESULT)
-#endif
-#ifdef UA_TYPES_BROWSEPATHTARGET
-UAPP_TYPEREGISTRY_NATIVE(UA_BrowsePathTarget, UA_TYPES_BROWSEPATHTARGET)
-#endif
-#ifdef UA_TYPES_BROWSEREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_BrowseRequest, UA_TYPES_BROWSEREQUEST)
-#endif
-#ifdef UA_TYPES_BROWSERESPONSE
-UAPP_TYPEREGISTRY_NATIVE(UA_BrowseResponse, UA_TYPES_BROWSERESPONSE)
-#endif
-#ifdef UA_TYPES_BROWSERESULT
-UAPP_TYPEREGISTRY_NATIVE(UA_BrowseResult, UA_TYPES_BROWSERESULT)
-#endif
-#ifdef UA_TYPES_BROWSERESULTMASK
-UAPP_TYPEREGISTRY_NATIVE(UA_BrowseResultMask, UA_TYPES_BROWSERESULTMASK)
-#endif
-#ifdef UA_TYPES_BUILDINFO
-UAPP_TYPEREGISTRY_NATIVE(UA_BuildInfo, UA_TYPES_BUILDINFO)
-#endif
-#ifdef UA_TYPES_CALLMETHODREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_CallMethodRequest, UA_TYPES_CALLMETHODREQUEST)
-#endif
-#ifdef UA_TYPES_CALLMETHODRESULT
-UAPP_TYPEREGISTRY_NATIVE(UA_CallMethodResult, UA_TYPES_CALLMETHODRESULT)
-#endif
-#ifdef UA_TYPES_CALLREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_CallRequest, UA_TYPES_CALLREQUEST)
-#endif
-#ifdef UA_TYPES_CALLRESPONSE
-UAPP_TYPEREGISTRY_NATIVE(UA_CallResponse, UA_TYPES_CALLRESPONSE)
-#endif
-#ifdef UA_TYPES_CHANNELSECURITYTOKEN
-UAPP_TYPEREGISTRY_NATIVE(UA_ChannelSecurityToken, UA_TYPES_CHANNELSECURITYTOKEN)
-#endif
-#ifdef UA_TYPES_CLOSESECURECHANNELREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_CloseSecureChannelRequest, UA_TYPES_CLOSESECURECHANNELREQUEST)
-#endif
-#ifdef UA_TYPES_CLOSESECURECHANNELRESPONSE
-UAPP_TYPEREGISTRY_NATIVE(UA_CloseSecureChannelResponse, UA_TYPES_CLOSESECURECHANNELRESPONSE)
-#endif
-#ifdef UA_TYPES_CLOSESESSIONREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_CloseSessionRequest, UA_TYPES_CLOSESESSIONREQUEST)
-#endif
-#ifdef UA_TYPES_CLOSESESSIONRESPONSE
-UAPP_TYPEREGISTRY_NATIVE(UA_CloseSessionResponse, UA_TYPES_CLOSESESSIONRESPONSE)
-#endif
-#ifdef UA_TYPES_COMPLEXNUMBERTYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_ComplexNumberType, UA_TYPES_COMPLEXNUMBERTYPE)
-#endif
-#ifdef UA_TYPES_CONFIGURATIONVERSIONDATATYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_ConfigurationVersionDataType, UA_TYPES_CONFIGURATIONVERSIONDATATYPE)
-#endif
-#ifdef UA_TYPES_CONTENTFILTER
-UAPP_TYPEREGISTRY_NATIVE(UA_ContentFilter, UA_TYPES_CONTENTFILTER)
-#endif
-#ifdef UA_TYPES_CONTENTFILTERELEMENT
-UAPP_TYPEREGISTRY_NATIVE(UA_ContentFilterElement, UA_TYPES_CONTENTFILTERELEMENT)
-#endif
-#ifdef UA_TYPES_CONTENTFILTERELEMENTRESULT
-UAPP_TYPEREGISTRY_NATIVE(UA_ContentFilterElementResult, UA_TYPES_CONTENTFILTERELEMENTRESULT)
-#endif
-#ifdef UA_TYPES_CONTENTFILTERRESULT
-UAPP_TYPEREGISTRY_NATIVE(UA_ContentFilterResult, UA_TYPES_CONTENTFILTERRESULT)
-#endif
-#ifdef UA_TYPES_CREATEMONITOREDITEMSREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_CreateMonitoredItemsRequest, UA_TYPES_CREATEMONITOREDITEMSREQUEST)
-#endif
-#ifdef UA_TYPES_CREATEMONITOREDITEMSRESPONSE
-UAPP_TYPEREGISTRY_NATIVE(UA_CreateMonitoredItemsResponse, UA_TYPES_CREATEMONITOREDITEMSRESPONSE)
-#endif
-#ifdef UA_TYPES_CREATESESSIONREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_CreateSessionRequest, UA_TYPES_CREATESESSIONREQUEST)
-#endif
-#ifdef UA_TYPES_CREATESESSIONRESPONSE
-UAPP_TYPEREGISTRY_NATIVE(UA_CreateSessionResponse, UA_TYPES_CREATESESSIONRESPONSE)
-#endif
-#ifdef UA_TYPES_CREATESUBSCRIPTIONREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_CreateSubscriptionRequest, UA_TYPES_CREATESUBSCRIPTIONREQUEST)
-#endif
-#ifdef UA_TYPES_CREATESUBSCRIPTIONRESPONSE
-UAPP_TYPEREGISTRY_NATIVE(UA_CreateSubscriptionResponse, UA_TYPES_CREATESUBSCRIPTIONRESPONSE)
-#endif
-#ifdef UA_TYPES_DATACHANGEFILTER
-UAPP_TYPEREGISTRY_NATIVE(UA_DataChangeFilter, UA_TYPES_DATACHANGEFILTER)
-#endif
-#ifdef UA_TYPES_DATACHANGENOTIFICATION
-UAPP_TYPEREGISTRY_NATIVE(UA_DataChangeNotification, UA_TYPES_DATACHANGENOTIFICATION)
-#endif
-#ifdef UA_TYPES_DATACHANGETRIGGER
-UAPP_TYPEREGISTRY_NATIVE(UA_DataChangeTrigger, UA_TYPES_DATACHANGETRIGGER)
-#endif
-#ifdef UA_TYPES_DATASETMETADATATYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_DataSetMetaDataType, UA_TYPES_DATASETMETADATATYPE)
-#endif
-#ifdef UA_TYPES_DATASETORDERINGTYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_DataSetOrderingType, UA_TYPES_DATASETORDERINGTYPE)
-#endif
-#ifdef UA_TYPES_DATASETREADERDATATYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_DataSetReaderDataType, UA_TYPES_DATASETREADERDATATYPE)
-#endif
-#ifdef UA_TYPES_DATASETWRITERDATATYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_DataSetWriterDataType, UA_TYPES_DATASETWRITERDATATYPE)
-#endif
-#ifdef UA_TYPES_DATATYPEATTRIBUTES
-UAPP_TYPEREGISTRY_NATIVE(UA_DataTypeAttributes, UA_TYPES_DATATYPEATTRIBUTES)
-#endif
-#ifdef UA_TYPES_DATAGRAMCONNECTIONTRANSPORTDATATYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_DatagramConnectionTransportDataType, UA_TYPES_DATAGRAMCONNECTIONTRANSPORTDATATYPE)
-#endif
-#ifdef UA_TYPES_DATAGRAMWRITERGROUPTRANSPORTDATATYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_DatagramWriterGroupTransportDataType, UA_TYPES_DATAGRAMWRITERGROUPTRANSPORTDATATYPE)
-#endif
-#ifdef UA_TYPES_DEADBANDTYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_DeadbandType, UA_TYPES_DEADBANDTYPE)
-#endif
-#ifdef UA_TYPES_DELETEMONITOREDITEMSREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_DeleteMonitoredItemsRequest, UA_TYPES_DELETEMONITOREDITEMSREQUEST)
-#endif
-#ifdef UA_TYPES_DELETEMONITOREDITEMSRESPONSE
-UAPP_TYPEREGISTRY_NATIVE(UA_DeleteMonitoredItemsResponse, UA_TYPES_DELETEMONITOREDITEMSRESPONSE)
-#endif
-#ifdef UA_TYPES_DELETENODESITEM
-UAPP_TYPEREGISTRY_NATIVE(UA_DeleteNodesItem, UA_TYPES_DELETENODESITEM)
-#endif
-#ifdef UA_TYPES_DELETENODESREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_DeleteNodesRequest, UA_TYPES_DELETENODESREQUEST)
-#endif
-#ifdef UA_TYPES_DELETENODESRESPONSE
-UAPP_TYPEREGISTRY_NATIVE(UA_DeleteNodesResponse, UA_TYPES_DELETENODESRESPONSE)
-#endif
-#ifdef UA_TYPES_DELETERAWMODIFIEDDETAILS
-UAPP_TYPEREGISTRY_NATIVE(UA_DeleteRawModifiedDetails, UA_TYPES_DELETERAWMODIFIEDDETAILS)
-#endif
-#ifdef UA_TYPES_DELETEREFERENCESITEM
-UAPP_TYPEREGISTRY_NATIVE(UA_DeleteReferencesItem, UA_TYPES_DELETEREFERENCESITEM)
-#endif
-#ifdef UA_TYPES_DELETEREFERENCESREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_DeleteReferencesRequest, UA_TYPES_DELETEREFERENCESREQUEST)
-#endif
-#ifdef UA_TYPES_DELETEREFERENCESRESPONSE
-UAPP_TYPEREGISTRY_NATIVE(UA_DeleteReferencesResponse, UA_TYPES_DELETEREFERENCESRESPONSE)
-#endif
-#ifdef UA_TYPES_DELETESUBSCRIPTIONSREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_DeleteSubscriptionsRequest, UA_TYPES_DELETESUBSCRIPTIONSREQUEST)
-#endif
-#ifdef UA_TYPES_DELETESUBSCRIPTIONSRESPONSE
-UAPP_TYPEREGISTRY_NATIVE(UA_DeleteSubscriptionsResponse, UA_TYPES_DELETESUBSCRIPTIONSRESPONSE)
-#endif
-#ifdef UA_TYPES_DOUBLECOMPLEXNUMBERTYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_DoubleComplexNumberType, UA_TYPES_DOUBLECOMPLEXNUMBERTYPE)
-#endif
-#ifdef UA_TYPES_EUINFORMATION
-UAPP_TYPEREGISTRY_NATIVE(UA_EUInformation, UA_TYPES_EUINFORMATION)
-#endif
-#ifdef UA_TYPES_ELEMENTOPERAND
-UAPP_TYPEREGISTRY_NATIVE(UA_ElementOperand, UA_TYPES_ELEMENTOPERAND)
-#endif
-#ifdef UA_TYPES_ENDPOINTDESCRIPTION
-UAPP_TYPEREGISTRY_NATIVE(UA_EndpointDescription, UA_TYPES_ENDPOINTDESCRIPTION)
-#endif
-#ifdef UA_TYPES_ENUMDEFINITION
-UAPP_TYPEREGISTRY_NATIVE(UA_EnumDefinition, UA_TYPES_ENUMDEFINITION)
-#endif
-#ifdef UA_TYPES_ENUMDESCRIPTION
-UAPP_TYPEREGISTRY_NATIVE(UA_EnumDescription, UA_TYPES_ENUMDESCRIPTION)
-#endif
-#ifdef UA_TYPES_ENUMFIELD
-UAPP_TYPEREGISTRY_NATIVE(UA_EnumField, UA_TYPES_ENUMFIELD)
-#endif
-#ifdef UA_TYPES_ENUMVALUETYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_EnumValueType, UA_TYPES_ENUMVALUETYPE)
-#endif
-#ifdef UA_TYPES_EVENTFIELDLIST
-UAPP_TYPEREGISTRY_NATIVE(UA_EventFieldList, UA_TYPES_EVENTFIELDLIST)
-#endif
-#ifdef UA_TYPES_EVENTFILTER
-UAPP_TYPEREGISTRY_NATIVE(UA_EventFilter, UA_TYPES_EVENTFILTER)
-#endif
-#ifdef UA_TYPES_EVENTFILTERRESULT
-UAPP_TYPEREGISTRY_NATIVE(UA_EventFilterResult, UA_TYPES_EVENTFILTERRESULT)
-#endif
-#ifdef UA_TYPES_EVENTNOTIFICATIONLIST
-UAPP_TYPEREGISTRY_NATIVE(UA_EventNotificationList, UA_TYPES_EVENTNOTIFICATIONLIST)
-#endif
-#ifdef UA_TYPES_FIELDMETADATA
-UAPP_TYPEREGISTRY_NATIVE(UA_FieldMetaData, UA_TYPES_FIELDMETADATA)
-#endif
-#ifdef UA_TYPES_FIELDTARGETDATATYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_FieldTargetDataType, UA_TYPES_FIELDTARGETDATATYPE)
-#endif
-#ifdef UA_TYPES_FILTEROPERATOR
-UAPP_TYPEREGISTRY_NATIVE(UA_FilterOperator, UA_TYPES_FILTEROPERATOR)
-#endif
-#ifdef UA_TYPES_FINDSERVERSONNETWORKREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_FindServersOnNetworkRequest, UA_TYPES_FINDSERVERSONNETWORKREQUEST)
-#endif
-#ifdef UA_TYPES_FINDSERVERSONNETWORKRESPONSE
-UAPP_TYPEREGISTRY_NATIVE(UA_FindServersOnNetworkResponse, UA_TYPES_FINDSERVERSONNETWORKRESPONSE)
-#endif
-#ifdef UA_TYPES_FINDSERVERSREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_FindServersRequest, UA_TYPES_FINDSERVERSREQUEST)
-#endif
-#ifdef UA_TYPES_FINDSERVERSRESPONSE
-UAPP_TYPEREGISTRY_NATIVE(UA_FindServersResponse, UA_TYPES_FINDSERVERSRESPONSE)
-#endif
-#ifdef UA_TYPES_GETENDPOINTSREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_GetEndpointsRequest, UA_TYPES_GETENDPOINTSREQUEST)
-#endif
-#ifdef UA_TYPES_GETENDPOINTSRESPONSE
-UAPP_TYPEREGISTRY_NATIVE(UA_GetEndpointsResponse, UA_TYPES_GETENDPOINTSRESPONSE)
-#endif
-#ifdef UA_TYPES_HISTORYDATA
-UAPP_TYPEREGISTRY_NATIVE(UA_HistoryData, UA_TYPES_HISTORYDATA)
-#endif
-#ifdef UA_TYPES_HISTORYEVENT
-UAPP_TYPEREGISTRY_NATIVE(UA_HistoryEvent, UA_TYPES_HISTORYEVENT)
-#endif
-#ifdef UA_TYPES_HISTORYEVENTFIELDLIST
-UAPP_TYPEREGISTRY_NATIVE(UA_HistoryEventFieldList, UA_TYPES_HISTORYEVENTFIELDLIST)
-#endif
-#ifdef UA_TYPES_HISTORYMODIFIEDDATA
-UAPP_TYPEREGISTRY_NATIVE(UA_HistoryModifiedData, UA_TYPES_HISTORYMODIFIEDDATA)
-#endif
-#ifdef UA_TYPES_HISTORYREADREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_HistoryReadRequest, UA_TYPES_HISTORYREADREQUEST)
-#endif
-#ifdef UA_TYPES_HISTORYREADRESPONSE
-UAPP_TYPEREGISTRY_NATIVE(UA_HistoryReadResponse, UA_TYPES_HISTORYREADRESPONSE)
-#endif
-#ifdef UA_TYPES_HISTORYREADRESULT
-UAPP_TYPEREGISTRY_NATIVE(UA_HistoryReadResult, UA_TYPES_HISTORYREADRESULT)
-#endif
-#ifdef UA_TYPES_HISTORYREADVALUEID
-UAPP_TYPEREGISTRY_NATIVE(UA_HistoryReadValueId, UA_TYPES_HISTORYREADVALUEID)
-#endif
-#ifdef UA_TYPES_HISTORYUPDATEREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_HistoryUpdateRequest, UA_TYPES_HISTORYUPDATEREQUEST)
-#endif
-#ifdef UA_TYPES_HISTORYUPDATERESPONSE
-UAPP_TYPEREGISTRY_NATIVE(UA_HistoryUpdateResponse, UA_TYPES_HISTORYUPDATERESPONSE)
-#endif
-#ifdef UA_TYPES_HISTORYUPDATERESULT
-UAPP_TYPEREGISTRY_NATIVE(UA_HistoryUpdateResult, UA_TYPES_HISTORYUPDATERESULT)
-#endif
-#ifdef UA_TYPES_HISTORYUPDATETYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_HistoryUpdateType, UA_TYPES_HISTORYUPDATETYPE)
-#endif
-#ifdef UA_TYPES_ISSUEDIDENTITYTOKEN
-UAPP_TYPEREGISTRY_NATIVE(UA_IssuedIdentityToken, UA_TYPES_ISSUEDIDENTITYTOKEN)
-#endif
-#ifdef UA_TYPES_JSONDATASETREADERMESSAGEDATATYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_JsonDataSetReaderMessageDataType, UA_TYPES_JSONDATASETREADERMESSAGEDATATYPE)
-#endif
-#ifdef UA_TYPES_JSONDATASETWRITERMESSAGEDATATYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_JsonDataSetWriterMessageDataType, UA_TYPES_JSONDATASETWRITERMESSAGEDATATYPE)
-#endif
-#ifdef UA_TYPES_JSONWRITERGROUPMESSAGEDATATYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_JsonWriterGroupMessageDataType, UA_TYPES_JSONWRITERGROUPMESSAGEDATATYPE)
-#endif
-#ifdef UA_TYPES_KEYVALUEPAIR
-UAPP_TYPEREGISTRY_NATIVE(UA_KeyValuePair, UA_TYPES_KEYVALUEPAIR)
-#endif
-#ifdef UA_TYPES_LITERALOPERAND
-UAPP_TYPEREGISTRY_NATIVE(UA_LiteralOperand, UA_TYPES_LITERALOPERAND)
-#endif
-#ifdef UA_TYPES_MDNSDISCOVERYCONFIGURATION
-UAPP_TYPEREGISTRY_NATIVE(UA_MdnsDiscoveryConfiguration, UA_TYPES_MDNSDISCOVERYCONFIGURATION)
-#endif
-#ifdef UA_TYPES_MESSAGESECURITYMODE
-UAPP_TYPEREGISTRY_NATIVE(UA_MessageSecurityMode, UA_TYPES_MESSAGESECURITYMODE)
-#endif
-#ifdef UA_TYPES_METHODATTRIBUTES
-UAPP_TYPEREGISTRY_NATIVE(UA_MethodAttributes, UA_TYPES_METHODATTRIBUTES)
-#endif
-#ifdef UA_TYPES_MODIFICATIONINFO
-UAPP_TYPEREGISTRY_NATIVE(UA_ModificationInfo, UA_TYPES_MODIFICATIONINFO)
-#endif
-#ifdef UA_TYPES_MODIFYMONITOREDITEMSREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_ModifyMonitoredItemsRequest, UA_TYPES_MODIFYMONITOREDITEMSREQUEST)
-#endif
-#ifdef UA_TYPES_MODIFYMONITOREDITEMSRESPONSE
-UAPP_TYPEREGISTRY_NATIVE(UA_ModifyMonitoredItemsResponse, UA_TYPES_MODIFYMONITOREDITEMSRESPONSE)
-#endif
-#ifdef UA_TYPES_MODIFYSUBSCRIPTIONREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_ModifySubscriptionRequest, UA_TYPES_MODIFYSUBSCRIPTIONREQUEST)
-#endif
-#ifdef UA_TYPES_MODIFYSUBSCRIPTIONRESPONSE
-UAPP_TYPEREGISTRY_NATIVE(UA_ModifySubscriptionResponse, UA_TYPES_MODIFYSUBSCRIPTIONRESPONSE)
-#endif
-#ifdef UA_TYPES_MONITOREDITEMCREATEREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_MonitoredItemCreateRequest, UA_TYPES_MONITOREDITEMCREATEREQUEST)
-#endif
-#ifdef UA_TYPES_MONITOREDITEMCREATERESULT
-UAPP_TYPEREGISTRY_NATIVE(UA_MonitoredItemCreateResult, UA_TYPES_MONITOREDITEMCREATERESULT)
-#endif
-#ifdef UA_TYPES_MONITOREDITEMMODIFYREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_MonitoredItemModifyRequest, UA_TYPES_MONITOREDITEMMODIFYREQUEST)
-#endif
-#ifdef UA_TYPES_MONITOREDITEMMODIFYRESULT
-UAPP_TYPEREGISTRY_NATIVE(UA_MonitoredItemModifyResult, UA_TYPES_MONITOREDITEMMODIFYRESULT)
-#endif
-#ifdef UA_TYPES_MONITOREDITEMNOTIFICATION
-UAPP_TYPEREGISTRY_NATIVE(UA_MonitoredItemNotification, UA_TYPES_MONITOREDITEMNOTIFICATION)
-#endif
-#ifdef UA_TYPES_MONITORINGMODE
-UAPP_TYPEREGISTRY_NATIVE(UA_MonitoringMode, UA_TYPES_MONITORINGMODE)
-#endif
-#ifdef UA_TYPES_MONITORINGPARAMETERS
-UAPP_TYPEREGISTRY_NATIVE(UA_MonitoringParameters, UA_TYPES_MONITORINGPARAMETERS)
-#endif
-#ifdef UA_TYPES_NETWORKADDRESSURLDATATYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_NetworkAddressUrlDataType, UA_TYPES_NETWORKADDRESSURLDATATYPE)
-#endif
-#ifdef UA_TYPES_NODEATTRIBUTES
-UAPP_TYPEREGISTRY_NATIVE(UA_NodeAttributes, UA_TYPES_NODEATTRIBUTES)
-#endif
-#ifdef UA_TYPES_NODEATTRIBUTESMASK
-UAPP_TYPEREGISTRY_NATIVE(UA_NodeAttributesMask, UA_TYPES_NODEATTRIBUTESMASK)
-#endif
-#ifdef UA_TYPES_NODECLASS
-UAPP_TYPEREGISTRY_NATIVE(UA_NodeClass, UA_TYPES_NODECLASS)
-#endif
-#ifdef UA_TYPES_NODETYPEDESCRIPTION
-UAPP_TYPEREGISTRY_NATIVE(UA_NodeTypeDescription, UA_TYPES_NODETYPEDESCRIPTION)
-#endif
-#ifdef UA_TYPES_NOTIFICATIONMESSAGE
-UAPP_TYPEREGISTRY_NATIVE(UA_NotificationMessage, UA_TYPES_NOTIFICATIONMESSAGE)
-#endif
-#ifdef UA_TYPES_OBJECTATTRIBUTES
-UAPP_TYPEREGISTRY_NATIVE(UA_ObjectAttributes, UA_TYPES_OBJECTATTRIBUTES)
-#endif
-#ifdef UA_TYPES_OBJECTTYPEATTRIBUTES
-UAPP_TYPEREGISTRY_NATIVE(UA_ObjectTypeAttributes, UA_TYPES_OBJECTTYPEATTRIBUTES)
-#endif
-#ifdef UA_TYPES_OPENSECURECHANNELREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_OpenSecureChannelRequest, UA_TYPES_OPENSECURECHANNELREQUEST)
-#endif
-#ifdef UA_TYPES_OPENSECURECHANNELRESPONSE
-UAPP_TYPEREGISTRY_NATIVE(UA_OpenSecureChannelResponse, UA_TYPES_OPENSECURECHANNELRESPONSE)
-#endif
-#ifdef UA_TYPES_OVERRIDEVALUEHANDLING
-UAPP_TYPEREGISTRY_NATIVE(UA_OverrideValueHandling, UA_TYPES_OVERRIDEVALUEHANDLING)
-#endif
-#ifdef UA_TYPES_PARSINGRESULT
-UAPP_TYPEREGISTRY_NATIVE(UA_ParsingResult, UA_TYPES_PARSINGRESULT)
-#endif
-#ifdef UA_TYPES_PERFORMUPDATETYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_PerformUpdateType, UA_TYPES_PERFORMUPDATETYPE)
-#endif
-#ifdef UA_TYPES_PUBSUBCONFIGURATIONDATATYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_PubSubConfigurationDataType, UA_TYPES_PUBSUBCONFIGURATIONDATATYPE)
-#endif
-#ifdef UA_TYPES_PUBSUBCONNECTIONDATATYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_PubSubConnectionDataType, UA_TYPES_PUBSUBCONNECTIONDATATYPE)
-#endif
-#ifdef UA_TYPES_PUBSUBSTATE
-UAPP_TYPEREGISTRY_NATIVE(UA_PubSubState, UA_TYPES_PUBSUBSTATE)
-#endif
-#ifdef UA_TYPES_PUBLISHREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_PublishRequest, UA_TYPES_PUBLISHREQUEST)
-#endif
-#ifdef UA_TYPES_PUBLISHRESPONSE
-UAPP_TYPEREGISTRY_NATIVE(UA_PublishResponse, UA_TYPES_PUBLISHRESPONSE)
-#endif
-#ifdef UA_TYPES_PUBLISHEDDATAITEMSDATATYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_PublishedDataItemsDataType, UA_TYPES_PUBLISHEDDATAITEMSDATATYPE)
-#endif
-#ifdef UA_TYPES_PUBLISHEDDATASETDATATYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_PublishedDataSetDataType, UA_TYPES_PUBLISHEDDATASETDATATYPE)
-#endif
-#ifdef UA_TYPES_PUBLISHEDEVENTSDATATYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_PublishedEventsDataType, UA_TYPES_PUBLISHEDEVENTSDATATYPE)
-#endif
-#ifdef UA_TYPES_PUBLISHEDVARIABLEDATATYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_PublishedVariableDataType, UA_TYPES_PUBLISHEDVARIABLEDATATYPE)
-#endif
-#ifdef UA_TYPES_QUERYDATADESCRIPTION
-UAPP_TYPEREGISTRY_NATIVE(UA_QueryDataDescription, UA_TYPES_QUERYDATADESCRIPTION)
-#endif
-#ifdef UA_TYPES_QUERYDATASET
-UAPP_TYPEREGISTRY_NATIVE(UA_QueryDataSet, UA_TYPES_QUERYDATASET)
-#endif
-#ifdef UA_TYPES_QUERYFIRSTREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_QueryFirstRequest, UA_TYPES_QUERYFIRSTREQUEST)
-#endif
-#ifdef UA_TYPES_QUERYFIRSTRESPONSE
-UAPP_TYPEREGISTRY_NATIVE(UA_QueryFirstResponse, UA_TYPES_QUERYFIRSTRESPONSE)
-#endif
-#ifdef UA_TYPES_QUERYNEXTREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_QueryNextRequest, UA_TYPES_QUERYNEXTREQUEST)
-#endif
-#ifdef UA_TYPES_QUERYNEXTRESPONSE
-UAPP_TYPEREGISTRY_NATIVE(UA_QueryNextResponse, UA_TYPES_QUERYNEXTRESPONSE)
-#endif
-#ifdef UA_TYPES_RANGE
-UAPP_TYPEREGISTRY_NATIVE(UA_Range, UA_TYPES_RANGE)
-#endif
-#ifdef UA_TYPES_READATTIMEDETAILS
-UAPP_TYPEREGISTRY_NATIVE(UA_ReadAtTimeDetails, UA_TYPES_READATTIMEDETAILS)
-#endif
-#ifdef UA_TYPES_READEVENTDETAILS
-UAPP_TYPEREGISTRY_NATIVE(UA_ReadEventDetails, UA_TYPES_READEVENTDETAILS)
-#endif
-#ifdef UA_TYPES_READPROCESSEDDETAILS
-UAPP_TYPEREGISTRY_NATIVE(UA_ReadProcessedDetails, UA_TYPES_READPROCESSEDDETAILS)
-#endif
-#ifdef UA_TYPES_READRAWMODIFIEDDETAILS
-UAPP_TYPEREGISTRY_NATIVE(UA_ReadRawModifiedDetails, UA_TYPES_READRAWMODIFIEDDETAILS)
-#endif
-#ifdef UA_TYPES_READREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_ReadRequest, UA_TYPES_READREQUEST)
-#endif
-#ifdef UA_TYPES_READRESPONSE
-UAPP_TYPEREGISTRY_NATIVE(UA_ReadResponse, UA_TYPES_READRESPONSE)
-#endif
-#ifdef UA_TYPES_READVALUEID
-UAPP_TYPEREGISTRY_NATIVE(UA_ReadValueId, UA_TYPES_READVALUEID)
-#endif
-#ifdef UA_TYPES_READERGROUPDATATYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_ReaderGroupDataType, UA_TYPES_READERGROUPDATATYPE)
-#endif
-#ifdef UA_TYPES_REDUNDANCYSUPPORT
-UAPP_TYPEREGISTRY_NATIVE(UA_RedundancySupport, UA_TYPES_REDUNDANCYSUPPORT)
-#endif
-#ifdef UA_TYPES_REFERENCEDESCRIPTION
-UAPP_TYPEREGISTRY_NATIVE(UA_ReferenceDescription, UA_TYPES_REFERENCEDESCRIPTION)
-#endif
-#ifdef UA_TYPES_REFERENCETYPEATTRIBUTES
-UAPP_TYPEREGISTRY_NATIVE(UA_ReferenceTypeAttributes, UA_TYPES_REFERENCETYPEATTRIBUTES)
-#endif
-#ifdef UA_TYPES_REGISTERNODESREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_RegisterNodesRequest, UA_TYPES_REGISTERNODESREQUEST)
-#endif
-#ifdef UA_TYPES_REGISTERNODESRESPONSE
-UAPP_TYPEREGISTRY_NATIVE(UA_RegisterNodesResponse, UA_TYPES_REGISTERNODESRESPONSE)
-#endif
-#ifdef UA_TYPES_REGISTERSERVER2REQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_RegisterServer2Request, UA_TYPES_REGISTERSERVER2REQUEST)
-#endif
-#ifdef UA_TYPES_REGISTERSERVER2RESPONSE
-UAPP_TYPEREGISTRY_NATIVE(UA_RegisterServer2Response, UA_TYPES_REGISTERSERVER2RESPONSE)
-#endif
-#ifdef UA_TYPES_REGISTERSERVERREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_RegisterServerRequest, UA_TYPES_REGISTERSERVERREQUEST)
-#endif
-#ifdef UA_TYPES_REGISTERSERVERRESPONSE
-UAPP_TYPEREGISTRY_NATIVE(UA_RegisterServerResponse, UA_TYPES_REGISTERSERVERRESPONSE)
-#endif
-#ifdef UA_TYPES_REGISTEREDSERVER
-UAPP_TYPEREGISTRY_NATIVE(UA_RegisteredServer, UA_TYPES_REGISTEREDSERVER)
-#endif
-#ifdef UA_TYPES_RELATIVEPATH
-UAPP_TYPEREGISTRY_NATIVE(UA_RelativePath, UA_TYPES_RELATIVEPATH)
-#endif
-#ifdef UA_TYPES_RELATIVEPATHELEMENT
-UAPP_TYPEREGISTRY_NATIVE(UA_RelativePathElement, UA_TYPES_RELATIVEPATHELEMENT)
-#endif
-#ifdef UA_TYPES_REPUBLISHREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_RepublishRequest, UA_TYPES_REPUBLISHREQUEST)
-#endif
-#ifdef UA_TYPES_REPUBLISHRESPONSE
-UAPP_TYPEREGISTRY_NATIVE(UA_RepublishResponse, UA_TYPES_REPUBLISHRESPONSE)
-#endif
-#ifdef UA_TYPES_REQUESTHEADER
-UAPP_TYPEREGISTRY_NATIVE(UA_RequestHeader, UA_TYPES_REQUESTHEADER)
-#endif
-#ifdef UA_TYPES_RESPONSEHEADER
-UAPP_TYPEREGISTRY_NATIVE(UA_ResponseHeader, UA_TYPES_RESPONSEHEADER)
-#endif
-#ifdef UA_TYPES_ROLEPERMISSIONTYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_RolePermissionType, UA_TYPES_ROLEPERMISSIONTYPE)
-#endif
-#ifdef UA_TYPES_SECURITYTOKENREQUESTTYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_SecurityTokenRequestType, UA_TYPES_SECURITYTOKENREQUESTTYPE)
-#endif
-#ifdef UA_TYPES_SERVERDIAGNOSTICSSUMMARYDATATYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_ServerDiagnosticsSummaryDataType, UA_TYPES_SERVERDIAGNOSTICSSUMMARYDATATYPE)
-#endif
-#ifdef UA_TYPES_SERVERONNETWORK
-UAPP_TYPEREGISTRY_NATIVE(UA_ServerOnNetwork, UA_TYPES_SERVERONNETWORK)
-#endif
-#ifdef UA_TYPES_SERVERSTATE
-UAPP_TYPEREGISTRY_NATIVE(UA_ServerState, UA_TYPES_SERVERSTATE)
-#endif
-#ifdef UA_TYPES_SERVERSTATUSDATATYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_ServerStatusDataType, UA_TYPES_SERVERSTATUSDATATYPE)
-#endif
-#ifdef UA_TYPES_SERVICEFAULT
-UAPP_TYPEREGISTRY_NATIVE(UA_ServiceFault, UA_TYPES_SERVICEFAULT)
-#endif
-#ifdef UA_TYPES_SETMONITORINGMODEREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_SetMonitoringModeRequest, UA_TYPES_SETMONITORINGMODEREQUEST)
-#endif
-#ifdef UA_TYPES_SETMONITORINGMODERESPONSE
-UAPP_TYPEREGISTRY_NATIVE(UA_SetMonitoringModeResponse, UA_TYPES_SETMONITORINGMODERESPONSE)
-#endif
-#ifdef UA_TYPES_SETPUBLISHINGMODEREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_SetPublishingModeRequest, UA_TYPES_SETPUBLISHINGMODEREQUEST)
-#endif
-#ifdef UA_TYPES_SETPUBLISHINGMODERESPONSE
-UAPP_TYPEREGISTRY_NATIVE(UA_SetPublishingModeResponse, UA_TYPES_SETPUBLISHINGMODERESPONSE)
-#endif
-#ifdef UA_TYPES_SETTRIGGERINGREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_SetTriggeringRequest, UA_TYPES_SETTRIGGERINGREQUEST)
-#endif
-#ifdef UA_TYPES_SETTRIGGERINGRESPONSE
-UAPP_TYPEREGISTRY_NATIVE(UA_SetTriggeringResponse, UA_TYPES_SETTRIGGERINGRESPONSE)
-#endif
-#ifdef UA_TYPES_SIGNATUREDATA
-UAPP_TYPEREGISTRY_NATIVE(UA_SignatureData, UA_TYPES_SIGNATUREDATA)
-#endif
-#ifdef UA_TYPES_SIGNEDSOFTWARECERTIFICATE
-UAPP_TYPEREGISTRY_NATIVE(UA_SignedSoftwareCertificate, UA_TYPES_SIGNEDSOFTWARECERTIFICATE)
-#endif
-#ifdef UA_TYPES_SIMPLEATTRIBUTEOPERAND
-UAPP_TYPEREGISTRY_NATIVE(UA_SimpleAttributeOperand, UA_TYPES_SIMPLEATTRIBUTEOPERAND)
-#endif
-#ifdef UA_TYPES_SIMPLETYPEDESCRIPTION
-UAPP_TYPEREGISTRY_NATIVE(UA_SimpleTypeDescription, UA_TYPES_SIMPLETYPEDESCRIPTION)
-#endif
-#ifdef UA_TYPES_STATUSCHANGENOTIFICATION
-UAPP_TYPEREGISTRY_NATIVE(UA_StatusChangeNotification, UA_TYPES_STATUSCHANGENOTIFICATION)
-#endif
-#ifdef UA_TYPES_STRUCTUREDEFINITION
-UAPP_TYPEREGISTRY_NATIVE(UA_StructureDefinition, UA_TYPES_STRUCTUREDEFINITION)
-#endif
-#ifdef UA_TYPES_STRUCTUREDESCRIPTION
-UAPP_TYPEREGISTRY_NATIVE(UA_StructureDescription, UA_TYPES_STRUCTUREDESCRIPTION)
-#endif
-#ifdef UA_TYPES_STRUCTUREFIELD
-UAPP_TYPEREGISTRY_NATIVE(UA_StructureField, UA_TYPES_STRUCTUREFIELD)
-#endif
-#ifdef UA_TYPES_STRUCTURETYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_StructureType, UA_TYPES_STRUCTURETYPE)
-#endif
-#ifdef UA_TYPES_SUBSCRIBEDDATASETMIRRORDATATYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_SubscribedDataSetMirrorDataType, UA_TYPES_SUBSCRIBEDDATASETMIRRORDATATYPE)
-#endif
-#ifdef UA_TYPES_SUBSCRIPTIONACKNOWLEDGEMENT
-UAPP_TYPEREGISTRY_NATIVE(UA_SubscriptionAcknowledgement, UA_TYPES_SUBSCRIPTIONACKNOWLEDGEMENT)
-#endif
-#ifdef UA_TYPES_TARGETVARIABLESDATATYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_TargetVariablesDataType, UA_TYPES_TARGETVARIABLESDATATYPE)
-#endif
-#ifdef UA_TYPES_TIMEZONEDATATYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_TimeZoneDataType, UA_TYPES_TIMEZONEDATATYPE)
-#endif
-#ifdef UA_TYPES_TIMESTAMPSTORETURN
-UAPP_TYPEREGISTRY_NATIVE(UA_TimestampsToReturn, UA_TYPES_TIMESTAMPSTORETURN)
-#endif
-#ifdef UA_TYPES_TRANSFERRESULT
-UAPP_TYPEREGISTRY_NATIVE(UA_TransferResult, UA_TYPES_TRANSFERRESULT)
-#endif
-#ifdef UA_TYPES_TRANSFERSUBSCRIPTIONSREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_TransferSubscriptionsRequest, UA_TYPES_TRANSFERSUBSCRIPTIONSREQUEST)
-#endif
-#ifdef UA_TYPES_TRANSFERSUBSCRIPTIONSRESPONSE
-UAPP_TYPEREGISTRY_NATIVE(UA_TransferSubscriptionsResponse, UA_TYPES_TRANSFERSUBSCRIPTIONSRESPONSE)
-#endif
-#ifdef UA_TYPES_TRANSLATEBROWSEPATHSTONODEIDSREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_TranslateBrowsePathsToNodeIdsRequest, UA_TYPES_TRANSLATEBROWSEPATHSTONODEIDSREQUEST)
-#endif
-#ifdef UA_TYPES_TRANSLATEBROWSEPATHSTONODEIDSRESPONSE
-UAPP_TYPEREGISTRY_NATIVE(UA_TranslateBrowsePathsToNodeIdsResponse, UA_TYPES_TRANSLATEBROWSEPATHSTONODEIDSRESPONSE)
-#endif
-#ifdef UA_TYPES_UABINARYFILEDATATYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_UABinaryFileDataType, UA_TYPES_UABINARYFILEDATATYPE)
-#endif
-#ifdef UA_TYPES_UADPDATASETREADERMESSAGEDATATYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_UadpDataSetReaderMessageDataType, UA_TYPES_UADPDATASETREADERMESSAGEDATATYPE)
-#endif
-#ifdef UA_TYPES_UADPDATASETWRITERMESSAGEDATATYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_UadpDataSetWriterMessageDataType, UA_TYPES_UADPDATASETWRITERMESSAGEDATATYPE)
-#endif
-#ifdef UA_TYPES_UADPWRITERGROUPMESSAGEDATATYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_UadpWriterGroupMessageDataType, UA_TYPES_UADPWRITERGROUPMESSAGEDATATYPE)
-#endif
-#ifdef UA_TYPES_UNREGISTERNODESREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_UnregisterNodesRequest, UA_TYPES_UNREGISTERNODESREQUEST)
-#endif
-#ifdef UA_TYPES_UNREGISTERNODESRESPONSE
-UAPP_TYPEREGISTRY_NATIVE(UA_UnregisterNodesResponse, UA_TYPES_UNREGISTERNODESRESPONSE)
-#endif
-#ifdef UA_TYPES_UPDATEDATADETAILS
-UAPP_TYPEREGISTRY_NATIVE(UA_UpdateDataDetails, UA_TYPES_UPDATEDATADETAILS)
-#endif
-#ifdef UA_TYPES_USERIDENTITYTOKEN
-UAPP_TYPEREGISTRY_NATIVE(UA_UserIdentityToken, UA_TYPES_USERIDENTITYTOKEN)
-#endif
-#ifdef UA_TYPES_USERNAMEIDENTITYTOKEN
-UAPP_TYPEREGISTRY_NATIVE(UA_UserNameIdentityToken, UA_TYPES_USERNAMEIDENTITYTOKEN)
-#endif
-#ifdef UA_TYPES_USERTOKENPOLICY
-UAPP_TYPEREGISTRY_NATIVE(UA_UserTokenPolicy, UA_TYPES_USERTOKENPOLICY)
-#endif
-#ifdef UA_TYPES_USERTOKENTYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_UserTokenType, UA_TYPES_USERTOKENTYPE)
-#endif
-#ifdef UA_TYPES_VARIABLEATTRIBUTES
-UAPP_TYPEREGISTRY_NATIVE(UA_VariableAttributes, UA_TYPES_VARIABLEATTRIBUTES)
-#endif
-#ifdef UA_TYPES_VARIABLETYPEATTRIBUTES
-UAPP_TYPEREGISTRY_NATIVE(UA_VariableTypeAttributes, UA_TYPES_VARIABLETYPEATTRIBUTES)
-#endif
-#ifdef UA_TYPES_VIEWATTRIBUTES
-UAPP_TYPEREGISTRY_NATIVE(UA_ViewAttributes, UA_TYPES_VIEWATTRIBUTES)
-#endif
-#ifdef UA_TYPES_VIEWDESCRIPTION
-UAPP_TYPEREGISTRY_NATIVE(UA_ViewDescription, UA_TYPES_VIEWDESCRIPTION)
-#endif
-#ifdef UA_TYPES_WRITEREQUEST
-UAPP_TYPEREGISTRY_NATIVE(UA_WriteRequest, UA_TYPES_WRITEREQUEST)
-#endif
-#ifdef UA_TYPES_WRITERESPONSE
-UAPP_TYPEREGISTRY_NATIVE(UA_WriteResponse, UA_TYPES_WRITERESPONSE)
-#endif
-#ifdef UA_TYPES_WRITEVALUE
-UAPP_TYPEREGISTRY_NATIVE(UA_WriteValue, UA_TYPES_WRITEVALUE)
-#endif
-#ifdef UA_TYPES_WRITERGROUPDATATYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_WriterGroupDataType, UA_TYPES_WRITERGROUPDATATYPE)
-#endif
-#ifdef UA_TYPES_X509IDENTITYTOKEN
-UAPP_TYPEREGISTRY_NATIVE(UA_X509IdentityToken, UA_TYPES_X509IDENTITYTOKEN)
-#endif
-#ifdef UA_TYPES_XVTYPE
-UAPP_TYPEREGISTRY_NATIVE(UA_XVType, UA_TYPES_XVTYPE)
-#endif
-
-// clang-format on
-
-}  // namespace opcua
+// template specializations of TypeRegistry for the native types, grouped by type family
+#include "open62541pp/typeregistry/Core.h"
+#include "open62541pp/typeregistry/History.h"
+#include "open62541pp/typeregistry/PubSub.h"
+#include "open62541pp/typeregistry/Services.h"
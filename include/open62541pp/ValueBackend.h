@@ -1,12 +1,16 @@
 #pragma once
 
+#include <chrono>
 #include <functional>
+#include <utility>  // move
+
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/Variant.h"
 
 namespace opcua {
 
 // forward declaration
 class NodeId;
-class DataValue;
 
 /**
  * Value callbacks for variable nodes.
@@ -27,6 +31,18 @@ struct ValueCallback {
      */
     std::function<void(const DataValue& value)> onBeforeRead;
 
+    /**
+     * Minimum period between two onBeforeRead calls.
+     *
+     * Reads within the period after the last onBeforeRead call skip the callback and return the
+     * stored value, e.g. to refresh a value from hardware once per period while many clients poll
+     * the node. The last refresh time is kept per node. Zero calls onBeforeRead on every read.
+     *
+     * @note The `maxAge` parameter of read requests is not passed to value callbacks by open62541,
+     *       use the minimum refresh period to limit the age of the stored value instead.
+     */
+    std::chrono::steady_clock::duration minRefreshPeriod{};
+
     /**
      * Called after writing the value attribute.
      *
@@ -64,6 +80,22 @@ struct ValueBackendDataSource {
      */
     std::function<StatusCode(DataValue& value, const NumericRange& range, bool timestamp)> read;
 
+    /**
+     * Apply the numeric range of read requests automatically.
+     * If `true`, `read` is always called with an empty range and returns the full value. The
+     * requested subset is extracted afterwards with Variant::getRange. The subset references
+     * the value if it is not owned (zero-copy read) and the range is contiguous.
+     */
+    bool applyReadRange = false;
+
+    /**
+     * Set the source timestamp automatically.
+     * If `true` and a source timestamp is requested, values without source timestamp returned by
+     * `read` are timestamped with DateTime::nowCoarse, which is cheaper than querying the precise
+     * clock in every callback.
+     */
+    bool autoSourceTimestamp = false;
+
     /**
      * Callback to write the value into a data source.
      * This function can be empty if the operation is unsupported.
@@ -76,4 +108,62 @@ struct ValueBackendDataSource {
     std::function<StatusCode(const DataValue& value, const NumericRange& range)> write;
 };
 
+/**
+ * External value backend for variable nodes.
+ *
+ * The value is stored in user memory and read by the server directly, without callbacks and
+ * without copies into the node. Realtime PubSub publishers with fixed message layouts (see
+ * WriterGroupConfig::fixedSize) copy the value into the pre-encoded message in every cycle.
+ * The application updates the bound memory itself, writes of clients are rejected
+ * (`BadWriteNotSupported`).
+ *
+ * The backend references itself and is neither copyable nor movable. The backend and the bound
+ * memory must outlive the server (or the node).
+ * @code
+ * double position = 0.0;
+ * ValueBackendExternal backend(position);
+ * server.setVariableNodeValueBackend(id, backend);
+ * position = 1.0;  // visible to readers and publishers without further calls
+ * @endcode
+ * @see https://www.open62541.org/doc/1.3/tutorial_server_datasource.html
+ */
+class ValueBackendExternal {
+public:
+    /// Bind a scalar value in user memory (no copy).
+    template <typename T>
+    explicit ValueBackendExternal(T& value) {
+        Variant var;
+        var.setScalar(value);
+        dataValue_.setValue(std::move(var));
+    }
+
+    /// Bind a scalar value with custom data type in user memory (no copy).
+    template <typename T>
+    ValueBackendExternal(T& value, const UA_DataType& dataType) {
+        Variant var;
+        var.setScalar(value, dataType);
+        dataValue_.setValue(std::move(var));
+    }
+
+    ValueBackendExternal(const ValueBackendExternal&) = delete;
+    ValueBackendExternal(ValueBackendExternal&&) noexcept = delete;
+    ValueBackendExternal& operator=(const ValueBackendExternal&) = delete;
+    ValueBackendExternal& operator=(ValueBackendExternal&&) noexcept = delete;
+    ~ValueBackendExternal() = default;
+
+    /// Get the data value, e.g. to set the status code or timestamps.
+    DataValue& getDataValue() noexcept {
+        return dataValue_;
+    }
+
+    /// Get the native pointer to the data value pointer (`UA_ValueBackend::external.value`).
+    UA_DataValue** handle() noexcept {
+        return &native_;
+    }
+
+private:
+    DataValue dataValue_;
+    UA_DataValue* native_{dataValue_.handle()};
+};
+
 }  // namespace opcua
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <utility>  // move
+
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua {
+
+// forward declaration
+class Server;
+
+/**
+ * Slot with the latest value of a variable node, published by a producer thread.
+ *
+ * The slot is a triple buffer: the producer writes into its back buffer and publishes it with a
+ * single atomic exchange, the consumer (server thread) swaps in the latest published buffer before
+ * each read. Neither side ever blocks or waits for the other (wait-free). The buffer of the
+ * consumer stays untouched until its next acquire, so the value can be copied without a lock.
+ *
+ * Only a single producer thread may publish to a slot at a time. Consecutive values might be
+ * skipped by the consumer, only the latest value is read.
+ */
+class ValueSlot {
+public:
+    /// Publish a new value (wait-free).
+    void publish(DataValue value) noexcept {
+        buffers_[back_] = std::move(value);  // NOLINT
+        back_ = middle_.exchange(back_ | dirtyBit, std::memory_order_acq_rel) & indexMask;
+    }
+
+    /// Publish a new scalar value (wait-free, except for the allocation of the value).
+    template <typename T>
+    void publishScalar(const T& value) {
+        publish(DataValue::fromScalar(value));
+    }
+
+    /// Acquire the latest published value (consumer side, used by the server).
+    /// The returned reference is valid until the next call of acquire.
+    const DataValue& acquire() noexcept {
+        if ((middle_.load(std::memory_order_relaxed) & dirtyBit) != 0) {
+            front_ = middle_.exchange(front_, std::memory_order_acq_rel) & indexMask;
+        }
+        return buffers_[front_];  // NOLINT
+    }
+
+private:
+    static constexpr uint8_t indexMask = 0x03;
+    static constexpr uint8_t dirtyBit = 0x04;
+
+    std::array<DataValue, 3> buffers_{};
+    std::atomic<uint8_t> middle_{1};  // index of the published buffer + dirty bit
+    uint8_t back_{2};  // owned by the producer
+    uint8_t front_{0};  // owned by the consumer
+};
+
+/**
+ * Built-in value backend with lock-free publishing of variable values from producer threads.
+ *
+ * Register variable nodes with registerNode; the store installs a data source backend
+ * (Server::setVariableNodeValueBackend) that serves reads with a copy of the latest value of the
+ * node's ValueSlot. Numeric ranges and source timestamps are handled by the backend.
+ * Producers publish values with ValueSlot::publish, neither producers nor the server loop take a
+ * lock. Reads before the first published value return `BadWaitingForInitialData`.
+ *
+ * Register all nodes before producers start publishing. Registered nodes are read-only for
+ * clients (`BadNotWritable`). The store must outlive the server.
+ * @code
+ * ValueStore store;
+ * auto& slot = store.registerNode(server, id);
+ * std::thread producer([&] {
+ *     for (double value = 0;; value += 1.0) {
+ *         slot.publishScalar(value);
+ *     }
+ * });
+ * server.run();
+ * @endcode
+ */
+class ValueStore {
+public:
+    ValueStore() = default;
+    ~ValueStore() = default;
+
+    ValueStore(const ValueStore&) = delete;
+    ValueStore(ValueStore&&) noexcept = delete;
+    ValueStore& operator=(const ValueStore&) = delete;
+    ValueStore& operator=(ValueStore&&) noexcept = delete;
+
+    /**
+     * Register a variable node and set the store as its value backend.
+     * @return Slot to publish values of the node, stable for the lifetime of the store
+     * @exception BadStatus If the value backend can not be set
+     */
+    ValueSlot& registerNode(Server& server, const NodeId& id);
+
+    /// Get the slot of a registered node.
+    /// @exception BadStatus (BadNodeIdUnknown) If the node is not registered
+    ValueSlot& getSlot(const NodeId& id);
+
+    /// Number of registered nodes.
+    size_t size() const noexcept {
+        return slots_.size();
+    }
+
+private:
+    std::unordered_map<NodeId, std::unique_ptr<ValueSlot>> slots_;
+};
+
+}  // namespace opcua
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>  // invoke
+#include <type_traits>
+#include <utility>  // forward, index_sequence
+#include <variant>  // monostate
+
+#include "open62541pp/Span.h"
+#include "open62541pp/open62541.h"
+#include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/DateTime.h"
+#include "open62541pp/types/ExtensionObject.h"
+#include "open62541pp/types/NodeId.h"
+#include "open62541pp/types/Variant.h"
+
+namespace opcua {
+
+/**
+ * Helper to combine multiple lambdas to a single visitor for @ref visit.
+ * @code
+ * visit(variant, Overloaded{
+ *     [](int32_t value) { ... },
+ *     [](const String& value) { ... },
+ *     [](const auto& other) { ... },
+ * });
+ * @endcode
+ */
+template <typename... Ts>
+struct Overloaded : Ts... {
+    using Ts::operator()...;
+};
+
+template <typename... Ts>
+Overloaded(Ts...) -> Overloaded<Ts...>;
+
+namespace detail {
+
+/// Wrapper/native type of a builtin data type kind (`UA_DataTypeKind`).
+template <size_t Kind>
+struct BuiltinTypeOfKind;
+
+// NOLINTNEXTLINE
+#define UAPP_BUILTIN_TYPE_OF_KIND(kind, Type)                                                      \
+    template <>                                                                                    \
+    struct BuiltinTypeOfKind<kind> {                                                               \
+        using type = Type;                                                                         \
+    };
+
+UAPP_BUILTIN_TYPE_OF_KIND(UA_DATATYPEKIND_BOOLEAN, bool)
+UAPP_BUILTIN_TYPE_OF_KIND(UA_DATATYPEKIND_SBYTE, int8_t)
+UAPP_BUILTIN_TYPE_OF_KIND(UA_DATATYPEKIND_BYTE, uint8_t)
+UAPP_BUILTIN_TYPE_OF_KIND(UA_DATATYPEKIND_INT16, int16_t)
+UAPP_BUILTIN_TYPE_OF_KIND(UA_DATATYPEKIND_UINT16, uint16_t)
+UAPP_BUILTIN_TYPE_OF_KIND(UA_DATATYPEKIND_INT32, int32_t)
+UAPP_BUILTIN_TYPE_OF_KIND(UA_DATATYPEKIND_UINT32, uint32_t)
+UAPP_BUILTIN_TYPE_OF_KIND(UA_DATATYPEKIND_INT64, int64_t)
+UAPP_BUILTIN_TYPE_OF_KIND(UA_DATATYPEKIND_UINT64, uint64_t)
+UAPP_BUILTIN_TYPE_OF_KIND(UA_DATATYPEKIND_FLOAT, float)
+UAPP_BUILTIN_TYPE_OF_KIND(UA_DATATYPEKIND_DOUBLE, double)
+UAPP_BUILTIN_TYPE_OF_KIND(UA_DATATYPEKIND_STRING, String)
+UAPP_BUILTIN_TYPE_OF_KIND(UA_DATATYPEKIND_DATETIME, DateTime)
+UAPP_BUILTIN_TYPE_OF_KIND(UA_DATATYPEKIND_GUID, Guid)
+UAPP_BUILTIN_TYPE_OF_KIND(UA_DATATYPEKIND_BYTESTRING, ByteString)
+UAPP_BUILTIN_TYPE_OF_KIND(UA_DATATYPEKIND_XMLELEMENT, XmlElement)
+UAPP_BUILTIN_TYPE_OF_KIND(UA_DATATYPEKIND_NODEID, NodeId)
+UAPP_BUILTIN_TYPE_OF_KIND(UA_DATATYPEKIND_EXPANDEDNODEID, ExpandedNodeId)
+UAPP_BUILTIN_TYPE_OF_KIND(UA_DATATYPEKIND_STATUSCODE, StatusCode)
+UAPP_BUILTIN_TYPE_OF_KIND(UA_DATATYPEKIND_QUALIFIEDNAME, QualifiedName)
+UAPP_BUILTIN_TYPE_OF_KIND(UA_DATATYPEKIND_LOCALIZEDTEXT, LocalizedText)
+UAPP_BUILTIN_TYPE_OF_KIND(UA_DATATYPEKIND_EXTENSIONOBJECT, ExtensionObject)
+UAPP_BUILTIN_TYPE_OF_KIND(UA_DATATYPEKIND_DATAVALUE, DataValue)
+UAPP_BUILTIN_TYPE_OF_KIND(UA_DATATYPEKIND_VARIANT, Variant)
+UAPP_BUILTIN_TYPE_OF_KIND(UA_DATATYPEKIND_DIAGNOSTICINFO, DiagnosticInfo)
+
+#undef UAPP_BUILTIN_TYPE_OF_KIND
+
+template <typename Visitor>
+using VisitResult = std::invoke_result_t<Visitor&, const Variant&>;
+
+template <typename Visitor>
+using VisitFunction = VisitResult<Visitor> (*)(const Variant&, Visitor&);
+
+template <size_t Kind, typename Visitor>
+VisitResult<Visitor> visitKind(const Variant& variant, Visitor& visitor) {
+    using T = typename BuiltinTypeOfKind<Kind>::type;
+    // the wrapper types have the same memory layout as the native types
+    const auto* data = static_cast<const T*>(variant.data());
+    if (variant.isScalar()) {
+        if constexpr (Kind == UA_DATATYPEKIND_VARIANT) {
+            // nested scalar variant, `const Variant&` is reserved for non-builtin types
+            return std::invoke(visitor, Span<const T>(data, 1));
+        } else {
+            return std::invoke(visitor, *data);
+        }
+    }
+    return std::invoke(
+        visitor, Span<const T>(variant.isArray() ? data : nullptr, variant.getArrayLength())
+    );
+}
+
+template <typename Visitor, size_t... Kinds>
+constexpr auto makeVisitTable(std::index_sequence<Kinds...> /* unused */) noexcept {
+    return std::array<VisitFunction<Visitor>, sizeof...(Kinds)>{&visitKind<Kinds, Visitor>...};
+}
+
+}  // namespace detail
+
+/**
+ * Visit the value of a variant with a single switch over the builtin type kind.
+ *
+ * Generic code handling all builtin types would otherwise chain up to 25 `isType<T>()` checks.
+ * The visitor is invoked with:
+ * - `std::monostate` if the variant is empty,
+ * - `const T&` for scalars of builtin types,
+ * - `Span<const T>` for arrays of builtin types (including empty arrays),
+ * - `Span<const Variant>` with a single element for a scalar variant nested in the variant,
+ * - `const Variant&` (the variant itself) for all other data types, e.g. structures or enums.
+ *
+ * `T` is the wrapper type (e.g. String, NodeId) or the native type of numeric types
+ * (e.g. `int32_t`, `double`). The dispatch uses the type kind of the data type, so subtypes with
+ * the memory layout of a builtin type are visited as their builtin type (e.g. `Duration` as
+ * `double` or `UtcTime` as DateTime).
+ *
+ * Like `std::visit`, the visitor must accept all alternatives (use a generic lambda as fallback)
+ * and return the same type for all alternatives.
+ * @code
+ * opcua::visit(variant, Overloaded{
+ *     [](std::monostate) { std::cout << "empty"; },
+ *     [](double value) { std::cout << value; },
+ *     [](const String& value) { std::cout << value; },
+ *     [](const auto&) { std::cout << "unsupported"; },
+ * });
+ * @endcode
+ */
+template <typename Visitor>
+detail::VisitResult<Visitor> visit(const Variant& variant, Visitor&& visitor) {
+    const auto* dataType = variant.getDataType();
+    if (dataType == nullptr) {
+        return std::invoke(visitor, std::monostate{});
+    }
+    if (dataType->typeKind <= UA_DATATYPEKIND_DIAGNOSTICINFO) {
+        static constexpr auto table = detail::makeVisitTable<std::remove_reference_t<Visitor>>(
+            std::make_index_sequence<UA_DATATYPEKIND_DIAGNOSTICINFO + 1>{}
+        );
+        return table[dataType->typeKind](variant, visitor);  // NOLINT
+    }
+    return std::invoke(visitor, variant);
+}
+
+}  // namespace opcua
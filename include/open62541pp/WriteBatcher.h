@@ -0,0 +1,155 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>  // forward, pair
+#include <vector>
+
+#include "open62541pp/Common.h"  // AttributeId
+#include "open62541pp/async.h"
+#include "open62541pp/open62541.h"
+#include "open62541pp/types/Builtin.h"  // StatusCode
+#include "open62541pp/types/Composed.h"  // WriteValue
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua {
+
+// forward declaration
+class Client;
+
+/**
+ * Options of WriteBatcher.
+ */
+struct WriteBatcherOptions {
+    /// Time window to collect writes, starting with the first write of a batch.
+    std::chrono::milliseconds window{1};
+    /// Maximum number of writes per batch, flush immediately if reached (0: unlimited).
+    size_t maxBatchSize = 0;
+    /// Replace pending writes of the same node attribute (last value wins).
+    bool deduplicate = false;
+};
+
+/**
+ * Gather writes of a client and send them in batched write requests.
+ *
+ * Writes issued with writeAttributeAsync are collected until the maximum batch size is reached or
+ * the time window has elapsed. They are sent with a single WriteRequest (split by the server's
+ * `MaxNodesPerWrite` limit) and each completion handler is invoked with the status code of its
+ * item in the WriteResponse.
+ *
+ * With deduplication enabled, a pending write of the same `(NodeId, AttributeId)` is replaced by
+ * the newer value. The completion handlers of replaced writes are invoked with the result of the
+ * write that superseded them.
+ *
+ * Pending writes are sent by Client::runIterate when the window has elapsed or explicitly with
+ * flush(). The batcher must not outlive the client and, like the client, is not thread-safe.
+ */
+class WriteBatcher {
+public:
+    /// Create write batcher for the client.
+    /// The server's `MaxNodesPerWrite` operation limit is read once (if the client is connected).
+    explicit WriteBatcher(Client& client, WriteBatcherOptions options = {});
+
+    ~WriteBatcher();
+
+    WriteBatcher(const WriteBatcher&) = delete;
+    WriteBatcher(WriteBatcher&&) noexcept = delete;
+    WriteBatcher& operator=(const WriteBatcher&) = delete;
+    WriteBatcher& operator=(WriteBatcher&&) noexcept = delete;
+
+    /**
+     * Asynchronously write node attribute, batched with other writes.
+     * @param id Node to write
+     * @param attributeId Attribute to write
+     * @param value Value to write
+     * @param token @completiontoken{void(opcua::StatusCode)}
+     */
+    template <typename CompletionToken = DefaultCompletionToken>
+    auto writeAttributeAsync(
+        const NodeId& id,
+        AttributeId attributeId,
+        const DataValue& value,
+        CompletionToken&& token = DefaultCompletionToken()
+    ) {
+        return asyncInitiate<void>(
+            [&](auto&& handler) {
+                add(id, attributeId, value, wrapHandler(std::forward<decltype(handler)>(handler)));
+            },
+            std::forward<CompletionToken>(token)
+        );
+    }
+
+    /**
+     * Asynchronously write the `AttributeId::Value` attribute of a node, batched with other writes.
+     * @param token @completiontoken{void(opcua::StatusCode)}
+     */
+    template <typename CompletionToken = DefaultCompletionToken>
+    auto writeValueAsync(
+        const NodeId& id, const Variant& value, CompletionToken&& token = DefaultCompletionToken()
+    ) {
+        return writeAttributeAsync(
+            id, AttributeId::Value, DataValue(value), std::forward<CompletionToken>(token)
+        );
+    }
+
+    /// Send all pending writes immediately.
+    void flush();
+
+    /// Number of pending writes (after deduplication), that are not sent yet.
+    size_t pending() const noexcept {
+        return items_.size();
+    }
+
+    /// Maximum number of nodes per write request (server's operation limit, 0: unlimited).
+    uint32_t getMaxNodesPerWrite() const noexcept {
+        return maxNodesPerWrite_;
+    }
+
+private:
+    using Handler = std::function<void(StatusCode)>;
+
+    struct Key {
+        NodeId id;
+        AttributeId attributeId;
+
+        bool operator==(const Key& other) const noexcept {
+            return attributeId == other.attributeId && id == other.id;
+        }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const noexcept {
+            return std::hash<NodeId>()(key.id) ^ static_cast<size_t>(key.attributeId);
+        }
+    };
+
+    template <typename CompletionHandler>
+    static Handler wrapHandler(CompletionHandler&& handler) {
+        // std::function requires copyable callables, completion handlers might be move-only
+        auto ptr = std::make_shared<std::decay_t<CompletionHandler>>(
+            std::forward<CompletionHandler>(handler)
+        );
+        return [ptr](StatusCode code) { std::invoke(*ptr, code); };
+    }
+
+    void add(const NodeId& id, AttributeId attributeId, const DataValue& value, Handler&& handler);
+    void scheduleFlush();
+    void cancelFlush() noexcept;
+    static void flushCallback(UA_Client* client, void* data);
+
+    Client& client_;
+    WriteBatcherOptions options_;
+    uint32_t maxNodesPerWrite_{0};
+    uint64_t callbackId_{0};
+    std::vector<WriteValue> items_;
+    std::vector<std::pair<size_t, Handler>> handlers_;  // item index and handler
+    std::unordered_map<Key, size_t, KeyHash> index_;
+};
+
+}  // namespace opcua
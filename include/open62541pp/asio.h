@@ -0,0 +1,305 @@
+#pragma once
+
+/**
+ * @file
+ * Optional (header-only) integration with Asio.
+ * Requires standalone Asio (`<asio.hpp>`) or Boost.Asio if `UAPP_USE_BOOST_ASIO` is defined.
+ * This header is not included by `open62541pp.h`.
+ */
+
+#include <algorithm>  // min
+#include <chrono>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>  // forward, move
+
+#ifdef UAPP_USE_BOOST_ASIO
+#include <boost/asio.hpp>
+#else
+#include <asio.hpp>
+#endif
+
+#include "open62541pp/Client.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/async.h"
+#include "open62541pp/types/Builtin.h"  // StatusCode
+
+namespace opcua {
+
+#ifdef UAPP_USE_BOOST_ASIO
+namespace net = boost::asio;
+#else
+namespace net = ::asio;
+#endif
+
+/**
+ * Drive the main loop of a client with an Asio executor.
+ *
+ * The client is iterated with a zero timeout (`Client::runIterate(0)`), so it never blocks the
+ * executor's thread and a single thread can serve many clients. Iterations are scheduled with a
+ * steady timer in the given interval; wakeup() schedules an immediate iteration, e.g. after
+ * requests are initiated.
+ *
+ * The open62541 API does not expose the client's socket, readiness based wakeups are therefore
+ * not possible. Exceptions of runIterate (e.g. from user callbacks) are propagated by the
+ * executor, for example by `io_context::run`.
+ *
+ * The driver must not outlive the client and must be used from the executor's thread only.
+ * @code
+ * asio::io_context io;
+ * Client client;
+ * client.connect("opc.tcp://localhost:4840");
+ * AsioClientDriver driver(io.get_executor(), client);
+ * driver.start();
+ * io.run();
+ * @endcode
+ */
+class AsioClientDriver {
+public:
+    AsioClientDriver(
+        net::any_io_executor executor,
+        Client& client,
+        std::chrono::milliseconds interval = std::chrono::milliseconds(5)
+    )
+        : client_(client),
+          interval_(interval),
+          timer_(std::move(executor)) {}
+
+    ~AsioClientDriver() {
+        stop();
+    }
+
+    AsioClientDriver(const AsioClientDriver&) = delete;
+    AsioClientDriver(AsioClientDriver&&) noexcept = delete;
+    AsioClientDriver& operator=(const AsioClientDriver&) = delete;
+    AsioClientDriver& operator=(AsioClientDriver&&) noexcept = delete;
+
+    /// Start iterating the client.
+    void start() {
+        if (!running_) {
+            running_ = true;
+            schedule(interval_);
+        }
+    }
+
+    /// Stop iterating the client, pending iterations are canceled.
+    void stop() noexcept {
+        running_ = false;
+        timer_.cancel();
+    }
+
+    /// Schedule an immediate iteration.
+    void wakeup() {
+        if (running_) {
+            schedule(std::chrono::milliseconds(0));
+        }
+    }
+
+    bool isRunning() const noexcept {
+        return running_;
+    }
+
+private:
+    void schedule(std::chrono::milliseconds delay) {
+        timer_.expires_after(delay);
+        timer_.async_wait([this](const auto& error) {
+            if (!error && running_) {
+                client_.runIterate(0);
+                schedule(interval_);
+            }
+        });
+    }
+
+    Client& client_;
+    std::chrono::milliseconds interval_;
+    net::steady_timer timer_;
+    bool running_{false};
+};
+
+/**
+ * Drive the main loop of a server with an Asio executor.
+ *
+ * The server is iterated without waiting (Server::runIterate), so it shares the executor's thread
+ * with clients and other I/O. The next iteration is scheduled at the deadline of the server's next
+ * timed event (e.g. publishing or sampling intervals), returned by runIterate, but at the latest
+ * after the poll interval to receive network messages. wakeup() schedules an immediate
+ * iteration, e.g. after values are written.
+ *
+ * The open62541 API does not expose the server's sockets, readiness based wakeups are therefore
+ * not possible and the poll interval bounds the latency of incoming requests. Exceptions of
+ * runIterate (e.g. from user callbacks) are propagated by the executor.
+ *
+ * The driver must not outlive the server and must be used from the executor's thread only.
+ * @code
+ * asio::io_context io;
+ * Server server;
+ * AsioServerDriver driver(io.get_executor(), server);
+ * driver.start();
+ * io.run();
+ * @endcode
+ */
+class AsioServerDriver {
+public:
+    AsioServerDriver(
+        net::any_io_executor executor,
+        Server& server,
+        std::chrono::milliseconds pollInterval = std::chrono::milliseconds(5)
+    )
+        : server_(server),
+          pollInterval_(pollInterval),
+          timer_(std::move(executor)) {}
+
+    ~AsioServerDriver() {
+        stop();
+    }
+
+    AsioServerDriver(const AsioServerDriver&) = delete;
+    AsioServerDriver(AsioServerDriver&&) noexcept = delete;
+    AsioServerDriver& operator=(const AsioServerDriver&) = delete;
+    AsioServerDriver& operator=(AsioServerDriver&&) noexcept = delete;
+
+    /// Start iterating the server (the server is started with the first iteration).
+    void start() {
+        if (!running_) {
+            running_ = true;
+            schedule(std::chrono::milliseconds(0));
+        }
+    }
+
+    /// Stop iterating the server, pending iterations are canceled. The server is not shut down.
+    void stop() noexcept {
+        running_ = false;
+        timer_.cancel();
+    }
+
+    /// Schedule an immediate iteration.
+    void wakeup() {
+        if (running_) {
+            schedule(std::chrono::milliseconds(0));
+        }
+    }
+
+    bool isRunning() const noexcept {
+        return running_;
+    }
+
+private:
+    void schedule(std::chrono::milliseconds delay) {
+        timer_.expires_after(delay);
+        timer_.async_wait([this](const auto& error) {
+            if (!error && running_) {
+                const std::chrono::milliseconds nextTimer(server_.runIterate());
+                schedule(std::min(nextTimer, pollInterval_));
+            }
+        });
+    }
+
+    Server& server_;
+    std::chrono::milliseconds pollInterval_;
+    net::steady_timer timer_;
+    bool running_{false};
+};
+
+namespace detail {
+
+/// Result of an eagerly initiated operation, awaited lazily by an Asio completion token.
+template <typename Result>
+struct AsioOperationState {
+    using Storage = std::conditional_t<std::is_void_v<Result>, bool, std::optional<Result>>;
+    using Handler = std::function<void(std::exception_ptr, AsioOperationState&)>;
+
+    std::exception_ptr exception;
+    Storage result{};
+    bool done{false};
+    Handler handler;
+
+    template <typename... Ts>
+    void complete(StatusCode code, Ts&&... value) {
+        if (code.isBad()) {
+            exception = std::make_exception_ptr(BadStatus(code));
+        } else if constexpr (!std::is_void_v<Result> && sizeof...(Ts) > 0) {
+            result.emplace(std::move(value)...);  // NOLINT
+        }
+        done = true;
+        if (handler) {
+            std::exchange(handler, {})(exception, *this);
+        }
+    }
+};
+
+/**
+ * Bridge to initiate async operations with Asio completion tokens (e.g. `asio::use_future`,
+ * `asio::use_awaitable`).
+ * Initiations of open62541pp reference arguments of the async function and must be invoked
+ * immediately. Lazy tokens like `use_awaitable` would defer the initiation, so the operation is
+ * started eagerly into a shared state and the token only waits for its completion.
+ * The completion signature is `void(std::exception_ptr, Result)`, the completion handler is invoked
+ * on its associated executor.
+ */
+template <typename CompletionToken, typename Result>
+struct AsioAsyncResult {
+    static_assert(std::is_same_v<CompletionToken, std::decay_t<CompletionToken>>);
+
+    using Signature = std::conditional_t<
+        std::is_void_v<Result>,
+        void(std::exception_ptr),
+        void(std::exception_ptr, Result)>;
+
+    template <typename Initiation, typename Token, typename... Args>
+    static auto initiate(Initiation&& initiation, Token&& token, Args&&... args) {
+        using State = AsioOperationState<Result>;
+        auto state = std::make_shared<State>();
+        std::invoke(
+            std::forward<Initiation>(initiation),
+            [state](StatusCode code, auto&&... result) {
+                state->complete(code, std::forward<decltype(result)>(result)...);
+            },
+            std::forward<Args>(args)...
+        );
+        return net::async_initiate<CompletionToken, Signature>(
+            [state](auto handler) {
+                // the handler is invoked on its associated executor (e.g. of the coroutine), not
+                // in the thread that completes the operation (e.g. Client::runIterate)
+                auto executor = net::get_associated_executor(handler);
+                auto ptr = std::make_shared<decltype(handler)>(std::move(handler));
+                auto bind = [ptr](std::exception_ptr exception, State& s) {
+                    if constexpr (std::is_void_v<Result>) {
+                        return [ptr, exception] { std::move(*ptr)(exception); };
+                    } else {
+                        Result result = exception ? Result{} : std::move(*s.result);
+                        return [ptr, exception, result = std::move(result)]() mutable {
+                            std::move(*ptr)(exception, std::move(result));
+                        };
+                    }
+                };
+                if (state->done) {
+                    // never complete inside the initiating function
+                    net::post(executor, bind(state->exception, *state));
+                } else {
+                    state->handler = [executor, bind](std::exception_ptr exception, State& s) {
+                        net::dispatch(executor, bind(std::move(exception), s));
+                    };
+                }
+            },
+            std::forward<Token>(token)
+        );
+    }
+};
+
+}  // namespace detail
+
+template <typename Allocator, typename Result>
+struct AsyncResult<net::use_future_t<Allocator>, Result>
+    : detail::AsioAsyncResult<net::use_future_t<Allocator>, Result> {};
+
+#if defined(ASIO_HAS_CO_AWAIT) || defined(BOOST_ASIO_HAS_CO_AWAIT)
+template <typename Executor, typename Result>
+struct AsyncResult<net::use_awaitable_t<Executor>, Result>
+    : detail::AsioAsyncResult<net::use_awaitable_t<Executor>, Result> {};
+#endif
+
+}  // namespace opcua
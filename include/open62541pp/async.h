@@ -1,11 +1,19 @@
 #pragma once
 
+#include <cstdint>
 #include <functional>  // invoke
 #include <future>
 #include <tuple>
 #include <type_traits>
 #include <utility>  // forward, move
 
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L
+#define UAPP_HAS_COROUTINES
+#include <coroutine>
+#include <exception>
+#include <optional>
+#endif
+
 #include "open62541pp/ErrorHandling.h"
 #include "open62541pp/types/Builtin.h"  // StatusCode
 
@@ -153,6 +161,290 @@ struct AsyncResult<UseDetachedToken, Result> {
     }
 };
 
+/* ------------------------------------------ Executor ------------------------------------------ */
+
+/**
+ * Bind a completion handler to an executor.
+ * The returned completion handler forwards the invocation with the (moved) results to the executor,
+ * e.g. to process completions of a client running in a background network thread on an
+ * application thread.
+ * @param executor Callable with the signature `void(std::function<void()>)` or compatible
+ * @param handler Completion handler
+ */
+template <typename Executor, typename CompletionHandler>
+auto bindExecutor(Executor executor, CompletionHandler&& handler) {
+    return [executor = std::move(executor),
+            handler = std::forward<CompletionHandler>(handler)](
+               StatusCode code, auto&&... result
+           ) mutable {
+        // NOLINTNEXTLINE(bugprone-move-forwarding-reference), results are owned by the caller
+        executor([handler, code, args = std::make_tuple(std::move(result)...)]() mutable {
+            std::apply([&](auto&... values) { std::invoke(handler, code, values...); }, args);
+        });
+    };
+}
+
+/* ------------------------------------------ Awaitable ----------------------------------------- */
+
+#ifdef UAPP_HAS_COROUTINES
+
+/**
+ * Awaitable completion token type (C++20).
+ * The token is used to indicate that an asynchronous operation should return an Awaitable, that
+ * can be awaited with `co_await` in a coroutine.
+ */
+struct UseAwaitableToken {};
+
+/**
+ * Awaitable completion token object (C++20).
+ * @see UseAwaitableToken
+ */
+constexpr UseAwaitableToken useAwaitable;
+
+/**
+ * Result of an asynchronous operation initiated with the `useAwaitable` completion token.
+ * The operation is initiated immediately. The awaiting coroutine is resumed directly by the
+ * completion handler, e.g. from the client's async service callback within Client::runIterate.
+ * The result is stored in the awaitable itself, no further allocation or synchronization is
+ * required. A bad status code is thrown as BadStatus by `co_await`.
+ *
+ * The awaitable is neither copyable nor movable and must be kept alive until the operation has
+ * completed. Await it directly: `co_await services::readValueAsync(client, id, useAwaitable)`.
+ */
+template <typename Result>
+class [[nodiscard]] Awaitable {
+public:
+    template <typename Initiation, typename... Args>
+    explicit Awaitable(Initiation&& initiation, Args&&... args) {
+        std::invoke(
+            std::forward<Initiation>(initiation),
+            [this](StatusCode code, auto&&... result) {
+                complete(code, std::move(result)...);  // NOLINT, move result out of the handler
+            },
+            std::forward<Args>(args)...
+        );
+    }
+
+    ~Awaitable() = default;
+
+    Awaitable(const Awaitable&) = delete;
+    Awaitable(Awaitable&&) noexcept = delete;
+    Awaitable& operator=(const Awaitable&) = delete;
+    Awaitable& operator=(Awaitable&&) noexcept = delete;
+
+    bool await_ready() const noexcept {  // NOLINT(readability-identifier-naming)
+        return done_;
+    }
+
+    void await_suspend(std::coroutine_handle<> handle) noexcept {  // NOLINT
+        continuation_ = handle;
+    }
+
+    Result await_resume() {  // NOLINT(readability-identifier-naming)
+        if (code_.isBad()) {
+            throw BadStatus(code_);
+        }
+        if constexpr (!std::is_void_v<Result>) {
+            return std::move(*result_);
+        }
+    }
+
+private:
+    template <typename... Ts>
+    void complete(StatusCode code, Ts&&... result) {
+        code_ = code;
+        if constexpr (!std::is_void_v<Result> && sizeof...(Ts) > 0) {
+            if (code.isGood()) {
+                result_.emplace(std::forward<Ts>(result)...);
+            }
+        }
+        done_ = true;
+        if (continuation_) {
+            std::exchange(continuation_, {}).resume();
+        }
+    }
+
+    struct Empty {};
+    using Storage = std::conditional_t<std::is_void_v<Result>, Empty, std::optional<Result>>;
+
+    StatusCode code_;
+    bool done_{false};
+    std::coroutine_handle<> continuation_;
+    [[no_unique_address]] Storage result_;
+};
+
+template <typename Result>
+struct AsyncResult<UseAwaitableToken, Result> {
+    template <typename Initiation, typename... Args>
+    static auto initiate(Initiation&& initiation, UseAwaitableToken /*unused*/, Args&&... args) {
+        // guaranteed copy elision, the awaitable is constructed in place of the co_await operand
+        return Awaitable<Result>(std::forward<Initiation>(initiation), std::forward<Args>(args)...);
+    }
+};
+
+namespace detail {
+
+template <typename T>
+struct TaskPromiseResult {
+    std::optional<T> value;
+
+    template <typename U>
+    void return_value(U&& result) {  // NOLINT(readability-identifier-naming)
+        value.emplace(std::forward<U>(result));
+    }
+
+    T take() {
+        return std::move(*value);
+    }
+};
+
+template <>
+struct TaskPromiseResult<void> {
+    void return_void() noexcept {}  // NOLINT(readability-identifier-naming)
+
+    void take() noexcept {}
+};
+
+}  // namespace detail
+
+/**
+ * Lazily started coroutine task (C++20).
+ * A task is started by awaiting it from another coroutine or by runUntilComplete.
+ * @code
+ * Task<std::string> readName(Client& client, const NodeId& id) {
+ *     auto dv = co_await services::readAttributeAsync(
+ *         client, id, AttributeId::BrowseName, TimestampsToReturn::Neither, useAwaitable
+ *     );
+ *     co_return std::string(dv.getValue().getScalar<QualifiedName>().getName());
+ * }
+ *
+ * const auto name = runUntilComplete(client, readName(client, id));
+ * @endcode
+ */
+template <typename T = void>
+class [[nodiscard]] Task {
+public:
+    struct promise_type : detail::TaskPromiseResult<T> {  // NOLINT(readability-identifier-naming)
+        std::coroutine_handle<> continuation;
+        std::exception_ptr exception;
+        bool started{false};
+
+        Task get_return_object() noexcept {  // NOLINT(readability-identifier-naming)
+            return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() noexcept {  // NOLINT
+            return {};
+        }
+
+        auto final_suspend() noexcept {  // NOLINT(readability-identifier-naming)
+            struct FinalAwaiter {
+                bool await_ready() noexcept {  // NOLINT(readability-identifier-naming)
+                    return false;
+                }
+
+                std::coroutine_handle<> await_suspend(  // NOLINT
+                    std::coroutine_handle<promise_type> handle
+                ) noexcept {
+                    auto continuation = handle.promise().continuation;
+                    return continuation ? continuation : std::noop_coroutine();
+                }
+
+                void await_resume() noexcept {}  // NOLINT(readability-identifier-naming)
+            };
+
+            return FinalAwaiter{};
+        }
+
+        void unhandled_exception() noexcept {  // NOLINT(readability-identifier-naming)
+            exception = std::current_exception();
+        }
+    };
+
+    ~Task() {
+        if (handle_) {
+            handle_.destroy();
+        }
+    }
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    Task(Task&& other) noexcept
+        : handle_(std::exchange(other.handle_, {})) {}
+
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            if (handle_) {
+                handle_.destroy();
+            }
+            handle_ = std::exchange(other.handle_, {});
+        }
+        return *this;
+    }
+
+    /// Start the task, if not started yet.
+    void start() {
+        if (handle_ && !handle_.promise().started) {
+            handle_.promise().started = true;
+            handle_.resume();
+        }
+    }
+
+    /// Check if the task has completed.
+    bool done() const noexcept {
+        return !handle_ || handle_.done();
+    }
+
+    /// Get the result of a completed task or rethrow its exception.
+    T get() {
+        auto& promise = handle_.promise();
+        if (promise.exception) {
+            std::rethrow_exception(promise.exception);
+        }
+        return promise.take();
+    }
+
+    bool await_ready() const noexcept {  // NOLINT(readability-identifier-naming)
+        return done();
+    }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> handle) noexcept {  // NOLINT
+        handle_.promise().continuation = handle;
+        handle_.promise().started = true;
+        return handle_;  // symmetric transfer
+    }
+
+    T await_resume() {  // NOLINT(readability-identifier-naming)
+        return get();
+    }
+
+private:
+    explicit Task(std::coroutine_handle<promise_type> handle) noexcept
+        : handle_(handle) {}
+
+    std::coroutine_handle<promise_type> handle_;
+};
+
+/**
+ * Run a task to completion by driving the main loop of the client (C++20).
+ * Async responses are processed with `runIterate`, awaiting coroutines are resumed within.
+ * @param connection Instance of type Client
+ * @param task Task to run
+ * @param timeoutMilliseconds Timeout of each `runIterate` call
+ * @return Result of the task, exceptions are rethrown
+ */
+template <typename Connection, typename T>
+T runUntilComplete(Connection& connection, Task<T> task, uint16_t timeoutMilliseconds = 10) {
+    task.start();
+    while (!task.done()) {
+        connection.runIterate(timeoutMilliseconds);
+    }
+    return task.get();
+}
+
+#endif
+
 /* ------------------------------------------ Defaults ------------------------------------------ */
 
 /**
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "open62541pp/ServerMetrics.h"  // AdmissionLimits, AdmissionMetrics
+#include "open62541pp/open62541.h"
+
+namespace opcua::detail {
+
+/**
+ * Admission control of the data source and method callbacks (see Server::setAdmissionLimits).
+ * Operations are counted per server iteration, the iteration is advanced by the run loop.
+ * Callbacks of a server are serialized by open62541, only the rejection counters are atomic.
+ */
+class AdmissionController {
+public:
+    AdmissionController() = default;
+    ~AdmissionController();
+
+    AdmissionController(const AdmissionController&) = delete;
+    AdmissionController(AdmissionController&&) noexcept = delete;
+    AdmissionController& operator=(const AdmissionController&) = delete;
+    AdmissionController& operator=(AdmissionController&&) noexcept = delete;
+
+    /// Any operation limit set.
+    bool isEnabled() const noexcept {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    void setLimits(const AdmissionLimits& limits) noexcept;
+
+    const AdmissionLimits& getLimits() const noexcept {
+        return limits_;
+    }
+
+    /// Advance to the next server iteration.
+    void nextIteration() noexcept {
+        ++iteration_;
+        reads_ = 0;
+    }
+
+    /**
+     * Admit an operation.
+     * @param server Native server
+     * @param sessionContext Native session context, per-session limits only apply to sessions
+     *                       activated by CustomAccessControl
+     * @param read Data source read
+     * @return `UA_STATUSCODE_GOOD` if admitted, the rejection status otherwise
+     */
+    UA_StatusCode admit(UA_Server* server, void* sessionContext, bool read) noexcept;
+
+    void snapshot(AdmissionMetrics& metrics) const noexcept;
+
+    void reset() noexcept;
+
+private:
+    std::atomic<bool> enabled_{false};
+    AdmissionLimits limits_;
+    uint64_t iteration_{1};
+    size_t reads_{0};
+    std::atomic<uint64_t> rejectedOperations_{0};
+    std::atomic<uint64_t> rejectedReads_{0};
+};
+
+/// Get the admission controller of the native server, `nullptr` if no operation limits are set.
+/// Costs a single atomic load if no operation limits are set on any server.
+AdmissionController* getAdmissionController(UA_Server* server) noexcept;
+
+/// Admit an operation of a native callback, `UA_STATUSCODE_GOOD` if no limits are set.
+inline UA_StatusCode admitOperation(UA_Server* server, void* sessionContext, bool read) noexcept {
+    auto* controller = getAdmissionController(server);
+    return controller != nullptr ? controller->admit(server, sessionContext, read)
+                                 : UA_STATUSCODE_GOOD;
+}
+
+}  // namespace opcua::detail
@@ -0,0 +1,189 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>  // exchange, forward
+#include <vector>
+
+namespace opcua::detail {
+
+/**
+ * Pool of reusable memory blocks for small, short-lived objects (e.g. async callback contexts).
+ * Blocks are grouped in size classes. Released blocks are kept in a free list per size class and
+ * reused by subsequent allocations, so the allocation is free of heap operations in steady state.
+ * Objects larger than the largest size class or over-aligned objects use the global allocator.
+ */
+class BlockPool {
+public:
+    static constexpr std::array<size_t, 4> blockSizes{64, 128, 256, 512};
+#ifdef UAPP_LOW_MEMORY
+    static constexpr size_t maxFreeBlocks = 16;  // per size class
+#else
+    static constexpr size_t maxFreeBlocks = 256;  // per size class
+#endif
+
+    BlockPool() = default;
+
+    ~BlockPool() {
+        for (auto& sizeClass : classes_) {
+            while (sizeClass.head != nullptr) {
+                ::operator delete(std::exchange(sizeClass.head, sizeClass.head->next));
+            }
+        }
+    }
+
+    BlockPool(const BlockPool&) = delete;
+    BlockPool(BlockPool&&) noexcept = delete;
+    BlockPool& operator=(const BlockPool&) = delete;
+    BlockPool& operator=(BlockPool&&) noexcept = delete;
+
+    [[nodiscard]] void* allocate(size_t size, size_t alignment) {
+        const size_t index = getSizeClass(size, alignment);
+        if (index < blockSizes.size()) {
+            auto& sizeClass = classes_[index];  // NOLINT
+            const std::lock_guard lock(mutex_);
+            if (sizeClass.head != nullptr) {
+                --sizeClass.count;
+                return std::exchange(sizeClass.head, sizeClass.head->next);
+            }
+            return ::operator new(blockSizes[index]);  // NOLINT
+        }
+        return ::operator new(size);
+    }
+
+    void deallocate(void* ptr, size_t size, size_t alignment) noexcept {
+        const size_t index = getSizeClass(size, alignment);
+        if (index < blockSizes.size()) {
+            auto& sizeClass = classes_[index];  // NOLINT
+            const std::lock_guard lock(mutex_);
+            if (sizeClass.count < maxFreeBlocks) {
+                sizeClass.head = new (ptr) FreeBlock{sizeClass.head};
+                ++sizeClass.count;
+                return;
+            }
+        }
+        ::operator delete(ptr);
+    }
+
+    /// Number of cached blocks in the free lists.
+    size_t freeBlocks() const noexcept {
+        const std::lock_guard lock(mutex_);
+        size_t count = 0;
+        for (const auto& sizeClass : classes_) {
+            count += sizeClass.count;
+        }
+        return count;
+    }
+
+private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    struct SizeClass {
+        FreeBlock* head = nullptr;
+        size_t count = 0;
+    };
+
+    static constexpr size_t getSizeClass(size_t size, size_t alignment) noexcept {
+        if (alignment > alignof(std::max_align_t)) {
+            return blockSizes.size();
+        }
+        size_t index = 0;
+        while (index < blockSizes.size() && blockSizes[index] < size) {  // NOLINT
+            ++index;
+        }
+        return index;
+    }
+
+    mutable std::mutex mutex_;
+    std::array<SizeClass, blockSizes.size()> classes_{};
+};
+
+/// Deleter for objects created with makePooled.
+template <typename T>
+struct BlockPoolDeleter {
+    BlockPool* pool;
+
+    void operator()(T* ptr) const noexcept {
+        ptr->~T();
+        pool->deallocate(ptr, sizeof(T), alignof(T));
+    }
+};
+
+template <typename T>
+using PooledPtr = std::unique_ptr<T, BlockPoolDeleter<T>>;
+
+/// Create object in memory of the block pool.
+template <typename T, typename... Args>
+[[nodiscard]] PooledPtr<T> makePooled(BlockPool& pool, Args&&... args) {
+    void* ptr = pool.allocate(sizeof(T), alignof(T));
+    try {
+        return PooledPtr<T>(new (ptr) T(std::forward<Args>(args)...), {&pool});
+    } catch (...) {
+        pool.deallocate(ptr, sizeof(T), alignof(T));
+        throw;
+    }
+}
+
+/**
+ * Slab allocator for objects of a single type.
+ * Memory is allocated in slabs of `SlotsPerSlab` contiguous slots, so objects created one after
+ * another (e.g. the contexts of all monitored items of a subscription) are close in memory.
+ * Released slots are kept in a free list and reused, slabs are freed with the allocator.
+ */
+template <typename T, size_t SlotsPerSlab = 64>
+class SlabAllocator {
+public:
+    SlabAllocator() = default;
+    SlabAllocator(const SlabAllocator&) = delete;
+    SlabAllocator(SlabAllocator&&) noexcept = delete;
+    SlabAllocator& operator=(const SlabAllocator&) = delete;
+    SlabAllocator& operator=(SlabAllocator&&) noexcept = delete;
+    ~SlabAllocator() = default;
+
+    /// Allocate uninitialized memory of one object.
+    [[nodiscard]] void* allocate() {
+        const std::lock_guard lock(mutex_);
+        if (free_ == nullptr) {
+            grow();
+        }
+        return std::exchange(free_, free_->next);
+    }
+
+    /// Release memory of one object allocated with allocate.
+    void deallocate(void* ptr) noexcept {
+        const std::lock_guard lock(mutex_);
+        free_ = new (ptr) Slot{free_};
+    }
+
+    /// Number of allocated slabs.
+    size_t slabCount() const noexcept {
+        const std::lock_guard lock(mutex_);
+        return slabs_.size();
+    }
+
+private:
+    union Slot {
+        Slot* next;
+        alignas(T) std::byte storage[sizeof(T)];  // NOLINT
+    };
+
+    void grow() {
+        auto slab = std::make_unique<Slot[]>(SlotsPerSlab);  // NOLINT
+        for (size_t i = SlotsPerSlab; i-- > 0;) {
+            slab[i].next = free_;
+            free_ = &slab[i];
+        }
+        slabs_.push_back(std::move(slab));
+    }
+
+    mutable std::mutex mutex_;
+    Slot* free_ = nullptr;
+    std::vector<std::unique_ptr<Slot[]>> slabs_;  // NOLINT
+};
+
+}  // namespace opcua::detail
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>  // move
+
+namespace opcua::detail {
+
+/**
+ * Lock-free, bounded queue with preallocated slots (ring buffer with sequence numbers).
+ * Push and pop positions are claimed with compare-and-swap, so multiple producers and consumers
+ * are safe. tryPop may also be called by a producer to discard the oldest element if the queue is
+ * full.
+ * The capacity is rounded up to the next power of two.
+ * @see https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+ */
+template <typename T>
+class BoundedQueue {
+public:
+    explicit BoundedQueue(size_t capacity)
+        : mask_(roundUpPowerOfTwo(capacity) - 1),
+          slots_(std::make_unique<Slot[]>(mask_ + 1)) {  // NOLINT
+        for (size_t i = 0; i <= mask_; ++i) {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    BoundedQueue(const BoundedQueue&) = delete;
+    BoundedQueue(BoundedQueue&&) noexcept = delete;
+    BoundedQueue& operator=(const BoundedQueue&) = delete;
+    BoundedQueue& operator=(BoundedQueue&&) noexcept = delete;
+
+    ~BoundedQueue() = default;
+
+    /// Push value if the queue is not full.
+    /// @return `false` if the queue is full, the value is not moved then
+    bool tryPush(T& value) {
+        size_t pos = pushPos_.load(std::memory_order_relaxed);
+        Slot* slot = nullptr;
+        for (;;) {
+            slot = &slots_[pos & mask_];
+            const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (pushPos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;  // full
+            } else {
+                pos = pushPos_.load(std::memory_order_relaxed);
+            }
+        }
+        slot->value.emplace(std::move(value));
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Pop the oldest value.
+    /// @return Value or `std::nullopt` if the queue is empty
+    std::optional<T> tryPop() {
+        size_t pos = popPos_.load(std::memory_order_relaxed);
+        Slot* slot = nullptr;
+        for (;;) {
+            slot = &slots_[pos & mask_];
+            const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (popPos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return std::nullopt;  // empty
+            } else {
+                pos = popPos_.load(std::memory_order_relaxed);
+            }
+        }
+        std::optional<T> value(std::move(slot->value));
+        slot->value.reset();
+        slot->sequence.store(pos + mask_ + 1, std::memory_order_release);
+        return value;
+    }
+
+    /// Maximum number of elements.
+    size_t capacity() const noexcept {
+        return mask_ + 1;
+    }
+
+    /// Approximate number of elements.
+    size_t size() const noexcept {
+        const size_t pushPos = pushPos_.load(std::memory_order_acquire);
+        const size_t popPos = popPos_.load(std::memory_order_acquire);
+        return pushPos > popPos ? pushPos - popPos : 0;
+    }
+
+private:
+    static size_t roundUpPowerOfTwo(size_t value) noexcept {
+        size_t result = 1;
+        while (result < value) {
+            result <<= 1U;
+        }
+        return result;
+    }
+
+    struct Slot {
+        std::atomic<size_t> sequence{0};
+        std::optional<T> value;
+    };
+
+    static constexpr size_t cacheLineSize = 64;
+
+    size_t mask_;
+    std::unique_ptr<Slot[]> slots_;  // NOLINT
+    alignas(cacheLineSize) std::atomic<size_t> pushPos_{0};  // producers
+    alignas(cacheLineSize) std::atomic<size_t> popPos_{0};  // consumers
+};
+
+}  // namespace opcua::detail
@@ -3,12 +3,26 @@
 #include <array>
 #include <cassert>
 #include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
 #include <utility>  // pair
+#include <vector>
 
+#include "open62541pp/AttributeCache.h"
 #include "open62541pp/Client.h"
 #include "open62541pp/Config.h"
+#include "open62541pp/NamespaceTable.h"
+#include "open62541pp/detail/BlockPool.h"
+#include "open62541pp/detail/ClientMetricsRecorder.h"
 #include "open62541pp/detail/ContextMap.h"
+#include "open62541pp/detail/DiagnosticsSampler.h"
 #include "open62541pp/detail/ExceptionCatcher.h"
+#include "open62541pp/detail/MemoryAccounting.h"
+#include "open62541pp/detail/HandlePool.h"
+#include "open62541pp/detail/RequestScheduler.h"
+#include "open62541pp/detail/SubscriptionRegistry.h"
 #include "open62541pp/open62541.h"
 #include "open62541pp/services/detail/MonitoredItemContext.h"
 #include "open62541pp/services/detail/SubscriptionContext.h"
@@ -33,8 +47,11 @@ public:
     using SubId = uint32_t;
     using MonId = uint32_t;
     using SubMonId = std::pair<uint32_t, uint32_t>;
+    detail::HandlePool monitoredItemHandles;  // dense client handles, must outlive the contexts
     detail::ContextMap<SubId, services::detail::SubscriptionContext> subscriptions;
     detail::ContextMap<SubMonId, services::detail::MonitoredItemContext> monitoredItems;
+    std::vector<SubId> pendingDataChangeBatches;  // delivered after each client iteration
+    std::unique_ptr<SubscriptionRegistry> subscriptionRegistry;  // optional, for recovery
 #endif
 
 #if UAPP_OPEN62541_VER_LE(1, 0)
@@ -45,7 +62,19 @@ public:
 #endif
     std::array<StateCallback, clientStateCount> stateCallbacks;
 
+    std::string endpointUrl;  // of the last connect call, used by reconnect
+    std::optional<NamespaceTable> namespaceTable;  // cached, reset on reconnect/disconnect
+    std::optional<OperationLimits> operationLimits;  // cached, reset on connect/disconnect
+    std::shared_ptr<AttributeCache> attributeCache;  // optional, cleared on reconnect/disconnect
+    std::unordered_map<NodeId, NodeId> registeredNodes;  // original -> alias of current session
+    uint32_t lastRequestHandle{0};  // manual request handles of cancellable requests
+
     detail::ExceptionCatcher exceptionCatcher;
+    detail::ClientMetricsRecorder metrics;  // lock-free, must outlive the async contexts
+    detail::MemoryAccountingSwitch memoryAccounting;
+    detail::DiagnosticsSampler diagnostics;
+    detail::BlockPool contextPool;  // async callback contexts, must outlive the request scheduler
+    detail::RequestScheduler requestScheduler;  // destroyed first, cancels queued requests
 };
 
 /* ---------------------------------------------------------------------------------------------- */
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>  // exchange, move
+
+#include "open62541pp/ClientMetrics.h"
+#include "open62541pp/detail/ExceptionCatcher.h"
+#include "open62541pp/detail/MetricsRecorder.h"  // AtomicLatencyHistogram
+#include "open62541pp/open62541.h"
+#include "open62541pp/typeregistry/Builtin.h"
+
+namespace opcua::detail {
+
+inline constexpr size_t clientServiceCount = 64;  // the last slot collects all further services
+
+/// Register a service by its response type, returns a stable index < clientServiceCount.
+size_t registerClientService(const UA_DataType& responseType) noexcept;
+
+/// Get the name of a registered service, e.g. `Read`.
+std::string getClientServiceName(size_t index);
+
+/// Get the service index of a response type, registered once.
+template <typename Response>
+size_t getClientServiceIndex() noexcept {
+    static const size_t index = registerClientService(getDataType<Response>());
+    return index;
+}
+
+/**
+ * Storage of the client metrics and the request tracer, part of the ClientContext.
+ * Recording is lock-free. Requests are recorded with RequestTrace.
+ */
+class ClientMetricsRecorder {
+public:
+    ClientMetricsRecorder() = default;
+
+    bool isEnabled() const noexcept {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    void setEnabled(bool enabled) noexcept {
+        enabled_.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool isTracing() const noexcept {
+        return tracing_.load(std::memory_order_relaxed);
+    }
+
+    void setTracer(std::shared_ptr<RequestTracer> tracer);
+    std::shared_ptr<RequestTracer> getTracer() const;
+
+    void recordStart() noexcept;
+    void recordEnd(size_t service, std::chrono::nanoseconds duration, StatusCode status) noexcept;
+
+    ClientMetrics snapshot() const;
+
+    /// Reset the counters and histograms, requests in flight are kept.
+    void reset() noexcept;
+
+private:
+    struct Service {
+        std::atomic<uint64_t> requests{0};
+        std::atomic<uint64_t> badStatus{0};
+        std::atomic<uint64_t> timeouts{0};
+        AtomicLatencyHistogram latency;
+    };
+
+    std::atomic<bool> enabled_{false};
+    std::atomic<bool> tracing_{false};
+    std::atomic<uint64_t> inFlight_{0};
+    std::atomic<uint64_t> maxInFlight_{0};
+    std::array<Service, clientServiceCount> services_{};
+    mutable std::mutex tracerMutex_;
+    std::shared_ptr<RequestTracer> tracer_;
+};
+
+/**
+ * Trace of a single client request, stored in the context of async requests.
+ * Inactive (a few null members) if neither metrics nor tracing were enabled at the start.
+ * The trace is ended once with the service result, or with `BadUnexpectedError` on destruction.
+ */
+class RequestTrace {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    RequestTrace() noexcept = default;
+
+    template <typename Response>
+    static RequestTrace start(ClientMetricsRecorder& recorder, ExceptionCatcher& catcher) {
+        if (!recorder.isEnabled() && !recorder.isTracing()) {
+            return {};
+        }
+        return {recorder, catcher, getClientServiceIndex<Response>()};
+    }
+
+    ~RequestTrace() {
+        end(UA_STATUSCODE_BADUNEXPECTEDERROR);
+    }
+
+    RequestTrace(const RequestTrace&) = delete;
+
+    RequestTrace(RequestTrace&& other) noexcept
+        : recorder_(std::exchange(other.recorder_, nullptr)),
+          catcher_(other.catcher_),
+          service_(other.service_),
+          metrics_(other.metrics_),
+          start_(other.start_),
+          tracer_(std::move(other.tracer_)),
+          span_(other.span_) {}
+
+    RequestTrace& operator=(const RequestTrace&) = delete;
+    RequestTrace& operator=(RequestTrace&&) noexcept = delete;
+
+    bool isActive() const noexcept {
+        return recorder_ != nullptr;
+    }
+
+    void end(StatusCode status) noexcept {
+        if (isActive()) {
+            finish(status);
+        }
+    }
+
+private:
+    RequestTrace(ClientMetricsRecorder& recorder, ExceptionCatcher& catcher, size_t service);
+
+    void finish(StatusCode status) noexcept;
+
+    ClientMetricsRecorder* recorder_{nullptr};
+    ExceptionCatcher* catcher_{nullptr};
+    size_t service_{0};
+    bool metrics_{false};  // metrics were enabled at the start
+    Clock::time_point start_;
+    std::shared_ptr<RequestTracer> tracer_;
+    void* span_{nullptr};
+};
+
+}  // namespace opcua::detail
@@ -1,88 +1,310 @@
 #pragma once
 
-#include <map>
+#include <algorithm>  // max
+#include <array>
+#include <cstddef>
+#include <functional>  // hash
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <type_traits>
+#include <unordered_map>
+#include <utility>  // as_const, move, pair
+#include <vector>
 
+#include "open62541pp/detail/MemoryAccounting.h"
 #include "open62541pp/detail/Staleable.h"
 
 namespace opcua::detail {
 
+/// Hash function of ContextMap keys, combines the hashes of pair elements.
+template <typename Key>
+struct ContextMapHash : std::hash<Key> {};
+
+template <typename T1, typename T2>
+struct ContextMapHash<std::pair<T1, T2>> {
+    size_t operator()(const std::pair<T1, T2>& pair) const noexcept {
+        const size_t seed = std::hash<T1>()(pair.first);
+        return seed ^ (std::hash<T2>()(pair.second) + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+    }
+};
+
 /**
  * Thread-safe map for context objects.
  * Context objects are reference as `void*` pointers in open62541 functions/callbacks. To prevent
  * pointer-invalidation, the objects are stored as unique pointers.
- * Stale objects will be removed when new objects are stored in the map.
+ *
+ * The map is split into shards (hash maps) with their own reader-writer lock, so lookups only
+ * take a shared lock of a single shard and concurrent insertions rarely contend.
+ *
+ * Objects derived from Staleable, that are marked with Staleable::markStale, are linked into an
+ * intrusive stale list of the map and reclaimed at the next insertion (the safe point) in O(1)
+ * per object, without a sweep over the map. Reclaimed objects are reset and reused for new
+ * elements created with `operator[]`.
+ *
+ * All objects owned by the map (elements, stale and recycled objects) are counted for the memory
+ * statistics, see getMemoryCounter.
  */
 template <typename Key, typename Item>
 class ContextMap {
 public:
+    ContextMap() = default;
+    ContextMap(const ContextMap&) = delete;
+    ContextMap(ContextMap&&) = delete;
+    ContextMap& operator=(const ContextMap&) = delete;
+    ContextMap& operator=(ContextMap&&) = delete;
+
+    ~ContextMap() {
+        if constexpr (reclaimable) {
+            // objects of removed elements are owned by the stale list
+            for (Staleable* it = staleList_.takeAll(); it != nullptr;) {
+                auto* item = static_cast<Item*>(it);
+                it = it->nextStale;
+                if (item->staleDetached) {
+                    delete item;  // NOLINT
+                }
+            }
+        }
+    }
+
     /// Access or insert specified element
-    Item* operator[](Key key) {
-        eraseStale();
-        auto lock = acquireLock();
-        auto& item = map_[key];
-        if (item == nullptr) {
-            item = std::make_unique<Item>();  // allocate item if empty
+    Item* operator[](const Key& key) {
+        reclaim();
+        const size_t index = getShardIndex(key);
+        auto& shard = shards_[index];
+        const std::unique_lock lock(shard.mutex);
+        auto& entry = *shard.map.try_emplace(key).first;
+        if (entry.second == nullptr || isStale(*entry.second)) {
+            dispose(entry.second);
+            entry.second = allocate();  // allocate item if empty or stale
+            track(entry, index);
         }
-        return item.get();
+        return entry.second.get();
     }
 
     /// Inserts an element or assigns to the current element if the key already exists
-    Item* insert(Key key, std::unique_ptr<Item>&& item) {
-        eraseStale();
-        auto lock = acquireLock();
-        return map_.insert_or_assign(key, std::move(item)).first->second.get();
+    Item* insert(const Key& key, std::unique_ptr<Item>&& item) {
+        reclaim();
+        const size_t index = getShardIndex(key);
+        auto& shard = shards_[index];
+        const std::unique_lock lock(shard.mutex);
+        auto& entry = *shard.map.try_emplace(key).first;
+        dispose(entry.second);
+        entry.second = std::move(item);
+        if (entry.second != nullptr) {
+            memory_.adopt();
+        }
+        track(entry, index);
+        return entry.second.get();
     }
 
-    size_t erase(Key key) {
-        auto lock = acquireLock();
-        return map_.erase(key);
+    size_t erase(const Key& key) {
+        auto& shard = shards_[getShardIndex(key)];
+        const std::unique_lock lock(shard.mutex);
+        const auto it = shard.map.find(key);
+        if (it == shard.map.end()) {
+            return 0;
+        }
+        dispose(it->second);
+        shard.map.erase(it);
+        return 1;
+    }
+
+    /// Erase the elements of all keys in the range [first, last)
+    template <typename InputIt>
+    size_t erase(InputIt first, InputIt last) {
+        size_t count = 0;
+        for (; first != last; ++first) {
+            count += erase(*first);
+        }
+        return count;
     }
 
+    /// Remove all stale objects of all shards (full sweep).
     size_t eraseStale() {
-        const size_t count = map_.size();
-        if constexpr (IsStaleable<Item>::value) {
-            auto lock = acquireLock();
-            for (auto it = map_.begin(); it != map_.end();) {
-                if (it->second->stale) {
-                    it = map_.erase(it);
+        reclaim();
+        size_t count = 0;
+        for (auto& shard : shards_) {
+            const std::unique_lock lock(shard.mutex);
+            for (auto it = shard.map.begin(); it != shard.map.end();) {
+                if (isStale(*it->second)) {
+                    dispose(it->second);
+                    it = shard.map.erase(it);
+                    ++count;
                 } else {
                     ++it;
                 }
             }
         }
-        return count - map_.size();
+        return count;
     }
 
-    bool contains(Key key) const {
-        auto lock = acquireLock();
-        return map_.count(key) > 0;
+    /// Reclaim all objects marked with Staleable::markStale.
+    /// Called automatically before insertions.
+    size_t reclaim() {
+        size_t count = 0;
+        if constexpr (reclaimable) {
+            for (Staleable* it = staleList_.takeAll(); it != nullptr; ++count) {
+                auto* item = static_cast<Item*>(it);
+                it = it->nextStale;
+                std::unique_ptr<Item> owned;
+                {
+                    auto& shard = shards_[item->staleShard];
+                    const std::unique_lock lock(shard.mutex);
+                    if (staleList_.isDetached(*item)) {
+                        owned.reset(item);  // element already removed
+                    } else {
+                        auto* entry = static_cast<typename Map::value_type*>(item->staleEntry);
+                        owned = std::move(entry->second);
+                        shard.map.erase(shard.map.find(entry->first));
+                    }
+                }
+                recycle(std::move(owned));
+            }
+        }
+        return count;
     }
 
-    const Item* find(Key key) const {
-        auto lock = acquireLock();
-        auto it = map_.find(key);
-        if (it != map_.end()) {
+    bool contains(const Key& key) const {
+        const auto& shard = getShard(key);
+        const std::shared_lock lock(shard.mutex);
+        return shard.map.count(key) > 0;
+    }
+
+    const Item* find(const Key& key) const {
+        const auto& shard = getShard(key);
+        const std::shared_lock lock(shard.mutex);
+        auto it = shard.map.find(key);
+        if (it != shard.map.end()) {
             return it->second.get();
         }
         return nullptr;
     }
 
-    /// Acquire the lock/mutex for unique access to the underlying map.
-    [[nodiscard]] auto acquireLock() const {
-        return std::lock_guard(mutex_);
+    Item* find(const Key& key) {
+        return const_cast<Item*>(std::as_const(*this).find(key));  // NOLINT
+    }
+
+    /// Number of elements, including stale objects that were not swept yet.
+    size_t size() const {
+        size_t count = 0;
+        for (const auto& shard : shards_) {
+            const std::shared_lock lock(shard.mutex);
+            count += shard.map.size();
+        }
+        return count;
+    }
+
+    /// Counter of the objects owned by the map, including stale and recycled objects.
+    const MemoryCounter& getMemoryCounter() const noexcept {
+        return memory_;
     }
 
-    /// Get access to the underlying map. Use `acquireLock` before any operation.
-    const auto& underlying() const noexcept {
-        return map_;
+    /// Invoke `visitor(key, item)` for all elements (except stale objects), shard by shard.
+    /// The visitor is called with the shard locked, it must not access the map.
+    template <typename Visitor>
+    void forEach(Visitor&& visitor) const {
+        for (const auto& shard : shards_) {
+            const std::shared_lock lock(shard.mutex);
+            for (const auto& [key, item] : shard.map) {
+                if (!isStale(*item)) {
+                    visitor(key, *item);
+                }
+            }
+        }
     }
 
 private:
-    std::map<Key, std::unique_ptr<Item>> map_;
-    mutable std::mutex mutex_;
+#ifdef UAPP_LOW_MEMORY
+    static constexpr size_t shardCount = 1;
+    static constexpr size_t maxRecycled = 16;
+#else
+    static constexpr size_t shardCount = 16;
+    static constexpr size_t maxRecycled = 1024;
+#endif
+    static constexpr bool reclaimable = std::is_base_of_v<Staleable, Item>;
+
+    using Map = std::unordered_map<Key, std::unique_ptr<Item>, ContextMapHash<Key>>;
+
+    struct Shard {
+        Map map;
+        mutable std::shared_mutex mutex;
+    };
+
+    static size_t getShardIndex(const Key& key) {
+        return ContextMapHash<Key>()(key) % shardCount;
+    }
+
+    const Shard& getShard(const Key& key) const {
+        return shards_[getShardIndex(key)];
+    }
+
+    static bool isStale([[maybe_unused]] const Item& item) noexcept {
+        if constexpr (IsStaleable<Item>::value) {
+            return item.stale;
+        } else {
+            return false;
+        }
+    }
+
+    /// Link the element to the stale list, called with the shard locked.
+    void track(typename Map::value_type& entry, [[maybe_unused]] size_t index) {
+        if constexpr (reclaimable) {
+            if (entry.second != nullptr) {
+                entry.second->staleList = &staleList_;
+                entry.second->staleEntry = &entry;
+                entry.second->staleShard = index;
+            }
+        }
+    }
+
+    /// Release the object of a removed element, called with the shard locked.
+    /// Objects in the stale list are detached and reclaimed later.
+    void dispose(std::unique_ptr<Item>& item) {
+        if constexpr (reclaimable) {
+            if (item != nullptr && staleList_.detachIfQueued(*item)) {
+                item.release();  // NOLINT, owned by the stale list
+                return;
+            }
+        }
+        if (item != nullptr) {
+            item.reset();
+            memory_.release();
+        }
+    }
+
+    std::unique_ptr<Item> allocate() {
+        if constexpr (reclaimable && std::is_move_assignable_v<Item>) {
+            const std::lock_guard lock(recycledMutex_);
+            if (!recycled_.empty()) {
+                auto item = std::move(recycled_.back());
+                recycled_.pop_back();
+                return item;
+            }
+        }
+        auto item = std::make_unique<Item>();
+        memory_.adopt();
+        return item;
+    }
+
+    void recycle(std::unique_ptr<Item> item) {
+        if constexpr (reclaimable && std::is_move_assignable_v<Item>) {
+            *item = Item{};  // reset, keep the allocation
+            const std::lock_guard lock(recycledMutex_);
+            if (recycled_.size() < maxRecycled) {
+                recycled_.push_back(std::move(item));
+                return;
+            }
+        }
+        item.reset();
+        memory_.release();
+    }
+
+    std::array<Shard, shardCount> shards_;
+    StaleList staleList_;
+    std::mutex recycledMutex_;
+    std::vector<std::unique_ptr<Item>> recycled_;
+    MemoryCounter memory_;
 };
 
 }  // namespace opcua::detail
@@ -0,0 +1,209 @@
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>  // declval
+
+#include "open62541pp/Span.h"
+#include "open62541pp/TypeWrapper.h"  // asWrapper
+#include "open62541pp/detail/AdmissionControl.h"  // admitOperation
+#include "open62541pp/detail/MetricsRecorder.h"  // CallbackTimer
+#include "open62541pp/detail/Result.h"  // tryInvokeGetStatus
+#include "open62541pp/open62541.h"
+#include "open62541pp/types/Builtin.h"  // NumericRangeDimension, StatusCode
+#include "open62541pp/types/DataValue.h"
+
+namespace opcua::detail {
+
+/// Borrowed view of the dimensions of a native numeric range, empty if `range` is `nullptr`.
+inline Span<const NumericRangeDimension> asRangeView(const UA_NumericRange* range) noexcept {
+    if (range == nullptr) {
+        return {};
+    }
+    return {range->dimensions, range->dimensionsSize};
+}
+
+template <typename Backend, typename = void>
+struct HasDataSourceRead : std::false_type {};
+
+template <typename Backend>
+struct HasDataSourceRead<
+    Backend,
+    std::void_t<decltype(std::declval<Backend&>().read(
+        std::declval<DataValue&>(), std::declval<Span<const NumericRangeDimension>>(), bool{}
+    ))>> : std::true_type {};
+
+template <typename Backend, typename = void>
+struct HasDataSourceWrite : std::false_type {};
+
+template <typename Backend>
+struct HasDataSourceWrite<
+    Backend,
+    std::void_t<decltype(std::declval<Backend&>().write(
+        std::declval<const DataValue&>(), std::declval<Span<const NumericRangeDimension>>()
+    ))>> : std::true_type {};
+
+template <typename Backend, typename = void>
+struct HasKeyedDataSourceRead : std::false_type {};
+
+template <typename Backend>
+struct HasKeyedDataSourceRead<
+    Backend,
+    std::void_t<decltype(std::declval<Backend&>().read(
+        uint64_t{},
+        std::declval<DataValue&>(),
+        std::declval<Span<const NumericRangeDimension>>(),
+        bool{}
+    ))>> : std::true_type {};
+
+template <typename Backend, typename = void>
+struct HasKeyedDataSourceWrite : std::false_type {};
+
+template <typename Backend>
+struct HasKeyedDataSourceWrite<
+    Backend,
+    std::void_t<decltype(std::declval<Backend&>().write(
+        uint64_t{},
+        std::declval<const DataValue&>(),
+        std::declval<Span<const NumericRangeDimension>>()
+    ))>> : std::true_type {};
+
+/// Compact node context of a backend object shared by many nodes.
+struct KeyedNodeContext {
+    void* backend;
+    uint64_t key;
+};
+
+template <typename F>
+inline UA_StatusCode invokeGetStatus(F&& func) noexcept {
+    if constexpr (std::is_nothrow_invocable_v<F>) {
+        return func();
+    } else {
+        return tryInvokeGetStatus(std::forward<F>(func));
+    }
+}
+
+/**
+ * Native data source callbacks, that invoke the `read`/`write` members of a backend object.
+ * The node context is the backend object itself.
+ */
+template <typename Backend>
+struct DataSourceBinding {
+    static UA_StatusCode read(
+        UA_Server* server,
+        [[maybe_unused]] const UA_NodeId* sessionId,
+        void* sessionContext,
+        [[maybe_unused]] const UA_NodeId* nodeId,
+        void* nodeContext,
+        UA_Boolean includeSourceTimestamp,
+        const UA_NumericRange* range,
+        UA_DataValue* value
+    ) noexcept {
+        auto& backend = *static_cast<Backend*>(nodeContext);
+        if (const auto status = admitOperation(server, sessionContext, true);
+            status != UA_STATUSCODE_GOOD) {
+            return status;
+        }
+        const CallbackTimer timer(getMetricsRecorder(server), MetricsCallback::DataSourceRead);
+        return invokeGetStatus([&] {
+            return backend.read(
+                asWrapper<DataValue>(*value), asRangeView(range), includeSourceTimestamp
+            );
+        });
+    }
+
+    static UA_StatusCode write(
+        UA_Server* server,
+        [[maybe_unused]] const UA_NodeId* sessionId,
+        void* sessionContext,
+        [[maybe_unused]] const UA_NodeId* nodeId,
+        void* nodeContext,
+        const UA_NumericRange* range,
+        const UA_DataValue* value
+    ) noexcept {
+        auto& backend = *static_cast<Backend*>(nodeContext);
+        if (const auto status = admitOperation(server, sessionContext, false);
+            status != UA_STATUSCODE_GOOD) {
+            return status;
+        }
+        const CallbackTimer timer(getMetricsRecorder(server), MetricsCallback::DataSourceWrite);
+        return invokeGetStatus([&] {
+            return backend.write(asWrapper<DataValue>(*value), asRangeView(range));
+        });
+    }
+
+    static UA_DataSource create() noexcept {
+        UA_DataSource dataSource{};
+        dataSource.read = read;
+        if constexpr (HasDataSourceWrite<Backend>::value) {
+            dataSource.write = write;
+        }
+        return dataSource;
+    }
+};
+
+/**
+ * Native data source callbacks, that invoke the `read`/`write` members of a backend object with
+ * the key of the node. The node context is a KeyedNodeContext.
+ */
+template <typename Backend>
+struct KeyedDataSourceBinding {
+    static UA_StatusCode read(
+        UA_Server* server,
+        [[maybe_unused]] const UA_NodeId* sessionId,
+        void* sessionContext,
+        [[maybe_unused]] const UA_NodeId* nodeId,
+        void* nodeContext,
+        UA_Boolean includeSourceTimestamp,
+        const UA_NumericRange* range,
+        UA_DataValue* value
+    ) noexcept {
+        const auto& context = *static_cast<const KeyedNodeContext*>(nodeContext);
+        auto& backend = *static_cast<Backend*>(context.backend);
+        if (const auto status = admitOperation(server, sessionContext, true);
+            status != UA_STATUSCODE_GOOD) {
+            return status;
+        }
+        const CallbackTimer timer(getMetricsRecorder(server), MetricsCallback::DataSourceRead);
+        return invokeGetStatus([&] {
+            return backend.read(
+                context.key,
+                asWrapper<DataValue>(*value),
+                asRangeView(range),
+                includeSourceTimestamp
+            );
+        });
+    }
+
+    static UA_StatusCode write(
+        UA_Server* server,
+        [[maybe_unused]] const UA_NodeId* sessionId,
+        void* sessionContext,
+        [[maybe_unused]] const UA_NodeId* nodeId,
+        void* nodeContext,
+        const UA_NumericRange* range,
+        const UA_DataValue* value
+    ) noexcept {
+        const auto& context = *static_cast<const KeyedNodeContext*>(nodeContext);
+        auto& backend = *static_cast<Backend*>(context.backend);
+        if (const auto status = admitOperation(server, sessionContext, false);
+            status != UA_STATUSCODE_GOOD) {
+            return status;
+        }
+        const CallbackTimer timer(getMetricsRecorder(server), MetricsCallback::DataSourceWrite);
+        return invokeGetStatus([&] {
+            return backend.write(context.key, asWrapper<DataValue>(*value), asRangeView(range));
+        });
+    }
+
+    static UA_DataSource create() noexcept {
+        UA_DataSource dataSource{};
+        dataSource.read = read;
+        if constexpr (HasKeyedDataSourceWrite<Backend>::value) {
+            dataSource.write = write;
+        }
+        return dataSource;
+    }
+};
+
+}  // namespace opcua::detail
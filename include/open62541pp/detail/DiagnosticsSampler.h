@@ -0,0 +1,118 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <unordered_set>
+
+#include "open62541pp/ClientDiagnostics.h"
+#include "open62541pp/detail/ClientMetricsRecorder.h"  // clientServiceCount
+#include "open62541pp/detail/ExceptionCatcher.h"
+#include "open62541pp/open62541.h"
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua::detail {
+
+/// Invoke `func(const UA_NodeId&)` for the node ids referenced by a request.
+/// Requests of other services are ignored.
+template <typename Request, typename Func>
+void forEachRequestNodeId([[maybe_unused]] const Request& request, [[maybe_unused]] Func&& func) {
+    [[maybe_unused]] const auto visit = [&](const auto* items, size_t size, auto&& getNodeId) {
+        for (size_t i = 0; i < size; ++i) {
+            func(getNodeId(items[i]));
+        }
+    };
+    if constexpr (std::is_same_v<Request, UA_ReadRequest>) {
+        visit(request.nodesToRead, request.nodesToReadSize, [](const auto& item) -> auto& {
+            return item.nodeId;
+        });
+    } else if constexpr (std::is_same_v<Request, UA_WriteRequest>) {
+        visit(request.nodesToWrite, request.nodesToWriteSize, [](const auto& item) -> auto& {
+            return item.nodeId;
+        });
+    } else if constexpr (std::is_same_v<Request, UA_BrowseRequest>) {
+        visit(request.nodesToBrowse, request.nodesToBrowseSize, [](const auto& item) -> auto& {
+            return item.nodeId;
+        });
+    } else if constexpr (std::is_same_v<Request, UA_CallRequest>) {
+        visit(request.methodsToCall, request.methodsToCallSize, [](const auto& item) -> auto& {
+            return item.objectId;
+        });
+        visit(request.methodsToCall, request.methodsToCallSize, [](const auto& item) -> auto& {
+            return item.methodId;
+        });
+    } else if constexpr (std::is_same_v<Request, UA_CreateMonitoredItemsRequest>) {
+        visit(request.itemsToCreate, request.itemsToCreateSize, [](const auto& item) -> auto& {
+            return item.itemToMonitor.nodeId;
+        });
+    }
+}
+
+/**
+ * Sampling of client requests with diagnostics, part of the ClientContext.
+ * Disabled sampling costs a single atomic load per request. The sampling decision of enabled
+ * sampling is taken under a lock.
+ */
+class DiagnosticsSampler {
+public:
+    bool isEnabled() const noexcept {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    /// Set the sampling criteria and the callback, an empty callback disables the sampling.
+    void configure(DiagnosticsSampling sampling, DiagnosticsCallback callback);
+
+    /// Decide if a request is sampled.
+    /// @return Diagnostics mask of the request header if sampled
+    template <typename Request>
+    std::optional<uint32_t> sample(size_t service, const Request& request) {
+        const std::lock_guard lock(mutex_);
+        if (state_ == nullptr) {
+            return std::nullopt;
+        }
+        const auto& sampling = state_->sampling;
+        bool sampled = matchesInterval() || matchesService(service);
+        if (!sampled && !state_->nodes.empty()) {
+            forEachRequestNodeId(request, [&](const UA_NodeId& id) {
+                sampled = sampled || state_->nodes.count(asWrapper<NodeId>(id)) > 0;
+            });
+        }
+        if (!sampled) {
+            return std::nullopt;
+        }
+        return sampling.returnDiagnostics;
+    }
+
+    /// Deliver diagnostics to the callback, exceptions are forwarded to the catcher.
+    void deliver(const RequestDiagnostics& diagnostics, ExceptionCatcher& catcher);
+
+private:
+    struct State {
+        DiagnosticsSampling sampling;
+        std::shared_ptr<DiagnosticsCallback> callback;
+        std::unordered_set<NodeId> nodes;
+        std::array<int8_t, clientServiceCount> services{};  // cached matches: 0 unknown, 1, -1
+        uint64_t counter{0};
+    };
+
+    bool matchesInterval() noexcept;
+    bool matchesService(size_t service);
+
+    std::atomic<bool> enabled_{false};
+    std::mutex mutex_;
+    std::unique_ptr<State> state_;  // guarded by mutex_
+};
+
+/// Check if a native DiagnosticInfo has any field set.
+inline bool hasDiagnostics(const UA_DiagnosticInfo& info) noexcept {
+    return info.hasSymbolicId || info.hasNamespaceUri || info.hasLocalizedText ||
+           info.hasLocale || info.hasAdditionalInfo || info.hasInnerStatusCode ||
+           info.hasInnerDiagnosticInfo;
+}
+
+}  // namespace opcua::detail
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <atomic>
 #include <exception>
 #include <functional>
+#include <mutex>
+#include <type_traits>
 #include <utility>  // exchange
 
 namespace opcua {
@@ -19,30 +22,57 @@ namespace opcua::detail {
 /**
  * Catch & store exceptions from user-defined callbacks in an exception-unaware context (open62541).
  * The stored exception can be rethrown in a different context.
+ * Exceptions can be set from any thread, e.g. from callbacks executed off the main loop.
+ *
+ * Callbacks that are declared `noexcept` (detected with `std::is_nothrow_invocable`) are invoked
+ * directly, without the try/catch and `std::exception_ptr` machinery. The check for a stored
+ * exception is a relaxed atomic flag test, the exception itself is guarded by the mutex.
+ * The low-memory profile (UAPP_LOW_MEMORY) invokes all callbacks directly, exceptions escaping a
+ * callback terminate the program.
  */
 class ExceptionCatcher {
 public:
     void setException(std::exception_ptr exception) noexcept {
+        std::lock_guard lock(mutex_);
         exception_ = std::move(exception);
+        hasException_.store(exception_ != nullptr, std::memory_order_relaxed);
     }
 
     bool hasException() const noexcept {
-        return exception_ != nullptr;
+        return hasException_.load(std::memory_order_relaxed);
     }
 
     void rethrow() {
-        if (hasException()) {
-            std::rethrow_exception(std::exchange(exception_, nullptr));
+        if (!hasException()) {
+            return;  // fast path without lock
+        }
+        std::exception_ptr exception;
+        {
+            std::lock_guard lock(mutex_);
+            exception = std::exchange(exception_, nullptr);
+            hasException_.store(false, std::memory_order_relaxed);
+        }
+        if (exception != nullptr) {
+            std::rethrow_exception(exception);
         }
     }
 
     template <typename Callback, typename... Args>
     void invoke(Callback&& callback, Args&&... args) noexcept {
         static_assert(std::is_void_v<std::invoke_result_t<Callback, Args&&...>>);
-        try {
+#ifdef UAPP_LOW_MEMORY
+        constexpr bool nothrow = true;  // exceptions terminate, see CMake option UAPP_LOW_MEMORY
+#else
+        constexpr bool nothrow = std::is_nothrow_invocable_v<Callback, Args&&...>;
+#endif
+        if constexpr (nothrow) {
             std::invoke(std::forward<Callback>(callback), std::forward<Args>(args)...);
-        } catch (...) {
-            setException(std::current_exception());
+        } else {
+            try {
+                std::invoke(std::forward<Callback>(callback), std::forward<Args>(args)...);
+            } catch (...) {
+                setException(std::current_exception());
+            }
         }
     }
 
@@ -61,13 +91,15 @@ public:
 
     template <typename Callback>
     auto wrapCallback(Callback&& callback) noexcept {
-        return [this, cb = std::forward<Callback>(callback)](auto&&... args) {
+        return [this, cb = std::forward<Callback>(callback)](auto&&... args) noexcept {
             this->invoke(std::move(cb), std::forward<decltype(args)>(args)...);
         };
     }
 
 private:
     std::exception_ptr exception_;
+    std::atomic<bool> hasException_{false};
+    std::mutex mutex_;
 };
 
 }  // namespace opcua::detail
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+namespace opcua::detail {
+
+/**
+ * Pool of dense handles in the range [0, size()).
+ * Released handles are reused first (LIFO), so the handles stay dense and can be used as indices
+ * of flat arrays.
+ */
+class HandlePool {
+public:
+    static constexpr uint32_t invalid = std::numeric_limits<uint32_t>::max();
+
+    uint32_t acquire() {
+        const std::lock_guard lock(mutex_);
+        if (!released_.empty()) {
+            const uint32_t handle = released_.back();
+            released_.pop_back();
+            return handle;
+        }
+        return next_++;
+    }
+
+    void release(uint32_t handle) {
+        if (handle == invalid) {
+            return;
+        }
+        const std::lock_guard lock(mutex_);
+        released_.push_back(handle);
+    }
+
+    /// Upper bound of all acquired handles.
+    uint32_t size() const {
+        const std::lock_guard lock(mutex_);
+        return next_;
+    }
+
+private:
+    mutable std::mutex mutex_;
+    uint32_t next_{0};
+    std::vector<uint32_t> released_;
+};
+
+}  // namespace opcua::detail
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "open62541pp/MemoryStatistics.h"
+
+// forward declare
+struct UA_DataType;
+
+namespace opcua::detail {
+
+/* ------------------------------------- Native allocations ------------------------------------- */
+
+/// Check if the accounting of native allocations is enabled by any server or client.
+bool isMemoryAccountingActive() noexcept;
+
+/// Record a native allocation of the category NativeAllocation or NativeCopy.
+void recordNativeAllocation(MemoryCategory category, size_t bytes) noexcept;
+
+/// Record a deep copy of `size` objects (`size = 0` for a scalar copied by value).
+/// The bytes of the copied members are estimated with the binary encoding size.
+void recordNativeCopy(const void* data, size_t size, const UA_DataType& type) noexcept;
+
+/// Get the process-wide statistics of a native category.
+MemoryCategoryStatistics getNativeMemoryStatistics(MemoryCategory category) noexcept;
+
+/// Switch of a server/client to enable the native accounting, part of the contexts.
+/// Native allocations are recorded while at least one switch is enabled.
+class MemoryAccountingSwitch {
+public:
+    MemoryAccountingSwitch() = default;
+
+    ~MemoryAccountingSwitch() {
+        setEnabled(false);
+    }
+
+    MemoryAccountingSwitch(const MemoryAccountingSwitch&) = delete;
+    MemoryAccountingSwitch(MemoryAccountingSwitch&&) noexcept = delete;
+    MemoryAccountingSwitch& operator=(const MemoryAccountingSwitch&) = delete;
+    MemoryAccountingSwitch& operator=(MemoryAccountingSwitch&&) noexcept = delete;
+
+    bool isEnabled() const noexcept {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    void setEnabled(bool enabled) noexcept;
+
+private:
+    std::atomic<bool> enabled_{false};
+};
+
+/* ------------------------------------------ Contexts ------------------------------------------ */
+
+/// Lock-free counter of the objects owned by a container, e.g. the ContextMap.
+class MemoryCounter {
+public:
+    /// Record the allocation of an object that is now owned.
+    void adopt() noexcept {
+        allocations_.fetch_add(1, std::memory_order_relaxed);
+        const auto objects = objects_.fetch_add(1, std::memory_order_relaxed) + 1;
+        auto peak = peak_.load(std::memory_order_relaxed);
+        while (objects > peak &&
+               !peak_.compare_exchange_weak(peak, objects, std::memory_order_relaxed)) {
+        }
+    }
+
+    /// Record the destruction of an owned object.
+    void release() noexcept {
+        objects_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    MemoryCategoryStatistics snapshot(MemoryCategory category, size_t objectSize) const noexcept {
+        MemoryCategoryStatistics result;
+        result.category = category;
+        result.allocations = allocations_.load(std::memory_order_relaxed);
+        result.allocatedBytes = result.allocations * objectSize;
+        result.objects = objects_.load(std::memory_order_relaxed);
+        result.currentBytes = result.objects * objectSize;
+        result.peakBytes = peak_.load(std::memory_order_relaxed) * objectSize;
+        return result;
+    }
+
+private:
+    std::atomic<uint64_t> allocations_{0};
+    std::atomic<uint64_t> objects_{0};
+    std::atomic<uint64_t> peak_{0};
+};
+
+}  // namespace opcua::detail
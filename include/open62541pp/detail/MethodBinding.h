@@ -0,0 +1,146 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <functional>  // invoke
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>  // forward, index_sequence
+
+#include "open62541pp/Config.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/TypeConverter.h"
+#include "open62541pp/open62541.h"
+#include "open62541pp/typeregistry/Builtin.h"
+#include "open62541pp/types/Composed.h"  // Argument
+#include "open62541pp/types/Variant.h"
+
+#ifdef UA_ENABLE_METHODCALLS
+
+namespace opcua::detail {
+
+/// Data type of a scalar method argument, the native type of convertible types.
+template <typename T>
+const UA_DataType& getMethodArgumentType() noexcept {
+    static_assert(
+        isRegisteredType<T> || isConvertibleType<T>,
+        "Method arguments must be registered or convertible types"
+    );
+    if constexpr (isRegisteredType<T>) {
+        return opcua::getDataType<T>();
+    } else {
+        return opcua::getDataType<typename TypeConverter<T>::NativeType>();
+    }
+}
+
+/// Get scalar method argument from a type-checked variant.
+/// Registered types are referenced, convertible types are converted from the native type.
+template <typename T>
+decltype(auto) getMethodArgument(const UA_Variant& var) {
+    if constexpr (isRegisteredType<T>) {
+        return *static_cast<const T*>(var.data);
+    } else {
+        using NativeType = typename TypeConverter<T>::NativeType;
+        T value{};
+        TypeConverter<T>::fromNative(*static_cast<const NativeType*>(var.data), value);
+        return value;
+    }
+}
+
+/**
+ * Binding of a typed callback with the signature `R(Args...)` to a method node.
+ * Arguments are scalars of registered or convertible types, e.g. `int32_t`, `NodeId` or
+ * `std::string_view`. The return value (if not `void`) is the single output argument.
+ */
+template <typename Signature>
+struct MethodBinding;
+
+template <typename R, typename... Args>
+struct MethodBinding<R(Args...)> {
+    static constexpr size_t inputSize = sizeof...(Args);
+    static constexpr size_t outputSize = std::is_void_v<R> ? 0 : 1;
+
+    static std::array<Argument, inputSize> createInputArguments(
+        Span<const std::string_view> names
+    ) {
+        return createInputArguments(names, std::index_sequence_for<Args...>{});
+    }
+
+    static std::array<Argument, outputSize> createOutputArguments(std::string_view name) {
+        if constexpr (std::is_void_v<R>) {
+            return {};
+        } else {
+            return {createArgument<std::decay_t<R>>(name)};
+        }
+    }
+
+    /// Create a method callback that validates and unpacks the input arguments.
+    template <typename F>
+    static auto bind(F&& func) {
+        static_assert(std::is_invocable_r_v<R, F&, Args...>, "Callback does not match signature");
+        // data types are resolved once, the calls compare the type pointers only
+        const std::array<const UA_DataType*, inputSize> types{
+            &getMethodArgumentType<std::decay_t<Args>>()...
+        };
+        return [func = std::forward<F>(func),
+                types](Span<const Variant> input, Span<Variant> output) mutable {
+            if (input.size() < inputSize) {
+                throw BadStatus(UA_STATUSCODE_BADARGUMENTSMISSING);
+            }
+            if (input.size() > inputSize) {
+                throw BadStatus(UA_STATUSCODE_BADTOOMANYARGUMENTS);
+            }
+            if (output.size() < outputSize) {
+                throw BadStatus(UA_STATUSCODE_BADINTERNALERROR);
+            }
+            for (size_t i = 0; i < inputSize; ++i) {
+                const UA_Variant& var = *input[i].handle();
+                if (var.type != types[i] || !UA_Variant_isScalar(&var)) {
+                    throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+                }
+            }
+            invoke(func, input, output, std::index_sequence_for<Args...>{});
+        };
+    }
+
+private:
+    template <typename T>
+    static Argument createArgument(std::string_view name) {
+        const UA_DataType& type = getMethodArgumentType<T>();
+        return {name, {}, NodeId(type.typeId), ValueRank::Scalar};
+    }
+
+    template <size_t... Is>
+    static std::array<Argument, inputSize> createInputArguments(
+        Span<const std::string_view> names, std::index_sequence<Is...> /* unused */
+    ) {
+        // unnamed arguments are numbered: arg1, arg2, ...
+        const auto getName = [&](size_t index) {
+            return index < names.size() ? std::string(names[index])
+                                        : "arg" + std::to_string(index + 1);
+        };
+        return {createArgument<std::decay_t<Args>>(getName(Is))...};
+    }
+
+    template <typename F, size_t... Is>
+    static void invoke(
+        F& func,
+        [[maybe_unused]] Span<const Variant> input,
+        [[maybe_unused]] Span<Variant> output,
+        std::index_sequence<Is...> /* unused */
+    ) {
+        if constexpr (std::is_void_v<R>) {
+            std::invoke(func, getMethodArgument<std::decay_t<Args>>(*input[Is].handle())...);
+        } else {
+            output[0].setScalarCopy(
+                std::invoke(func, getMethodArgument<std::decay_t<Args>>(*input[Is].handle())...)
+            );
+        }
+    }
+};
+
+}  // namespace opcua::detail
+
+#endif
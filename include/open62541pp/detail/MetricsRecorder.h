@@ -0,0 +1,204 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>  // uncaught_exceptions
+#include <memory>
+#include <mutex>
+
+#include "open62541pp/ServerMetrics.h"
+#include "open62541pp/detail/ExceptionCatcher.h"
+
+// forward declare
+struct UA_Server;
+
+namespace opcua {
+class Server;
+}  // namespace opcua
+
+namespace opcua::detail {
+
+/// Lock-free latency histogram with the buckets of LatencyHistogram.
+class AtomicLatencyHistogram {
+public:
+    void record(std::chrono::nanoseconds duration) noexcept;
+    LatencyHistogram snapshot() const noexcept;
+    void reset() noexcept;
+
+private:
+    std::array<std::atomic<uint64_t>, LatencyHistogram::bounds.size() + 1> buckets_{};
+    std::atomic<uint64_t> count_{0};
+    std::atomic<uint64_t> sumNanoseconds_{0};
+};
+
+/**
+ * Storage of the server metrics and the trace callback, part of the ServerContext.
+ * Recording of metrics is lock-free; instrumented code gets the recorder with getMetricsRecorder,
+ * which returns `nullptr` if neither metrics nor tracing are enabled.
+ */
+class MetricsRecorder {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    MetricsRecorder() = default;
+    ~MetricsRecorder();
+
+    MetricsRecorder(const MetricsRecorder&) = delete;
+    MetricsRecorder(MetricsRecorder&&) noexcept = delete;
+    MetricsRecorder& operator=(const MetricsRecorder&) = delete;
+    MetricsRecorder& operator=(MetricsRecorder&&) noexcept = delete;
+
+    /// Metrics or tracing enabled.
+    bool isActive() const noexcept {
+        return isEnabled() || isTracing();
+    }
+
+    bool isEnabled() const noexcept {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    void setEnabled(bool enabled) noexcept;
+
+    bool isTracing() const noexcept {
+        return tracing_.load(std::memory_order_relaxed);
+    }
+
+    /// Set the trace callback, exceptions of the callback are forwarded to the catcher.
+    void setTraceCallback(ServerTraceCallback callback, ExceptionCatcher& catcher);
+
+    void recordService(
+        MetricsService service, Clock::time_point start, Clock::time_point end, bool error
+    ) noexcept;
+
+    void recordCallback(
+        MetricsCallback callback, Clock::time_point start, Clock::time_point end
+    ) noexcept;
+
+    /// Invoke the trace callback, if set.
+    void trace(const ServerTraceEvent& event) noexcept;
+
+    /// Fill the metrics of the local requests and callbacks.
+    void snapshot(ServerMetrics& metrics) const noexcept;
+
+    void reset() noexcept;
+
+private:
+    struct Service {
+        std::atomic<uint64_t> requests{0};
+        std::atomic<uint64_t> errors{0};
+        AtomicLatencyHistogram latency;
+    };
+
+    void updateActive(bool wasActive) noexcept;
+
+    std::atomic<bool> enabled_{false};
+    std::atomic<bool> tracing_{false};
+    std::array<Service, 5> services_{};
+    std::array<AtomicLatencyHistogram, 3> callbacks_{};
+    mutable std::mutex mutex_;  // of the trace callback
+    std::shared_ptr<const ServerTraceCallback> traceCallback_;
+    ExceptionCatcher* catcher_{nullptr};
+};
+
+/// Get the metrics recorder of the server, `nullptr` if metrics and tracing are disabled.
+MetricsRecorder* getMetricsRecorder(Server& server) noexcept;
+
+/// Get the metrics recorder of the native server, `nullptr` if metrics and tracing are disabled.
+/// Costs a single atomic load if metrics and tracing are disabled on all servers.
+MetricsRecorder* getMetricsRecorder(UA_Server* server) noexcept;
+
+/// Record the duration of a local service request, if metrics or tracing are enabled.
+/// Requests are recorded as failed if the scope is left with an exception or with setError.
+class [[nodiscard]] ServiceTimer {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    ServiceTimer(MetricsRecorder* recorder, MetricsService service) noexcept
+        : recorder_(recorder),
+          service_(service),
+          exceptions_(recorder != nullptr ? std::uncaught_exceptions() : 0),
+          start_(recorder != nullptr ? Clock::now() : Clock::time_point{}) {}
+
+    ~ServiceTimer() {
+        if (recorder_ != nullptr) {
+            recorder_->recordService(
+                service_, start_, Clock::now(), error_ || std::uncaught_exceptions() > exceptions_
+            );
+        }
+    }
+
+    ServiceTimer(const ServiceTimer&) = delete;
+    ServiceTimer(ServiceTimer&&) noexcept = delete;
+    ServiceTimer& operator=(const ServiceTimer&) = delete;
+    ServiceTimer& operator=(ServiceTimer&&) noexcept = delete;
+
+    void setError(bool error) noexcept {
+        error_ = error;
+    }
+
+private:
+    MetricsRecorder* recorder_;
+    MetricsService service_;
+    int exceptions_;
+    bool error_{false};
+    Clock::time_point start_;
+};
+
+/// Record the duration of a user callback, if metrics or tracing are enabled.
+class [[nodiscard]] CallbackTimer {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    CallbackTimer(MetricsRecorder* recorder, MetricsCallback callback) noexcept
+        : recorder_(recorder),
+          callback_(callback),
+          start_(recorder != nullptr ? Clock::now() : Clock::time_point{}) {}
+
+    ~CallbackTimer() {
+        if (recorder_ != nullptr) {
+            recorder_->recordCallback(callback_, start_, Clock::now());
+        }
+    }
+
+    CallbackTimer(const CallbackTimer&) = delete;
+    CallbackTimer(CallbackTimer&&) noexcept = delete;
+    CallbackTimer& operator=(const CallbackTimer&) = delete;
+    CallbackTimer& operator=(CallbackTimer&&) noexcept = delete;
+
+private:
+    MetricsRecorder* recorder_;
+    MetricsCallback callback_;
+    Clock::time_point start_;
+};
+
+/// Trace a span of the server loop, if tracing is enabled.
+class [[nodiscard]] TraceScope {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    TraceScope(MetricsRecorder& recorder, ServerTracepoint tracepoint) noexcept
+        : recorder_(recorder.isTracing() ? &recorder : nullptr),
+          tracepoint_(tracepoint),
+          start_(recorder_ != nullptr ? Clock::now() : Clock::time_point{}) {}
+
+    ~TraceScope() {
+        if (recorder_ != nullptr) {
+            recorder_->trace({tracepoint_, {}, start_, Clock::now() - start_});
+        }
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope(TraceScope&&) noexcept = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+    TraceScope& operator=(TraceScope&&) noexcept = delete;
+
+private:
+    MetricsRecorder* recorder_;
+    ServerTracepoint tracepoint_;
+    Clock::time_point start_;
+};
+
+}  // namespace opcua::detail
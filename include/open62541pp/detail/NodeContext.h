@@ -1,17 +1,128 @@
 #pragma once
 
+#include <chrono>
+#include <optional>
+#include <utility>  // move
+#include <variant>
+
 #include "open62541pp/Config.h"
 #include "open62541pp/ValueBackend.h"
 #include "open62541pp/services/NodeManagement.h"  // MethodCallback
 
 namespace opcua::detail {
 
-struct NodeContext {
-    ValueCallback valueCallback;
-    ValueBackendDataSource dataSource;
+#ifdef UAPP_LOW_MEMORY
+
+/**
+ * Compact node context of the low-memory profile.
+ * A node uses either a value callback, a data source or a method callback (open62541 stores the
+ * value callback and the data source of variable nodes in a union as well), so the callbacks share
+ * a single storage. The accessors return `nullptr` if another kind of callback is stored, only the
+ * setters replace the current kind.
+ */
+class NodeContext {
+public:
+    ValueCallback* valueCallback() noexcept {
+        auto* state = std::get_if<ValueCallbackState>(&callbacks_);
+        return state != nullptr ? &state->callback : nullptr;
+    }
+
+    std::optional<std::chrono::steady_clock::time_point>* lastRefresh() noexcept {
+        auto* state = std::get_if<ValueCallbackState>(&callbacks_);
+        return state != nullptr ? &state->lastRefresh : nullptr;
+    }
+
+    ValueBackendDataSource* dataSource() noexcept {
+        return std::get_if<ValueBackendDataSource>(&callbacks_);
+    }
+
 #ifdef UA_ENABLE_METHODCALLS
-    services::MethodCallback methodCallback;
+    services::MethodCallback* methodCallback() noexcept {
+        return std::get_if<services::MethodCallback>(&callbacks_);
+    }
 #endif
+
+    /// Set the value callback and reset the time of the last refresh.
+    void setValueCallback(ValueCallback callback) {
+        callbacks_.emplace<ValueCallbackState>(ValueCallbackState{std::move(callback), {}});
+    }
+
+    void setDataSource(ValueBackendDataSource dataSource) {
+        callbacks_.emplace<ValueBackendDataSource>(std::move(dataSource));
+    }
+
+#ifdef UA_ENABLE_METHODCALLS
+    void setMethodCallback(services::MethodCallback callback) {
+        callbacks_.emplace<services::MethodCallback>(std::move(callback));
+    }
+#endif
+
+private:
+    struct ValueCallbackState {
+        ValueCallback callback;
+        std::optional<std::chrono::steady_clock::time_point> lastRefresh;  // of onBeforeRead
+    };
+
+#ifdef UA_ENABLE_METHODCALLS
+    using Callbacks = std::variant<
+        std::monostate,
+        ValueCallbackState,
+        ValueBackendDataSource,
+        services::MethodCallback>;
+#else
+    using Callbacks = std::variant<std::monostate, ValueCallbackState, ValueBackendDataSource>;
+#endif
+
+    Callbacks callbacks_;
 };
 
+#else
+
+class NodeContext {
+public:
+    ValueCallback* valueCallback() noexcept {
+        return &valueCallback_;
+    }
+
+    std::optional<std::chrono::steady_clock::time_point>* lastRefresh() noexcept {
+        return &lastRefresh_;
+    }
+
+    ValueBackendDataSource* dataSource() noexcept {
+        return &dataSource_;
+    }
+
+#ifdef UA_ENABLE_METHODCALLS
+    services::MethodCallback* methodCallback() noexcept {
+        return &methodCallback_;
+    }
+#endif
+
+    /// Set the value callback and reset the time of the last refresh.
+    void setValueCallback(ValueCallback callback) {
+        valueCallback_ = std::move(callback);
+        lastRefresh_.reset();
+    }
+
+    void setDataSource(ValueBackendDataSource dataSource) {
+        dataSource_ = std::move(dataSource);
+    }
+
+#ifdef UA_ENABLE_METHODCALLS
+    void setMethodCallback(services::MethodCallback callback) {
+        methodCallback_ = std::move(callback);
+    }
+#endif
+
+private:
+    ValueCallback valueCallback_;
+    std::optional<std::chrono::steady_clock::time_point> lastRefresh_;  // of onBeforeRead
+    ValueBackendDataSource dataSource_;
+#ifdef UA_ENABLE_METHODCALLS
+    services::MethodCallback methodCallback_;
+#endif
+};
+
+#endif
+
 }  // namespace opcua::detail
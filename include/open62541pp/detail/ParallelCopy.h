@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+#include "open62541pp/open62541.h"
+
+namespace opcua::detail {
+
+/* ---------------------------------- Parallel copy and clear ----------------------------------- */
+
+/// Check if the parallel copy and clear of large arrays is enabled (see opcua::setParallelCopy).
+bool isParallelCopyActive() noexcept;
+
+/// Minimum number of array elements that are copied or cleared in parallel.
+size_t getParallelCopyThreshold() noexcept;
+
+/// Invoke `func(begin, end)` for consecutive chunks of `[0, size)` on the worker pool.
+/// @return First bad status code returned by `func`
+UA_StatusCode forEachChunkParallel(
+    size_t size, const std::function<UA_StatusCode(size_t, size_t)>& func
+) noexcept;
+
+/// UA_copy with large arrays of the object copied in parallel (members, variant and data value).
+UA_StatusCode copyParallel(const void* src, void* dst, const UA_DataType& type) noexcept;
+
+/// UA_clear with large arrays of the object cleared in parallel (members, variant and data value).
+void clearParallel(void* native, const UA_DataType& type) noexcept;
+
+/// UA_Array_copy with the elements of large arrays copied in parallel.
+UA_StatusCode copyArrayParallel(
+    const void* src, size_t size, void** dst, const UA_DataType& type
+) noexcept;
+
+/// UA_Array_delete with the elements of large arrays cleared in parallel.
+void deleteArrayParallel(void* array, size_t size, const UA_DataType& type) noexcept;
+
+}  // namespace opcua::detail
@@ -0,0 +1,220 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <utility>  // move
+
+#include "open62541pp/Client.h"  // RequestPriority
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/detail/helper.h"  // copy, clear
+#include "open62541pp/open62541.h"
+#include "open62541pp/typeregistry/Builtin.h"
+
+namespace opcua::detail {
+
+inline constexpr size_t requestPriorityCount = 3;
+
+/**
+ * Flow control of async client requests.
+ *
+ * With a window of `maxInFlight > 0` requests, further requests are queued by priority and sent
+ * as soon as responses of in-flight requests arrive. Requests of the same priority are sent in
+ * order. Submitting a request to a full queue (`maxQueued > 0`) throws a BadStatus with
+ * `UA_STATUSCODE_BADTOOMANYOPERATIONS` to signal back-pressure to the caller.
+ * The scheduler is disabled by default (`maxInFlight == 0`), requests are sent immediately.
+ */
+class RequestScheduler {
+public:
+    RequestScheduler() = default;
+
+    ~RequestScheduler() {
+        cancelQueued();
+    }
+
+    RequestScheduler(const RequestScheduler&) = delete;
+    RequestScheduler(RequestScheduler&&) noexcept = delete;
+    RequestScheduler& operator=(const RequestScheduler&) = delete;
+    RequestScheduler& operator=(RequestScheduler&&) noexcept = delete;
+
+    /// Queued requests are sent if the window is enlarged or disabled.
+    void setWindow(UA_Client* client, size_t maxInFlight, size_t maxQueued) {
+        maxInFlight_ = maxInFlight;
+        maxQueued_ = maxQueued;
+        sendQueued(client);
+    }
+
+    void setPriority(RequestPriority priority) noexcept {
+        priority_ = priority;
+    }
+
+    RequestPriority getPriority() const noexcept {
+        return priority_;
+    }
+
+    size_t inFlight() const noexcept {
+        return inFlight_;
+    }
+
+    size_t queued() const noexcept {
+        size_t count = 0;
+        for (const auto& queue : queues_) {
+            count += queue.size();
+        }
+        return count;
+    }
+
+    /// Send request or queue it, if the in-flight window is exhausted.
+    /// The callback is invoked with a `nullptr` response if a queued request can not be sent.
+    /// @param timeout Timeout of the request in milliseconds, the client's timeout if zero
+    /// @param requestId Output of the request id, remains zero if the request is queued
+    template <typename Request, typename Response>
+    void submit(
+        UA_Client* client,
+        const Request& request,
+        UA_ClientAsyncServiceCallback callback,
+        void* userdata,
+        uint32_t timeout = 0,
+        uint32_t* requestId = nullptr
+    ) {
+        if (maxInFlight_ == 0) {
+            throwIfBad(sendAsync<Request, Response>(
+                client, request, callback, userdata, timeout, requestId
+            ));
+            return;
+        }
+        if (inFlight_ < maxInFlight_ && queued() == 0) {
+            throwIfBad(sendTracked<Request, Response>(
+                client, request, callback, userdata, timeout, requestId
+            ));
+            return;
+        }
+        if (maxQueued_ > 0 && queued() >= maxQueued_) {
+            throw BadStatus(UA_STATUSCODE_BADTOOMANYOPERATIONS);
+        }
+        // deep copy, the request might be destroyed before it is sent
+        std::shared_ptr<Request> copy(
+            new Request(opcua::detail::copy(request, getDataType<Request>())),
+            [](Request* ptr) {
+                opcua::detail::clear(*ptr, getDataType<Request>());
+                delete ptr;  // NOLINT
+            }
+        );
+        queues_.at(static_cast<size_t>(priority_))
+            .push_back({
+                [this, copy, timeout](UA_Client* c, UA_ClientAsyncServiceCallback cb, void* data) {
+                    return sendTracked<Request, Response>(c, *copy, cb, data, timeout, nullptr);
+                },
+                callback,
+                userdata,
+            });
+    }
+
+private:
+    struct Queued {
+        std::function<UA_StatusCode(UA_Client*, UA_ClientAsyncServiceCallback, void*)> send;
+        UA_ClientAsyncServiceCallback callback;
+        void* userdata;
+    };
+
+    struct Tracked {
+        RequestScheduler* scheduler;
+        UA_ClientAsyncServiceCallback callback;
+        void* userdata;
+    };
+
+    template <typename Request, typename Response>
+    static UA_StatusCode sendAsync(
+        UA_Client* client,
+        const Request& request,
+        UA_ClientAsyncServiceCallback callback,
+        void* userdata,
+        uint32_t timeout,
+        uint32_t* requestId
+    ) {
+        if (timeout > 0) {
+            return __UA_Client_AsyncServiceEx(
+                client,
+                &request,
+                &getDataType<Request>(),
+                callback,
+                &getDataType<Response>(),
+                userdata,
+                requestId,
+                timeout
+            );
+        }
+        return __UA_Client_AsyncService(
+            client,
+            &request,
+            &getDataType<Request>(),
+            callback,
+            &getDataType<Response>(),
+            userdata,
+            requestId
+        );
+    }
+
+    template <typename Request, typename Response>
+    UA_StatusCode sendTracked(
+        UA_Client* client,
+        const Request& request,
+        UA_ClientAsyncServiceCallback callback,
+        void* userdata,
+        uint32_t timeout,
+        uint32_t* requestId
+    ) {
+        auto tracked = std::make_unique<Tracked>(Tracked{this, callback, userdata});
+        const auto status = sendAsync<Request, Response>(
+            client, request, trackedCallback, tracked.get(), timeout, requestId
+        );
+        if (status == UA_STATUSCODE_GOOD) {
+            tracked.release();  // NOLINT, ownership transferred to callback
+            ++inFlight_;
+        }
+        return status;
+    }
+
+    static void trackedCallback(
+        UA_Client* client, void* userdata, uint32_t requestId, void* response
+    ) {
+        std::unique_ptr<Tracked> tracked{static_cast<Tracked*>(userdata)};
+        auto* scheduler = tracked->scheduler;
+        --scheduler->inFlight_;
+        tracked->callback(client, tracked->userdata, requestId, response);
+        scheduler->sendQueued(client);
+    }
+
+    void sendQueued(UA_Client* client) {
+        for (auto& queue : queues_) {
+            while (!queue.empty() && (maxInFlight_ == 0 || inFlight_ < maxInFlight_)) {
+                auto item = std::move(queue.front());
+                queue.pop_front();
+                if (item.send(client, item.callback, item.userdata) != UA_STATUSCODE_GOOD) {
+                    item.callback(client, item.userdata, 0, nullptr);
+                }
+            }
+        }
+    }
+
+    void cancelQueued() noexcept {
+        for (auto& queue : queues_) {
+            while (!queue.empty()) {
+                auto item = std::move(queue.front());
+                queue.pop_front();
+                item.callback(nullptr, item.userdata, 0, nullptr);
+            }
+        }
+    }
+
+    size_t maxInFlight_{0};
+    size_t maxQueued_{0};
+    size_t inFlight_{0};
+    RequestPriority priority_{RequestPriority::Normal};
+    std::array<std::deque<Queued>, requestPriorityCount> queues_;
+};
+
+}  // namespace opcua::detail
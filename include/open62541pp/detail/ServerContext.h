@@ -1,19 +1,278 @@
 #pragma once
 
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>  // memcpy
+#include <functional>
+#include <iterator>  // next
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
 
 #include "open62541pp/Config.h"
+#include "open62541pp/NamespaceTable.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/detail/AdmissionControl.h"
 #include "open62541pp/detail/ContextMap.h"
+#include "open62541pp/detail/DataSourceBinding.h"  // KeyedNodeContext
 #include "open62541pp/detail/ExceptionCatcher.h"
+#include "open62541pp/detail/MemoryAccounting.h"
+#include "open62541pp/detail/MetricsRecorder.h"
 #include "open62541pp/detail/NodeContext.h"
+#include "open62541pp/services/Subscription.h"  // MonitoredItemNotification
 #include "open62541pp/services/detail/MonitoredItemContext.h"
+#include "open62541pp/types/Composed.h"  // BrowseDescription, BrowseResult
+#include "open62541pp/types/DataValue.h"
 #include "open62541pp/types/NodeId.h"
 
+namespace opcua {
+class AddressSpaceIndex;
+class InstantiationTemplate;
+struct WriteNotification;
+}  // namespace opcua
+
 namespace opcua::detail {
 
+struct QueryState;
+
+/**
+ * Write notifications of a group of nodes, collected by the onAfterWrite value callbacks and
+ * delivered in a batch after each server iteration.
+ */
+struct WriteNotificationGroup {
+    std::function<void(Span<const WriteNotification>)> callback;
+    std::mutex mutex;
+    std::vector<WriteNotification> pending;  // guarded by mutex
+    std::vector<WriteNotification> delivering;  // owned by the server loop
+};
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+/**
+ * Data change notifications of a group of local monitored items, collected by the data change
+ * callbacks and delivered in a batch after each server iteration.
+ * The group is removed from the server context with the last of its monitored items.
+ */
+struct DataChangeNotificationGroup {
+    std::function<void(uint32_t subId, Span<services::MonitoredItemNotification>)> callback;
+    std::vector<uint32_t> monitoredItemIds;  // guarded by the context mutex
+    std::mutex mutex;
+    std::vector<services::MonitoredItemNotification> pending;  // guarded by mutex
+    std::vector<services::MonitoredItemNotification> delivering;  // owned by the server loop
+};
+#endif
+
+/// Contiguous block of node contexts of a bulk registration.
+template <typename T>
+struct NodeContextBlock {
+    std::unique_ptr<T[]> data;  // NOLINT
+    size_t size;
+};
+
+/**
+ * Cache of complete local browse results (see Server::setBrowseCacheEnabled).
+ * Entries are keyed by the browse description. Any change of the address space clears the whole
+ * cache and increments the generation, results browsed before the change are not inserted.
+ */
+class BrowseCache {
+public:
+    bool isEnabled() const noexcept {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    void setEnabled(bool enabled, size_t capacity) {
+        const std::lock_guard lock(mutex_);
+        capacity_ = capacity;
+        entries_.clear();
+        enabled_ = enabled;
+    }
+
+    uint64_t getGeneration() const noexcept {
+        return generation_.load(std::memory_order_acquire);
+    }
+
+    std::optional<BrowseResult> find(const BrowseDescription& bd) const {
+        const std::lock_guard lock(mutex_);
+        const auto it = entries_.find(Key(bd));
+        if (it == entries_.end()) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    void insert(const BrowseDescription& bd, const BrowseResult& result, uint64_t generation) {
+        const std::lock_guard lock(mutex_);
+        if (!enabled_ || generation != generation_) {
+            return;
+        }
+        if (entries_.size() >= capacity_) {
+            entries_.clear();
+        }
+        entries_.insert_or_assign(Key(bd), result);
+    }
+
+    void invalidate() {
+        generation_.fetch_add(1, std::memory_order_acq_rel);
+        if (isEnabled()) {
+            const std::lock_guard lock(mutex_);
+            entries_.clear();
+        }
+    }
+
+    size_t size() const {
+        const std::lock_guard lock(mutex_);
+        return entries_.size();
+    }
+
+private:
+    struct Key {
+        explicit Key(const BrowseDescription& bd)
+            : nodeId(bd.getNodeId()),
+              referenceTypeId(bd.getReferenceTypeId()),
+              browseDirection(static_cast<uint32_t>(bd.getBrowseDirection())),
+              includeSubtypes(bd.getIncludeSubtypes()),
+              nodeClassMask(bd.getNodeClassMask().get()),
+              resultMask(bd.getResultMask().get()) {}
+
+        bool operator==(const Key& other) const noexcept {
+            return nodeId == other.nodeId && referenceTypeId == other.referenceTypeId &&
+                   browseDirection == other.browseDirection &&
+                   includeSubtypes == other.includeSubtypes &&
+                   nodeClassMask == other.nodeClassMask && resultMask == other.resultMask;
+        }
+
+        NodeId nodeId;
+        NodeId referenceTypeId;
+        uint32_t browseDirection;
+        bool includeSubtypes;
+        uint32_t nodeClassMask;
+        uint32_t resultMask;
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const noexcept {
+            size_t hash = std::hash<NodeId>{}(key.nodeId);
+            hash = hash * 31 + std::hash<NodeId>{}(key.referenceTypeId);
+            hash = hash * 31 + key.browseDirection;
+            hash = hash * 31 + static_cast<size_t>(key.includeSubtypes);
+            hash = hash * 31 + key.nodeClassMask;
+            return hash * 31 + key.resultMask;
+        }
+    };
+
+    std::atomic<bool> enabled_{false};
+    std::atomic<uint64_t> generation_{0};
+    size_t capacity_{0};
+    mutable std::mutex mutex_;
+    std::unordered_map<Key, BrowseResult, KeyHash> entries_;
+};
+
+/**
+ * Continuation points of local browse requests.
+ * The complete reference array of a browse is kept with a cursor to the next reference, so every
+ * page costs `O(page size)`. Continuation points are bound to the session (null for local calls)
+ * and limited per session.
+ */
+class BrowseContinuations {
+public:
+    struct Cursor {
+        NodeId sessionId;
+        BrowseResult result;  // complete references
+        size_t next;  // index of the next reference
+        uint32_t maxReferences;  // page size
+    };
+
+    void setMaxPerSession(size_t maxPerSession) {
+        const std::lock_guard lock(mutex_);
+        maxPerSession_ = maxPerSession;
+    }
+
+    /// Store the cursor and return its continuation point, `std::nullopt` if the limit is reached.
+    std::optional<ByteString> open(Cursor&& cursor) {
+        const std::lock_guard lock(mutex_);
+        size_t count = 0;
+        for (const auto& [id, other] : cursors_) {
+            count += static_cast<size_t>(other.sessionId == cursor.sessionId);
+        }
+        if (count >= maxPerSession_) {
+            return std::nullopt;
+        }
+        const uint64_t id = ++lastId_;
+        cursors_.emplace(id, std::move(cursor));
+        return encode(id);
+    }
+
+    /// Store a cursor taken with @ref take again under the same continuation point.
+    void restore(const ByteString& continuationPoint, Cursor&& cursor) {
+        const std::lock_guard lock(mutex_);
+        cursors_.emplace(decode(continuationPoint).value(), std::move(cursor));
+    }
+
+    /// Remove and return the cursor, `std::nullopt` if the continuation point is unknown.
+    std::optional<Cursor> take(const NodeId& sessionId, const ByteString& continuationPoint) {
+        const auto id = decode(continuationPoint);
+        if (!id.has_value()) {
+            return std::nullopt;
+        }
+        const std::lock_guard lock(mutex_);
+        const auto it = cursors_.find(*id);
+        if (it == cursors_.end() || it->second.sessionId != sessionId) {
+            return std::nullopt;
+        }
+        auto cursor = std::move(it->second);
+        cursors_.erase(it);
+        return cursor;
+    }
+
+    /// Check if the continuation point was created by this class (possibly released already).
+    static bool isOwned(const ByteString& continuationPoint) noexcept {
+        return decode(continuationPoint).has_value();
+    }
+
+    void releaseSession(const NodeId& sessionId) {
+        const std::lock_guard lock(mutex_);
+        for (auto it = cursors_.begin(); it != cursors_.end();) {
+            it = (it->second.sessionId == sessionId) ? cursors_.erase(it) : std::next(it);
+        }
+    }
+
+    size_t size() const {
+        const std::lock_guard lock(mutex_);
+        return cursors_.size();
+    }
+
+private:
+    // distinguishes the continuation points from the 16 byte continuation points of open62541
+    static constexpr UA_Byte tag = 0xBC;
+
+    static ByteString encode(uint64_t id) {
+        std::vector<uint8_t> bytes(1 + sizeof(id), tag);
+        std::memcpy(bytes.data() + 1, &id, sizeof(id));
+        return ByteString(bytes);
+    }
+
+    static std::optional<uint64_t> decode(const ByteString& continuationPoint) noexcept {
+        uint64_t id{};
+        if (continuationPoint->length != 1 + sizeof(id) || continuationPoint->data[0] != tag) {
+            return std::nullopt;
+        }
+        std::memcpy(&id, continuationPoint->data + 1, sizeof(id));  // NOLINT
+        return id;
+    }
+
+    size_t maxPerSession_{5};  // UA_MAXCONTINUATIONPOINTS of open62541
+    uint64_t lastId_{0};
+    mutable std::mutex mutex_;
+    std::unordered_map<uint64_t, Cursor> cursors_;
+};
+
 /**
  * Internal storage for Server class.
  * Mainly used to store stateful function pointers.
+ * The context can be accessed from any thread: the context maps are synchronized internally, all
+ * other members are guarded by `mutex`.
  */
 class ServerContext {
 public:
@@ -22,9 +281,53 @@ public:
     using MonId = uint32_t;
     using SubMonId = std::pair<uint32_t, uint32_t>;
     detail::ContextMap<SubMonId, services::detail::MonitoredItemContext> monitoredItems;
+    std::vector<std::shared_ptr<DataChangeNotificationGroup>> dataChangeNotificationGroups;
+    std::atomic<bool> hasDataChangeNotifications{false};
 #endif
 
     detail::ContextMap<NodeId, NodeContext> nodeContexts;
+    std::vector<NodeContextBlock<NodeContext>> nodeContextBlocks;  // bulk registrations
+    std::vector<NodeContextBlock<KeyedNodeContext>> keyedNodeContextBlocks;
+
+    std::optional<NamespaceTable> namespaceTable;  // cached, reset by registerNamespace
+
+    std::vector<std::unique_ptr<WriteNotificationGroup>> writeNotificationGroups;
+    std::atomic<bool> hasWriteNotifications{false};
+
+    std::shared_ptr<void> historyGathering;  // UA_HistoryDataGathering of the history database
+
+    std::unordered_map<NodeId, std::shared_ptr<InstantiationTemplate>> instantiationTemplates;
+
+    BrowseCache browseCache;  // synchronized internally
+    BrowseContinuations browseContinuations;  // synchronized internally
+
+    std::shared_ptr<AddressSpaceIndex> addressSpaceIndex;  // created on first use
+
+    std::shared_ptr<QueryState> queryState;  // continuation points of local queries
+
+#ifdef UA_ENABLE_PUBSUB
+    unsigned pubSubTransports{0};  // flags of PubSubTransport layers added to the config (<= v1.3)
+    std::unordered_map<NodeId, std::shared_ptr<void>> dataSetReaders;  // decoding targets
+#endif
+
+    MetricsRecorder metrics;  // lock-free
+    AdmissionController admission;
+    MemoryAccountingSwitch memoryAccounting;
+
+    /// Incremented by every change of the address space through the C++ API or by clients.
+    std::atomic<uint64_t> addressSpaceGeneration{0};
+    /// Set while a notification after an applied client change is scheduled.
+    std::atomic<bool> addressSpaceChangePending{false};
+
+    /// Invalidate the derived views of the address space (browse cache, address space index).
+    void notifyAddressSpaceChange() {
+        addressSpaceGeneration.fetch_add(1, std::memory_order_acq_rel);
+        browseCache.invalidate();
+    }
+
+    std::mutex mutex;  // guards node context blocks, write and data change notification groups,
+                       // namespace table, history gathering, instantiation templates, the
+                       // address space index, the query state and the PubSub transports
 
     detail::ExceptionCatcher exceptionCatcher;
 };
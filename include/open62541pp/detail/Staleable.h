@@ -1,9 +1,13 @@
 #pragma once
 
+#include <cstddef>
+#include <mutex>
 #include <type_traits>
 
 namespace opcua::detail {
 
+class StaleList;
+
 /**
  * Object that can mark itself as stale (to be removed).
  *
@@ -13,11 +17,75 @@ namespace opcua::detail {
  * container owning this context object. Each context object could carry a reference to its owning
  * container and delete itself, but this can be problematic... Instead a simple flag `stale` can be
  * set if the item is deleted and should be removed from its container, the `ContextMap`.
+ *
+ * With markStale, the object is additionally linked into the stale list of its `ContextMap`
+ * (intrusive, no allocation). The map reclaims all listed objects at its next insertion in O(1)
+ * per object and reuses their allocations for new objects.
  */
 struct Staleable {
     bool stale = false;  ///< Mark the object to be removed
+
+    /// Mark the object to be removed and enqueue it for reclamation by its owning container.
+    void markStale() noexcept;
+
+    // intrusive reclamation state, managed by the owning ContextMap
+    StaleList* staleList = nullptr;
+    Staleable* nextStale = nullptr;
+    void* staleEntry = nullptr;  // element of the map
+    size_t staleShard = 0;
+    bool staleQueued = false;  // linked into the stale list
+    bool staleDetached = false;  // removed from the map, owned by the stale list
 };
 
+/**
+ * Intrusive list of stale objects marked with Staleable::markStale.
+ * The stale flags of listed objects are guarded by the list's mutex.
+ */
+class StaleList {
+public:
+    void push(Staleable& item) noexcept {
+        const std::lock_guard lock(mutex_);
+        if (item.staleQueued) {
+            return;
+        }
+        item.staleQueued = true;
+        item.nextStale = head_;
+        head_ = &item;
+    }
+
+    /// Take all listed objects, linked by Staleable::nextStale.
+    Staleable* takeAll() noexcept {
+        const std::lock_guard lock(mutex_);
+        Staleable* head = head_;
+        head_ = nullptr;
+        return head;
+    }
+
+    /// Detach the object of a removed map element if it is listed.
+    /// @return `true` if the object is now owned by the stale list (to be reclaimed)
+    bool detachIfQueued(Staleable& item) noexcept {
+        const std::lock_guard lock(mutex_);
+        item.staleDetached = item.staleQueued;
+        return item.staleDetached;
+    }
+
+    bool isDetached(const Staleable& item) noexcept {
+        const std::lock_guard lock(mutex_);
+        return item.staleDetached;
+    }
+
+private:
+    std::mutex mutex_;
+    Staleable* head_ = nullptr;
+};
+
+inline void Staleable::markStale() noexcept {
+    stale = true;
+    if (staleList != nullptr) {
+        staleList->push(*this);
+    }
+}
+
 /**
  * Check if an object as a boolean `stale` flag.
  */
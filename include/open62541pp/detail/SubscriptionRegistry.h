@@ -0,0 +1,122 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <utility>  // move, pair
+#include <variant>
+#include <vector>
+
+#include "open62541pp/Common.h"  // MonitoringMode
+#include "open62541pp/Config.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/services/MonitoredItem.h"
+#include "open62541pp/services/Subscription.h"
+#include "open62541pp/services/detail/MonitoredItemContext.h"
+#include "open62541pp/types/Composed.h"  // ReadValueId
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+namespace opcua::detail {
+
+/// Definition of a client monitored item, recorded to recreate it in a new session.
+struct MonitoredItemRecord {
+    ReadValueId itemToMonitor;
+    MonitoringMode monitoringMode{};
+    services::MonitoringParameters parameters;
+    std::variant<
+        std::monostate,
+        services::detail::MonitoredItemContext::DataChangeCallback,
+        services::detail::MonitoredItemContext::EventCallback>
+        notificationCallback;
+    std::function<void(uint32_t subId, uint32_t monId)> deleteCallback;
+};
+
+/// Definition of a client subscription and its monitored items.
+struct SubscriptionRecord {
+    services::SubscriptionParameters parameters;
+    bool publishingEnabled = true;
+    std::function<void(uint32_t subId)> deleteCallback;
+    services::DataChangeBatchCallback batchCallback;
+    std::map<uint32_t, MonitoredItemRecord> monitoredItems;  // by monitored item id
+};
+
+/**
+ * Records of the subscriptions and monitored items created by the client services.
+ * Subscriptions that are lost with their session (their contexts were deleted) are recreated from
+ * the records by services::recoverSubscriptions. The records are synchronized internally.
+ */
+class SubscriptionRegistry {
+public:
+    void addSubscription(uint32_t subId, SubscriptionRecord record) {
+        const std::lock_guard lock(mutex_);
+        subscriptions_[subId] = std::move(record);
+    }
+
+    void removeSubscription(uint32_t subId) {
+        const std::lock_guard lock(mutex_);
+        subscriptions_.erase(subId);
+    }
+
+    /// Invoke `func(SubscriptionRecord&)` if the subscription is recorded.
+    template <typename Func>
+    void updateSubscription(uint32_t subId, Func&& func) {
+        const std::lock_guard lock(mutex_);
+        if (auto it = subscriptions_.find(subId); it != subscriptions_.end()) {
+            func(it->second);
+        }
+    }
+
+    void addMonitoredItem(uint32_t subId, uint32_t monId, MonitoredItemRecord record) {
+        updateSubscription(subId, [&](SubscriptionRecord& subscription) {
+            subscription.monitoredItems[monId] = std::move(record);
+        });
+    }
+
+    void removeMonitoredItem(uint32_t subId, uint32_t monId) {
+        updateSubscription(subId, [&](SubscriptionRecord& subscription) {
+            subscription.monitoredItems.erase(monId);
+        });
+    }
+
+    /// Invoke `func(MonitoredItemRecord&)` if the monitored item is recorded.
+    template <typename Func>
+    void updateMonitoredItem(uint32_t subId, uint32_t monId, Func&& func) {
+        updateSubscription(subId, [&](SubscriptionRecord& subscription) {
+            if (auto it = subscription.monitoredItems.find(monId);
+                it != subscription.monitoredItems.end()) {
+                func(it->second);
+            }
+        });
+    }
+
+    /// Remove and return the records of all subscriptions with `isLost(subId) == true`.
+    template <typename Predicate>
+    std::vector<std::pair<uint32_t, SubscriptionRecord>> takeLost(Predicate&& isLost) {
+        const std::lock_guard lock(mutex_);
+        std::vector<std::pair<uint32_t, SubscriptionRecord>> lost;
+        for (auto it = subscriptions_.begin(); it != subscriptions_.end();) {
+            if (isLost(it->first)) {
+                lost.emplace_back(it->first, std::move(it->second));
+                it = subscriptions_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        return lost;
+    }
+
+    std::atomic<bool> recoveryPending{false};  // set when a session is activated
+    std::function<void()> recover;  // invoked by the client loop if recovery is pending
+
+private:
+    std::mutex mutex_;
+    std::unordered_map<uint32_t, SubscriptionRecord> subscriptions_;
+};
+
+}  // namespace opcua::detail
+
+#endif
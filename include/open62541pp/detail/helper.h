@@ -8,6 +8,8 @@
 
 #include "open62541pp/Common.h"  // TypeIndex
 #include "open62541pp/ErrorHandling.h"
+#include "open62541pp/detail/MemoryAccounting.h"
+#include "open62541pp/detail/ParallelCopy.h"
 #include "open62541pp/detail/traits.h"  // IsOneOf
 #include "open62541pp/open62541.h"
 
@@ -46,7 +48,11 @@ template <typename T>
 constexpr void clear(T& native, const UA_DataType& type) noexcept {
     assert(isValidTypeCombination<T>(type));
     if constexpr (!isPointerFree<T>) {
-        UA_clear(&native, &type);
+        if (isParallelCopyActive()) {
+            clearParallel(&native, type);
+        } else {
+            UA_clear(&native, &type);
+        }
     }
 }
 
@@ -63,6 +69,9 @@ template <typename T>
     if (result == nullptr) {
         throw std::bad_alloc();
     }
+    if (isMemoryAccountingActive()) {
+        recordNativeAllocation(MemoryCategory::NativeAllocation, type.memSize);
+    }
     return result;
 }
 
@@ -77,7 +86,12 @@ template <typename T>
     assert(isValidTypeCombination<T>(type));
     if constexpr (!isPointerFree<T>) {
         T dst;  // NOLINT, initialized in UA_copy function
-        throwIfBad(UA_copy(&src, &dst, &type));
+        throwIfBad(
+            isParallelCopyActive() ? copyParallel(&src, &dst, type) : UA_copy(&src, &dst, &type)
+        );
+        if (isMemoryAccountingActive()) {
+            recordNativeCopy(&dst, 0, type);
+        }
         return dst;
     } else {
         return src;
@@ -89,7 +103,7 @@ template <typename T>
 template <typename T>
 inline void deallocateArray(T* array, size_t size, const UA_DataType& type) noexcept {
     assert(isValidTypeCombination<T>(type));
-    UA_Array_delete(array, size, &type);
+    deleteArrayParallel(array, size, type);  // sequential if disabled or below threshold
 }
 
 template <typename T>
@@ -99,6 +113,9 @@ template <typename T>
     if (result == nullptr) {
         throw std::bad_alloc();
     }
+    if (isMemoryAccountingActive()) {
+        recordNativeAllocation(MemoryCategory::NativeAllocation, size * type.memSize);
+    }
     return result;
 }
 
@@ -113,11 +130,20 @@ template <typename T>
     assert(isValidTypeCombination<T>(type));
     if constexpr (!isPointerFree<T>) {
         T* dst{};
-        throwIfBad(UA_Array_copy(src, size, (void**)&dst, &type));  // NOLINT
+        throwIfBad(copyArrayParallel(src, size, (void**)&dst, type));  // NOLINT
+        if (isMemoryAccountingActive()) {
+            recordNativeCopy(dst, size, type);
+        }
         return dst;
     } else {
-        T* dst = allocateArray<T>(size, type);
+        auto* dst = static_cast<T*>(UA_Array_new(size, &type));
+        if (dst == nullptr) {
+            throw std::bad_alloc();
+        }
         std::copy_n(src, size, dst);
+        if (isMemoryAccountingActive()) {
+            recordNativeCopy(dst, size, type);
+        }
         return dst;
     }
 }
@@ -1,28 +1,87 @@
 #pragma once
 
 #include "open62541pp/AccessControl.h"
+#include "open62541pp/AddressSpaceIndex.h"
+#include "open62541pp/AddressSpaceSnapshot.h"
+#include "open62541pp/Aggregator.h"
+#include "open62541pp/AsyncDataSource.h"
+#include "open62541pp/AttributeCache.h"
+#include "open62541pp/BatchedWriteBackend.h"
 #include "open62541pp/Bitmask.h"
+#include "open62541pp/BrowsePathResolver.h"
 #include "open62541pp/Client.h"
+#include "open62541pp/ClientDiagnostics.h"
+#include "open62541pp/ClientMetrics.h"
+#include "open62541pp/ClientPool.h"
 #include "open62541pp/Common.h"
 #include "open62541pp/Config.h"
+#include "open62541pp/ConditionStore.h"
+#include "open62541pp/ConnectionCache.h"
+#include "open62541pp/CredentialStore.h"
 #include "open62541pp/Crypto.h"
 #include "open62541pp/DataType.h"
 #include "open62541pp/DataTypeBuilder.h"
+#include "open62541pp/DataTypeDiscovery.h"
+#include "open62541pp/DataTypeRegistry.h"
+#include "open62541pp/DataValueBatch.h"
+#include "open62541pp/DeadbandWriter.h"
+#include "open62541pp/DeltaArray.h"
+#include "open62541pp/Encoding.h"
+#include "open62541pp/EndpointDiscovery.h"
 #include "open62541pp/ErrorHandling.h"
 #include "open62541pp/Event.h"
+#include "open62541pp/EventFilterBuilder.h"
+#include "open62541pp/EventFilterSet.h"
+#include "open62541pp/HistoryBackend.h"
+#include "open62541pp/HotStandby.h"
+#include "open62541pp/InstantiationTemplate.h"
+#include "open62541pp/JsonEncoding.h"
 #include "open62541pp/Logger.h"
+#include "open62541pp/MemoryArena.h"
+#include "open62541pp/MemoryStatistics.h"
+#include "open62541pp/MethodDispatcher.h"
+#include "open62541pp/ModelChangeTracker.h"
 #include "open62541pp/MonitoredItem.h"
+#include "open62541pp/Multiplexer.h"
+#include "open62541pp/NamespaceTable.h"
 #include "open62541pp/Node.h"
+#include "open62541pp/NodeBatch.h"
+#include "open62541pp/NodeIdPool.h"
+#include "open62541pp/NodeSetImporter.h"
+#include "open62541pp/NodeView.h"
+#include "open62541pp/NotificationQueue.h"
+#include "open62541pp/NotificationRecorder.h"
 #include "open62541pp/NodeIds.h"
+#include "open62541pp/ParallelCopy.h"
+#include "open62541pp/PreparedRead.h"
+#include "open62541pp/PubSub.h"
+#include "open62541pp/ReadCoalescer.h"
+#include "open62541pp/RequestOptions.h"
+#include "open62541pp/RequestView.h"
+#include "open62541pp/Result.h"
+#include "open62541pp/RoleAccessControl.h"
+#include "open62541pp/SamplingScheduler.h"
 #include "open62541pp/Server.h"
+#include "open62541pp/ServerMetrics.h"
 #include "open62541pp/Session.h"
+#include "open62541pp/ShardedServer.h"
+#include "open62541pp/SharedSampler.h"
 #include "open62541pp/Span.h"
+#include "open62541pp/StaticValueCache.h"
 #include "open62541pp/Subscription.h"
+#include "open62541pp/SubscriptionGroup.h"
+#include "open62541pp/SubscriptionStatistics.h"
+#include "open62541pp/SubscriptionTuner.h"
+#include "open62541pp/TransportSettings.h"
 #include "open62541pp/TypeConverter.h"
 #include "open62541pp/TypeRegistry.h"
+#include "open62541pp/TypeRegistryFwd.h"
 #include "open62541pp/TypeRegistryNative.h"
 #include "open62541pp/TypeWrapper.h"
 #include "open62541pp/ValueBackend.h"
+#include "open62541pp/ValueStore.h"
+#include "open62541pp/VariantVisit.h"
+#include "open62541pp/WriteBatcher.h"
 #include "open62541pp/async.h"
 #include "open62541pp/overloads/comparison.h"
 #include "open62541pp/services/services.h"
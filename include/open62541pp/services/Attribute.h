@@ -1,25 +1,31 @@
 #pragma once
 
+#include <array>
 #include <cassert>
 #include <cstdint>
+#include <functional>
 #include <utility>
 #include <vector>
 
 #include "open62541pp/Bitmask.h"
 #include "open62541pp/Client.h"
 #include "open62541pp/Common.h"
+#include "open62541pp/Result.h"
 #include "open62541pp/ErrorHandling.h"
 #include "open62541pp/Span.h"
 #include "open62541pp/TypeWrapper.h"
 #include "open62541pp/async.h"
+#include "open62541pp/detail/helper.h"  // isPointerFree
 #include "open62541pp/open62541.h"
 #include "open62541pp/services/detail/AttributeHandler.h"
 #include "open62541pp/services/detail/ClientService.h"
 #include "open62541pp/services/detail/RequestHandling.h"
 #include "open62541pp/services/detail/ResponseHandling.h"
+#include "open62541pp/typeregistry/Builtin.h"
 #include "open62541pp/types/Builtin.h"
 #include "open62541pp/types/Composed.h"
 #include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/DateTime.h"
 #include "open62541pp/types/NodeId.h"
 #include "open62541pp/types/Variant.h"
 
@@ -58,6 +64,84 @@ inline ReadResponse read(
     return read(client, detail::createReadRequest(timestamps, nodesToRead));
 }
 
+/**
+ * Columnar results of readValuesAs.
+ * The columns `values` and `statuses` have the size of the requested node ids, the timestamp
+ * columns are only filled if requested. Values of bad results are value-initialized.
+ */
+template <typename T>
+struct ValueColumns {
+    std::vector<T> values;
+    std::vector<StatusCode> statuses;
+    std::vector<DateTime> sourceTimestamps;
+    std::vector<DateTime> serverTimestamps;
+};
+
+/**
+ * Read the `AttributeId::Value` attribute of multiple nodes into columns (client only).
+ * The scalar values are decoded straight from the response without intermediate DataValue
+ * wrappers. Results with a value of another type get the status code `BadTypeMismatch`, results
+ * without a value `BadNoData`.
+ * @tparam T Registered type of the values, e.g. `double`
+ * @exception BadStatus If the service call failed
+ */
+template <typename T>
+ValueColumns<T> readValuesAs(
+    Client& client,
+    Span<const NodeId> ids,
+    TimestampsToReturn timestamps = TimestampsToReturn::Neither
+) {
+    static_assert(opcua::detail::isRegisteredType<T>);
+    std::vector<UA_ReadValueId> items(ids.size());
+    for (size_t i = 0; i < ids.size(); ++i) {
+        items[i].nodeId = *ids[i].handle();  // shallow copy
+        items[i].attributeId = UA_ATTRIBUTEID_VALUE;
+    }
+    UA_ReadRequest request{};
+    request.timestampsToReturn = static_cast<UA_TimestampsToReturn>(timestamps);
+    request.nodesToReadSize = items.size();
+    request.nodesToRead = items.data();
+    const auto response = read(client, asWrapper<ReadRequest>(request));
+    throwIfBad(response->responseHeader.serviceResult);
+    if (response->resultsSize != ids.size()) {
+        throw BadStatus(UA_STATUSCODE_BADUNEXPECTEDERROR);
+    }
+
+    const bool withSource = timestamps == TimestampsToReturn::Source ||
+                            timestamps == TimestampsToReturn::Both;
+    const bool withServer = timestamps == TimestampsToReturn::Server ||
+                            timestamps == TimestampsToReturn::Both;
+    ValueColumns<T> columns;
+    columns.values.resize(ids.size());
+    columns.statuses.resize(ids.size());
+    columns.sourceTimestamps.resize(withSource ? ids.size() : 0);
+    columns.serverTimestamps.resize(withServer ? ids.size() : 0);
+    const UA_DataType& type = getDataType<T>();
+    for (size_t i = 0; i < ids.size(); ++i) {
+        const UA_DataValue& dv = response->results[i];  // NOLINT
+        StatusCode status = dv.hasStatus ? dv.status : UA_STATUSCODE_GOOD;
+        if (status.isGood()) {
+            if (!dv.hasValue) {
+                status = UA_STATUSCODE_BADNODATA;
+            } else if (!UA_Variant_hasScalarType(&dv.value, &type)) {
+                status = UA_STATUSCODE_BADTYPEMISMATCH;
+            } else if constexpr (opcua::detail::isPointerFree<T>) {
+                columns.values[i] = *static_cast<const T*>(dv.value.data);
+            } else {
+                columns.values[i] = asWrapper<Variant>(dv.value).template getScalarCopy<T>();
+            }
+        }
+        columns.statuses[i] = status;
+        if (withSource) {
+            columns.sourceTimestamps[i] = DateTime(dv.sourceTimestamp);
+        }
+        if (withServer) {
+            columns.serverTimestamps[i] = DateTime(dv.serverTimestamp);
+        }
+    }
+    return columns;
+}
+
 /**
  * Asynchronously read one or more attributes of one or more nodes (client only).
  * @copydetails read
@@ -123,6 +207,176 @@ auto readAttributeAsync(
     );
 }
 
+namespace detail {
+struct NodeAttributesSnapshotAccess;
+}  // namespace detail
+
+/**
+ * Typed attributes of a node, result of readAttributes.
+ * Only the node id and the requested attributes are set, the other fields keep their default
+ * values. Check the status of the attributes with has() or getStatus().
+ */
+struct NodeAttributesSnapshot {
+    NodeId nodeId;
+    NodeClass nodeClass{};
+    QualifiedName browseName;
+    LocalizedText displayName;
+    LocalizedText description;
+    Bitmask<WriteMask> writeMask;
+    Bitmask<WriteMask> userWriteMask;
+    bool isAbstract{};
+    bool symmetric{};
+    LocalizedText inverseName;
+    bool containsNoLoops{};
+    Bitmask<EventNotifier> eventNotifier;
+    Variant value;
+    NodeId dataType;
+    ValueRank valueRank{};
+    std::vector<uint32_t> arrayDimensions;
+    Bitmask<AccessLevel> accessLevel;
+    Bitmask<AccessLevel> userAccessLevel;
+    double minimumSamplingInterval{};
+    bool historizing{};
+    bool executable{};
+    bool userExecutable{};
+
+    /// Get the status code of an attribute.
+    /// Attributes that were not requested return `BadNoData`, attributes with a value of an
+    /// unexpected type `BadTypeMismatch`.
+    StatusCode getStatus(AttributeId attributeId) const noexcept {
+        const auto index = static_cast<size_t>(attributeId);
+        if (index == 0 || index >= statuses_.size()) {
+            return UA_STATUSCODE_BADATTRIBUTEIDINVALID;
+        }
+        return requested_[index] ? statuses_[index] : UA_STATUSCODE_BADNODATA;
+    }
+
+    /// Check if an attribute was read without a bad status code.
+    bool has(AttributeId attributeId) const noexcept {
+        return !getStatus(attributeId).isBad();
+    }
+
+private:
+    friend struct detail::NodeAttributesSnapshotAccess;
+
+    std::array<UA_StatusCode, 23> statuses_{};  // indexed by attribute id
+    std::array<bool, 23> requested_{};
+};
+
+/**
+ * Read multiple attributes of multiple nodes in a single request.
+ * With a client, all attributes are sent in one Read request (split by the server's operation
+ * limits). The results are moved from the response into the typed fields of the snapshots
+ * without intermediate DataValue objects.
+ * Supported are the attributes from AttributeId::NodeId to AttributeId::UserExecutable.
+ * @return Snapshots in the order of the node ids
+ * @exception BadStatus (BadAttributeIdInvalid) If an attribute is not supported
+ * @exception BadStatus If the service call failed
+ */
+template <typename T>
+std::vector<NodeAttributesSnapshot> readAttributes(
+    T& serverOrClient, Span<const NodeId> ids, Span<const AttributeId> attributeIds
+);
+
+/**
+ * Read multiple attributes of a node in a single request.
+ * @copydetails readAttributes(T&, Span<const NodeId>, Span<const AttributeId>)
+ */
+template <typename T>
+inline NodeAttributesSnapshot readAttributes(
+    T& serverOrClient, const NodeId& id, Span<const AttributeId> attributeIds
+) {
+    auto snapshots = readAttributes(serverOrClient, Span<const NodeId>(&id, 1), attributeIds);
+    return std::move(snapshots.front());
+}
+
+/**
+ * Check if multiple nodes exist (client only).
+ * The AttributeId::NodeClass attributes of all nodes are read with a single Read request, split
+ * by the server's operation limit `MaxNodesPerRead`.
+ * @return Flags in the order of the node ids, `true` if the node exists
+ * @exception BadStatus If the service call failed
+ */
+std::vector<bool> existMany(Client& client, Span<const NodeId> ids);
+
+/**
+ * Check if multiple nodes exist (server only).
+ * The nodes are looked up in the node store without the service layer.
+ * @return Flags in the order of the node ids, `true` if the node exists
+ */
+std::vector<bool> existMany(Server& server, Span<const NodeId> ids);
+
+namespace detail {
+/// Type-erased implementation of readArrayStreaming, the chunks are array variants.
+size_t readArrayStreaming(
+    Client& client,
+    const NodeId& id,
+    size_t chunkElements,
+    const std::function<void(const Variant& chunk)>& sink
+);
+}  // namespace detail
+
+/**
+ * Read a large one-dimensional array value in chunks (client only).
+ * A single Read request of a large array may exceed the message size limits and holds the whole
+ * array twice in memory (encoded and decoded). Instead, the AttributeId::ArrayDimensions
+ * attribute is probed once and the array is read with consecutive NumericRange index ranges of
+ * `chunkElements` elements (e.g. `0:999`, `1000:1999`). Up to four chunk requests are pipelined.
+ * The chunks are passed to the sink in order, straight from the response buffer without copies;
+ * the span is only valid during the sink invocation.
+ *
+ * The array dimensions only bound the number of requests, the stream ends with the first chunk
+ * shorter than `chunkElements` or with the status code `BadIndexRangeNoData`. Arrays with unknown
+ * dimensions are read until the end as well.
+ * @code
+ * std::vector<double> samples;
+ * services::readArrayStreaming<double>(client, id, 100'000, [&](Span<const double> chunk) {
+ *     samples.insert(samples.end(), chunk.begin(), chunk.end());
+ * });
+ * @endcode
+ * @tparam T Native or wrapper type of the array elements, e.g. `double`
+ * @param sink Callable with the signature `void(Span<const T> chunk)`
+ * @return Total number of read elements
+ * @exception BadStatus (BadInvalidArgument) If `chunkElements` is zero
+ * @exception BadStatus (BadNotSupported) If the array has multiple dimensions
+ * @exception BadStatus (BadNoData) If a chunk has no value
+ * @exception BadVariantAccess If the value is not an array of type `T`
+ * @exception BadStatus If a service call failed
+ */
+template <typename T, typename Sink>
+size_t readArrayStreaming(Client& client, const NodeId& id, size_t chunkElements, Sink&& sink) {
+    return detail::readArrayStreaming(client, id, chunkElements, [&](const Variant& chunk) {
+        sink(chunk.getArray<T>());
+    });
+}
+
+/**
+ * Browsed node with prefetched attributes, result of browseWithAttributes.
+ */
+struct BrowsedNode {
+    /// Attributes of the target node.
+    NodeAttributesSnapshot attributes;
+    /// Type definition of the target node (objects and variables only).
+    ExpandedNodeId typeDefinition;
+};
+
+/**
+ * Browse the references of a node and read attributes of the target nodes in one batch.
+ * The node id, node class, browse name and display name are taken from the browse results
+ * (BrowseResultMask::TargetInfo), they are always set. All other attributes of all targets are
+ * read with a single Read request (see readAttributes) instead of one request per target.
+ * References to nodes of other servers are skipped.
+ * @param serverOrClient Instance of type Server or Client
+ * @param bd Browse description, the result mask is ignored
+ * @param attributeIds Attributes to read in addition to the browsed target info
+ * @exception BadStatus (BadAttributeIdInvalid) If an attribute is not supported
+ * @exception BadStatus If the browse or read service call failed
+ */
+template <typename T>
+std::vector<BrowsedNode> browseWithAttributes(
+    T& serverOrClient, const BrowseDescription& bd, Span<const AttributeId> attributeIds = {}
+);
+
 /**
  * @}
  * @defgroup Write
@@ -205,6 +459,9 @@ auto writeAttributeAsync(
     const DataValue& value,
     CompletionToken&& token = DefaultCompletionToken()
 ) {
+    if (auto* cache = client.getAttributeCache()) {
+        cache->invalidate(id, attributeId);
+    }
     auto item = detail::createWriteValue(id, attributeId, value);
     auto request = detail::createWriteRequest(item);
     return detail::sendRequest<UA_WriteRequest, UA_WriteResponse>(
@@ -317,6 +574,130 @@ inline auto writeDataValueAsync(
     );
 }
 
+/**
+ * Visit the stored value of a variable node without copy (server only).
+ * The visitor is invoked with a borrowed reference to the DataValue in the node store, which is
+ * only valid during the call. Large arrays can be processed in place, without the deep copy of
+ * readDataValue. Nodes with a data source or an `onBeforeRead` value callback (and all nodes if
+ * open62541 is built with `UA_MULTITHREADING >= 100`) are read with readDataValue instead, so the
+ * visitor always sees the value a read would return.
+ *
+ * Call this function from the thread of the server loop (or while the server loop is not
+ * running), the visitor must not modify the node.
+ * @exception BadStatus If the node does not exist or is not a variable node
+ * @ingroup Read
+ */
+void withDataValue(
+    Server& server, const NodeId& id, const std::function<void(const DataValue& value)>& visitor
+);
+
+/**
+ * Visit the stored value of a variable node without copy (server only).
+ * @copydetails withDataValue
+ * @ingroup Read
+ */
+template <typename Visitor>
+void withValue(Server& server, const NodeId& id, Visitor&& visitor) {
+    withDataValue(server, id, [&](const DataValue& value) {
+        std::invoke(std::forward<Visitor>(visitor), value.getValue());
+    });
+}
+
+/**
+ * Write the AttributeId::Value attribute of many nodes (server only).
+ * All values are written in one pass with a single reused write item, that references the node
+ * ids and values without copy. No DataValue is built per node. Data change notifications of
+ * monitored items are created by sampling, multiple writes within a sampling interval are
+ * coalesced into one notification.
+ * @param server Server instance
+ * @param ids Nodes to write
+ * @param values Values of the nodes, same size as `ids`
+ * @return Status codes of the writes, a failed write does not abort the batch
+ * @exception BadStatus (BadInvalidArgument) If the sizes of `ids` and `values` differ
+ * @ingroup Write
+ */
+std::vector<StatusCode> writeValues(
+    Server& server, Span<const NodeId> ids, Span<const Variant> values
+);
+
+/**
+ * Write the AttributeId::Value attribute of many nodes as DataValue objects (server only).
+ * @copydetails writeValues
+ * @ingroup Write
+ */
+std::vector<StatusCode> writeDataValues(
+    Server& server, Span<const NodeId> ids, Span<const DataValue> values
+);
+
+/* ---------------------------------- Non-throwing functions ---------------------------------- */
+
+/**
+ * Read node attribute without exceptions.
+ * Bad status codes of the service and the operation are returned in the Result instead of being
+ * thrown as BadStatus. Use the `try*` functions in loops where bad status codes are routine, e.g.
+ * polling of offline devices, to avoid the costs of exception unwinding.
+ * @ingroup Read
+ */
+template <typename T>
+Result<DataValue> tryReadAttribute(
+    T& serverOrClient,
+    const NodeId& id,
+    AttributeId attributeId,
+    TimestampsToReturn timestamps = TimestampsToReturn::Neither
+);
+
+/**
+ * Write node attribute without exceptions.
+ * @copydetails tryReadAttribute
+ * @ingroup Write
+ */
+template <typename T>
+Result<void> tryWriteAttribute(
+    T& serverOrClient, const NodeId& id, AttributeId attributeId, const DataValue& value
+);
+
+/**
+ * Read the AttributeId::Value attribute of a node without exceptions.
+ * @see tryReadAttribute
+ * @ingroup Read
+ */
+template <typename T>
+inline Result<Variant> tryReadValue(T& serverOrClient, const NodeId& id) {
+    auto result = tryReadAttribute(serverOrClient, id, AttributeId::Value);
+    return {result.code(), std::move(*result).getValue()};
+}
+
+/**
+ * Read the AttributeId::Value attribute of a node as a DataValue object without exceptions.
+ * @see tryReadAttribute
+ * @ingroup Read
+ */
+template <typename T>
+inline Result<DataValue> tryReadDataValue(T& serverOrClient, const NodeId& id) {
+    return tryReadAttribute(serverOrClient, id, AttributeId::Value, TimestampsToReturn::Both);
+}
+
+/**
+ * Write the AttributeId::Value attribute of a node without exceptions.
+ * @see tryWriteAttribute
+ * @ingroup Write
+ */
+template <typename T>
+inline Result<void> tryWriteValue(T& serverOrClient, const NodeId& id, const Variant& value) {
+    using Handler = detail::AttributeHandler<AttributeId::Value>;
+    return tryWriteAttribute(serverOrClient, id, AttributeId::Value, Handler::toDataValue(value));
+}
+
+/**
+ * Write the AttributeId::Value attribute of a node as a DataValue object without exceptions.
+ * @see tryWriteAttribute
+ * @ingroup Write
+ */
+template <typename T>
+inline Result<void> tryWriteDataValue(T& serverOrClient, const NodeId& id, const DataValue& value) {
+    return tryWriteAttribute(serverOrClient, id, AttributeId::Value, value);
+}
+
 /**
  * @}
  */
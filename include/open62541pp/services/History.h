@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include "open62541pp/Common.h"  // TimestampsToReturn
+#include "open62541pp/Span.h"
+#include "open62541pp/types/Builtin.h"  // StatusCode
+#include "open62541pp/types/DateTime.h"
+#include "open62541pp/types/NodeId.h"
+#include "open62541pp/types/Variant.h"
+
+// forward declarations
+namespace opcua {
+class Client;
+}  // namespace opcua
+
+namespace opcua::services {
+
+/**
+ * @defgroup History Attribute service set (historical access)
+ * Read historical values of variable nodes.
+ * @see https://reference.opcfoundation.org/Core/Part4/v105/docs/5.10.3
+ * @see https://reference.opcfoundation.org/Core/Part11/v105/docs/6.4.3
+ * @ingroup Services
+ * @{
+ */
+
+/**
+ * Options of historyReadRaw.
+ */
+struct HistoryReadRawOptions {
+    /// Beginning of the time range.
+    DateTime startTime;
+    /// End of the time range. Values are returned in reverse order if `endTime < startTime`.
+    DateTime endTime;
+    /// Maximum number of values per node and response, further values are requested with
+    /// continuation points (0: no limit, the server might limit the number anyway).
+    uint32_t numValuesPerNode = 1000;
+    /// Return the bounding values of the time range.
+    bool returnBounds = false;
+    TimestampsToReturn timestampsToReturn = TimestampsToReturn::Source;
+    /// Maximum number of nodes (or continuation points) per request.
+    /// The server's operation limit `MaxNodesPerHistoryReadData` is respected as well.
+    size_t maxNodesPerRequest = 64;
+    /// Maximum number of HistoryRead requests in flight.
+    size_t maxRequestsInFlight = 2;
+};
+
+/**
+ * Columnar batch of raw historical values of one node, as received in one response.
+ * The columns are only valid within the callback, values can be moved out.
+ */
+struct HistoryReadBatch {
+    size_t nodeIndex;  ///< Index of the node in the requested node ids
+    StatusCode status;  ///< Status of the node's result, the columns are empty if bad
+    Span<Variant> values;
+    Span<const StatusCode> statusCodes;
+    Span<const DateTime> sourceTimestamps;
+    Span<const DateTime> serverTimestamps;
+    bool last;  ///< No further batches of the node follow
+};
+
+/// Callback of historyReadRaw with a batch of values.
+using HistoryReadRawCallback = std::function<void(const HistoryReadBatch& batch)>;
+
+/**
+ * Read raw historical values of many nodes and stream them in batches (client only).
+ *
+ * The nodes are requested in chunks of `maxNodesPerRequest`. Continuation points are followed
+ * automatically: the next request is sent before the batches of a response are passed to the
+ * callback, so the server prepares the next batch while the current batch is processed. Only one
+ * response per request is kept in memory, the values are moved into the columns of the batch.
+ * Continuation points left after an error or exception are released.
+ *
+ * The client is iterated (Client::runIterate) until all values are read. Use
+ * historyReadRawAsync with a client running in a background network thread.
+ *
+ * @param connection Instance of type Client
+ * @param ids Variable nodes to read
+ * @param options Time range and request options
+ * @param callback Callback invoked for every batch
+ * @return Number of read values
+ * @exception BadStatus If a HistoryRead request failed
+ */
+size_t historyReadRaw(
+    Client& connection,
+    Span<const NodeId> ids,
+    const HistoryReadRawOptions& options,
+    const HistoryReadRawCallback& callback
+);
+
+/**
+ * Asynchronously read raw historical values of many nodes and stream them in batches.
+ * The batches are passed to the callback as the responses arrive in the client's event loop.
+ * Exceptions of the callback stop the read.
+ * @copydetails historyReadRaw
+ * @param onComplete Callback invoked once with the final status and the number of read values
+ */
+void historyReadRawAsync(
+    Client& connection,
+    Span<const NodeId> ids,
+    const HistoryReadRawOptions& options,
+    HistoryReadRawCallback callback,
+    std::function<void(StatusCode status, size_t count)> onComplete
+);
+
+/**
+ * @}
+ */
+
+}  // namespace opcua::services
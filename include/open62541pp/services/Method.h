@@ -5,11 +5,13 @@
 
 #include "open62541pp/Client.h"
 #include "open62541pp/Config.h"
+#include "open62541pp/Result.h"
 #include "open62541pp/Span.h"
 #include "open62541pp/async.h"
 #include "open62541pp/services/detail/ClientService.h"
 #include "open62541pp/services/detail/RequestHandling.h"
 #include "open62541pp/services/detail/ResponseHandling.h"
+#include "open62541pp/types/Composed.h"
 #include "open62541pp/types/NodeId.h"
 #include "open62541pp/types/Variant.h"
 
@@ -51,6 +53,24 @@ std::vector<Variant> call(
     Span<const Variant> inputArguments
 );
 
+/**
+ * Call a server method without exceptions.
+ * Bad status codes of the service, the method and the input arguments are returned in the Result
+ * instead of being thrown as BadStatus (see services::tryReadAttribute).
+ *
+ * @param serverOrClient Instance of type Server or Client
+ * @param objectId NodeId of the object on which the method is invoked
+ * @param methodId NodeId of the method to invoke
+ * @param inputArguments Input argument values
+ */
+template <typename T>
+Result<std::vector<Variant>> tryCall(
+    T& serverOrClient,
+    const NodeId& objectId,
+    const NodeId& methodId,
+    Span<const Variant> inputArguments
+);
+
 /**
  * Asynchronously call a server method and return results.
  *
@@ -83,6 +103,39 @@ auto callAsync(
     );
 }
 
+/**
+ * Call multiple server methods in a single Call service request (client only).
+ * The request is split into chunks if it exceeds the server's operation limit
+ * `MaxNodesPerMethodCall` (Client::getOperationLimits).
+ * Each result contains the status code and the output arguments of the method invocation in the
+ * order of the requests.
+ *
+ * @param client Instance of type Client
+ * @param methodsToCall Methods to call with their object ids and input arguments
+ * @exception BadStatus If the service call failed
+ */
+CallResponse callMany(Client& client, Span<const CallMethodRequest> methodsToCall);
+
+/**
+ * Asynchronously call multiple server methods in a single Call service request (client only).
+ * The request is sent as a whole, without splitting it within the operation limits.
+ *
+ * @param client Instance of type Client
+ * @param methodsToCall Methods to call with their object ids and input arguments
+ * @param token @completiontoken{void(opcua::StatusCode, opcua::CallResponse&)}
+ */
+template <typename CompletionToken = DefaultCompletionToken>
+auto callManyAsync(
+    Client& client,
+    Span<const CallMethodRequest> methodsToCall,
+    CompletionToken&& token = DefaultCompletionToken()
+) {
+    const auto request = detail::createCallRequest(methodsToCall);
+    return detail::sendRequest<UA_CallRequest, UA_CallResponse>(
+        client, request, detail::WrapResponse<CallResponse>{}, std::forward<CompletionToken>(token)
+    );
+}
+
 /**
  * @}
  * @}
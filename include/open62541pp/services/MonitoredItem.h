@@ -2,10 +2,14 @@
 
 #include <cstdint>
 #include <functional>
+#include <vector>
 
 #include "open62541pp/Common.h"
 #include "open62541pp/Config.h"
 #include "open62541pp/Span.h"
+#include "open62541pp/detail/HandlePool.h"
+#include "open62541pp/services/Subscription.h"  // DataChangeBatchCallback
+#include "open62541pp/types/Builtin.h"  // StatusCode
 #include "open62541pp/types/ExtensionObject.h"
 
 #ifdef UA_ENABLE_SUBSCRIPTIONS
@@ -70,6 +74,37 @@ struct MonitoringParameters {
     bool discardOldest = true;
 };
 
+/**
+ * Result of a monitored item in a batch operation.
+ */
+struct MonitoredItemResult {
+    /// Status code of the operation for this item.
+    StatusCode statusCode;
+    /// Server-assigned identifier of the monitored item.
+    uint32_t monitoredItemId = 0;
+    /// Dense client-side handle of the monitored item in the range [0, number of created items).
+    /// Handles of deleted items are reused, they can be used as indices of flat arrays.
+    uint32_t clientHandle = opcua::detail::HandlePool::invalid;
+    /// Monitoring parameters, revised by the server.
+    MonitoringParameters parameters;
+};
+
+/**
+ * Result of a subscription recreated by @ref recoverSubscriptions.
+ */
+struct RecoveredSubscription {
+    /// Identifier of the lost subscription.
+    uint32_t previousSubscriptionId = 0;
+    /// Identifier of the recreated subscription (`0` if the creation failed).
+    uint32_t subscriptionId = 0;
+    /// Status code of the subscription creation.
+    StatusCode statusCode;
+    /// Identifiers of the lost monitored items, in the order of `monitoredItems`.
+    std::vector<uint32_t> previousMonitoredItemIds;
+    /// Results of the recreated monitored items.
+    std::vector<MonitoredItemResult> monitoredItems;
+};
+
 /**
  * @defgroup CreateMonitoredItems
  * Create and add a monitored item to a subscription.
@@ -127,6 +162,33 @@ using EventNotificationCallback =
     DeleteMonitoredItemCallback deleteCallback = {}
 );
 
+/**
+ * Create and add many monitored items to a subscription for data change notifications.
+ * The items are created with one CreateMonitoredItems request, split into multiple requests if
+ * the number of items exceeds the server's `MaxMonitoredItemsPerCall` operation limit.
+ * All items share the monitoring mode, the requested parameters and the callbacks; the callbacks
+ * can distinguish the items by the monitored item identifier.
+ * Operations may fail for single items, check the status codes of the results.
+ *
+ * @param client Instance of type Client
+ * @param subscriptionId Identifier of the subscription returned by @ref createSubscription
+ * @param itemsToMonitor Items to monitor
+ * @param monitoringMode Monitoring mode
+ * @param parameters Requested monitoring parameters
+ * @param dataChangeCallback Invoked when a monitored item is changed
+ * @param deleteCallback Invoked when a monitored item is deleted
+ * @returns Results in the order of `itemsToMonitor`
+ */
+std::vector<MonitoredItemResult> createMonitoredItemsDataChange(
+    Client& client,
+    uint32_t subscriptionId,
+    Span<const ReadValueId> itemsToMonitor,
+    MonitoringMode monitoringMode,
+    const MonitoringParameters& parameters,
+    DataChangeNotificationCallback dataChangeCallback,
+    DeleteMonitoredItemCallback deleteCallback = {}
+);
+
 /**
  * Create a local monitored item for data change notifications.
  * Don't use this function to monitor the `EventNotifier` attribute.
@@ -147,6 +209,29 @@ using EventNotificationCallback =
     DataChangeNotificationCallback dataChangeCallback
 );
 
+/**
+ * Create many local monitored items for data change notifications with batched delivery.
+ * The data changes of all items are collected and delivered once per iteration of the server
+ * loop, after the iteration. Instead of one callback per item and change, the callback receives
+ * all notifications of the iteration in the order of the changes. The subscription identifier of
+ * the callback and the notifications is always `0`, the client handle is not assigned.
+ * Operations may fail for single items, check the status codes of the results.
+ *
+ * @param server Instance of type Server
+ * @param itemsToMonitor Items to monitor
+ * @param monitoringMode Monitoring mode
+ * @param parameters Requested monitoring parameters
+ * @param dataChangeBatchCallback Invoked in the server loop with the notifications
+ * @returns Results in the order of `itemsToMonitor`
+ */
+std::vector<MonitoredItemResult> createMonitoredItemsDataChange(
+    Server& server,
+    Span<const ReadValueId> itemsToMonitor,
+    MonitoringMode monitoringMode,
+    const MonitoringParameters& parameters,
+    DataChangeBatchCallback dataChangeBatchCallback
+);
+
 /**
  * Create and add a monitored item to a subscription for event notifications.
  * The `attributeId` of ReadValueId must be set to AttributeId::EventNotifier.
@@ -195,6 +280,24 @@ void modifyMonitoredItem(
     MonitoringParameters& parameters
 );
 
+/**
+ * Modify many monitored items of a subscription with the same parameters.
+ * The request is split into multiple requests if the number of items exceeds the server's
+ * `MaxMonitoredItemsPerCall` operation limit.
+ *
+ * @param client Instance of type Client
+ * @param subscriptionId Identifier of the subscription returned by @ref createSubscription
+ * @param monitoredItemIds Identifiers of the monitored items
+ * @param parameters Requested monitoring parameters
+ * @returns Results in the order of `monitoredItemIds`
+ */
+std::vector<MonitoredItemResult> modifyMonitoredItems(
+    Client& client,
+    uint32_t subscriptionId,
+    Span<const uint32_t> monitoredItemIds,
+    const MonitoringParameters& parameters
+);
+
 /**
  * @}
  * @defgroup SetMonitoringMode
@@ -215,6 +318,24 @@ void setMonitoringMode(
     Client& client, uint32_t subscriptionId, uint32_t monitoredItemId, MonitoringMode monitoringMode
 );
 
+/**
+ * Set the monitoring mode of many monitored items.
+ * The request is split into multiple requests if the number of items exceeds the server's
+ * `MaxMonitoredItemsPerCall` operation limit.
+ *
+ * @param client Instance of type Client
+ * @param subscriptionId Identifier of the subscription returned by @ref createSubscription
+ * @param monitoredItemIds Identifiers of the monitored items
+ * @param monitoringMode Monitoring mode
+ * @returns Status codes in the order of `monitoredItemIds`
+ */
+std::vector<StatusCode> setMonitoringMode(
+    Client& client,
+    uint32_t subscriptionId,
+    Span<const uint32_t> monitoredItemIds,
+    MonitoringMode monitoringMode
+);
+
 /**
  * @}
  * @defgroup SetTriggering
@@ -260,6 +381,20 @@ void setTriggering(
  */
 void deleteMonitoredItem(Client& client, uint32_t subscriptionId, uint32_t monitoredItemId);
 
+/**
+ * Delete many monitored items from a subscription.
+ * The request is split into multiple requests if the number of items exceeds the server's
+ * `MaxMonitoredItemsPerCall` operation limit.
+ *
+ * @param client Instance of type Client
+ * @param subscriptionId Identifier of the subscription returned by @ref createSubscription
+ * @param monitoredItemIds Identifiers of the monitored items
+ * @returns Status codes in the order of `monitoredItemIds`
+ */
+std::vector<StatusCode> deleteMonitoredItems(
+    Client& client, uint32_t subscriptionId, Span<const uint32_t> monitoredItemIds
+);
+
 /**
  * Delete a local monitored item.
  *
@@ -273,6 +408,22 @@ void deleteMonitoredItem(Server& server, uint32_t monitoredItemId);
  * @}
  */
 
+/**
+ * Recreate the subscriptions and monitored items that were lost with their session.
+ *
+ * Requires the recording of subscriptions with Client::enableSubscriptionRecovery. Subscriptions
+ * are lost if their client-side state was deleted, e.g. when open62541 created a new session
+ * after the server restarted or the session timed out. Each lost subscription is recreated with
+ * its (revised) parameters and callbacks, its monitored items with batched CreateMonitoredItems
+ * requests (one request per `MaxMonitoredItemsPerCall` chunk). The callbacks receive the new
+ * identifiers, the results map the previous to the new identifiers.
+ * Subscriptions that could not be recreated are retried on the next call.
+ *
+ * @param client Instance of type Client
+ * @returns Results of the recreated subscriptions
+ */
+std::vector<RecoveredSubscription> recoverSubscriptions(Client& client);
+
 }  // namespace opcua::services
 
 #endif
@@ -1,8 +1,10 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <string_view>
+#include <type_traits>  // enable_if_t, is_function_v
 #include <utility>  // exchange, forward
 
 #include "open62541pp/Client.h"
@@ -11,6 +13,7 @@
 #include "open62541pp/NodeIds.h"  // *TypeId
 #include "open62541pp/Span.h"
 #include "open62541pp/async.h"
+#include "open62541pp/detail/MethodBinding.h"
 #include "open62541pp/services/detail/ClientService.h"
 #include "open62541pp/services/detail/RequestHandling.h"
 #include "open62541pp/services/detail/ResponseHandling.h"
@@ -235,6 +238,22 @@ auto deleteNodesAsync(
 template <typename T>
 void deleteNode(T& serverOrClient, const NodeId& id, bool deleteReferences = true);
 
+/**
+ * Delete a node and all nodes of its subtree (server only).
+ *
+ * The subtree is collected once with browseRecursive (forward hierarchical references, including
+ * subtypes). Nodes with a hierarchical parent outside of the subtree (e.g. a node organized by
+ * another folder as well) are kept with their descendants, as are nodes of namespace zero. The
+ * nodes are deleted in one pass in reverse discovery order, children before their parents, so no
+ * delete has to remove children recursively. The node contexts of the deleted nodes are erased
+ * in one bulk operation afterwards.
+ * @return Number of deleted nodes (including the root node)
+ * @exception BadStatus (BadNodeIdUnknown) If the root node does not exist
+ * @exception BadStatus If a node can not be deleted (status code of the first failure). The
+ *            remaining nodes are deleted anyway.
+ */
+size_t deleteSubtree(Server& server, const NodeId& rootId);
+
 /**
  * Asynchronously delete node.
  * @copydetails deleteNode
@@ -584,6 +603,62 @@ NodeId addMethod(
     const NodeId& referenceType = ReferenceTypeId::HasComponent
 );
 
+/**
+ * Add method with a typed callback.
+ * The input and output arguments are derived from the signature `R(Args...)`: each parameter is a
+ * scalar input argument, the return value (if not `void`) the single output argument.
+ * Registered types (e.g. `int32_t`, `NodeId`) and convertible types (e.g. `std::string_view`) are
+ * supported. The data types of the input arguments are resolved once, each call only compares the
+ * type pointers of the input variants. Registered types are passed by reference to the callback,
+ * without copies.
+ * @code
+ * services::addMethod<double(int32_t, std::string_view)>(
+ *     server,
+ *     parentId,
+ *     id,
+ *     "scale",
+ *     [](int32_t value, std::string_view unit) { ... },
+ *     {"value", "unit"}
+ * );
+ * @endcode
+ * Calls with mismatching arguments are answered with `BadArgumentsMissing`, `BadTooManyArguments`
+ * or `BadInvalidArgument`.
+ * @tparam Signature Function signature of the method, e.g. `double(int32_t, std::string_view)`
+ * @param inputNames Names of the input arguments, unnamed arguments are numbered (arg1, arg2, ...)
+ * @param outputName Name of the output argument
+ */
+template <
+    typename Signature,
+    typename T,
+    typename F,
+    typename = std::enable_if_t<std::is_function_v<Signature>>>
+NodeId addMethod(
+    T& serverOrClient,
+    const NodeId& parentId,
+    const NodeId& id,
+    std::string_view browseName,
+    F&& callback,
+    Span<const std::string_view> inputNames = {},
+    std::string_view outputName = "result",
+    const MethodAttributes& attributes = {},
+    const NodeId& referenceType = ReferenceTypeId::HasComponent
+) {
+    using Binding = opcua::detail::MethodBinding<Signature>;
+    const auto inputArguments = Binding::createInputArguments(inputNames);
+    const auto outputArguments = Binding::createOutputArguments(outputName);
+    return addMethod(
+        serverOrClient,
+        parentId,
+        id,
+        browseName,
+        Binding::bind(std::forward<F>(callback)),
+        inputArguments,
+        outputArguments,
+        attributes,
+        referenceType
+    );
+}
+
 /**
  * Asynchronously add method.
  * @copydetails addMethod
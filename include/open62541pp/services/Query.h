@@ -0,0 +1,153 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <utility>  // forward
+
+#include "open62541pp/Client.h"
+#include "open62541pp/Config.h"
+#include "open62541pp/async.h"
+#include "open62541pp/services/detail/ClientService.h"
+#include "open62541pp/services/detail/ResponseHandling.h"
+#include "open62541pp/types/Composed.h"
+
+// forward declarations
+namespace opcua {
+class Server;
+}  // namespace opcua
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS  // ContentFilter
+
+namespace opcua::services {
+
+/**
+ * @defgroup Query Query service set
+ * Query nodes by type definition and attribute values, evaluated by the server.
+ *
+ * The open62541 stack does not implement the Query service set, requests to open62541 servers
+ * fail with `BadServiceUnsupported`. The client functions work with servers that implement it.
+ * The server functions evaluate queries locally with the AddressSpaceIndex: candidates are looked
+ * up by type definition (within the subtree of the view node, if any) and filtered with the
+ * content filter. Supported filter operators are `Equals`, `IsNull`, `GreaterThan`, `LessThan`,
+ * `GreaterThanOrEqual`, `LessThanOrEqual`, `Like`, `Not`, `Between`, `InList`, `And`, `Or` and
+ * `OfType`. Attribute operands are resolved relative to the evaluated node.
+ *
+ * @see https://reference.opcfoundation.org/Core/Part4/v105/docs/5.9
+ * @ingroup Services
+ * @{
+ */
+
+/**
+ * @defgroup QueryFirst
+ * Issue a query request, further results are requested with @ref queryNext.
+ * @see https://reference.opcfoundation.org/Core/Part4/v105/docs/5.9.3
+ * @{
+ */
+
+/**
+ * Issue a query request (client only).
+ * @param connection Instance of type Client
+ * @param request QueryFirst request
+ */
+QueryFirstResponse queryFirst(Client& connection, const QueryFirstRequest& request);
+
+/**
+ * Asynchronously issue a query request (client only).
+ * @copydetails queryFirst(Client&, const QueryFirstRequest&)
+ * @param token @completiontoken{void(opcua::StatusCode, opcua::QueryFirstResponse&)}
+ */
+template <typename CompletionToken = DefaultCompletionToken>
+auto queryFirstAsync(
+    Client& connection,
+    const QueryFirstRequest& request,
+    CompletionToken&& token = DefaultCompletionToken()
+) {
+    return detail::sendRequest<UA_QueryFirstRequest, UA_QueryFirstResponse>(
+        connection,
+        request,
+        detail::WrapResponse<QueryFirstResponse>{},
+        std::forward<CompletionToken>(token)
+    );
+}
+
+/**
+ * Evaluate a query request with the server's address space index (server only).
+ * The `maxReferencesToReturn` parameter is ignored, data sets contain no references.
+ * Errors are reported in the response header and the parsing / filter results.
+ * @param connection Instance of type Server
+ * @param request QueryFirst request
+ */
+QueryFirstResponse queryFirst(Server& connection, const QueryFirstRequest& request);
+
+/**
+ * @}
+ * @defgroup QueryNext
+ * Request the next set of a QueryFirst or QueryNext response.
+ * @see https://reference.opcfoundation.org/Core/Part4/v105/docs/5.9.4
+ * @{
+ */
+
+/**
+ * Request the next data sets of @ref queryFirst / @ref queryNext responses (client only).
+ * @param connection Instance of type Client
+ * @param request QueryNext request
+ */
+QueryNextResponse queryNext(Client& connection, const QueryNextRequest& request);
+
+/**
+ * Asynchronously request the next data sets of @ref queryFirst / @ref queryNext responses
+ * (client only).
+ * @copydetails queryNext(Client&, const QueryNextRequest&)
+ * @param token @completiontoken{void(opcua::StatusCode, opcua::QueryNextResponse&)}
+ */
+template <typename CompletionToken = DefaultCompletionToken>
+auto queryNextAsync(
+    Client& connection,
+    const QueryNextRequest& request,
+    CompletionToken&& token = DefaultCompletionToken()
+) {
+    return detail::sendRequest<UA_QueryNextRequest, UA_QueryNextResponse>(
+        connection,
+        request,
+        detail::WrapResponse<QueryNextResponse>{},
+        std::forward<CompletionToken>(token)
+    );
+}
+
+/**
+ * Request the next data sets of a local query (server only).
+ * The server keeps at most 16 continuation points, the oldest one is released if exceeded.
+ * @param connection Instance of type Server
+ * @param request QueryNext request
+ */
+QueryNextResponse queryNext(Server& connection, const QueryNextRequest& request);
+
+/**
+ * @}
+ */
+
+/// Callback of queryAll, data sets can be moved out.
+using QueryDataSetCallback = std::function<void(QueryDataSet& dataSet)>;
+
+/**
+ * Issue a query request and stream all data sets.
+ * Further data sets are requested with QueryNext until the continuation point is exhausted, so
+ * only one response is held in memory. The continuation point is released if the callback throws.
+ * @param connection Instance of type Server or Client
+ * @param request QueryFirst request, `maxDataSetsToReturn` defines the page size
+ * @param callback Callback invoked for each data set
+ * @return Number of data sets
+ * @exception BadStatus If the service or a parsing result fails
+ */
+template <typename T>
+size_t queryAll(
+    T& connection, const QueryFirstRequest& request, const QueryDataSetCallback& callback
+);
+
+/**
+ * @}
+ */
+
+}  // namespace opcua::services
+
+#endif
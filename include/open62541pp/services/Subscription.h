@@ -4,6 +4,9 @@
 #include <functional>
 
 #include "open62541pp/Config.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/detail/HandlePool.h"
+#include "open62541pp/types/DataValue.h"
 
 #ifdef UA_ENABLE_SUBSCRIPTIONS
 
@@ -61,20 +64,51 @@ struct SubscriptionParameters {
  */
 using DeleteSubscriptionCallback = std::function<void(uint32_t subId)>;
 
+/**
+ * Data change notification of a monitored item, delivered in batches.
+ * The value is moved out of the publish response, no copy is made.
+ */
+struct MonitoredItemNotification {
+    /// Identifier of the subscription.
+    uint32_t subscriptionId = 0;
+    /// Identifier of the monitored item.
+    uint32_t monitoredItemId = 0;
+    /// Dense client-side handle of the monitored item, see MonitoredItemResult::clientHandle.
+    uint32_t clientHandle = opcua::detail::HandlePool::invalid;
+    /// Changed value
+    DataValue value;
+};
+
+/**
+ * Batched data change notification callback of a subscription.
+ * The notifications are discarded after the callback, their values may be moved.
+ * @param subId Subscription identifier
+ * @param notifications Data change notifications of all monitored items since the last batch
+ */
+using DataChangeBatchCallback =
+    std::function<void(uint32_t subId, Span<MonitoredItemNotification> notifications)>;
+
 /**
  * Create a subscription.
  * @copydetails SubscriptionParameters
+ *
+ * If a `dataChangeBatchCallback` is set, the data change notifications of all monitored items of
+ * the subscription are collected and delivered with one call per client iteration (see
+ * Client::runIterate) instead of the callbacks of the single monitored items.
+ *
  * @param client Instance of type Client
  * @param parameters Subscription parameters, may be revised by server
  * @param publishingEnabled Enable/disable publishing of the subscription
  * @param deleteCallback Invoked when the subscription is deleted
+ * @param dataChangeBatchCallback Invoked with the batched data change notifications (optional)
  * @returns Server-assigned identifier of the subscription
  */
 [[nodiscard]] uint32_t createSubscription(
     Client& client,
     SubscriptionParameters& parameters,
     bool publishingEnabled = true,
-    DeleteSubscriptionCallback deleteCallback = {}
+    DeleteSubscriptionCallback deleteCallback = {},
+    DataChangeBatchCallback dataChangeBatchCallback = {}
 );
 
 /**
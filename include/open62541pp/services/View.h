@@ -1,11 +1,20 @@
 #pragma once
 
+#include <cassert>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <iterator>  // input_iterator_tag
+#include <unordered_map>
+#include <utility>  // move
 #include <vector>
 
+#include "open62541pp/Bitmask.h"
 #include "open62541pp/Client.h"
+#include "open62541pp/ErrorHandling.h"
 #include "open62541pp/Span.h"
 #include "open62541pp/async.h"
+#include "open62541pp/detail/ScopeExit.h"
 #include "open62541pp/open62541.h"
 #include "open62541pp/services/detail/ClientService.h"
 #include "open62541pp/services/detail/RequestHandling.h"
@@ -379,6 +388,259 @@ std::vector<ReferenceDescription> browseAll(
     return refs;
 }
 
+/**
+ * Input range over the references of a node, fetching the pages on demand.
+ *
+ * Only the current page of references is held in memory: the next page is requested with
+ * @ref browseNext when the iterator reaches the end of the current page. Callers can stop early,
+ * an open continuation point is released when the range is destroyed.
+ * The range can be iterated once. Create it with @ref browseRange.
+ * @ingroup Browse
+ */
+template <typename T>
+class BrowseRange {
+public:
+    class iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = ReferenceDescription;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ReferenceDescription*;
+        using reference = ReferenceDescription&;
+
+        iterator() noexcept = default;
+
+        reference operator*() const noexcept {
+            return range_->page_.getReferences()[range_->index_];
+        }
+
+        pointer operator->() const noexcept {
+            return &operator*();
+        }
+
+        iterator& operator++() {
+            if (!range_->advance()) {
+                range_ = nullptr;
+            }
+            return *this;
+        }
+
+        void operator++(int) {
+            ++*this;
+        }
+
+        bool operator==(const iterator& other) const noexcept {
+            return range_ == other.range_;
+        }
+
+        bool operator!=(const iterator& other) const noexcept {
+            return !(*this == other);
+        }
+
+    private:
+        friend class BrowseRange;
+
+        explicit iterator(BrowseRange* range) noexcept
+            : range_(range) {}
+
+        BrowseRange* range_{nullptr};
+    };
+
+    BrowseRange(T& connection, BrowseDescription bd, uint32_t maxReferencesPerPage)
+        : connection_(connection),
+          bd_(std::move(bd)),
+          maxReferencesPerPage_(maxReferencesPerPage) {}
+
+    ~BrowseRange() {
+        if (!page_.getContinuationPoint().empty()) {
+            try {
+                browseNext(connection_, true, page_.getContinuationPoint());  // release
+            } catch (...) {  // NOLINT(bugprone-empty-catch)
+            }
+        }
+    }
+
+    BrowseRange(const BrowseRange&) = delete;
+    BrowseRange(BrowseRange&&) = delete;
+    BrowseRange& operator=(const BrowseRange&) = delete;
+    BrowseRange& operator=(BrowseRange&&) = delete;
+
+    /**
+     * Browse the first page and return an iterator to the first reference.
+     * @exception BadStatus If the browse failed
+     */
+    iterator begin() {
+        assert(!started_ && "BrowseRange can only be iterated once");
+        started_ = true;
+        page_ = browse(connection_, bd_, maxReferencesPerPage_);
+        throwIfBad(page_.getStatusCode());
+        index_ = 0;
+        return (index_ < page_.getReferences().size() || nextPage()) ? iterator(this) : end();
+    }
+
+    iterator end() noexcept {
+        return {};
+    }
+
+private:
+    bool advance() {
+        ++index_;
+        return index_ < page_.getReferences().size() || nextPage();
+    }
+
+    /// Request pages until a non-empty page is received, `false` if all pages were consumed.
+    bool nextPage() {
+        while (!page_.getContinuationPoint().empty()) {
+            page_ = browseNext(connection_, false, page_.getContinuationPoint());
+            throwIfBad(page_.getStatusCode());
+            index_ = 0;
+            if (!page_.getReferences().empty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    T& connection_;
+    BrowseDescription bd_;
+    uint32_t maxReferencesPerPage_;
+    BrowseResult page_;
+    size_t index_{0};
+    bool started_{false};
+};
+
+/**
+ * Discover the references of a specified node lazily, page by page.
+ *
+ * @code
+ * for (auto& ref : services::browseRange(client, bd)) {
+ *     if (ref.getBrowseName() == QualifiedName(1, "Target")) {
+ *         break;  // remaining pages are not requested
+ *     }
+ * }
+ * @endcode
+ *
+ * @param connection Instance of type Server or Client
+ * @param bd Browse description
+ * @param maxReferencesPerPage The maximum number of references per page, i.e. in memory
+ *                             (0 if no limit)
+ * @exception BadStatus If the browse failed (on iteration)
+ * @ingroup Browse
+ */
+template <typename T>
+BrowseRange<T> browseRange(
+    T& connection, const BrowseDescription& bd, uint32_t maxReferencesPerPage = 1000
+) {
+    return {connection, bd, maxReferencesPerPage};
+}
+
+/**
+ * Discover all the references of a specified node into a projection (without calling
+ * @ref browseNext).
+ *
+ * Instead of copying every ReferenceDescription into a vector (like @ref browseAll), the
+ * references are passed one by one to the projection, which extracts only the fields it needs.
+ * The projection may move the fields out of the passed reference. The result mask of the
+ * BrowseDescription is replaced by the mask of the projection, so the server does not encode
+ * unused fields like display names or type definitions. Exceptions of the projection are
+ * propagated, the continuation point is released.
+ *
+ * The projection must provide:
+ * - `static constexpr Bitmask<BrowseResultMask> resultMask` (requested fields)
+ * - `void add(ReferenceDescription& ref)`
+ *
+ * @param connection Instance of type Server or Client
+ * @param bd Browse description, the result mask is ignored
+ * @param sink Projection, e.g. BrowseProjection
+ * @param maxReferences The maximum number of references to return (0 if no limit)
+ * @return Number of references passed to the projection
+ * @exception BadStatus If the browse failed
+ * @ingroup Browse
+ */
+template <typename Projection, typename T>
+size_t browseInto(
+    T& connection, const BrowseDescription& bd, Projection& sink, uint32_t maxReferences = 0
+) {
+    BrowseDescription projected(bd);
+    projected->resultMask = Bitmask<BrowseResultMask>(Projection::resultMask).get();
+    size_t count = 0;
+    auto response = browse(connection, projected, maxReferences);
+    while (true) {
+        throwIfBad(response.getStatusCode());
+        // release the continuation point if the projection throws
+        auto releaseOnThrow = opcua::detail::ScopeExit([&]() noexcept {
+            if (!response.getContinuationPoint().empty()) {
+                try {
+                    browseNext(connection, true, response.getContinuationPoint());
+                } catch (...) {  // NOLINT(bugprone-empty-catch)
+                }
+            }
+        });
+        for (auto& ref : response.getReferences()) {
+            if ((maxReferences > 0) && (count >= maxReferences)) {
+                break;
+            }
+            sink.add(ref);
+            ++count;
+        }
+        releaseOnThrow.release();
+        if (response.getContinuationPoint().empty()) {
+            return count;
+        }
+        if ((maxReferences > 0) && (count >= maxReferences)) {
+            browseNext(connection, true, response.getContinuationPoint());  // release
+            return count;
+        }
+        response = browseNext(connection, false, response.getContinuationPoint());
+    }
+}
+
+/**
+ * Compact struct-of-arrays projection of browse results for @ref browseInto.
+ *
+ * Only the target node ids, node classes and browse names are requested. Browse names are
+ * interned: each distinct name is stored once in `browseNames` and referenced by index, which
+ * saves most of the memory when mirroring large trees with repeating names (e.g. `Value`,
+ * `EURange`). References to nodes of other servers are skipped.
+ * The projection can be reused for many browse calls, the results are appended.
+ * @ingroup Browse
+ */
+struct BrowseProjection {
+    static constexpr Bitmask<BrowseResultMask> resultMask =
+        BrowseResultMask::NodeClass | BrowseResultMask::BrowseName;
+
+    /// Target node ids.
+    std::vector<NodeId> nodeIds;
+    /// Node classes of the targets.
+    std::vector<NodeClass> nodeClasses;
+    /// Indices of the browse names of the targets into `browseNames`.
+    std::vector<uint32_t> browseNameIndices;
+    /// Distinct browse names.
+    std::vector<QualifiedName> browseNames;
+
+    /// Number of projected references.
+    size_t size() const noexcept {
+        return nodeIds.size();
+    }
+
+    /// Get the browse name of the i-th target.
+    const QualifiedName& getBrowseName(size_t i) const {
+        return browseNames.at(browseNameIndices.at(i));
+    }
+
+    /// Append the fields of a reference, the target node id is moved.
+    void add(ReferenceDescription& ref);
+
+    /// Clear the projected references and the interned browse names.
+    void clear() noexcept;
+
+private:
+    uint32_t intern(const QualifiedName& browseName);
+
+    // hash of the browse name -> indices into browseNames (equal names are compared on collision)
+    std::unordered_map<size_t, std::vector<uint32_t>> browseNameIndex_;
+};
+
 /**
  * Discover child nodes recursively (non-standard).
  *
@@ -388,7 +650,7 @@ std::vector<ReferenceDescription> browseAll(
  * NodeClass does not match. So it is possible, for example, to get all VariableNodes below a
  * certain ObjectNode, with additional objects in the hierarchy below.
  *
- * @note No implementation for `Client`.
+ * @note Use the callback overload for `Client`.
  *
  * @param connection Instance of type Server
  * @param bd Browse description
@@ -397,6 +659,56 @@ std::vector<ReferenceDescription> browseAll(
  */
 std::vector<ExpandedNodeId> browseRecursive(Server& connection, const BrowseDescription& bd);
 
+/**
+ * Options of the client-side browseRecursive.
+ * @ingroup Browse
+ */
+struct BrowseRecursiveOptions {
+    /// Maximum number of Browse and BrowseNext requests in flight.
+    size_t maxRequestsInFlight = 8;
+    /// Maximum number of nodes (or continuation points) per request.
+    /// The server's operation limit `MaxNodesPerBrowse` is respected as well.
+    size_t maxNodesPerRequest = 64;
+    /// Maximum number of references per node and request (0: no limit). Further references are
+    /// browsed with continuation points.
+    uint32_t maxReferencesPerNode = 0;
+};
+
+/// Callback of the client-side browseRecursive with the browsed node and one of its references.
+using BrowseRecursiveCallback =
+    std::function<void(const NodeId& sourceId, const ReferenceDescription& reference)>;
+
+/**
+ * Discover child nodes recursively with many Browse requests in flight (client only).
+ *
+ * The address space is crawled breadth-first. Each Browse request contains up to
+ * `maxNodesPerRequest` nodes, up to `maxRequestsInFlight` Browse and BrowseNext requests are sent
+ * at a time. Continuation points of the results are browsed concurrently with BrowseNext.
+ * Visited nodes are deduplicated with a hash set, every local node is browsed at most once.
+ *
+ * References are passed to the callback as their responses arrive, nothing is collected. Only
+ * references to nodes matching the `nodeClassMask` of the BrowseDescription are passed. Like the
+ * server implementation, nodes of other node classes are still recursed into.
+ * Nodes with bad browse results (e.g. `BadNodeIdUnknown`) are skipped.
+ *
+ * The client is iterated (Client::runIterate) until all nodes are browsed. Don't use this
+ * function with a client running in a background network thread.
+ *
+ * @param connection Instance of type Client
+ * @param bd Browse description of the start node, the direction and the reference types
+ * @param callback Callback invoked for every reference
+ * @param options Options to control the concurrency
+ * @return Number of discovered nodes, including the start node
+ * @exception BadStatus If a Browse or BrowseNext request failed
+ * @ingroup Browse
+ */
+size_t browseRecursive(
+    Client& connection,
+    const BrowseDescription& bd,
+    const BrowseRecursiveCallback& callback,
+    const BrowseRecursiveOptions& options = {}
+);
+
 /**
  * @}
  */
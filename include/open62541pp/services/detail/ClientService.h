@@ -1,51 +1,156 @@
 #pragma once
 
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <exception>  // current_exception
 #include <functional>  // invoke
+#include <memory>
+#include <optional>
 #include <tuple>
 #include <type_traits>
-#include <utility>  // forward
+#include <utility>  // as_const, declval, forward, move
+#include <vector>
 
 #include "open62541pp/Client.h"
 #include "open62541pp/ErrorHandling.h"
-#include "open62541pp/TypeRegistry.h"
+#include "open62541pp/RequestOptions.h"
+#include "open62541pp/Span.h"
 #include "open62541pp/async.h"
+#include "open62541pp/detail/BlockPool.h"
 #include "open62541pp/detail/ClientContext.h"
+#include "open62541pp/detail/ClientMetricsRecorder.h"
+#include "open62541pp/detail/DiagnosticsSampler.h"
 #include "open62541pp/detail/ExceptionCatcher.h"
 #include "open62541pp/detail/Result.h"
 #include "open62541pp/detail/ScopeExit.h"
 #include "open62541pp/open62541.h"
+#include "open62541pp/typeregistry/Services.h"  // request and response types
+#include "open62541pp/types/Builtin.h"  // DiagnosticInfo
+#include "open62541pp/types/Composed.h"  // ResponseHeader
 
 namespace opcua::services::detail {
 
+template <typename T, typename = void>
+struct HasResponseHeader : std::false_type {};
+
+template <typename T>
+struct HasResponseHeader<T, std::void_t<decltype(std::declval<T>().responseHeader)>>
+    : std::true_type {};
+
+template <typename T, typename = void>
+struct HasDiagnosticInfos : std::false_type {};
+
+template <typename T>
+struct HasDiagnosticInfos<T, std::void_t<decltype(std::declval<T>().diagnosticInfos)>>
+    : std::true_type {};
+
+/**
+ * Request diagnostics of sampled requests (see Client::setDiagnosticsSampling).
+ * The callable is invoked with the original request or a shallow copy with `returnDiagnostics`.
+ */
+template <typename Request, typename Response, typename Func>
+decltype(auto) withDiagnostics(Client& client, const Request& request, Func&& func) {
+    auto& sampler = opcua::detail::getContext(client).diagnostics;
+    if (sampler.isEnabled()) {
+        const auto service = opcua::detail::getClientServiceIndex<Response>();
+        if (const auto mask = sampler.sample(service, request)) {
+            Request copy = request;
+            copy.requestHeader.returnDiagnostics = *mask;
+            return std::invoke(std::forward<Func>(func), std::as_const(copy));
+        }
+    }
+    return std::invoke(std::forward<Func>(func), request);
+}
+
+/// Deliver the diagnostics of a response to the diagnostics callback, if returned by the server.
+template <typename Response>
+void deliverDiagnostics(UA_Client* client, const Response& response) noexcept {
+    if constexpr (HasResponseHeader<Response>::value) {
+        Span<const DiagnosticInfo> operationDiagnostics;
+        if constexpr (HasDiagnosticInfos<Response>::value) {
+            operationDiagnostics = Span<const DiagnosticInfo>(
+                asWrapper<DiagnosticInfo>(response.diagnosticInfos), response.diagnosticInfosSize
+            );
+        }
+        const auto& header = response.responseHeader;
+        if (client == nullptr ||
+            (operationDiagnostics.empty() &&
+             !opcua::detail::hasDiagnostics(header.serviceDiagnostics))) {
+            return;
+        }
+        auto& context = opcua::detail::getContext(client);
+        try {
+            const auto service = opcua::detail::getClientServiceName(
+                opcua::detail::getClientServiceIndex<Response>()
+            );
+            context.diagnostics.deliver(
+                {service, asWrapper<ResponseHeader>(header), operationDiagnostics},
+                context.exceptionCatcher
+            );
+        } catch (...) {
+            context.exceptionCatcher.setException(std::current_exception());
+        }
+    }
+}
+
 /**
  * Adapter to initiate open62541 async client operations with completion tokens.
  */
 template <typename Response>
 struct AsyncServiceAdapter {
+    using BlockPool = opcua::detail::BlockPool;
     using ExceptionCatcher = opcua::detail::ExceptionCatcher;
+    using RequestTrace = opcua::detail::RequestTrace;
+
+    /// Service result of a native response, `BadUnexpectedError` if the request failed.
+    static StatusCode getResponseStatus(const void* responsePtr) noexcept {
+        if (responsePtr == nullptr) {
+            return UA_STATUSCODE_BADUNEXPECTEDERROR;
+        }
+        if constexpr (HasResponseHeader<Response>::value) {
+            return static_cast<const Response*>(responsePtr)->responseHeader.serviceResult;
+        } else {
+            return UA_STATUSCODE_GOOD;
+        }
+    }
 
     template <typename Context>
     struct CallbackAndContext {
         UA_ClientAsyncServiceCallback callback;
-        std::unique_ptr<Context> context;
+        opcua::detail::PooledPtr<Context> context;
     };
 
+    /// The context (including the completion handler) is stored in blocks of the client's pool.
+    /// The trace of the request (metrics, spans) is ended with the service result of the response.
     template <typename CompletionHandler, typename TransformResponse>
     static auto createCallbackAndContext(
+        BlockPool& pool,
         ExceptionCatcher& exceptionCatcher,
         TransformResponse&& transformResponse,
-        CompletionHandler&& completionHandler
+        CompletionHandler&& completionHandler,
+        RequestTrace trace = {}
     ) {
         static_assert(std::is_invocable_v<TransformResponse, Response&>);
         using TransformResult = std::invoke_result_t<TransformResponse, Response&>;
-        using Context = std::tuple<ExceptionCatcher&, TransformResponse, CompletionHandler>;
+        using Context = std::tuple<
+            BlockPool&,
+            ExceptionCatcher&,
+            RequestTrace,
+            TransformResponse,
+            CompletionHandler>;
 
-        auto callback = [](UA_Client*, void* userdata, uint32_t /* reqId */, void* responsePtr) {
+        auto callback = [](UA_Client* client, void* userdata, uint32_t, void* responsePtr) {
             assert(userdata != nullptr);
-            std::unique_ptr<Context> context{static_cast<Context*>(userdata)};
+            auto* contextPtr = static_cast<Context*>(userdata);
+            auto* pool = &std::get<BlockPool&>(*contextPtr);
+            opcua::detail::PooledPtr<Context> context{contextPtr, {pool}};
             auto& catcher = std::get<ExceptionCatcher&>(*context);
             auto& handler = std::get<CompletionHandler>(*context);
+            std::get<RequestTrace>(*context).end(getResponseStatus(responsePtr));
+            if (responsePtr != nullptr) {
+                deliverDiagnostics(client, *static_cast<const Response*>(responsePtr));
+            }
 
             auto result = [&]() -> opcua::detail::Result<TransformResult> {
                 if (responsePtr == nullptr) {
@@ -64,8 +169,11 @@ struct AsyncServiceAdapter {
 
         return CallbackAndContext<Context>{
             callback,
-            std::make_unique<Context>(
+            opcua::detail::makePooled<Context>(
+                pool,
+                pool,
                 exceptionCatcher,
+                std::move(trace),
                 std::forward<TransformResponse>(transformResponse),
                 std::forward<CompletionHandler>(completionHandler)
             )
@@ -93,17 +201,30 @@ struct AsyncServiceAdapter {
         return asyncInitiate<TransformResult>(
             [&](auto&& completionHandler, auto&& transform) {
                 // NOLINTNEXTLINE, false positive?
+                auto& context = opcua::detail::getContext(client);
                 auto callbackAndContext = createCallbackAndContext(
-                    opcua::detail::getContext(client).exceptionCatcher,
+                    context.contextPool,
+                    context.exceptionCatcher,
                     std::forward<decltype(transform)>(transform),
-                    std::forward<decltype(completionHandler)>(completionHandler)
+                    std::forward<decltype(completionHandler)>(completionHandler),
+                    RequestTrace::start<Response>(context.metrics, context.exceptionCatcher)
                 );
 
-                std::invoke(
-                    std::forward<Initiation>(initiation),
-                    callbackAndContext.callback,
-                    callbackAndContext.context.release()  // transfer ownership to callback
-                );
+                // initiations only throw if the callback is not invoked, the context is alive
+                auto& trace = std::get<RequestTrace>(*callbackAndContext.context);
+                try {
+                    std::invoke(
+                        std::forward<Initiation>(initiation),
+                        callbackAndContext.callback,
+                        callbackAndContext.context.release()  // transfer ownership to callback
+                    );
+                } catch (const BadStatus& e) {
+                    trace.end(e.code());
+                    throw;
+                } catch (...) {
+                    trace.end(UA_STATUSCODE_BADUNEXPECTEDERROR);
+                    throw;
+                }
             },
             std::forward<CompletionToken>(token),
             std::forward<TransformResponse>(transformResponse)
@@ -111,32 +232,204 @@ struct AsyncServiceAdapter {
     }
 };
 
+/**
+ * Substitute node ids registered with Client::registerNodes in read and write requests.
+ * The callable is invoked with the original request or a shallow copy with substituted node ids.
+ */
+template <typename Request, typename Func>
+decltype(auto) withRegisteredNodes(Client& client, const Request& request, Func&& func) {
+    constexpr bool isRead = std::is_same_v<Request, UA_ReadRequest>;
+    constexpr bool isWrite = std::is_same_v<Request, UA_WriteRequest>;
+    if constexpr (isRead || isWrite) {
+        const auto& registry = opcua::detail::getContext(client).registeredNodes;
+        if (!registry.empty()) {
+            auto* items = [&] {
+                if constexpr (isRead) {
+                    return request.nodesToRead;
+                } else {
+                    return request.nodesToWrite;
+                }
+            }();
+            const size_t size = isRead ? request.nodesToReadSize : request.nodesToWriteSize;
+            std::vector<std::remove_pointer_t<decltype(items)>> substituted(items, items + size);
+            bool found = false;
+            for (auto& item : substituted) {
+                const auto it = registry.find(asWrapper<NodeId>(item.nodeId));
+                if (it != registry.end() && it->second != it->first) {
+                    item.nodeId = *it->second.handle();  // shallow, alias owned by the registry
+                    found = true;
+                }
+            }
+            if (found) {
+                Request copy = request;
+                if constexpr (isRead) {
+                    copy.nodesToRead = substituted.data();
+                } else {
+                    copy.nodesToWrite = substituted.data();
+                }
+                return std::invoke(std::forward<Func>(func), std::as_const(copy));
+            }
+        }
+    }
+    return std::invoke(std::forward<Func>(func), request);
+}
+
+/**
+ * Completion handler of a request with RequestOptions.
+ * The handler is completed once, either by the response or by the cancellation token. It is
+ * released after the completion, late responses are discarded.
+ */
+template <typename CompletionHandler>
+struct CancellableHandler {
+    std::optional<CompletionHandler> handler;
+    std::optional<CancellationToken> cancellation;
+    size_t registration{0};
+
+    template <typename... Ts>
+    void complete(StatusCode code, Ts&&... result) {
+        if (!handler.has_value()) {
+            return;  // already completed by cancellation
+        }
+        auto completionHandler = std::move(*handler);
+        handler.reset();
+        if (cancellation.has_value() && registration != 0) {
+            cancellation->unregisterHandler(registration);
+        }
+        std::invoke(completionHandler, code, std::forward<Ts>(result)...);
+    }
+
+    /// Results without default constructor are completed by the server's response only.
+    template <typename Result>
+    void completeCancelled() {
+        if constexpr (std::is_void_v<Result>) {
+            complete(UA_STATUSCODE_BADREQUESTCANCELLEDBYCLIENT);
+        } else if constexpr (std::is_default_constructible_v<Result>) {
+            Result result{};
+            complete(UA_STATUSCODE_BADREQUESTCANCELLEDBYCLIENT, result);
+        }
+    }
+};
+
+/// Send the Cancel service request without waiting for the response.
+inline void sendCancelRequest(UA_Client* client, uint32_t requestHandle) noexcept {
+    UA_CancelRequest request{};
+    request.requestHandle = requestHandle;
+    __UA_Client_AsyncService(
+        client,
+        &request,
+        &UA_TYPES[UA_TYPES_CANCELREQUEST],
+        [](UA_Client*, void*, uint32_t, void*) {},
+        &UA_TYPES[UA_TYPES_CANCELRESPONSE],
+        nullptr,
+        nullptr
+    );
+}
+
+/// Request handles below the range of handles generated by open62541 (> 100000).
+inline uint32_t nextRequestHandle(uint32_t& lastRequestHandle) noexcept {
+    lastRequestHandle = (lastRequestHandle % 99999) + 1;
+    return lastRequestHandle;
+}
+
 template <typename Request, typename Response, typename TransformResponse, typename CompletionToken>
-auto sendRequest(
+auto sendRequestWithOptions(
     Client& client,
     const Request& request,
     TransformResponse&& transformResponse,
+    const RequestOptions& options,
     CompletionToken&& token
 ) {
-    return AsyncServiceAdapter<Response>::initiate(
-        client,
-        [&](UA_ClientAsyncServiceCallback callback, void* userdata) {
-            const auto status = __UA_Client_AsyncService(
-                client.handle(),
-                &request,
-                &getDataType<Request>(),
-                callback,
-                &getDataType<Response>(),
-                userdata,
-                nullptr
+    using TransformResult = std::invoke_result_t<TransformResponse, Response&>;
+    return asyncInitiate<TransformResult>(
+        [&](auto&& completionHandler, auto&& transform) {
+            using Handler = CancellableHandler<std::decay_t<decltype(completionHandler)>>;
+            auto handler = std::make_shared<Handler>(Handler{
+                std::forward<decltype(completionHandler)>(completionHandler),
+                options.cancellation,
+            });
+            AsyncServiceAdapter<Response>::initiate(
+                client,
+                [&](UA_ClientAsyncServiceCallback callback, void* userdata) {
+                    auto* native = client.handle();
+                    auto& context = opcua::detail::getContext(client);
+                    if (options.cancellation.has_value() && options.cancellation->isCancelled()) {
+                        handler->template completeCancelled<TransformResult>();
+                        callback(native, userdata, 0, nullptr);  // release context
+                        return;
+                    }
+                    Request copy = request;  // shallow copy to adjust the request header
+                    const auto timeout = static_cast<uint32_t>(options.timeout.count());
+                    copy.requestHeader.timeoutHint = timeout;
+                    if (options.cancellation.has_value()) {
+                        copy.requestHeader.requestHandle = nextRequestHandle(
+                            context.lastRequestHandle
+                        );
+                    }
+                    withDiagnostics<Request, Response>(client, copy, [&](const Request& sampled) {
+                        withRegisteredNodes(client, sampled, [&](const Request& substituted) {
+                            context.requestScheduler.submit<Request, Response>(
+                                native, substituted, callback, userdata, timeout
+                            );
+                        });
+                    });
+                    if (options.cancellation.has_value()) {
+                        handler->registration = handler->cancellation->registerHandler(
+                            [weak = std::weak_ptr<Handler>(handler),
+                             native,
+                             requestHandle = copy.requestHeader.requestHandle] {
+                                if (auto ptr = weak.lock()) {
+                                    sendCancelRequest(native, requestHandle);
+                                    ptr->template completeCancelled<TransformResult>();
+                                }
+                            }
+                        );
+                    }
+                },
+                std::forward<decltype(transform)>(transform),
+                [handler](StatusCode code, auto&&... result) {
+                    handler->complete(code, std::forward<decltype(result)>(result)...);
+                }
             );
-            throwIfBad(status);
         },
-        std::forward<TransformResponse>(transformResponse),
-        std::forward<CompletionToken>(token)
+        std::forward<CompletionToken>(token),
+        std::forward<TransformResponse>(transformResponse)
     );
 }
 
+template <typename Request, typename Response, typename TransformResponse, typename CompletionToken>
+auto sendRequest(
+    Client& client,
+    const Request& request,
+    TransformResponse&& transformResponse,
+    CompletionToken&& token
+) {
+    if constexpr (opcua::detail::isWithRequestOptions<CompletionToken>) {
+        return sendRequestWithOptions<Request, Response>(
+            client,
+            request,
+            std::forward<TransformResponse>(transformResponse),
+            token.options,
+            std::forward<CompletionToken>(token).token
+        );
+    } else {
+        return AsyncServiceAdapter<Response>::initiate(
+            client,
+            [&](UA_ClientAsyncServiceCallback callback, void* userdata) {
+                withDiagnostics<Request, Response>(client, request, [&](const Request& sampled) {
+                    withRegisteredNodes(client, sampled, [&](const Request& substituted) {
+                        auto& scheduler = opcua::detail::getContext(client).requestScheduler;
+                        scheduler.submit<Request, Response>(
+                            client.handle(), substituted, callback, userdata
+                        );
+                    });
+                });
+            },
+            std::forward<TransformResponse>(transformResponse),
+            std::forward<CompletionToken>(token)
+        );
+    }
+}
+
 /// Completion token for sync client operations.
 struct SyncOperation {};
 
@@ -153,9 +446,23 @@ static auto sendRequest(
         opcua::detail::clear(response, getDataType<Response>());
     });
 
-    __UA_Client_Service(
-        client.handle(), &request, &getDataType<Request>(), &response, &getDataType<Response>()
+    auto& context = opcua::detail::getContext(client);
+    auto trace = opcua::detail::RequestTrace::start<Response>(
+        context.metrics, context.exceptionCatcher
     );
+    withDiagnostics<Request, Response>(client, request, [&](const Request& sampled) {
+        withRegisteredNodes(client, sampled, [&](const Request& substituted) {
+            __UA_Client_Service(
+                client.handle(),
+                &substituted,
+                &getDataType<Request>(),
+                &response,
+                &getDataType<Response>()
+            );
+        });
+    });
+    trace.end(response.responseHeader.serviceResult);
+    deliverDiagnostics(client.handle(), response);
 
     return std::invoke(std::forward<TransformResponse>(transformResponse), response);
 }
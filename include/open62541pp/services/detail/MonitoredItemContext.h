@@ -1,27 +1,74 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <utility>  // exchange
+#include <variant>
 
+#include "open62541pp/Common.h"  // AttributeId
+#include "open62541pp/Config.h"
 #include "open62541pp/Span.h"
 #include "open62541pp/TypeWrapper.h"
+#include "open62541pp/detail/BlockPool.h"  // SlabAllocator
+#include "open62541pp/detail/HandlePool.h"
 #include "open62541pp/detail/Staleable.h"
 #include "open62541pp/services/detail/CallbackAdapter.h"
+#include "open62541pp/services/detail/SubscriptionContext.h"
 #include "open62541pp/types/Composed.h"
 #include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/NodeId.h"
 #include "open62541pp/types/Variant.h"
 
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
 // forward declare
 struct UA_Client;
 struct UA_Server;
 
 namespace opcua::services::detail {
 
+/**
+ * Context of a monitored item.
+ * Contexts are allocated in slabs (see SlabAllocator) to keep the contexts of many monitored items
+ * close in memory during the notification dispatch. Only the monitored node and attribute are
+ * stored, and either a data change or an event callback. Client monitored items record their
+ * statistics (see MonitoredItemStatistics) with lock-free counters.
+ */
 struct MonitoredItemContext : CallbackAdapter, opcua::detail::Staleable {
-    ReadValueId itemToMonitor;
-    std::function<void(uint32_t subId, uint32_t monId, const DataValue&)> dataChangeCallback;
-    std::function<void(uint32_t subId, uint32_t monId, Span<const Variant>)> eventCallback;
+    using DataChangeCallback =
+        std::function<void(uint32_t subId, uint32_t monId, const DataValue&)>;
+    using EventCallback = std::function<void(uint32_t subId, uint32_t monId, Span<const Variant>)>;
+
+    NodeId nodeId;
+    AttributeId attributeId{};
+    std::variant<std::monostate, DataChangeCallback, EventCallback> notificationCallback;
     std::function<void(uint32_t subId, uint32_t monId)> deleteCallback;
+    // dense client-side handle of client monitored items, released when the item is deleted
+    uint32_t clientHandle = opcua::detail::HandlePool::invalid;
+    opcua::detail::HandlePool* handlePool = nullptr;
+    MonitoredItemCounters statistics;
+
+    static void* operator new(size_t size) {
+        if (size != sizeof(MonitoredItemContext)) {
+            return ::operator new(size);
+        }
+        return getAllocator().allocate();
+    }
+
+    static void operator delete(void* ptr, size_t size) noexcept {
+        if (size != sizeof(MonitoredItemContext)) {
+            ::operator delete(ptr);
+            return;
+        }
+        getAllocator().deallocate(ptr);
+    }
+
+    static opcua::detail::SlabAllocator<MonitoredItemContext>& getAllocator() {
+        // never destroyed, contexts might outlive static objects
+        static auto* allocator = new opcua::detail::SlabAllocator<MonitoredItemContext>();
+        return *allocator;
+    }
 
     static void dataChangeCallbackNativeServer(
         [[maybe_unused]] UA_Server* server,
@@ -34,42 +81,73 @@ struct MonitoredItemContext : CallbackAdapter, opcua::detail::Staleable {
     ) noexcept {
         if (monContext != nullptr && value != nullptr) {
             auto* self = static_cast<MonitoredItemContext*>(monContext);
-            self->invoke(self->dataChangeCallback, 0U, monId, asWrapper<DataValue>(*value));
+            if (auto* callback = std::get_if<DataChangeCallback>(&self->notificationCallback)) {
+                self->invoke(*callback, 0U, monId, asWrapper<DataValue>(*value));
+            }
         }
     }
 
     static void dataChangeCallbackNativeClient(
         [[maybe_unused]] UA_Client* client,
         uint32_t subId,
-        [[maybe_unused]] void* subContext,
+        void* subContext,
         uint32_t monId,
         void* monContext,
         UA_DataValue* value
     ) noexcept {
-        if (monContext != nullptr && value != nullptr) {
-            auto* self = static_cast<MonitoredItemContext*>(monContext);
-            self->invoke(self->dataChangeCallback, subId, monId, asWrapper<DataValue>(*value));
+        auto* subscription = static_cast<SubscriptionContext*>(subContext);
+        auto* self = static_cast<MonitoredItemContext*>(monContext);
+        if (subscription != nullptr && value != nullptr) {
+            subscription->statistics->recordDataChange(
+                self != nullptr ? &self->statistics : nullptr, *value
+            );
+        }
+        // subscriptions with batched delivery collect the notifications of all monitored items
+        if (subscription != nullptr && subscription->batchCallback && value != nullptr) {
+            try {
+                subscription->enqueue(
+                    subId,
+                    monId,
+                    self != nullptr ? self->clientHandle : opcua::detail::HandlePool::invalid,
+                    *value
+                );
+            } catch (...) {
+                // drop notification if the batch can not grow
+            }
+            return;
+        }
+        if (self != nullptr && value != nullptr) {
+            if (auto* callback = std::get_if<DataChangeCallback>(&self->notificationCallback)) {
+                self->invoke(*callback, subId, monId, asWrapper<DataValue>(*value));
+            }
         }
     }
 
     static void eventCallbackNative(
         [[maybe_unused]] UA_Client* client,
         uint32_t subId,
-        [[maybe_unused]] void* subContext,
+        void* subContext,
         uint32_t monId,
         void* monContext,
         size_t nEventFields,
         UA_Variant* eventFields
     ) noexcept {
-        if (monContext != nullptr) {
-            auto* self = static_cast<MonitoredItemContext*>(monContext);
-            self->invoke(
-                self->eventCallback,
-                subId,
-                monId,
-                Span<const Variant>{asWrapper<Variant>(eventFields), nEventFields}
+        auto* self = static_cast<MonitoredItemContext*>(monContext);
+        if (auto* subscription = static_cast<SubscriptionContext*>(subContext)) {
+            subscription->statistics->recordNotification(
+                self != nullptr ? &self->statistics : nullptr
             );
         }
+        if (self != nullptr) {
+            if (auto* callback = std::get_if<EventCallback>(&self->notificationCallback)) {
+                self->invoke(
+                    *callback,
+                    subId,
+                    monId,
+                    Span<const Variant>{asWrapper<Variant>(eventFields), nEventFields}
+                );
+            }
+        }
     }
 
     static void deleteCallbackNative(
@@ -82,9 +160,16 @@ struct MonitoredItemContext : CallbackAdapter, opcua::detail::Staleable {
         if (monContext != nullptr) {
             auto* self = static_cast<MonitoredItemContext*>(monContext);
             self->invoke(self->deleteCallback, subId, monId);
-            self->stale = true;
+            if (self->handlePool != nullptr) {
+                self->handlePool->release(std::exchange(
+                    self->clientHandle, opcua::detail::HandlePool::invalid
+                ));
+            }
+            self->markStale();
         }
     }
 };
 
 }  // namespace opcua::services::detail
+
+#endif
@@ -97,6 +97,15 @@ inline UA_CallMethodRequest createCallMethodRequest(
     return request;
 }
 
+#ifdef UA_ENABLE_METHODCALLS
+inline UA_CallRequest createCallRequest(Span<const CallMethodRequest> methodsToCall) noexcept {
+    UA_CallRequest request{};
+    request.methodsToCallSize = methodsToCall.size();
+    request.methodsToCall = getNativePointer(methodsToCall);
+    return request;
+}
+#endif
+
 inline UA_BrowseRequest createBrowseRequest(
     const BrowseDescription& bd, uint32_t maxReferences
 ) noexcept {
@@ -1,12 +1,13 @@
 #pragma once
 
-#include <algorithm>  // for_each_n
+#include <algorithm>  // find_if, for_each_n
 #include <iterator>  // make_move_iterator
 #include <type_traits>
 #include <utility>  // exchange
 #include <vector>
 
 #include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Result.h"
 #include "open62541pp/Span.h"
 #include "open62541pp/TypeWrapper.h"  // isTypeWrapper
 #include "open62541pp/open62541.h"
@@ -68,6 +69,43 @@ inline auto getSingleResultMove(Response& response) {
     return std::exchange(getSingleResult(response), {});
 }
 
+/// Non-throwing check of the service result and the single result of a response.
+template <typename Response>
+inline StatusCode getSingleResultStatus(const Response& response) noexcept {
+    const StatusCode serviceResult = getServiceResult(response);
+    if (serviceResult.isBad()) {
+        return serviceResult;
+    }
+    if (response.results == nullptr || response.resultsSize != 1) {
+        return UA_STATUSCODE_BADUNEXPECTEDERROR;
+    }
+    return UA_STATUSCODE_GOOD;
+}
+
+/// Non-throwing variant of checkReadResult.
+inline StatusCode getReadResultStatus(const UA_DataValue& dv) noexcept {
+    if (dv.hasStatus && StatusCode(dv.status).isBad()) {
+        return dv.status;
+    }
+    if (!dv.hasValue) {
+        return UA_STATUSCODE_BADUNEXPECTEDERROR;
+    }
+    return dv.hasStatus ? dv.status : UA_STATUSCODE_GOOD;
+}
+
+/// Non-throwing variant of getReadResult.
+inline Result<DataValue> tryGetReadResult(UA_ReadResponse& response) noexcept {
+    if (const auto code = getSingleResultStatus(response); code.isBad()) {
+        return BadResult(code);
+    }
+    auto& result = *response.results;
+    const auto code = getReadResultStatus(result);
+    if (code.isBad()) {
+        return BadResult(code);
+    }
+    return {code, DataValue(std::exchange(result, {}))};
+}
+
 inline void checkReadResult(const UA_DataValue& dv) {
     if (dv.hasStatus) {
         throwIfBad(dv.status);
@@ -92,6 +130,28 @@ inline std::vector<Variant> getOutputArguments(UA_CallMethodResult& result) {
     };
 }
 
+/// Non-throwing variant of getOutputArguments.
+inline Result<std::vector<Variant>> tryGetOutputArguments(UA_CallMethodResult& result) {
+    if (StatusCode(result.statusCode).isBad()) {
+        return BadResult(result.statusCode);
+    }
+    const auto* inputResults = result.inputArgumentResults;
+    const auto* inputResultsEnd = inputResults + result.inputArgumentResultsSize;  // NOLINT
+    const auto* badInput = std::find_if(inputResults, inputResultsEnd, [](UA_StatusCode code) {
+        return StatusCode(code).isBad();
+    });
+    if (badInput != inputResultsEnd) {
+        return BadResult(*badInput);
+    }
+    return {
+        result.statusCode,
+        std::vector<Variant>(
+            std::make_move_iterator(result.outputArguments),
+            std::make_move_iterator(result.outputArguments + result.outputArgumentsSize)  // NOLINT
+        )
+    };
+}
+
 template <typename SubscriptionParameters, typename Response>
 inline void reviseSubscriptionParameters(
     SubscriptionParameters& parameters, const Response& response
@@ -1,28 +1,183 @@
 #pragma once
 
+#include <algorithm>  // max
+#include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <functional>
+#include <memory>
+#include <utility>  // exchange
+#include <vector>
 
+#include "open62541pp/Config.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/SubscriptionStatistics.h"
+#include "open62541pp/detail/MetricsRecorder.h"  // AtomicLatencyHistogram
 #include "open62541pp/detail/Staleable.h"
+#include "open62541pp/open62541.h"
+#include "open62541pp/services/Subscription.h"  // MonitoredItemNotification
 #include "open62541pp/services/detail/CallbackAdapter.h"
+#include "open62541pp/types/DataValue.h"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
 
 // forward declare
 struct UA_Client;
 
 namespace opcua::services::detail {
 
+/// Lock-free statistics of a monitored item, recorded by the native callbacks.
+/// Copyable (relaxed loads) to keep the monitored item contexts recyclable by the ContextMap.
+struct MonitoredItemCounters {
+    std::atomic<uint64_t> notifications{0};
+    std::atomic<uint64_t> overflows{0};
+    std::atomic<uint64_t> latencyCount{0};
+    std::atomic<int64_t> latencySum{0};  // nanoseconds
+    std::atomic<int64_t> latencyMax{0};  // nanoseconds
+
+    MonitoredItemCounters() = default;
+
+    MonitoredItemCounters(const MonitoredItemCounters& other) noexcept {
+        *this = other;
+    }
+
+    MonitoredItemCounters& operator=(const MonitoredItemCounters& other) noexcept {
+        constexpr auto relaxed = std::memory_order_relaxed;
+        notifications.store(other.notifications.load(relaxed), relaxed);
+        overflows.store(other.overflows.load(relaxed), relaxed);
+        latencyCount.store(other.latencyCount.load(relaxed), relaxed);
+        latencySum.store(other.latencySum.load(relaxed), relaxed);
+        latencyMax.store(other.latencyMax.load(relaxed), relaxed);
+        return *this;
+    }
+
+    ~MonitoredItemCounters() = default;
+
+    MonitoredItemStatistics snapshot() const noexcept {
+        MonitoredItemStatistics result;
+        result.notifications = notifications.load(std::memory_order_relaxed);
+        result.overflows = overflows.load(std::memory_order_relaxed);
+        result.latencyCount = latencyCount.load(std::memory_order_relaxed);
+        result.latencySum = std::chrono::nanoseconds(latencySum.load(std::memory_order_relaxed));
+        result.latencyMax = std::chrono::nanoseconds(latencyMax.load(std::memory_order_relaxed));
+        return result;
+    }
+};
+
+/// Lock-free statistics of a subscription, recorded by the native callbacks.
+struct SubscriptionCounters {
+    std::atomic<uint64_t> notifications{0};
+    std::atomic<uint64_t> overflows{0};
+    std::atomic<uint64_t> statusChanges{0};
+    std::atomic<uint64_t> inactivityTimeouts{0};
+    opcua::detail::AtomicLatencyHistogram latency;
+
+    /// Record a notification without value (e.g. an event) of a monitored item (optional).
+    void recordNotification(MonitoredItemCounters* item) noexcept {
+        notifications.fetch_add(1, std::memory_order_relaxed);
+        if (item != nullptr) {
+            item->notifications.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    /// Record a data change of a monitored item (optional).
+    /// The latency is measured from the source timestamp to the receipt by the client.
+    void recordDataChange(MonitoredItemCounters* item, const UA_DataValue& value) noexcept {
+        recordNotification(item);
+        // InfoType DataValue with Overflow bit, set if the server-side queue overflowed
+        constexpr UA_StatusCode overflowBits = 0x0480;
+        if ((value.status & overflowBits) == overflowBits) {
+            overflows.fetch_add(1, std::memory_order_relaxed);
+            if (item != nullptr) {
+                item->overflows.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        if (value.hasSourceTimestamp) {
+            // DateTime in 100 ns intervals, negative latencies (clock skew) are clamped to zero
+            const auto ticks = std::max<int64_t>(UA_DateTime_now() - value.sourceTimestamp, 0);
+            const int64_t nanoseconds = ticks * 100;
+            latency.record(std::chrono::nanoseconds(nanoseconds));
+            if (item != nullptr) {
+                item->latencyCount.fetch_add(1, std::memory_order_relaxed);
+                item->latencySum.fetch_add(nanoseconds, std::memory_order_relaxed);
+                auto max = item->latencyMax.load(std::memory_order_relaxed);
+                while (nanoseconds > max &&
+                       !item->latencyMax.compare_exchange_weak(max, nanoseconds)) {
+                }
+            }
+        }
+    }
+
+    SubscriptionStatistics snapshot() const noexcept {
+        SubscriptionStatistics result;
+        result.notifications = notifications.load(std::memory_order_relaxed);
+        result.overflows = overflows.load(std::memory_order_relaxed);
+        result.statusChanges = statusChanges.load(std::memory_order_relaxed);
+        result.inactivityTimeouts = inactivityTimeouts.load(std::memory_order_relaxed);
+        result.latency = latency.snapshot();
+        return result;
+    }
+};
+
 struct SubscriptionContext : CallbackAdapter, opcua::detail::Staleable {
     std::function<void(uint32_t subId)> deleteCallback;
+    // allocated separately to keep the context move-assignable (recycled by the ContextMap)
+    std::unique_ptr<SubscriptionCounters> statistics = std::make_unique<SubscriptionCounters>();
+
+    // batched delivery of data change notifications
+    std::function<void(uint32_t subId, Span<MonitoredItemNotification>)> batchCallback;
+    std::vector<MonitoredItemNotification> batch;
+    std::vector<uint32_t>* pendingBatches = nullptr;  // subscriptions with pending batches
+
+    /// Add a data change notification to the batch, the value is moved.
+    void enqueue(uint32_t subId, uint32_t monId, uint32_t clientHandle, UA_DataValue& value) {
+        if (batch.empty() && pendingBatches != nullptr) {
+            pendingBatches->push_back(subId);
+        }
+        batch.push_back({subId, monId, clientHandle, DataValue(std::exchange(value, {}))});
+    }
+
+    /// Deliver the batched notifications, the batch keeps its capacity.
+    void flush(uint32_t subId) noexcept {
+        if (!batch.empty()) {
+            invoke(batchCallback, subId, Span<MonitoredItemNotification>(batch));
+            batch.clear();
+        }
+    }
+
+    static void statusChangeCallbackNative(
+        [[maybe_unused]] UA_Client* client,
+        [[maybe_unused]] uint32_t subId,
+        void* subContext,
+        [[maybe_unused]] UA_StatusChangeNotification* notification
+    ) noexcept {
+        if (subContext != nullptr) {
+            auto* self = static_cast<SubscriptionContext*>(subContext);
+            self->statistics->statusChanges.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    static void inactivityCallbackNative(
+        [[maybe_unused]] UA_Client* client, [[maybe_unused]] uint32_t subId, void* subContext
+    ) noexcept {
+        if (subContext != nullptr) {
+            auto* self = static_cast<SubscriptionContext*>(subContext);
+            self->statistics->inactivityTimeouts.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
 
     static void deleteCallbackNative(
         [[maybe_unused]] UA_Client* client, uint32_t subId, void* subContext
     ) noexcept {
         if (subContext != nullptr) {
             auto* self = static_cast<SubscriptionContext*>(subContext);
+            self->flush(subId);
             self->invoke(self->deleteCallback, subId);
-            self->stale = true;
+            self->markStale();
         }
     }
 };
 
 }  // namespace opcua::services::detail
+
+#endif
@@ -1,9 +1,11 @@
 #pragma once
 
 #include "open62541pp/services/Attribute.h"
+#include "open62541pp/services/History.h"
 #include "open62541pp/services/Method.h"
 #include "open62541pp/services/MonitoredItem.h"
 #include "open62541pp/services/NodeManagement.h"
+#include "open62541pp/services/Query.h"
 #include "open62541pp/services/Subscription.h"
 #include "open62541pp/services/View.h"
 
@@ -0,0 +1,332 @@
+/* ---------------------------------------------------------------------------------------------- */
+/*                                   Generated - do not modify!                                   */
+/* ---------------------------------------------------------------------------------------------- */
+
+#pragma once
+
+#include "open62541pp/open62541.h"
+#include "open62541pp/typeregistry/Builtin.h"
+
+namespace opcua {
+
+// clang-format off
+
+#ifdef UA_TYPES_ADDNODESITEM
+UAPP_TYPEREGISTRY_NATIVE(UA_AddNodesItem, UA_TYPES_ADDNODESITEM)
+#endif
+#ifdef UA_TYPES_ADDNODESRESULT
+UAPP_TYPEREGISTRY_NATIVE(UA_AddNodesResult, UA_TYPES_ADDNODESRESULT)
+#endif
+#ifdef UA_TYPES_ADDREFERENCESITEM
+UAPP_TYPEREGISTRY_NATIVE(UA_AddReferencesItem, UA_TYPES_ADDREFERENCESITEM)
+#endif
+#ifdef UA_TYPES_AGGREGATECONFIGURATION
+UAPP_TYPEREGISTRY_NATIVE(UA_AggregateConfiguration, UA_TYPES_AGGREGATECONFIGURATION)
+#endif
+#ifdef UA_TYPES_AGGREGATEFILTER
+UAPP_TYPEREGISTRY_NATIVE(UA_AggregateFilter, UA_TYPES_AGGREGATEFILTER)
+#endif
+#ifdef UA_TYPES_ANONYMOUSIDENTITYTOKEN
+UAPP_TYPEREGISTRY_NATIVE(UA_AnonymousIdentityToken, UA_TYPES_ANONYMOUSIDENTITYTOKEN)
+#endif
+#ifdef UA_TYPES_APPLICATIONDESCRIPTION
+UAPP_TYPEREGISTRY_NATIVE(UA_ApplicationDescription, UA_TYPES_APPLICATIONDESCRIPTION)
+#endif
+#ifdef UA_TYPES_APPLICATIONTYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_ApplicationType, UA_TYPES_APPLICATIONTYPE)
+#endif
+#ifdef UA_TYPES_ARGUMENT
+UAPP_TYPEREGISTRY_NATIVE(UA_Argument, UA_TYPES_ARGUMENT)
+#endif
+#ifdef UA_TYPES_ATTRIBUTEOPERAND
+UAPP_TYPEREGISTRY_NATIVE(UA_AttributeOperand, UA_TYPES_ATTRIBUTEOPERAND)
+#endif
+#ifdef UA_TYPES_AXISINFORMATION
+UAPP_TYPEREGISTRY_NATIVE(UA_AxisInformation, UA_TYPES_AXISINFORMATION)
+#endif
+#ifdef UA_TYPES_AXISSCALEENUMERATION
+UAPP_TYPEREGISTRY_NATIVE(UA_AxisScaleEnumeration, UA_TYPES_AXISSCALEENUMERATION)
+#endif
+#ifdef UA_TYPES_BROWSEDESCRIPTION
+UAPP_TYPEREGISTRY_NATIVE(UA_BrowseDescription, UA_TYPES_BROWSEDESCRIPTION)
+#endif
+#ifdef UA_TYPES_BROWSEDIRECTION
+UAPP_TYPEREGISTRY_NATIVE(UA_BrowseDirection, UA_TYPES_BROWSEDIRECTION)
+#endif
+#ifdef UA_TYPES_BROWSEPATH
+UAPP_TYPEREGISTRY_NATIVE(UA_BrowsePath, UA_TYPES_BROWSEPATH)
+#endif
+#ifdef UA_TYPES_BROWSEPATHRESULT
+UAPP_TYPEREGISTRY_NATIVE(UA_BrowsePathResult, UA_TYPES_BROWSEPATHRESULT)
+#endif
+#ifdef UA_TYPES_BROWSEPATHTARGET
+UAPP_TYPEREGISTRY_NATIVE(UA_BrowsePathTarget, UA_TYPES_BROWSEPATHTARGET)
+#endif
+#ifdef UA_TYPES_BROWSERESULT
+UAPP_TYPEREGISTRY_NATIVE(UA_BrowseResult, UA_TYPES_BROWSERESULT)
+#endif
+#ifdef UA_TYPES_BROWSERESULTMASK
+UAPP_TYPEREGISTRY_NATIVE(UA_BrowseResultMask, UA_TYPES_BROWSERESULTMASK)
+#endif
+#ifdef UA_TYPES_BUILDINFO
+UAPP_TYPEREGISTRY_NATIVE(UA_BuildInfo, UA_TYPES_BUILDINFO)
+#endif
+#ifdef UA_TYPES_CALLMETHODRESULT
+UAPP_TYPEREGISTRY_NATIVE(UA_CallMethodResult, UA_TYPES_CALLMETHODRESULT)
+#endif
+#ifdef UA_TYPES_CHANNELSECURITYTOKEN
+UAPP_TYPEREGISTRY_NATIVE(UA_ChannelSecurityToken, UA_TYPES_CHANNELSECURITYTOKEN)
+#endif
+#ifdef UA_TYPES_COMPLEXNUMBERTYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_ComplexNumberType, UA_TYPES_COMPLEXNUMBERTYPE)
+#endif
+#ifdef UA_TYPES_CONTENTFILTER
+UAPP_TYPEREGISTRY_NATIVE(UA_ContentFilter, UA_TYPES_CONTENTFILTER)
+#endif
+#ifdef UA_TYPES_CONTENTFILTERELEMENT
+UAPP_TYPEREGISTRY_NATIVE(UA_ContentFilterElement, UA_TYPES_CONTENTFILTERELEMENT)
+#endif
+#ifdef UA_TYPES_CONTENTFILTERELEMENTRESULT
+UAPP_TYPEREGISTRY_NATIVE(UA_ContentFilterElementResult, UA_TYPES_CONTENTFILTERELEMENTRESULT)
+#endif
+#ifdef UA_TYPES_CONTENTFILTERRESULT
+UAPP_TYPEREGISTRY_NATIVE(UA_ContentFilterResult, UA_TYPES_CONTENTFILTERRESULT)
+#endif
+#ifdef UA_TYPES_DATACHANGEFILTER
+UAPP_TYPEREGISTRY_NATIVE(UA_DataChangeFilter, UA_TYPES_DATACHANGEFILTER)
+#endif
+#ifdef UA_TYPES_DATACHANGENOTIFICATION
+UAPP_TYPEREGISTRY_NATIVE(UA_DataChangeNotification, UA_TYPES_DATACHANGENOTIFICATION)
+#endif
+#ifdef UA_TYPES_DATACHANGETRIGGER
+UAPP_TYPEREGISTRY_NATIVE(UA_DataChangeTrigger, UA_TYPES_DATACHANGETRIGGER)
+#endif
+#ifdef UA_TYPES_DATATYPEATTRIBUTES
+UAPP_TYPEREGISTRY_NATIVE(UA_DataTypeAttributes, UA_TYPES_DATATYPEATTRIBUTES)
+#endif
+#ifdef UA_TYPES_DEADBANDTYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_DeadbandType, UA_TYPES_DEADBANDTYPE)
+#endif
+#ifdef UA_TYPES_DELETENODESITEM
+UAPP_TYPEREGISTRY_NATIVE(UA_DeleteNodesItem, UA_TYPES_DELETENODESITEM)
+#endif
+#ifdef UA_TYPES_DELETEREFERENCESITEM
+UAPP_TYPEREGISTRY_NATIVE(UA_DeleteReferencesItem, UA_TYPES_DELETEREFERENCESITEM)
+#endif
+#ifdef UA_TYPES_DOUBLECOMPLEXNUMBERTYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_DoubleComplexNumberType, UA_TYPES_DOUBLECOMPLEXNUMBERTYPE)
+#endif
+#ifdef UA_TYPES_EUINFORMATION
+UAPP_TYPEREGISTRY_NATIVE(UA_EUInformation, UA_TYPES_EUINFORMATION)
+#endif
+#ifdef UA_TYPES_ELEMENTOPERAND
+UAPP_TYPEREGISTRY_NATIVE(UA_ElementOperand, UA_TYPES_ELEMENTOPERAND)
+#endif
+#ifdef UA_TYPES_ENDPOINTDESCRIPTION
+UAPP_TYPEREGISTRY_NATIVE(UA_EndpointDescription, UA_TYPES_ENDPOINTDESCRIPTION)
+#endif
+#ifdef UA_TYPES_ENUMDEFINITION
+UAPP_TYPEREGISTRY_NATIVE(UA_EnumDefinition, UA_TYPES_ENUMDEFINITION)
+#endif
+#ifdef UA_TYPES_ENUMDESCRIPTION
+UAPP_TYPEREGISTRY_NATIVE(UA_EnumDescription, UA_TYPES_ENUMDESCRIPTION)
+#endif
+#ifdef UA_TYPES_ENUMFIELD
+UAPP_TYPEREGISTRY_NATIVE(UA_EnumField, UA_TYPES_ENUMFIELD)
+#endif
+#ifdef UA_TYPES_ENUMVALUETYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_EnumValueType, UA_TYPES_ENUMVALUETYPE)
+#endif
+#ifdef UA_TYPES_EVENTFIELDLIST
+UAPP_TYPEREGISTRY_NATIVE(UA_EventFieldList, UA_TYPES_EVENTFIELDLIST)
+#endif
+#ifdef UA_TYPES_EVENTFILTER
+UAPP_TYPEREGISTRY_NATIVE(UA_EventFilter, UA_TYPES_EVENTFILTER)
+#endif
+#ifdef UA_TYPES_EVENTFILTERRESULT
+UAPP_TYPEREGISTRY_NATIVE(UA_EventFilterResult, UA_TYPES_EVENTFILTERRESULT)
+#endif
+#ifdef UA_TYPES_EVENTNOTIFICATIONLIST
+UAPP_TYPEREGISTRY_NATIVE(UA_EventNotificationList, UA_TYPES_EVENTNOTIFICATIONLIST)
+#endif
+#ifdef UA_TYPES_FILTEROPERATOR
+UAPP_TYPEREGISTRY_NATIVE(UA_FilterOperator, UA_TYPES_FILTEROPERATOR)
+#endif
+#ifdef UA_TYPES_ISSUEDIDENTITYTOKEN
+UAPP_TYPEREGISTRY_NATIVE(UA_IssuedIdentityToken, UA_TYPES_ISSUEDIDENTITYTOKEN)
+#endif
+#ifdef UA_TYPES_KEYVALUEPAIR
+UAPP_TYPEREGISTRY_NATIVE(UA_KeyValuePair, UA_TYPES_KEYVALUEPAIR)
+#endif
+#ifdef UA_TYPES_LITERALOPERAND
+UAPP_TYPEREGISTRY_NATIVE(UA_LiteralOperand, UA_TYPES_LITERALOPERAND)
+#endif
+#ifdef UA_TYPES_MDNSDISCOVERYCONFIGURATION
+UAPP_TYPEREGISTRY_NATIVE(UA_MdnsDiscoveryConfiguration, UA_TYPES_MDNSDISCOVERYCONFIGURATION)
+#endif
+#ifdef UA_TYPES_MESSAGESECURITYMODE
+UAPP_TYPEREGISTRY_NATIVE(UA_MessageSecurityMode, UA_TYPES_MESSAGESECURITYMODE)
+#endif
+#ifdef UA_TYPES_METHODATTRIBUTES
+UAPP_TYPEREGISTRY_NATIVE(UA_MethodAttributes, UA_TYPES_METHODATTRIBUTES)
+#endif
+#ifdef UA_TYPES_MONITOREDITEMCREATERESULT
+UAPP_TYPEREGISTRY_NATIVE(UA_MonitoredItemCreateResult, UA_TYPES_MONITOREDITEMCREATERESULT)
+#endif
+#ifdef UA_TYPES_MONITOREDITEMMODIFYRESULT
+UAPP_TYPEREGISTRY_NATIVE(UA_MonitoredItemModifyResult, UA_TYPES_MONITOREDITEMMODIFYRESULT)
+#endif
+#ifdef UA_TYPES_MONITOREDITEMNOTIFICATION
+UAPP_TYPEREGISTRY_NATIVE(UA_MonitoredItemNotification, UA_TYPES_MONITOREDITEMNOTIFICATION)
+#endif
+#ifdef UA_TYPES_MONITORINGMODE
+UAPP_TYPEREGISTRY_NATIVE(UA_MonitoringMode, UA_TYPES_MONITORINGMODE)
+#endif
+#ifdef UA_TYPES_MONITORINGPARAMETERS
+UAPP_TYPEREGISTRY_NATIVE(UA_MonitoringParameters, UA_TYPES_MONITORINGPARAMETERS)
+#endif
+#ifdef UA_TYPES_NODEATTRIBUTES
+UAPP_TYPEREGISTRY_NATIVE(UA_NodeAttributes, UA_TYPES_NODEATTRIBUTES)
+#endif
+#ifdef UA_TYPES_NODEATTRIBUTESMASK
+UAPP_TYPEREGISTRY_NATIVE(UA_NodeAttributesMask, UA_TYPES_NODEATTRIBUTESMASK)
+#endif
+#ifdef UA_TYPES_NODECLASS
+UAPP_TYPEREGISTRY_NATIVE(UA_NodeClass, UA_TYPES_NODECLASS)
+#endif
+#ifdef UA_TYPES_NODETYPEDESCRIPTION
+UAPP_TYPEREGISTRY_NATIVE(UA_NodeTypeDescription, UA_TYPES_NODETYPEDESCRIPTION)
+#endif
+#ifdef UA_TYPES_NOTIFICATIONMESSAGE
+UAPP_TYPEREGISTRY_NATIVE(UA_NotificationMessage, UA_TYPES_NOTIFICATIONMESSAGE)
+#endif
+#ifdef UA_TYPES_OBJECTATTRIBUTES
+UAPP_TYPEREGISTRY_NATIVE(UA_ObjectAttributes, UA_TYPES_OBJECTATTRIBUTES)
+#endif
+#ifdef UA_TYPES_OBJECTTYPEATTRIBUTES
+UAPP_TYPEREGISTRY_NATIVE(UA_ObjectTypeAttributes, UA_TYPES_OBJECTTYPEATTRIBUTES)
+#endif
+#ifdef UA_TYPES_PARSINGRESULT
+UAPP_TYPEREGISTRY_NATIVE(UA_ParsingResult, UA_TYPES_PARSINGRESULT)
+#endif
+#ifdef UA_TYPES_QUERYDATADESCRIPTION
+UAPP_TYPEREGISTRY_NATIVE(UA_QueryDataDescription, UA_TYPES_QUERYDATADESCRIPTION)
+#endif
+#ifdef UA_TYPES_QUERYDATASET
+UAPP_TYPEREGISTRY_NATIVE(UA_QueryDataSet, UA_TYPES_QUERYDATASET)
+#endif
+#ifdef UA_TYPES_RANGE
+UAPP_TYPEREGISTRY_NATIVE(UA_Range, UA_TYPES_RANGE)
+#endif
+#ifdef UA_TYPES_READVALUEID
+UAPP_TYPEREGISTRY_NATIVE(UA_ReadValueId, UA_TYPES_READVALUEID)
+#endif
+#ifdef UA_TYPES_REDUNDANCYSUPPORT
+UAPP_TYPEREGISTRY_NATIVE(UA_RedundancySupport, UA_TYPES_REDUNDANCYSUPPORT)
+#endif
+#ifdef UA_TYPES_REFERENCEDESCRIPTION
+UAPP_TYPEREGISTRY_NATIVE(UA_ReferenceDescription, UA_TYPES_REFERENCEDESCRIPTION)
+#endif
+#ifdef UA_TYPES_REFERENCETYPEATTRIBUTES
+UAPP_TYPEREGISTRY_NATIVE(UA_ReferenceTypeAttributes, UA_TYPES_REFERENCETYPEATTRIBUTES)
+#endif
+#ifdef UA_TYPES_REGISTEREDSERVER
+UAPP_TYPEREGISTRY_NATIVE(UA_RegisteredServer, UA_TYPES_REGISTEREDSERVER)
+#endif
+#ifdef UA_TYPES_RELATIVEPATH
+UAPP_TYPEREGISTRY_NATIVE(UA_RelativePath, UA_TYPES_RELATIVEPATH)
+#endif
+#ifdef UA_TYPES_RELATIVEPATHELEMENT
+UAPP_TYPEREGISTRY_NATIVE(UA_RelativePathElement, UA_TYPES_RELATIVEPATHELEMENT)
+#endif
+#ifdef UA_TYPES_ROLEPERMISSIONTYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_RolePermissionType, UA_TYPES_ROLEPERMISSIONTYPE)
+#endif
+#ifdef UA_TYPES_SERVERDIAGNOSTICSSUMMARYDATATYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_ServerDiagnosticsSummaryDataType, UA_TYPES_SERVERDIAGNOSTICSSUMMARYDATATYPE)
+#endif
+#ifdef UA_TYPES_SERVERONNETWORK
+UAPP_TYPEREGISTRY_NATIVE(UA_ServerOnNetwork, UA_TYPES_SERVERONNETWORK)
+#endif
+#ifdef UA_TYPES_SERVERSTATE
+UAPP_TYPEREGISTRY_NATIVE(UA_ServerState, UA_TYPES_SERVERSTATE)
+#endif
+#ifdef UA_TYPES_SERVERSTATUSDATATYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_ServerStatusDataType, UA_TYPES_SERVERSTATUSDATATYPE)
+#endif
+#ifdef UA_TYPES_SIGNATUREDATA
+UAPP_TYPEREGISTRY_NATIVE(UA_SignatureData, UA_TYPES_SIGNATUREDATA)
+#endif
+#ifdef UA_TYPES_SIGNEDSOFTWARECERTIFICATE
+UAPP_TYPEREGISTRY_NATIVE(UA_SignedSoftwareCertificate, UA_TYPES_SIGNEDSOFTWARECERTIFICATE)
+#endif
+#ifdef UA_TYPES_SIMPLEATTRIBUTEOPERAND
+UAPP_TYPEREGISTRY_NATIVE(UA_SimpleAttributeOperand, UA_TYPES_SIMPLEATTRIBUTEOPERAND)
+#endif
+#ifdef UA_TYPES_SIMPLETYPEDESCRIPTION
+UAPP_TYPEREGISTRY_NATIVE(UA_SimpleTypeDescription, UA_TYPES_SIMPLETYPEDESCRIPTION)
+#endif
+#ifdef UA_TYPES_STATUSCHANGENOTIFICATION
+UAPP_TYPEREGISTRY_NATIVE(UA_StatusChangeNotification, UA_TYPES_STATUSCHANGENOTIFICATION)
+#endif
+#ifdef UA_TYPES_STRUCTUREDEFINITION
+UAPP_TYPEREGISTRY_NATIVE(UA_StructureDefinition, UA_TYPES_STRUCTUREDEFINITION)
+#endif
+#ifdef UA_TYPES_STRUCTUREDESCRIPTION
+UAPP_TYPEREGISTRY_NATIVE(UA_StructureDescription, UA_TYPES_STRUCTUREDESCRIPTION)
+#endif
+#ifdef UA_TYPES_STRUCTUREFIELD
+UAPP_TYPEREGISTRY_NATIVE(UA_StructureField, UA_TYPES_STRUCTUREFIELD)
+#endif
+#ifdef UA_TYPES_STRUCTURETYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_StructureType, UA_TYPES_STRUCTURETYPE)
+#endif
+#ifdef UA_TYPES_SUBSCRIPTIONACKNOWLEDGEMENT
+UAPP_TYPEREGISTRY_NATIVE(UA_SubscriptionAcknowledgement, UA_TYPES_SUBSCRIPTIONACKNOWLEDGEMENT)
+#endif
+#ifdef UA_TYPES_TIMEZONEDATATYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_TimeZoneDataType, UA_TYPES_TIMEZONEDATATYPE)
+#endif
+#ifdef UA_TYPES_TIMESTAMPSTORETURN
+UAPP_TYPEREGISTRY_NATIVE(UA_TimestampsToReturn, UA_TYPES_TIMESTAMPSTORETURN)
+#endif
+#ifdef UA_TYPES_TRANSFERRESULT
+UAPP_TYPEREGISTRY_NATIVE(UA_TransferResult, UA_TYPES_TRANSFERRESULT)
+#endif
+#ifdef UA_TYPES_USERIDENTITYTOKEN
+UAPP_TYPEREGISTRY_NATIVE(UA_UserIdentityToken, UA_TYPES_USERIDENTITYTOKEN)
+#endif
+#ifdef UA_TYPES_USERNAMEIDENTITYTOKEN
+UAPP_TYPEREGISTRY_NATIVE(UA_UserNameIdentityToken, UA_TYPES_USERNAMEIDENTITYTOKEN)
+#endif
+#ifdef UA_TYPES_USERTOKENPOLICY
+UAPP_TYPEREGISTRY_NATIVE(UA_UserTokenPolicy, UA_TYPES_USERTOKENPOLICY)
+#endif
+#ifdef UA_TYPES_USERTOKENTYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_UserTokenType, UA_TYPES_USERTOKENTYPE)
+#endif
+#ifdef UA_TYPES_VARIABLEATTRIBUTES
+UAPP_TYPEREGISTRY_NATIVE(UA_VariableAttributes, UA_TYPES_VARIABLEATTRIBUTES)
+#endif
+#ifdef UA_TYPES_VARIABLETYPEATTRIBUTES
+UAPP_TYPEREGISTRY_NATIVE(UA_VariableTypeAttributes, UA_TYPES_VARIABLETYPEATTRIBUTES)
+#endif
+#ifdef UA_TYPES_VIEWATTRIBUTES
+UAPP_TYPEREGISTRY_NATIVE(UA_ViewAttributes, UA_TYPES_VIEWATTRIBUTES)
+#endif
+#ifdef UA_TYPES_VIEWDESCRIPTION
+UAPP_TYPEREGISTRY_NATIVE(UA_ViewDescription, UA_TYPES_VIEWDESCRIPTION)
+#endif
+#ifdef UA_TYPES_WRITEVALUE
+UAPP_TYPEREGISTRY_NATIVE(UA_WriteValue, UA_TYPES_WRITEVALUE)
+#endif
+#ifdef UA_TYPES_X509IDENTITYTOKEN
+UAPP_TYPEREGISTRY_NATIVE(UA_X509IdentityToken, UA_TYPES_X509IDENTITYTOKEN)
+#endif
+#ifdef UA_TYPES_XVTYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_XVType, UA_TYPES_XVTYPE)
+#endif
+
+// clang-format on
+
+}  // namespace opcua
@@ -0,0 +1,65 @@
+/* ---------------------------------------------------------------------------------------------- */
+/*                                   Generated - do not modify!                                   */
+/* ---------------------------------------------------------------------------------------------- */
+
+#pragma once
+
+#include "open62541pp/open62541.h"
+#include "open62541pp/typeregistry/Builtin.h"
+
+namespace opcua {
+
+// clang-format off
+
+#ifdef UA_TYPES_DELETERAWMODIFIEDDETAILS
+UAPP_TYPEREGISTRY_NATIVE(UA_DeleteRawModifiedDetails, UA_TYPES_DELETERAWMODIFIEDDETAILS)
+#endif
+#ifdef UA_TYPES_HISTORYDATA
+UAPP_TYPEREGISTRY_NATIVE(UA_HistoryData, UA_TYPES_HISTORYDATA)
+#endif
+#ifdef UA_TYPES_HISTORYEVENT
+UAPP_TYPEREGISTRY_NATIVE(UA_HistoryEvent, UA_TYPES_HISTORYEVENT)
+#endif
+#ifdef UA_TYPES_HISTORYEVENTFIELDLIST
+UAPP_TYPEREGISTRY_NATIVE(UA_HistoryEventFieldList, UA_TYPES_HISTORYEVENTFIELDLIST)
+#endif
+#ifdef UA_TYPES_HISTORYMODIFIEDDATA
+UAPP_TYPEREGISTRY_NATIVE(UA_HistoryModifiedData, UA_TYPES_HISTORYMODIFIEDDATA)
+#endif
+#ifdef UA_TYPES_HISTORYREADRESULT
+UAPP_TYPEREGISTRY_NATIVE(UA_HistoryReadResult, UA_TYPES_HISTORYREADRESULT)
+#endif
+#ifdef UA_TYPES_HISTORYREADVALUEID
+UAPP_TYPEREGISTRY_NATIVE(UA_HistoryReadValueId, UA_TYPES_HISTORYREADVALUEID)
+#endif
+#ifdef UA_TYPES_HISTORYUPDATERESULT
+UAPP_TYPEREGISTRY_NATIVE(UA_HistoryUpdateResult, UA_TYPES_HISTORYUPDATERESULT)
+#endif
+#ifdef UA_TYPES_HISTORYUPDATETYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_HistoryUpdateType, UA_TYPES_HISTORYUPDATETYPE)
+#endif
+#ifdef UA_TYPES_MODIFICATIONINFO
+UAPP_TYPEREGISTRY_NATIVE(UA_ModificationInfo, UA_TYPES_MODIFICATIONINFO)
+#endif
+#ifdef UA_TYPES_PERFORMUPDATETYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_PerformUpdateType, UA_TYPES_PERFORMUPDATETYPE)
+#endif
+#ifdef UA_TYPES_READATTIMEDETAILS
+UAPP_TYPEREGISTRY_NATIVE(UA_ReadAtTimeDetails, UA_TYPES_READATTIMEDETAILS)
+#endif
+#ifdef UA_TYPES_READEVENTDETAILS
+UAPP_TYPEREGISTRY_NATIVE(UA_ReadEventDetails, UA_TYPES_READEVENTDETAILS)
+#endif
+#ifdef UA_TYPES_READPROCESSEDDETAILS
+UAPP_TYPEREGISTRY_NATIVE(UA_ReadProcessedDetails, UA_TYPES_READPROCESSEDDETAILS)
+#endif
+#ifdef UA_TYPES_READRAWMODIFIEDDETAILS
+UAPP_TYPEREGISTRY_NATIVE(UA_ReadRawModifiedDetails, UA_TYPES_READRAWMODIFIEDDETAILS)
+#endif
+#ifdef UA_TYPES_UPDATEDATADETAILS
+UAPP_TYPEREGISTRY_NATIVE(UA_UpdateDataDetails, UA_TYPES_UPDATEDATADETAILS)
+#endif
+
+// clang-format on
+
+}  // namespace opcua
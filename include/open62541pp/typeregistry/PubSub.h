@@ -0,0 +1,122 @@
+/* ---------------------------------------------------------------------------------------------- */
+/*                                   Generated - do not modify!                                   */
+/* ---------------------------------------------------------------------------------------------- */
+
+#pragma once
+
+#include "open62541pp/open62541.h"
+#include "open62541pp/typeregistry/Builtin.h"
+
+namespace opcua {
+
+// clang-format off
+
+#ifdef UA_TYPES_BROKERCONNECTIONTRANSPORTDATATYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_BrokerConnectionTransportDataType, UA_TYPES_BROKERCONNECTIONTRANSPORTDATATYPE)
+#endif
+#ifdef UA_TYPES_BROKERDATASETREADERTRANSPORTDATATYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_BrokerDataSetReaderTransportDataType, UA_TYPES_BROKERDATASETREADERTRANSPORTDATATYPE)
+#endif
+#ifdef UA_TYPES_BROKERDATASETWRITERTRANSPORTDATATYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_BrokerDataSetWriterTransportDataType, UA_TYPES_BROKERDATASETWRITERTRANSPORTDATATYPE)
+#endif
+#ifdef UA_TYPES_BROKERTRANSPORTQUALITYOFSERVICE
+UAPP_TYPEREGISTRY_NATIVE(UA_BrokerTransportQualityOfService, UA_TYPES_BROKERTRANSPORTQUALITYOFSERVICE)
+#endif
+#ifdef UA_TYPES_BROKERWRITERGROUPTRANSPORTDATATYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_BrokerWriterGroupTransportDataType, UA_TYPES_BROKERWRITERGROUPTRANSPORTDATATYPE)
+#endif
+#ifdef UA_TYPES_BROKERWRITERGROUPTRANSPORTTYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_BrokerWriterGroupTransportType, UA_TYPES_BROKERWRITERGROUPTRANSPORTTYPE)
+#endif
+#ifdef UA_TYPES_CONFIGURATIONVERSIONDATATYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_ConfigurationVersionDataType, UA_TYPES_CONFIGURATIONVERSIONDATATYPE)
+#endif
+#ifdef UA_TYPES_DATASETMETADATATYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_DataSetMetaDataType, UA_TYPES_DATASETMETADATATYPE)
+#endif
+#ifdef UA_TYPES_DATASETORDERINGTYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_DataSetOrderingType, UA_TYPES_DATASETORDERINGTYPE)
+#endif
+#ifdef UA_TYPES_DATASETREADERDATATYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_DataSetReaderDataType, UA_TYPES_DATASETREADERDATATYPE)
+#endif
+#ifdef UA_TYPES_DATASETWRITERDATATYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_DataSetWriterDataType, UA_TYPES_DATASETWRITERDATATYPE)
+#endif
+#ifdef UA_TYPES_DATAGRAMCONNECTIONTRANSPORTDATATYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_DatagramConnectionTransportDataType, UA_TYPES_DATAGRAMCONNECTIONTRANSPORTDATATYPE)
+#endif
+#ifdef UA_TYPES_DATAGRAMWRITERGROUPTRANSPORTDATATYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_DatagramWriterGroupTransportDataType, UA_TYPES_DATAGRAMWRITERGROUPTRANSPORTDATATYPE)
+#endif
+#ifdef UA_TYPES_FIELDMETADATA
+UAPP_TYPEREGISTRY_NATIVE(UA_FieldMetaData, UA_TYPES_FIELDMETADATA)
+#endif
+#ifdef UA_TYPES_FIELDTARGETDATATYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_FieldTargetDataType, UA_TYPES_FIELDTARGETDATATYPE)
+#endif
+#ifdef UA_TYPES_JSONDATASETREADERMESSAGEDATATYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_JsonDataSetReaderMessageDataType, UA_TYPES_JSONDATASETREADERMESSAGEDATATYPE)
+#endif
+#ifdef UA_TYPES_JSONDATASETWRITERMESSAGEDATATYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_JsonDataSetWriterMessageDataType, UA_TYPES_JSONDATASETWRITERMESSAGEDATATYPE)
+#endif
+#ifdef UA_TYPES_JSONWRITERGROUPMESSAGEDATATYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_JsonWriterGroupMessageDataType, UA_TYPES_JSONWRITERGROUPMESSAGEDATATYPE)
+#endif
+#ifdef UA_TYPES_NETWORKADDRESSURLDATATYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_NetworkAddressUrlDataType, UA_TYPES_NETWORKADDRESSURLDATATYPE)
+#endif
+#ifdef UA_TYPES_OVERRIDEVALUEHANDLING
+UAPP_TYPEREGISTRY_NATIVE(UA_OverrideValueHandling, UA_TYPES_OVERRIDEVALUEHANDLING)
+#endif
+#ifdef UA_TYPES_PUBSUBCONFIGURATIONDATATYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_PubSubConfigurationDataType, UA_TYPES_PUBSUBCONFIGURATIONDATATYPE)
+#endif
+#ifdef UA_TYPES_PUBSUBCONNECTIONDATATYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_PubSubConnectionDataType, UA_TYPES_PUBSUBCONNECTIONDATATYPE)
+#endif
+#ifdef UA_TYPES_PUBSUBSTATE
+UAPP_TYPEREGISTRY_NATIVE(UA_PubSubState, UA_TYPES_PUBSUBSTATE)
+#endif
+#ifdef UA_TYPES_PUBLISHEDDATAITEMSDATATYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_PublishedDataItemsDataType, UA_TYPES_PUBLISHEDDATAITEMSDATATYPE)
+#endif
+#ifdef UA_TYPES_PUBLISHEDDATASETDATATYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_PublishedDataSetDataType, UA_TYPES_PUBLISHEDDATASETDATATYPE)
+#endif
+#ifdef UA_TYPES_PUBLISHEDEVENTSDATATYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_PublishedEventsDataType, UA_TYPES_PUBLISHEDEVENTSDATATYPE)
+#endif
+#ifdef UA_TYPES_PUBLISHEDVARIABLEDATATYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_PublishedVariableDataType, UA_TYPES_PUBLISHEDVARIABLEDATATYPE)
+#endif
+#ifdef UA_TYPES_READERGROUPDATATYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_ReaderGroupDataType, UA_TYPES_READERGROUPDATATYPE)
+#endif
+#ifdef UA_TYPES_SUBSCRIBEDDATASETMIRRORDATATYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_SubscribedDataSetMirrorDataType, UA_TYPES_SUBSCRIBEDDATASETMIRRORDATATYPE)
+#endif
+#ifdef UA_TYPES_TARGETVARIABLESDATATYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_TargetVariablesDataType, UA_TYPES_TARGETVARIABLESDATATYPE)
+#endif
+#ifdef UA_TYPES_UABINARYFILEDATATYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_UABinaryFileDataType, UA_TYPES_UABINARYFILEDATATYPE)
+#endif
+#ifdef UA_TYPES_UADPDATASETREADERMESSAGEDATATYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_UadpDataSetReaderMessageDataType, UA_TYPES_UADPDATASETREADERMESSAGEDATATYPE)
+#endif
+#ifdef UA_TYPES_UADPDATASETWRITERMESSAGEDATATYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_UadpDataSetWriterMessageDataType, UA_TYPES_UADPDATASETWRITERMESSAGEDATATYPE)
+#endif
+#ifdef UA_TYPES_UADPWRITERGROUPMESSAGEDATATYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_UadpWriterGroupMessageDataType, UA_TYPES_UADPWRITERGROUPMESSAGEDATATYPE)
+#endif
+#ifdef UA_TYPES_WRITERGROUPDATATYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_WriterGroupDataType, UA_TYPES_WRITERGROUPDATATYPE)
+#endif
+
+// clang-format on
+
+}  // namespace opcua
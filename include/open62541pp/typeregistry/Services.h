@@ -0,0 +1,266 @@
+/* ---------------------------------------------------------------------------------------------- */
+/*                                   Generated - do not modify!                                   */
+/* ---------------------------------------------------------------------------------------------- */
+
+#pragma once
+
+#include "open62541pp/open62541.h"
+#include "open62541pp/typeregistry/Builtin.h"
+
+namespace opcua {
+
+// clang-format off
+
+#ifdef UA_TYPES_ACTIVATESESSIONREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_ActivateSessionRequest, UA_TYPES_ACTIVATESESSIONREQUEST)
+#endif
+#ifdef UA_TYPES_ACTIVATESESSIONRESPONSE
+UAPP_TYPEREGISTRY_NATIVE(UA_ActivateSessionResponse, UA_TYPES_ACTIVATESESSIONRESPONSE)
+#endif
+#ifdef UA_TYPES_ADDNODESREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_AddNodesRequest, UA_TYPES_ADDNODESREQUEST)
+#endif
+#ifdef UA_TYPES_ADDNODESRESPONSE
+UAPP_TYPEREGISTRY_NATIVE(UA_AddNodesResponse, UA_TYPES_ADDNODESRESPONSE)
+#endif
+#ifdef UA_TYPES_ADDREFERENCESREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_AddReferencesRequest, UA_TYPES_ADDREFERENCESREQUEST)
+#endif
+#ifdef UA_TYPES_ADDREFERENCESRESPONSE
+UAPP_TYPEREGISTRY_NATIVE(UA_AddReferencesResponse, UA_TYPES_ADDREFERENCESRESPONSE)
+#endif
+#ifdef UA_TYPES_BROWSENEXTREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_BrowseNextRequest, UA_TYPES_BROWSENEXTREQUEST)
+#endif
+#ifdef UA_TYPES_BROWSENEXTRESPONSE
+UAPP_TYPEREGISTRY_NATIVE(UA_BrowseNextResponse, UA_TYPES_BROWSENEXTRESPONSE)
+#endif
+#ifdef UA_TYPES_BROWSEREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_BrowseRequest, UA_TYPES_BROWSEREQUEST)
+#endif
+#ifdef UA_TYPES_BROWSERESPONSE
+UAPP_TYPEREGISTRY_NATIVE(UA_BrowseResponse, UA_TYPES_BROWSERESPONSE)
+#endif
+#ifdef UA_TYPES_CALLMETHODREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_CallMethodRequest, UA_TYPES_CALLMETHODREQUEST)
+#endif
+#ifdef UA_TYPES_CALLREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_CallRequest, UA_TYPES_CALLREQUEST)
+#endif
+#ifdef UA_TYPES_CALLRESPONSE
+UAPP_TYPEREGISTRY_NATIVE(UA_CallResponse, UA_TYPES_CALLRESPONSE)
+#endif
+#ifdef UA_TYPES_CLOSESECURECHANNELREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_CloseSecureChannelRequest, UA_TYPES_CLOSESECURECHANNELREQUEST)
+#endif
+#ifdef UA_TYPES_CLOSESECURECHANNELRESPONSE
+UAPP_TYPEREGISTRY_NATIVE(UA_CloseSecureChannelResponse, UA_TYPES_CLOSESECURECHANNELRESPONSE)
+#endif
+#ifdef UA_TYPES_CLOSESESSIONREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_CloseSessionRequest, UA_TYPES_CLOSESESSIONREQUEST)
+#endif
+#ifdef UA_TYPES_CLOSESESSIONRESPONSE
+UAPP_TYPEREGISTRY_NATIVE(UA_CloseSessionResponse, UA_TYPES_CLOSESESSIONRESPONSE)
+#endif
+#ifdef UA_TYPES_CREATEMONITOREDITEMSREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_CreateMonitoredItemsRequest, UA_TYPES_CREATEMONITOREDITEMSREQUEST)
+#endif
+#ifdef UA_TYPES_CREATEMONITOREDITEMSRESPONSE
+UAPP_TYPEREGISTRY_NATIVE(UA_CreateMonitoredItemsResponse, UA_TYPES_CREATEMONITOREDITEMSRESPONSE)
+#endif
+#ifdef UA_TYPES_CREATESESSIONREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_CreateSessionRequest, UA_TYPES_CREATESESSIONREQUEST)
+#endif
+#ifdef UA_TYPES_CREATESESSIONRESPONSE
+UAPP_TYPEREGISTRY_NATIVE(UA_CreateSessionResponse, UA_TYPES_CREATESESSIONRESPONSE)
+#endif
+#ifdef UA_TYPES_CREATESUBSCRIPTIONREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_CreateSubscriptionRequest, UA_TYPES_CREATESUBSCRIPTIONREQUEST)
+#endif
+#ifdef UA_TYPES_CREATESUBSCRIPTIONRESPONSE
+UAPP_TYPEREGISTRY_NATIVE(UA_CreateSubscriptionResponse, UA_TYPES_CREATESUBSCRIPTIONRESPONSE)
+#endif
+#ifdef UA_TYPES_DELETEMONITOREDITEMSREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_DeleteMonitoredItemsRequest, UA_TYPES_DELETEMONITOREDITEMSREQUEST)
+#endif
+#ifdef UA_TYPES_DELETEMONITOREDITEMSRESPONSE
+UAPP_TYPEREGISTRY_NATIVE(UA_DeleteMonitoredItemsResponse, UA_TYPES_DELETEMONITOREDITEMSRESPONSE)
+#endif
+#ifdef UA_TYPES_DELETENODESREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_DeleteNodesRequest, UA_TYPES_DELETENODESREQUEST)
+#endif
+#ifdef UA_TYPES_DELETENODESRESPONSE
+UAPP_TYPEREGISTRY_NATIVE(UA_DeleteNodesResponse, UA_TYPES_DELETENODESRESPONSE)
+#endif
+#ifdef UA_TYPES_DELETEREFERENCESREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_DeleteReferencesRequest, UA_TYPES_DELETEREFERENCESREQUEST)
+#endif
+#ifdef UA_TYPES_DELETEREFERENCESRESPONSE
+UAPP_TYPEREGISTRY_NATIVE(UA_DeleteReferencesResponse, UA_TYPES_DELETEREFERENCESRESPONSE)
+#endif
+#ifdef UA_TYPES_DELETESUBSCRIPTIONSREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_DeleteSubscriptionsRequest, UA_TYPES_DELETESUBSCRIPTIONSREQUEST)
+#endif
+#ifdef UA_TYPES_DELETESUBSCRIPTIONSRESPONSE
+UAPP_TYPEREGISTRY_NATIVE(UA_DeleteSubscriptionsResponse, UA_TYPES_DELETESUBSCRIPTIONSRESPONSE)
+#endif
+#ifdef UA_TYPES_FINDSERVERSONNETWORKREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_FindServersOnNetworkRequest, UA_TYPES_FINDSERVERSONNETWORKREQUEST)
+#endif
+#ifdef UA_TYPES_FINDSERVERSONNETWORKRESPONSE
+UAPP_TYPEREGISTRY_NATIVE(UA_FindServersOnNetworkResponse, UA_TYPES_FINDSERVERSONNETWORKRESPONSE)
+#endif
+#ifdef UA_TYPES_FINDSERVERSREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_FindServersRequest, UA_TYPES_FINDSERVERSREQUEST)
+#endif
+#ifdef UA_TYPES_FINDSERVERSRESPONSE
+UAPP_TYPEREGISTRY_NATIVE(UA_FindServersResponse, UA_TYPES_FINDSERVERSRESPONSE)
+#endif
+#ifdef UA_TYPES_GETENDPOINTSREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_GetEndpointsRequest, UA_TYPES_GETENDPOINTSREQUEST)
+#endif
+#ifdef UA_TYPES_GETENDPOINTSRESPONSE
+UAPP_TYPEREGISTRY_NATIVE(UA_GetEndpointsResponse, UA_TYPES_GETENDPOINTSRESPONSE)
+#endif
+#ifdef UA_TYPES_HISTORYREADREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_HistoryReadRequest, UA_TYPES_HISTORYREADREQUEST)
+#endif
+#ifdef UA_TYPES_HISTORYREADRESPONSE
+UAPP_TYPEREGISTRY_NATIVE(UA_HistoryReadResponse, UA_TYPES_HISTORYREADRESPONSE)
+#endif
+#ifdef UA_TYPES_HISTORYUPDATEREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_HistoryUpdateRequest, UA_TYPES_HISTORYUPDATEREQUEST)
+#endif
+#ifdef UA_TYPES_HISTORYUPDATERESPONSE
+UAPP_TYPEREGISTRY_NATIVE(UA_HistoryUpdateResponse, UA_TYPES_HISTORYUPDATERESPONSE)
+#endif
+#ifdef UA_TYPES_MODIFYMONITOREDITEMSREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_ModifyMonitoredItemsRequest, UA_TYPES_MODIFYMONITOREDITEMSREQUEST)
+#endif
+#ifdef UA_TYPES_MODIFYMONITOREDITEMSRESPONSE
+UAPP_TYPEREGISTRY_NATIVE(UA_ModifyMonitoredItemsResponse, UA_TYPES_MODIFYMONITOREDITEMSRESPONSE)
+#endif
+#ifdef UA_TYPES_MODIFYSUBSCRIPTIONREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_ModifySubscriptionRequest, UA_TYPES_MODIFYSUBSCRIPTIONREQUEST)
+#endif
+#ifdef UA_TYPES_MODIFYSUBSCRIPTIONRESPONSE
+UAPP_TYPEREGISTRY_NATIVE(UA_ModifySubscriptionResponse, UA_TYPES_MODIFYSUBSCRIPTIONRESPONSE)
+#endif
+#ifdef UA_TYPES_MONITOREDITEMCREATEREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_MonitoredItemCreateRequest, UA_TYPES_MONITOREDITEMCREATEREQUEST)
+#endif
+#ifdef UA_TYPES_MONITOREDITEMMODIFYREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_MonitoredItemModifyRequest, UA_TYPES_MONITOREDITEMMODIFYREQUEST)
+#endif
+#ifdef UA_TYPES_OPENSECURECHANNELREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_OpenSecureChannelRequest, UA_TYPES_OPENSECURECHANNELREQUEST)
+#endif
+#ifdef UA_TYPES_OPENSECURECHANNELRESPONSE
+UAPP_TYPEREGISTRY_NATIVE(UA_OpenSecureChannelResponse, UA_TYPES_OPENSECURECHANNELRESPONSE)
+#endif
+#ifdef UA_TYPES_PUBLISHREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_PublishRequest, UA_TYPES_PUBLISHREQUEST)
+#endif
+#ifdef UA_TYPES_PUBLISHRESPONSE
+UAPP_TYPEREGISTRY_NATIVE(UA_PublishResponse, UA_TYPES_PUBLISHRESPONSE)
+#endif
+#ifdef UA_TYPES_QUERYFIRSTREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_QueryFirstRequest, UA_TYPES_QUERYFIRSTREQUEST)
+#endif
+#ifdef UA_TYPES_QUERYFIRSTRESPONSE
+UAPP_TYPEREGISTRY_NATIVE(UA_QueryFirstResponse, UA_TYPES_QUERYFIRSTRESPONSE)
+#endif
+#ifdef UA_TYPES_QUERYNEXTREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_QueryNextRequest, UA_TYPES_QUERYNEXTREQUEST)
+#endif
+#ifdef UA_TYPES_QUERYNEXTRESPONSE
+UAPP_TYPEREGISTRY_NATIVE(UA_QueryNextResponse, UA_TYPES_QUERYNEXTRESPONSE)
+#endif
+#ifdef UA_TYPES_READREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_ReadRequest, UA_TYPES_READREQUEST)
+#endif
+#ifdef UA_TYPES_READRESPONSE
+UAPP_TYPEREGISTRY_NATIVE(UA_ReadResponse, UA_TYPES_READRESPONSE)
+#endif
+#ifdef UA_TYPES_REGISTERNODESREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_RegisterNodesRequest, UA_TYPES_REGISTERNODESREQUEST)
+#endif
+#ifdef UA_TYPES_REGISTERNODESRESPONSE
+UAPP_TYPEREGISTRY_NATIVE(UA_RegisterNodesResponse, UA_TYPES_REGISTERNODESRESPONSE)
+#endif
+#ifdef UA_TYPES_REGISTERSERVER2REQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_RegisterServer2Request, UA_TYPES_REGISTERSERVER2REQUEST)
+#endif
+#ifdef UA_TYPES_REGISTERSERVER2RESPONSE
+UAPP_TYPEREGISTRY_NATIVE(UA_RegisterServer2Response, UA_TYPES_REGISTERSERVER2RESPONSE)
+#endif
+#ifdef UA_TYPES_REGISTERSERVERREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_RegisterServerRequest, UA_TYPES_REGISTERSERVERREQUEST)
+#endif
+#ifdef UA_TYPES_REGISTERSERVERRESPONSE
+UAPP_TYPEREGISTRY_NATIVE(UA_RegisterServerResponse, UA_TYPES_REGISTERSERVERRESPONSE)
+#endif
+#ifdef UA_TYPES_REPUBLISHREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_RepublishRequest, UA_TYPES_REPUBLISHREQUEST)
+#endif
+#ifdef UA_TYPES_REPUBLISHRESPONSE
+UAPP_TYPEREGISTRY_NATIVE(UA_RepublishResponse, UA_TYPES_REPUBLISHRESPONSE)
+#endif
+#ifdef UA_TYPES_REQUESTHEADER
+UAPP_TYPEREGISTRY_NATIVE(UA_RequestHeader, UA_TYPES_REQUESTHEADER)
+#endif
+#ifdef UA_TYPES_RESPONSEHEADER
+UAPP_TYPEREGISTRY_NATIVE(UA_ResponseHeader, UA_TYPES_RESPONSEHEADER)
+#endif
+#ifdef UA_TYPES_SECURITYTOKENREQUESTTYPE
+UAPP_TYPEREGISTRY_NATIVE(UA_SecurityTokenRequestType, UA_TYPES_SECURITYTOKENREQUESTTYPE)
+#endif
+#ifdef UA_TYPES_SERVICEFAULT
+UAPP_TYPEREGISTRY_NATIVE(UA_ServiceFault, UA_TYPES_SERVICEFAULT)
+#endif
+#ifdef UA_TYPES_SETMONITORINGMODEREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_SetMonitoringModeRequest, UA_TYPES_SETMONITORINGMODEREQUEST)
+#endif
+#ifdef UA_TYPES_SETMONITORINGMODERESPONSE
+UAPP_TYPEREGISTRY_NATIVE(UA_SetMonitoringModeResponse, UA_TYPES_SETMONITORINGMODERESPONSE)
+#endif
+#ifdef UA_TYPES_SETPUBLISHINGMODEREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_SetPublishingModeRequest, UA_TYPES_SETPUBLISHINGMODEREQUEST)
+#endif
+#ifdef UA_TYPES_SETPUBLISHINGMODERESPONSE
+UAPP_TYPEREGISTRY_NATIVE(UA_SetPublishingModeResponse, UA_TYPES_SETPUBLISHINGMODERESPONSE)
+#endif
+#ifdef UA_TYPES_SETTRIGGERINGREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_SetTriggeringRequest, UA_TYPES_SETTRIGGERINGREQUEST)
+#endif
+#ifdef UA_TYPES_SETTRIGGERINGRESPONSE
+UAPP_TYPEREGISTRY_NATIVE(UA_SetTriggeringResponse, UA_TYPES_SETTRIGGERINGRESPONSE)
+#endif
+#ifdef UA_TYPES_TRANSFERSUBSCRIPTIONSREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_TransferSubscriptionsRequest, UA_TYPES_TRANSFERSUBSCRIPTIONSREQUEST)
+#endif
+#ifdef UA_TYPES_TRANSFERSUBSCRIPTIONSRESPONSE
+UAPP_TYPEREGISTRY_NATIVE(UA_TransferSubscriptionsResponse, UA_TYPES_TRANSFERSUBSCRIPTIONSRESPONSE)
+#endif
+#ifdef UA_TYPES_TRANSLATEBROWSEPATHSTONODEIDSREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_TranslateBrowsePathsToNodeIdsRequest, UA_TYPES_TRANSLATEBROWSEPATHSTONODEIDSREQUEST)
+#endif
+#ifdef UA_TYPES_TRANSLATEBROWSEPATHSTONODEIDSRESPONSE
+UAPP_TYPEREGISTRY_NATIVE(UA_TranslateBrowsePathsToNodeIdsResponse, UA_TYPES_TRANSLATEBROWSEPATHSTONODEIDSRESPONSE)
+#endif
+#ifdef UA_TYPES_UNREGISTERNODESREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_UnregisterNodesRequest, UA_TYPES_UNREGISTERNODESREQUEST)
+#endif
+#ifdef UA_TYPES_UNREGISTERNODESRESPONSE
+UAPP_TYPEREGISTRY_NATIVE(UA_UnregisterNodesResponse, UA_TYPES_UNREGISTERNODESRESPONSE)
+#endif
+#ifdef UA_TYPES_WRITEREQUEST
+UAPP_TYPEREGISTRY_NATIVE(UA_WriteRequest, UA_TYPES_WRITEREQUEST)
+#endif
+#ifdef UA_TYPES_WRITERESPONSE
+UAPP_TYPEREGISTRY_NATIVE(UA_WriteResponse, UA_TYPES_WRITERESPONSE)
+#endif
+
+// clang-format on
+
+}  // namespace opcua
@@ -1,10 +1,12 @@
 #pragma once
 
+#include <algorithm>  // min
 #include <array>
 #include <cstdint>
 #include <iosfwd>  // forward declare ostream
 #include <string>
 #include <string_view>
+#include <utility>  // as_const
 #include <vector>
 
 // Workaround for GCC 7 with partial C++17 support
@@ -167,6 +169,114 @@ bool operator!=(const ByteString& lhs, std::string_view rhs) noexcept;
 bool operator==(std::string_view lhs, const ByteString& rhs) noexcept;
 bool operator!=(std::string_view lhs, const ByteString& rhs) noexcept;
 
+/**
+ * Non-owning reference to a string, usable as String (`StringRef`) or ByteString (`ByteStringRef`).
+ *
+ * The characters are referenced without allocation and must outlive the reference.
+ * The memory layout equals the native `UA_String`, hence it can be passed to every function
+ * expecting a `const String&` (`const ByteString&`) and assigned to a Variant without allocation.
+ * The type is not registered in the TypeRegistry: copies (e.g. `Variant::getScalarCopy`) would
+ * allocate characters that the reference does not own. Assign it with the data type of the wrapper:
+ * @code
+ * StringRef ref("status text");
+ * Variant var;
+ * var.setScalar(ref, getDataType<String>());  // no copy, var references ref
+ * @endcode
+ */
+template <typename WrapperType>
+class BasicStringRef {
+public:
+    constexpr BasicStringRef() noexcept = default;
+
+    BasicStringRef(std::string_view str) noexcept  // NOLINT, implicit wanted
+        : native_{detail::toNativeString(str)} {}
+
+    /// Get the referenced string.
+    const WrapperType& get() const noexcept {
+        return asWrapper<WrapperType>(native_);
+    }
+
+    /// Implicit conversion to the wrapper type.
+    operator const WrapperType&() const noexcept {  // NOLINT, implicit wanted
+        return get();
+    }
+
+    /// Implicit conversion to std::string_view.
+    operator std::string_view() const noexcept {  // NOLINT, implicit wanted
+        return get().get();
+    }
+
+    /// Return const pointer to native object.
+    constexpr const UA_String* handle() const noexcept {
+        return &native_;
+    }
+
+protected:
+    UA_String native_{};
+};
+
+using StringRef = BasicStringRef<String>;
+using ByteStringRef = BasicStringRef<ByteString>;
+
+/**
+ * String with fixed capacity and inline storage (no heap allocation).
+ *
+ * Strings longer than the capacity `N` are truncated.
+ * BasicStaticString derives from BasicStringRef that references the inline storage. Pass it as
+ * `StringRef` (`ByteStringRef`) to assign it to a Variant without allocation.
+ */
+template <typename WrapperType, size_t N>
+class BasicStaticString : public BasicStringRef<WrapperType> {
+public:
+    constexpr BasicStaticString() noexcept = default;
+
+    BasicStaticString(std::string_view str) noexcept {  // NOLINT, implicit wanted
+        assign(str);
+    }
+
+    BasicStaticString(const BasicStaticString& other) noexcept
+        : BasicStaticString(std::string_view(other)) {}
+
+    BasicStaticString& operator=(const BasicStaticString& other) noexcept {
+        if (this != &other) {
+            assign(other);
+        }
+        return *this;
+    }
+
+    // inline storage can not be moved, moving equals copying
+    BasicStaticString(BasicStaticString&& other) noexcept
+        : BasicStaticString(std::as_const(other)) {}
+
+    BasicStaticString& operator=(BasicStaticString&& other) noexcept {
+        return *this = std::as_const(other);
+    }
+
+    ~BasicStaticString() = default;
+
+    /// Replace the content, truncated to the capacity.
+    void assign(std::string_view str) noexcept {
+        const size_t length = std::min(str.size(), N);
+        std::copy_n(str.data(), length, storage_.data());
+        this->native_.length = length;
+        this->native_.data = length > 0 ? storage_.data() : nullptr;
+    }
+
+    /// Maximum number of characters.
+    static constexpr size_t capacity() noexcept {
+        return N;
+    }
+
+private:
+    std::array<uint8_t, N> storage_{};
+};
+
+template <size_t N>
+using StaticString = BasicStaticString<String, N>;
+
+template <size_t N>
+using StaticByteString = BasicStaticString<ByteString, N>;
+
 /**
  * UA_XmlElement wrapper class.
  * @ingroup TypeWrapper
@@ -201,6 +311,36 @@ public:
     std::string_view getName() const noexcept;
 };
 
+/**
+ * Non-owning view of a QualifiedName.
+ *
+ * The name is referenced without allocation and must outlive the view.
+ * QualifiedNameView can be passed to every function expecting a `const QualifiedName&`.
+ */
+class QualifiedNameView {
+public:
+    QualifiedNameView(uint16_t namespaceIndex, std::string_view name) noexcept
+        : native_{namespaceIndex, detail::toNativeString(name)} {}
+
+    /// Get the referenced QualifiedName.
+    const QualifiedName& get() const noexcept {
+        return asWrapper<QualifiedName>(native_);
+    }
+
+    /// Implicit conversion to QualifiedName.
+    operator const QualifiedName&() const noexcept {  // NOLINT, implicit wanted
+        return get();
+    }
+
+    /// Return const pointer to native object.
+    constexpr const UA_QualifiedName* handle() const noexcept {
+        return &native_;
+    }
+
+private:
+    UA_QualifiedName native_;
+};
+
 /**
  * UA_LocalizedText wrapper class.
  * The format of locale is `<language>[-<country/region>]`:
@@ -11,10 +11,10 @@
 #include "open62541pp/Common.h"
 #include "open62541pp/NodeIds.h"  // ReferenceTypeId
 #include "open62541pp/Span.h"
-#include "open62541pp/TypeRegistry.h"  // getDataType
 #include "open62541pp/TypeWrapper.h"
 #include "open62541pp/detail/traits.h"
 #include "open62541pp/open62541.h"
+#include "open62541pp/typeregistry/Builtin.h"  // getDataType
 #include "open62541pp/types/Builtin.h"
 #include "open62541pp/types/DataValue.h"
 #include "open62541pp/types/DateTime.h"
@@ -1655,6 +1655,154 @@ public:
 
 #endif
 
+/* -------------------------------------------- Query ------------------------------------------- */
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS  // ContentFilter
+
+/**
+ * UA_QueryDataDescription wrapper class.
+ * @see https://reference.opcfoundation.org/Core/Part4/v105/docs/7.28
+ */
+class QueryDataDescription
+    : public TypeWrapper<UA_QueryDataDescription, UA_TYPES_QUERYDATADESCRIPTION> {
+public:
+    using TypeWrapperBase::TypeWrapperBase;
+
+    QueryDataDescription(
+        RelativePath relativePath, AttributeId attributeId, std::string_view indexRange = {}
+    );
+
+    UAPP_COMPOSED_GETTER_WRAPPER(RelativePath, getRelativePath, relativePath)
+    UAPP_COMPOSED_GETTER_CAST(AttributeId, getAttributeId, attributeId)
+    UAPP_COMPOSED_GETTER_WRAPPER(String, getIndexRange, indexRange)
+};
+
+/**
+ * UA_NodeTypeDescription wrapper class.
+ * @see https://reference.opcfoundation.org/Core/Part4/v105/docs/7.24
+ */
+class NodeTypeDescription
+    : public TypeWrapper<UA_NodeTypeDescription, UA_TYPES_NODETYPEDESCRIPTION> {
+public:
+    using TypeWrapperBase::TypeWrapperBase;
+
+    NodeTypeDescription(
+        ExpandedNodeId typeDefinitionNode,
+        bool includeSubTypes,
+        Span<const QueryDataDescription> dataToReturn
+    );
+
+    UAPP_COMPOSED_GETTER_WRAPPER(ExpandedNodeId, getTypeDefinitionNode, typeDefinitionNode)
+    UAPP_COMPOSED_GETTER(bool, getIncludeSubTypes, includeSubTypes)
+    UAPP_COMPOSED_GETTER_SPAN_WRAPPER(
+        QueryDataDescription, getDataToReturn, dataToReturn, dataToReturnSize
+    )
+};
+
+/**
+ * UA_QueryDataSet wrapper class.
+ * @see https://reference.opcfoundation.org/Core/Part4/v105/docs/7.29
+ */
+class QueryDataSet : public TypeWrapper<UA_QueryDataSet, UA_TYPES_QUERYDATASET> {
+public:
+    using TypeWrapperBase::TypeWrapperBase;
+
+    UAPP_COMPOSED_GETTER_WRAPPER(ExpandedNodeId, getNodeId, nodeId)
+    UAPP_COMPOSED_GETTER_WRAPPER(ExpandedNodeId, getTypeDefinitionNode, typeDefinitionNode)
+    UAPP_COMPOSED_GETTER_SPAN_WRAPPER(Variant, getValues, values, valuesSize)
+};
+
+/**
+ * UA_ParsingResult wrapper class.
+ * @see https://reference.opcfoundation.org/Core/Part4/v105/docs/5.9.3
+ */
+class ParsingResult : public TypeWrapper<UA_ParsingResult, UA_TYPES_PARSINGRESULT> {
+public:
+    using TypeWrapperBase::TypeWrapperBase;
+
+    UAPP_COMPOSED_GETTER(StatusCode, getStatusCode, statusCode)
+    UAPP_COMPOSED_GETTER_SPAN_WRAPPER(
+        StatusCode, getDataStatusCodes, dataStatusCodes, dataStatusCodesSize
+    )
+};
+
+/**
+ * UA_QueryFirstRequest wrapper class.
+ */
+class QueryFirstRequest : public TypeWrapper<UA_QueryFirstRequest, UA_TYPES_QUERYFIRSTREQUEST> {
+public:
+    using TypeWrapperBase::TypeWrapperBase;
+
+    QueryFirstRequest(
+        RequestHeader requestHeader,
+        ViewDescription view,
+        Span<const NodeTypeDescription> nodeTypes,
+        ContentFilter filter,
+        uint32_t maxDataSetsToReturn = 0,
+        uint32_t maxReferencesToReturn = 0
+    );
+
+    UAPP_COMPOSED_GETTER_WRAPPER(RequestHeader, getRequestHeader, requestHeader)
+    UAPP_COMPOSED_GETTER_WRAPPER(ViewDescription, getView, view)
+    UAPP_COMPOSED_GETTER_SPAN_WRAPPER(NodeTypeDescription, getNodeTypes, nodeTypes, nodeTypesSize)
+    UAPP_COMPOSED_GETTER_WRAPPER(ContentFilter, getFilter, filter)
+    UAPP_COMPOSED_GETTER(uint32_t, getMaxDataSetsToReturn, maxDataSetsToReturn)
+    UAPP_COMPOSED_GETTER(uint32_t, getMaxReferencesToReturn, maxReferencesToReturn)
+};
+
+/**
+ * UA_QueryFirstResponse wrapper class.
+ */
+class QueryFirstResponse
+    : public TypeWrapper<UA_QueryFirstResponse, UA_TYPES_QUERYFIRSTRESPONSE> {
+public:
+    using TypeWrapperBase::TypeWrapperBase;
+
+    UAPP_COMPOSED_GETTER_WRAPPER(ResponseHeader, getResponseHeader, responseHeader)
+    UAPP_COMPOSED_GETTER_SPAN_WRAPPER(
+        QueryDataSet, getQueryDataSets, queryDataSets, queryDataSetsSize
+    )
+    UAPP_COMPOSED_GETTER_WRAPPER(ByteString, getContinuationPoint, continuationPoint)
+    UAPP_COMPOSED_GETTER_SPAN_WRAPPER(
+        ParsingResult, getParsingResults, parsingResults, parsingResultsSize
+    )
+    UAPP_COMPOSED_GETTER_SPAN_WRAPPER(
+        DiagnosticInfo, getDiagnosticInfos, diagnosticInfos, diagnosticInfosSize
+    )
+};
+
+/**
+ * UA_QueryNextRequest wrapper class.
+ */
+class QueryNextRequest : public TypeWrapper<UA_QueryNextRequest, UA_TYPES_QUERYNEXTREQUEST> {
+public:
+    using TypeWrapperBase::TypeWrapperBase;
+
+    QueryNextRequest(
+        RequestHeader requestHeader, bool releaseContinuationPoint, ByteString continuationPoint
+    );
+
+    UAPP_COMPOSED_GETTER_WRAPPER(RequestHeader, getRequestHeader, requestHeader)
+    UAPP_COMPOSED_GETTER(bool, getReleaseContinuationPoint, releaseContinuationPoint)
+    UAPP_COMPOSED_GETTER_WRAPPER(ByteString, getContinuationPoint, continuationPoint)
+};
+
+/**
+ * UA_QueryNextResponse wrapper class.
+ */
+class QueryNextResponse : public TypeWrapper<UA_QueryNextResponse, UA_TYPES_QUERYNEXTRESPONSE> {
+public:
+    using TypeWrapperBase::TypeWrapperBase;
+
+    UAPP_COMPOSED_GETTER_WRAPPER(ResponseHeader, getResponseHeader, responseHeader)
+    UAPP_COMPOSED_GETTER_SPAN_WRAPPER(
+        QueryDataSet, getQueryDataSets, queryDataSets, queryDataSetsSize
+    )
+    UAPP_COMPOSED_GETTER_WRAPPER(ByteString, getRevisedContinuationPoint, revisedContinuationPoint)
+};
+
+#endif
+
 /* ----------------------------------------- Historizing ---------------------------------------- */
 
 /**
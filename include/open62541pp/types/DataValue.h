@@ -1,8 +1,9 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>  // shared_ptr
 #include <optional>
-#include <utility>  // forward
+#include <utility>  // forward, move
 
 #include "open62541pp/TypeWrapper.h"
 #include "open62541pp/open62541.h"
@@ -191,4 +192,55 @@ public:
     }
 };
 
+/**
+ * Reference-counted, immutable DataValue with copy-on-write semantics.
+ *
+ * Copies share the same DataValue with an atomic reference count instead of a deep copy.
+ * This is useful to fan out a single value to many consumers (e.g. queues of data change
+ * handlers). The shared value can be passed to every function expecting a `const DataValue&`.
+ * A mutable reference is only available with mutate(), which copies the value if it is shared.
+ */
+class SharedDataValue {
+public:
+    SharedDataValue()
+        : SharedDataValue(DataValue{}) {}
+
+    explicit SharedDataValue(DataValue value)
+        : ptr_(std::make_shared<DataValue>(std::move(value))) {}
+
+    /// Get the shared DataValue.
+    const DataValue& get() const noexcept {
+        return *ptr_;
+    }
+
+    /// Implicit conversion to DataValue.
+    operator const DataValue&() const noexcept {  // NOLINT, implicit wanted
+        return *ptr_;
+    }
+
+    const DataValue& operator*() const noexcept {
+        return *ptr_;
+    }
+
+    const DataValue* operator->() const noexcept {
+        return ptr_.get();
+    }
+
+    /// Get mutable reference to the DataValue, it is deep copied first if shared.
+    DataValue& mutate() {
+        if (ptr_.use_count() > 1) {
+            ptr_ = std::make_shared<DataValue>(*ptr_);
+        }
+        return *ptr_;
+    }
+
+    /// Number of SharedDataValue objects sharing the DataValue.
+    long useCount() const noexcept {
+        return ptr_.use_count();
+    }
+
+private:
+    std::shared_ptr<DataValue> ptr_;
+};
+
 }  // namespace opcua
@@ -1,11 +1,13 @@
 #pragma once
 
+#include <algorithm>  // max
 #include <chrono>
 #include <cstdint>
 #include <ratio>
 #include <string>
 #include <string_view>
 
+#include "open62541pp/Span.h"
 #include "open62541pp/TypeWrapper.h"
 #include "open62541pp/open62541.h"
 
@@ -35,6 +37,16 @@ public:
     /// Get current DateTime.
     static DateTime now() noexcept;
 
+    /// Get current DateTime from a coarse clock (resolution of ~1-4 ms, if available).
+    /// Querying the coarse clock is considerably cheaper than now(), e.g. to timestamp many
+    /// values per cycle. Falls back to now() if no coarse clock is available on the platform.
+    static DateTime nowCoarse() noexcept;
+
+    /// Get current DateTime from the coarse clock, strictly increasing within the calling thread.
+    /// Values timestamped in a batch get unique timestamps in order of their creation, even if the
+    /// coarse clock did not advance (or jumped back) in the meantime.
+    static DateTime nowMonotonic() noexcept;
+
     /// Get DateTime from std::chrono::time_point.
     template <typename Clock, typename Duration>
     static DateTime fromTimePoint(std::chrono::time_point<Clock, Duration> timePoint);
@@ -45,10 +57,27 @@ public:
     /// Offset of local time to UTC.
     static int64_t localTimeUtcOffset() noexcept;
 
+    /// Convert contiguous std::chrono::time_point objects to DateTime objects in one go.
+    /// @param src Input time points
+    /// @param dst Output array with at least `src.size()` elements
+    template <typename Clock, typename Duration>
+    static void fromTimePoints(
+        Span<const std::chrono::time_point<Clock, Duration>> src, DateTime* dst
+    ) noexcept;
+
     /// Convert to std::chrono::time_point.
     template <typename Clock = DefaultClock, typename Duration = UaDuration>
     std::chrono::time_point<Clock, Duration> toTimePoint() const;
 
+    /// Convert contiguous DateTime objects to std::chrono::time_point objects in one go.
+    /// The loop is free of calls and branches and can be vectorized by the compiler.
+    /// @param src Input DateTime objects
+    /// @param dst Output array with at least `src.size()` elements
+    template <typename Clock, typename Duration>
+    static void toTimePoints(
+        Span<const DateTime> src, std::chrono::time_point<Clock, Duration>* dst
+    ) noexcept;
+
     /// Convert to Unix time (number of seconds since January 1, 1970 UTC).
     int64_t toUnixTime() const noexcept;
 
@@ -82,4 +111,29 @@ std::chrono::time_point<Clock, Duration> DateTime::toTimePoint() const {
     return unixEpoch + std::chrono::duration_cast<Duration>(sinceEpoch);
 }
 
+template <typename Clock, typename Duration>
+void DateTime::fromTimePoints(
+    Span<const std::chrono::time_point<Clock, Duration>> src, DateTime* dst
+) noexcept {
+    for (size_t i = 0; i < src.size(); ++i) {
+        *dst[i].handle() =  // NOLINT
+            UA_DATETIME_UNIX_EPOCH +
+            std::chrono::duration_cast<UaDuration>(src[i].time_since_epoch()).count();
+    }
+}
+
+template <typename Clock, typename Duration>
+void DateTime::toTimePoints(
+    Span<const DateTime> src, std::chrono::time_point<Clock, Duration>* dst
+) noexcept {
+    using TimePoint = std::chrono::time_point<Clock, Duration>;
+    for (size_t i = 0; i < src.size(); ++i) {
+        // clamp to unix epoch like toTimePoint
+        const int64_t sinceEpoch = std::max<int64_t>(
+            *src[i].handle() - UA_DATETIME_UNIX_EPOCH, 0  // NOLINT
+        );
+        dst[i] = TimePoint(std::chrono::duration_cast<Duration>(UaDuration(sinceEpoch)));  // NOLINT
+    }
+}
+
 }  // namespace opcua
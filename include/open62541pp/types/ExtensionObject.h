@@ -2,9 +2,9 @@
 
 #include <optional>
 
-#include "open62541pp/TypeRegistry.h"
 #include "open62541pp/TypeWrapper.h"
 #include "open62541pp/open62541.h"
+#include "open62541pp/typeregistry/Builtin.h"
 
 namespace opcua {
 
@@ -92,12 +92,11 @@ public:
 
     /// Get pointer to the decoded data with given template type. Returns `nullptr` if the
     /// ExtensionObject is either encoded or the decoded data not of type `T`.
+    /// Binary encoded bodies of type `T` are decoded on demand,
+    /// see getDecodedData(const UA_DataType&).
     template <typename T>
     T* getDecodedData() noexcept {
-        if (getDecodedDataType() == &getDataType<T>()) {
-            return static_cast<T*>(getDecodedData());
-        }
-        return nullptr;
+        return static_cast<T*>(getDecodedData(getDataType<T>()));
     }
 
     /// @copydoc getDecodedData
@@ -115,6 +114,15 @@ public:
 
     /// @copydoc getDecodedData
     const void* getDecodedData() const noexcept;
+
+    /// Get pointer to the decoded data of the given data type, decode on demand.
+    /// If the body is binary encoded with the encoding id of `type` (e.g. a passthrough data type,
+    /// see Server::setPassthroughDataTypes), it is decoded on the first call. The ExtensionObject
+    /// holds the decoded data afterwards, subsequent calls return the cached result.
+    /// Returns `nullptr` if the data is not of the given type or the decoding fails.
+    /// @note Decoding on demand is only supported since open62541 v1.3
+    /// @warning Type erased version, use with caution.
+    void* getDecodedData(const UA_DataType& type) noexcept;
 };
 
 }  // namespace opcua
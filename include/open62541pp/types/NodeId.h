@@ -5,12 +5,17 @@
 #include <functional>  // hash
 #include <string>
 #include <string_view>
+#include <type_traits>  // enable_if
 #include <variant>
+#include <vector>
 
 #include "open62541pp/Common.h"  // Type
 #include "open62541pp/NodeIds.h"
+#include "open62541pp/Result.h"
+#include "open62541pp/Span.h"
 #include "open62541pp/TypeWrapper.h"
 #include "open62541pp/detail/helper.h"
+#include "open62541pp/detail/traits.h"  // IsOneOf
 #include "open62541pp/open62541.h"
 #include "open62541pp/types/Builtin.h"
 
@@ -121,6 +126,24 @@ public:
     /// Encode NodeId as a string like `ns=1;s=SomeNode`.
     /// @see https://reference.opcfoundation.org/Core/Part6/v105/docs/5.3.1.10
     std::string toString() const;
+
+    /// Encode NodeId as a string into a caller-provided buffer without allocations.
+    /// Numbers are formatted with `std::to_chars`.
+    /// @return View of the encoded string in the buffer or
+    ///         BadResult (BadEncodingLimitsExceeded) if the buffer is too small
+    Result<std::string_view> toString(Span<char> buffer) const noexcept;
+
+    /// Parse NodeId from its string encoding like `ns=1;s=SomeNode` without exceptions.
+    /// The string is parsed in place, only String and ByteString identifiers are allocated.
+    /// @return Parsed NodeId or
+    ///         BadResult (BadNodeIdInvalid) if the string is not a valid encoding or
+    ///         BadResult (BadOutOfMemory) if the identifier can not be allocated
+    /// @see https://reference.opcfoundation.org/Core/Part6/v105/docs/5.3.1.10
+    static Result<NodeId> parse(std::string_view str) noexcept;
+
+    /// Parse many NodeIds from their string encodings, see parse().
+    /// @return Results in the order of the strings
+    static std::vector<Result<NodeId>> parseMany(Span<const std::string_view> strings);
 };
 
 /**
@@ -151,6 +174,63 @@ public:
     std::string toString() const;
 };
 
+/**
+ * Non-owning view of a NodeId with numeric or string identifier.
+ *
+ * NodeIdView is created without allocation (`constexpr` for numeric identifiers) and never
+ * destroys its identifier. It can be passed to every function expecting a `const NodeId&`.
+ * String identifiers are referenced and must outlive the view.
+ * @code
+ * static constexpr NodeIdView id(VariableId::Server_NamespaceArray);
+ * const auto value = services::readValue(server, id);
+ * @endcode
+ */
+class NodeIdView {
+public:
+    /// Create NodeIdView with numeric identifier.
+    constexpr NodeIdView(uint16_t namespaceIndex, uint32_t identifier) noexcept
+        : native_{namespaceIndex, UA_NODEIDTYPE_NUMERIC, {identifier}} {}
+
+    /// Create NodeIdView with String identifier (no copy).
+    NodeIdView(uint16_t namespaceIndex, std::string_view identifier) noexcept
+        : native_{namespaceIndex, UA_NODEIDTYPE_STRING, {}} {
+        native_.identifier.string = detail::toNativeString(identifier);
+    }
+
+    /// Create NodeIdView from the generated node id enums (DataTypeId, ObjectId, ...).
+    template <
+        typename T,
+        typename = std::enable_if_t<detail::IsOneOf<
+            T,
+            DataTypeId,
+            ReferenceTypeId,
+            ObjectTypeId,
+            VariableTypeId,
+            ObjectId,
+            VariableId,
+            MethodId>::value>>
+    constexpr NodeIdView(T id) noexcept  // NOLINT, implicit wanted
+        : NodeIdView(0, static_cast<uint32_t>(id)) {}
+
+    /// Get the referenced NodeId.
+    const NodeId& get() const noexcept {
+        return asWrapper<NodeId>(native_);
+    }
+
+    /// Implicit conversion to NodeId.
+    operator const NodeId&() const noexcept {  // NOLINT, implicit wanted
+        return get();
+    }
+
+    /// Return const pointer to native object.
+    constexpr const UA_NodeId* handle() const noexcept {
+        return &native_;
+    }
+
+private:
+    UA_NodeId native_;
+};
+
 }  // namespace opcua
 
 /* ---------------------------------- std::hash specializations --------------------------------- */
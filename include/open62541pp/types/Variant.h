@@ -1,10 +1,14 @@
 #pragma once
 
 #include <algorithm>  // transform
+#include <array>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
-#include <iterator>  // distance
+#include <cstring>  // memcpy
+#include <iterator>  // data, distance, size
+#include <memory>  // allocator, shared_ptr, uses_allocator
+#include <new>  // placement new
 #include <optional>
 #include <utility>  // as_const
 #include <vector>
@@ -13,10 +17,12 @@
 #include "open62541pp/ErrorHandling.h"
 #include "open62541pp/Span.h"
 #include "open62541pp/TypeConverter.h"
-#include "open62541pp/TypeRegistry.h"
 #include "open62541pp/TypeWrapper.h"
+#include "open62541pp/detail/ParallelCopy.h"
+#include "open62541pp/detail/helper.h"
 #include "open62541pp/detail/traits.h"
 #include "open62541pp/open62541.h"
+#include "open62541pp/typeregistry/Builtin.h"
 
 namespace opcua {
 
@@ -36,6 +42,9 @@ enum class VariantPolicy {
 // forward declarations
 class NodeId;
 
+template <typename T, size_t Rank>
+class ArrayView;
+
 namespace detail {
 template <VariantPolicy>
 struct VariantHandler;
@@ -195,6 +204,19 @@ public:
         return getScalarCopyImpl<T>();
     }
 
+    /// Get copy of scalar value with given allocator-aware template type, e.g. `std::pmr::string`.
+    /// The value is constructed with the allocator.
+    /// @exception BadVariantAccess If the variant is not a scalar or not convertible to `T`.
+    template <typename T, typename Allocator>
+    T getScalarCopy(const Allocator& allocator) const {
+        static_assert(std::uses_allocator_v<T, Allocator>, "T must be allocator-aware");
+        static_assert(detail::isConvertibleType<T>, "T must be convertible with TypeConverter");
+        using Native = typename TypeConverter<T>::NativeType;
+        T result(allocator);
+        TypeConverter<T>::fromNative(getScalar<Native>(), result);
+        return result;
+    }
+
     /// Get array length or 0 if variant is not an array.
     size_t getArrayLength() const noexcept;
 
@@ -232,9 +254,66 @@ public:
     template <typename T>
     std::vector<T> getArrayCopy() const {
         assertIsCopyableOrConvertible<T>();
-        return getArrayCopyImpl<T>();
+        return getArrayCopyImpl<T>(std::allocator<T>());
+    }
+
+    /**
+     * Get copy of array with given template type and return it as a std::vector with allocator.
+     * The elements are constructed with the allocator of the vector, e.g. to allocate the vector
+     * and its strings from the same memory resource:
+     * @code
+     * std::pmr::monotonic_buffer_resource resource;
+     * std::pmr::polymorphic_allocator<std::pmr::string> allocator(&resource);
+     * std::pmr::vector<std::pmr::string> strings = var.getArrayCopy<std::pmr::string>(allocator);
+     * @endcode
+     * @exception BadVariantAccess If the variant is not an array or not convertible to `T`.
+     */
+    template <typename T, typename Allocator>
+    std::vector<T, Allocator> getArrayCopy(const Allocator& allocator) const {
+        assertIsCopyableOrConvertible<T>();
+        return getArrayCopyImpl<T>(allocator);
     }
 
+    /**
+     * Move array with given template type out of the variant and return it as a std::vector.
+     * Owned data is transferred without deep copy of the elements: Pointer-free types are copied
+     * in one go, the element headers of other types (e.g. String, NodeId) are moved into the
+     * std::vector. Data that is not owned by the variant (no copy assignment) is copied.
+     * The variant is empty afterwards.
+     * @exception BadVariantAccess If the variant is not an array or not of type `T`.
+     */
+    template <typename T>
+    std::vector<T> getArrayMove() && {
+        assertIsNative<T>();
+        return getArrayMoveImpl<T>();
+    }
+
+    /**
+     * Get multi-dimensional view of the array with given template type (only native or wrapper
+     * types). The array dimensions are taken from getArrayDimensions (row-major order).
+     * One-dimensional arrays without array dimensions can be viewed with `Rank = 1`.
+     * @exception BadVariantAccess If the variant is not an array, not of type `T` or the array
+     *                             dimensions do not match `Rank`.
+     */
+    template <typename T, size_t Rank>
+    ArrayView<T, Rank> getArrayView();
+
+    /// @copydoc getArrayView
+    template <typename T, size_t Rank>
+    ArrayView<const T, Rank> getArrayView() const;
+
+    /**
+     * Get subset of the array specified by a numeric range.
+     * Contiguous subsets (ranges of the first dimension, full extent in all other dimensions) can
+     * be referenced without copy. Multi-dimensional subsets are only referenced if they cover the
+     * full array, because the array dimensions can not be borrowed otherwise.
+     * @tparam Policy Policy (@ref VariantPolicy) how to store the subset inside the result
+     * @exception BadStatus If the range is invalid or does not match the array dimensions
+     * @exception BadVariantAccess If the subset can not be referenced (`VariantPolicy::Reference`)
+     */
+    template <VariantPolicy Policy = VariantPolicy::Copy>
+    [[nodiscard]] Variant getRange(const NumericRange& range) const;
+
     /// Assign scalar value to variant (no copy).
     template <typename T>
     void setScalar(T& value) noexcept {
@@ -293,10 +372,17 @@ public:
      * Copy array to variant.
      * @param array Iterable container, for example `std::vector`, `std::list` or `Span`.
      *              The container must implement `begin()` and `end()`.
+     *              Contiguous containers of convertible types are converted in bulk if the
+     *              TypeConverter provides `toNativeArray`.
      */
     template <typename ArrayLike>
     void setArrayCopy(const ArrayLike& array) {
-        setArrayCopy(array.begin(), array.end());
+        if constexpr (detail::IsContiguousContainer<const ArrayLike&>::value) {
+            const auto* first = std::data(array);  // pointers enable bulk conversions
+            setArrayCopy(first, first + std::size(array));  // NOLINT
+        } else {
+            setArrayCopy(array.begin(), array.end());
+        }
     }
 
     /**
@@ -306,7 +392,12 @@ public:
      */
     template <typename ArrayLike>
     void setArrayCopy(const ArrayLike& array, const UA_DataType& dataType) {
-        setArrayCopy(array.begin(), array.end(), dataType);
+        if constexpr (detail::IsContiguousContainer<const ArrayLike&>::value) {
+            const auto* first = std::data(array);
+            setArrayCopy(first, first + std::size(array), dataType);  // NOLINT
+        } else {
+            setArrayCopy(array.begin(), array.end(), dataType);
+        }
     }
 
     /**
@@ -378,8 +469,13 @@ private:
 
     template <typename T>
     inline T getScalarCopyImpl() const;
+    template <typename T, typename Allocator>
+    inline std::vector<T, Allocator> getArrayCopyImpl(const Allocator& allocator) const;
     template <typename T>
-    inline std::vector<T> getArrayCopyImpl() const;
+    inline std::vector<T> getArrayMoveImpl();
+
+    Variant getRangeCopy(const NumericRange& range) const;
+    std::optional<Variant> getRangeReference(const NumericRange& range) const;
 
     template <typename T>
     inline void setScalarImpl(
@@ -413,9 +509,9 @@ T Variant::getScalarCopyImpl() const {
     }
 }
 
-template <typename T>
-std::vector<T> Variant::getArrayCopyImpl() const {
-    std::vector<T> result(handle()->arrayLength);
+template <typename T, typename Allocator>
+std::vector<T, Allocator> Variant::getArrayCopyImpl(const Allocator& allocator) const {
+    std::vector<T, Allocator> result(handle()->arrayLength, allocator);
     if constexpr (detail::isRegisteredType<T>) {
         auto native = getArray<T>();
         std::transform(native.begin(), native.end(), result.begin(), [](auto&& value) {
@@ -424,13 +520,63 @@ std::vector<T> Variant::getArrayCopyImpl() const {
     } else {
         using Native = typename TypeConverter<T>::NativeType;
         auto native = getArray<Native>();
-        for (size_t i = 0; i < native.size(); ++i) {
-            TypeConverter<T>::fromNative(native[i], result[i]);
+        if constexpr (detail::hasFromNativeArray<T>) {
+            TypeConverter<T>::fromNativeArray(native.data(), native.size(), result.data());
+        } else {
+            for (size_t i = 0; i < native.size(); ++i) {
+                TypeConverter<T>::fromNative(native[i], result[i]);
+            }
         }
     }
     return result;
 }
 
+template <typename T>
+std::vector<T> Variant::getArrayMoveImpl() {
+    auto native = getArray<T>();
+    if (handle()->storageType != UA_VARIANT_DATA || native.empty()) {
+        auto result = getArrayCopyImpl<T>(std::allocator<T>());
+        clear();
+        return result;
+    }
+    if constexpr (detail::isPointerFree<T>) {
+        std::vector<T> result(native.begin(), native.end());
+        clear();
+        return result;
+    } else {
+        // shallow copy of the element headers, the elements are owned by the vector afterwards
+        // default constructed elements do not own any memory and can be overwritten
+        std::vector<T> result(native.size());
+        std::memcpy(  // NOLINT
+            static_cast<void*>(result.data()),
+            native.data(),
+            native.size() * sizeof(T)
+        );
+        UA_free(handle()->data);  // NOLINT
+        handle()->data = nullptr;
+        handle()->arrayLength = 0;
+        clear();
+        return result;
+    }
+}
+
+template <VariantPolicy Policy>
+Variant Variant::getRange(const NumericRange& range) const {
+    if constexpr (Policy == VariantPolicy::Copy) {
+        return getRangeCopy(range);
+    } else {
+        auto result = getRangeReference(range);
+        if (result.has_value()) {
+            return std::move(*result);
+        }
+        if constexpr (Policy == VariantPolicy::Reference) {
+            throw BadVariantAccess("Numeric range can not be referenced, it is not contiguous");
+        } else {
+            return getRangeCopy(range);
+        }
+    }
+}
+
 template <typename T>
 void Variant::setScalarImpl(
     T* data, const UA_DataType& dataType, UA_VariantStorageType storageType
@@ -477,6 +623,27 @@ void Variant::setArrayCopyImpl(InputIt first, InputIt last, const UA_DataType& d
     using ValueType = typename std::iterator_traits<InputIt>::value_type;
     const size_t size = std::distance(first, last);
     auto native = detail::allocateArrayUniquePtr<ValueType>(size, dataType);
+    if constexpr (std::is_base_of_v<
+                      std::random_access_iterator_tag,
+                      typename std::iterator_traits<InputIt>::iterator_category>) {
+        if (!dataType.pointerFree && detail::isParallelCopyActive() &&
+            size >= detail::getParallelCopyThreshold()) {
+            throwIfBad(detail::forEachChunkParallel(size, [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    const auto status = UA_copy(&first[i], &native.get()[i], &dataType);  // NOLINT
+                    if (status != UA_STATUSCODE_GOOD) {
+                        return status;
+                    }
+                }
+                return UA_StatusCode{UA_STATUSCODE_GOOD};
+            }));
+            if (detail::isMemoryAccountingActive()) {
+                detail::recordNativeCopy(native.get(), size, dataType);
+            }
+            setArrayImpl(native.release(), size, dataType, UA_VARIANT_DATA);  // move ownership
+            return;
+        }
+    }
     std::transform(first, last, native.get(), [&](const ValueType& value) {
         return detail::copy(value, dataType);
     });
@@ -490,12 +657,398 @@ void Variant::setArrayCopyConvertImpl(InputIt first, InputIt last) {
     const auto& dataType = opcua::getDataType<Native>();
     const size_t size = std::distance(first, last);
     auto native = detail::allocateArrayUniquePtr<Native>(size, dataType);
-    for (size_t i = 0; i < size; ++i) {
-        TypeConverter<ValueType>::toNative(*first++, native.get()[i]);  // NOLINT
+    if constexpr (detail::hasToNativeArray<ValueType> && std::is_pointer_v<InputIt>) {
+        TypeConverter<ValueType>::toNativeArray(first, size, native.get());
+    } else {
+        for (size_t i = 0; i < size; ++i) {
+            TypeConverter<ValueType>::toNative(*first++, native.get()[i]);  // NOLINT
+        }
     }
     setArrayImpl(native.release(), size, dataType, UA_VARIANT_DATA);  // move ownership
 }
 
+/* ---------------------------------------- InlineVariant --------------------------------------- */
+
+/**
+ * Variant with inline storage for scalar values of pointer-free types.
+ *
+ * Variant::fromScalar and Variant::setScalarCopy allocate the scalar on the heap, even for small
+ * numeric types. InlineVariant stores the scalar in an internal buffer instead and references it
+ * with `UA_VARIANT_DATA_NODELETE`. No memory is allocated to create, copy or destroy the object.
+ *
+ * The underlying Variant can be passed to every function expecting a `const Variant&`:
+ * @code
+ * InlineVariant var(11.11);
+ * services::writeValue(server, id, var);
+ * @endcode
+ *
+ * @tparam Capacity Size of the inline buffer in bytes, large enough for `UA_Guid` by default
+ * @ingroup TypeWrapper
+ */
+template <size_t Capacity = sizeof(UA_Guid)>
+class InlineVariant {
+public:
+    InlineVariant() noexcept = default;
+
+    /// Create InlineVariant from scalar value.
+    template <
+        typename T,
+        typename = std::enable_if_t<!std::is_same_v<std::decay_t<T>, InlineVariant>>>
+    explicit InlineVariant(T value) noexcept {
+        setScalar(value);
+    }
+
+    InlineVariant(const InlineVariant& other) noexcept {
+        copyFrom(other);
+    }
+
+    InlineVariant& operator=(const InlineVariant& other) noexcept {
+        if (this != &other) {
+            copyFrom(other);
+        }
+        return *this;
+    }
+
+    ~InlineVariant() = default;
+
+    /// Store scalar value in the inline buffer (no allocation).
+    template <typename T>
+    void setScalar(T value) noexcept {
+        static_assert(
+            detail::isPointerFree<T> && detail::isRegisteredType<T>,
+            "InlineVariant can only store registered pointer-free types like integers and floats"
+        );
+        static_assert(sizeof(T) <= Capacity, "Type exceeds the capacity of the inline buffer");
+        static_assert(alignof(T) <= alignof(std::max_align_t));
+        T* ptr = new (storage_.data()) T(value);
+        variant_.setScalar(*ptr);
+    }
+
+    /// Get copy of the stored scalar value.
+    /// @exception BadVariantAccess If the variant is empty or not of type `T`.
+    template <typename T>
+    T getScalar() const {
+        return variant_.template getScalar<T>();
+    }
+
+    /// Check if the variant is empty.
+    bool isEmpty() const noexcept {
+        return variant_.isEmpty();
+    }
+
+    /// Get the underlying Variant that references the inline buffer.
+    const Variant& get() const noexcept {
+        return variant_;
+    }
+
+    /// Implicit conversion to the underlying Variant.
+    operator const Variant&() const noexcept {  // NOLINT, implicit wanted
+        return variant_;
+    }
+
+    /// Return pointer to the native object.
+    /// The data must not be reassigned, it is owned by the InlineVariant.
+    UA_Variant* handle() noexcept {
+        return variant_.handle();
+    }
+
+    /// Return const pointer to native object.
+    const UA_Variant* handle() const noexcept {
+        return variant_.handle();
+    }
+
+private:
+    void copyFrom(const InlineVariant& other) noexcept {
+        storage_ = other.storage_;
+        variant_ = Variant{};
+        if (!other.isEmpty()) {
+            variant_->type = other.variant_.getDataType();
+            variant_->storageType = UA_VARIANT_DATA_NODELETE;
+            variant_->data = storage_.data();
+        }
+    }
+
+    alignas(std::max_align_t) std::array<std::byte, Capacity> storage_{};
+    Variant variant_;
+};
+
+/* --------------------------------------- BorrowedVariant -------------------------------------- */
+
+/**
+ * Variant referencing the data of convertible types without copy.
+ *
+ * Convertible types like `std::string` are copied into their native representation by
+ * Variant::fromScalar and Variant::fromArray. For types with a `TypeConverter<T>::toNativeView`
+ * function, BorrowedVariant only creates the native headers (e.g. `UA_String`) and references the
+ * data of the original objects. The referenced objects must outlive the BorrowedVariant, which acts
+ * as a scope guard for the native headers:
+ * @code
+ * std::vector<std::string> values{"a", "b", "c"};
+ * const auto var = BorrowedVariant::fromArray(values);
+ * client.writeValue(id, var);
+ * @endcode
+ */
+class BorrowedVariant {
+public:
+    /// Create BorrowedVariant referencing a scalar value.
+    template <typename T>
+    [[nodiscard]] static BorrowedVariant fromScalar(const T& value) {
+        assertIsBorrowable<T>();
+        using NativeType = typename TypeConverter<T>::NativeType;
+        auto header = std::make_shared<NativeViewType<T>>(TypeConverter<T>::toNativeView(value));
+        BorrowedVariant result;
+        result.variant_.setScalar(*header, opcua::getDataType<NativeType>());
+        result.headers_ = std::move(header);
+        return result;
+    }
+
+    /// Create BorrowedVariant referencing the elements of an array (container).
+    template <typename ArrayLike>
+    [[nodiscard]] static BorrowedVariant fromArray(const ArrayLike& array) {
+        using ValueType = typename std::iterator_traits<decltype(std::begin(array))>::value_type;
+        assertIsBorrowable<ValueType>();
+        using NativeType = typename TypeConverter<ValueType>::NativeType;
+        auto headers = std::make_shared<std::vector<NativeViewType<ValueType>>>();
+        headers->reserve(std::size(array));
+        for (const auto& item : array) {
+            headers->push_back(TypeConverter<ValueType>::toNativeView(item));
+        }
+        BorrowedVariant result;
+        result.variant_.setArray(*headers, opcua::getDataType<NativeType>());
+        result.headers_ = std::move(headers);
+        return result;
+    }
+
+    /// Get the underlying Variant.
+    const Variant& get() const noexcept {
+        return variant_;
+    }
+
+    /// Implicit conversion to the underlying Variant.
+    operator const Variant&() const noexcept {  // NOLINT, implicit wanted
+        return variant_;
+    }
+
+    /// Return const pointer to native object.
+    const UA_Variant* handle() const noexcept {
+        return variant_.handle();
+    }
+
+private:
+    template <typename T>
+    using NativeViewType = decltype(TypeConverter<T>::toNativeView(std::declval<const T&>()));
+
+    template <typename T>
+    static constexpr void assertIsBorrowable() {
+        static_assert(
+            detail::isBorrowableType<T>,
+            "Type must provide a TypeConverter<T>::toNativeView function to be borrowed"
+        );
+    }
+
+    template <typename T, size_t Rank>
+    friend class ArrayView;
+
+    BorrowedVariant() = default;
+
+    std::shared_ptr<void> headers_;  // type-erased storage of the native headers
+    Variant variant_;
+};
+
+/* ----------------------------------------- ArrayView ------------------------------------------ */
+
+/**
+ * Non-owning, strided view of a multi-dimensional array.
+ *
+ * The view is created with Variant::getArrayView and indexes the array data in row-major order
+ * without copy. Slices of the view reference the same data. Contiguous views (e.g. slices of rows)
+ * can be referenced by a BorrowedVariant with toVariant().
+ * @code
+ * // 1080x1920 image
+ * auto image = var.getArrayView<uint8_t, 2>();
+ * uint8_t pixel = image(10, 20);
+ * auto rows = image.slice(0, 100, 50);  // rows 100-149
+ * auto cols = image.slice(1, 0, 640);  // columns 0-639 (strided)
+ * @endcode
+ */
+template <typename T, size_t Rank>
+class ArrayView {
+public:
+    static_assert(Rank > 0, "Rank must be greater than 0");
+
+    using Extents = std::array<size_t, Rank>;
+
+    /// Create view of a contiguous array in row-major order.
+    ArrayView(T* data, Extents extents) noexcept
+        : data_(data),
+          extents_(extents) {
+        size_t stride = 1;
+        for (size_t i = Rank; i > 0; --i) {
+            strides_[i - 1] = stride;
+            stride *= extents_[i - 1];
+        }
+    }
+
+    /// Create strided view.
+    ArrayView(T* data, Extents extents, Extents strides) noexcept
+        : data_(data),
+          extents_(extents),
+          strides_(strides) {}
+
+    /// Implicit conversion from view of non-const elements.
+    template <typename U, typename = std::enable_if_t<std::is_same_v<const U, T>>>
+    ArrayView(const ArrayView<U, Rank>& other) noexcept  // NOLINT, implicit wanted
+        : ArrayView(other.data(), other.extents(), other.strides()) {}
+
+    static constexpr size_t rank() noexcept {
+        return Rank;
+    }
+
+    /// Number of elements per dimension.
+    const Extents& extents() const noexcept {
+        return extents_;
+    }
+
+    /// Distance between two elements per dimension (in number of elements).
+    const Extents& strides() const noexcept {
+        return strides_;
+    }
+
+    /// Number of elements in the given dimension.
+    size_t extent(size_t dim) const noexcept {
+        return extents_[dim];
+    }
+
+    /// Distance between two elements in the given dimension (in number of elements).
+    size_t stride(size_t dim) const noexcept {
+        return strides_[dim];
+    }
+
+    /// Total number of elements.
+    size_t size() const noexcept {
+        size_t result = 1;
+        for (size_t extent : extents_) {
+            result *= extent;
+        }
+        return result;
+    }
+
+    bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    /// Pointer to the first element.
+    T* data() const noexcept {
+        return data_;
+    }
+
+    /// Check if the elements are stored contiguously in row-major order.
+    bool isContiguous() const noexcept {
+        size_t stride = 1;
+        for (size_t i = Rank; i > 0; --i) {
+            if (extents_[i - 1] > 1 && strides_[i - 1] != stride) {
+                return false;
+            }
+            stride *= extents_[i - 1];
+        }
+        return true;
+    }
+
+    /// Access element by indices (one index per dimension, no bounds checking).
+    template <typename... Indices>
+    T& operator()(Indices... indices) const noexcept {
+        static_assert(sizeof...(Indices) == Rank, "Number of indices must match the rank");
+        const std::array<size_t, Rank> index{static_cast<size_t>(indices)...};
+        size_t offset = 0;
+        for (size_t i = 0; i < Rank; ++i) {
+            offset += index[i] * strides_[i];
+        }
+        return data_[offset];  // NOLINT
+    }
+
+    /// Access element (`Rank = 1`) or sub-view of lower rank (`Rank > 1`), no bounds checking.
+    decltype(auto) operator[](size_t index) const noexcept {
+        if constexpr (Rank == 1) {
+            return (data_[index * strides_[0]]);  // NOLINT
+        } else {
+            typename ArrayView<T, Rank - 1>::Extents extents{};
+            typename ArrayView<T, Rank - 1>::Extents strides{};
+            std::copy(extents_.begin() + 1, extents_.end(), extents.begin());
+            std::copy(strides_.begin() + 1, strides_.end(), strides.begin());
+            return ArrayView<T, Rank - 1>(data_ + index * strides_[0], extents, strides);  // NOLINT
+        }
+    }
+
+    /**
+     * Get slice of `count` elements starting at `first` in the given dimension.
+     * @exception BadStatus (BadIndexRangeInvalid) If the range exceeds the extent
+     */
+    ArrayView slice(size_t dim, size_t first, size_t count) const {
+        if (dim >= Rank || first + count > extents_[dim]) {
+            throw BadStatus(UA_STATUSCODE_BADINDEXRANGEINVALID);
+        }
+        Extents extents = extents_;
+        extents[dim] = count;
+        return {data_ + first * strides_[dim], extents, strides_};  // NOLINT
+    }
+
+    /**
+     * Create BorrowedVariant referencing the elements of the view (no copy).
+     * The array dimensions are set according to the extents.
+     * @exception BadStatus (BadNotSupported) If the view is not contiguous
+     */
+    BorrowedVariant toVariant() const {
+        using ValueType = std::remove_const_t<T>;
+        if (!isContiguous()) {
+            throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+        }
+        auto dimensions = std::make_shared<std::array<uint32_t, Rank>>();
+        std::transform(extents_.begin(), extents_.end(), dimensions->begin(), [](size_t extent) {
+            return static_cast<uint32_t>(extent);
+        });
+        BorrowedVariant result;
+        result.variant_.setArray(
+            Span<ValueType>(const_cast<ValueType*>(data_), size()),  // NOLINT, read-only
+            opcua::getDataType<ValueType>()
+        );
+        if constexpr (Rank > 1) {
+            result.variant_->arrayDimensionsSize = Rank;
+            result.variant_->arrayDimensions = dimensions->data();  // not freed (NODELETE)
+        }
+        result.headers_ = std::move(dimensions);
+        return result;
+    }
+
+private:
+    T* data_;
+    Extents extents_;
+    Extents strides_{};
+};
+
+template <typename T, size_t Rank>
+ArrayView<T, Rank> Variant::getArrayView() {
+    auto array = getArray<T>();
+    const auto dimensions = getArrayDimensions();
+    typename ArrayView<T, Rank>::Extents extents{};
+    if (dimensions.empty() && Rank == 1) {
+        extents[0] = array.size();
+    } else if (dimensions.size() == Rank) {
+        std::copy(dimensions.begin(), dimensions.end(), extents.begin());
+    } else {
+        throw BadVariantAccess("Variant array dimensions do not match the rank");
+    }
+    ArrayView<T, Rank> view(array.data(), extents);
+    if (view.size() > array.size()) {
+        throw BadVariantAccess("Variant array dimensions exceed the array length");
+    }
+    return view;
+}
+
+template <typename T, size_t Rank>
+ArrayView<const T, Rank> Variant::getArrayView() const {
+    return const_cast<Variant*>(this)->getArrayView<T, Rank>();  // NOLINT
+}
+
 /* --------------------------------------- Variant handler -------------------------------------- */
 
 namespace detail {
@@ -3,6 +3,7 @@
 #include <string_view>
 #include <utility>  // move
 
+#include "open62541pp/CredentialStore.h"
 #include "open62541pp/open62541.h"
 #include "open62541pp/types/DateTime.h"
 #include "open62541pp/types/ExtensionObject.h"
@@ -32,7 +33,7 @@ std::vector<UserTokenPolicy> AccessControlDefault::getUserTokenPolicies() {
             securityPolicyUri
         );
     }
-    if (!logins_.empty()) {
+    if (!logins_.empty() || credentials_ != nullptr) {
         result.emplace_back(
             policyIdUsername,
             UserTokenType::Username,
@@ -87,6 +88,11 @@ StatusCode AccessControlDefault::activateSession(
         if (token->getUserName().empty() && token->getPassword().empty()) {
             return UA_STATUSCODE_BADIDENTITYTOKENINVALID;
         }
+        if (credentials_ != nullptr) {
+            return credentials_->verify(token->getUserName(), token->getPassword().get())
+                ? UA_STATUSCODE_GOOD
+                : UA_STATUSCODE_BADUSERACCESSDENIED;
+        }
         // try to match username / password
         for (const auto& login : logins_) {
             if ((login.username == token->getUserName()) &&
@@ -0,0 +1,245 @@
+#include "open62541pp/AddressSpaceIndex.h"
+
+#include <algorithm>  // lower_bound, sort
+#include <memory>
+#include <utility>  // move
+
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/detail/ServerContext.h"
+#include "open62541pp/services/Attribute_highlevel.h"
+#include "open62541pp/types/Composed.h"
+
+#include "open62541_impl.h"
+
+namespace opcua {
+
+static std::string getBrowseNameKey(const QualifiedName& browseName) {
+    std::string key = std::to_string(browseName.getNamespaceIndex());
+    key += ':';
+    key += browseName.getName();
+    return key;
+}
+
+static bool isTypeNodeClass(NodeClass nodeClass) noexcept {
+    return nodeClass == NodeClass::ObjectType || nodeClass == NodeClass::VariableType;
+}
+
+/// Browse the hierarchical children of a node, bypassing the browse cache.
+static BrowseResult browseChildren(Server& server, const NodeId& id) {
+    const BrowseDescription bd(
+        id,
+        BrowseDirection::Forward,
+        ReferenceTypeId::HierarchicalReferences,
+        true,
+        NodeClass::Unspecified,
+        BrowseResultMask::NodeClass | BrowseResultMask::BrowseName |
+            BrowseResultMask::TypeDefinition
+    );
+    return UA_Server_browse(server.handle(), 0, bd.handle());
+}
+
+AddressSpaceIndex::AddressSpaceIndex(Server& server)
+    : server_(server) {
+    rebuild();
+}
+
+void AddressSpaceIndex::rebuild() {
+    const std::lock_guard lock(mutex_);
+    build();
+}
+
+void AddressSpaceIndex::update() const {
+    if (generation_ != detail::getContext(server_).addressSpaceGeneration.load()) {
+        build();
+    }
+}
+
+void AddressSpaceIndex::build() const {
+    // read the generation first, changes during the walk trigger another rebuild
+    generation_ = detail::getContext(server_).addressSpaceGeneration.load();
+    entries_.clear();
+    positions_.clear();
+    byTypeDefinition_.clear();
+    byBrowseName_.clear();
+
+    const auto add = [&](NodeId id,
+                         NodeClass nodeClass,
+                         const QualifiedName& browseName,
+                         const NodeId& typeDefinition) {
+        const auto position = static_cast<uint32_t>(entries_.size());
+        positions_.emplace(id, position);
+        if (!typeDefinition.isNull()) {
+            byTypeDefinition_[typeDefinition].push_back(position);
+        }
+        byBrowseName_[getBrowseNameKey(browseName)].push_back(position);
+        entries_.push_back({std::move(id), nodeClass, position + 1});
+        return position;
+    };
+
+    struct Frame {
+        uint32_t position;
+        BrowseResult children;
+        size_t next;
+    };
+
+    const NodeId rootId(ObjectId::RootFolder);
+    std::vector<Frame> stack;
+    stack.push_back(
+        {add(rootId,
+             services::readNodeClass(server_, rootId),
+             services::readBrowseName(server_, rootId),
+             NodeId(ObjectTypeId::FolderType)),
+         browseChildren(server_, rootId),
+         0}
+    );
+    while (!stack.empty()) {
+        auto& frame = stack.back();
+        const auto refs = frame.children.getReferences();
+        if (frame.next >= refs.size()) {
+            entries_[frame.position].end = static_cast<uint32_t>(entries_.size());
+            stack.pop_back();
+            continue;
+        }
+        auto& ref = refs[frame.next++];
+        if (!ref.getNodeId().isLocal() || positions_.count(ref.getNodeId().getNodeId()) > 0) {
+            continue;
+        }
+        auto children = browseChildren(server_, ref.getNodeId().getNodeId());
+        const auto position = add(
+            std::move(ref.getNodeId().getNodeId()),
+            ref.getNodeClass(),
+            ref.getBrowseName(),
+            ref.getTypeDefinition().getNodeId()
+        );
+        stack.push_back({position, std::move(children), 0});  // invalidates frame
+    }
+}
+
+uint32_t AddressSpaceIndex::getPosition(const NodeId& id) const {
+    const auto it = positions_.find(id);
+    if (it == positions_.end()) {
+        throw BadStatus(UA_STATUSCODE_BADNODEIDUNKNOWN);
+    }
+    return it->second;
+}
+
+void AddressSpaceIndex::collect(
+    const Bucket& bucket, uint32_t begin, uint32_t end, std::vector<uint32_t>& out
+) const {
+    for (auto it = std::lower_bound(bucket.begin(), bucket.end(), begin);
+         it != bucket.end() && *it < end;
+         ++it) {
+        out.push_back(*it);
+    }
+}
+
+std::vector<NodeId> AddressSpaceIndex::toNodeIds(const std::vector<uint32_t>& positions) const {
+    std::vector<NodeId> result;
+    result.reserve(positions.size());
+    for (const auto position : positions) {
+        result.push_back(entries_[position].id);
+    }
+    return result;
+}
+
+size_t AddressSpaceIndex::size() const {
+    const std::lock_guard lock(mutex_);
+    update();
+    return entries_.size();
+}
+
+bool AddressSpaceIndex::contains(const NodeId& id) const {
+    const std::lock_guard lock(mutex_);
+    update();
+    return positions_.count(id) > 0;
+}
+
+bool AddressSpaceIndex::isInSubtree(const NodeId& id, const NodeId& rootId) const {
+    const std::lock_guard lock(mutex_);
+    update();
+    const auto node = positions_.find(id);
+    const auto root = positions_.find(rootId);
+    if (node == positions_.end() || root == positions_.end()) {
+        return false;
+    }
+    return node->second >= root->second && node->second < entries_[root->second].end;
+}
+
+std::vector<NodeId> AddressSpaceIndex::getSubtree(const NodeId& rootId) const {
+    const std::lock_guard lock(mutex_);
+    update();
+    const auto begin = getPosition(rootId);
+    const auto end = entries_[begin].end;
+    std::vector<NodeId> result;
+    result.reserve(end - begin);
+    for (auto position = begin; position < end; ++position) {
+        result.push_back(entries_[position].id);
+    }
+    return result;
+}
+
+std::vector<NodeId> AddressSpaceIndex::findByTypeDefinition(
+    const NodeId& typeDefinition, const NodeId& rootId, bool includeSubtypes
+) const {
+    const std::lock_guard lock(mutex_);
+    update();
+    const auto begin = getPosition(rootId);
+    const auto end = entries_[begin].end;
+    std::vector<uint32_t> positions;
+    const auto collectType = [&](const NodeId& type) {
+        if (const auto it = byTypeDefinition_.find(type); it != byTypeDefinition_.end()) {
+            collect(it->second, begin, end, positions);
+        }
+    };
+    collectType(typeDefinition);
+    if (includeSubtypes) {
+        // subtypes are descendants of the type (HasSubtype is a hierarchical reference)
+        if (const auto type = positions_.find(typeDefinition); type != positions_.end()) {
+            for (auto position = type->second + 1; position < entries_[type->second].end;
+                 ++position) {
+                if (isTypeNodeClass(entries_[position].nodeClass)) {
+                    collectType(entries_[position].id);
+                }
+            }
+            std::sort(positions.begin(), positions.end());
+        }
+    }
+    return toNodeIds(positions);
+}
+
+std::vector<NodeId> AddressSpaceIndex::findByBrowseName(
+    const QualifiedName& browseName, const NodeId& rootId
+) const {
+    const std::lock_guard lock(mutex_);
+    update();
+    const auto begin = getPosition(rootId);
+    const auto end = entries_[begin].end;
+    std::vector<uint32_t> positions;
+    if (const auto it = byBrowseName_.find(getBrowseNameKey(browseName));
+        it != byBrowseName_.end()) {
+        collect(it->second, begin, end, positions);
+    }
+    return toNodeIds(positions);
+}
+
+/* ------------------------------------------- Server ------------------------------------------- */
+
+AddressSpaceIndex& Server::getAddressSpaceIndex() {
+    auto& context = detail::getContext(*this);
+    {
+        const std::lock_guard lock(context.mutex);
+        if (context.addressSpaceIndex != nullptr) {
+            return *context.addressSpaceIndex;
+        }
+    }
+    // build the index without holding the lock
+    auto created = std::make_shared<AddressSpaceIndex>(*this);
+    const std::lock_guard lock(context.mutex);
+    if (context.addressSpaceIndex == nullptr) {
+        context.addressSpaceIndex = std::move(created);
+    }
+    return *context.addressSpaceIndex;
+}
+
+}  // namespace opcua
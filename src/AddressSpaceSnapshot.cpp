@@ -0,0 +1,149 @@
+#include "open62541pp/AddressSpaceSnapshot.h"
+
+#include <atomic>  // atomic_load, atomic_store for shared_ptr
+#include <utility>  // move
+
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/services/Attribute.h"
+#include "open62541pp/services/View.h"
+#include "open62541pp/types/Composed.h"
+
+namespace opcua {
+
+const AddressSpaceSnapshot::Node* AddressSpaceSnapshot::View::find(
+    const NodeId& id
+) const noexcept {
+    const auto it = index_.find(id);
+    return it == index_.end() ? nullptr : nodes_[it->second].get();
+}
+
+void AddressSpaceSnapshot::View::clear() noexcept {
+    roots_.clear();
+    nodes_.clear();
+    index_.clear();  // keeps the buckets
+}
+
+AddressSpaceSnapshot::AddressSpaceSnapshot(std::vector<NodeId> roots)
+    : roots_(std::move(roots)),
+      current_(std::make_shared<View>()) {
+    current_->roots_ = roots_;
+}
+
+namespace {
+
+struct PendingNode {
+    NodeId id;
+    NodeClass nodeClass;
+    QualifiedName browseName;
+    LocalizedText displayName;
+};
+
+}  // namespace
+
+size_t AddressSpaceSnapshot::refresh(Server& server) {
+    std::shared_ptr<View> previous = std::atomic_load(&current_);
+    std::shared_ptr<View> next;
+    // the spare view is not published anymore, its use count can only decrease
+    if (spare_ != nullptr && spare_.use_count() == 1) {
+        next = std::move(spare_);
+        next->clear();
+    } else {
+        spare_.reset();
+        next = std::make_shared<View>();
+    }
+    next->roots_ = roots_;
+    next->timestamp_ = DateTime::now();
+
+    std::vector<PendingNode> queue;
+    for (const auto& root : roots_) {
+        if (next->index_.count(root) > 0) {
+            continue;
+        }
+        try {
+            queue.push_back(
+                {root,
+                 services::readNodeClass(server, root),
+                 services::readBrowseName(server, root),
+                 services::readDisplayName(server, root)}
+            );
+        } catch (const BadStatus&) {
+            continue;  // unknown root node
+        }
+        next->index_.emplace(root, queue.size() - 1);
+    }
+
+    size_t copied = 0;
+    for (size_t i = 0; i < queue.size(); ++i) {
+        const NodeId id = queue[i].id;  // queue might grow
+
+        std::vector<NodeId> children;
+        const BrowseDescription bd(
+            id,
+            BrowseDirection::Forward,
+            ReferenceTypeId::HierarchicalReferences,
+            true,
+            NodeClass::Unspecified,
+            BrowseResultMask::NodeClass | BrowseResultMask::BrowseName |
+                BrowseResultMask::DisplayName
+        );
+        for (const auto& ref : services::browseAll(server, bd)) {
+            if (!ref.getNodeId().isLocal()) {
+                continue;
+            }
+            const auto& childId = ref.getNodeId().getNodeId();
+            children.push_back(childId);
+            if (next->index_.emplace(childId, queue.size()).second) {
+                queue.push_back(
+                    {childId, ref.getNodeClass(), ref.getBrowseName(), ref.getDisplayName()}
+                );
+            }
+        }
+
+        auto& pending = queue[i];
+        const Node* prev = previous->find(id);
+        const bool sameAttributes = prev != nullptr && prev->nodeClass == pending.nodeClass &&
+                                    prev->browseName == pending.browseName &&
+                                    prev->displayName == pending.displayName &&
+                                    prev->children == children;
+        bool sameValue = true;
+        DataValue value;
+        if (pending.nodeClass == NodeClass::Variable) {
+            try {
+                services::withDataValue(server, id, [&](const DataValue& stored) {
+                    sameValue = prev != nullptr && prev->value == stored;
+                    if (!sameValue || !sameAttributes) {
+                        value = stored;  // copy only if the node changed
+                    }
+                });
+            } catch (const BadStatus& e) {
+                sameValue = prev != nullptr && prev->value.getStatus() == e.code();
+                value.setStatus(e.code());
+            }
+        }
+
+        if (sameAttributes && sameValue) {
+            next->nodes_.push_back(previous->nodes_[previous->index_.find(id)->second]);
+            continue;
+        }
+        next->nodes_.push_back(std::make_shared<const Node>(Node{
+            std::move(pending.id),
+            pending.nodeClass,
+            std::move(pending.browseName),
+            std::move(pending.displayName),
+            std::move(value),
+            std::move(children),
+        }));
+        ++copied;
+    }
+
+    std::atomic_store(&current_, next);
+    spare_ = std::move(previous);
+    return copied;
+}
+
+std::shared_ptr<const AddressSpaceSnapshot::View> AddressSpaceSnapshot::get() const noexcept {
+    return std::atomic_load(&current_);
+}
+
+}  // namespace opcua
@@ -0,0 +1,104 @@
+#include "open62541pp/detail/AdmissionControl.h"
+
+#include <algorithm>  // min
+
+#include "open62541pp/Config.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/detail/ServerContext.h"
+
+#include "CustomAccessControl.h"  // findServer, getSessionEntry, SessionEntry
+#include "open62541_impl.h"
+
+namespace opcua {
+
+namespace detail {
+
+// number of controllers with operation limits of all servers, skip the lookup if zero
+static std::atomic<size_t> enabledControllers{0};
+
+AdmissionController::~AdmissionController() {
+    if (isEnabled()) {
+        enabledControllers.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+void AdmissionController::setLimits(const AdmissionLimits& limits) noexcept {
+    const bool wasEnabled = isEnabled();
+    const bool enabled = limits.maxOperationsPerSession > 0 || limits.maxReadsPerIteration > 0;
+    limits_ = limits;
+    enabled_.store(enabled, std::memory_order_relaxed);
+    if (enabled && !wasEnabled) {
+        enabledControllers.fetch_add(1, std::memory_order_relaxed);
+    } else if (!enabled && wasEnabled) {
+        enabledControllers.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+UA_StatusCode AdmissionController::admit(
+    UA_Server* server, void* sessionContext, bool read
+) noexcept {
+    auto* session = getSessionEntry(server, sessionContext);
+    if (session != nullptr && limits_.maxOperationsPerSession > 0) {
+        if (session->admissionIteration != iteration_) {
+            session->admissionIteration = iteration_;
+            session->admittedOperations = 0;
+        }
+        if (session->admittedOperations >= limits_.maxOperationsPerSession) {
+            rejectedOperations_.fetch_add(1, std::memory_order_relaxed);
+            return UA_STATUSCODE_BADTOOMANYOPERATIONS;
+        }
+        ++session->admittedOperations;
+    }
+    if (read && limits_.maxReadsPerIteration > 0) {
+        if (reads_ >= limits_.maxReadsPerIteration) {
+            rejectedReads_.fetch_add(1, std::memory_order_relaxed);
+            return UA_STATUSCODE_BADRESOURCEUNAVAILABLE;
+        }
+        ++reads_;
+    }
+    return UA_STATUSCODE_GOOD;
+}
+
+void AdmissionController::snapshot(AdmissionMetrics& metrics) const noexcept {
+    metrics.rejectedOperations = rejectedOperations_.load(std::memory_order_relaxed);
+    metrics.rejectedReads = rejectedReads_.load(std::memory_order_relaxed);
+}
+
+void AdmissionController::reset() noexcept {
+    rejectedOperations_.store(0, std::memory_order_relaxed);
+    rejectedReads_.store(0, std::memory_order_relaxed);
+}
+
+AdmissionController* getAdmissionController(UA_Server* server) noexcept {
+    if (enabledControllers.load(std::memory_order_relaxed) == 0) {
+        return nullptr;
+    }
+    auto* wrapper = findServer(server);
+    if (wrapper == nullptr) {
+        return nullptr;
+    }
+    auto& controller = getContext(*wrapper).admission;
+    return controller.isEnabled() ? &controller : nullptr;
+}
+
+}  // namespace detail
+
+void Server::setAdmissionLimits(const AdmissionLimits& limits) {
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+    if (limits.maxNotificationQueueSize > 0) {
+        auto* config = UA_Server_getConfig(handle());
+        config->queueSizeLimits.max = limits.maxNotificationQueueSize;
+        config->queueSizeLimits.min = std::min(
+            config->queueSizeLimits.min, limits.maxNotificationQueueSize
+        );
+        config->maxRetransmissionQueueSize = limits.maxNotificationQueueSize;
+    }
+#endif
+    detail::getContext(*this).admission.setLimits(limits);
+}
+
+AdmissionLimits Server::getAdmissionLimits() {
+    return detail::getContext(*this).admission.getLimits();
+}
+
+}  // namespace opcua
@@ -0,0 +1,243 @@
+#include "open62541pp/Aggregator.h"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+#include <iterator>  // size
+#include <string>
+#include <utility>  // move
+
+#include "open62541pp/Client.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Node.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/ValueBackend.h"
+#include "open62541pp/services/Attribute.h"
+#include "open62541pp/services/detail/AttributeHandler.h"
+#include "open62541pp/types/Composed.h"
+
+#include "open62541_impl.h"
+
+namespace opcua {
+
+struct Aggregator::Source {
+    Client* client{};
+    std::vector<uint16_t> namespaces;  // local namespace index by remote namespace index
+    std::unique_ptr<WriteBatcher> writer;
+    uint32_t subscriptionId{0};
+    std::vector<ValueSlot*> slots;  // by client handle of the monitored items
+};
+
+Aggregator::Aggregator(Server& server, AggregatorOptions options)
+    : server_(server),
+      options_(std::move(options)) {}
+
+Aggregator::~Aggregator() {
+    // reset the data sources first, the callbacks reference the slots and the sources
+    // (reads fail with BadInternalError, writes with BadWriteNotSupported)
+    for (const auto& [localId, slot] : slots_) {
+        UA_DataSource dataSource{};
+        UA_Server_setVariableNode_dataSource(server_.handle(), localId, dataSource);
+    }
+    // deletes the monitored items and the batch callback, which references the source
+    for (const auto& source : sources_) {
+        try {
+            services::deleteSubscription(*source->client, source->subscriptionId);
+        } catch (...) {  // NOLINT(bugprone-empty-catch)
+            // disconnected, the subscription was deleted with the session
+        }
+    }
+}
+
+size_t Aggregator::addSource(Client& client, std::string_view namespacePrefix) {
+    auto source = std::make_unique<Source>();
+    source->client = &client;
+    for (const auto& uri : client.getNamespaceArray()) {
+        const auto localUri = std::string(namespacePrefix).append(uri);
+        source->namespaces.push_back(server_.registerNamespace(localUri));
+    }
+    source->writer = std::make_unique<WriteBatcher>(client, options_.writes);
+
+    auto* sourcePtr = source.get();
+    auto parameters = options_.subscription;
+    source->subscriptionId = services::createSubscription(
+        client,
+        parameters,
+        true,
+        {},
+        [sourcePtr](uint32_t /* subId */, Span<services::MonitoredItemNotification> notifications) {
+            for (auto& notification : notifications) {
+                if (notification.clientHandle < sourcePtr->slots.size()) {
+                    auto* slot = sourcePtr->slots[notification.clientHandle];
+                    if (slot != nullptr) {
+                        slot->publish(std::move(notification.value));
+                    }
+                }
+            }
+        }
+    );
+    sources_.push_back(std::move(source));
+    return sources_.size() - 1;
+}
+
+NodeId Aggregator::getLocalId(size_t source, const NodeId& remoteId) const {
+    const auto& namespaces = sources_.at(source)->namespaces;
+    const auto ns = remoteId.getNamespaceIndex();
+    if (ns >= namespaces.size()) {
+        throw BadStatus(UA_STATUSCODE_BADNODEIDINVALID);
+    }
+    NodeId localId(remoteId);
+    localId->namespaceIndex = namespaces[ns];
+    return localId;
+}
+
+template <AttributeId Attribute>
+static auto getAttribute(const DataValue& dv) {
+    return services::detail::AttributeHandler<Attribute>::fromDataValue(DataValue(dv));
+}
+
+static StatusCode readCache(ValueSlot& slot, DataValue& dv, bool timestamp) noexcept {
+    const auto& latest = slot.acquire();
+    if (!latest->hasValue && !latest->hasStatus) {
+        return UA_STATUSCODE_BADWAITINGFORINITIALDATA;
+    }
+    // deep copy, the slot reuses the value with the next publish after the next acquire
+    UA_DataValue& native = *dv.handle();
+    UA_DataValue_clear(&native);
+    if (const auto status = UA_DataValue_copy(latest.handle(), &native);
+        status != UA_STATUSCODE_GOOD) {
+        return status;
+    }
+    native.hasServerTimestamp = false;
+    if (!timestamp) {
+        native.hasSourceTimestamp = false;
+        native.hasSourcePicoseconds = false;
+    }
+    return UA_STATUSCODE_GOOD;  // downstream status is returned in the DataValue
+}
+
+std::vector<NodeId> Aggregator::mirror(
+    size_t source, const NodeId& parentId, Span<const NodeId> remoteIds
+) {
+    auto& src = *sources_.at(source);
+    auto& client = *src.client;
+
+    // read the attributes of all variables with a single (batched) request
+    constexpr AttributeId attributes[] = {
+        AttributeId::NodeClass,
+        AttributeId::BrowseName,
+        AttributeId::DisplayName,
+        AttributeId::DataType,
+        AttributeId::ValueRank,
+        AttributeId::AccessLevel,
+    };
+    constexpr size_t attributeCount = std::size(attributes);
+    std::vector<ReadValueId> items;
+    items.reserve(remoteIds.size() * attributeCount);
+    for (const auto& id : remoteIds) {
+        for (const auto attribute : attributes) {
+            items.emplace_back(id, attribute);
+        }
+    }
+    const auto response = services::read(client, items);
+    throwIfBad(response.getResponseHeader().getServiceResult());
+    const auto results = response.getResults();
+    if (results.size() != items.size()) {
+        throw BadStatus(UA_STATUSCODE_BADUNEXPECTEDERROR);
+    }
+
+    std::vector<NodeId> localIds(remoteIds.size());
+    std::vector<ReadValueId> itemsToMonitor;
+    std::vector<ValueSlot*> slots;
+    for (size_t i = 0; i < remoteIds.size(); ++i) {
+        const auto* values = &results[i * attributeCount];
+        const auto isGood = [&](size_t index) {
+            return values[index].getStatus().isGood() && values[index].hasValue();
+        };
+        if (!isGood(0) || !isGood(1) || !isGood(3) ||
+            getAttribute<AttributeId::NodeClass>(values[0]) != NodeClass::Variable) {
+            continue;  // not a (readable) variable
+        }
+        const auto localId = getLocalId(source, remoteIds[i]);
+        if (slots_.count(localId) != 0) {
+            continue;  // mirrored before
+        }
+
+        VariableAttributes attr;
+        const auto browseName = getAttribute<AttributeId::BrowseName>(values[1]);
+        if (isGood(2)) {
+            attr.setDisplayName(getAttribute<AttributeId::DisplayName>(values[2]));
+        }
+        attr.setDataType(getAttribute<AttributeId::DataType>(values[3]));
+        if (isGood(4)) {
+            attr.setValueRank(getAttribute<AttributeId::ValueRank>(values[4]));
+        }
+        if (isGood(5)) {
+            attr.setAccessLevel(getAttribute<AttributeId::AccessLevel>(values[5]));
+        }
+        try {
+            server_.getNode(parentId).addVariable(localId, browseName.getName(), attr);
+        } catch (const BadStatus&) {
+            continue;
+        }
+
+        auto& slot = *slots_.emplace(localId, std::make_unique<ValueSlot>()).first->second;
+        ValueBackendDataSource backend;
+        backend.read = [ptr = &slot](DataValue& dv, const NumericRange&, bool timestamp) {
+            return readCache(*ptr, dv, timestamp);
+        };
+        backend.write = [this, srcPtr = &src, remoteId = remoteIds[i], localId](
+                            const DataValue& value, const NumericRange& range
+                        ) -> StatusCode {
+            if (!range.empty()) {
+                return UA_STATUSCODE_BADWRITENOTSUPPORTED;
+            }
+            // forwarded by the client's loop, thread-safe
+            srcPtr->client->post([this, srcPtr, remoteId, localId, value] {
+                srcPtr->writer->writeAttributeAsync(
+                    remoteId,
+                    AttributeId::Value,
+                    value,
+                    [this, localId](StatusCode code) {
+                        if (options_.onWriteResult) {
+                            options_.onWriteResult(localId, code);
+                        }
+                    }
+                );
+            });
+            return UA_STATUSCODE_GOOD;
+        };
+        backend.applyReadRange = true;
+        server_.setVariableNodeValueBackend(localId, std::move(backend));
+
+        localIds[i] = localId;
+        itemsToMonitor.emplace_back(remoteIds[i], AttributeId::Value);
+        slots.push_back(&slot);
+    }
+
+    if (itemsToMonitor.empty()) {
+        return localIds;
+    }
+    const auto monitored = services::createMonitoredItemsDataChange(
+        client,
+        src.subscriptionId,
+        itemsToMonitor,
+        MonitoringMode::Reporting,
+        options_.monitoring,
+        {}  // notifications are delivered in batches to the subscription
+    );
+    for (size_t i = 0; i < monitored.size(); ++i) {
+        const auto handle = monitored[i].clientHandle;
+        if (!monitored[i].statusCode.isGood() || handle == opcua::detail::HandlePool::invalid) {
+            continue;  // served from the cache with BadWaitingForInitialData
+        }
+        if (src.slots.size() <= handle) {
+            src.slots.resize(handle + 1, nullptr);
+        }
+        src.slots[handle] = slots[i];
+    }
+    return localIds;
+}
+
+}  // namespace opcua
+
+#endif
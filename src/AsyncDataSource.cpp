@@ -0,0 +1,150 @@
+#include "open62541pp/AsyncDataSource.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <utility>  // move
+
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/ValueBackend.h"
+#include "open62541pp/open62541.h"
+#include "open62541pp/types/DateTime.h"
+
+namespace opcua {
+
+namespace detail {
+
+struct AsyncDataSourceState {
+    using Clock = std::chrono::steady_clock;
+
+    /// Begin a new device read, if none is pending or the pending read timed out.
+    /// Requires the lock.
+    std::optional<uint64_t> tryBegin(Clock::time_point now, std::chrono::milliseconds timeout) {
+        if (pending && now - requested < timeout) {
+            return std::nullopt;
+        }
+        pending = true;
+        requested = now;
+        return ++requestId;
+    }
+
+    void finish(uint64_t id, DataValue* result, StatusCode code) {
+        {
+            std::lock_guard lock(mutex);
+            if (!pending || id != requestId) {
+                return;  // already completed or timed out
+            }
+            pending = false;
+            status = code;
+            if (result != nullptr) {
+                value = std::move(*result);
+                hasValue = true;
+                updated = Clock::now();
+            }
+        }
+        cv.notify_all();
+    }
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    DataValue value;
+    bool hasValue = false;
+    Clock::time_point updated;
+    StatusCode status = UA_STATUSCODE_BADWAITINGFORINITIALDATA;  // status of the last device read
+    bool pending = false;
+    uint64_t requestId = 0;
+    Clock::time_point requested;
+};
+
+}  // namespace detail
+
+void AsyncReadCompletion::complete(DataValue value) const {
+    if (!value.hasSourceTimestamp()) {
+        value.setSourceTimestamp(DateTime::now());
+    }
+    state_->finish(requestId_, &value, UA_STATUSCODE_GOOD);
+}
+
+void AsyncReadCompletion::fail(StatusCode code) const {
+    state_->finish(requestId_, nullptr, code);
+}
+
+AsyncDataSource::AsyncDataSource(ReadFunction read, AsyncDataSourceOptions options)
+    : read_(std::move(read)),
+      options_(options),
+      state_(std::make_shared<detail::AsyncDataSourceState>()) {}
+
+AsyncDataSource::~AsyncDataSource() = default;
+
+void AsyncDataSource::registerNode(Server& server, const NodeId& id) {
+    ValueBackendDataSource backend;
+    backend.read = [this](DataValue& dv, const NumericRange&, bool timestamp) {
+        return read(dv, timestamp);
+    };
+    backend.write = [](const DataValue&, const NumericRange&) -> StatusCode {
+        return UA_STATUSCODE_BADNOTWRITABLE;
+    };
+    backend.applyReadRange = true;
+    server.setVariableNodeValueBackend(id, std::move(backend));
+}
+
+void AsyncDataSource::refresh() {
+    const auto now = detail::AsyncDataSourceState::Clock::now();
+    std::unique_lock lock(state_->mutex);
+    const auto requestId = state_->tryBegin(now, options_.readTimeout);
+    lock.unlock();
+    if (requestId.has_value()) {
+        start(*requestId);
+    }
+}
+
+std::optional<DataValue> AsyncDataSource::getCached() const {
+    std::lock_guard lock(state_->mutex);
+    if (!state_->hasValue) {
+        return std::nullopt;
+    }
+    return state_->value;
+}
+
+StatusCode AsyncDataSource::read(DataValue& value, bool timestamp) {
+    auto& state = *state_;
+    const auto now = detail::AsyncDataSourceState::Clock::now();
+    std::unique_lock lock(state.mutex);
+    const auto isStale = [&] { return !state.hasValue || now - state.updated > options_.maxAge; };
+    if (isStale()) {
+        const auto requestId = state.tryBegin(now, options_.readTimeout);
+        if (requestId.has_value()) {
+            lock.unlock();
+            start(*requestId);  // might complete inline
+            lock.lock();
+        }
+        if (options_.waitTimeout.count() > 0) {
+            state.cv.wait_for(lock, options_.waitTimeout, [&] { return !state.pending; });
+        }
+    }
+    if (!state.hasValue) {
+        return state.status;
+    }
+    value = state.value;
+    if (isStale() && value.getStatus().isGood()) {
+        value.setStatus(UA_STATUSCODE_UNCERTAINLASTUSABLEVALUE);  // cache fallback
+    }
+    if (!timestamp) {
+        value->hasSourceTimestamp = false;
+        value->hasSourcePicoseconds = false;
+    }
+    return UA_STATUSCODE_GOOD;
+}
+
+void AsyncDataSource::start(uint64_t requestId) {
+    const AsyncReadCompletion completion(state_, requestId);
+    try {
+        read_(completion);
+    } catch (const BadStatus& e) {
+        completion.fail(e.code());
+    } catch (...) {
+        completion.fail(UA_STATUSCODE_BADINTERNALERROR);
+    }
+}
+
+}  // namespace opcua
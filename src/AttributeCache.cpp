@@ -0,0 +1,160 @@
+#include "open62541pp/AttributeCache.h"
+
+#include <functional>  // hash
+#include <utility>  // move
+
+#include "open62541pp/TypeWrapper.h"  // asWrapper
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+#include "open62541pp/Client.h"
+#include "open62541pp/MonitoredItem.h"
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/Subscription.h"
+#include "open62541pp/types/Composed.h"  // EventFilter
+#include "open62541pp/types/Variant.h"
+#endif
+
+namespace opcua {
+
+static constexpr uint32_t attributeBit(AttributeId attributeId) noexcept {
+    const auto index = static_cast<uint32_t>(attributeId);
+    return index < 32 ? (uint32_t{1} << index) : 0;
+}
+
+size_t AttributeCache::KeyHash::operator()(const Key& key) const noexcept {
+    return std::hash<NodeId>{}(key.id) ^ (static_cast<size_t>(key.attributeId) << 1U);
+}
+
+AttributeCache::AttributeCache(AttributeCacheOptions options)
+    : options_(std::move(options)) {
+    for (const auto attributeId : options_.attributes) {
+        attributeMask_ |= attributeBit(attributeId);
+    }
+}
+
+bool AttributeCache::isCached(AttributeId attributeId) const noexcept {
+    return (attributeMask_ & attributeBit(attributeId)) != 0;
+}
+
+std::optional<DataValue> AttributeCache::get(const NodeId& id, AttributeId attributeId) {
+    if (!isCached(attributeId)) {
+        return std::nullopt;
+    }
+    const auto it = index_.find({id, attributeId});
+    if (it == index_.end()) {
+        ++misses_;
+        return std::nullopt;
+    }
+    auto entry = it->second;
+    if (options_.ttl.count() > 0 && Clock::now() >= entry->expiry) {
+        index_.erase(it);
+        entries_.erase(entry);
+        ++misses_;
+        return std::nullopt;
+    }
+    entries_.splice(entries_.begin(), entries_, entry);  // mark as most recently used
+    ++hits_;
+    return entry->value;
+}
+
+void AttributeCache::put(const NodeId& id, AttributeId attributeId, const DataValue& value) {
+    if (!isCached(attributeId) || options_.capacity == 0) {
+        return;
+    }
+    const auto expiry = Clock::now() + options_.ttl;
+    Key key{id, attributeId};
+    if (const auto it = index_.find(key); it != index_.end()) {
+        it->second->value = value;
+        it->second->expiry = expiry;
+        entries_.splice(entries_.begin(), entries_, it->second);
+        return;
+    }
+    while (entries_.size() >= options_.capacity) {
+        index_.erase(entries_.back().key);  // evict least recently used
+        entries_.pop_back();
+    }
+    entries_.push_front({key, value, expiry});
+    index_.emplace(std::move(key), entries_.begin());
+}
+
+void AttributeCache::erase(const Key& key) noexcept {
+    if (const auto it = index_.find(key); it != index_.end()) {
+        entries_.erase(it->second);
+        index_.erase(it);
+    }
+}
+
+void AttributeCache::invalidate(const NodeId& id) noexcept {
+    for (const auto attributeId : options_.attributes) {
+        erase({id, attributeId});
+    }
+}
+
+void AttributeCache::invalidate(const NodeId& id, AttributeId attributeId) noexcept {
+    if (isCached(attributeId)) {
+        erase({id, attributeId});
+    }
+}
+
+void AttributeCache::clear() noexcept {
+    index_.clear();
+    entries_.clear();
+}
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+template <typename ChangeStructure>
+static bool invalidateChanges(
+    AttributeCache& cache, const Variant& changes, const UA_DataType& dataType
+) {
+    if (!changes.isType(dataType)) {
+        return false;
+    }
+    const auto* items = static_cast<const ChangeStructure*>(changes.data());
+    const size_t count = changes.isScalar() ? 1 : changes.getArrayLength();
+    for (size_t i = 0; i < count; ++i) {
+        cache.invalidate(asWrapper<NodeId>(items[i].affected));  // NOLINT
+    }
+    return true;
+}
+
+MonitoredItem<Client> AttributeCache::invalidateOnModelChange(Subscription<Client>& subscription) {
+    const EventFilter eventFilter(
+        {
+            {ObjectTypeId::BaseEventType, {{0, "EventType"}}, AttributeId::Value},
+            {ObjectTypeId::GeneralModelChangeEventType, {{0, "Changes"}}, AttributeId::Value},
+        },
+        {}
+    );
+    return subscription.subscribeEvent(
+        ObjectId::Server,
+        eventFilter,
+        [weakCache = weak_from_this()](
+            const MonitoredItem<Client>& /* item */, Span<const Variant> eventFields
+        ) {
+            auto cache = weakCache.lock();
+            if (cache == nullptr || eventFields.size() < 2 || !eventFields[0].isType<NodeId>()) {
+                return;
+            }
+            const auto& eventType = eventFields[0].getScalar<NodeId>();
+            if (eventType != NodeId(ObjectTypeId::BaseModelChangeEventType) &&
+                eventType != NodeId(ObjectTypeId::GeneralModelChangeEventType) &&
+                eventType != NodeId(ObjectTypeId::SemanticChangeEventType)) {
+                return;
+            }
+            const auto& changes = eventFields[1];
+            const bool invalidated =
+                invalidateChanges<UA_ModelChangeStructureDataType>(
+                    *cache, changes, UA_TYPES[UA_TYPES_MODELCHANGESTRUCTUREDATATYPE]
+                ) ||
+                invalidateChanges<UA_SemanticChangeStructureDataType>(
+                    *cache, changes, UA_TYPES[UA_TYPES_SEMANTICCHANGESTRUCTUREDATATYPE]
+                );
+            if (!invalidated) {
+                cache->clear();  // affected nodes unknown
+            }
+        }
+    );
+}
+#endif
+
+}  // namespace opcua
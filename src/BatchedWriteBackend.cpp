@@ -0,0 +1,222 @@
+#include "open62541pp/BatchedWriteBackend.h"
+
+#include <mutex>
+#include <unordered_map>
+#include <utility>  // exchange, move, pair
+#include <vector>
+
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/detail/ServerContext.h"
+#include "open62541pp/types/Variant.h"
+
+namespace opcua {
+
+namespace detail {
+
+struct BatchedWriteState {
+    struct Entry {
+        DataValue value;  // shadow
+        uint64_t sequence = 0;  // of the last write or update
+    };
+
+    struct Batch {
+        std::vector<std::pair<uint64_t, uint64_t>> writes;  // key and sequence
+    };
+
+    /// Apply the results of the device to the shadow values.
+    template <typename GetResult>
+    void finish(uint64_t batchId, GetResult&& getResult) {
+        const std::lock_guard lock(mutex);
+        const auto it = batches.find(batchId);
+        if (it == batches.end()) {
+            return;  // already completed
+        }
+        const auto& writes = it->second.writes;
+        for (size_t i = 0; i < writes.size(); ++i) {
+            const StatusCode result = getResult(i);
+            if (result.isGood()) {
+                continue;
+            }
+            const auto [key, sequence] = writes[i];
+            const auto entry = entries.find(key);
+            if (entry != entries.end() && entry->second.sequence == sequence) {
+                entry->second.value.setStatus(result);  // not overwritten meanwhile
+            }
+        }
+        batches.erase(it);
+    }
+
+    mutable std::mutex mutex;
+    std::unordered_map<uint64_t, Entry> entries;
+    std::vector<BatchedWrite> queued;
+    std::vector<uint64_t> queuedSequences;
+    std::unordered_map<uint64_t, Batch> batches;  // handed over, not completed
+    uint64_t lastSequence = 0;
+    uint64_t lastBatchId = 0;
+};
+
+}  // namespace detail
+
+void BatchedWriteCompletion::complete(Span<const StatusCode> results) const {
+    state_->finish(batchId_, [&](size_t index) -> StatusCode {
+        return index < results.size() ? results[index] : UA_STATUSCODE_BADINTERNALERROR;
+    });
+}
+
+void BatchedWriteCompletion::fail(StatusCode code) const {
+    state_->finish(batchId_, [&](size_t /* index */) { return code; });
+}
+
+BatchedWriteBackend::BatchedWriteBackend(Server& server, WriteFunction write)
+    : server_(server),
+      write_(std::move(write)),
+      state_(std::make_shared<detail::BatchedWriteState>()) {}
+
+BatchedWriteBackend::~BatchedWriteBackend() {
+    if (callbackId_ != 0) {
+        UA_Server_removeCallback(server_.handle(), callbackId_);
+    }
+    // the data source callbacks of the nodes reference the backend
+    for (const auto& id : nodeIds_) {
+        UA_DataSource dataSource{};
+        UA_Server_setVariableNode_dataSource(server_.handle(), id, dataSource);
+    }
+}
+
+void BatchedWriteBackend::registerNodes(Span<const NodeId> ids, Span<const uint64_t> keys) {
+    {
+        const std::lock_guard lock(state_->mutex);
+        for (const auto key : keys) {
+            auto& entry = state_->entries[key];
+            if (entry.sequence == 0) {
+                entry.value.setStatus(UA_STATUSCODE_BADWAITINGFORINITIALDATA);
+            }
+        }
+    }
+    server_.setVariableNodeValueBackends(ids, keys, *this);
+    nodeIds_.insert(nodeIds_.end(), ids.begin(), ids.end());
+}
+
+void BatchedWriteBackend::setValue(uint64_t key, DataValue value) {
+    const std::lock_guard lock(state_->mutex);
+    const auto it = state_->entries.find(key);
+    if (it != state_->entries.end()) {
+        it->second.value = std::move(value);
+        it->second.sequence = ++state_->lastSequence;
+    }
+}
+
+size_t BatchedWriteBackend::getQueuedWrites() const {
+    const std::lock_guard lock(state_->mutex);
+    return state_->queued.size();
+}
+
+size_t BatchedWriteBackend::getPendingBatches() const {
+    const std::lock_guard lock(state_->mutex);
+    return state_->batches.size();
+}
+
+StatusCode BatchedWriteBackend::read(
+    uint64_t key, DataValue& value, Span<const NumericRangeDimension> range, bool timestamp
+) {
+    const std::lock_guard lock(state_->mutex);
+    const auto it = state_->entries.find(key);
+    if (it == state_->entries.end()) {
+        return UA_STATUSCODE_BADINTERNALERROR;
+    }
+    const auto& shadow = it->second.value;
+    if (!shadow.hasValue() && shadow.getStatus().isBad()) {
+        return shadow.getStatus();  // no value yet
+    }
+    value = shadow;
+    if (!range.empty()) {
+        value.setValue(shadow.getValue().getRange(
+            NumericRange(std::vector<NumericRangeDimension>(range.begin(), range.end()))
+        ));
+    }
+    if (!timestamp) {
+        value->hasSourceTimestamp = false;
+        value->hasSourcePicoseconds = false;
+    }
+    return UA_STATUSCODE_GOOD;
+}
+
+StatusCode BatchedWriteBackend::write(
+    uint64_t key, const DataValue& value, Span<const NumericRangeDimension> range
+) {
+    {
+        const std::lock_guard lock(state_->mutex);
+        const auto it = state_->entries.find(key);
+        if (it == state_->entries.end()) {
+            return UA_STATUSCODE_BADINTERNALERROR;
+        }
+        auto& entry = it->second;
+        if (range.empty()) {
+            entry.value = value;
+        } else {
+            // apply the subset to the shadow
+            UA_NumericRange nativeRange{
+                range.size(),
+                const_cast<NumericRangeDimension*>(range.data())  // NOLINT, not modified
+            };
+            const auto status = UA_Variant_setRangeCopy(
+                &entry.value->value, value->value.data, value->value.arrayLength, nativeRange
+            );
+            if (status != UA_STATUSCODE_GOOD) {
+                return status;
+            }
+            entry.value.setStatus(value.getStatus());
+        }
+        entry.sequence = ++state_->lastSequence;
+        state_->queued.push_back({key, value, {range.begin(), range.end()}});
+        state_->queuedSequences.push_back(entry.sequence);
+    }
+    if (callbackId_ == 0) {
+        scheduleFlush();
+    }
+    return UA_STATUSCODE_GOOD;
+}
+
+void BatchedWriteBackend::flush() {
+    std::vector<BatchedWrite> writes;
+    uint64_t batchId = 0;
+    {
+        const std::lock_guard lock(state_->mutex);
+        if (state_->queued.empty()) {
+            return;
+        }
+        writes = std::exchange(state_->queued, {});
+        const auto sequences = std::exchange(state_->queuedSequences, {});
+        batchId = ++state_->lastBatchId;
+        auto& batch = state_->batches[batchId];
+        batch.writes.reserve(writes.size());
+        for (size_t i = 0; i < writes.size(); ++i) {
+            batch.writes.emplace_back(writes[i].key, sequences[i]);
+        }
+    }
+    const BatchedWriteCompletion completion(state_, batchId);
+    try {
+        write_(std::move(writes), completion);
+    } catch (const BadStatus& e) {
+        completion.fail(e.code());
+    } catch (...) {
+        completion.fail(UA_STATUSCODE_BADINTERNALERROR);
+    }
+}
+
+void BatchedWriteBackend::scheduleFlush() {
+    // timed callbacks are processed after the current request, so all writes of the request
+    // (and of other requests in the same iteration) are handed over as one batch
+    throwIfBad(UA_Server_addTimedCallback(
+        server_.handle(), flushCallback, this, UA_DateTime_nowMonotonic(), &callbackId_
+    ));
+}
+
+void BatchedWriteBackend::flushCallback([[maybe_unused]] UA_Server* server, void* data) noexcept {
+    auto* self = static_cast<BatchedWriteBackend*>(data);
+    self->callbackId_ = 0;  // timed callbacks are removed after execution
+    detail::getContext(self->server_).exceptionCatcher.invoke([self] { self->flush(); });
+}
+
+}  // namespace opcua
@@ -0,0 +1,220 @@
+#include "open62541pp/BrowsePathResolver.h"
+
+#include <cstdint>
+#include <functional>  // hash
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>  // move, swap
+
+#include "open62541pp/Client.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/services/View.h"
+#include "open62541pp/services/detail/RequestHandling.h"  // createBrowsePath
+#include "open62541pp/types/Composed.h"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+#include "open62541pp/MonitoredItem.h"
+#include "open62541pp/Subscription.h"
+#include "open62541pp/types/Variant.h"
+#endif
+
+namespace opcua {
+
+namespace {
+
+struct SegmentKey {
+    explicit SegmentKey(const QualifiedName& browseName)
+        : namespaceIndex(browseName.getNamespaceIndex()),
+          name(browseName.getName()) {}
+
+    bool operator==(const SegmentKey& other) const noexcept {
+        return namespaceIndex == other.namespaceIndex && name == other.name;
+    }
+
+    uint16_t namespaceIndex;
+    std::string name;
+};
+
+struct SegmentKeyHash {
+    size_t operator()(const SegmentKey& key) const noexcept {
+        return std::hash<std::string>{}(key.name) ^ (size_t{key.namespaceIndex} << 1U);
+    }
+};
+
+/// Target of a single-segment browse path result, a null NodeId if unresolved.
+NodeId getTarget(const BrowsePathResult& result) {
+    if (result.getStatusCode().isBad()) {
+        return {};
+    }
+    for (const auto& target : result.getTargets()) {
+        if (target.getRemainingPathIndex() == UA_UINT32_MAX && target.getTargetId().isLocal()) {
+            return target.getTargetId().getNodeId();
+        }
+    }
+    return {};
+}
+
+}  // namespace
+
+/// Trie of resolved segments: parent node -> browse name -> child node (null if unresolved).
+struct BrowsePathResolver::Cache {
+    const NodeId* find(const NodeId& parent, const QualifiedName& browseName) const {
+        const auto it = children.find(parent);
+        if (it == children.end()) {
+            return nullptr;
+        }
+        const auto itChild = it->second.find(SegmentKey(browseName));
+        return itChild == it->second.end() ? nullptr : &itChild->second;
+    }
+
+    void insert(const NodeId& parent, const QualifiedName& browseName, NodeId child) {
+        const auto [it, inserted] =
+            children[parent].insert_or_assign(SegmentKey(browseName), std::move(child));
+        size += inserted ? 1 : 0;
+    }
+
+    void clear() noexcept {
+        children.clear();
+        size = 0;
+    }
+
+    std::unordered_map<NodeId, std::unordered_map<SegmentKey, NodeId, SegmentKeyHash>> children;
+    size_t size{0};
+    size_t requests{0};
+};
+
+BrowsePathResolver::BrowsePathResolver(Client& client)
+    : client_(&client),
+      cache_(std::make_shared<Cache>()) {}
+
+BrowsePathResolver::~BrowsePathResolver() = default;
+
+std::vector<NodeId> BrowsePathResolver::resolvePaths(
+    const NodeId& origin, Span<const std::vector<QualifiedName>> browsePaths
+) {
+    struct Cursor {
+        size_t index;  // index of browse path
+        size_t depth;  // number of resolved segments
+        NodeId node;  // last resolved node
+    };
+
+    std::vector<NodeId> results(browsePaths.size());
+    std::vector<Cursor> active;
+    active.reserve(browsePaths.size());
+    for (size_t i = 0; i < browsePaths.size(); ++i) {
+        active.push_back({i, 0, origin});
+    }
+
+    std::vector<Cursor> next;
+    std::vector<BrowsePath> requestPaths;
+    std::vector<std::pair<NodeId, const QualifiedName*>> requestSegments;
+    std::unordered_map<NodeId, std::unordered_map<SegmentKey, size_t, SegmentKeyHash>> requested;
+    while (!active.empty()) {
+        next.clear();
+        requestPaths.clear();
+        requestSegments.clear();
+        requested.clear();
+
+        // advance all paths through the cache, collect unique unresolved segments
+        for (auto& cursor : active) {
+            const auto& path = browsePaths[cursor.index];
+            const NodeId* child = nullptr;
+            while (cursor.depth < path.size() &&
+                   (child = cache_->find(cursor.node, path[cursor.depth])) != nullptr &&
+                   !child->isNull()) {
+                cursor.node = *child;
+                ++cursor.depth;
+            }
+            if (cursor.depth == path.size()) {
+                results[cursor.index] = std::move(cursor.node);
+                continue;
+            }
+            if (child != nullptr) {
+                continue;  // cached as unresolved
+            }
+            const auto& browseName = path[cursor.depth];
+            const auto [it, inserted] =
+                requested[cursor.node].try_emplace(SegmentKey(browseName), requestPaths.size());
+            if (inserted) {
+                const Span<const QualifiedName> segment(&browseName, 1);
+                requestPaths.push_back(services::detail::createBrowsePath(cursor.node, segment));
+                requestSegments.emplace_back(cursor.node, &browseName);
+            }
+            next.push_back(std::move(cursor));
+        }
+        if (requestPaths.empty()) {
+            break;
+        }
+
+        // resolve all collected segments with a single request
+        const auto response = services::translateBrowsePathsToNodeIds(
+            *client_, TranslateBrowsePathsToNodeIdsRequest({}, requestPaths)
+        );
+        ++cache_->requests;
+        throwIfBad(response.getResponseHeader().getServiceResult());
+        const auto pathResults = response.getResults();
+        for (size_t i = 0; i < requestSegments.size(); ++i) {
+            auto& [parent, browseName] = requestSegments[i];
+            cache_->insert(
+                parent, *browseName, i < pathResults.size() ? getTarget(pathResults[i]) : NodeId{}
+            );
+        }
+        std::swap(active, next);
+    }
+    return results;
+}
+
+NodeId BrowsePathResolver::resolvePath(
+    const NodeId& origin, Span<const QualifiedName> browsePath
+) {
+    const std::vector<QualifiedName> path(browsePath.begin(), browsePath.end());
+    auto results = resolvePaths(origin, Span<const std::vector<QualifiedName>>(&path, 1));
+    return std::move(results.at(0));
+}
+
+void BrowsePathResolver::invalidate() noexcept {
+    cache_->clear();
+}
+
+size_t BrowsePathResolver::cachedSegments() const noexcept {
+    return cache_->size;
+}
+
+size_t BrowsePathResolver::requestCount() const noexcept {
+    return cache_->requests;
+}
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+MonitoredItem<Client> BrowsePathResolver::invalidateOnModelChange(
+    Subscription<Client>& subscription
+) {
+    const EventFilter eventFilter(
+        {
+            {ObjectTypeId::BaseEventType, {{0, "EventType"}}, AttributeId::Value},
+        },
+        {}
+    );
+    return subscription.subscribeEvent(
+        ObjectId::Server,
+        eventFilter,
+        [weakCache = std::weak_ptr<Cache>(cache_)](
+            const MonitoredItem<Client>& /* item */, Span<const Variant> eventFields
+        ) {
+            auto cache = weakCache.lock();
+            if (cache == nullptr || eventFields.empty() || !eventFields[0].isType<NodeId>()) {
+                return;
+            }
+            const auto& eventType = eventFields[0].getScalar<NodeId>();
+            if (eventType == NodeId(ObjectTypeId::BaseModelChangeEventType) ||
+                eventType == NodeId(ObjectTypeId::GeneralModelChangeEventType) ||
+                eventType == NodeId(ObjectTypeId::SemanticChangeEventType)) {
+                cache->clear();
+            }
+        }
+    );
+}
+#endif
+
+}  // namespace opcua
@@ -0,0 +1,218 @@
+#include "CertificateVerificationCache.h"
+
+#ifdef UA_ENABLE_ENCRYPTION
+
+#include <algorithm>  // min_element
+#include <iterator>  // next
+#include <type_traits>
+#include <utility>  // move
+#include <vector>
+
+#include "open62541pp/Config.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/TypeWrapper.h"
+
+namespace opcua {
+
+using Clock = std::chrono::steady_clock;
+
+// The first parameter of the native callbacks is the context (<= v1.3) or the verification itself
+// (>= v1.4). The wrappers are generic lambdas, converted to the function pointer type of the
+// installed open62541 version.
+
+template <typename T>
+struct FirstArg;
+
+template <typename R, typename Arg, typename... Args>
+struct FirstArg<R (*)(Arg, Args...)> {
+    using type = Arg;
+};
+
+using VerifyArg = typename FirstArg<decltype(UA_CertificateVerification::verifyCertificate)>::type;
+
+template <typename Wrapped, typename Arg>
+static Wrapped* getWrapped(Arg arg) noexcept {
+    if constexpr (std::is_same_v<Arg, void*>) {
+        return static_cast<Wrapped*>(arg);
+    } else {
+        return static_cast<Wrapped*>(arg->context);
+    }
+}
+
+template <typename Arg>
+static Arg getInnerArg(UA_CertificateVerification& inner) noexcept {
+    if constexpr (std::is_same_v<Arg, void*>) {
+        return inner.context;
+    } else {
+        return &inner;
+    }
+}
+
+CertificateVerificationCache::~CertificateVerificationCache() {
+    // the verifications are usually cleared with the server config before
+    for (auto& wrapped : wrapped_) {
+        if (wrapped->inner.clear != nullptr) {
+            wrapped->inner.clear(&wrapped->inner);
+        }
+    }
+}
+
+void CertificateVerificationCache::install(UA_ServerConfig& config) {
+    const std::lock_guard lock(mutex_);
+    if (!wrapped_.empty()) {
+        return;
+    }
+#if UAPP_OPEN62541_VER_GE(1, 4)
+    wrap(config.secureChannelPKI);
+    wrap(config.sessionPKI);
+#else
+    wrap(config.certificateVerification);
+#endif
+}
+
+void CertificateVerificationCache::wrap(UA_CertificateVerification& verification) {
+    auto& wrapped = *wrapped_.emplace_back(
+        std::make_unique<Wrapped>(Wrapped{this, &verification, verification, {}})
+    );
+    verification.context = &wrapped;
+    verification.verifyCertificate = [](auto arg, const UA_ByteString* certificate) {
+        auto* self = getWrapped<Wrapped>(arg);
+        return self->cache->verify(*self, *certificate);
+    };
+    verification.verifyApplicationURI =
+        [](auto arg, const UA_ByteString* certificate, const UA_String* applicationUri) {
+            using Arg = decltype(arg);
+            auto* self = getWrapped<Wrapped>(arg);
+            const std::lock_guard lock(self->cache->mutex_);
+            if (self->inner.verifyApplicationURI == nullptr) {
+                return UA_StatusCode{UA_STATUSCODE_BADSECURITYCHECKSFAILED};  // fail closed
+            }
+            return self->inner.verifyApplicationURI(
+                getInnerArg<Arg>(self->inner), certificate, applicationUri
+            );
+        };
+    verification.clear = [](UA_CertificateVerification* cv) {
+        auto* self = static_cast<Wrapped*>(cv->context);
+        const std::lock_guard lock(self->cache->mutex_);
+        if (self->inner.clear != nullptr) {
+            self->inner.clear(&self->inner);
+        }
+        self->inner = {};
+        self->entries.clear();
+        cv->context = nullptr;
+        cv->clear = nullptr;
+    };
+}
+
+UA_StatusCode CertificateVerificationCache::verify(
+    Wrapped& wrapped, const UA_ByteString& certificate
+) {
+    const std::lock_guard lock(mutex_);
+    const bool enabled = ttl_ > Clock::duration::zero() && maxEntries_ > 0;
+    const auto now = Clock::now();
+    std::string key;
+    if (enabled) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        key.assign(reinterpret_cast<const char*>(certificate.data), certificate.length);
+        const auto it = wrapped.entries.find(key);
+        if (it != wrapped.entries.end()) {
+            if (now < it->second) {
+                return UA_STATUSCODE_GOOD;
+            }
+            wrapped.entries.erase(it);
+        }
+    }
+    if (wrapped.inner.verifyCertificate == nullptr) {
+        return UA_STATUSCODE_BADSECURITYCHECKSFAILED;  // fail closed, e.g. after clear
+    }
+    const auto status =
+        wrapped.inner.verifyCertificate(getInnerArg<VerifyArg>(wrapped.inner), &certificate);
+    if (enabled && status == UA_STATUSCODE_GOOD) {
+        insert(wrapped, std::move(key), now + ttl_);
+    }
+    return status;
+}
+
+void CertificateVerificationCache::insert(
+    Wrapped& wrapped, std::string key, Clock::time_point expiry
+) {
+    auto& entries = wrapped.entries;
+    if (entries.size() >= maxEntries_) {
+        const auto now = Clock::now();
+        for (auto it = entries.begin(); it != entries.end();) {
+            it = it->second <= now ? entries.erase(it) : std::next(it);
+        }
+    }
+    if (entries.size() >= maxEntries_) {
+        const auto oldest = std::min_element(
+            entries.begin(),
+            entries.end(),
+            [](const auto& lhs, const auto& rhs) { return lhs.second < rhs.second; }
+        );
+        entries.erase(oldest);
+    }
+    entries.insert_or_assign(std::move(key), expiry);
+}
+
+void CertificateVerificationCache::setOptions(Clock::duration ttl, size_t maxEntries) {
+    const std::lock_guard lock(mutex_);
+    ttl_ = ttl;
+    maxEntries_ = maxEntries;
+    for (auto& wrapped : wrapped_) {
+        wrapped->entries.clear();
+    }
+}
+
+void CertificateVerificationCache::setTrustList(
+    Span<const ByteString> trustList,
+    Span<const ByteString> issuerList,
+    Span<const ByteString> revocationList
+) {
+    const std::lock_guard lock(mutex_);
+    // create all new verifications first, the current ones stay active if one of them fails
+    std::vector<UA_CertificateVerification> replacements(wrapped_.size());
+    const auto clearReplacements = [&] {
+        for (auto& replacement : replacements) {
+            if (replacement.clear != nullptr) {
+                replacement.clear(&replacement);
+            }
+        }
+    };
+    for (size_t i = 0; i < wrapped_.size(); ++i) {
+        auto& replacement = replacements[i];
+        replacement.logging = wrapped_[i]->inner.logging;
+        const auto status = UA_CertificateVerification_Trustlist(
+            &replacement,
+            asNative(trustList.data()),
+            trustList.size(),
+            asNative(issuerList.data()),
+            issuerList.size(),
+            asNative(revocationList.data()),
+            revocationList.size()
+        );
+        replacement.logging = wrapped_[i]->inner.logging;
+        if (status != UA_STATUSCODE_GOOD) {
+            clearReplacements();
+            throw BadStatus(status);
+        }
+    }
+    for (size_t i = 0; i < wrapped_.size(); ++i) {
+        auto& inner = wrapped_[i]->inner;
+        if (inner.clear != nullptr) {
+            inner.clear(&inner);
+        }
+        inner = replacements[i];
+        wrapped_[i]->entries.clear();
+    }
+}
+
+void CertificateVerificationCache::clear() {
+    const std::lock_guard lock(mutex_);
+    for (auto& wrapped : wrapped_) {
+        wrapped->entries.clear();
+    }
+}
+
+}  // namespace opcua
+
+#endif
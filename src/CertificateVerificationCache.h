@@ -0,0 +1,75 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "open62541pp/Span.h"
+#include "open62541pp/types/Builtin.h"
+
+#include "open62541_impl.h"
+
+#ifdef UA_ENABLE_ENCRYPTION
+
+namespace opcua {
+
+/**
+ * Cache of successful certificate validations.
+ *
+ * The native certificate verifications of the server config are wrapped in place, the security
+ * policies keep their pointers to the config. Known certificates (keyed by their DER encoding,
+ * which identifies them like the thumbprint without hashing) are accepted without validation until
+ * the TTL expires. Rejected certificates are not cached.
+ * The wrapped verifications can be reinitialized with new trust lists at runtime (thread-safe).
+ */
+class CertificateVerificationCache {
+public:
+    CertificateVerificationCache() = default;
+    ~CertificateVerificationCache();
+
+    CertificateVerificationCache(const CertificateVerificationCache&) = delete;
+    CertificateVerificationCache(CertificateVerificationCache&&) noexcept = delete;
+    CertificateVerificationCache& operator=(const CertificateVerificationCache&) = delete;
+    CertificateVerificationCache& operator=(CertificateVerificationCache&&) noexcept = delete;
+
+    /// Wrap the certificate verifications of the config (once).
+    void install(UA_ServerConfig& config);
+
+    /// Set the TTL and the maximum number of entries, a zero TTL disables the cache.
+    void setOptions(std::chrono::steady_clock::duration ttl, size_t maxEntries);
+
+    /// Reinitialize the wrapped verifications with new lists and invalidate the cache.
+    void setTrustList(
+        Span<const ByteString> trustList,
+        Span<const ByteString> issuerList,
+        Span<const ByteString> revocationList
+    );
+
+    /// Invalidate all cached validations.
+    void clear();
+
+private:
+    struct Wrapped {
+        CertificateVerificationCache* cache;
+        UA_CertificateVerification* outer;
+        UA_CertificateVerification inner;
+        std::unordered_map<std::string, std::chrono::steady_clock::time_point> entries;
+    };
+
+    void wrap(UA_CertificateVerification& verification);
+    UA_StatusCode verify(Wrapped& wrapped, const UA_ByteString& certificate);
+    void insert(Wrapped& wrapped, std::string key, std::chrono::steady_clock::time_point now);
+
+    mutable std::mutex mutex_;
+    std::vector<std::unique_ptr<Wrapped>> wrapped_;
+    std::chrono::steady_clock::duration ttl_{};
+    size_t maxEntries_{0};
+};
+
+}  // namespace opcua
+
+#endif
@@ -1,26 +1,39 @@
 #include "open62541pp/Client.h"
 
+#include <algorithm>  // min
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <cstddef>
+#include <exception>
+#include <functional>
 #include <iterator>
+#include <memory>
 #include <string>
+#include <thread>
 #include <utility>  // move
+#include <vector>
 
 #include "open62541pp/AccessControl.h"  // Login
 #include "open62541pp/Config.h"
+#include "open62541pp/ConnectionCache.h"
 #include "open62541pp/DataType.h"
 #include "open62541pp/ErrorHandling.h"
+#include "open62541pp/NamespaceTable.h"
 #include "open62541pp/Node.h"
 #include "open62541pp/TypeWrapper.h"
 #include "open62541pp/detail/ClientContext.h"
 #include "open62541pp/open62541.h"
 #include "open62541pp/services/Attribute.h"  // readValue
+#include "open62541pp/services/MonitoredItem.h"  // recoverSubscriptions
 #include "open62541pp/services/Subscription.h"
+#include "open62541pp/services/View.h"  // registerNodes, unregisterNodes
 #include "open62541pp/types/Builtin.h"
 #include "open62541pp/types/Composed.h"
 
 #include "CustomDataTypes.h"
 #include "CustomLogger.h"
+#include "MpscQueue.h"
 
 namespace opcua {
 
@@ -77,6 +90,14 @@ inline static void invokeStateCallback(
     }
 }
 
+inline static void markRecoveryPending([[maybe_unused]] detail::ClientContext& context) noexcept {
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+    if (context.subscriptionRegistry) {
+        context.subscriptionRegistry->recoveryPending = true;
+    }
+#endif
+}
+
 #if UAPP_OPEN62541_VER_LE(1, 0)
 // state callback for v1.0
 static void stateCallback(UA_Client* client, UA_ClientState clientState) noexcept {
@@ -90,6 +111,7 @@ static void stateCallback(UA_Client* client, UA_ClientState clientState) noexcep
             invokeStateCallback(context, detail::ClientState::Connected);
             break;
         case UA_CLIENTSTATE_SESSION:
+            markRecoveryPending(context);
             invokeStateCallback(context, detail::ClientState::SessionActivated);
             break;
         case UA_CLIENTSTATE_SESSION_DISCONNECTED:
@@ -114,6 +136,7 @@ static void stateCallback(
     if (sessionState != context.lastSessionState) {
         switch (sessionState) {
         case UA_SESSIONSTATE_ACTIVATED:
+            markRecoveryPending(context);
             invokeStateCallback(context, detail::ClientState::SessionActivated);
             break;
         case UA_SESSIONSTATE_CLOSED:
@@ -152,6 +175,10 @@ public:
     }
 
     ~Connection() {
+        running_ = false;
+        if (networkThread_.joinable()) {
+            networkThread_.join();
+        }
         UA_Client_disconnect(handle());
         UA_Client_delete(handle());
     }
@@ -166,14 +193,99 @@ public:
         auto* config = getConfig(handle());
         config->clientContext = &context_;
         config->stateCallback = stateCallback;
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+        config->subscriptionInactivityCallback =
+            services::detail::SubscriptionContext::inactivityCallbackNative;
+#endif
     }
 
     void runIterate(uint16_t timeoutMilliseconds) {
+        runPosted();
         const auto status = UA_Client_run_iterate(handle(), timeoutMilliseconds);
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+        flushDataChangeBatches();
+        runRecovery();
+#endif
         throwIfBad(status);
         context_.exceptionCatcher.rethrow();
     }
 
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+    /// Deliver the data change notifications collected by subscriptions with batched delivery.
+    void flushDataChangeBatches() {
+        if (context_.pendingDataChangeBatches.empty()) {
+            return;
+        }
+        // batch callbacks may process publish responses (synchronous requests) and enqueue again
+        std::vector<uint32_t> pending;
+        pending.swap(context_.pendingDataChangeBatches);
+        for (const uint32_t subId : pending) {
+            auto* subscription = context_.subscriptions.find(subId);
+            if (subscription != nullptr && !subscription->stale) {
+                subscription->flush(subId);
+            }
+        }
+        if (context_.pendingDataChangeBatches.empty()) {
+            pending.clear();
+            pending.swap(context_.pendingDataChangeBatches);  // keep capacity
+        }
+    }
+
+    /// Recreate lost subscriptions after a session was activated (in the client loop).
+    void runRecovery() {
+        auto& registry = context_.subscriptionRegistry;
+        if (registry && registry->recoveryPending.exchange(false)) {
+            context_.exceptionCatcher.invoke(registry->recover);
+        }
+    }
+#endif
+
+    void runPosted() {
+        while (auto task = posted_.pop()) {
+            context_.exceptionCatcher.invoke(*task);
+        }
+    }
+
+    void post(std::function<void()>&& task) {
+        posted_.push(std::move(task));
+    }
+
+    void runInBackground(uint16_t timeoutMilliseconds) {
+        if (running_) {
+            return;
+        }
+        if (networkThread_.joinable()) {
+            networkThread_.join();  // stopped before
+        }
+        running_ = true;
+        networkThread_ = std::thread([this, timeoutMilliseconds] {
+            networkThreadId_ = std::this_thread::get_id();
+            try {
+                while (running_) {
+                    runPosted();
+                    const auto status = UA_Client_run_iterate(handle(), timeoutMilliseconds);
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+                    flushDataChangeBatches();
+                    runRecovery();
+#endif
+                    if (status != UA_STATUSCODE_GOOD) {
+                        // not connected, wait for a reconnect initiated by a posted task
+                        std::this_thread::sleep_for(std::chrono::milliseconds(timeoutMilliseconds));
+                    }
+                    context_.exceptionCatcher.rethrow();
+                }
+            } catch (...) {
+                backgroundException_ = std::current_exception();
+            }
+            running_ = false;
+            networkThreadId_ = std::thread::id();
+        });
+    }
+
+    bool isNetworkThread() const noexcept {
+        return std::this_thread::get_id() == networkThreadId_.load();
+    }
+
     void run() {
         if (running_) {
             return;
@@ -192,6 +304,12 @@ public:
 
     void stop() {
         running_ = false;
+        if (networkThread_.joinable() && !isNetworkThread()) {
+            networkThread_.join();
+            if (backgroundException_) {
+                std::rethrow_exception(std::exchange(backgroundException_, nullptr));
+            }
+        }
     }
 
     bool isRunning() const noexcept {
@@ -220,6 +338,10 @@ private:
     CustomDataTypes customDataTypes_;
     CustomLogger logger_;
     std::atomic<bool> running_{false};
+    detail::MpscQueue<std::function<void()>> posted_;
+    std::thread networkThread_;
+    std::atomic<std::thread::id> networkThreadId_{};
+    std::exception_ptr backgroundException_;
 };
 
 /* ------------------------------------------- Client ------------------------------------------- */
@@ -308,8 +430,16 @@ std::vector<EndpointDescription> Client::getEndpoints(std::string_view serverUrl
     return result;
 }
 
-void Client::setLogger(Logger logger) {
-    connection_->getCustomLogger().setLogger(std::move(logger));
+void Client::setLogger(Logger logger, const LogFilter& filter) {
+    connection_->getCustomLogger().setLogger(std::move(logger), filter);
+}
+
+void Client::setAsyncLogger(Logger logger, const AsyncLoggerOptions& options) {
+    connection_->getCustomLogger().setAsyncLogger(std::move(logger), options);
+}
+
+void Client::setStructuredLogger(StructuredLogger logger, const LogFilter& filter) {
+    connection_->getCustomLogger().setStructuredLogger(std::move(logger), filter);
 }
 
 void Client::setTimeout(uint32_t milliseconds) {
@@ -320,10 +450,51 @@ void Client::setSecurityMode(MessageSecurityMode mode) {
     getConfig(this)->securityMode = static_cast<UA_MessageSecurityMode>(mode);
 }
 
+void Client::setTransportSettings(const TransportSettings& settings) {
+    // remote limits are taken from the Acknowledge message of the server
+    auto& config = getConfig(this)->localConnectionConfig;
+    config.sendBufferSize = settings.sendBufferSize;
+    config.recvBufferSize = settings.recvBufferSize;
+    config.localMaxMessageSize = settings.maxMessageSize;
+    config.localMaxChunkCount = settings.maxChunkCount;
+}
+
+void Client::setRequestWindow(size_t maxInFlight, size_t maxQueued) {
+    connection_->getContext().requestScheduler.setWindow(handle(), maxInFlight, maxQueued);
+}
+
+void Client::setRequestPriority(RequestPriority priority) noexcept {
+    connection_->getContext().requestScheduler.setPriority(priority);
+}
+
+size_t Client::getRequestsInFlight() const noexcept {
+    return connection_->getContext().requestScheduler.inFlight();
+}
+
+size_t Client::getRequestsQueued() const noexcept {
+    return connection_->getContext().requestScheduler.queued();
+}
+
 void Client::setCustomDataTypes(std::vector<DataType> dataTypes) {
     connection_->getCustomDataTypes().setCustomDataTypes(std::move(dataTypes));
 }
 
+void Client::setPassthroughDataTypes(std::vector<DataType> dataTypes) {
+    connection_->getCustomDataTypes().setPassthroughDataTypes(std::move(dataTypes));
+}
+
+void Client::setDataTypeRegistry(std::shared_ptr<const DataTypeRegistry> registry) {
+    connection_->getCustomDataTypes().setRegistry(std::move(registry));
+}
+
+std::shared_ptr<const DataTypeRegistry> Client::getDataTypeRegistry() const noexcept {
+    return connection_->getCustomDataTypes().getRegistry();
+}
+
+const UA_DataType* Client::findDataType(const NodeId& id) const noexcept {
+    return connection_->getCustomDataTypes().find(id);
+}
+
 static void setStateCallback(Client& client, detail::ClientState state, StateCallback&& callback) {
     detail::getContext(client).stateCallbacks.at(static_cast<size_t>(state)) = std::move(callback);
 }
@@ -344,12 +515,48 @@ void Client::onSessionClosed(StateCallback callback) {
     setStateCallback(*this, detail::ClientState::SessionClosed, std::move(callback));
 }
 
+static void registerWithServer(Client& client, Span<const NodeId> ids) {
+    auto& registry = detail::getContext(client).registeredNodes;
+    const auto response = services::registerNodes(client, RegisterNodesRequest({}, ids));
+    throwIfBad(response.getResponseHeader().getServiceResult());
+    const auto aliases = response.getRegisteredNodeIds();
+    if (aliases.size() != ids.size()) {
+        throw BadStatus(UA_STATUSCODE_BADUNEXPECTEDERROR);
+    }
+    for (size_t i = 0; i < ids.size(); ++i) {
+        registry[ids[i]] = aliases[i];
+    }
+}
+
+static void reregisterNodes(Client& client) noexcept {
+    auto& registry = detail::getContext(client).registeredNodes;
+    if (registry.empty()) {
+        return;
+    }
+    std::vector<NodeId> ids;
+    ids.reserve(registry.size());
+    for (auto& [id, alias] : registry) {
+        alias = id;
+        ids.push_back(id);
+    }
+    try {
+        registerWithServer(client, ids);
+    } catch (...) {
+        // keep original node ids
+    }
+}
+
 void Client::connect(std::string_view endpointUrl) {
+    connection_->getContext().endpointUrl = endpointUrl;
+    connection_->getContext().operationLimits.reset();
     const auto status = UA_Client_connect(handle(), std::string(endpointUrl).c_str());
     throwIfBad(status);
+    reregisterNodes(*this);
 }
 
 void Client::connect(std::string_view endpointUrl, const Login& login) {
+    connection_->getContext().endpointUrl = endpointUrl;
+    connection_->getContext().operationLimits.reset();
 #if UAPP_OPEN62541_VER_LE(1, 0)
     const auto func = UA_Client_connect_username;
 #else
@@ -359,10 +566,35 @@ void Client::connect(std::string_view endpointUrl, const Login& login) {
         handle(), std::string(endpointUrl).c_str(), login.username.c_str(), login.password.c_str()
     );
     throwIfBad(status);
+    reregisterNodes(*this);
+}
+
+void Client::reconnect() {
+    const auto& endpointUrl = connection_->getContext().endpointUrl;
+    if (endpointUrl.empty()) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDSTATE);
+    }
+    // the selected endpoint and the user identity token of the last connection are kept in the
+    // client config, open62541 reactivates the session if it was not closed
+    connection_->getContext().namespaceTable.reset();  // the server might have been restarted
+    if (auto& cache = connection_->getContext().attributeCache) {
+        cache->clear();
+    }
+    const auto status = UA_Client_connect(handle(), endpointUrl.c_str());
+    throwIfBad(status);
+    reregisterNodes(*this);
 }
 
 void Client::disconnect() noexcept {
     UA_Client_disconnect(handle());
+    connection_->getContext().namespaceTable.reset();
+    connection_->getContext().operationLimits.reset();
+    if (auto& cache = connection_->getContext().attributeCache) {
+        cache->clear();
+    }
+    for (auto& [id, alias] : connection_->getContext().registeredNodes) {
+        alias = id;  // aliases are only valid within the session
+    }
 }
 
 bool Client::isConnected() noexcept {
@@ -376,8 +608,171 @@ bool Client::isConnected() noexcept {
 }
 
 std::vector<std::string> Client::getNamespaceArray() {
-    return services::readValue(*this, {0, UA_NS0ID_SERVER_NAMESPACEARRAY})
-        .getArrayCopy<std::string>();
+    return getNamespaceTable().getUris();
+}
+
+const NamespaceTable& Client::getNamespaceTable() {
+    auto& cached = connection_->getContext().namespaceTable;
+    if (!cached.has_value()) {
+        cached.emplace(services::readValue(*this, NodeIdView(0, UA_NS0ID_SERVER_NAMESPACEARRAY))
+                           .getArrayCopy<std::string>());
+    }
+    return *cached;
+}
+
+uint16_t Client::getNamespaceIndex(std::string_view uri) {
+    auto index = getNamespaceTable().find(uri);
+    if (!index.has_value()) {
+        connection_->getContext().namespaceTable.reset();  // namespace might be added since
+        index = getNamespaceTable().find(uri);
+    }
+    if (!index.has_value()) {
+        throw BadStatus(UA_STATUSCODE_BADNOTFOUND);
+    }
+    return *index;
+}
+
+NodeId Client::resolveNodeId(const ExpandedNodeId& id) {
+    if (!id.isLocal()) {
+        throw BadStatus(UA_STATUSCODE_BADNODEIDUNKNOWN);
+    }
+    const auto uri = id.getNamespaceUri();
+    if (uri.empty()) {
+        return id.getNodeId();
+    }
+    NodeId result(id.getNodeId());
+    result->namespaceIndex = getNamespaceIndex(uri);
+    return result;
+}
+
+ConnectionCache Client::getConnectionCache() {
+    ConnectionCache cache;
+    cache.endpointUrl = connection_->getContext().endpointUrl;
+#if UAPP_OPEN62541_VER_GE(1, 1)
+    // selected endpoint and user token policy are stored in the config by open62541
+    cache.endpoint = EndpointDescription(getConfig(this)->endpoint);
+    cache.userTokenPolicy = UserTokenPolicy(getConfig(this)->userTokenPolicy);
+#endif
+    cache.namespaceArray = getNamespaceArray();
+    return cache;
+}
+
+void Client::setConnectionCache(const ConnectionCache& cache) {
+#if UAPP_OPEN62541_VER_GE(1, 1)
+    // the endpoint discovery is skipped if the endpoint and user token policy are set
+    asWrapper<EndpointDescription>(getConfig(this)->endpoint) = cache.endpoint;
+    asWrapper<UserTokenPolicy>(getConfig(this)->userTokenPolicy) = cache.userTokenPolicy;
+#endif
+    if (cache.namespaceArray.empty()) {
+        connection_->getContext().namespaceTable.reset();
+    } else {
+        connection_->getContext().namespaceTable.emplace(cache.namespaceArray);
+    }
+}
+
+const OperationLimits& Client::getOperationLimits() {
+    auto& cached = connection_->getContext().operationLimits;
+    if (cached.has_value()) {
+        return *cached;
+    }
+    OperationLimits limits{};
+    uint32_t* const targets[] = {
+        &limits.maxNodesPerRead,
+        &limits.maxNodesPerWrite,
+        &limits.maxNodesPerMethodCall,
+        &limits.maxNodesPerBrowse,
+        &limits.maxNodesPerTranslateBrowsePathsToNodeIds,
+        &limits.maxNodesPerNodeManagement,
+        &limits.maxMonitoredItemsPerCall,
+        &limits.maxNodesPerHistoryReadData,
+    };
+    const uint32_t ids[] = {
+        UA_NS0ID_SERVER_SERVERCAPABILITIES_OPERATIONLIMITS_MAXNODESPERREAD,
+        UA_NS0ID_SERVER_SERVERCAPABILITIES_OPERATIONLIMITS_MAXNODESPERWRITE,
+        UA_NS0ID_SERVER_SERVERCAPABILITIES_OPERATIONLIMITS_MAXNODESPERMETHODCALL,
+        UA_NS0ID_SERVER_SERVERCAPABILITIES_OPERATIONLIMITS_MAXNODESPERBROWSE,
+        UA_NS0ID_SERVER_SERVERCAPABILITIES_OPERATIONLIMITS_MAXNODESPERTRANSLATEBROWSEPATHSTONODEIDS,
+        UA_NS0ID_SERVER_SERVERCAPABILITIES_OPERATIONLIMITS_MAXNODESPERNODEMANAGEMENT,
+        UA_NS0ID_SERVER_SERVERCAPABILITIES_OPERATIONLIMITS_MAXMONITOREDITEMSPERCALL,
+        UA_NS0ID_SERVER_SERVERCAPABILITIES_OPERATIONLIMITS_MAXNODESPERHISTORYREADDATA,
+    };
+    std::array<ReadValueId, std::size(ids)> items;
+    for (size_t i = 0; i < items.size(); ++i) {
+        items[i] = ReadValueId(NodeId(0, ids[i]), AttributeId::Value);  // NOLINT
+    }
+    // send raw request to bypass the automatic chunking, which depends on the limits
+    UA_ReadRequest request{};
+    request.timestampsToReturn = UA_TIMESTAMPSTORETURN_NEITHER;
+    request.nodesToReadSize = items.size();
+    request.nodesToRead = asNative(items.data());
+    ReadResponse response;
+    __UA_Client_Service(
+        handle(),
+        &request,
+        &UA_TYPES[UA_TYPES_READREQUEST],
+        response.handle(),
+        &UA_TYPES[UA_TYPES_READRESPONSE]
+    );
+    throwIfBad(response->responseHeader.serviceResult);
+    auto results = response.getResults();
+    for (size_t i = 0; i < std::min(results.size(), items.size()); ++i) {
+        const auto& value = results[i].getValue();
+        if (value.isType<uint32_t>()) {
+            *targets[i] = value.getScalar<uint32_t>();  // NOLINT
+        }
+    }
+    cached = limits;
+    return *cached;
+}
+
+AttributeCache& Client::enableAttributeCache(AttributeCacheOptions options) {
+    auto& cache = connection_->getContext().attributeCache;
+    cache = std::make_shared<AttributeCache>(std::move(options));
+    return *cache;
+}
+
+void Client::disableAttributeCache() noexcept {
+    connection_->getContext().attributeCache.reset();
+}
+
+AttributeCache* Client::getAttributeCache() noexcept {
+    return connection_->getContext().attributeCache.get();
+}
+
+void Client::registerNodes(Span<const NodeId> ids) {
+    auto& registry = connection_->getContext().registeredNodes;
+    for (const auto& id : ids) {
+        registry.try_emplace(id, id);
+    }
+    if (isConnected()) {
+        registerWithServer(*this, ids);
+    }
+}
+
+void Client::unregisterNodes(Span<const NodeId> ids) {
+    auto& registry = connection_->getContext().registeredNodes;
+    std::vector<NodeId> aliases;
+    for (const auto& id : ids) {
+        const auto it = registry.find(id);
+        if (it != registry.end()) {
+            if (it->second != it->first) {
+                aliases.push_back(it->second);
+            }
+            registry.erase(it);
+        }
+    }
+    if (!aliases.empty() && isConnected()) {
+        const auto response = services::unregisterNodes(
+            *this, UnregisterNodesRequest({}, aliases)
+        );
+        throwIfBad(response.getResponseHeader().getServiceResult());
+    }
+}
+
+const NodeId& Client::getRegisteredNodeId(const NodeId& id) const noexcept {
+    const auto& registry = connection_->getContext().registeredNodes;
+    const auto it = registry.find(id);
+    return it != registry.end() ? it->second : id;
 }
 
 #ifdef UA_ENABLE_SUBSCRIPTIONS
@@ -391,18 +786,39 @@ Subscription<Client> Client::createSubscription(SubscriptionParameters& paramete
     return {*this, subscriptionId};
 }
 
+Subscription<Client> Client::createSubscription(
+    SubscriptionParameters& parameters, DataChangeBatchCallback onDataChangeBatch
+) {
+    const uint32_t subscriptionId = services::createSubscription(
+        *this, parameters, true, {}, std::move(onDataChangeBatch)
+    );
+    return {*this, subscriptionId};
+}
+
 std::vector<Subscription<Client>> Client::getSubscriptions() {
-    auto& subscriptions = detail::getContext(*this).subscriptions;
-    subscriptions.eraseStale();
-    auto lock = subscriptions.acquireLock();
-    const auto& map = subscriptions.underlying();
+    const auto& subscriptions = detail::getContext(*this).subscriptions;
     std::vector<Subscription<Client>> result;
-    result.reserve(map.size());
-    for (const auto& [subId, _] : map) {
+    result.reserve(subscriptions.size());
+    subscriptions.forEach([&](uint32_t subId, const auto& /* context */) {
         result.emplace_back(*this, subId);
-    }
+    });
     return result;
 }
+
+void Client::enableSubscriptionRecovery(
+    std::function<void(Span<const RecoveredSubscription>)> onRecovered
+) {
+    auto& registry = detail::getContext(*this).subscriptionRegistry;
+    if (!registry) {
+        registry = std::make_unique<detail::SubscriptionRegistry>();
+    }
+    registry->recover = [this, onRecovered = std::move(onRecovered)] {
+        const auto results = services::recoverSubscriptions(*this);
+        if (!results.empty() && onRecovered) {
+            onRecovered(results);
+        }
+    };
+}
 #endif
 
 void Client::runIterate(uint16_t timeoutMilliseconds) {
@@ -413,6 +829,18 @@ void Client::run() {
     connection_->run();
 }
 
+void Client::runInBackground(uint16_t timeoutMilliseconds) {
+    connection_->runInBackground(timeoutMilliseconds);
+}
+
+bool Client::isNetworkThread() const noexcept {
+    return connection_->isNetworkThread();
+}
+
+void Client::post(std::function<void()> task) {
+    connection_->post(std::move(task));
+}
+
 void Client::stop() {
     connection_->stop();
 }
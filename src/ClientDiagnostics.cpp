@@ -0,0 +1,70 @@
+#include "open62541pp/ClientDiagnostics.h"
+
+#include <algorithm>  // find
+#include <memory>
+#include <mutex>
+#include <utility>  // move
+
+#include "open62541pp/Client.h"
+#include "open62541pp/detail/ClientContext.h"
+#include "open62541pp/detail/ClientMetricsRecorder.h"  // getClientServiceName
+#include "open62541pp/detail/DiagnosticsSampler.h"
+
+namespace opcua {
+
+namespace detail {
+
+void DiagnosticsSampler::configure(DiagnosticsSampling sampling, DiagnosticsCallback callback) {
+    std::unique_ptr<State> state;
+    if (callback) {
+        state = std::make_unique<State>();
+        state->nodes.insert(sampling.nodes.begin(), sampling.nodes.end());
+        state->sampling = std::move(sampling);
+        state->callback = std::make_shared<DiagnosticsCallback>(std::move(callback));
+    }
+    const std::lock_guard lock(mutex_);
+    enabled_.store(state != nullptr, std::memory_order_relaxed);
+    state_ = std::move(state);
+}
+
+bool DiagnosticsSampler::matchesInterval() noexcept {
+    const auto interval = state_->sampling.interval;
+    return interval > 0 && (state_->counter++ % interval) == 0;
+}
+
+bool DiagnosticsSampler::matchesService(size_t service) {
+    const auto& services = state_->sampling.services;
+    if (services.empty() || service >= state_->services.size()) {
+        return false;
+    }
+    auto& cached = state_->services[service];
+    if (cached == 0) {
+        const auto name = getClientServiceName(service);
+        const bool match = std::find(services.begin(), services.end(), name) != services.end();
+        cached = match ? 1 : -1;
+    }
+    return cached > 0;
+}
+
+void DiagnosticsSampler::deliver(const RequestDiagnostics& diagnostics, ExceptionCatcher& catcher) {
+    std::shared_ptr<DiagnosticsCallback> callback;
+    {
+        const std::lock_guard lock(mutex_);
+        if (state_ != nullptr) {
+            callback = state_->callback;
+        }
+    }
+    if (callback != nullptr) {
+        catcher.invoke(*callback, diagnostics);
+    }
+}
+
+}  // namespace detail
+
+void Client::setDiagnosticsSampling(
+    const DiagnosticsSampling& sampling, DiagnosticsCallback callback
+) {
+    detail::getContext(*this).diagnostics.configure(sampling, std::move(callback));
+}
+
+}  // namespace opcua
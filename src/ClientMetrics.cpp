@@ -0,0 +1,280 @@
+#include "open62541pp/ClientMetrics.h"
+
+#include <array>
+#include <exception>  // current_exception
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>  // exchange, move
+#include <vector>
+
+#include "open62541pp/Client.h"
+#include "open62541pp/detail/ClientContext.h"
+#include "open62541pp/detail/ClientMetricsRecorder.h"
+
+#include "Prometheus.h"
+#include "open62541_impl.h"
+
+namespace opcua {
+
+/* ----------------------------------------- Recording ------------------------------------------ */
+
+namespace detail {
+
+namespace {
+
+struct ClientServiceRegistry {
+    ClientServiceRegistry() {
+        names.back() = "Other";
+    }
+
+    std::mutex mutex;
+    std::array<const UA_DataType*, clientServiceCount - 1> types{};
+    std::array<std::string, clientServiceCount> names{};
+    size_t size{0};
+};
+
+ClientServiceRegistry& getClientServiceRegistry() {
+    static ClientServiceRegistry registry;
+    return registry;
+}
+
+std::string getServiceName(const UA_DataType& responseType) {
+#ifdef UA_ENABLE_TYPEDESCRIPTION
+    std::string_view name(responseType.typeName);
+    constexpr std::string_view suffix = "Response";
+    if (name.size() > suffix.size() && name.substr(name.size() - suffix.size()) == suffix) {
+        name.remove_suffix(suffix.size());
+    }
+    return std::string(name);
+#else
+    return "i=" + std::to_string(responseType.typeId.identifier.numeric);
+#endif
+}
+
+}  // namespace
+
+size_t registerClientService(const UA_DataType& responseType) noexcept {
+    auto& registry = getClientServiceRegistry();
+    const std::lock_guard lock(registry.mutex);
+    for (size_t i = 0; i < registry.size; ++i) {
+        if (registry.types[i] == &responseType) {
+            return i;
+        }
+    }
+    try {
+        if (registry.size < registry.types.size()) {
+            registry.names[registry.size] = getServiceName(responseType);
+            registry.types[registry.size] = &responseType;
+            return registry.size++;
+        }
+    } catch (...) {  // NOLINT(bugprone-empty-catch), recorded as unnamed service
+    }
+    return clientServiceCount - 1;
+}
+
+std::string getClientServiceName(size_t index) {
+    auto& registry = getClientServiceRegistry();
+    const std::lock_guard lock(registry.mutex);
+    return index < registry.names.size() ? registry.names[index] : std::string{};
+}
+
+void ClientMetricsRecorder::setTracer(std::shared_ptr<RequestTracer> tracer) {
+    const std::lock_guard lock(tracerMutex_);
+    tracing_.store(tracer != nullptr, std::memory_order_relaxed);
+    tracer_ = std::move(tracer);
+}
+
+std::shared_ptr<RequestTracer> ClientMetricsRecorder::getTracer() const {
+    const std::lock_guard lock(tracerMutex_);
+    return tracer_;
+}
+
+void ClientMetricsRecorder::recordStart() noexcept {
+    const auto inFlight = inFlight_.fetch_add(1, std::memory_order_relaxed) + 1;
+    auto maxInFlight = maxInFlight_.load(std::memory_order_relaxed);
+    while (inFlight > maxInFlight &&
+           !maxInFlight_.compare_exchange_weak(maxInFlight, inFlight, std::memory_order_relaxed)) {
+    }
+}
+
+void ClientMetricsRecorder::recordEnd(
+    size_t service, std::chrono::nanoseconds duration, StatusCode status
+) noexcept {
+    inFlight_.fetch_sub(1, std::memory_order_relaxed);
+    auto& metrics = services_[service];
+    metrics.requests.fetch_add(1, std::memory_order_relaxed);
+    if (status.isBad()) {
+        metrics.badStatus.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (status == UA_STATUSCODE_BADTIMEOUT) {
+        metrics.timeouts.fetch_add(1, std::memory_order_relaxed);
+    }
+    metrics.latency.record(duration);
+}
+
+ClientMetrics ClientMetricsRecorder::snapshot() const {
+    ClientMetrics metrics;
+    metrics.inFlight = inFlight_.load(std::memory_order_relaxed);
+    metrics.maxInFlight = maxInFlight_.load(std::memory_order_relaxed);
+    auto& registry = getClientServiceRegistry();
+    const std::lock_guard lock(registry.mutex);
+    for (size_t i = 0; i < services_.size(); ++i) {
+        const auto requests = services_[i].requests.load(std::memory_order_relaxed);
+        if (requests == 0) {
+            continue;
+        }
+        auto& item = metrics.services.emplace_back();
+        item.service = registry.names[i];
+        item.requests = requests;
+        item.badStatus = services_[i].badStatus.load(std::memory_order_relaxed);
+        item.timeouts = services_[i].timeouts.load(std::memory_order_relaxed);
+        item.latency = services_[i].latency.snapshot();
+    }
+    return metrics;
+}
+
+void ClientMetricsRecorder::reset() noexcept {
+    for (auto& service : services_) {
+        service.requests.store(0, std::memory_order_relaxed);
+        service.badStatus.store(0, std::memory_order_relaxed);
+        service.timeouts.store(0, std::memory_order_relaxed);
+        service.latency.reset();
+    }
+    maxInFlight_.store(inFlight_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+RequestTrace::RequestTrace(
+    ClientMetricsRecorder& recorder, ExceptionCatcher& catcher, size_t service
+)
+    : recorder_(&recorder),
+      catcher_(&catcher),
+      service_(service),
+      metrics_(recorder.isEnabled()),
+      start_(Clock::now()) {
+    if (metrics_) {
+        recorder.recordStart();
+    }
+    if (recorder.isTracing()) {
+        tracer_ = recorder.getTracer();
+    }
+    if (tracer_ != nullptr) {
+        RequestSpan span;
+        span.service = getClientServiceRegistry().names[service_];
+        span.start = start_;
+        try {
+            span_ = tracer_->startSpan(span);
+        } catch (...) {
+            catcher.setException(std::current_exception());
+        }
+    }
+}
+
+void RequestTrace::finish(StatusCode status) noexcept {
+    auto* recorder = std::exchange(recorder_, nullptr);
+    const auto end = Clock::now();
+    if (metrics_) {
+        recorder->recordEnd(service_, end - start_, status);
+    }
+    if (tracer_ != nullptr) {
+        RequestSpan span;
+        span.service = getClientServiceRegistry().names[service_];
+        span.start = start_;
+        span.end = end;
+        span.status = status;
+        try {
+            tracer_->endSpan(span_, span);
+        } catch (...) {
+            catcher_->setException(std::current_exception());
+        }
+        tracer_.reset();
+    }
+}
+
+}  // namespace detail
+
+/* ----------------------------------------- Prometheus ----------------------------------------- */
+
+std::string toPrometheus(const ClientMetrics& metrics) {
+    std::string out;
+    std::vector<std::string> labels;
+    labels.reserve(metrics.services.size());
+    for (const auto& service : metrics.services) {
+        std::string item = "service=";
+        detail::appendPrometheusLabelValue(item, service.service);
+        labels.push_back(std::move(item));
+    }
+    const auto appendCounter = [&](std::string_view name, std::string_view help, auto&& getValue) {
+        detail::appendPrometheusHeader(out, name, "counter", help);
+        for (size_t i = 0; i < metrics.services.size(); ++i) {
+            detail::appendPrometheusSample(
+                out, name, labels[i], static_cast<double>(getValue(metrics.services[i]))
+            );
+        }
+    };
+    appendCounter(
+        "opcua_client_requests_total",
+        "Completed requests.",
+        [](const ClientServiceMetrics& s) { return s.requests; }
+    );
+    appendCounter(
+        "opcua_client_request_errors_total",
+        "Requests completed with a bad service result.",
+        [](const ClientServiceMetrics& s) { return s.badStatus; }
+    );
+    appendCounter(
+        "opcua_client_request_timeouts_total",
+        "Requests completed with BadTimeout.",
+        [](const ClientServiceMetrics& s) { return s.timeouts; }
+    );
+
+    detail::appendPrometheusHeader(
+        out, "opcua_client_request_duration_seconds", "histogram", "Latency of requests."
+    );
+    for (size_t i = 0; i < metrics.services.size(); ++i) {
+        detail::appendPrometheusHistogram(
+            out, "opcua_client_request_duration_seconds", labels[i], metrics.services[i].latency
+        );
+    }
+
+    detail::appendPrometheusHeader(
+        out, "opcua_client_requests_in_flight", "gauge", "Requests in flight."
+    );
+    out.append("opcua_client_requests_in_flight ");
+    detail::appendPrometheusNumber(out, static_cast<double>(metrics.inFlight));
+    out += '\n';
+    detail::appendPrometheusHeader(
+        out,
+        "opcua_client_requests_in_flight_max",
+        "gauge",
+        "Maximum of requests in flight since the last reset."
+    );
+    out.append("opcua_client_requests_in_flight_max ");
+    detail::appendPrometheusNumber(out, static_cast<double>(metrics.maxInFlight));
+    out += '\n';
+    return out;
+}
+
+/* ------------------------------------------- Client ------------------------------------------- */
+
+void Client::setMetricsEnabled(bool enabled) {
+    detail::getContext(*this).metrics.setEnabled(enabled);
+}
+
+bool Client::isMetricsEnabled() {
+    return detail::getContext(*this).metrics.isEnabled();
+}
+
+ClientMetrics Client::getMetrics() {
+    return detail::getContext(*this).metrics.snapshot();
+}
+
+void Client::resetMetrics() {
+    detail::getContext(*this).metrics.reset();
+}
+
+void Client::setRequestTracer(std::shared_ptr<RequestTracer> tracer) {
+    detail::getContext(*this).metrics.setTracer(std::move(tracer));
+}
+
+}  // namespace opcua
@@ -0,0 +1,148 @@
+#include "open62541pp/ClientPool.h"
+
+#include <algorithm>  // max
+#include <limits>
+#include <utility>  // move
+
+#include "open62541pp/ErrorHandling.h"
+
+namespace opcua {
+
+ClientPool::ClientPool(std::vector<std::string> endpointUrls, ClientPoolOptions options)
+    : options_(options) {
+    const size_t clientsPerEndpoint = std::max<size_t>(options_.clientsPerEndpoint, 1);
+    members_.reserve(endpointUrls.size() * clientsPerEndpoint);
+    for (auto& endpointUrl : endpointUrls) {
+        for (size_t i = 0; i < clientsPerEndpoint; ++i) {
+            members_.push_back({endpointUrl, Client{}});
+        }
+    }
+    // members are not moved anymore, callbacks can reference them
+    for (auto& member : members_) {
+        member.client.setRequestWindow(std::numeric_limits<size_t>::max());  // track in-flight
+        member.client.onConnected([&member] { member.connected = true; });
+        member.client.onDisconnected([&member] { member.connected = false; });
+    }
+}
+
+bool ClientPool::tryConnect(Member& member) noexcept {
+    member.lastAttempt = std::chrono::steady_clock::now();
+    try {
+        member.client.connect(member.endpointUrl);
+        member.connected = true;
+    } catch (...) {
+        member.connected = false;
+    }
+    return member.connected;
+}
+
+size_t ClientPool::connect() {
+    reconnect_ = true;
+    size_t count = 0;
+    for (auto& member : members_) {
+        if (member.connected || tryConnect(member)) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+void ClientPool::disconnect() noexcept {
+    reconnect_ = false;
+    for (auto& member : members_) {
+        member.client.disconnect();
+        member.connected = false;
+    }
+}
+
+size_t ClientPool::connectedCount() const noexcept {
+    size_t count = 0;
+    for (const auto& member : members_) {
+        count += member.connected ? 1 : 0;
+    }
+    return count;
+}
+
+Client& ClientPool::acquire() {
+    Member* best = nullptr;
+    for (auto& member : members_) {
+        if (member.connected && (best == nullptr || member.client.getRequestsInFlight() <
+                                                        best->client.getRequestsInFlight())) {
+            best = &member;
+        }
+    }
+    if (best == nullptr) {
+        throw BadStatus(UA_STATUSCODE_BADNOTCONNECTED);
+    }
+    return best->client;
+}
+
+Client& ClientPool::acquireForSubscription() {
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+    Member* best = nullptr;
+    size_t bestCount = 0;
+    for (auto& member : members_) {
+        if (!member.connected) {
+            continue;
+        }
+        const size_t count = member.client.getSubscriptions().size();
+        if (best == nullptr || count < bestCount) {
+            best = &member;
+            bestCount = count;
+        }
+    }
+    if (best == nullptr) {
+        throw BadStatus(UA_STATUSCODE_BADNOTCONNECTED);
+    }
+    return best->client;
+#else
+    return acquire();
+#endif
+}
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+Subscription<Client> ClientPool::createSubscription() {
+    return acquireForSubscription().createSubscription();
+}
+
+Subscription<Client> ClientPool::createSubscription(SubscriptionParameters& parameters) {
+    return acquireForSubscription().createSubscription(parameters);
+}
+#endif
+
+void ClientPool::runIterate(uint16_t timeoutMilliseconds) {
+    const auto now = std::chrono::steady_clock::now();
+    for (auto& member : members_) {
+        if (member.connected) {
+            try {
+                member.client.runIterate(timeoutMilliseconds);
+            } catch (const BadStatus&) {
+                member.connected = false;  // connection lost, reconnect later
+                member.lastAttempt = now;
+            }
+        } else if (reconnect_ && now - member.lastAttempt >= options_.reconnectInterval) {
+            tryConnect(member);
+        }
+    }
+}
+
+void ClientPool::run() {
+    if (running_) {
+        return;
+    }
+    running_ = true;
+    try {
+        while (running_) {
+            runIterate(10);
+        }
+    } catch (...) {
+        running_ = false;
+        throw;
+    }
+}
+
+void ClientPool::stop() noexcept {
+    running_ = false;
+}
+
+}  // namespace opcua
@@ -0,0 +1,243 @@
+#include "open62541pp/ConditionStore.h"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+
+#include <utility>  // move
+
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/services/NodeManagement.h"
+#include "open62541pp/types/Composed.h"  // VariableAttributes
+#include "open62541pp/types/DateTime.h"
+#include "open62541pp/types/Variant.h"
+
+namespace opcua {
+
+ConditionStore::ConditionStore(Server& server, const NodeId& originId)
+    : server_(server),
+      originId_(originId) {}
+
+uint32_t ConditionStore::addCondition(const ConditionDefinition& definition) {
+    const auto id = static_cast<uint32_t>(states_.size());
+    definitions_.push_back(definition);
+    messages_.emplace_back();
+    events_.emplace_back();
+    states_.emplace_back();
+    return id;
+}
+
+void ConditionStore::checkId(uint32_t id) const {
+    if (id >= states_.size()) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+    }
+}
+
+ConditionState ConditionStore::getState(uint32_t id) const {
+    checkId(id);
+    return states_[id];
+}
+
+const ConditionDefinition& ConditionStore::getDefinition(uint32_t id) const {
+    checkId(id);
+    return definitions_[id];
+}
+
+const NodeId& ConditionStore::getConditionId(uint32_t id) {
+    checkId(id);
+    return getEvent(id).getNodeId();
+}
+
+Event& ConditionStore::getEvent(uint32_t id) {
+    auto& event = events_[id];
+    if (event == nullptr) {
+        auto created = std::make_unique<Event>(server_, ObjectTypeId::AlarmConditionType);
+        // optional in AlarmConditionType, not instantiated with the event node
+        try {
+            services::addVariable(
+                server_,
+                created->getNodeId(),
+                NodeId(created->getNodeId().getNamespaceIndex(), 0),  // assigned by the server
+                "ConfirmedState",
+                VariableAttributes{}.setDataType<LocalizedText>(),
+                VariableTypeId::TwoStateVariableType,
+                ReferenceTypeId::HasComponent
+            );
+        } catch (const BadStatus&) {  // NOLINT(bugprone-empty-catch)
+            // instantiated with the event node, otherwise writeEvent fails with BadNoMatch
+        }
+        event = std::move(created);
+    }
+    return *event;
+}
+
+StatusCode ConditionStore::transitionActive(uint32_t id, bool active, uint16_t severity) {
+    if (id >= states_.size()) {
+        return UA_STATUSCODE_BADINVALIDARGUMENT;
+    }
+    auto& state = states_[id];
+    if (active && !state.active) {
+        state.acked = false;
+        state.confirmed = false;
+    }
+    state.active = active;
+    state.severity = severity;
+    return UA_STATUSCODE_GOOD;
+}
+
+StatusCode ConditionStore::transitionAcked(uint32_t id) {
+    if (id >= states_.size()) {
+        return UA_STATUSCODE_BADINVALIDARGUMENT;
+    }
+    auto& state = states_[id];
+    if (state.acked) {
+        return UA_STATUSCODE_BADCONDITIONBRANCHALREADYACKED;
+    }
+    state.acked = true;
+    return UA_STATUSCODE_GOOD;
+}
+
+StatusCode ConditionStore::transitionConfirmed(uint32_t id) {
+    if (id >= states_.size()) {
+        return UA_STATUSCODE_BADINVALIDARGUMENT;
+    }
+    auto& state = states_[id];
+    if (state.confirmed) {
+        return UA_STATUSCODE_BADCONDITIONBRANCHALREADYCONFIRMED;
+    }
+    state.confirmed = true;
+    return UA_STATUSCODE_GOOD;
+}
+
+void ConditionStore::writeEvent(Event& event, uint32_t id) {
+    static const LocalizedText active("en", "Active");
+    static const LocalizedText inactive("en", "Inactive");
+    static const LocalizedText acknowledged("en", "Acknowledged");
+    static const LocalizedText unacknowledged("en", "Unacknowledged");
+    static const LocalizedText confirmed("en", "Confirmed");
+    static const LocalizedText unconfirmed("en", "Unconfirmed");
+    static const QualifiedName activeStateId[] = {{0, "ActiveState"}, {0, "Id"}};
+    static const QualifiedName ackedStateId[] = {{0, "AckedState"}, {0, "Id"}};
+    static const QualifiedName confirmedStateId[] = {{0, "ConfirmedState"}, {0, "Id"}};
+
+    const auto& state = states_[id];
+    const auto& definition = definitions_[id];
+    event.writeTime(DateTime::now());
+    event.writeSeverity(state.severity);
+    event.writeMessage(messages_[id]);
+    event.writeSourceName(definition.sourceName);
+    event.writeProperty({0, "SourceNode"}, Variant::fromScalar(definition.sourceId));
+    event.writeProperty({0, "ConditionName"}, Variant::fromScalar(definition.conditionName));
+    event.writeProperty({0, "Retain"}, Variant::fromScalar(state.isRetained()));
+    event.writeProperty({0, "ActiveState"}, Variant::fromScalar(state.active ? active : inactive));
+    event.writeNestedProperty(activeStateId, Variant::fromScalar(state.active));
+    event.writeProperty(
+        {0, "AckedState"}, Variant::fromScalar(state.acked ? acknowledged : unacknowledged)
+    );
+    event.writeNestedProperty(ackedStateId, Variant::fromScalar(state.acked));
+    event.writeProperty(
+        {0, "ConfirmedState"}, Variant::fromScalar(state.confirmed ? confirmed : unconfirmed)
+    );
+    event.writeNestedProperty(confirmedStateId, Variant::fromScalar(state.confirmed));
+}
+
+void ConditionStore::emit(Span<const uint32_t> ids) {
+    for (const auto id : ids) {
+        auto& event = getEvent(id);
+        writeEvent(event, id);
+        event.trigger(originId_);
+    }
+}
+
+void ConditionStore::triggerRefreshEvent(std::optional<Event>& event, const NodeId& eventType) {
+    if (!event.has_value()) {
+        event.emplace(server_, eventType);
+    }
+    event->writeTime(DateTime::now());
+    event->trigger(originId_);
+}
+
+template <typename Transition>
+static std::vector<StatusCode> transitionMany(
+    Span<const uint32_t> ids, std::vector<uint32_t>& transitioned, Transition&& transition
+) {
+    std::vector<StatusCode> results;
+    results.reserve(ids.size());
+    transitioned.reserve(ids.size());
+    for (const auto id : ids) {
+        const auto& status = results.emplace_back(transition(id));
+        if (status.isGood()) {
+            transitioned.push_back(id);
+        }
+    }
+    return results;
+}
+
+void ConditionStore::setActive(
+    uint32_t id, bool active, uint16_t severity, const LocalizedText& message
+) {
+    throwIfBad(setActive({&id, 1}, active, severity, message).front());
+}
+
+std::vector<StatusCode> ConditionStore::setActive(
+    Span<const uint32_t> ids, bool active, uint16_t severity, const LocalizedText& message
+) {
+    const bool hasMessage = !message.getText().empty();
+    std::vector<uint32_t> transitioned;
+    auto results = transitionMany(ids, transitioned, [&](uint32_t id) {
+        const auto status = transitionActive(id, active, severity);
+        if (status.isGood() && hasMessage) {
+            messages_[id] = message;
+        }
+        return status;
+    });
+    emit(transitioned);
+    return results;
+}
+
+void ConditionStore::acknowledge(uint32_t id) {
+    throwIfBad(acknowledge({&id, 1}).front());
+}
+
+std::vector<StatusCode> ConditionStore::acknowledge(Span<const uint32_t> ids) {
+    std::vector<uint32_t> transitioned;
+    auto results = transitionMany(ids, transitioned, [this](uint32_t id) {
+        return transitionAcked(id);
+    });
+    emit(transitioned);
+    return results;
+}
+
+void ConditionStore::confirm(uint32_t id) {
+    throwIfBad(confirm({&id, 1}).front());
+}
+
+std::vector<StatusCode> ConditionStore::confirm(Span<const uint32_t> ids) {
+    std::vector<uint32_t> transitioned;
+    auto results = transitionMany(ids, transitioned, [this](uint32_t id) {
+        return transitionConfirmed(id);
+    });
+    emit(transitioned);
+    return results;
+}
+
+std::vector<uint32_t> ConditionStore::getRetained() const {
+    std::vector<uint32_t> ids;
+    for (size_t i = 0; i < states_.size(); ++i) {
+        if (states_[i].isRetained()) {
+            ids.push_back(static_cast<uint32_t>(i));
+        }
+    }
+    return ids;
+}
+
+size_t ConditionStore::refresh() {
+    const auto ids = getRetained();
+    triggerRefreshEvent(refreshStartEvent_, ObjectTypeId::RefreshStartEventType);
+    emit(ids);
+    triggerRefreshEvent(refreshEndEvent_, ObjectTypeId::RefreshEndEventType);
+    return ids.size();
+}
+
+}  // namespace opcua
+
+#endif
@@ -0,0 +1,71 @@
+#include "open62541pp/ConnectionCache.h"
+
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <iterator>
+#include <utility>  // move
+
+#include "open62541pp/Encoding.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/Variant.h"
+
+namespace opcua {
+
+// file format: magic number, endpoint url, endpoint description, user token policy, namespaces
+constexpr uint32_t cacheMagic = 0x55414343;  // "UACC"
+
+void saveConnectionCache(std::string_view path, const ConnectionCache& cache) {
+    BatchEncoder encoder;
+    encoder.append(cacheMagic);
+    encoder.append(String(cache.endpointUrl));
+    encoder.append(cache.endpoint);
+    encoder.append(cache.userTokenPolicy);
+    encoder.append(Variant::fromArray(cache.namespaceArray));
+
+    std::ofstream file(std::string(path), std::ios::binary | std::ios::trunc);
+    const auto data = encoder.data();
+    file.write(
+        reinterpret_cast<const char*>(data.data()),  // NOLINT
+        static_cast<std::streamsize>(data.size())
+    );
+    if (!file) {
+        throw BadStatus(UA_STATUSCODE_BADINTERNALERROR);
+    }
+}
+
+std::optional<ConnectionCache> loadConnectionCache(std::string_view path) {
+    std::ifstream file(std::string(path), std::ios::binary);
+    if (!file) {
+        return std::nullopt;
+    }
+    const std::vector<uint8_t> data(
+        (std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>()
+    );
+    try {
+        BinaryDecoder decoder;
+        decoder.append(data);
+        const auto magic = decoder.next<uint32_t>();
+        if (!magic.has_value() || *magic != cacheMagic) {
+            return std::nullopt;
+        }
+        auto endpointUrl = decoder.next<String>();
+        auto endpoint = decoder.next<EndpointDescription>();
+        auto userTokenPolicy = decoder.next<UserTokenPolicy>();
+        auto namespaces = decoder.next<Variant>();
+        if (!endpointUrl || !endpoint || !userTokenPolicy || !namespaces) {
+            return std::nullopt;
+        }
+        return ConnectionCache{
+            std::string(endpointUrl->get()),
+            std::move(*endpoint),
+            std::move(*userTokenPolicy),
+            namespaces->getArrayCopy<std::string>(),
+        };
+    } catch (const std::exception&) {
+        return std::nullopt;  // e.g. binary decoding not supported
+    }
+}
+
+}  // namespace opcua
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace opcua::detail {
+
+using Sha256Digest = std::array<uint8_t, 32>;
+
+/// HMAC-SHA256 of a message.
+/// Computed with OpenSSL/LibreSSL if open62541 uses it for encryption, with a builtin
+/// implementation otherwise.
+Sha256Digest hmacSha256(std::string_view key, std::string_view message);
+
+/// PBKDF2-HMAC-SHA256 with a single output block.
+/// Computed with OpenSSL/LibreSSL if open62541 uses it for encryption, with a builtin
+/// implementation otherwise.
+Sha256Digest pbkdf2HmacSha256(
+    std::string_view password, std::string_view salt, uint32_t iterations
+);
+
+}  // namespace opcua::detail
@@ -0,0 +1,448 @@
+#include "open62541pp/CredentialStore.h"
+
+#include <algorithm>  // copy, max
+#include <limits>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <utility>  // move
+
+#include "open62541pp/Config.h"
+#include "open62541pp/ErrorHandling.h"
+
+#include "CredentialHash.h"
+#include "WorkerPool.h"
+
+// use the crypto library of open62541 if available, the builtin implementation otherwise
+#if defined(UA_ENABLE_ENCRYPTION_OPENSSL) || defined(UA_ENABLE_ENCRYPTION_LIBRESSL)
+#define UAPP_CREDENTIAL_HASH_OPENSSL
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+#endif
+
+namespace opcua {
+
+/* ------------------------------------ HMAC-SHA256 / PBKDF2 ------------------------------------ */
+
+namespace {
+
+using Digest = detail::Sha256Digest;
+
+inline std::string_view asStringView(const uint8_t* data, size_t size) noexcept {
+    return {reinterpret_cast<const char*>(data), size};  // NOLINT
+}
+
+#ifdef UAPP_CREDENTIAL_HASH_OPENSSL
+
+int toInt(size_t value) {
+    if (value > static_cast<size_t>(std::numeric_limits<int>::max())) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+    }
+    return static_cast<int>(value);
+}
+
+inline const unsigned char* asBytes(std::string_view data) noexcept {
+    return reinterpret_cast<const unsigned char*>(data.data());  // NOLINT
+}
+
+#else
+
+class Sha256 {
+public:
+    void update(const uint8_t* data, size_t size) noexcept {
+        for (size_t i = 0; i < size; ++i) {
+            block_[blockSize_++] = data[i];
+            if (blockSize_ == block_.size()) {
+                transform();
+                bitLength_ += 512;
+                blockSize_ = 0;
+            }
+        }
+    }
+
+    void update(std::string_view data) noexcept {
+        update(reinterpret_cast<const uint8_t*>(data.data()), data.size());  // NOLINT
+    }
+
+    Digest finish() noexcept {
+        bitLength_ += blockSize_ * 8;
+        const uint64_t bitLength = bitLength_;
+        const uint8_t pad = 0x80;
+        update(&pad, 1);
+        const uint8_t zero = 0;
+        while (blockSize_ != 56) {
+            update(&zero, 1);
+        }
+        for (int i = 7; i >= 0; --i) {
+            const auto byte = static_cast<uint8_t>(bitLength >> (i * 8));
+            update(&byte, 1);
+        }
+        Digest digest{};
+        for (size_t i = 0; i < 8; ++i) {
+            for (size_t j = 0; j < 4; ++j) {
+                digest[i * 4 + j] = static_cast<uint8_t>(state_[i] >> (24 - j * 8));
+            }
+        }
+        return digest;
+    }
+
+private:
+    static constexpr uint32_t rotr(uint32_t x, uint32_t n) noexcept {
+        return (x >> n) | (x << (32 - n));
+    }
+
+    void transform() noexcept {
+        static constexpr std::array<uint32_t, 64> k{
+            0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4,
+            0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe,
+            0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f,
+            0x4a7484aa, 0x5cb0a9dc, 0x76f988da, 0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+            0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc,
+            0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+            0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070, 0x19a4c116,
+            0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+            0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7,
+            0xc67178f2,
+        };
+        std::array<uint32_t, 64> w{};
+        for (size_t i = 0; i < 16; ++i) {
+            w[i] = (uint32_t{block_[i * 4]} << 24U) | (uint32_t{block_[i * 4 + 1]} << 16U) |
+                   (uint32_t{block_[i * 4 + 2]} << 8U) | uint32_t{block_[i * 4 + 3]};
+        }
+        for (size_t i = 16; i < 64; ++i) {
+            const uint32_t s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >> 3U);
+            const uint32_t s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >> 10U);
+            w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+        }
+        auto s = state_;
+        for (size_t i = 0; i < 64; ++i) {
+            const uint32_t s1 = rotr(s[4], 6) ^ rotr(s[4], 11) ^ rotr(s[4], 25);
+            const uint32_t ch = (s[4] & s[5]) ^ (~s[4] & s[6]);
+            const uint32_t t1 = s[7] + s1 + ch + k[i] + w[i];
+            const uint32_t s0 = rotr(s[0], 2) ^ rotr(s[0], 13) ^ rotr(s[0], 22);
+            const uint32_t maj = (s[0] & s[1]) ^ (s[0] & s[2]) ^ (s[1] & s[2]);
+            const uint32_t t2 = s0 + maj;
+            s = {t1 + t2, s[0], s[1], s[2], s[3] + t1, s[4], s[5], s[6]};
+        }
+        for (size_t i = 0; i < 8; ++i) {
+            state_[i] += s[i];
+        }
+    }
+
+    std::array<uint32_t, 8> state_{
+        0x6a09e667,
+        0xbb67ae85,
+        0x3c6ef372,
+        0xa54ff53a,
+        0x510e527f,
+        0x9b05688c,
+        0x1f83d9ab,
+        0x5be0cd19,
+    };
+    std::array<uint8_t, 64> block_{};
+    size_t blockSize_{0};
+    uint64_t bitLength_{0};
+};
+
+/// HMAC-SHA256 with precomputed inner and outer pads of the key.
+class HmacSha256 {
+public:
+    explicit HmacSha256(std::string_view key) noexcept {
+        std::array<uint8_t, 64> block{};
+        if (key.size() > block.size()) {
+            Sha256 hash;
+            hash.update(key);
+            const auto digest = hash.finish();
+            std::copy(digest.begin(), digest.end(), block.begin());
+        } else {
+            std::copy(key.begin(), key.end(), block.begin());
+        }
+        std::array<uint8_t, 64> pad{};
+        for (size_t i = 0; i < pad.size(); ++i) {
+            pad[i] = block[i] ^ 0x36U;
+        }
+        inner_.update(pad.data(), pad.size());
+        for (size_t i = 0; i < pad.size(); ++i) {
+            pad[i] = block[i] ^ 0x5cU;
+        }
+        outer_.update(pad.data(), pad.size());
+    }
+
+    /// Start a new MAC, the returned hash is updated with the message and passed to finish.
+    Sha256 begin() const noexcept {
+        return inner_;
+    }
+
+    Digest finish(Sha256& inner) const noexcept {
+        const auto innerDigest = inner.finish();
+        auto outer = outer_;
+        outer.update(innerDigest.data(), innerDigest.size());
+        return outer.finish();
+    }
+
+private:
+    Sha256 inner_;
+    Sha256 outer_;
+};
+#endif
+
+}  // namespace
+
+namespace detail {
+
+#ifdef UAPP_CREDENTIAL_HASH_OPENSSL
+
+Sha256Digest hmacSha256(std::string_view key, std::string_view message) {
+    Sha256Digest digest{};
+    unsigned int length = 0;
+    const auto* result = HMAC(
+        EVP_sha256(),
+        key.data(),
+        toInt(key.size()),
+        asBytes(message),
+        message.size(),
+        digest.data(),
+        &length
+    );
+    if (result == nullptr || length != digest.size()) {
+        throw BadStatus(UA_STATUSCODE_BADINTERNALERROR);
+    }
+    return digest;
+}
+
+Sha256Digest pbkdf2HmacSha256(
+    std::string_view password, std::string_view salt, uint32_t iterations
+) {
+    if (iterations == 0) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+    }
+    Sha256Digest key{};
+    const int ok = PKCS5_PBKDF2_HMAC(
+        password.data(),
+        toInt(password.size()),
+        asBytes(salt),
+        toInt(salt.size()),
+        toInt(iterations),
+        EVP_sha256(),
+        toInt(key.size()),
+        key.data()
+    );
+    if (ok != 1) {
+        throw BadStatus(UA_STATUSCODE_BADINTERNALERROR);
+    }
+    return key;
+}
+
+#else
+
+Sha256Digest hmacSha256(std::string_view key, std::string_view message) {
+    const HmacSha256 hmac(key);
+    auto hash = hmac.begin();
+    hash.update(message);
+    return hmac.finish(hash);
+}
+
+Sha256Digest pbkdf2HmacSha256(
+    std::string_view password, std::string_view salt, uint32_t iterations
+) {
+    if (iterations == 0) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+    }
+    const HmacSha256 hmac(password);
+    auto hash = hmac.begin();
+    hash.update(salt);
+    const std::array<uint8_t, 4> blockIndex{0, 0, 0, 1};
+    hash.update(blockIndex.data(), blockIndex.size());
+    Sha256Digest u = hmac.finish(hash);
+    Sha256Digest result = u;
+    for (uint32_t i = 1; i < iterations; ++i) {
+        hash = hmac.begin();
+        hash.update(u.data(), u.size());
+        u = hmac.finish(hash);
+        for (size_t j = 0; j < result.size(); ++j) {
+            result[j] ^= u[j];
+        }
+    }
+    return result;
+}
+
+#endif
+
+}  // namespace detail
+
+namespace {
+
+bool equalConstantTime(const Digest& lhs, const Digest& rhs) noexcept {
+    uint8_t diff = 0;
+    for (size_t i = 0; i < lhs.size(); ++i) {
+        diff |= static_cast<uint8_t>(lhs[i] ^ rhs[i]);
+    }
+    return diff == 0;
+}
+
+template <size_t N>
+void fillRandom(std::array<uint8_t, N>& bytes) {
+    std::random_device device;
+    for (auto& byte : bytes) {
+        byte = static_cast<uint8_t>(device());
+    }
+}
+
+}  // namespace
+
+/* ---------------------------------------- PasswordHash ---------------------------------------- */
+
+PasswordHash PasswordHash::derive(std::string_view password, uint32_t iterations) {
+    if (iterations == 0) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+    }
+    PasswordHash hash;
+    fillRandom(hash.salt);
+    hash.iterations = iterations;
+    hash.key = detail::pbkdf2HmacSha256(
+        password, asStringView(hash.salt.data(), hash.salt.size()), iterations
+    );
+    return hash;
+}
+
+bool PasswordHash::matches(std::string_view password) const {
+    if (iterations == 0) {
+        return false;
+    }
+    const auto derived = detail::pbkdf2HmacSha256(
+        password, asStringView(salt.data(), salt.size()), iterations
+    );
+    return equalConstantTime(derived, key);
+}
+
+/* --------------------------------------- CredentialStore -------------------------------------- */
+
+CredentialStore::CredentialStore(CredentialStoreOptions options)
+    : options_(options) {
+    fillRandom(cacheKey_);
+}
+
+CredentialStore::~CredentialStore() {
+    // pending verifications of verifyAsync access the store
+    std::unique_lock lock(mutex_);
+    pendingCv_.wait(lock, [&] { return pending_ == 0; });
+}
+
+CredentialStore::Digest CredentialStore::getCacheDigest(
+    std::string_view username, std::string_view password
+) const {
+    std::string message(username);
+    message.push_back('\0');  // separator
+    message.append(password);
+    return detail::hmacSha256(asStringView(cacheKey_.data(), cacheKey_.size()), message);
+}
+
+void CredentialStore::addUser(std::string_view username, std::string_view password) {
+    addUser(username, PasswordHash::derive(password, options_.iterations));
+}
+
+void CredentialStore::addUser(std::string_view username, const PasswordHash& hash) {
+    const std::lock_guard lock(mutex_);
+    const std::string key(username);
+    users_[key] = hash;
+    cache_.erase(key);
+}
+
+void CredentialStore::removeUser(std::string_view username) {
+    const std::lock_guard lock(mutex_);
+    const std::string key(username);
+    users_.erase(key);
+    cache_.erase(key);
+}
+
+size_t CredentialStore::size() const {
+    const std::lock_guard lock(mutex_);
+    return users_.size();
+}
+
+bool CredentialStore::verify(std::string_view username, std::string_view password) {
+    const bool useCache = options_.cacheDuration > Clock::duration::zero();
+    const auto digest = useCache ? getCacheDigest(username, password) : Digest{};
+    const std::string key(username);
+    std::optional<PasswordHash> hash;
+    {
+        const std::lock_guard lock(mutex_);
+        const auto user = users_.find(key);
+        if (user != users_.end()) {
+            if (useCache) {
+                if (auto it = cache_.find(key); it != cache_.end()) {
+                    if (it->second.expiry <= Clock::now()) {
+                        cache_.erase(it);
+                    } else if (equalConstantTime(it->second.digest, digest)) {
+                        ++cacheHits_;
+                        return true;
+                    }
+                }
+            }
+            hash = user->second;
+        }
+    }
+
+    // derive the key without holding the lock, verifications run concurrently
+    if (!hash.has_value()) {
+        // derive a key of the same cost for unknown users, the duration must not reveal them
+        if (options_.iterations > 0) {
+            detail::pbkdf2HmacSha256(
+                password, asStringView(cacheKey_.data(), cacheKey_.size()), options_.iterations
+            );
+        }
+        return false;
+    }
+    if (!hash->matches(password)) {
+        return false;
+    }
+    if (useCache) {
+        const std::lock_guard lock(mutex_);
+        const auto user = users_.find(key);
+        if (user == users_.end() || user->second.key != hash->key) {
+            return true;  // user changed during verification, do not cache
+        }
+        if (cache_.size() >= options_.maxCacheSize) {
+            cache_.clear();
+        }
+        cache_[key] = {digest, Clock::now() + options_.cacheDuration};
+    }
+    return true;
+}
+
+std::future<bool> CredentialStore::verifyAsync(std::string username, std::string password) {
+    // std::function of the worker pool requires a copyable task
+    auto task = std::make_shared<std::packaged_task<bool()>>(
+        [this, username = std::move(username), password = std::move(password)] {
+            return verify(username, password);
+        }
+    );
+    auto future = task->get_future();
+    {
+        const std::lock_guard lock(mutex_);
+        ++pending_;
+    }
+    auto& pool = WorkerPool::instance();
+    pool.reserve(std::max<size_t>(options_.asyncThreads, 1));
+    pool.post([this, task] {
+        (*task)();
+        const std::lock_guard lock(mutex_);
+        if (--pending_ == 0) {
+            pendingCv_.notify_all();
+        }
+    });
+    return future;
+}
+
+void CredentialStore::clearCache() {
+    const std::lock_guard lock(mutex_);
+    cache_.clear();
+}
+
+size_t CredentialStore::getCacheHits() const {
+    const std::lock_guard lock(mutex_);
+    return cacheHits_;
+}
+
+}  // namespace opcua
@@ -2,17 +2,35 @@
 
 #ifdef UA_ENABLE_ENCRYPTION
 
+#include <algorithm>  // min
+#include <atomic>
+#include <exception>
+#include <memory>
 #include <string>
 #include <string_view>
+#include <thread>
+#include <utility>  // move
 #include <vector>
 
 #include "open62541pp/ErrorHandling.h"
 #include "open62541pp/Logger.h"
 #include "open62541pp/TypeWrapper.h"
+#include "open62541pp/detail/ScopeExit.h"
 
 #include "CustomLogger.h"
 #include "open62541_impl.h"
 
+#ifdef UAPP_CREATE_CERTIFICATE
+#include <openssl/bio.h>
+#include <openssl/bn.h>
+#include <openssl/err.h>
+#include <openssl/evp.h>
+#include <openssl/pem.h>
+#include <openssl/rsa.h>
+#include <openssl/x509.h>
+#include <openssl/x509v3.h>
+#endif
+
 namespace opcua::crypto {
 
 #ifdef UAPP_CREATE_CERTIFICATE
@@ -65,6 +83,323 @@ CreateCertificateResult createCertificate(
     return result;
 }
 
+/* ------------------------------------------- OpenSSL ------------------------------------------ */
+
+template <typename T, void (*Free)(T*)>
+struct OpenSSLDeleter {
+    void operator()(T* ptr) const noexcept {
+        Free(ptr);
+    }
+};
+
+template <typename T, void (*Free)(T*)>
+using OpenSSLPtr = std::unique_ptr<T, OpenSSLDeleter<T, Free>>;
+
+using BioPtr = OpenSSLPtr<BIO, BIO_free_all>;
+using BignumPtr = OpenSSLPtr<BIGNUM, BN_free>;
+using KeyPtr = OpenSSLPtr<EVP_PKEY, EVP_PKEY_free>;
+using KeyContextPtr = OpenSSLPtr<EVP_PKEY_CTX, EVP_PKEY_CTX_free>;
+using X509Ptr = OpenSSLPtr<X509, X509_free>;
+using ExtensionPtr = OpenSSLPtr<X509_EXTENSION, X509_EXTENSION_free>;
+
+[[noreturn]] static void throwOpenSSLError(std::string_view what) {
+    std::string message(what);
+    const auto code = ERR_get_error();
+    ERR_clear_error();  // errors are queued per thread
+    if (code != 0) {
+        char buffer[256]{};  // NOLINT(*-avoid-c-arrays)
+        ERR_error_string_n(code, buffer, sizeof(buffer));
+        message.append(": ").append(buffer);
+    }
+    throw CreateCertificateError(message);
+}
+
+template <typename T>
+static T* checkOpenSSL(T* ptr, std::string_view what) {
+    if (ptr == nullptr) {
+        throwOpenSSLError(what);
+    }
+    return ptr;
+}
+
+static void checkOpenSSL(int result, std::string_view what) {
+    if (result <= 0) {
+        throwOpenSSLError(what);
+    }
+}
+
+static ByteString toByteString(BIO* bio) {
+    char* data = nullptr;
+    const auto length = BIO_get_mem_data(bio, &data);
+    return ByteString(std::string_view(data, static_cast<size_t>(length)));
+}
+
+static KeyPtr generateKey(size_t keySizeBits) {
+    const KeyContextPtr ctx(checkOpenSSL(
+        EVP_PKEY_CTX_new_id(EVP_PKEY_RSA, nullptr), "Failed to create key context"
+    ));
+    checkOpenSSL(EVP_PKEY_keygen_init(ctx.get()), "Failed to initialize key generation");
+    checkOpenSSL(
+        EVP_PKEY_CTX_set_rsa_keygen_bits(ctx.get(), static_cast<int>(keySizeBits)),
+        "Invalid key size"
+    );
+    EVP_PKEY* key = nullptr;
+    checkOpenSSL(EVP_PKEY_keygen(ctx.get(), &key), "Failed to generate key");
+    return KeyPtr(key);
+}
+
+static ByteString encodeKey(EVP_PKEY* key, CertificateFormat format) {
+    const BioPtr bio(checkOpenSSL(BIO_new(BIO_s_mem()), "Failed to allocate BIO"));
+    if (format == CertificateFormat::PEM) {
+        checkOpenSSL(
+            PEM_write_bio_PrivateKey(bio.get(), key, nullptr, nullptr, 0, nullptr, nullptr),
+            "Failed to encode private key"
+        );
+    } else {
+        checkOpenSSL(i2d_PrivateKey_bio(bio.get(), key), "Failed to encode private key");
+    }
+    return toByteString(bio.get());
+}
+
+static KeyPtr decodeKey(const ByteString& privateKey) {
+    const auto* data = privateKey.handle()->data;
+    const auto length = static_cast<int>(privateKey.handle()->length);
+    constexpr std::string_view pemPrefix = "-----BEGIN";
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const std::string_view str(reinterpret_cast<const char*>(data), privateKey.handle()->length);
+    if (str.substr(0, pemPrefix.size()) == pemPrefix) {
+        const BioPtr bio(checkOpenSSL(BIO_new_mem_buf(data, length), "Failed to allocate BIO"));
+        return KeyPtr(checkOpenSSL(
+            PEM_read_bio_PrivateKey(bio.get(), nullptr, nullptr, nullptr),
+            "Failed to decode private key"
+        ));
+    }
+    return KeyPtr(checkOpenSSL(
+        d2i_AutoPrivateKey(nullptr, &data, length), "Failed to decode private key"
+    ));
+}
+
+static void addExtension(X509* cert, int nid, const std::string& value) {
+    X509V3_CTX ctx;
+    X509V3_set_ctx_nodb(&ctx);
+    X509V3_set_ctx(&ctx, cert, cert, nullptr, nullptr, 0);
+    const ExtensionPtr ext(checkOpenSSL(
+        X509V3_EXT_conf_nid(nullptr, &ctx, nid, value.c_str()), "Invalid certificate extension"
+    ));
+    checkOpenSSL(X509_add_ext(cert, ext.get(), -1), "Failed to add certificate extension");
+}
+
+static ByteString signCertificate(
+    Span<const String> subject,
+    Span<const String> subjectAltName,
+    EVP_PKEY* key,
+    CertificateFormat certificateFormat
+) {
+    if (subject.empty() || subjectAltName.empty()) {
+        throw CreateCertificateError("Argument subject or subjectAltName is empty");
+    }
+    const X509Ptr cert(checkOpenSSL(X509_new(), "Failed to allocate certificate"));
+    checkOpenSSL(X509_set_version(cert.get(), 2), "Failed to set version");  // v3
+
+    // random 159 bit serial number (positive, at most 20 bytes)
+    const BignumPtr serial(checkOpenSSL(BN_new(), "Failed to allocate serial number"));
+    checkOpenSSL(BN_rand(serial.get(), 159, BN_RAND_TOP_ANY, BN_RAND_BOTTOM_ANY), "Failed RNG");
+    checkOpenSSL(
+        BN_to_ASN1_INTEGER(serial.get(), X509_get_serialNumber(cert.get())),
+        "Failed to set serial number"
+    );
+
+    constexpr long validitySeconds = 60L * 60 * 24 * 365;  // 1 year
+    checkOpenSSL(X509_gmtime_adj(X509_getm_notBefore(cert.get()), 0), "Failed to set validity");
+    checkOpenSSL(
+        X509_gmtime_adj(X509_getm_notAfter(cert.get()), validitySeconds), "Failed to set validity"
+    );
+    checkOpenSSL(X509_set_pubkey(cert.get(), key), "Failed to set public key");
+
+    X509_NAME* name = X509_get_subject_name(cert.get());
+    for (const auto& element : subject) {
+        const auto str = std::string(element);
+        const auto pos = str.find('=');
+        if (pos == std::string::npos) {
+            throw CreateCertificateError("Invalid subject element: " + str);
+        }
+        const auto field = str.substr(0, pos);
+        const auto value = str.substr(pos + 1);
+        checkOpenSSL(
+            X509_NAME_add_entry_by_txt(
+                name,
+                field.c_str(),
+                MBSTRING_UTF8,
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+                reinterpret_cast<const unsigned char*>(value.c_str()),
+                -1,
+                -1,
+                0
+            ),
+            "Invalid subject element: " + str
+        );
+    }
+    checkOpenSSL(X509_set_issuer_name(cert.get(), name), "Failed to set issuer");  // self-signed
+
+    std::string altNames;
+    for (const auto& element : subjectAltName) {
+        if (!altNames.empty()) {
+            altNames += ',';
+        }
+        altNames += element;
+    }
+    addExtension(cert.get(), NID_basic_constraints, "critical,CA:FALSE");
+    addExtension(
+        cert.get(),
+        NID_key_usage,
+        "critical,digitalSignature,nonRepudiation,keyEncipherment,dataEncipherment,keyCertSign"
+    );
+    addExtension(cert.get(), NID_ext_key_usage, "serverAuth,clientAuth");
+    addExtension(cert.get(), NID_subject_key_identifier, "hash");
+    addExtension(cert.get(), NID_subject_alt_name, altNames);
+
+    checkOpenSSL(X509_sign(cert.get(), key, EVP_sha256()), "Failed to sign certificate");
+
+    const BioPtr bio(checkOpenSSL(BIO_new(BIO_s_mem()), "Failed to allocate BIO"));
+    if (certificateFormat == CertificateFormat::PEM) {
+        checkOpenSSL(PEM_write_bio_X509(bio.get(), cert.get()), "Failed to encode certificate");
+    } else {
+        checkOpenSSL(i2d_X509_bio(bio.get(), cert.get()), "Failed to encode certificate");
+    }
+    return toByteString(bio.get());
+}
+
+/* ---------------------------------------- Thread pool ----------------------------------------- */
+
+/// Invoke `func(i)` for all indices `i < count` in parallel, rethrow the first exception.
+template <typename Func>
+static void parallelFor(size_t count, size_t threads, Func&& func) {
+    if (threads == 0) {
+        threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    std::atomic<size_t> next{0};
+    std::mutex mutex;
+    std::exception_ptr error;
+    auto worker = [&] {
+        for (size_t i = next++; i < count; i = next++) {
+            try {
+                func(i);
+            } catch (...) {
+                const std::lock_guard lock(mutex);
+                if (!error) {
+                    error = std::current_exception();
+                }
+                next = count;  // skip remaining items
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    {
+        const auto joinOnExit = detail::ScopeExit([&] {
+            for (auto& thread : pool) {
+                thread.join();
+            }
+        });
+        const size_t threadCount = std::min(threads, count);
+        pool.reserve(threadCount);
+        for (size_t i = 1; i < threadCount; ++i) {
+            pool.emplace_back(worker);
+        }
+        worker();  // calling thread participates
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+/* -------------------------------------- Batch generation -------------------------------------- */
+
+std::vector<ByteString> generatePrivateKeys(
+    size_t count, size_t keySizeBits, CertificateFormat keyFormat, size_t threads
+) {
+    std::vector<ByteString> keys(count);
+    parallelFor(count, threads, [&](size_t i) {
+        keys[i] = encodeKey(generateKey(keySizeBits).get(), keyFormat);
+    });
+    return keys;
+}
+
+ByteString createCertificate(
+    Span<const String> subject,
+    Span<const String> subjectAltName,
+    const ByteString& privateKey,
+    CertificateFormat certificateFormat
+) {
+    const auto key = decodeKey(privateKey);
+    return signCertificate(subject, subjectAltName, key.get(), certificateFormat);
+}
+
+std::vector<CreateCertificateResult> createCertificates(
+    Span<const CertificateRequest> requests,
+    size_t keySizeBits,
+    CertificateFormat certificateFormat,
+    size_t threads
+) {
+    std::vector<CreateCertificateResult> results(requests.size());
+    parallelFor(requests.size(), threads, [&](size_t i) {
+        const auto key = generateKey(keySizeBits);
+        results[i].certificate = signCertificate(
+            requests[i].subject, requests[i].subjectAltName, key.get(), certificateFormat
+        );
+        results[i].privateKey = encodeKey(key.get(), certificateFormat);
+    });
+    return results;
+}
+
+/* --------------------------------------- PrivateKeyPool --------------------------------------- */
+
+PrivateKeyPool::PrivateKeyPool(size_t keySizeBits, CertificateFormat keyFormat)
+    : keySizeBits_(keySizeBits),
+      keyFormat_(keyFormat) {}
+
+void PrivateKeyPool::fill(size_t targetSize, size_t threads) {
+    const size_t available = size();
+    if (available >= targetSize) {
+        return;
+    }
+    // generate without lock, keys can be acquired meanwhile
+    auto keys = generatePrivateKeys(targetSize - available, keySizeBits_, keyFormat_, threads);
+    const std::lock_guard lock(mutex_);
+    for (auto& key : keys) {
+        keys_.push_back(std::move(key));
+    }
+}
+
+ByteString PrivateKeyPool::acquire() {
+    {
+        const std::lock_guard lock(mutex_);
+        if (!keys_.empty()) {
+            auto key = std::move(keys_.front());
+            keys_.pop_front();
+            return key;
+        }
+    }
+    return encodeKey(generateKey(keySizeBits_).get(), keyFormat_);
+}
+
+CreateCertificateResult PrivateKeyPool::createCertificate(
+    Span<const String> subject,
+    Span<const String> subjectAltName,
+    CertificateFormat certificateFormat
+) {
+    CreateCertificateResult result;
+    result.privateKey = acquire();
+    result.certificate =
+        crypto::createCertificate(subject, subjectAltName, result.privateKey, certificateFormat);
+    return result;
+}
+
+size_t PrivateKeyPool::size() const {
+    const std::lock_guard lock(mutex_);
+    return keys_.size();
+}
+
 #endif  // ifdef UAPP_CREATE_CERTIFICATE
 
 }  // namespace opcua::crypto
@@ -0,0 +1,125 @@
+#include "CryptoOffload.h"
+
+#ifdef UAPP_HAS_CRYPTO_OFFLOAD
+
+#include <array>
+#include <atomic>
+#include <cstring>  // memmove
+#include <mutex>
+#include <utility>  // index_sequence
+#include <vector>
+
+#include "WorkerPool.h"
+
+namespace opcua {
+
+/* ---------------------------------------- Trampolines ----------------------------------------- */
+
+using DecryptFn = decltype(UA_SecurityPolicyEncryptionAlgorithm::decrypt);
+using KeyLengthFn = decltype(UA_SecurityPolicyEncryptionAlgorithm::getLocalKeyLength);
+
+struct Slot {
+    std::atomic<DecryptFn> decrypt{nullptr};
+    std::atomic<KeyLengthFn> getLocalKeyLength{nullptr};
+};
+
+// distinct policy implementations (Basic128Rsa15, Basic256, Basic256Sha256, Aes128/256...)
+constexpr size_t maxSlots = 16;
+static std::array<Slot, maxSlots> slots;  // NOLINT(*-avoid-non-const-global-variables)
+static std::mutex slotsMutex;  // NOLINT(*-avoid-non-const-global-variables)
+
+template <size_t Index>
+static UA_StatusCode decryptOffloaded(void* channelContext, UA_ByteString* data) {
+    const auto decrypt = slots[Index].decrypt.load();
+    const auto getLocalKeyLength = slots[Index].getLocalKeyLength.load();
+    const size_t blockSize = getLocalKeyLength(channelContext) / 8;  // bits -> bytes
+    if (blockSize == 0 || data->length % blockSize != 0 || data->length / blockSize < 2) {
+        return decrypt(channelContext, data);
+    }
+
+    // decrypt the blocks in place, each block shrinks to its plaintext
+    const size_t blocks = data->length / blockSize;
+    std::vector<UA_ByteString> plaintexts(blocks);
+    std::vector<UA_StatusCode> results(blocks, UA_STATUSCODE_GOOD);
+    WorkerPool::instance().run(blocks, [&](size_t i) {
+        plaintexts[i].data = data->data + (i * blockSize);  // NOLINT(*-pointer-arithmetic)
+        plaintexts[i].length = blockSize;
+        results[i] = decrypt(channelContext, &plaintexts[i]);
+    });
+
+    size_t length = 0;
+    for (size_t i = 0; i < blocks; ++i) {
+        if (results[i] != UA_STATUSCODE_GOOD) {
+            return results[i];
+        }
+        // NOLINTNEXTLINE(*-pointer-arithmetic)
+        std::memmove(data->data + length, plaintexts[i].data, plaintexts[i].length);
+        length += plaintexts[i].length;
+    }
+    data->length = length;
+    return UA_STATUSCODE_GOOD;
+}
+
+template <size_t... Indices>
+static constexpr auto makeTrampolines(std::index_sequence<Indices...> /* unused */) {
+    return std::array<DecryptFn, sizeof...(Indices)>{&decryptOffloaded<Indices>...};
+}
+
+static constexpr auto trampolines = makeTrampolines(std::make_index_sequence<maxSlots>{});
+
+static size_t findTrampoline(DecryptFn decrypt) noexcept {
+    for (size_t i = 0; i < maxSlots; ++i) {
+        if (trampolines[i] == decrypt) {
+            return i;
+        }
+    }
+    return maxSlots;
+}
+
+static size_t acquireSlot(UA_SecurityPolicyEncryptionAlgorithm& algorithm) {
+    for (size_t i = 0; i < maxSlots; ++i) {
+        auto& slot = slots[i];
+        if (slot.decrypt == nullptr) {
+            slot.decrypt = algorithm.decrypt;
+            slot.getLocalKeyLength = algorithm.getLocalKeyLength;
+            return i;
+        }
+        if (slot.decrypt == algorithm.decrypt &&
+            slot.getLocalKeyLength == algorithm.getLocalKeyLength) {
+            return i;
+        }
+    }
+    return maxSlots;
+}
+
+void setAsymmetricCryptoOffload(UA_ServerConfig& config, size_t threads) {
+    if (threads > 0) {
+        WorkerPool::instance().reserve(threads);
+    }
+    const std::lock_guard lock(slotsMutex);
+    for (size_t i = 0; i < config.securityPoliciesSize; ++i) {
+        auto& algorithm =
+            config.securityPolicies[i].asymmetricModule.cryptoModule.encryptionAlgorithm;
+        if (algorithm.decrypt == nullptr || algorithm.getLocalKeyLength == nullptr) {
+            continue;  // e.g. policy None
+        }
+        const size_t installed = findTrampoline(algorithm.decrypt);
+        if (threads == 0) {
+            if (installed < maxSlots) {
+                algorithm.decrypt = slots[installed].decrypt;
+            }
+            continue;
+        }
+        if (installed < maxSlots) {
+            continue;
+        }
+        const size_t slot = acquireSlot(algorithm);
+        if (slot < maxSlots) {
+            algorithm.decrypt = trampolines[slot];
+        }
+    }
+}
+
+}  // namespace opcua
+
+#endif
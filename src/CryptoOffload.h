@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstddef>
+
+#include "open62541pp/Config.h"
+
+#include "open62541_impl.h"
+
+#ifdef UAPP_HAS_CRYPTO_OFFLOAD
+
+namespace opcua {
+
+/**
+ * Offload the asymmetric decryption of the security policies to a worker pool.
+ *
+ * Asymmetrically encrypted messages (OpenSecureChannel requests, encrypted user identity tokens)
+ * consist of independent RSA blocks, one per key size (e.g. 256 bytes with 2048 bit keys). The
+ * blocks are decrypted in parallel by the worker pool and the calling thread, which shortens the
+ * time the server loop is blocked by a handshake from one private key operation per block to
+ * roughly one in total.
+ *
+ * The native decrypt callbacks have no context, the wrappers are therefore static trampolines
+ * (one per distinct policy implementation) and the worker pool is shared by all servers.
+ *
+ * @param config Server config, the security policies are modified in place
+ * @param threads Number of worker threads, 0 restores the inline decryption
+ */
+void setAsymmetricCryptoOffload(UA_ServerConfig& config, size_t threads);
+
+}  // namespace opcua
+
+#endif
@@ -5,6 +5,8 @@
 #include <cstdint>
 #include <exception>
 #include <functional>  // invoke
+#include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <utility>  // move
@@ -16,6 +18,7 @@
 #include "open62541pp/Server.h"
 #include "open62541pp/Session.h"
 #include "open62541pp/TypeWrapper.h"  // asWrapper, asNative
+#include "open62541pp/detail/ServerContext.h"
 #include "open62541pp/detail/helper.h"
 #include "open62541pp/types/Builtin.h"
 #include "open62541pp/types/DataValue.h"
@@ -38,6 +41,33 @@ inline static Server& getServer(UA_AccessControl* ac) noexcept {
     return getContext(ac).getServer();
 }
 
+static void notifyAppliedChange([[maybe_unused]] UA_Server* server, void* data) noexcept {
+    auto& context = *static_cast<detail::ServerContext*>(data);
+    context.addressSpaceChangePending.store(false, std::memory_order_release);
+    context.notifyAddressSpaceChange();
+}
+
+/// NodeManagement services of clients bypass the C++ API, invalidate the derived views here.
+/// The callbacks run before the change is applied. Without `UA_MULTITHREADING >= 100` no server
+/// lock keeps other threads from caching stale results in between, so the views are invalidated
+/// again by a timed callback, that runs after the current request.
+inline static bool notifyIfAllowed(UA_AccessControl* ac, bool allowed) {
+    if (allowed) {
+        auto& server = getServer(ac);
+        auto& context = detail::getContext(server);
+        context.notifyAddressSpaceChange();
+        if (!context.addressSpaceChangePending.exchange(true, std::memory_order_acq_rel)) {
+            const auto status = UA_Server_addTimedCallback(
+                server.handle(), notifyAppliedChange, &context, UA_DateTime_nowMonotonic(), nullptr
+            );
+            if (status != UA_STATUSCODE_GOOD) {
+                context.addressSpaceChangePending.store(false, std::memory_order_release);
+            }
+        }
+    }
+    return allowed;
+}
+
 template <typename WrapperType, typename NativeType = typename WrapperType::NativeType>
 inline static const WrapperType& asWrapperRef(const NativeType* nativePtr) {
     static const WrapperType empty;
@@ -45,11 +75,41 @@ inline static const WrapperType& asWrapperRef(const NativeType* nativePtr) {
 }
 
 inline static Session getSession(UA_AccessControl* ac, const UA_NodeId* sessionId) noexcept {
-    // session constructed with every call to access control
-    // future optimization: store session object in sessionContext
     return {getServer(ac), asWrapperRef<NodeId>(sessionId)};
 }
 
+/**
+ * Session of a callback.
+ * Activated sessions are stored and referenced by the session context (or the session id), only
+ * other sessions (e.g. detached or internal sessions) are constructed with a copy of the id.
+ */
+class SessionRef {
+public:
+    SessionRef(UA_AccessControl* ac, const UA_NodeId* sessionId, void* sessionContext) noexcept
+        : entry_(
+              sessionContext != nullptr
+                  ? static_cast<SessionEntry*>(sessionContext)
+                  : getContext(ac).findSession(asWrapperRef<NodeId>(sessionId))
+          ) {
+        if (entry_ == nullptr) {
+            temporary_.emplace(getSession(ac, sessionId));
+        }
+    }
+
+    Session& get() noexcept {
+        return entry_ != nullptr ? entry_->session : *temporary_;
+    }
+
+    SessionEntry* getEntry() noexcept {
+        return entry_;
+    }
+
+private:
+    SessionEntry* entry_;
+    std::optional<Session> temporary_;
+    detail::SessionScope scope_{entry_};
+};
+
 inline static AccessControlBase& getAccessControl(UA_AccessControl* ac) noexcept {
     auto* accessControl = getContext(ac).getAccessControl();
     assert(accessControl != nullptr);
@@ -67,6 +127,44 @@ inline static void logException(
     log(server, LogLevel::Warning, LogCategory::Server, message);
 }
 
+/// Invoke `decide()` or return the cached decision of the session and node.
+template <typename T, typename F>
+static T cachedDecision(
+    AccessControlBase& accessControl,
+    SessionRef& session,
+    const UA_NodeId* nodeId,
+    AccessDecisions::Flag flag,
+    T AccessDecisions::*member,
+    F&& decide
+) {
+#ifdef UAPP_LOW_MEMORY
+    constexpr size_t maxDecisions = 1U << 10U;  // per session, discarded if exceeded
+#else
+    constexpr size_t maxDecisions = 1U << 16U;  // per session, discarded if exceeded
+#endif
+    auto* entry = session.getEntry();
+    if (entry == nullptr || nodeId == nullptr || !accessControl.isDecisionCacheEnabled()) {
+        return decide();
+    }
+    if (entry->decisionEpoch != accessControl.getDecisionEpoch()) {
+        entry->decisions.clear();
+        entry->decisionEpoch = accessControl.getDecisionEpoch();
+    }
+    const auto& id = asWrapper<NodeId>(*nodeId);
+    if (auto it = entry->decisions.find(id); it != entry->decisions.end()) {
+        if ((it->second.cached & flag) != 0) {
+            return it->second.*member;
+        }
+    } else if (entry->decisions.size() >= maxDecisions) {
+        entry->decisions.clear();
+    }
+    const T result = decide();  // exceptions are not cached
+    auto& decisions = entry->decisions[id];
+    decisions.*member = result;
+    decisions.cached = static_cast<uint8_t>(decisions.cached | flag);
+    return result;
+}
+
 template <typename F, typename ReturnType = std::invoke_result_t<F>>
 inline static auto invokeAccessCallback(
     UA_Server* server, std::string_view callbackName, ReturnType returnOnException, F&& fn
@@ -86,18 +184,39 @@ static UA_StatusCode activateSession(
     const UA_ByteString* secureChannelRemoteCertificate,
     const UA_NodeId* sessionId,
     const UA_ExtensionObject* userIdentityToken,
-    [[maybe_unused]] void** sessionContext
+    void** sessionContext
 ) {
     return invokeAccessCallback(server, "activateSession", UA_STATUSCODE_BADINTERNALERROR, [&] {
-        auto session = getSession(ac, sessionId);
-        const auto status = getAccessControl(ac).activateSession(
-            session,
-            asWrapperRef<EndpointDescription>(endpointDescription),
-            asWrapperRef<ByteString>(secureChannelRemoteCertificate),
-            asWrapperRef<ExtensionObject>(userIdentityToken)
-        );
+        // create the entry before the callback to allow attaching session contexts
+        auto& context = getContext(ac);
+        const auto& id = asWrapperRef<NodeId>(sessionId);
+        auto* entry = context.findSession(id);
+        const bool created = entry == nullptr;
+        if (created) {
+            entry = &context.onSessionActivated(id);
+        }
+        StatusCode status;
+        try {
+            const detail::SessionScope scope(entry);
+            status = getAccessControl(ac).activateSession(
+                entry->session,
+                asWrapperRef<EndpointDescription>(endpointDescription),
+                asWrapperRef<ByteString>(secureChannelRemoteCertificate),
+                asWrapperRef<ExtensionObject>(userIdentityToken)
+            );
+        } catch (...) {
+            if (created) {
+                context.onSessionClosed(id);
+            }
+            throw;
+        }
         if (status.isGood()) {
-            getContext(ac).onSessionActivated(asWrapperRef<NodeId>(sessionId));
+            context.onSessionActivated(id);  // discard cached decisions of the previous user
+            if (sessionContext != nullptr) {
+                *sessionContext = entry;
+            }
+        } else if (created) {
+            context.onSessionClosed(id);
         }
         return status.get();
     });
@@ -107,11 +226,11 @@ static void closeSession(
     UA_Server* server,
     UA_AccessControl* ac,
     const UA_NodeId* sessionId,
-    [[maybe_unused]] void* sessionContext
+    void* sessionContext
 ) {
     try {
-        auto session = getSession(ac, sessionId);
-        getAccessControl(ac).closeSession(session);
+        SessionRef session(ac, sessionId, sessionContext);
+        getAccessControl(ac).closeSession(session.get());
         getContext(ac).onSessionClosed(asWrapperRef<NodeId>(sessionId));
     } catch (const std::exception& e) {
         logException(server, "closeSession", e.what());
@@ -122,13 +241,24 @@ static UA_UInt32 getUserRightsMask(
     UA_Server* server,
     UA_AccessControl* ac,
     const UA_NodeId* sessionId,
-    [[maybe_unused]] void* sessionContext,
+    void* sessionContext,
     const UA_NodeId* nodeId,
     [[maybe_unused]] void* nodeContext
 ) {
     return invokeAccessCallback(server, "getUserRightsMask", uint32_t{}, [&] {
-        auto session = getSession(ac, sessionId);
-        return getAccessControl(ac).getUserRightsMask(session, asWrapperRef<NodeId>(nodeId)).get();
+        SessionRef session(ac, sessionId, sessionContext);
+        auto& accessControl = getAccessControl(ac);
+        return cachedDecision(
+            accessControl,
+            session,
+            nodeId,
+            AccessDecisions::RightsMask,
+            &AccessDecisions::rightsMask,
+            [&] {
+                return accessControl.getUserRightsMask(session.get(), asWrapperRef<NodeId>(nodeId))
+                    .get();
+            }
+        );
     });
 }
 
@@ -136,13 +266,24 @@ static UA_Byte getUserAccessLevel(
     UA_Server* server,
     UA_AccessControl* ac,
     const UA_NodeId* sessionId,
-    [[maybe_unused]] void* sessionContext,
+    void* sessionContext,
     const UA_NodeId* nodeId,
     [[maybe_unused]] void* nodeContext
 ) {
     return invokeAccessCallback(server, "getUserAccessLevel", uint8_t{}, [&] {
-        auto session = getSession(ac, sessionId);
-        return getAccessControl(ac).getUserAccessLevel(session, asWrapperRef<NodeId>(nodeId)).get();
+        SessionRef session(ac, sessionId, sessionContext);
+        auto& accessControl = getAccessControl(ac);
+        return cachedDecision(
+            accessControl,
+            session,
+            nodeId,
+            AccessDecisions::AccessLevel,
+            &AccessDecisions::accessLevel,
+            [&] {
+                return accessControl.getUserAccessLevel(session.get(), asWrapperRef<NodeId>(nodeId))
+                    .get();
+            }
+        );
     });
 }
 
@@ -150,13 +291,15 @@ static UA_Boolean getUserExecutable(
     UA_Server* server,
     UA_AccessControl* ac,
     const UA_NodeId* sessionId,
-    [[maybe_unused]] void* sessionContext,
+    void* sessionContext,
     const UA_NodeId* methodId,
     [[maybe_unused]] void* methodContext
 ) {
     return invokeAccessCallback(server, "getUserExecutable", false, [&] {
-        auto session = getSession(ac, sessionId);
-        return getAccessControl(ac).getUserExecutable(session, asWrapperRef<NodeId>(methodId));
+        SessionRef session(ac, sessionId, sessionContext);
+        return getAccessControl(ac).getUserExecutable(
+            session.get(), asWrapperRef<NodeId>(methodId)
+        );
     });
 }
 
@@ -164,16 +307,16 @@ static UA_Boolean getUserExecutableOnObject(
     UA_Server* server,
     UA_AccessControl* ac,
     const UA_NodeId* sessionId,
-    [[maybe_unused]] void* sessionContext,
+    void* sessionContext,
     const UA_NodeId* methodId,
     [[maybe_unused]] void* methodContext,
     const UA_NodeId* objectId,
     [[maybe_unused]] void* objectContext
 ) {
     return invokeAccessCallback(server, "getUserExecutableOnObject", false, [&] {
-        auto session = getSession(ac, sessionId);
+        SessionRef session(ac, sessionId, sessionContext);
         return getAccessControl(ac).getUserExecutableOnObject(
-            session, asWrapperRef<NodeId>(methodId), asWrapperRef<NodeId>(objectId)
+            session.get(), asWrapperRef<NodeId>(methodId), asWrapperRef<NodeId>(objectId)
         );
     });
 }
@@ -182,12 +325,15 @@ static UA_Boolean allowAddNode(
     UA_Server* server,
     UA_AccessControl* ac,
     const UA_NodeId* sessionId,
-    [[maybe_unused]] void* sessionContext,
+    void* sessionContext,
     const UA_AddNodesItem* item
 ) {
     return invokeAccessCallback(server, "allowAddNode", false, [&] {
-        auto session = getSession(ac, sessionId);
-        return getAccessControl(ac).allowAddNode(session, asWrapperRef<AddNodesItem>(item));
+        SessionRef session(ac, sessionId, sessionContext);
+        const bool allowed = getAccessControl(ac).allowAddNode(
+            session.get(), asWrapperRef<AddNodesItem>(item)
+        );
+        return notifyIfAllowed(ac, allowed);
     });
 }
 
@@ -195,14 +341,15 @@ static UA_Boolean allowAddReference(
     UA_Server* server,
     UA_AccessControl* ac,
     const UA_NodeId* sessionId,
-    [[maybe_unused]] void* sessionContext,
+    void* sessionContext,
     const UA_AddReferencesItem* item
 ) {
     return invokeAccessCallback(server, "allowAddReference", false, [&] {
-        auto session = getSession(ac, sessionId);
-        return getAccessControl(ac).allowAddReference(
-            session, asWrapperRef<AddReferencesItem>(item)
+        SessionRef session(ac, sessionId, sessionContext);
+        const bool allowed = getAccessControl(ac).allowAddReference(
+            session.get(), asWrapperRef<AddReferencesItem>(item)
         );
+        return notifyIfAllowed(ac, allowed);
     });
 }
 
@@ -210,12 +357,15 @@ static UA_Boolean allowDeleteNode(
     UA_Server* server,
     UA_AccessControl* ac,
     const UA_NodeId* sessionId,
-    [[maybe_unused]] void* sessionContext,
+    void* sessionContext,
     const UA_DeleteNodesItem* item
 ) {
     return invokeAccessCallback(server, "allowDeleteNode", false, [&] {
-        auto session = getSession(ac, sessionId);
-        return getAccessControl(ac).allowDeleteNode(session, asWrapperRef<DeleteNodesItem>(item));
+        SessionRef session(ac, sessionId, sessionContext);
+        const bool allowed = getAccessControl(ac).allowDeleteNode(
+            session.get(), asWrapperRef<DeleteNodesItem>(item)
+        );
+        return notifyIfAllowed(ac, allowed);
     });
 }
 
@@ -223,14 +373,15 @@ static UA_Boolean allowDeleteReference(
     UA_Server* server,
     UA_AccessControl* ac,
     const UA_NodeId* sessionId,
-    [[maybe_unused]] void* sessionContext,
+    void* sessionContext,
     const UA_DeleteReferencesItem* item
 ) {
     return invokeAccessCallback(server, "allowDeleteReference", false, [&] {
-        auto session = getSession(ac, sessionId);
-        return getAccessControl(ac).allowDeleteReference(
-            session, asWrapperRef<DeleteReferencesItem>(item)
+        SessionRef session(ac, sessionId, sessionContext);
+        const bool allowed = getAccessControl(ac).allowDeleteReference(
+            session.get(), asWrapperRef<DeleteReferencesItem>(item)
         );
+        return notifyIfAllowed(ac, allowed);
     });
 }
 
@@ -238,13 +389,23 @@ static UA_Boolean allowDeleteReference(
     UA_Server* server,
     UA_AccessControl* ac,
     const UA_NodeId* sessionId,
-    [[maybe_unused]] void* sessionContext,
+    void* sessionContext,
     const UA_NodeId* nodeId,
     [[maybe_unused]] void* nodeContext
 ) {
     return invokeAccessCallback(server, "allowBrowseNode", false, [&] {
-        auto session = getSession(ac, sessionId);
-        return getAccessControl(ac).allowBrowseNode(session, asWrapperRef<NodeId>(nodeId));
+        SessionRef session(ac, sessionId, sessionContext);
+        auto& accessControl = getAccessControl(ac);
+        return cachedDecision(
+            accessControl,
+            session,
+            nodeId,
+            AccessDecisions::Browse,
+            &AccessDecisions::browse,
+            [&] {
+                return accessControl.allowBrowseNode(session.get(), asWrapperRef<NodeId>(nodeId));
+            }
+        );
     });
 }
 
@@ -253,14 +414,14 @@ static UA_Boolean allowDeleteReference(
     UA_Server* server,
     UA_AccessControl* ac,
     const UA_NodeId* oldSessionId,
-    [[maybe_unused]] void* oldSessionContext,
+    void* oldSessionContext,
     const UA_NodeId* newSessionId,
-    [[maybe_unused]] void* newSessionContext
+    void* newSessionContext
 ) {
     return invokeAccessCallback(server, "allowTransferSubscription", false, [&] {
-        auto oldSession = getSession(ac, oldSessionId);
-        auto newSession = getSession(ac, newSessionId);
-        return getAccessControl(ac).allowTransferSubscription(oldSession, newSession);
+        SessionRef oldSession(ac, oldSessionId, oldSessionContext);
+        SessionRef newSession(ac, newSessionId, newSessionContext);
+        return getAccessControl(ac).allowTransferSubscription(oldSession.get(), newSession.get());
     });
 }
 #endif
@@ -270,15 +431,15 @@ static UA_Boolean allowHistoryUpdateUpdateData(
     UA_Server* server,
     UA_AccessControl* ac,
     const UA_NodeId* sessionId,
-    [[maybe_unused]] void* sessionContext,
+    void* sessionContext,
     const UA_NodeId* nodeId,
     UA_PerformUpdateType performInsertReplace,
     const UA_DataValue* value
 ) {
     return invokeAccessCallback(server, "allowHistoryUpdate", false, [&] {
-        auto session = getSession(ac, sessionId);
+        SessionRef session(ac, sessionId, sessionContext);
         return getAccessControl(ac).allowHistoryUpdate(
-            session,
+            session.get(),
             asWrapperRef<NodeId>(nodeId),
             static_cast<PerformUpdateType>(performInsertReplace),
             asWrapperRef<DataValue>(value)
@@ -290,16 +451,16 @@ static UA_Boolean allowHistoryUpdateDeleteRawModified(
     UA_Server* server,
     UA_AccessControl* ac,
     const UA_NodeId* sessionId,
-    [[maybe_unused]] void* sessionContext,
+    void* sessionContext,
     const UA_NodeId* nodeId,
     UA_DateTime startTimestamp,
     UA_DateTime endTimestamp,
     bool isDeleteModified
 ) {
     return invokeAccessCallback(server, "allowHistoryDelete", false, [&] {
-        auto session = getSession(ac, sessionId);
+        SessionRef session(ac, sessionId, sessionContext);
         return getAccessControl(ac).allowHistoryDelete(
-            session,
+            session.get(),
             asWrapperRef<NodeId>(nodeId),
             DateTime(startTimestamp),
             DateTime(endTimestamp),
@@ -326,6 +487,42 @@ void clearUaAccessControl(UA_AccessControl& ac) noexcept {
     ac = UA_AccessControl{};
 }
 
+static thread_local SessionEntry* currentSession = nullptr;
+
+SessionScope::SessionScope(SessionEntry* entry) noexcept
+    : previous_(currentSession) {
+    currentSession = entry;
+}
+
+SessionScope::SessionScope(UA_Server* server, void* sessionContext) noexcept
+    : previous_(currentSession) {
+    currentSession = getSessionEntry(server, sessionContext);
+}
+
+SessionScope::~SessionScope() {
+    currentSession = previous_;
+}
+
+SessionEntry* SessionScope::getCurrent() noexcept {
+    return currentSession;
+}
+
+Server* findServer(UA_Server* server) noexcept {
+    auto* config = server != nullptr ? UA_Server_getConfig(server) : nullptr;
+    if (config == nullptr || config->accessControl.activateSession != opcua::activateSession) {
+        return nullptr;
+    }
+    return &getServer(&config->accessControl);
+}
+
+SessionEntry* getSessionEntry(UA_Server* server, void* sessionContext) noexcept {
+    // the session context is only a SessionEntry if set by the activateSession callback above
+    const auto* config = server != nullptr ? UA_Server_getConfig(server) : nullptr;
+    const bool isCustom = config != nullptr &&
+                          config->accessControl.activateSession == opcua::activateSession;
+    return isCustom ? static_cast<SessionEntry*>(sessionContext) : nullptr;
+}
+
 }  // namespace detail
 
 static void copyUserTokenPoliciesToEndpoints(UA_ServerConfig* config) {
@@ -413,18 +610,30 @@ void CustomAccessControl::setAccessControl(std::unique_ptr<AccessControlBase> ac
     setAccessControl();
 }
 
-void CustomAccessControl::onSessionActivated(const NodeId& sessionId) {
-    sessionIds_.insert(sessionId);
+SessionEntry& CustomAccessControl::onSessionActivated(const NodeId& sessionId) {
+    auto& entry = sessions_[sessionId];
+    if (entry == nullptr) {
+        entry = std::make_unique<SessionEntry>(Session(server_, sessionId));
+    }
+    entry->decisions.clear();  // user might have changed
+    return *entry;
 }
 
 void CustomAccessControl::onSessionClosed(const NodeId& sessionId) {
-    sessionIds_.erase(sessionId);
+    sessions_.erase(sessionId);
+    detail::getContext(server_).browseContinuations.releaseSession(sessionId);
+}
+
+SessionEntry* CustomAccessControl::findSession(const NodeId& sessionId) noexcept {
+    const auto it = sessions_.find(sessionId);
+    return it == sessions_.end() ? nullptr : it->second.get();
 }
 
 std::vector<Session> CustomAccessControl::getSessions() const {
     std::vector<Session> result;
-    for (auto id : sessionIds_) {
-        result.emplace_back(server_, std::move(id));
+    result.reserve(sessions_.size());
+    for (const auto& [id, entry] : sessions_) {
+        result.push_back(entry->session);
     }
     return result;
 }
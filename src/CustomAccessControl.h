@@ -1,15 +1,20 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
-#include <set>
+#include <unordered_map>
+#include <utility>  // move
 #include <variant>
 #include <vector>
 
+#include "open62541pp/Session.h"
 #include "open62541pp/types/Composed.h"
 #include "open62541pp/types/NodeId.h"
 
 // forward declare
 struct UA_AccessControl;
+struct UA_Server;
 
 namespace opcua {
 
@@ -21,8 +26,72 @@ void clearUaAccessControl(UA_AccessControl& ac) noexcept;
 
 // forward declare
 class AccessControlBase;
+class CustomAccessControl;
 class Server;
-class Session;
+
+/// Cached access decisions of a node.
+struct AccessDecisions {
+    enum Flag : uint8_t {
+        RightsMask = 1U << 0U,
+        AccessLevel = 1U << 1U,
+        Browse = 1U << 2U,
+    };
+
+    uint8_t cached = 0;  // flags of the cached decisions
+    uint8_t accessLevel = 0;
+    bool browse = false;
+    uint32_t rightsMask = 0;
+};
+
+/// State of an activated session, set as session context of the native callbacks.
+struct SessionEntry {
+    explicit SessionEntry(Session session)
+        : session(std::move(session)) {}
+
+    Session session;
+    uint64_t decisionEpoch = 0;
+    std::unordered_map<NodeId, AccessDecisions> decisions;
+    std::vector<std::shared_ptr<void>> slots;  // by SessionSlot index
+    uint64_t admissionIteration = 0;  // server iteration of admittedOperations
+    size_t admittedOperations = 0;
+};
+
+namespace detail {
+
+/**
+ * Set the session of the callback invoked on the current thread.
+ * The previous session is restored on destruction (nested callbacks).
+ */
+class SessionScope {
+public:
+    explicit SessionScope(SessionEntry* entry) noexcept;
+
+    /// Set the session from the native session context, only if set by CustomAccessControl.
+    SessionScope(UA_Server* server, void* sessionContext) noexcept;
+
+    ~SessionScope();
+
+    SessionScope(const SessionScope&) = delete;
+    SessionScope(SessionScope&&) noexcept = delete;
+    SessionScope& operator=(const SessionScope&) = delete;
+    SessionScope& operator=(SessionScope&&) noexcept = delete;
+
+    /// Get the session of the current callback or `nullptr`.
+    static SessionEntry* getCurrent() noexcept;
+
+private:
+    SessionEntry* previous_;
+};
+
+/// Get the server of a native server, only if its access control is set by CustomAccessControl.
+Server* findServer(UA_Server* server) noexcept;
+
+/// Get the session entry of a native session context, only if set by CustomAccessControl.
+/// Other access controls store other data in the session context, e.g. the default access
+/// control of open62541 the username.
+SessionEntry* getSessionEntry(UA_Server* server, void* sessionContext) noexcept;
+
+}  // namespace detail
 
 class CustomAccessControl {
 public:
@@ -36,12 +105,23 @@ public:
     /// Set and apply custom access control (transfer ownership).
     void setAccessControl(std::unique_ptr<AccessControlBase> accessControl);
 
-    void onSessionActivated(const NodeId& sessionId);
+    SessionEntry& onSessionActivated(const NodeId& sessionId);
     void onSessionClosed(const NodeId& sessionId);
 
+    /// Find the state of an activated session.
+    SessionEntry* findSession(const NodeId& sessionId) noexcept;
+
     /// Get active sessions.
     std::vector<Session> getSessions() const;
 
+    /// Invoke `func(Session&)` for each active session without copies.
+    template <typename Func>
+    void forEachSession(Func&& func) {
+        for (auto& [id, entry] : sessions_) {
+            func(entry->session);
+        }
+    }
+
     Server& getServer() noexcept;
     AccessControlBase* getAccessControl() noexcept;
 
@@ -49,7 +129,7 @@ private:
     Server& server_;
     std::variant<AccessControlBase*, std::unique_ptr<AccessControlBase>> accessControl_;
     std::vector<UserTokenPolicy> userTokenPolicies_;
-    std::set<NodeId> sessionIds_;
+    std::unordered_map<NodeId, std::unique_ptr<SessionEntry>> sessions_;
 };
 
 }  // namespace opcua
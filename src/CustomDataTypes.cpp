@@ -2,22 +2,38 @@
 
 #include <utility>  // move
 
-#include "open62541pp/TypeWrapper.h"
-
 namespace opcua {
 
 CustomDataTypes::CustomDataTypes(const UA_DataTypeArray** arrayConfig)
     : arrayConfig_(arrayConfig) {}
 
+// compose registries instead of copying the data types, the copies would reference names and
+// member types owned by the previous registry
 void CustomDataTypes::setCustomDataTypes(std::vector<DataType> dataTypes) {
-    dataTypes_ = std::move(dataTypes);
-    // NOLINTNEXTLINE
-    array_ = std::unique_ptr<UA_DataTypeArray>(new UA_DataTypeArray{
-        nullptr,  // next
-        dataTypes_.size(),
-        asNative(dataTypes_.data()),
-    });
-    *arrayConfig_ = array_.get();
+    setRegistry(DataTypeRegistry::compose(
+        std::make_shared<const DataTypeRegistry>(std::move(dataTypes)), registry_
+    ));
+}
+
+void CustomDataTypes::setPassthroughDataTypes(std::vector<DataType> dataTypes) {
+    setRegistry(DataTypeRegistry::compose(
+        registry_,
+        std::make_shared<const DataTypeRegistry>(std::vector<DataType>{}, std::move(dataTypes))
+    ));
+}
+
+void CustomDataTypes::setRegistry(std::shared_ptr<const DataTypeRegistry> registry) {
+    *arrayConfig_ = registry != nullptr ? registry->array() : nullptr;
+    registry_ = std::move(registry);  // release previous registry after the config is updated
+}
+
+const UA_DataType* CustomDataTypes::find(const NodeId& id) const noexcept {
+    if (registry_ != nullptr) {
+        if (const auto* dataType = registry_->find(id); dataType != nullptr) {
+            return dataType;
+        }
+    }
+    return UA_findDataType(id.handle());
 }
 
 }  // namespace opcua
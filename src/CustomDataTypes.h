@@ -4,7 +4,9 @@
 #include <vector>
 
 #include "open62541pp/DataType.h"
+#include "open62541pp/DataTypeRegistry.h"
 #include "open62541pp/open62541.h"
+#include "open62541pp/types/NodeId.h"
 
 namespace opcua {
 
@@ -14,10 +16,22 @@ public:
 
     void setCustomDataTypes(std::vector<DataType> dataTypes);
 
+    /// Set data types that are indexed for lookup, but not passed to the decoder of open62541.
+    void setPassthroughDataTypes(std::vector<DataType> dataTypes);
+
+    /// Attach a shared registry, replaces the custom and passthrough data types.
+    void setRegistry(std::shared_ptr<const DataTypeRegistry> registry);
+
+    const std::shared_ptr<const DataTypeRegistry>& getRegistry() const noexcept {
+        return registry_;
+    }
+
+    /// Find data type by its type id or binary encoding id (custom types first, then builtin).
+    const UA_DataType* find(const NodeId& id) const noexcept;
+
 private:
     const UA_DataTypeArray** arrayConfig_;
-    std::unique_ptr<UA_DataTypeArray> array_;
-    std::vector<DataType> dataTypes_;
+    std::shared_ptr<const DataTypeRegistry> registry_;
 };
 
 }  // namespace opcua
@@ -1,11 +1,24 @@
 #include "CustomLogger.h"
 
+#include <algorithm>  // min, max
+#include <array>
+#include <atomic>  // atomic_load, atomic_store for shared_ptr
 #include <cassert>
+#include <chrono>
+#include <condition_variable>
 #include <cstdarg>  // va_list, va_copy
+#include <cstddef>
+#include <cstdint>
 #include <cstdio>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <utility>  // move
 
+#include "open62541pp/detail/BoundedQueue.h"
+
 namespace opcua {
 
 static std::string printfFormatToString(const char* msg, va_list args) noexcept {
@@ -21,11 +34,143 @@ static std::string printfFormatToString(const char* msg, va_list args) noexcept
     return buffer;
 }
 
+/* --------------------------------------- Async logging ---------------------------------------- */
+
+/**
+ * Background thread draining fixed-size log records from a lock-free ring buffer.
+ * Producers (any thread) format into a thread-local record and copy it into a preallocated slot,
+ * neither requires allocations or locks.
+ */
+class AsyncLogWorker {
+public:
+    AsyncLogWorker(Logger logger, const AsyncLoggerOptions& options)
+        : logger_(std::move(logger)),
+          filter_(options.filter),
+          queue_(std::max<size_t>(options.capacity, 1)),
+          thread_([this] { run(); }) {}
+
+    ~AsyncLogWorker() {
+        {
+            const std::lock_guard lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_one();
+        thread_.join();
+    }
+
+    AsyncLogWorker(const AsyncLogWorker&) = delete;
+    AsyncLogWorker(AsyncLogWorker&&) noexcept = delete;
+    AsyncLogWorker& operator=(const AsyncLogWorker&) = delete;
+    AsyncLogWorker& operator=(AsyncLogWorker&&) noexcept = delete;
+
+    const LogFilter& getFilter() const noexcept {
+        return filter_;
+    }
+
+    void push(LogLevel level, LogCategory category, const char* msg, va_list args) noexcept {
+        thread_local LogRecord record;
+        const int length = std::vsnprintf(  // NOLINT
+            record.message.data(),
+            record.message.size(),
+            msg,
+            args
+        );
+        if (length < 0) {
+            return;
+        }
+        record.level = level;
+        record.category = category;
+        record.length = std::min<size_t>(length, AsyncLoggerOptions::maxMessageLength);
+        if (!queue_.tryPush(record)) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        cv_.notify_one();
+    }
+
+private:
+    struct LogRecord {
+        LogLevel level;
+        LogCategory category;
+        size_t length;
+        std::array<char, AsyncLoggerOptions::maxMessageLength + 1> message;
+    };
+
+    void run() {
+        while (true) {
+            drain();
+            std::unique_lock lock(mutex_);
+            if (stop_) {
+                break;
+            }
+            // notifications are sent without the lock and might be missed, poll as fallback
+            cv_.wait_for(lock, std::chrono::milliseconds(50));
+        }
+        drain();
+    }
+
+    void drain() noexcept {
+        while (auto record = queue_.tryPop()) {
+            invoke(
+                record->level,
+                record->category,
+                std::string_view(record->message.data(), record->length)
+            );
+        }
+        if (const auto dropped = dropped_.exchange(0, std::memory_order_relaxed); dropped > 0) {
+            invoke(
+                LogLevel::Warning,
+                LogCategory::Userland,
+                std::to_string(dropped) + " log messages dropped, the log buffer is full"
+            );
+        }
+    }
+
+    void invoke(LogLevel level, LogCategory category, std::string_view msg) noexcept {
+        try {
+            logger_(level, category, msg);
+        } catch (...) {  // NOLINT(bugprone-empty-catch)
+        }
+    }
+
+    Logger logger_;
+    LogFilter filter_;  // own copy, the worker might be replaced while other threads log
+    detail::BoundedQueue<LogRecord> queue_;  // multiple producers are safe (CAS on push position)
+    std::atomic<size_t> dropped_{0};
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool stop_{false};  // guarded by mutex_
+    std::thread thread_;  // last member, started after the others are initialized
+};
+
+/* ------------------------------------------- Logger ------------------------------------------- */
+
 static void log(
     void* context, UA_LogLevel level, UA_LogCategory category, const char* msg, va_list args
 ) {
     assert(context != nullptr);
-    const auto* instance = static_cast<CustomLogger*>(context);
+    auto* instance = static_cast<CustomLogger*>(context);
+    const auto logLevel = static_cast<LogLevel>(level);
+    const auto logCategory = static_cast<LogCategory>(category);
+
+    if (const auto worker = instance->getAsyncWorker(); worker != nullptr) {
+        // discard before formatting
+        if (worker->getFilter().accepts(logLevel, logCategory)) {
+            worker->push(logLevel, logCategory, msg, args);
+        }
+        return;
+    }
+
+    // discard before formatting
+    if (!instance->getFilter().accepts(logLevel, logCategory)) {
+        return;
+    }
+
+    if (const auto& structuredLogger = instance->getStructuredLogger()) {
+        structuredLogger(LogRecord(logLevel, logCategory, msg, args));
+        return;
+    }
+
     const Logger& logger = instance->getLogger();
 
     // skip if no logger set
@@ -33,33 +178,83 @@ static void log(
         return;
     }
 
-    logger(
-        static_cast<LogLevel>(level),
-        static_cast<LogCategory>(category),
-        printfFormatToString(msg, args)
-    );
+    logger(logLevel, logCategory, printfFormatToString(msg, args));
 }
 
 CustomLogger::CustomLogger(UA_Logger& logger)
     : nativeLogger_(logger) {}
 
-void CustomLogger::setLogger(Logger logger) {
+CustomLogger::~CustomLogger() = default;
+
+void CustomLogger::setLogger(Logger logger, const LogFilter& filter) {
     if (!logger) {
         return;
     }
 
+    install();
+    resetAsyncWorker();
+    logger_ = std::move(logger);
+    structuredLogger_ = nullptr;
+    filter_ = filter;
+}
+
+void CustomLogger::setStructuredLogger(StructuredLogger logger, const LogFilter& filter) {
+    if (!logger) {
+        return;
+    }
+
+    install();
+    resetAsyncWorker();
+    logger_ = nullptr;
+    structuredLogger_ = std::move(logger);
+    filter_ = filter;
+}
+
+void CustomLogger::setAsyncLogger(Logger logger, const AsyncLoggerOptions& options) {
+    if (!logger) {
+        return;
+    }
+
+    install();
+    // swap without a gap, the previous worker is drained and stopped after the swap
+    resetAsyncWorker(std::make_shared<AsyncLogWorker>(logger, options));
+    logger_ = std::move(logger);
+    structuredLogger_ = nullptr;
+    filter_ = options.filter;
+}
+
+const Logger& CustomLogger::getLogger() const noexcept {
+    return logger_;
+}
+
+const LogFilter& CustomLogger::getFilter() const noexcept {
+    return filter_;
+}
+
+const StructuredLogger& CustomLogger::getStructuredLogger() const noexcept {
+    return structuredLogger_;
+}
+
+std::shared_ptr<AsyncLogWorker> CustomLogger::getAsyncWorker() const noexcept {
+    return std::atomic_load(&asyncWorker_);
+}
+
+void CustomLogger::resetAsyncWorker(std::shared_ptr<AsyncLogWorker> worker) noexcept {
+    // the previous worker is stopped by the last thread releasing it (might be in push)
+    std::atomic_store(&asyncWorker_, std::move(worker));
+}
+
+void CustomLogger::install() noexcept {
+    if (nativeLogger_.context == this) {
+        return;
+    }
     if (nativeLogger_.clear != nullptr) {
         nativeLogger_.clear(nativeLogger_.context);
         nativeLogger_.context = nullptr;
     }
-    logger_ = std::move(logger);
     nativeLogger_.log = log;
     nativeLogger_.context = this;
     nativeLogger_.clear = nullptr;
 }
 
-const Logger& CustomLogger::getLogger() const noexcept {
-    return logger_;
-}
-
 }  // namespace opcua
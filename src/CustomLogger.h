@@ -1,21 +1,45 @@
 #pragma once
 
+#include <memory>
+
 #include "open62541pp/Logger.h"
 
 #include "open62541_impl.h"  // UA_Logger
 
 namespace opcua {
 
+class AsyncLogWorker;
+
 class CustomLogger {
 public:
     explicit CustomLogger(UA_Logger& logger);
+    ~CustomLogger();
 
-    void setLogger(Logger logger);
+    CustomLogger(const CustomLogger&) = delete;
+    CustomLogger(CustomLogger&&) noexcept = delete;
+    CustomLogger& operator=(const CustomLogger&) = delete;
+    CustomLogger& operator=(CustomLogger&&) noexcept = delete;
+
+    void setLogger(Logger logger, const LogFilter& filter = {});
+    /// Pass unformatted records to the structured logger, formatting is deferred to the consumer.
+    void setStructuredLogger(StructuredLogger logger, const LogFilter& filter = {});
+    /// Format into thread-local buffers and call the logger from a background thread.
+    void setAsyncLogger(Logger logger, const AsyncLoggerOptions& options);
     const Logger& getLogger() const noexcept;
+    const StructuredLogger& getStructuredLogger() const noexcept;
+    const LogFilter& getFilter() const noexcept;
+    /// Thread-safe, the worker can be replaced while other threads log.
+    std::shared_ptr<AsyncLogWorker> getAsyncWorker() const noexcept;
 
 private:
+    void install() noexcept;
+    void resetAsyncWorker(std::shared_ptr<AsyncLogWorker> worker = {}) noexcept;
+
     UA_Logger& nativeLogger_;
     Logger logger_;
+    StructuredLogger structuredLogger_;
+    LogFilter filter_;
+    std::shared_ptr<AsyncLogWorker> asyncWorker_;  // atomic access with atomic_load/atomic_store
 };
 
 }  // namespace opcua
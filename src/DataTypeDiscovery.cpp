@@ -0,0 +1,752 @@
+#include "open62541pp/DataTypeDiscovery.h"
+
+#include <algorithm>  // max
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <initializer_list>
+#include <iomanip>  // setfill, setw
+#include <iterator>
+#include <optional>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>  // move
+
+#include "open62541pp/Client.h"
+#include "open62541pp/Config.h"
+#include "open62541pp/DataType.h"
+#include "open62541pp/Encoding.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/NamespaceTable.h"
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/RequestView.h"
+#include "open62541pp/TypeWrapper.h"
+#include "open62541pp/detail/helper.h"
+#include "open62541pp/services/Attribute.h"
+#include "open62541pp/services/View.h"
+#include "open62541pp/types/Composed.h"
+
+namespace opcua {
+
+#if UAPP_OPEN62541_VER_GE(1, 3)
+
+/// Data type of abstract data types and data types without own encoding, known to open62541.
+/// Abstract structures are encoded as ExtensionObject (`i=22`), abstract numbers as Variant.
+static const UA_DataType* findBuiltinDataType(const UA_NodeId& id) noexcept {
+    if (const auto* type = UA_findDataType(&id); type != nullptr) {
+        return type;
+    }
+    if (id.namespaceIndex == 0 && id.identifierType == UA_NODEIDTYPE_NUMERIC) {
+        switch (id.identifier.numeric) {
+        case UA_NS0ID_NUMBER:
+        case UA_NS0ID_INTEGER:
+        case UA_NS0ID_UINTEGER:
+            return &UA_TYPES[UA_TYPES_VARIANT];
+        case UA_NS0ID_ENUMERATION:
+            return &UA_TYPES[UA_TYPES_INT32];
+        default:
+            break;
+        }
+    }
+    return nullptr;
+}
+
+static const UA_StructureDefinition* getStructureDefinition(const Variant& definition) noexcept {
+    if (definition.isScalar() && definition.isType(UA_TYPES[UA_TYPES_STRUCTUREDEFINITION])) {
+        return static_cast<const UA_StructureDefinition*>(definition.data());
+    }
+    return nullptr;
+}
+
+static bool isEnumDefinition(const Variant& definition) noexcept {
+    return definition.isScalar() && definition.isType(UA_TYPES[UA_TYPES_ENUMDEFINITION]);
+}
+
+/* ------------------------------------------ Discovery ----------------------------------------- */
+
+static std::vector<NodeId> browseDataTypes(Client& client, uint16_t namespaceIndex) {
+    std::vector<NodeId> ids;
+    std::unordered_set<NodeId> visited;
+    for (const auto rootId : {DataTypeId::Structure, DataTypeId::Enumeration}) {
+        const BrowseDescription bd(
+            rootId,
+            BrowseDirection::Forward,
+            ReferenceTypeId::HasSubtype,
+            true,
+            NodeClass::DataType,
+            BrowseResultMask::None
+        );
+        services::browseRecursive(client, bd, [&](const NodeId&, const ReferenceDescription& ref) {
+            const auto& id = ref.getNodeId();
+            if (id.isLocal() && id.getNodeId().getNamespaceIndex() == namespaceIndex &&
+                visited.insert(id.getNodeId()).second) {
+                ids.push_back(id.getNodeId());
+            }
+        });
+    }
+    return ids;
+}
+
+/// Read attributes of many nodes in a single request.
+/// @return Results grouped by node, in the order of the attribute ids
+static std::vector<DataValue> readAttributes(
+    Client& client, Span<const NodeId> ids, std::initializer_list<AttributeId> attributeIds
+) {
+    ReadRequestView view;
+    view.reserve(ids.size() * attributeIds.size());
+    for (const auto& id : ids) {
+        for (const auto attributeId : attributeIds) {
+            view.add(id, attributeId);
+        }
+    }
+    auto response = services::read(client, view.request());
+    throwIfBad(response.getResponseHeader().getServiceResult());
+    auto results = response.getResults();
+    if (results.size() != view.size()) {
+        throw BadStatus(UA_STATUSCODE_BADUNEXPECTEDERROR);
+    }
+    return {std::make_move_iterator(results.begin()), std::make_move_iterator(results.end())};
+}
+
+static std::optional<NodeId> browseSupertype(Client& client, const NodeId& id) {
+    const auto result = services::browse(
+        client,
+        BrowseDescription(
+            id,
+            BrowseDirection::Inverse,
+            ReferenceTypeId::HasSubtype,
+            false,
+            NodeClass::DataType,
+            BrowseResultMask::None
+        )
+    );
+    for (const auto& ref : result.getReferences()) {
+        if (ref.getNodeId().isLocal()) {
+            return ref.getNodeId().getNodeId();
+        }
+    }
+    return std::nullopt;
+}
+
+/**
+ * Resolve field data types without definition to their builtin supertype.
+ * Concrete structures of other namespaces are not resolved (they are not encoded as
+ * ExtensionObject), the fields keep their data type.
+ */
+static void resolveFieldTypes(Client& client, std::vector<DiscoveredDataType>& dataTypes) {
+    std::unordered_set<NodeId> known;
+    for (const auto& dataType : dataTypes) {
+        known.insert(dataType.typeId);
+    }
+    std::vector<NodeId> unresolved;
+    for (const auto& dataType : dataTypes) {
+        const auto* sd = getStructureDefinition(dataType.definition);
+        for (size_t i = 0; sd != nullptr && i < sd->fieldsSize; ++i) {
+            const auto& fieldType = asWrapper<NodeId>(sd->fields[i].dataType);  // NOLINT
+            if (findBuiltinDataType(*fieldType.handle()) == nullptr &&
+                known.insert(fieldType).second) {
+                unresolved.push_back(fieldType);
+            }
+        }
+    }
+    if (unresolved.empty()) {
+        return;
+    }
+
+    const auto isAbstract = readAttributes(client, unresolved, {AttributeId::IsAbstract});
+    std::unordered_map<NodeId, NodeId> resolved;
+    for (size_t i = 0; i < unresolved.size(); ++i) {
+        std::optional<NodeId> current = unresolved[i];
+        for (size_t depth = 0; current.has_value() && depth < 32; ++depth) {
+            if (const auto* type = findBuiltinDataType(*current->handle()); type != nullptr) {
+                const bool isStructure = type == &UA_TYPES[UA_TYPES_EXTENSIONOBJECT];
+                const auto& abstract = isAbstract[i].getValue();
+                if (!isStructure || (abstract.isType<bool>() && abstract.getScalar<bool>())) {
+                    resolved.try_emplace(unresolved[i], type->typeId);
+                }
+                break;
+            }
+            current = browseSupertype(client, *current);
+        }
+    }
+
+    for (auto& dataType : dataTypes) {
+        if (!dataType.definition.isType(UA_TYPES[UA_TYPES_STRUCTUREDEFINITION])) {
+            continue;
+        }
+        auto* sd = static_cast<UA_StructureDefinition*>(dataType.definition.data());
+        for (size_t i = 0; i < sd->fieldsSize; ++i) {
+            auto& fieldType = asWrapper<NodeId>(sd->fields[i].dataType);  // NOLINT
+            if (const auto it = resolved.find(fieldType); it != resolved.end()) {
+                fieldType = it->second;
+            }
+        }
+    }
+}
+
+std::vector<DiscoveredDataType> readDataTypeDefinitions(
+    Client& client, std::string_view namespaceUri
+) {
+    const auto namespaceIndex = client.getNamespaceIndex(namespaceUri);
+    const auto ids = browseDataTypes(client, namespaceIndex);
+    auto values = readAttributes(
+        client,
+        ids,
+        {AttributeId::DataTypeDefinition, AttributeId::IsAbstract, AttributeId::BrowseName}
+    );
+
+    std::vector<DiscoveredDataType> result;
+    for (size_t i = 0; i < ids.size(); ++i) {
+        auto& definition = values[3 * i].getValue();
+        const auto& isAbstract = values[3 * i + 1].getValue();
+        const auto& browseName = values[3 * i + 2].getValue();
+        if (isAbstract.isType<bool>() && isAbstract.getScalar<bool>()) {
+            continue;
+        }
+        if (getStructureDefinition(definition) == nullptr && !isEnumDefinition(definition)) {
+            continue;  // e.g. subtypes of builtin types without definition
+        }
+        result.push_back({
+            ids[i],
+            browseName.isType<QualifiedName>()
+                ? std::string(browseName.getScalar<QualifiedName>().getName())
+                : std::string{},
+            std::move(definition),
+        });
+    }
+    resolveFieldTypes(client, result);
+    return result;
+}
+
+/* --------------------------------------- Registry builder ------------------------------------- */
+
+/// Registry owning the names referenced by its data types and members.
+class DiscoveredDataTypeRegistry : public DataTypeRegistry {
+public:
+    DiscoveredDataTypeRegistry(std::vector<DataType> dataTypes, std::deque<std::string> names)
+        : DataTypeRegistry(std::move(dataTypes)),
+          names_(std::move(names)) {}
+
+private:
+    std::deque<std::string> names_;  // moved without relocation of the elements
+};
+
+constexpr size_t maxAlignment = std::max({alignof(void*), alignof(UA_Int64), alignof(UA_Double)});
+
+static size_t getAlignment(const UA_DataType& type) noexcept {
+    switch (type.typeKind) {
+    case UA_DATATYPEKIND_BOOLEAN:
+    case UA_DATATYPEKIND_SBYTE:
+    case UA_DATATYPEKIND_BYTE:
+        return 1;
+    case UA_DATATYPEKIND_INT16:
+    case UA_DATATYPEKIND_UINT16:
+        return alignof(UA_Int16);
+    case UA_DATATYPEKIND_INT32:
+    case UA_DATATYPEKIND_UINT32:
+    case UA_DATATYPEKIND_FLOAT:
+    case UA_DATATYPEKIND_STATUSCODE:
+    case UA_DATATYPEKIND_ENUM:
+        return alignof(UA_Int32);
+    default:
+        return maxAlignment;  // 64 bit numbers and types with pointers, over-aligned otherwise
+    }
+}
+
+static constexpr size_t alignUp(size_t offset, size_t alignment) noexcept {
+    return (offset + alignment - 1) / alignment * alignment;
+}
+
+/**
+ * Create data types from definitions.
+ * The memory layout of each definition is computed first, by-value dependencies recursively.
+ * The data types are created afterwards with members referencing the final data types.
+ */
+class DataTypeRegistryBuilder {
+public:
+    explicit DataTypeRegistryBuilder(Span<const DiscoveredDataType> definitions)
+        : definitions_(definitions),
+          states_(definitions.size(), State::Pending),
+          layouts_(definitions.size()) {
+        for (size_t i = 0; i < definitions.size(); ++i) {
+            index_.try_emplace(definitions[i].typeId, i);
+        }
+    }
+
+    std::shared_ptr<const DataTypeRegistry> build() {
+        for (size_t i = 0; i < definitions_.size(); ++i) {
+            computeLayout(i);
+        }
+        invalidateDependents();
+
+        std::vector<size_t> positions(definitions_.size(), npos);
+        std::vector<DataType> dataTypes;
+        dataTypes.reserve(definitions_.size());
+        for (size_t i = 0; i < definitions_.size(); ++i) {
+            if (states_[i] == State::Done) {
+                positions[i] = dataTypes.size();
+                dataTypes.push_back(createDataType(i));
+            }
+        }
+        // members reference the data types in the final vector (not relocated by the move)
+        for (size_t i = 0; i < definitions_.size(); ++i) {
+            if (states_[i] == State::Done) {
+                dataTypes[positions[i]].setMembers(createMembers(i, dataTypes, positions));
+            }
+        }
+        return std::make_shared<const DiscoveredDataTypeRegistry>(
+            std::move(dataTypes), std::move(names_)
+        );
+    }
+
+private:
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    enum class State { Pending, Visiting, Done, Failed };
+
+    struct Field {
+        const UA_NodeId* dataType;
+        uint8_t padding;
+        bool isArray;
+        bool isOptional;
+    };
+
+    struct Layout {
+        size_t memSize{};
+        size_t alignment{1};
+        bool pointerFree{true};
+        uint8_t typeKind{};
+        std::vector<Field> fields;
+    };
+
+    struct MemberLayout {
+        size_t memSize;
+        size_t alignment;
+        bool pointerFree;
+    };
+
+    std::optional<size_t> findIndex(const UA_NodeId& id) const {
+        if (const auto it = index_.find(asWrapper<NodeId>(id)); it != index_.end()) {
+            return it->second;
+        }
+        return std::nullopt;
+    }
+
+    std::optional<MemberLayout> getMemberLayout(const UA_NodeId& id) {
+        if (const auto index = findIndex(id)) {
+            if (!computeLayout(*index)) {
+                return std::nullopt;
+            }
+            const auto& layout = layouts_[*index];
+            return MemberLayout{layout.memSize, layout.alignment, layout.pointerFree};
+        }
+        if (const auto* type = findBuiltinDataType(id)) {
+            return MemberLayout{type->memSize, getAlignment(*type), type->pointerFree};
+        }
+        return std::nullopt;
+    }
+
+    bool computeLayout(size_t index) {
+        if (states_[index] == State::Done) {
+            return true;
+        }
+        if (states_[index] != State::Pending) {
+            return false;  // failed or by-value cycle
+        }
+        states_[index] = State::Visiting;
+        auto layout = computeDefinitionLayout(definitions_[index].definition);
+        if (layout.has_value() && layout->memSize <= UINT16_MAX) {
+            layouts_[index] = std::move(*layout);
+            states_[index] = State::Done;
+            return true;
+        }
+        states_[index] = State::Failed;
+        return false;
+    }
+
+    std::optional<Layout> computeDefinitionLayout(const Variant& definition) {
+        if (isEnumDefinition(definition)) {
+            Layout layout;
+            layout.memSize = sizeof(UA_Int32);
+            layout.alignment = alignof(UA_Int32);
+            layout.typeKind = UA_DATATYPEKIND_ENUM;
+            return layout;
+        }
+        const auto* sd = getStructureDefinition(definition);
+        if (sd == nullptr || sd->fieldsSize >= (1U << 8U)) {
+            return std::nullopt;
+        }
+        Layout layout;
+        switch (sd->structureType) {
+        case UA_STRUCTURETYPE_STRUCTURE:
+            layout.typeKind = UA_DATATYPEKIND_STRUCTURE;
+            break;
+        case UA_STRUCTURETYPE_STRUCTUREWITHOPTIONALFIELDS:
+            layout.typeKind = UA_DATATYPEKIND_OPTSTRUCT;
+            break;
+        case UA_STRUCTURETYPE_UNION:
+            layout.typeKind = UA_DATATYPEKIND_UNION;
+            break;
+        default:
+            return std::nullopt;  // subtyped values are not supported by open62541
+        }
+        const bool isUnion = layout.typeKind == UA_DATATYPEKIND_UNION;
+        // union: switch field followed by the fields at the same offset
+        size_t offset = isUnion ? sizeof(UA_UInt32) : 0;
+        size_t unionSize = 0;
+        layout.alignment = isUnion ? alignof(UA_UInt32) : 1;
+        std::vector<size_t> offsets;
+        for (size_t i = 0; i < sd->fieldsSize; ++i) {
+            const auto& field = sd->fields[i];  // NOLINT
+            if (field.valueRank != UA_VALUERANK_SCALAR &&
+                field.valueRank != UA_VALUERANK_ONE_DIMENSION &&
+                field.valueRank != UA_VALUERANK_ONE_OR_MORE_DIMENSIONS) {
+                return std::nullopt;  // multi-dimensional arrays are not supported by open62541
+            }
+            const bool isArray = field.valueRank != UA_VALUERANK_SCALAR;
+            const bool isOptional = layout.typeKind == UA_DATATYPEKIND_OPTSTRUCT &&
+                                    field.isOptional;
+            size_t size = sizeof(void*);
+            size_t alignment = alignof(void*);
+            if (isArray || isOptional) {
+                // referenced by pointer, the layout of the member type is not required
+                if (!findIndex(field.dataType) && findBuiltinDataType(field.dataType) == nullptr) {
+                    return std::nullopt;
+                }
+                if (isArray) {
+                    size = sizeof(size_t) + sizeof(void*);
+                    alignment = std::max(alignof(size_t), alignof(void*));
+                }
+                layout.pointerFree = false;
+            } else {
+                const auto member = getMemberLayout(field.dataType);
+                if (!member.has_value()) {
+                    return std::nullopt;
+                }
+                size = member->memSize;
+                alignment = member->alignment;
+                layout.pointerFree = layout.pointerFree && member->pointerFree;
+            }
+            layout.alignment = std::max(layout.alignment, alignment);
+            if (isUnion) {
+                unionSize = std::max(unionSize, size);
+                offsets.push_back(0);
+            } else {
+                const size_t aligned = alignUp(offset, alignment);
+                offsets.push_back(aligned - offset);
+                offset = aligned + size;
+            }
+            layout.fields.push_back({&field.dataType, 0, isArray, isOptional});
+        }
+        if (isUnion) {
+            // padding of union fields is the offset from the start of the union type
+            offset = alignUp(offset, layout.alignment);
+            std::fill(offsets.begin(), offsets.end(), offset);
+            offset += unionSize;
+        }
+        for (size_t i = 0; i < offsets.size(); ++i) {
+            layout.fields[i].padding = static_cast<uint8_t>(offsets[i]);
+        }
+        layout.memSize = alignUp(offset, layout.alignment);
+        return layout;
+    }
+
+    /// Invalidate definitions with members of failed definitions (by value, array or pointer).
+    void invalidateDependents() {
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (size_t i = 0; i < definitions_.size(); ++i) {
+                if (states_[i] != State::Done) {
+                    continue;
+                }
+                for (const auto& field : layouts_[i].fields) {
+                    const auto index = findIndex(*field.dataType);
+                    if (index.has_value() && states_[*index] != State::Done) {
+                        states_[i] = State::Failed;
+                        changed = true;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    const char* storeName(std::string name) {
+        return names_.emplace_back(std::move(name)).c_str();
+    }
+
+    DataType createDataType(size_t index) {
+        const auto& definition = definitions_[index];
+        const auto& layout = layouts_[index];
+        DataType dataType;
+        dataType.setTypeName(storeName(definition.name));
+        dataType.setTypeId(definition.typeId);
+        if (const auto* sd = getStructureDefinition(definition.definition)) {
+            dataType.setBinaryEncodingId(NodeId(sd->defaultEncodingId));
+        }
+        dataType.setMemSize(static_cast<uint16_t>(layout.memSize));
+        dataType.setTypeKind(layout.typeKind);
+        dataType.setPointerFree(layout.pointerFree);
+        dataType.setOverlayable(false);
+        return dataType;
+    }
+
+    std::vector<DataTypeMember> createMembers(
+        size_t index, const std::vector<DataType>& dataTypes, const std::vector<size_t>& positions
+    ) {
+        const auto* sd = getStructureDefinition(definitions_[index].definition);
+        std::vector<DataTypeMember> members;
+        for (size_t i = 0; i < layouts_[index].fields.size(); ++i) {
+            const auto& field = layouts_[index].fields[i];
+            const auto memberIndex = findIndex(*field.dataType);
+            const UA_DataType& memberType = memberIndex.has_value()
+                                                ? *asNative(&dataTypes[positions[*memberIndex]])
+                                                : *findBuiltinDataType(*field.dataType);
+            members.push_back(detail::createDataTypeMember(
+                storeName(detail::toString(sd->fields[i].name)),  // NOLINT
+                memberType,
+                field.padding,
+                field.isArray,
+                field.isOptional
+            ));
+        }
+        return members;
+    }
+
+    Span<const DiscoveredDataType> definitions_;
+    std::unordered_map<NodeId, size_t> index_;
+    std::vector<State> states_;
+    std::vector<Layout> layouts_;
+    std::deque<std::string> names_;
+};
+
+std::shared_ptr<const DataTypeRegistry> createDataTypeRegistry(
+    Span<const DiscoveredDataType> dataTypes
+) {
+    return DataTypeRegistryBuilder(dataTypes).build();
+}
+
+/* -------------------------------------------- Cache ------------------------------------------- */
+
+// file format: magic number, namespace uri, version, namespace array, data types
+constexpr uint32_t cacheMagic = 0x55414454;  // "UADT"
+
+/// Read the NamespaceVersion property of the namespace metadata object.
+/// @return The version or an empty string if not available
+static std::string readNamespaceVersion(Client& client, std::string_view namespaceUri) {
+    const auto readProperty = [&](const NodeId& id, std::string_view name) -> std::string {
+        const QualifiedName path[]{QualifiedName(0, name)};
+        const auto result = services::browseSimplifiedBrowsePath(client, id, path);
+        if (!result.getStatusCode().isGood() || result.getTargets().empty()) {
+            return {};
+        }
+        const auto value = services::readValue(
+            client, result.getTargets()[0].getTargetId().getNodeId()
+        );
+        return value.isType<String>() ? value.getScalarCopy<std::string>() : std::string{};
+    };
+    try {
+        const auto children = services::browseAll(
+            client,
+            BrowseDescription(
+                ObjectId::Server_Namespaces,
+                BrowseDirection::Forward,
+                ReferenceTypeId::HierarchicalReferences,
+                true,
+                NodeClass::Object,
+                BrowseResultMask::None
+            )
+        );
+        for (const auto& child : children) {
+            const auto& id = child.getNodeId().getNodeId();
+            if (readProperty(id, "NamespaceUri") == namespaceUri) {
+                return readProperty(id, "NamespaceVersion");
+            }
+        }
+    } catch (const BadStatus&) {
+        // namespace metadata not available
+    }
+    return {};
+}
+
+static std::string getCachePath(
+    std::string_view directory, std::string_view namespaceUri, std::string_view version
+) {
+    // FNV-1a hash, stable across processes and platforms
+    uint64_t hash = 14695981039346656037ULL;
+    const auto update = [&](std::string_view str) {
+        for (const char c : str) {
+            hash = (hash ^ static_cast<uint8_t>(c)) * 1099511628211ULL;
+        }
+    };
+    update(namespaceUri);
+    update("\n");
+    update(version);
+    std::ostringstream ss;
+    ss << directory << "/datatypes-" << std::hex << std::setw(16) << std::setfill('0') << hash
+       << ".bin";
+    return ss.str();
+}
+
+static void saveCache(
+    const std::string& path,
+    std::string_view namespaceUri,
+    std::string_view version,
+    const std::vector<std::string>& namespaceArray,
+    Span<const DiscoveredDataType> dataTypes
+) {
+    BatchEncoder encoder;
+    encoder.append(cacheMagic);
+    encoder.append(String(namespaceUri));
+    encoder.append(String(version));
+    encoder.append(Variant::fromArray(namespaceArray));
+    encoder.append(static_cast<uint32_t>(dataTypes.size()));
+    for (const auto& dataType : dataTypes) {
+        encoder.append(dataType.typeId);
+        encoder.append(String(dataType.name));
+        encoder.append(dataType.definition);
+    }
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    const auto data = encoder.data();
+    file.write(
+        reinterpret_cast<const char*>(data.data()),  // NOLINT
+        static_cast<std::streamsize>(data.size())
+    );
+    if (!file) {
+        throw BadStatus(UA_STATUSCODE_BADINTERNALERROR);
+    }
+}
+
+/// Map the namespace indexes of the cached node ids to the current namespace array.
+static bool remapNamespaces(
+    DiscoveredDataType& dataType,
+    const std::vector<std::string>& cachedNamespaces,
+    const NamespaceTable& namespaces
+) {
+    const auto remap = [&](UA_NodeId& id) {
+        if (id.namespaceIndex >= cachedNamespaces.size()) {
+            return false;
+        }
+        const auto index = namespaces.find(cachedNamespaces[id.namespaceIndex]);
+        if (!index.has_value()) {
+            return false;
+        }
+        id.namespaceIndex = *index;
+        return true;
+    };
+    bool valid = remap(*dataType.typeId.handle());
+    if (dataType.definition.isType(UA_TYPES[UA_TYPES_STRUCTUREDEFINITION])) {
+        auto* sd = static_cast<UA_StructureDefinition*>(dataType.definition.data());
+        valid = valid && remap(sd->defaultEncodingId) && remap(sd->baseDataType);
+        for (size_t i = 0; valid && i < sd->fieldsSize; ++i) {
+            valid = remap(sd->fields[i].dataType);  // NOLINT
+        }
+    }
+    return valid;
+}
+
+static std::optional<std::vector<DiscoveredDataType>> loadCache(
+    const std::string& path,
+    std::string_view namespaceUri,
+    std::string_view version,
+    const NamespaceTable& namespaces
+) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return std::nullopt;
+    }
+    const std::vector<uint8_t> data(
+        (std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>()
+    );
+    try {
+        BinaryDecoder decoder;
+        decoder.append(data);
+        const auto magic = decoder.next<uint32_t>();
+        const auto cachedUri = decoder.next<String>();
+        const auto cachedVersion = decoder.next<String>();
+        const auto cachedNamespaces = decoder.next<Variant>();
+        const auto count = decoder.next<uint32_t>();
+        if (!magic || *magic != cacheMagic || !cachedUri || cachedUri->get() != namespaceUri ||
+            !cachedVersion || cachedVersion->get() != version || !cachedNamespaces || !count) {
+            return std::nullopt;
+        }
+        const auto namespaceArray = cachedNamespaces->getArrayCopy<std::string>();
+        std::vector<DiscoveredDataType> result;
+        result.reserve(*count);
+        for (uint32_t i = 0; i < *count; ++i) {
+            auto typeId = decoder.next<NodeId>();
+            auto name = decoder.next<String>();
+            auto definition = decoder.next<Variant>();
+            if (!typeId || !name || !definition) {
+                return std::nullopt;
+            }
+            auto& dataType = result.emplace_back(DiscoveredDataType{
+                std::move(*typeId), std::string(name->get()), std::move(*definition)
+            });
+            if (!remapNamespaces(dataType, namespaceArray, namespaces)) {
+                return std::nullopt;
+            }
+        }
+        return result;
+    } catch (const std::exception&) {
+        return std::nullopt;
+    }
+}
+
+std::shared_ptr<const DataTypeRegistry> discoverDataTypes(
+    Client& client, Span<const std::string> namespaceUris, const DataTypeDiscoveryOptions& options
+) {
+    const bool useCache = !options.cacheDirectory.empty();
+    std::vector<DiscoveredDataType> dataTypes;
+    for (const auto& uri : namespaceUris) {
+        const auto version = useCache ? readNamespaceVersion(client, uri) : std::string{};
+        const auto path = getCachePath(options.cacheDirectory, uri, version);
+        std::optional<std::vector<DiscoveredDataType>> discovered;
+        if (useCache && !version.empty()) {
+            discovered = loadCache(path, uri, version, client.getNamespaceTable());
+        }
+        if (!discovered.has_value()) {
+            discovered = readDataTypeDefinitions(client, uri);
+            if (useCache && !version.empty()) {
+                try {
+                    saveCache(path, uri, version, client.getNamespaceArray(), *discovered);
+                } catch (const std::exception&) {  // NOLINT(*-empty-catch)
+                    // discovered again next time
+                }
+            }
+        }
+        std::move(discovered->begin(), discovered->end(), std::back_inserter(dataTypes));
+    }
+    return createDataTypeRegistry(dataTypes);
+}
+
+#else
+
+std::vector<DiscoveredDataType> readDataTypeDefinitions(
+    [[maybe_unused]] Client& client, [[maybe_unused]] std::string_view namespaceUri
+) {
+    throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+}
+
+std::shared_ptr<const DataTypeRegistry> createDataTypeRegistry(
+    [[maybe_unused]] Span<const DiscoveredDataType> dataTypes
+) {
+    throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+}
+
+std::shared_ptr<const DataTypeRegistry> discoverDataTypes(
+    [[maybe_unused]] Client& client,
+    [[maybe_unused]] Span<const std::string> namespaceUris,
+    [[maybe_unused]] const DataTypeDiscoveryOptions& options
+) {
+    throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+}
+
+#endif
+
+}  // namespace opcua
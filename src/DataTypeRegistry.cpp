@@ -0,0 +1,83 @@
+#include "open62541pp/DataTypeRegistry.h"
+
+#include <utility>  // move
+
+#include "open62541pp/TypeWrapper.h"
+
+namespace opcua {
+
+DataTypeRegistry::DataTypeRegistry(
+    std::vector<DataType> dataTypes, std::vector<DataType> passthroughDataTypes
+)
+    : dataTypes_(std::move(dataTypes)),
+      passthroughDataTypes_(std::move(passthroughDataTypes)),
+      dataTypesView_(dataTypes_),
+      passthroughView_(passthroughDataTypes_),
+      array_{
+          nullptr,  // next
+          dataTypesView_.size(),
+          asNative(dataTypesView_.data()),
+      } {
+    buildIndex();
+}
+
+DataTypeRegistry::DataTypeRegistry(
+    ComposeTag,
+    std::shared_ptr<const DataTypeRegistry> dataTypesSource,
+    std::shared_ptr<const DataTypeRegistry> passthroughSource
+)
+    : dataTypesView_(
+          dataTypesSource != nullptr ? dataTypesSource->getDataTypes() : Span<const DataType>{}
+      ),
+      passthroughView_(
+          passthroughSource != nullptr ? passthroughSource->getPassthroughDataTypes()
+                                       : Span<const DataType>{}
+      ),
+      array_{
+          nullptr,  // next
+          dataTypesView_.size(),
+          asNative(dataTypesView_.data()),
+      } {
+    // keep only the owners of the data types alive, composing repeatedly does not chain registries
+    if (dataTypesSource != nullptr) {
+        dataTypesOwner_ = dataTypesSource->dataTypesOwner_ != nullptr
+            ? dataTypesSource->dataTypesOwner_
+            : std::move(dataTypesSource);
+    }
+    if (passthroughSource != nullptr) {
+        passthroughOwner_ = passthroughSource->passthroughOwner_ != nullptr
+            ? passthroughSource->passthroughOwner_
+            : std::move(passthroughSource);
+    }
+    buildIndex();
+}
+
+std::shared_ptr<const DataTypeRegistry> DataTypeRegistry::compose(
+    std::shared_ptr<const DataTypeRegistry> dataTypesSource,
+    std::shared_ptr<const DataTypeRegistry> passthroughSource
+) {
+    return std::make_shared<const DataTypeRegistry>(
+        ComposeTag{}, std::move(dataTypesSource), std::move(passthroughSource)
+    );
+}
+
+void DataTypeRegistry::buildIndex() {
+    // build index once, lookups during decoding are in constant time
+    index_.reserve(2 * (dataTypesView_.size() + passthroughView_.size()));
+    for (const auto types : {dataTypesView_, passthroughView_}) {
+        for (const auto& dataType : types) {
+            const UA_DataType* native = asNative(&dataType);
+            index_.try_emplace(dataType.getTypeId(), native);
+            index_.try_emplace(dataType.getBinaryEncodingId(), native);
+        }
+    }
+}
+
+const UA_DataType* DataTypeRegistry::find(const NodeId& id) const noexcept {
+    if (const auto it = index_.find(id); it != index_.end()) {
+        return it->second;
+    }
+    return nullptr;
+}
+
+}  // namespace opcua
@@ -0,0 +1,150 @@
+#include "open62541pp/DeadbandWriter.h"
+
+#include <cmath>  // abs
+#include <cstdint>
+
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/open62541.h"
+#include "open62541pp/services/Attribute.h"
+#include "open62541pp/services/View.h"
+
+namespace opcua {
+
+template <typename T>
+static bool toNumber(const UA_Variant& var, const UA_DataType& type, double& number) noexcept {
+    if (var.type != &type) {
+        return false;
+    }
+    number = static_cast<double>(*static_cast<const T*>(var.data));
+    return true;
+}
+
+static std::optional<double> toNumber(const Variant& value) noexcept {
+    const UA_Variant& var = *value.handle();
+    if (var.type == nullptr || var.data == nullptr || !value.isScalar()) {
+        return std::nullopt;
+    }
+    double number = 0.0;
+    // clang-format off
+    const bool numeric =
+        toNumber<UA_Double>(var, UA_TYPES[UA_TYPES_DOUBLE], number) ||
+        toNumber<UA_Float>(var, UA_TYPES[UA_TYPES_FLOAT], number) ||
+        toNumber<UA_Int32>(var, UA_TYPES[UA_TYPES_INT32], number) ||
+        toNumber<UA_UInt32>(var, UA_TYPES[UA_TYPES_UINT32], number) ||
+        toNumber<UA_Int16>(var, UA_TYPES[UA_TYPES_INT16], number) ||
+        toNumber<UA_UInt16>(var, UA_TYPES[UA_TYPES_UINT16], number) ||
+        toNumber<UA_Int64>(var, UA_TYPES[UA_TYPES_INT64], number) ||
+        toNumber<UA_UInt64>(var, UA_TYPES[UA_TYPES_UINT64], number) ||
+        toNumber<UA_SByte>(var, UA_TYPES[UA_TYPES_SBYTE], number) ||
+        toNumber<UA_Byte>(var, UA_TYPES[UA_TYPES_BYTE], number) ||
+        toNumber<UA_Boolean>(var, UA_TYPES[UA_TYPES_BOOLEAN], number);
+    // clang-format on
+    return numeric ? std::optional(number) : std::nullopt;
+}
+
+static double readEURange(Server& server, const NodeId& id) {
+    const auto result = services::browseSimplifiedBrowsePath(server, id, {{0, "EURange"}});
+    for (const auto& target : result.getTargets()) {
+        if (!target.getTargetId().isLocal()) {
+            continue;
+        }
+        const auto value = services::readValue(server, target.getTargetId().getNodeId());
+        if (value.isScalar() && value.isType(UA_TYPES[UA_TYPES_RANGE])) {
+            const auto* range = static_cast<const UA_Range*>(value.data());
+            return range->high - range->low;
+        }
+    }
+    throw BadStatus(UA_STATUSCODE_BADDEADBANDFILTERINVALID);
+}
+
+void DeadbandWriter::setDeadband(
+    const NodeId& id, DeadbandType type, double deadband, std::optional<double> range
+) {
+    double threshold = deadband;
+    if (type == DeadbandType::Percent) {
+        threshold = deadband / 100.0 * (range.has_value() ? *range : readEURange(server_, id));
+    } else if (type == DeadbandType::None) {
+        threshold = 0.0;
+    }
+    filters_[id] = {type, std::abs(threshold), std::nullopt};
+}
+
+void DeadbandWriter::removeDeadband(const NodeId& id) noexcept {
+    filters_.erase(id);
+}
+
+bool DeadbandWriter::accept(
+    const NodeId& id, const Variant& value, Filter*& filter, double& number
+) {
+    filter = nullptr;
+    if (filters_.empty()) {
+        return true;
+    }
+    const auto it = filters_.find(id);
+    if (it == filters_.end()) {
+        return true;
+    }
+    const auto numeric = toNumber(value);
+    if (!numeric.has_value()) {
+        return true;  // not filtered
+    }
+    filter = &it->second;
+    number = *numeric;
+    if (!filter->last.has_value()) {
+        return true;
+    }
+    const double delta = std::abs(number - *filter->last);
+    const bool within = filter->type == DeadbandType::None ? delta == 0.0
+                                                           : delta <= filter->threshold;
+    if (within) {
+        ++dropped_;
+        return false;
+    }
+    return true;
+}
+
+StatusCode DeadbandWriter::write(const NodeId& id, const Variant& value) {
+    UA_WriteValue item{};
+    item.nodeId = *id.handle();  // shallow copy
+    item.attributeId = UA_ATTRIBUTEID_VALUE;
+    item.value.value = *value.handle();  // shallow copy
+    item.value.hasValue = true;
+    return UA_Server_write(server_.handle(), &item);
+}
+
+bool DeadbandWriter::writeValue(const NodeId& id, const Variant& value) {
+    Filter* filter = nullptr;
+    double number = 0.0;
+    if (!accept(id, value, filter, number)) {
+        return false;
+    }
+    throwIfBad(write(id, value));
+    if (filter != nullptr) {
+        filter->last = number;
+    }
+    return true;
+}
+
+size_t DeadbandWriter::writeValues(Span<const NodeId> ids, Span<const Variant> values) {
+    if (ids.size() != values.size()) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+    }
+    size_t written = 0;
+    for (size_t i = 0; i < ids.size(); ++i) {
+        Filter* filter = nullptr;
+        double number = 0.0;
+        if (!accept(ids[i], values[i], filter, number)) {
+            continue;
+        }
+        if (write(ids[i], values[i]).isGood()) {
+            ++written;
+            if (filter != nullptr) {
+                filter->last = number;
+            }
+        }
+    }
+    return written;
+}
+
+}  // namespace opcua
@@ -0,0 +1,168 @@
+#include "open62541pp/DeltaArray.h"
+
+#include <cstring>  // memcmp, memcpy
+#include <vector>
+
+#include "open62541pp/DataTypeBuilder.h"
+#include "open62541pp/ErrorHandling.h"
+
+namespace opcua {
+
+DataType createDeltaArrayFrameDataType(NodeId typeId, NodeId binaryEncodingId) {
+    return DataTypeBuilder<DeltaArrayFrame>::createStructure(
+               "DeltaArrayFrame", std::move(typeId), std::move(binaryEncodingId)
+    )
+        .addField<&DeltaArrayFrame::sequenceNumber>("sequenceNumber")
+        .addField<&DeltaArrayFrame::keyframe>("keyframe")
+        .addField<&DeltaArrayFrame::arrayLength>("arrayLength")
+        .addField<&DeltaArrayFrame::rangesSize, &DeltaArrayFrame::ranges>("ranges")
+        .addField<&DeltaArrayFrame::values>("values")
+        .build();
+}
+
+static const uint8_t* elementAt(const Variant& var, size_t index, size_t elementSize) noexcept {
+    return static_cast<const uint8_t*>(var.data()) + index * elementSize;
+}
+
+/// Find the changed index ranges as pairs of first index and count.
+static size_t findChangedRanges(
+    const Variant& array,
+    const Variant& last,
+    size_t elementSize,
+    uint32_t mergeGap,
+    std::vector<uint32_t>& ranges
+) {
+    const size_t length = array.getArrayLength();
+    const auto differs = [&](size_t i) {
+        return std::memcmp(
+                   elementAt(array, i, elementSize), elementAt(last, i, elementSize), elementSize
+               ) != 0;
+    };
+    size_t changed = 0;
+    for (size_t i = 0; i < length;) {
+        if (!differs(i)) {
+            ++i;
+            continue;
+        }
+        size_t end = i + 1;
+        for (size_t j = end, unchanged = 0; j < length && unchanged <= mergeGap; ++j) {
+            if (differs(j)) {
+                end = j + 1;
+                unchanged = 0;
+            } else {
+                ++unchanged;
+            }
+        }
+        ranges.push_back(static_cast<uint32_t>(i));
+        ranges.push_back(static_cast<uint32_t>(end - i));
+        changed += end - i;
+        i = end;
+    }
+    return changed;
+}
+
+Variant DeltaArrayEncoder::encode(const Variant& array) {
+    const UA_DataType* type = array.getDataType();
+    if (!array.isArray() || type == nullptr || !type->pointerFree) {
+        throw BadStatus(UA_STATUSCODE_BADTYPEMISMATCH);
+    }
+    const size_t length = array.getArrayLength();
+    const size_t elementSize = type->memSize;
+
+    bool keyframe = forceKeyframe_ || framesSinceKeyframe_ >= options_.keyframeInterval ||
+                    !last_.isType(type) || last_.getArrayLength() != length;
+    std::vector<uint32_t> ranges;
+    size_t changed = 0;
+    if (!keyframe) {
+        changed = findChangedRanges(array, last_, elementSize, options_.mergeGap, ranges);
+        keyframe = static_cast<double>(changed) > options_.maxDeltaRatio * length;
+    }
+
+    Variant result;
+    auto* frame = static_cast<DeltaArrayFrame*>(UA_new(frameType_));
+    if (frame == nullptr) {
+        throw BadStatus(UA_STATUSCODE_BADOUTOFMEMORY);
+    }
+    UA_Variant_setScalar(result.handle(), frame, frameType_);  // take ownership
+    frame->sequenceNumber = sequenceNumber_++;
+    frame->keyframe = keyframe;
+    frame->arrayLength = static_cast<uint32_t>(length);
+    if (keyframe) {
+        throwIfBad(UA_Variant_copy(array.handle(), &frame->values));
+        framesSinceKeyframe_ = 0;
+        forceKeyframe_ = false;
+    } else {
+        frame->ranges = static_cast<uint32_t*>(
+            UA_Array_new(ranges.size(), &UA_TYPES[UA_TYPES_UINT32])
+        );
+        frame->rangesSize = frame->ranges == nullptr ? 0 : ranges.size();
+        auto* values = static_cast<uint8_t*>(UA_Array_new(changed, type));
+        if (frame->ranges == nullptr || values == nullptr) {
+            UA_Array_delete(values, changed, type);
+            throw BadStatus(UA_STATUSCODE_BADOUTOFMEMORY);
+        }
+        std::memcpy(frame->ranges, ranges.data(), ranges.size() * sizeof(uint32_t));
+        UA_Variant_setArray(&frame->values, values, changed, type);
+        for (size_t i = 0; i < ranges.size(); i += 2) {
+            const size_t bytes = ranges[i + 1] * elementSize;
+            if (bytes > 0) {
+                std::memcpy(values, elementAt(array, ranges[i], elementSize), bytes);
+                values += bytes;
+            }
+        }
+        ++framesSinceKeyframe_;
+    }
+    last_ = array;
+    return result;
+}
+
+bool DeltaArrayDecoder::decode(const Variant& frameVariant) {
+    if (!frameVariant.isScalar() || !frameVariant.isType(frameTypeId_)) {
+        throw BadStatus(UA_STATUSCODE_BADTYPEMISMATCH);
+    }
+    const auto& frame = *static_cast<const DeltaArrayFrame*>(frameVariant.data());
+    const bool inSequence = valid_ && frame.sequenceNumber == nextSequenceNumber_;
+    nextSequenceNumber_ = frame.sequenceNumber + 1;
+    if (frame.keyframe) {
+        // deltas are copied bytewise into the array, owned pointers would be overwritten
+        if (frame.values.type == nullptr || !frame.values.type->pointerFree) {
+            valid_ = false;
+            throw BadStatus(UA_STATUSCODE_BADTYPEMISMATCH);
+        }
+        array_ = *asWrapper<Variant>(&frame.values);
+        valid_ = array_.getArrayLength() == frame.arrayLength;
+        return valid_;
+    }
+    if (!inSequence) {
+        valid_ = false;
+        return false;
+    }
+
+    const auto& values = *asWrapper<Variant>(&frame.values);
+    const UA_DataType* type = array_.getDataType();
+    if (frame.rangesSize % 2 != 0 || !values.isType(type) ||
+        array_.getArrayLength() != frame.arrayLength) {
+        valid_ = false;
+        return false;
+    }
+    const size_t elementSize = type->memSize;
+    auto* dst = static_cast<uint8_t*>(array_.data());
+    const auto* src = static_cast<const uint8_t*>(values.data());
+    size_t consumed = 0;
+    for (size_t i = 0; i < frame.rangesSize; i += 2) {
+        const size_t first = frame.ranges[i];  // NOLINT
+        const size_t count = frame.ranges[i + 1];  // NOLINT
+        if (first + count > frame.arrayLength || consumed + count > values.getArrayLength()) {
+            valid_ = false;
+            return false;
+        }
+        if (count > 0) {
+            const size_t bytes = count * elementSize;
+            std::memcpy(dst + first * elementSize, src + consumed * elementSize, bytes);
+        }
+        consumed += count;
+    }
+    return true;
+}
+
+}  // namespace opcua
@@ -0,0 +1,148 @@
+#include "open62541pp/Encoding.h"
+
+#include <algorithm>  // max
+#include <cstddef>  // ptrdiff_t
+#include <cstring>  // memcpy
+
+#include "open62541pp/Config.h"
+#include "open62541pp/ErrorHandling.h"
+
+namespace opcua {
+
+namespace detail {
+
+#if UAPP_OPEN62541_VER_GE(1, 3)
+static UA_ByteString asByteString(const uint8_t* data, size_t length) noexcept {
+    UA_ByteString result{};
+    result.length = length;
+    result.data = const_cast<uint8_t*>(data);  // NOLINT, not modified
+    return result;
+}
+
+static UA_StatusCode decodeBinaryImpl(
+    Span<const uint8_t> data, size_t& offset, void* dst, const UA_DataType& type
+) noexcept {
+#if UAPP_OPEN62541_VER_GE(1, 4)
+    const UA_ByteString remaining =
+        asByteString(data.data() + offset, data.size() - offset);  // NOLINT
+    const auto status = UA_decodeBinary(&remaining, dst, &type, nullptr);
+    if (status == UA_STATUSCODE_GOOD) {
+        offset += UA_calcSizeBinary(dst, &type);
+    }
+    return status;
+#else
+    const UA_ByteString input = asByteString(data.data(), data.size());
+    return UA_decodeBinary(&input, &offset, dst, &type, nullptr);
+#endif
+}
+#endif
+
+ByteString encodeBinary(
+    [[maybe_unused]] const void* src, [[maybe_unused]] const UA_DataType& type
+) {
+#if UAPP_OPEN62541_VER_GE(1, 3)
+    ByteString result;
+    throwIfBad(UA_encodeBinary(src, &type, result.handle()));
+    return result;
+#else
+    throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+#endif
+}
+
+Span<uint8_t> encodeBinary(
+    [[maybe_unused]] const void* src,
+    [[maybe_unused]] const UA_DataType& type,
+    [[maybe_unused]] Span<uint8_t> buffer
+) {
+#if UAPP_OPEN62541_VER_GE(1, 3)
+    if (buffer.empty()) {
+        throw BadStatus(UA_STATUSCODE_BADENCODINGLIMITSEXCEEDED);
+    }
+    // non-empty buffer is used, not allocated
+    UA_ByteString output = asByteString(buffer.data(), buffer.size());
+    throwIfBad(UA_encodeBinary(src, &type, &output));
+    return buffer.first(output.length);
+#else
+    throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+#endif
+}
+
+size_t decodeBinary(
+    [[maybe_unused]] Span<const uint8_t> data,
+    [[maybe_unused]] void* dst,
+    [[maybe_unused]] const UA_DataType& type
+) {
+#if UAPP_OPEN62541_VER_GE(1, 3)
+    size_t offset = 0;
+    throwIfBad(decodeBinaryImpl(data, offset, dst, type));
+    return offset;
+#else
+    throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+#endif
+}
+
+size_t calcSizeBinary(
+    [[maybe_unused]] const void* src, [[maybe_unused]] const UA_DataType& type
+) {
+#if UAPP_OPEN62541_VER_GE(1, 3)
+    return UA_calcSizeBinary(src, &type);
+#else
+    throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+#endif
+}
+
+}  // namespace detail
+
+BatchEncoder::BatchEncoder(size_t capacity) {
+    reserve(capacity);
+}
+
+void BatchEncoder::reserve(size_t capacity) {
+    if (capacity <= buffer_->length) {
+        return;
+    }
+    ByteString buffer;
+    throwIfBad(UA_ByteString_allocBuffer(buffer.handle(), capacity));
+    if (size_ > 0) {
+        std::memcpy(buffer->data, buffer_->data, size_);
+    }
+    buffer_.swap(buffer);
+}
+
+void BatchEncoder::appendImpl(const void* src, const UA_DataType& type) {
+    const size_t required = detail::calcSizeBinary(src, type);
+    if (required == 0) {
+        return;
+    }
+    if (size_ + required > capacity()) {
+        reserve(std::max(2 * capacity(), size_ + required));
+    }
+    detail::encodeBinary(src, type, {buffer_->data + size_, required});  // NOLINT
+    size_ += required;
+}
+
+void BinaryDecoder::append(Span<const uint8_t> chunk) {
+    // discard consumed bytes before the buffer grows
+    if (offset_ > 0) {
+        buffer_.erase(buffer_.begin(), buffer_.begin() + static_cast<ptrdiff_t>(offset_));
+        offset_ = 0;
+    }
+    buffer_.insert(buffer_.end(), chunk.begin(), chunk.end());
+}
+
+bool BinaryDecoder::decodeNext(
+    [[maybe_unused]] void* dst, [[maybe_unused]] const UA_DataType& dataType
+) noexcept {
+#if UAPP_OPEN62541_VER_GE(1, 3)
+    if (available() == 0) {
+        return false;
+    }
+    // decoding fails if the data is incomplete, the decoded object is cleaned up in that case
+    const Span<const uint8_t> data(buffer_.data(), buffer_.size());
+    return detail::decodeBinaryImpl(data, offset_, dst, dataType) == UA_STATUSCODE_GOOD;
+#else
+    return false;
+#endif
+}
+
+}  // namespace opcua
@@ -0,0 +1,121 @@
+#include "open62541pp/EndpointDiscovery.h"
+
+#include <algorithm>  // min, max
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <unordered_set>
+#include <utility>  // move
+
+#include "open62541pp/Client.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Logger.h"
+#include "open62541pp/detail/ScopeExit.h"
+
+namespace opcua {
+
+static EndpointDiscoveryResult probe(const std::string& endpointUrl, uint32_t timeout) noexcept {
+    EndpointDiscoveryResult result{endpointUrl, {}, {}, false};
+    try {
+        Client client([](LogLevel, LogCategory, std::string_view) {});  // silence failed probes
+        client.setTimeout(timeout);
+        result.endpoints = client.getEndpoints(endpointUrl);
+    } catch (const BadStatus& e) {
+        result.status = e.code();
+    } catch (const std::exception&) {
+        result.status = UA_STATUSCODE_BADINTERNALERROR;
+    }
+    return result;
+}
+
+EndpointDiscovery::EndpointDiscovery(EndpointDiscoveryOptions options)
+    : options_(options) {}
+
+void EndpointDiscovery::scan(Span<const std::string> endpointUrls, const Callback& callback) {
+    const auto now = Clock::now();
+    std::vector<const std::string*> pending;
+    std::unordered_set<std::string_view> seen;
+    for (const auto& endpointUrl : endpointUrls) {
+        if (!seen.insert(endpointUrl).second) {
+            continue;
+        }
+        const auto it = cache_.find(endpointUrl);
+        if (it != cache_.end() && now < it->second.expiry) {
+            EndpointDiscoveryResult result{endpointUrl, {}, it->second.endpoints, true};
+            callback(result);
+        } else {
+            pending.push_back(&endpointUrl);
+        }
+    }
+    if (pending.empty()) {
+        return;
+    }
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<EndpointDiscoveryResult> results;
+    std::atomic<size_t> next{0};
+    const auto timeout = static_cast<uint32_t>(options_.probeTimeout.count());
+    auto worker = [&] {
+        for (size_t i = next++; i < pending.size(); i = next++) {
+            auto result = probe(*pending[i], timeout);
+            {
+                std::lock_guard lock(mutex);
+                results.push_back(std::move(result));
+            }
+            cv.notify_one();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    const auto joinOnExit = detail::ScopeExit([&] {
+        next = pending.size();  // skip remaining probes, e.g. if the callback throws
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    });
+    const size_t threadCount =
+        std::min(std::max<size_t>(options_.maxConcurrentProbes, 1), pending.size());
+    threads.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; ++i) {
+        threads.emplace_back(worker);
+    }
+
+    for (size_t delivered = 0; delivered < pending.size(); ++delivered) {
+        std::unique_lock lock(mutex);
+        cv.wait(lock, [&] { return !results.empty(); });
+        auto result = std::move(results.front());
+        results.pop_front();
+        lock.unlock();
+        if (result.status.isGood() && options_.cacheTtl.count() > 0) {
+            cache_[result.endpointUrl] = {result.endpoints, Clock::now() + options_.cacheTtl};
+        }
+        callback(result);
+    }
+}
+
+std::vector<EndpointDiscoveryResult> EndpointDiscovery::scan(Span<const std::string> endpointUrls
+) {
+    std::vector<EndpointDiscoveryResult> results;
+    results.reserve(endpointUrls.size());
+    scan(endpointUrls, [&](EndpointDiscoveryResult& result) {
+        results.push_back(std::move(result));
+    });
+    return results;
+}
+
+std::optional<std::vector<EndpointDescription>> EndpointDiscovery::getCached(
+    const std::string& endpointUrl
+) const {
+    const auto it = cache_.find(endpointUrl);
+    if (it == cache_.end() || Clock::now() >= it->second.expiry) {
+        return std::nullopt;
+    }
+    return it->second.endpoints;
+}
+
+}  // namespace opcua
@@ -1,9 +1,13 @@
 #include "open62541pp/Event.h"
 
+#include <algorithm>  // equal
+
 #include "open62541pp/ErrorHandling.h"
 #include "open62541pp/Server.h"
 #include "open62541pp/TypeWrapper.h"  // operator==
 #include "open62541pp/overloads/comparison.h"  // operator==
+#include "open62541pp/services/View.h"  // browseSimplifiedBrowsePath
+#include "open62541pp/types/Composed.h"  // BrowsePathResult
 #include "open62541pp/types/DateTime.h"
 #include "open62541pp/types/Variant.h"
 
@@ -36,24 +40,52 @@ const NodeId& Event::getNodeId() const noexcept {
 }
 
 Event& Event::writeSourceName(std::string_view sourceName) {
-    return writeProperty({0, "SourceName"}, Variant::fromScalar(sourceName));
+    return writeProperty(QualifiedNameView(0, "SourceName"), Variant::fromScalar(sourceName));
 }
 
 Event& Event::writeTime(DateTime time) {  // NOLINT
-    return writeProperty({0, "Time"}, Variant::fromScalar(time));
+    return writeProperty(QualifiedNameView(0, "Time"), Variant::fromScalar(time));
 }
 
 Event& Event::writeSeverity(uint16_t severity) {
-    return writeProperty({0, "Severity"}, Variant::fromScalar(severity));
+    return writeProperty(QualifiedNameView(0, "Severity"), Variant::fromScalar(severity));
 }
 
 Event& Event::writeMessage(const LocalizedText& message) {
-    return writeProperty({0, "Message"}, Variant::fromScalar(message));
+    return writeProperty(QualifiedNameView(0, "Message"), Variant::fromScalar(message));
+}
+
+const NodeId& Event::getPropertyId(Span<const QualifiedName> propertyPath) {
+    // few properties per event type, linear search is faster than hashing
+    for (const auto& [path, id] : propertyIds_) {
+        if (std::equal(path.begin(), path.end(), propertyPath.begin(), propertyPath.end())) {
+            return id;
+        }
+    }
+    const auto result = services::browseSimplifiedBrowsePath(
+        getConnection(), getNodeId(), propertyPath
+    );
+    throwIfBad(result.getStatusCode());
+    for (const auto& target : result.getTargets()) {
+        if (target.getTargetId().isLocal()) {
+            return propertyIds_
+                .emplace_back(
+                    std::vector<QualifiedName>(propertyPath.begin(), propertyPath.end()),
+                    target.getTargetId().getNodeId()
+                )
+                .second;
+        }
+    }
+    throw BadStatus(UA_STATUSCODE_BADNOMATCH);
 }
 
 Event& Event::writeProperty(const QualifiedName& propertyName, const Variant& value) {
-    const auto status = UA_Server_writeObjectProperty(
-        getConnection().handle(), getNodeId(), propertyName, value
+    return writeNestedProperty({&propertyName, 1}, value);
+}
+
+Event& Event::writeNestedProperty(Span<const QualifiedName> propertyPath, const Variant& value) {
+    const auto status = UA_Server_writeValue(
+        getConnection().handle(), getPropertyId(propertyPath), value
     );
     throwIfBad(status);
     return *this;
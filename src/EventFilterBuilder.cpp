@@ -0,0 +1,71 @@
+#include "open62541pp/EventFilterBuilder.h"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+#include <algorithm>  // min
+
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/types/Builtin.h"  // QualifiedName
+
+namespace opcua {
+
+std::optional<size_t> EventFieldMap::find(std::string_view name) const {
+    const auto it = indices_.find(name);
+    if (it == indices_.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+const Variant& EventView::operator[](size_t index) const noexcept {
+    static const Variant empty;
+    return index < eventFields_.size() ? eventFields_[index] : empty;
+}
+
+const Variant& EventView::operator[](std::string_view name) const {
+    const auto index = fields_->find(name);
+    return (*this)[index.value_or(eventFields_.size())];
+}
+
+static std::vector<QualifiedName> parseBrowsePath(std::string_view name) {
+    std::vector<QualifiedName> browsePath;
+    size_t begin = 0;
+    while (begin <= name.size()) {
+        const size_t end = std::min(name.find('/', begin), name.size());
+        if (end == begin) {
+            throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);  // empty browse name
+        }
+        browsePath.emplace_back(0, name.substr(begin, end - begin));
+        begin = end + 1;
+    }
+    return browsePath;
+}
+
+size_t EventFilterBuilder::add(std::string_view name, const NodeId& typeDefinitionId) {
+    const auto browsePath = parseBrowsePath(name);
+    return add(name, SimpleAttributeOperand(typeDefinitionId, browsePath, AttributeId::Value));
+}
+
+size_t EventFilterBuilder::add(std::string_view name, SimpleAttributeOperand selectClause) {
+    if (name.empty() || fields_.find(name).has_value()) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+    }
+    const size_t index = selectClauses_.size();
+    selectClauses_.push_back(std::move(selectClause));
+    fields_.names_.emplace_back(name);
+    fields_.indices_.emplace(name, index);
+    return index;
+}
+
+EventFilterBuilder& EventFilterBuilder::where(ContentFilter whereClause) {
+    whereClause_ = std::move(whereClause);
+    return *this;
+}
+
+EventFilter EventFilterBuilder::build() const {
+    return {selectClauses_, whereClause_};
+}
+
+}  // namespace opcua
+
+#endif
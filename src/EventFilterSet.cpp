@@ -0,0 +1,330 @@
+#include "open62541pp/EventFilterSet.h"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+
+#include <algorithm>  // count_if
+#include <utility>  // move
+
+#include "open62541pp/AddressSpaceIndex.h"
+#include "open62541pp/Encoding.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/ExtensionObject.h"
+
+#include "open62541_impl.h"
+#include "services/ContentFilter.h"
+
+namespace opcua {
+
+namespace {
+
+/// Maximum number of cached event nodes, the cache is cleared if exceeded.
+#ifdef UAPP_LOW_MEMORY
+constexpr size_t maxEventNodes = 64;
+#else
+constexpr size_t maxEventNodes = 1024;
+#endif
+
+template <typename T>
+std::string encodeKey(const T& value) {
+    const auto encoded = encodeBinary(value);
+    return {reinterpret_cast<const char*>(encoded->data), encoded->length};  // NOLINT
+}
+
+std::optional<bool> toBool(const Variant& value) {
+    if (value.isScalar() && value.isType<bool>()) {
+        return value.getScalar<bool>();
+    }
+    return std::nullopt;
+}
+
+const Variant& fromBool(std::optional<bool> value) {
+    static const Variant trueValue = Variant::fromScalar(true);
+    static const Variant falseValue = Variant::fromScalar(false);
+    static const Variant nullValue;
+    if (!value.has_value()) {
+        return nullValue;
+    }
+    return *value ? trueValue : falseValue;
+}
+
+}  // namespace
+
+EventFilterSet::EventFilterSet(Server& server)
+    : server_(server) {}
+
+size_t EventFilterSet::add(const EventFilter& filter) {
+    auto key = encodeKey(filter);
+    if (const auto it = filterIds_.find(key); it != filterIds_.end()) {
+        ++filters_[it->second].refCount;
+        return it->second;
+    }
+    const auto selectClauses = filter.getSelectClauses();
+    if (selectClauses.empty()) {
+        throw BadStatus(UA_STATUSCODE_BADEVENTFILTERINVALID);
+    }
+    const auto elements = filter.getWhereClause().getElements();
+    for (size_t i = 0; i < elements.size(); ++i) {
+        throwIfBad(services::detail::validateElement(elements, i));
+        for (const auto& operand : elements[i].getFilterOperands()) {
+            if (operand.getDecodedData<AttributeOperand>() != nullptr) {
+                throw BadStatus(UA_STATUSCODE_BADFILTEROPERANDINVALID);  // not allowed for events
+            }
+        }
+    }
+
+    Filter compiled;
+    compiled.key = key;
+    compiled.refCount = 1;
+    if (!elements.empty()) {
+        compile(compiled, elements, 0);
+    }
+    compiled.select.reserve(selectClauses.size());
+    for (const auto& operand : selectClauses) {
+        compiled.select.push_back(addField(operand));
+    }
+
+    // reuse the first free slot
+    size_t filterId = 0;
+    while (filterId < filters_.size() && filters_[filterId].refCount > 0) {
+        ++filterId;
+    }
+    if (filterId == filters_.size()) {
+        filters_.emplace_back();
+    }
+    filters_[filterId] = std::move(compiled);
+    filterIds_.emplace(std::move(key), filterId);
+    ++size_;
+    return filterId;
+}
+
+void EventFilterSet::remove(size_t filterId) {
+    if (filterId >= filters_.size() || filters_[filterId].refCount == 0) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+    }
+    auto& filter = filters_[filterId];
+    if (--filter.refCount > 0) {
+        return;
+    }
+    for (const auto index : filter.select) {
+        --fields_[index].refCount;
+    }
+    for (const auto& instruction : filter.program) {
+        if (instruction.kind == Instruction::Kind::Field) {
+            --fields_[instruction.arg].refCount;
+        }
+    }
+    filterIds_.erase(filter.key);
+    filter = {};
+    --size_;
+}
+
+size_t EventFilterSet::getFieldCount() const noexcept {
+    return static_cast<size_t>(std::count_if(fields_.begin(), fields_.end(), [](const Field& f) {
+        return f.refCount > 0;
+    }));
+}
+
+uint32_t EventFilterSet::addField(const SimpleAttributeOperand& operand) {
+    auto key = encodeKey(operand);
+    if (const auto it = fieldIds_.find(key); it != fieldIds_.end()) {
+        ++fields_[it->second].refCount;
+        return it->second;
+    }
+    const auto index = static_cast<uint32_t>(fields_.size());
+    fields_.push_back({operand, 1});
+    fieldIds_.emplace(std::move(key), index);
+    return index;
+}
+
+void EventFilterSet::compile(
+    Filter& filter, Span<const ContentFilterElement> elements, size_t index
+) {
+    const auto& element = elements[index];
+    const auto operands = element.getFilterOperands();
+    for (const auto& operand : operands) {
+        if (const auto* op = operand.getDecodedData<LiteralOperand>()) {
+            const auto literal = static_cast<uint32_t>(filter.literals.size());
+            filter.literals.push_back(op->getValue());
+            filter.program.push_back({Instruction::Kind::Literal, {}, literal});
+        } else if (const auto* op = operand.getDecodedData<ElementOperand>()) {
+            compile(filter, elements, op->getIndex());  // forward references only
+        } else if (const auto* op = operand.getDecodedData<SimpleAttributeOperand>()) {
+            filter.program.push_back({Instruction::Kind::Field, {}, addField(*op)});
+        }
+    }
+    filter.program.push_back(
+        {Instruction::Kind::Operator,
+         element.getFilterOperator(),
+         static_cast<uint32_t>(operands.size())}
+    );
+}
+
+EventFilterSet::EventNode& EventFilterSet::resolve(const NodeId& eventId) {
+    auto it = eventNodes_.find(eventId);
+    if (it == eventNodes_.end()) {
+        if (eventNodes_.size() >= maxEventNodes) {
+            eventNodes_.clear();  // drop nodes of deleted events
+        }
+        it = eventNodes_.emplace(eventId, EventNode{}).first;
+        it->second.typeDefinition = services::detail::readTypeDefinition(server_, eventId);
+    }
+    auto& node = it->second;
+    // fields added since the last evaluation
+    for (size_t i = node.targets.size(); i < fields_.size(); ++i) {
+        node.targets.push_back(services::detail::resolvePath(
+            server_,
+            eventId,
+            services::detail::toRelativePath(fields_[i].operand.getBrowsePath())
+        ));
+    }
+    return node;
+}
+
+size_t EventFilterSet::evaluate(const NodeId& eventId, const MatchCallback& onMatch) {
+    if (size_ == 0) {
+        return 0;
+    }
+    const auto& node = resolve(eventId);
+
+    // read each distinct field once
+    values_.resize(fields_.size());
+    for (size_t i = 0; i < fields_.size(); ++i) {
+        values_[i] = Variant();
+        if (fields_[i].refCount == 0 || !node.targets[i].has_value()) {
+            continue;
+        }
+        const auto& operand = fields_[i].operand;
+        const ReadValueId rv(
+            *node.targets[i], operand.getAttributeId(), operand.getIndexRange().get()
+        );
+        DataValue dv = UA_Server_read(server_.handle(), rv.handle(), UA_TIMESTAMPSTORETURN_NEITHER);
+        if (dv.getStatus().isGood()) {
+            values_[i] = std::move(dv.getValue());
+        }
+    }
+
+    size_t matched = 0;
+    for (size_t filterId = 0; filterId < filters_.size(); ++filterId) {
+        const auto& filter = filters_[filterId];
+        if (filter.refCount == 0 || !matches(filter, node.typeDefinition)) {
+            continue;
+        }
+        selected_.clear();
+        for (const auto index : filter.select) {
+            selected_.push_back(values_[index]);
+        }
+        ++matched;
+        if (onMatch) {
+            onMatch(filterId, selected_);
+        }
+    }
+    return matched;
+}
+
+bool EventFilterSet::matches(const Filter& filter, const NodeId& typeDefinition) {
+    if (filter.program.empty()) {
+        return true;
+    }
+    stack_.clear();
+    for (const auto& instruction : filter.program) {
+        switch (instruction.kind) {
+        case Instruction::Kind::Field:
+            stack_.push_back(&values_[instruction.arg]);
+            break;
+        case Instruction::Kind::Literal:
+            stack_.push_back(&filter.literals[instruction.arg]);
+            break;
+        case Instruction::Kind::Operator: {
+            const size_t count = instruction.arg;
+            const Span<const Variant* const> operands(stack_.data() + stack_.size() - count, count);
+            const auto result = apply(instruction.filterOperator, operands, typeDefinition);
+            stack_.resize(stack_.size() - count);
+            stack_.push_back(&fromBool(result));
+            break;
+        }
+        }
+    }
+    return toBool(*stack_.back()).value_or(false);
+}
+
+std::optional<bool> EventFilterSet::apply(
+    FilterOperator filterOperator,
+    Span<const Variant* const> operands,
+    const NodeId& typeDefinition
+) const {
+    using services::detail::compare;
+    const auto compareWith = [&](auto&& pred) -> std::optional<bool> {
+        const auto result = compare(*operands[0], *operands[1]);
+        return result ? std::optional(pred(*result)) : std::nullopt;
+    };
+    switch (filterOperator) {
+    case FilterOperator::Equals:
+        return compareWith([](int r) { return r == 0; });
+    case FilterOperator::IsNull:
+        return operands[0]->isEmpty();
+    case FilterOperator::GreaterThan:
+        return compareWith([](int r) { return r > 0; });
+    case FilterOperator::LessThan:
+        return compareWith([](int r) { return r < 0; });
+    case FilterOperator::GreaterThanOrEqual:
+        return compareWith([](int r) { return r >= 0; });
+    case FilterOperator::LessThanOrEqual:
+        return compareWith([](int r) { return r <= 0; });
+    case FilterOperator::Like: {
+        const auto text = services::detail::toText(*operands[0]);
+        const auto pattern = services::detail::toText(*operands[1]);
+        if (!text || !pattern) {
+            return std::nullopt;
+        }
+        return services::detail::matchLike(*text, *pattern);
+    }
+    case FilterOperator::Not: {
+        const auto value = toBool(*operands[0]);
+        return value ? std::optional(!*value) : std::nullopt;
+    }
+    case FilterOperator::Between: {
+        const auto lower = compare(*operands[0], *operands[1]);
+        const auto upper = compare(*operands[0], *operands[2]);
+        if (!lower || !upper) {
+            return std::nullopt;
+        }
+        return *lower >= 0 && *upper <= 0;
+    }
+    case FilterOperator::InList:
+        for (size_t i = 1; i < operands.size(); ++i) {
+            if (compare(*operands[0], *operands[i]) == 0) {
+                return true;
+            }
+        }
+        return false;
+    case FilterOperator::And: {
+        const auto lhs = toBool(*operands[0]);
+        const auto rhs = toBool(*operands[1]);
+        if (lhs == false || rhs == false) {
+            return false;
+        }
+        return (lhs && rhs) ? std::optional(true) : std::nullopt;
+    }
+    case FilterOperator::Or: {
+        const auto lhs = toBool(*operands[0]);
+        const auto rhs = toBool(*operands[1]);
+        if (lhs == true || rhs == true) {
+            return true;
+        }
+        return (lhs && rhs) ? std::optional(false) : std::nullopt;
+    }
+    case FilterOperator::OfType:
+        return !typeDefinition.isNull() &&
+               server_.getAddressSpaceIndex().isInSubtree(
+                   typeDefinition, operands[0]->getScalar<NodeId>()
+               );
+    default:
+        return std::nullopt;  // rejected by validateElement
+    }
+}
+
+}  // namespace opcua
+
+#endif
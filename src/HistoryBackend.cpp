@@ -0,0 +1,671 @@
+#include "open62541pp/HistoryBackend.h"
+
+#include <cstring>  // memcpy
+#include <mutex>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define UAPP_HAS_MMAP
+#endif
+
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/TypeWrapper.h"  // asWrapper
+#include "open62541pp/detail/ServerContext.h"
+#include "open62541pp/services/Attribute.h"
+
+#include "open62541_impl.h"
+
+namespace opcua {
+
+/* ------------------------------------- HistoryRingBuffer -------------------------------------- */
+
+struct HistoryRingBuffer::Header {
+    uint64_t magic;
+    uint64_t capacity;
+    uint64_t start;  // physical index of the oldest sample
+    uint64_t count;
+    uint32_t typeIndex;  // index in UA_TYPES
+    uint32_t reserved;
+};
+
+static constexpr uint64_t historyMagic = 0x3154534948505041;  // "AAPHIST1"
+static constexpr uint32_t noType = UINT32_MAX;
+static constexpr size_t headerSize = 64;
+
+// layout: header | timestamps (int64) | values (uint64) | status codes (uint32)
+static size_t layoutSize(size_t capacity) noexcept {
+    return headerSize + capacity * (sizeof(int64_t) + sizeof(uint64_t) + sizeof(uint32_t));
+}
+
+static bool isFixedSizeBuiltin(const UA_DataType* type) noexcept {
+    return type >= &UA_TYPES[0] && type < &UA_TYPES[UA_TYPES_COUNT] && type->pointerFree &&
+           type->memSize <= sizeof(uint64_t);
+}
+
+HistoryRingBuffer::HistoryRingBuffer(size_t capacity, const std::string& path) {
+    if (capacity == 0) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+    }
+    const size_t size = layoutSize(capacity);
+    uint8_t* base = nullptr;
+    bool existing = false;
+    if (path.empty()) {
+        memory_ = std::make_unique<uint8_t[]>(size);  // NOLINT, zero-initialized
+        base = memory_.get();
+    } else {
+#ifdef UAPP_HAS_MMAP
+        const int fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);  // NOLINT
+        if (fd < 0) {
+            throw BadStatus(UA_STATUSCODE_BADRESOURCEUNAVAILABLE);
+        }
+        struct stat st {};
+        existing = ::fstat(fd, &st) == 0 && st.st_size > 0;
+        if (existing && static_cast<size_t>(st.st_size) != size) {
+            ::close(fd);
+            throw BadStatus(UA_STATUSCODE_BADINVALIDSTATE);
+        }
+        if (!existing && ::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+            ::close(fd);
+            throw BadStatus(UA_STATUSCODE_BADRESOURCEUNAVAILABLE);
+        }
+        void* mapping = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);  // the mapping keeps the file open
+        if (mapping == MAP_FAILED) {  // NOLINT
+            throw BadStatus(UA_STATUSCODE_BADRESOURCEUNAVAILABLE);
+        }
+        mapping_ = mapping;
+        mappingSize_ = size;
+        base = static_cast<uint8_t*>(mapping);
+#else
+        throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+#endif
+    }
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+    header_ = reinterpret_cast<Header*>(base);
+    timestamps_ = reinterpret_cast<int64_t*>(base + headerSize);
+    values_ = reinterpret_cast<uint64_t*>(base + headerSize + capacity * sizeof(int64_t));
+    status_ = reinterpret_cast<uint32_t*>(
+        base + headerSize + capacity * (sizeof(int64_t) + sizeof(uint64_t))
+    );
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+
+    if (existing) {
+        const bool valid = header_->magic == historyMagic && header_->capacity == capacity &&
+                           header_->start < capacity && header_->count <= capacity &&
+                           (header_->typeIndex == noType || header_->typeIndex < UA_TYPES_COUNT);
+        if (!valid) {
+#ifdef UAPP_HAS_MMAP
+            ::munmap(mapping_, mappingSize_);
+#endif
+            throw BadStatus(UA_STATUSCODE_BADINVALIDSTATE);
+        }
+    } else {
+        *header_ = {historyMagic, capacity, 0, 0, noType, 0};
+    }
+}
+
+HistoryRingBuffer::~HistoryRingBuffer() {
+#ifdef UAPP_HAS_MMAP
+    if (mapping_ != nullptr) {
+        ::munmap(mapping_, mappingSize_);
+    }
+#endif
+}
+
+size_t HistoryRingBuffer::physical(size_t index) const noexcept {
+    return (header_->start + index) % header_->capacity;
+}
+
+void HistoryRingBuffer::write(
+    size_t index, int64_t timestamp, StatusCode status, const UA_Variant& value
+) noexcept {
+    const size_t pos = physical(index);
+    timestamps_[pos] = timestamp;  // NOLINT
+    status_[pos] = status.get();  // NOLINT
+    values_[pos] = 0;  // NOLINT
+    if (!status.isBad()) {
+        std::memcpy(&values_[pos], value.data, value.type->memSize);  // NOLINT
+    }
+}
+
+void HistoryRingBuffer::move(size_t from, size_t to) noexcept {
+    const size_t src = physical(from);
+    const size_t dst = physical(to);
+    timestamps_[dst] = timestamps_[src];  // NOLINT
+    status_[dst] = status_[src];  // NOLINT
+    values_[dst] = values_[src];  // NOLINT
+}
+
+StatusCode HistoryRingBuffer::insert(const DataValue& value, bool replace) {
+    const UA_DataValue& native = *value.handle();
+    int64_t timestamp = 0;
+    if (native.hasSourceTimestamp) {
+        timestamp = native.sourceTimestamp;
+    } else if (native.hasServerTimestamp) {
+        timestamp = native.serverTimestamp;
+    } else {
+        timestamp = DateTime::now().get();
+    }
+    const StatusCode status = native.hasStatus ? native.status : UA_STATUSCODE_GOOD;
+    if (!status.isBad()) {
+        const auto* type = native.value.type;
+        const bool valid = native.hasValue && value.getValue().isScalar() &&
+                           isFixedSizeBuiltin(type) &&
+                           (header_->typeIndex == noType || &UA_TYPES[header_->typeIndex] == type);
+        if (!valid) {
+            return UA_STATUSCODE_BADTYPEMISMATCH;
+        }
+        header_->typeIndex = static_cast<uint32_t>(type - &UA_TYPES[0]);
+    }
+
+    auto& count = header_->count;
+    const auto capacity = header_->capacity;
+    if (count == 0 || timestamp > timestamps_[physical(count - 1)]) {  // NOLINT
+        // append, overwrite the oldest sample if full
+        if (count == capacity) {
+            header_->start = (header_->start + 1) % capacity;
+            --count;
+        }
+        write(count, timestamp, status, native.value);
+        ++count;
+        return UA_STATUSCODE_GOOD;
+    }
+
+    size_t pos = lowerBound(DateTime(timestamp));
+    if (pos < count && timestamps_[physical(pos)] == timestamp) {  // NOLINT
+        if (!replace) {
+            return UA_STATUSCODE_BADENTRYEXISTS;
+        }
+        write(pos, timestamp, status, native.value);
+        return UA_STATUSCODE_GOOD;
+    }
+    if (count == capacity) {
+        if (pos == 0) {
+            return UA_STATUSCODE_GOOD;  // older than all samples of the full buffer
+        }
+        header_->start = (header_->start + 1) % capacity;
+        --count;
+        --pos;
+    }
+    for (size_t i = count; i > pos; --i) {
+        move(i - 1, i);
+    }
+    write(pos, timestamp, status, native.value);
+    ++count;
+    return UA_STATUSCODE_GOOD;
+}
+
+StatusCode HistoryRingBuffer::replace(const DataValue& value) {
+    const UA_DataValue& native = *value.handle();
+    const int64_t timestamp = native.hasSourceTimestamp ? native.sourceTimestamp
+                                                        : native.serverTimestamp;
+    const size_t pos = lowerBound(DateTime(timestamp));
+    if (pos == size() || timestamps_[physical(pos)] != timestamp) {  // NOLINT
+        return UA_STATUSCODE_BADNOENTRYEXISTS;
+    }
+    return insert(value, true);
+}
+
+size_t HistoryRingBuffer::remove(DateTime start, DateTime end) noexcept {
+    const size_t first = lowerBound(start);
+    const size_t last = lowerBound(end);
+    if (last <= first) {
+        return 0;
+    }
+    const size_t removed = last - first;
+    for (size_t i = last; i < header_->count; ++i) {
+        move(i, i - removed);
+    }
+    header_->count -= removed;
+    return removed;
+}
+
+void HistoryRingBuffer::clear() noexcept {
+    header_->start = 0;
+    header_->count = 0;
+}
+
+size_t HistoryRingBuffer::size() const noexcept {
+    return header_->count;
+}
+
+size_t HistoryRingBuffer::capacity() const noexcept {
+    return header_->capacity;
+}
+
+DateTime HistoryRingBuffer::getTimestamp(size_t index) const noexcept {
+    return DateTime(timestamps_[physical(index)]);  // NOLINT
+}
+
+void HistoryRingBuffer::getDataValue(size_t index, UA_DataValue& dv) const noexcept {
+    UA_DataValue_init(&dv);
+    const size_t pos = physical(index);
+    dv.sourceTimestamp = timestamps_[pos];  // NOLINT
+    dv.hasSourceTimestamp = true;
+    dv.status = status_[pos];  // NOLINT
+    dv.hasStatus = dv.status != UA_STATUSCODE_GOOD;
+    if (!StatusCode(dv.status).isBad() && header_->typeIndex != noType) {
+        // reference the value column without copy
+        UA_Variant_setScalar(&dv.value, &values_[pos], &UA_TYPES[header_->typeIndex]);  // NOLINT
+        dv.value.storageType = UA_VARIANT_DATA_NODELETE;
+        dv.hasValue = true;
+    }
+}
+
+DataValue HistoryRingBuffer::getDataValue(size_t index) const {
+    UA_DataValue sample;
+    getDataValue(index, sample);
+    DataValue result;
+    throwIfBad(UA_DataValue_copy(&sample, result.handle()));
+    return result;
+}
+
+size_t HistoryRingBuffer::lowerBound(DateTime timestamp) const noexcept {
+    size_t first = 0;
+    size_t count = header_->count;
+    while (count > 0) {
+        const size_t step = count / 2;
+        if (timestamps_[physical(first + step)] < timestamp.get()) {  // NOLINT
+            first += step + 1;
+            count -= step + 1;
+        } else {
+            count = step;
+        }
+    }
+    return first;
+}
+
+size_t HistoryRingBuffer::upperBound(DateTime timestamp) const noexcept {
+    size_t first = 0;
+    size_t count = header_->count;
+    while (count > 0) {
+        const size_t step = count / 2;
+        if (timestamps_[physical(first + step)] <= timestamp.get()) {  // NOLINT
+            first += step + 1;
+            count -= step + 1;
+        } else {
+            count = step;
+        }
+    }
+    return first;
+}
+
+const UA_DataType* HistoryRingBuffer::getDataType() const noexcept {
+    return header_->typeIndex == noType ? nullptr : &UA_TYPES[header_->typeIndex];
+}
+
+void HistoryRingBuffer::flush() noexcept {
+#ifdef UAPP_HAS_MMAP
+    if (mapping_ != nullptr) {
+        ::msync(mapping_, mappingSize_, MS_SYNC);
+    }
+#endif
+}
+
+/* --------------------------------------- HistoryBackend --------------------------------------- */
+
+HistoryRingBuffer* HistoryBackend::findBuffer(const UA_NodeId* id) noexcept {
+    const auto it = buffers_.find(asWrapper<NodeId>(*id));
+    return it == buffers_.end() ? nullptr : it->second.get();
+}
+
+HistoryRingBuffer& HistoryBackend::getBuffer(const NodeId& id) {
+    const auto it = buffers_.find(id);
+    if (it == buffers_.end()) {
+        throw BadStatus(UA_STATUSCODE_BADNODEIDUNKNOWN);
+    }
+    return *it->second;
+}
+
+#ifdef UA_ENABLE_HISTORIZING
+
+/// Native callbacks of UA_HistoryDataBackend, the indexes are logical indexes of the ring buffer.
+/// The end index (sentinel of invalid results) is the size of the buffer.
+struct HistoryBackendCallbacks {
+    static HistoryRingBuffer* getBuffer(void* context, const UA_NodeId* nodeId) noexcept {
+        return static_cast<HistoryBackend*>(context)->findBuffer(nodeId);
+    }
+
+    static UA_StatusCode serverSetHistoryData(
+        UA_Server* /* server */,
+        void* context,
+        const UA_NodeId* /* sessionId */,
+        void* /* sessionContext */,
+        const UA_NodeId* nodeId,
+        UA_Boolean historizing,
+        const UA_DataValue* value
+    ) noexcept {
+        auto* buffer = getBuffer(context, nodeId);
+        if (!historizing || buffer == nullptr) {
+            return UA_STATUSCODE_GOOD;
+        }
+        return buffer->insert(asWrapper<DataValue>(*value), true);
+    }
+
+    static size_t getDateTimeMatch(
+        UA_Server* /* server */,
+        void* context,
+        const UA_NodeId* /* sessionId */,
+        void* /* sessionContext */,
+        const UA_NodeId* nodeId,
+        const UA_DateTime timestamp,
+        const MatchStrategy strategy
+    ) noexcept {
+        const auto* buffer = getBuffer(context, nodeId);
+        if (buffer == nullptr) {
+            return 0;
+        }
+        const size_t end = buffer->size();
+        const DateTime dt(timestamp);
+        switch (strategy) {
+        case MATCH_EQUAL: {
+            const size_t index = buffer->lowerBound(dt);
+            return index < end && buffer->getTimestamp(index).get() == timestamp ? index : end;
+        }
+        case MATCH_AFTER:
+            return buffer->upperBound(dt);
+        case MATCH_EQUAL_OR_AFTER:
+            return buffer->lowerBound(dt);
+        case MATCH_BEFORE: {
+            const size_t index = buffer->lowerBound(dt);
+            return index == 0 ? end : index - 1;
+        }
+        case MATCH_EQUAL_OR_BEFORE: {
+            const size_t index = buffer->upperBound(dt);
+            return index == 0 ? end : index - 1;
+        }
+        default:
+            return end;
+        }
+    }
+
+    static size_t getEnd(
+        UA_Server* /* server */,
+        void* context,
+        const UA_NodeId* /* sessionId */,
+        void* /* sessionContext */,
+        const UA_NodeId* nodeId
+    ) noexcept {
+        const auto* buffer = getBuffer(context, nodeId);
+        return buffer == nullptr ? 0 : buffer->size();
+    }
+
+    static size_t lastIndex(
+        UA_Server* server,
+        void* context,
+        const UA_NodeId* sessionId,
+        void* sessionContext,
+        const UA_NodeId* nodeId
+    ) noexcept {
+        const size_t end = getEnd(server, context, sessionId, sessionContext, nodeId);
+        return end == 0 ? end : end - 1;
+    }
+
+    static size_t firstIndex(
+        UA_Server* /* server */,
+        void* /* context */,
+        const UA_NodeId* /* sessionId */,
+        void* /* sessionContext */,
+        const UA_NodeId* /* nodeId */
+    ) noexcept {
+        return 0;  // equals the end index if the buffer is empty
+    }
+
+    static size_t resultSize(
+        UA_Server* /* server */,
+        void* context,
+        const UA_NodeId* /* sessionId */,
+        void* /* sessionContext */,
+        const UA_NodeId* nodeId,
+        size_t startIndex,
+        size_t endIndex
+    ) noexcept {
+        const auto* buffer = getBuffer(context, nodeId);
+        const size_t end = buffer == nullptr ? 0 : buffer->size();
+        if (startIndex >= end || endIndex >= end) {
+            return 0;
+        }
+        return (startIndex <= endIndex ? endIndex - startIndex : startIndex - endIndex) + 1;
+    }
+
+    static UA_StatusCode copyDataValues(
+        UA_Server* /* server */,
+        void* context,
+        const UA_NodeId* /* sessionId */,
+        void* /* sessionContext */,
+        const UA_NodeId* nodeId,
+        size_t startIndex,
+        size_t endIndex,
+        UA_Boolean reverse,
+        size_t valueSize,
+        UA_NumericRange range,
+        UA_Boolean /* releaseContinuationPoints */,
+        const UA_ByteString* continuationPoint,
+        UA_ByteString* outContinuationPoint,
+        size_t* providedValues,
+        UA_DataValue* values
+    ) noexcept {
+        size_t skip = 0;
+        if (continuationPoint->length > 0) {
+            if (continuationPoint->length < sizeof(size_t)) {
+                return UA_STATUSCODE_BADCONTINUATIONPOINTINVALID;
+            }
+            std::memcpy(&skip, continuationPoint->data, sizeof(size_t));
+        }
+        const auto* buffer = getBuffer(context, nodeId);
+        const size_t end = buffer == nullptr ? 0 : buffer->size();
+        const size_t total = reverse ? startIndex - endIndex + 1 : endIndex - startIndex + 1;
+        size_t counter = 0;
+        for (size_t i = skip; i < total && counter < valueSize; ++i) {
+            const size_t index = reverse ? startIndex - i : startIndex + i;
+            if (index >= end) {
+                break;
+            }
+            UA_DataValue sample;
+            buffer->getDataValue(index, sample);
+            UA_DataValue& dst = values[counter];  // NOLINT
+            if (range.dimensionsSize > 0) {
+                dst = sample;  // timestamps and status, no value
+                UA_Variant_init(&dst.value);
+                dst.hasValue = false;
+                dst.status = UA_STATUSCODE_BADINDEXRANGENODATA;  // scalar samples only
+                dst.hasStatus = true;
+            } else {
+                const auto status = UA_DataValue_copy(&sample, &dst);
+                if (status != UA_STATUSCODE_GOOD) {
+                    return status;
+                }
+            }
+            ++counter;
+        }
+        if (providedValues != nullptr) {
+            *providedValues = counter;
+        }
+        if (skip + counter < total) {
+            const size_t next = skip + counter;
+            const auto status = UA_ByteString_allocBuffer(outContinuationPoint, sizeof(size_t));
+            if (status != UA_STATUSCODE_GOOD) {
+                return status;
+            }
+            std::memcpy(outContinuationPoint->data, &next, sizeof(size_t));
+        }
+        return UA_STATUSCODE_GOOD;
+    }
+
+    static const UA_DataValue* getDataValue(
+        UA_Server* /* server */,
+        void* context,
+        const UA_NodeId* /* sessionId */,
+        void* /* sessionContext */,
+        const UA_NodeId* nodeId,
+        size_t index
+    ) noexcept {
+        auto& backend = *static_cast<HistoryBackend*>(context);
+        const auto* buffer = backend.findBuffer(nodeId);
+        if (buffer == nullptr || index >= buffer->size()) {
+            return nullptr;
+        }
+        UA_DataValue& scratch = *backend.scratch_.handle();
+        UA_DataValue_clear(&scratch);
+        buffer->getDataValue(index, scratch);  // valid until the next call
+        return &scratch;
+    }
+
+    static UA_Boolean boundSupported(
+        UA_Server* /* server */,
+        void* /* context */,
+        const UA_NodeId* /* sessionId */,
+        void* /* sessionContext */,
+        const UA_NodeId* /* nodeId */
+    ) noexcept {
+        return true;
+    }
+
+    static UA_Boolean timestampsToReturnSupported(
+        UA_Server* /* server */,
+        void* /* context */,
+        const UA_NodeId* /* sessionId */,
+        void* /* sessionContext */,
+        const UA_NodeId* /* nodeId */,
+        const UA_TimestampsToReturn timestampsToReturn
+    ) noexcept {
+        return timestampsToReturn == UA_TIMESTAMPSTORETURN_SOURCE;
+    }
+
+    static UA_StatusCode insertDataValue(
+        UA_Server* /* server */,
+        void* context,
+        const UA_NodeId* /* sessionId */,
+        void* /* sessionContext */,
+        const UA_NodeId* nodeId,
+        const UA_DataValue* value
+    ) noexcept {
+        auto* buffer = getBuffer(context, nodeId);
+        if (buffer == nullptr) {
+            return UA_STATUSCODE_BADNODEIDUNKNOWN;
+        }
+        return buffer->insert(asWrapper<DataValue>(*value), false);
+    }
+
+    static UA_StatusCode replaceDataValue(
+        UA_Server* /* server */,
+        void* context,
+        const UA_NodeId* /* sessionId */,
+        void* /* sessionContext */,
+        const UA_NodeId* nodeId,
+        const UA_DataValue* value
+    ) noexcept {
+        auto* buffer = getBuffer(context, nodeId);
+        if (buffer == nullptr) {
+            return UA_STATUSCODE_BADNODEIDUNKNOWN;
+        }
+        return buffer->replace(asWrapper<DataValue>(*value));
+    }
+
+    static UA_StatusCode updateDataValue(
+        UA_Server* /* server */,
+        void* context,
+        const UA_NodeId* /* sessionId */,
+        void* /* sessionContext */,
+        const UA_NodeId* nodeId,
+        const UA_DataValue* value
+    ) noexcept {
+        auto* buffer = getBuffer(context, nodeId);
+        if (buffer == nullptr) {
+            return UA_STATUSCODE_BADNODEIDUNKNOWN;
+        }
+        return buffer->insert(asWrapper<DataValue>(*value), true);
+    }
+
+    static UA_StatusCode removeDataValue(
+        UA_Server* /* server */,
+        void* context,
+        const UA_NodeId* /* sessionId */,
+        void* /* sessionContext */,
+        const UA_NodeId* nodeId,
+        UA_DateTime startTimestamp,
+        UA_DateTime endTimestamp
+    ) noexcept {
+        auto* buffer = getBuffer(context, nodeId);
+        if (buffer == nullptr) {
+            return UA_STATUSCODE_BADNODEIDUNKNOWN;
+        }
+        buffer->remove(DateTime(startTimestamp), DateTime(endTimestamp));
+        return UA_STATUSCODE_GOOD;
+    }
+
+    static UA_HistoryDataBackend create(HistoryBackend* backend) noexcept {
+        UA_HistoryDataBackend result{};
+        result.context = backend;
+        result.serverSetHistoryData = serverSetHistoryData;
+        result.getDateTimeMatch = getDateTimeMatch;
+        result.getEnd = getEnd;
+        result.lastIndex = lastIndex;
+        result.firstIndex = firstIndex;
+        result.resultSize = resultSize;
+        result.copyDataValues = copyDataValues;
+        result.getDataValue = getDataValue;
+        result.boundSupported = boundSupported;
+        result.timestampsToReturnSupported = timestampsToReturnSupported;
+        result.insertDataValue = insertDataValue;
+        result.replaceDataValue = replaceDataValue;
+        result.updateDataValue = updateDataValue;
+        result.removeDataValue = removeDataValue;
+        return result;  // storage is owned by HistoryBackend, no deleteMembers
+    }
+};
+
+static UA_HistoryDataGathering& getGathering(Server& server) {
+    auto& context = detail::getContext(server);
+    std::lock_guard lock(context.mutex);
+    if (context.historyGathering == nullptr) {
+        auto* config = UA_Server_getConfig(server.handle());
+        if (config->historyDatabase.context != nullptr) {
+            throw BadStatus(UA_STATUSCODE_BADINVALIDSTATE);
+        }
+        auto gathering = std::make_shared<UA_HistoryDataGathering>(
+            UA_HistoryDataGathering_Default(16)
+        );
+        // the database takes ownership of the gathering context and frees it with the server
+        config->historyDatabase = UA_HistoryDatabase_default(*gathering);
+        context.historyGathering = gathering;
+    }
+    return *static_cast<UA_HistoryDataGathering*>(context.historyGathering.get());
+}
+
+HistoryRingBuffer& HistoryBackend::registerNode(
+    Server& server, const NodeId& id, const HistoryOptions& options
+) {
+    auto buffer = std::make_unique<HistoryRingBuffer>(options.capacity, options.path);
+    auto& gathering = getGathering(server);
+
+    UA_HistorizingNodeIdSettings setting{};
+    setting.historizingBackend = HistoryBackendCallbacks::create(this);
+    setting.maxHistoryDataResponseSize = options.maxResponseSize;
+    setting.historizingUpdateStrategy = UA_HISTORIZINGUPDATESTRATEGY_VALUESET;
+    throwIfBad(gathering.registerNodeId(server.handle(), gathering.context, id.handle(), setting));
+
+    services::writeAccessLevel(
+        server, id, services::readAccessLevel(server, id) | AccessLevel::HistoryRead
+    );
+    services::writeHistorizing(server, id, true);
+
+    auto& slot = buffers_[id];
+    slot = std::move(buffer);
+    return *slot;
+}
+
+#else
+
+HistoryRingBuffer& HistoryBackend::registerNode(Server&, const NodeId&, const HistoryOptions&) {
+    throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+}
+
+#endif
+
+}  // namespace opcua
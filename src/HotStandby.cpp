@@ -0,0 +1,137 @@
+#include "open62541pp/HotStandby.h"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+#include <initializer_list>
+#include <memory>
+#include <utility>  // move
+
+#include "open62541pp/Client.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/MonitoredItem.h"
+#include "open62541pp/detail/ScopeExit.h"
+#include "open62541pp/types/Composed.h"  // ReadValueId
+#include "open62541pp/types/DataValue.h"
+
+namespace opcua {
+
+HotStandby::HotStandby(Client& primary, Client& secondary, HotStandbyOptions options)
+    : options_(options),
+      primary_{primary},
+      secondary_{secondary} {}
+
+HotStandby::~HotStandby() {
+    for (auto* side : {&primary_, &secondary_}) {
+        if (side->subscriptionId == 0 || !side->client.isConnected()) {
+            continue;
+        }
+        try {
+            services::deleteSubscription(side->client, side->subscriptionId);
+        } catch (...) {  // NOLINT(bugprone-empty-catch)
+        }
+    }
+}
+
+std::vector<MonitoredItemResult> HotStandby::subscribeDataChange(
+    Span<const ReadValueId> itemsToMonitor,
+    const MonitoringParameters& parameters,
+    DataChangeCallback<Client> onDataChange
+) {
+    // shared callback, that only forwards the notifications of the active server
+    auto callback = std::make_shared<DataChangeCallback<Client>>(std::move(onDataChange));
+    auto forwardIf = [this, callback](bool failedOver) {
+        return [this, callback, failedOver](
+                   const MonitoredItem<Client>& item, const DataValue& value
+               ) {
+            if (isFailedOver() == failedOver && *callback) {
+                (*callback)(item, value);
+            }
+        };
+    };
+    if (isFailedOver()) {
+        // the primary server is not used anymore
+        return subscribe(
+            secondary_, itemsToMonitor, MonitoringMode::Reporting, parameters, forwardIf(true)
+        );
+    }
+    auto results = subscribe(
+        primary_, itemsToMonitor, MonitoringMode::Reporting, parameters, forwardIf(false)
+    );
+    subscribe(secondary_, itemsToMonitor, options_.standbyMode, parameters, forwardIf(true));
+    return results;
+}
+
+std::vector<MonitoredItemResult> HotStandby::subscribe(
+    Side& side,
+    Span<const ReadValueId> itemsToMonitor,
+    MonitoringMode monitoringMode,
+    const MonitoringParameters& parameters,
+    DataChangeCallback<Client> onDataChange
+) {
+    if (side.subscriptionId == 0) {
+        auto subscriptionParameters = options_.parameters;
+        side.subscriptionId =
+            side.client.createSubscription(subscriptionParameters).getSubscriptionId();
+    }
+    auto results = Subscription<Client>(side.client, side.subscriptionId)
+                       .subscribeDataChangeMany(
+                           itemsToMonitor, monitoringMode, parameters, std::move(onDataChange)
+                       );
+    for (const auto& result : results) {
+        if (result.statusCode.isGood()) {
+            side.monitoredItemIds.push_back(result.monitoredItemId);
+        }
+    }
+    return results;
+}
+
+bool HotStandby::isPrimaryAlive() {
+    if (!primary_.client.isConnected()) {
+        return false;
+    }
+    if (primary_.subscriptionId == 0) {
+        return true;
+    }
+    try {
+        const Subscription<Client> subscription(primary_.client, primary_.subscriptionId);
+        return subscription.getStatistics().inactivityTimeouts == 0;
+    } catch (const BadStatus&) {
+        return false;  // subscription deleted, e.g. by a lost session
+    }
+}
+
+bool HotStandby::check() {
+    if (isFailedOver() || isPrimaryAlive()) {
+        return false;
+    }
+    failover();
+    return true;
+}
+
+void HotStandby::failover() {
+    if (failedOver_.exchange(true, std::memory_order_acq_rel)) {
+        return;
+    }
+    if (secondary_.monitoredItemIds.empty() || options_.standbyMode == MonitoringMode::Reporting) {
+        return;
+    }
+    // not failed over if the request fails, the failover can be retried
+    auto resetOnFailure = detail::ScopeExit([this] {
+        failedOver_.store(false, std::memory_order_release);
+    });
+    // single batched request for all standby items
+    const auto results = services::setMonitoringMode(
+        secondary_.client,
+        secondary_.subscriptionId,
+        secondary_.monitoredItemIds,
+        MonitoringMode::Reporting
+    );
+    for (const auto& code : results) {
+        throwIfBad(code);
+    }
+    resetOnFailure.release();
+}
+
+}  // namespace opcua
+
+#endif
@@ -0,0 +1,234 @@
+#include "open62541pp/InstantiationTemplate.h"
+
+#include <algorithm>  // any_of, equal, find_if
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>  // move
+
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/ValueBackend.h"
+#include "open62541pp/detail/ServerContext.h"
+#include "open62541pp/services/Attribute_highlevel.h"
+#include "open62541pp/services/View.h"
+#include "open62541pp/types/Composed.h"
+
+#include "NodeInsertion.h"
+
+namespace opcua {
+
+static std::vector<ReferenceDescription> browseForward(
+    Server& server, const NodeId& id, const NodeId& referenceType, BrowseResultMask resultMask
+) {
+    return services::browseAll(
+        server,
+        BrowseDescription(
+            id, BrowseDirection::Forward, referenceType, true, NodeClass::Unspecified, resultMask
+        )
+    );
+}
+
+static bool isMandatory(Server& server, const NodeId& declarationId) {
+    const auto refs = browseForward(
+        server, declarationId, ReferenceTypeId::HasModellingRule, BrowseResultMask::None
+    );
+    return std::any_of(refs.begin(), refs.end(), [](const ReferenceDescription& ref) {
+        return ref.getNodeId().getNodeId() == NodeId(ObjectId::ModellingRule_Mandatory);
+    });
+}
+
+/// Get the supertype of a type node, null if none.
+static NodeId getSupertype(Server& server, const NodeId& typeId) {
+    const auto refs = services::browseAll(
+        server,
+        BrowseDescription(
+            typeId,
+            BrowseDirection::Inverse,
+            ReferenceTypeId::HasSubtype,
+            false,
+            NodeClass::Unspecified,
+            BrowseResultMask::None
+        )
+    );
+    return refs.empty() ? NodeId{} : refs.front().getNodeId().getNodeId();
+}
+
+InstantiationTemplate::InstantiationTemplate(Server& server, const NodeId& objectType)
+    : server_(server),
+      objectType_(objectType) {
+    if (services::readNodeClass(server, objectType) != NodeClass::ObjectType) {
+        throw BadStatus(UA_STATUSCODE_BADNODECLASSINVALID);
+    }
+    // instance declarations of subtypes override the inherited ones with the same browse name
+    for (NodeId typeId = objectType; !typeId.isNull(); typeId = getSupertype(server, typeId)) {
+        collectChildren(typeId, npos);
+    }
+}
+
+void InstantiationTemplate::collectChildren(const NodeId& declarationId, size_t parent) {
+    const auto refs = browseForward(
+        server_, declarationId, ReferenceTypeId::Aggregates, BrowseResultMask::All
+    );
+    for (const auto& ref : refs) {
+        const auto& target = ref.getNodeId();
+        if (!target.isLocal() || !isMandatory(server_, target.getNodeId())) {
+            continue;
+        }
+        if (parent == npos) {
+            const auto overridden = std::any_of(
+                children_.begin(), children_.end(), [&](const Child& child) {
+                    return child.parent == npos && child.browseName == ref.getBrowseName();
+                }
+            );
+            if (overridden) {
+                continue;
+            }
+        }
+        const NodeClass nodeClass = ref.getNodeClass();
+        if (nodeClass == NodeClass::Method) {
+            methods_.push_back({parent, ref.getReferenceTypeId(), target.getNodeId()});
+            continue;
+        }
+        if (nodeClass != NodeClass::Object && nodeClass != NodeClass::Variable) {
+            continue;
+        }
+
+        auto path = parent == npos ? std::vector<QualifiedName>{} : paths_[parent];
+        path.push_back(ref.getBrowseName());
+        paths_.push_back(std::move(path));
+        children_.push_back(
+            {parent,
+             ref.getReferenceTypeId(),
+             nodeClass,
+             ref.getBrowseName(),
+             target.getNodeId(),
+             ref.getTypeDefinition().getNodeId(),
+             detail::readNodeAttributes(server_, target.getNodeId(), nodeClass)}
+        );
+        collectChildren(target.getNodeId(), children_.size() - 1);
+    }
+}
+
+std::optional<size_t> InstantiationTemplate::findChild(Span<const QualifiedName> browsePath
+) const {
+    const auto it = std::find_if(paths_.begin(), paths_.end(), [&](const auto& path) {
+        return std::equal(path.begin(), path.end(), browsePath.begin(), browsePath.end());
+    });
+    if (it == paths_.end()) {
+        return std::nullopt;
+    }
+    return static_cast<size_t>(it - paths_.begin());
+}
+
+NodeId InstantiationTemplate::getChildId(const NodeId& instanceId, size_t index) const {
+    const auto ns = instanceId.getNamespaceIndex();
+    switch (instanceId.getIdentifierType()) {
+    case NodeIdType::Numeric:
+        return {ns, instanceId.getIdentifierAs<uint32_t>() + static_cast<uint32_t>(index) + 1};
+    case NodeIdType::String: {
+        std::string id(instanceId.getIdentifierAs<String>().get());
+        for (const auto& name : paths_.at(index)) {
+            id += '.';
+            id += name.getName();
+        }
+        return {ns, id};
+    }
+    default:
+        throw BadStatus(UA_STATUSCODE_BADNODEIDINVALID);
+    }
+}
+
+std::vector<NodeId> InstantiationTemplate::instantiate(
+    const NodeId& parentId,
+    Span<const NodeId> ids,
+    Span<const QualifiedName> browseNames,
+    const NodeId& referenceType
+) {
+    if (ids.size() != browseNames.size()) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+    }
+    const size_t nodesPerInstance = children_.size() + 1;
+    std::vector<detail::NodeRecord> records;
+    records.reserve(ids.size() * nodesPerInstance);
+    std::vector<NodeId> variables;
+
+    for (size_t i = 0; i < ids.size(); ++i) {
+        const size_t first = records.size();
+        auto& root = records.emplace_back();
+        root.nodeClass = NodeClass::Object;
+        root.id = ids[i];
+        root.browseName = browseNames[i];
+        root.parentId = parentId;
+        root.attributes = ExtensionObject::fromDecodedCopy(
+            ObjectAttributes{}.setDisplayName({"", browseNames[i].getName()})
+        );
+        root.references.push_back({referenceType, parentId, false});
+        root.references.push_back(
+            {NodeId(ReferenceTypeId::HasTypeDefinition), objectType_, true}
+        );
+
+        for (size_t c = 0; c < children_.size(); ++c) {
+            const auto& child = children_[c];
+            auto& record = records.emplace_back();
+            record.nodeClass = child.nodeClass;
+            record.id = getChildId(ids[i], c);
+            record.browseName = child.browseName;
+            record.parentId = records[first + (child.parent == npos ? 0 : child.parent + 1)].id;
+            record.attributes = child.attributes;
+            record.references.push_back({child.referenceType, record.parentId, false});
+            if (!child.typeDefinition.isNull()) {
+                record.references.push_back(
+                    {NodeId(ReferenceTypeId::HasTypeDefinition), child.typeDefinition, true}
+                );
+            }
+            if (child.nodeClass == NodeClass::Variable) {
+                variables.push_back(record.id);
+            }
+        }
+        for (const auto& method : methods_) {
+            auto& source = records[first + (method.parent == npos ? 0 : method.parent + 1)];
+            source.references.push_back({method.referenceType, method.methodId, true});
+        }
+    }
+
+    const auto result = detail::insertNodes(server_, records);
+    if (!result.errors.empty()) {
+        throw BadStatus(result.errors.front().second);
+    }
+    return variables;
+}
+
+std::vector<NodeId> InstantiationTemplate::instantiate(
+    const NodeId& parentId,
+    Span<const NodeId> ids,
+    Span<const QualifiedName> browseNames,
+    ValueBackendDataSource backend,
+    const NodeId& referenceType
+) {
+    auto variables = instantiate(parentId, ids, browseNames, referenceType);
+    server_.setVariableNodeValueBackends(variables, std::move(backend));
+    return variables;
+}
+
+/* ------------------------------------------- Server ------------------------------------------- */
+
+InstantiationTemplate& Server::getInstantiationTemplate(const NodeId& objectType) {
+    auto& context = detail::getContext(*this);
+    {
+        const std::lock_guard lock(context.mutex);
+        const auto it = context.instantiationTemplates.find(objectType);
+        if (it != context.instantiationTemplates.end()) {
+            return *it->second;
+        }
+    }
+    // browse the type without holding the lock
+    auto created = std::make_shared<InstantiationTemplate>(*this, objectType);
+    const std::lock_guard lock(context.mutex);
+    return *context.instantiationTemplates.try_emplace(objectType, std::move(created))
+                .first->second;
+}
+
+}  // namespace opcua
@@ -0,0 +1,885 @@
+#include "open62541pp/JsonEncoding.h"
+
+#include <algorithm>  // max
+#include <charconv>  // to_chars
+#include <cmath>  // isinf, isnan
+#include <cstddef>  // byte
+#include <cstdio>  // snprintf
+#include <cstring>  // memcpy
+#include <limits>
+#include <string_view>
+
+#include "open62541pp/Config.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/detail/helper.h"
+
+namespace opcua {
+
+namespace {
+
+/// Maximum nesting depth of variants, extension objects, diagnostic infos and structures.
+constexpr size_t maxDepth = 100;
+
+constexpr std::string_view hexDigits = "0123456789ABCDEF";
+constexpr std::string_view base64Digits =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+const UA_DataType* getMemberType(const UA_DataTypeMember& member) noexcept {
+#if UAPP_OPEN62541_VER_GE(1, 3)
+    return member.memberType;
+#else
+    return member.namespaceZero ? &UA_TYPES[member.memberTypeIndex] : nullptr;  // NOLINT
+#endif
+}
+
+std::string_view getMemberName([[maybe_unused]] const UA_DataTypeMember& member) {
+#ifdef UA_ENABLE_TYPEDESCRIPTION
+    if (member.memberName != nullptr) {
+        return member.memberName;
+    }
+#endif
+    throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+}
+
+bool isOptional([[maybe_unused]] const UA_DataTypeMember& member) noexcept {
+#if UAPP_OPEN62541_VER_GE(1, 1)
+    return member.isOptional;
+#else
+    return false;
+#endif
+}
+
+template <typename T>
+const T& load(const std::byte* ptr) noexcept {
+    return *static_cast<const T*>(static_cast<const void*>(ptr));
+}
+
+/**
+ * Output buffer of the JSON writer.
+ * Writes either into a growable string or into a fixed, caller-provided buffer.
+ */
+class JsonBuffer {
+public:
+    /// Append to a growable string, starting at `offset`.
+    JsonBuffer(std::string& storage, size_t offset) noexcept
+        : storage_(&storage),
+          data_(storage.data()),
+          capacity_(storage.size()),
+          size_(offset) {}
+
+    /// Write into a fixed buffer.
+    explicit JsonBuffer(Span<char> buffer) noexcept
+        : data_(buffer.data()),
+          capacity_(buffer.size()) {}
+
+    size_t size() const noexcept {
+        return size_;
+    }
+
+    void put(char c) {
+        *reserve(1) = c;
+        ++size_;
+    }
+
+    void write(std::string_view str) {
+        if (!str.empty()) {
+            std::memcpy(reserve(str.size()), str.data(), str.size());
+            size_ += str.size();
+        }
+    }
+
+    /// Get a pointer to at least `count` writable bytes, commit the written bytes with commit().
+    /// Fixed buffers must fit all `count` bytes, reserve only the exact length of the output.
+    char* reserve(size_t count) {
+        if (capacity_ - size_ < count) {
+            grow(count);
+        }
+        return data_ + size_;  // NOLINT(*-pointer-arithmetic)
+    }
+
+    void commit(const char* end) noexcept {
+        size_ = static_cast<size_t>(end - data_);
+    }
+
+private:
+    void grow(size_t count) {
+        if (storage_ == nullptr) {
+            throw BadStatus(UA_STATUSCODE_BADENCODINGLIMITSEXCEEDED);
+        }
+        storage_->resize(std::max({2 * capacity_, size_ + count, size_t{256}}));
+        data_ = storage_->data();
+        capacity_ = storage_->size();
+    }
+
+    std::string* storage_{nullptr};
+    char* data_;
+    size_t capacity_;
+    size_t size_{0};
+};
+
+/**
+ * Writer of the OPC UA JSON encoding (Part 6, 5.4).
+ * The encoding is driven by the data type descriptions, values are written without intermediate
+ * strings.
+ */
+class JsonWriter {
+public:
+    JsonWriter(JsonBuffer& buffer, const JsonEncodingOptions& options) noexcept
+        : buffer_(buffer),
+          options_(options) {}
+
+    void encode(const void* src, const UA_DataType& type) {
+        const DepthGuard guard(depth_);
+        switch (type.typeKind) {
+        case UA_DATATYPEKIND_BOOLEAN:
+            buffer_.write(*static_cast<const UA_Boolean*>(src) ? "true" : "false");
+            break;
+        case UA_DATATYPEKIND_SBYTE:
+            writeInteger(*static_cast<const UA_SByte*>(src));
+            break;
+        case UA_DATATYPEKIND_BYTE:
+            writeInteger(*static_cast<const UA_Byte*>(src));
+            break;
+        case UA_DATATYPEKIND_INT16:
+            writeInteger(*static_cast<const UA_Int16*>(src));
+            break;
+        case UA_DATATYPEKIND_UINT16:
+            writeInteger(*static_cast<const UA_UInt16*>(src));
+            break;
+        case UA_DATATYPEKIND_INT32:
+        case UA_DATATYPEKIND_ENUM:
+            writeInteger(*static_cast<const UA_Int32*>(src));
+            break;
+        case UA_DATATYPEKIND_UINT32:
+            writeInteger(*static_cast<const UA_UInt32*>(src));
+            break;
+        case UA_DATATYPEKIND_INT64:
+            // 64 bit integers are encoded as strings, JSON numbers are doubles
+            buffer_.put('"');
+            writeInteger(*static_cast<const UA_Int64*>(src));
+            buffer_.put('"');
+            break;
+        case UA_DATATYPEKIND_UINT64:
+            buffer_.put('"');
+            writeInteger(*static_cast<const UA_UInt64*>(src));
+            buffer_.put('"');
+            break;
+        case UA_DATATYPEKIND_FLOAT:
+            writeFloating(*static_cast<const UA_Float*>(src));
+            break;
+        case UA_DATATYPEKIND_DOUBLE:
+            writeFloating(*static_cast<const UA_Double*>(src));
+            break;
+        case UA_DATATYPEKIND_STRING:
+        case UA_DATATYPEKIND_XMLELEMENT:
+            writeString(*static_cast<const UA_String*>(src));
+            break;
+        case UA_DATATYPEKIND_DATETIME:
+            writeDateTime(*static_cast<const UA_DateTime*>(src));
+            break;
+        case UA_DATATYPEKIND_GUID:
+            buffer_.put('"');
+            writeGuid(*static_cast<const UA_Guid*>(src));
+            buffer_.put('"');
+            break;
+        case UA_DATATYPEKIND_BYTESTRING:
+            writeByteString(*static_cast<const UA_ByteString*>(src));
+            break;
+        case UA_DATATYPEKIND_NODEID:
+            buffer_.put('"');
+            writeNodeId(*static_cast<const UA_NodeId*>(src), true);
+            buffer_.put('"');
+            break;
+        case UA_DATATYPEKIND_EXPANDEDNODEID:
+            writeExpandedNodeId(*static_cast<const UA_ExpandedNodeId*>(src));
+            break;
+        case UA_DATATYPEKIND_STATUSCODE:
+            writeStatusCode(*static_cast<const UA_StatusCode*>(src));
+            break;
+        case UA_DATATYPEKIND_QUALIFIEDNAME:
+            writeQualifiedName(*static_cast<const UA_QualifiedName*>(src));
+            break;
+        case UA_DATATYPEKIND_LOCALIZEDTEXT:
+            writeLocalizedText(*static_cast<const UA_LocalizedText*>(src));
+            break;
+        case UA_DATATYPEKIND_EXTENSIONOBJECT:
+            writeExtensionObject(*static_cast<const UA_ExtensionObject*>(src));
+            break;
+        case UA_DATATYPEKIND_DATAVALUE:
+            writeDataValue(*static_cast<const UA_DataValue*>(src));
+            break;
+        case UA_DATATYPEKIND_VARIANT:
+            writeVariant(*static_cast<const UA_Variant*>(src));
+            break;
+        case UA_DATATYPEKIND_DIAGNOSTICINFO:
+            writeDiagnosticInfo(*static_cast<const UA_DiagnosticInfo*>(src));
+            break;
+        case UA_DATATYPEKIND_STRUCTURE:
+#if UAPP_OPEN62541_VER_GE(1, 1)
+        case UA_DATATYPEKIND_OPTSTRUCT:
+#endif
+            writeStructure(src, type);
+            break;
+#if UAPP_OPEN62541_VER_GE(1, 1)
+        case UA_DATATYPEKIND_UNION:
+            writeUnion(src, type);
+            break;
+#endif
+        default:
+            throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+        }
+    }
+
+private:
+    class DepthGuard {
+    public:
+        explicit DepthGuard(size_t& depth)
+            : depth_(depth) {
+            if (++depth_ > maxDepth) {
+                --depth_;
+                throw BadStatus(UA_STATUSCODE_BADENCODINGLIMITSEXCEEDED);
+            }
+        }
+
+        ~DepthGuard() {
+            --depth_;
+        }
+
+        DepthGuard(const DepthGuard&) = delete;
+        DepthGuard(DepthGuard&&) = delete;
+        DepthGuard& operator=(const DepthGuard&) = delete;
+        DepthGuard& operator=(DepthGuard&&) = delete;
+
+    private:
+        size_t& depth_;
+    };
+
+    /// Write the output of a formatter with a maximum length, formatted into a scratch buffer.
+    /// The exact length is written, so values fit into fixed buffers without the worst case width.
+    template <size_t MaxLength, typename Format>
+    void writeFormatted(Format&& format) {
+        char scratch[MaxLength];  // NOLINT(*-avoid-c-arrays)
+        const char* end = format(scratch, scratch + MaxLength);  // NOLINT(*-pointer-arithmetic)
+        buffer_.write({scratch, static_cast<size_t>(end - scratch)});
+    }
+
+    template <typename T>
+    void writeInteger(T value) {
+        constexpr size_t maxLength = std::numeric_limits<T>::digits10 + 3;
+        writeFormatted<maxLength>([&](char* first, char* last) {
+            return std::to_chars(first, last, value).ptr;
+        });
+    }
+
+    template <typename T>
+    void writeFloating(T value) {
+        if (std::isnan(value)) {
+            buffer_.write("\"NaN\"");
+            return;
+        }
+        if (std::isinf(value)) {
+            buffer_.write(value > 0 ? "\"Infinity\"" : "\"-Infinity\"");
+            return;
+        }
+        constexpr size_t maxLength = 32;
+        writeFormatted<maxLength>([&](char* first, [[maybe_unused]] char* last) {
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+            // shortest representation that round-trips
+            return std::to_chars(first, last, value).ptr;
+#else
+            const int length = std::snprintf(  // NOLINT
+                first,
+                maxLength,
+                "%.*g",
+                std::numeric_limits<T>::max_digits10,
+                static_cast<double>(value)
+            );
+            return first + length;  // NOLINT(*-pointer-arithmetic)
+#endif
+        });
+    }
+
+    /// Write string content with escaping, runs of unescaped characters are copied at once.
+    void writeEscaped(std::string_view str) {
+        size_t begin = 0;
+        for (size_t i = 0; i < str.size(); ++i) {
+            const auto c = static_cast<unsigned char>(str[i]);
+            if (c >= 0x20 && c != '"' && c != '\\') {
+                continue;
+            }
+            buffer_.write(str.substr(begin, i - begin));
+            begin = i + 1;
+            switch (c) {
+            case '"':
+                buffer_.write("\\\"");
+                break;
+            case '\\':
+                buffer_.write("\\\\");
+                break;
+            case '\b':
+                buffer_.write("\\b");
+                break;
+            case '\f':
+                buffer_.write("\\f");
+                break;
+            case '\n':
+                buffer_.write("\\n");
+                break;
+            case '\r':
+                buffer_.write("\\r");
+                break;
+            case '\t':
+                buffer_.write("\\t");
+                break;
+            default: {
+                const char escaped[] = {'\\', 'u', '0', '0', hexDigits[c >> 4], hexDigits[c & 0xF]};
+                buffer_.write({escaped, sizeof(escaped)});  // NOLINT(*-array-to-pointer-decay)
+            }
+            }
+        }
+        buffer_.write(str.substr(begin));
+    }
+
+    void writeQuoted(std::string_view str) {
+        buffer_.put('"');
+        writeEscaped(str);
+        buffer_.put('"');
+    }
+
+    void writeKey(std::string_view name, bool& first) {
+        if (!first) {
+            buffer_.put(',');
+        }
+        first = false;
+        writeQuoted(name);
+        buffer_.put(':');
+    }
+
+    void writeBase64(const UA_ByteString& bs) {
+        char* out = buffer_.reserve((bs.length + 2) / 3 * 4);
+        size_t i = 0;
+        // NOLINTBEGIN(*-pointer-arithmetic)
+        for (; i + 2 < bs.length; i += 3) {
+            const uint32_t triple = (uint32_t{bs.data[i]} << 16U) |
+                                    (uint32_t{bs.data[i + 1]} << 8U) | uint32_t{bs.data[i + 2]};
+            *out++ = base64Digits[(triple >> 18U) & 0x3FU];
+            *out++ = base64Digits[(triple >> 12U) & 0x3FU];
+            *out++ = base64Digits[(triple >> 6U) & 0x3FU];
+            *out++ = base64Digits[triple & 0x3FU];
+        }
+        if (i < bs.length) {
+            const bool two = i + 1 < bs.length;
+            const uint32_t triple = (uint32_t{bs.data[i]} << 16U) |
+                                    (two ? uint32_t{bs.data[i + 1]} << 8U : 0U);
+            *out++ = base64Digits[(triple >> 18U) & 0x3FU];
+            *out++ = base64Digits[(triple >> 12U) & 0x3FU];
+            *out++ = two ? base64Digits[(triple >> 6U) & 0x3FU] : '=';
+            *out++ = '=';
+        }
+        // NOLINTEND(*-pointer-arithmetic)
+        buffer_.commit(out);
+    }
+
+    /// Write fixed-width, zero-padded decimal number.
+    static char* writeDigits(char* out, uint32_t value, size_t width) noexcept {
+        for (size_t i = width; i > 0; --i) {
+            out[i - 1] = static_cast<char>('0' + value % 10);  // NOLINT(*-pointer-arithmetic)
+            value /= 10;
+        }
+        return out + width;  // NOLINT(*-pointer-arithmetic)
+    }
+
+    /// Write fixed-width, uppercase hexadecimal number.
+    void writeHex(uint32_t value, size_t width) {
+        char* out = buffer_.reserve(width);
+        for (size_t i = width; i > 0; --i) {
+            out[i - 1] = hexDigits[value & 0xFU];  // NOLINT(*-pointer-arithmetic)
+            value >>= 4U;
+        }
+        buffer_.commit(out + width);  // NOLINT(*-pointer-arithmetic)
+    }
+
+    void writeString(const UA_String& str) {
+        if (str.data == nullptr) {
+            buffer_.write("null");
+        } else {
+            writeQuoted(detail::toStringView(str));
+        }
+    }
+
+    void writeByteString(const UA_ByteString& bs) {
+        if (bs.data == nullptr) {
+            buffer_.write("null");
+        } else {
+            buffer_.put('"');
+            writeBase64(bs);
+            buffer_.put('"');
+        }
+    }
+
+    /// ISO 8601 format with up to 7 fractional digits, clamped to the years 0001 to 9999.
+    void writeDateTime(UA_DateTime dt) {
+        if (dt <= 0) {
+            buffer_.write("\"0001-01-01T00:00:00Z\"");
+            return;
+        }
+        const UA_DateTimeStruct dts = UA_DateTime_toStruct(dt);
+        if (dts.year > 9999) {
+            buffer_.write("\"9999-12-31T23:59:59Z\"");
+            return;
+        }
+        writeFormatted<30>([&](char* out, char* /* last */) {
+            return formatDateTime(out, dt, dts);
+        });
+    }
+
+    static char* formatDateTime(char* out, UA_DateTime dt, const UA_DateTimeStruct& dts) noexcept {
+        // NOLINTBEGIN(*-pointer-arithmetic)
+        *out++ = '"';
+        out = writeDigits(out, static_cast<uint32_t>(dts.year), 4);
+        *out++ = '-';
+        out = writeDigits(out, dts.month, 2);
+        *out++ = '-';
+        out = writeDigits(out, dts.day, 2);
+        *out++ = 'T';
+        out = writeDigits(out, dts.hour, 2);
+        *out++ = ':';
+        out = writeDigits(out, dts.min, 2);
+        *out++ = ':';
+        out = writeDigits(out, dts.sec, 2);
+        auto fraction = static_cast<uint32_t>(dt % UA_DATETIME_SEC);  // 100 ns ticks
+        if (fraction > 0) {
+            size_t width = 7;
+            while (fraction % 10 == 0) {
+                fraction /= 10;
+                --width;
+            }
+            *out++ = '.';
+            out = writeDigits(out, fraction, width);
+        }
+        *out++ = 'Z';
+        *out++ = '"';
+        // NOLINTEND(*-pointer-arithmetic)
+        return out;
+    }
+
+    void writeGuid(const UA_Guid& guid) {
+        writeHex(guid.data1, 8);
+        buffer_.put('-');
+        writeHex(guid.data2, 4);
+        buffer_.put('-');
+        writeHex(guid.data3, 4);
+        buffer_.put('-');
+        for (size_t i = 0; i < 8; ++i) {
+            if (i == 2) {
+                buffer_.put('-');
+            }
+            writeHex(guid.data4[i], 2);  // NOLINT(*-constant-array-index)
+        }
+    }
+
+    /// Write NodeId in its string format, e.g. `ns=1;s=Name` (without quotes).
+    void writeNodeId(const UA_NodeId& id, bool withNamespace) {
+        if (withNamespace && id.namespaceIndex != 0) {
+            buffer_.write("ns=");
+            writeInteger(id.namespaceIndex);
+            buffer_.put(';');
+        }
+        switch (id.identifierType) {
+        case UA_NODEIDTYPE_NUMERIC:
+            buffer_.write("i=");
+            writeInteger(id.identifier.numeric);
+            break;
+        case UA_NODEIDTYPE_STRING:
+            buffer_.write("s=");
+            writeEscaped(detail::toStringView(id.identifier.string));
+            break;
+        case UA_NODEIDTYPE_GUID:
+            buffer_.write("g=");
+            writeGuid(id.identifier.guid);
+            break;
+        case UA_NODEIDTYPE_BYTESTRING:
+            buffer_.write("b=");
+            writeBase64(id.identifier.byteString);
+            break;
+        default:
+            throw BadStatus(UA_STATUSCODE_BADENCODINGERROR);
+        }
+    }
+
+    void writeExpandedNodeId(const UA_ExpandedNodeId& id) {
+        buffer_.put('"');
+        if (id.serverIndex != 0) {
+            buffer_.write("svr=");
+            writeInteger(id.serverIndex);
+            buffer_.put(';');
+        }
+        const bool hasUri = !detail::isEmpty(id.namespaceUri);
+        if (hasUri) {
+            buffer_.write("nsu=");
+            writeEscaped(detail::toStringView(id.namespaceUri));
+            buffer_.put(';');
+        }
+        writeNodeId(id.nodeId, !hasUri);
+        buffer_.put('"');
+    }
+
+    void writeStatusCode(UA_StatusCode code) {
+        if (options_.reversible) {
+            writeInteger(code);
+            return;
+        }
+        buffer_.write("{\"Code\":");
+        writeInteger(code);
+        buffer_.write(",\"Symbol\":");
+        writeQuoted(UA_StatusCode_name(code));
+        buffer_.put('}');
+    }
+
+    void writeQualifiedName(const UA_QualifiedName& qn) {
+        bool first = true;
+        buffer_.put('{');
+        writeKey("Name", first);
+        writeString(qn.name);
+        if (qn.namespaceIndex != 0) {
+            writeKey("Uri", first);
+            writeInteger(qn.namespaceIndex);
+        }
+        buffer_.put('}');
+    }
+
+    void writeLocalizedText(const UA_LocalizedText& lt) {
+        if (!options_.reversible) {
+            writeString(lt.text);
+            return;
+        }
+        bool first = true;
+        buffer_.put('{');
+        if (!detail::isEmpty(lt.locale)) {
+            writeKey("Locale", first);
+            writeString(lt.locale);
+        }
+        writeKey("Text", first);
+        writeString(lt.text);
+        buffer_.put('}');
+    }
+
+    void writeExtensionObject(const UA_ExtensionObject& eo) {
+        if (eo.encoding >= UA_EXTENSIONOBJECT_DECODED) {
+            const UA_DataType* type = eo.content.decoded.type;
+            if (type == nullptr) {
+                throw BadStatus(UA_STATUSCODE_BADENCODINGERROR);
+            }
+            writeTypedBody(eo.content.decoded.data, *type);
+            return;
+        }
+        bool first = true;
+        buffer_.put('{');
+        writeKey("TypeId", first);
+        buffer_.put('"');
+        writeNodeId(eo.content.encoded.typeId, true);
+        buffer_.put('"');
+        if (eo.encoding == UA_EXTENSIONOBJECT_ENCODED_BYTESTRING) {
+            writeKey("Encoding", first);
+            buffer_.put('1');
+            writeKey("Body", first);
+            writeByteString(eo.content.encoded.body);
+        } else if (eo.encoding == UA_EXTENSIONOBJECT_ENCODED_XML) {
+            writeKey("Encoding", first);
+            buffer_.put('2');
+            writeKey("Body", first);
+            writeString(eo.content.encoded.body);
+        }
+        buffer_.put('}');
+    }
+
+    /// Write a structure as extension object body, with its TypeId in the reversible form.
+    void writeTypedBody(const void* src, const UA_DataType& type) {
+        if (!options_.reversible) {
+            encode(src, type);
+            return;
+        }
+        bool first = true;
+        buffer_.put('{');
+        writeKey("TypeId", first);
+        buffer_.put('"');
+        writeNodeId(type.typeId, true);
+        buffer_.put('"');
+        writeKey("Body", first);
+        encode(src, type);
+        buffer_.put('}');
+    }
+
+    void writeDataValue(const UA_DataValue& dv) {
+        bool first = true;
+        buffer_.put('{');
+        if (dv.hasValue) {
+            writeKey("Value", first);
+            writeVariant(dv.value);
+        }
+        if (dv.hasStatus) {
+            writeKey("Status", first);
+            writeStatusCode(dv.status);
+        }
+        if (dv.hasSourceTimestamp) {
+            writeKey("SourceTimestamp", first);
+            writeDateTime(dv.sourceTimestamp);
+        }
+        if (dv.hasSourcePicoseconds) {
+            writeKey("SourcePicoseconds", first);
+            writeInteger(dv.sourcePicoseconds);
+        }
+        if (dv.hasServerTimestamp) {
+            writeKey("ServerTimestamp", first);
+            writeDateTime(dv.serverTimestamp);
+        }
+        if (dv.hasServerPicoseconds) {
+            writeKey("ServerPicoseconds", first);
+            writeInteger(dv.serverPicoseconds);
+        }
+        buffer_.put('}');
+    }
+
+    static bool isBuiltin(const UA_DataType& type) noexcept {
+        return type.typeKind <= UA_DATATYPEKIND_DIAGNOSTICINFO ||
+               type.typeKind == UA_DATATYPEKIND_ENUM;
+    }
+
+    void writeVariantElement(const void* src, const UA_DataType& type) {
+        if (isBuiltin(type)) {
+            encode(src, type);
+        } else {
+            writeTypedBody(src, type);  // structures are encoded as extension objects
+        }
+    }
+
+    void writeVariantBody(const UA_Variant& var) {
+        const UA_DataType& type = *var.type;
+        if (UA_Variant_isScalar(&var)) {
+            writeVariantElement(var.data, type);
+            return;
+        }
+        const auto* ptr = static_cast<const std::byte*>(var.data);
+        buffer_.put('[');
+        for (size_t i = 0; i < var.arrayLength; ++i) {
+            if (i > 0) {
+                buffer_.put(',');
+            }
+            writeVariantElement(ptr, type);
+            ptr += type.memSize;  // NOLINT(*-pointer-arithmetic)
+        }
+        buffer_.put(']');
+    }
+
+    void writeVariant(const UA_Variant& var) {
+        const DepthGuard guard(depth_);
+        if (var.type == nullptr) {
+            buffer_.write("null");
+            return;
+        }
+        if (!options_.reversible) {
+            writeVariantBody(var);
+            return;
+        }
+        bool first = true;
+        buffer_.put('{');
+        writeKey("Type", first);
+        if (isBuiltin(*var.type)) {
+            // type kinds of builtin types are their builtin type ids - 1
+            writeInteger(
+                var.type->typeKind == UA_DATATYPEKIND_ENUM ? UA_DATATYPEKIND_INT32 + 1
+                                                           : var.type->typeKind + 1
+            );
+        } else {
+            writeInteger(UA_DATATYPEKIND_EXTENSIONOBJECT + 1);
+        }
+        writeKey("Body", first);
+        writeVariantBody(var);
+        if (var.arrayDimensionsSize > 1) {
+            writeKey("Dimension", first);
+            buffer_.put('[');
+            for (size_t i = 0; i < var.arrayDimensionsSize; ++i) {
+                if (i > 0) {
+                    buffer_.put(',');
+                }
+                writeInteger(var.arrayDimensions[i]);  // NOLINT(*-pointer-arithmetic)
+            }
+            buffer_.put(']');
+        }
+        buffer_.put('}');
+    }
+
+    void writeDiagnosticInfo(const UA_DiagnosticInfo& di) {
+        bool first = true;
+        buffer_.put('{');
+        if (di.hasSymbolicId) {
+            writeKey("SymbolicId", first);
+            writeInteger(di.symbolicId);
+        }
+        if (di.hasNamespaceUri) {
+            writeKey("NamespaceUri", first);
+            writeInteger(di.namespaceUri);
+        }
+        if (di.hasLocalizedText) {
+            writeKey("LocalizedText", first);
+            writeInteger(di.localizedText);
+        }
+        if (di.hasLocale) {
+            writeKey("Locale", first);
+            writeInteger(di.locale);
+        }
+        if (di.hasAdditionalInfo) {
+            writeKey("AdditionalInfo", first);
+            writeString(di.additionalInfo);
+        }
+        if (di.hasInnerStatusCode) {
+            writeKey("InnerStatusCode", first);
+            writeStatusCode(di.innerStatusCode);
+        }
+        if (di.hasInnerDiagnosticInfo && di.innerDiagnosticInfo != nullptr) {
+            writeKey("InnerDiagnosticInfo", first);
+            encode(di.innerDiagnosticInfo, UA_TYPES[UA_TYPES_DIAGNOSTICINFO]);
+        }
+        buffer_.put('}');
+    }
+
+    void writeArray(const void* data, size_t size, const UA_DataType& type) {
+        const auto* ptr = static_cast<const std::byte*>(data);
+        buffer_.put('[');
+        for (size_t i = 0; i < size; ++i) {
+            if (i > 0) {
+                buffer_.put(',');
+            }
+            encode(ptr, type);
+            ptr += type.memSize;  // NOLINT(*-pointer-arithmetic)
+        }
+        buffer_.put(']');
+    }
+
+    static const UA_DataType& getMemberTypeOrThrow(const UA_DataTypeMember& member) {
+        const UA_DataType* type = getMemberType(member);
+        if (type == nullptr) {
+            throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+        }
+        return *type;
+    }
+
+    /// Structures are encoded as objects, absent optional fields are omitted.
+    void writeStructure(const void* src, const UA_DataType& type) {
+        const auto* ptr = static_cast<const std::byte*>(src);
+        bool first = true;
+        buffer_.put('{');
+        // NOLINTBEGIN(*-pointer-arithmetic)
+        for (size_t i = 0; i < type.membersSize; ++i) {
+            const auto& member = type.members[i];
+            const auto& memberType = getMemberTypeOrThrow(member);
+            ptr += member.padding;
+            if (member.isArray) {
+                const auto size = load<size_t>(ptr);
+                const auto* data = load<const void*>(ptr + sizeof(size_t));
+                ptr += sizeof(size_t) + sizeof(void*);
+                if (isOptional(member) && data == nullptr) {
+                    continue;
+                }
+                writeKey(getMemberName(member), first);
+                writeArray(data, size, memberType);
+            } else if (isOptional(member)) {
+                const auto* data = load<const void*>(ptr);
+                ptr += sizeof(void*);
+                if (data == nullptr) {
+                    continue;
+                }
+                writeKey(getMemberName(member), first);
+                encode(data, memberType);
+            } else {
+                writeKey(getMemberName(member), first);
+                encode(ptr, memberType);
+                ptr += memberType.memSize;
+            }
+        }
+        // NOLINTEND(*-pointer-arithmetic)
+        buffer_.put('}');
+    }
+
+    /// Unions are encoded with their switch field in the reversible form, empty unions as null.
+    void writeUnion(const void* src, const UA_DataType& type) {
+        const auto selection = *static_cast<const UA_UInt32*>(src);
+        if (selection == 0) {
+            buffer_.write("null");
+            return;
+        }
+        if (selection > type.membersSize) {
+            throw BadStatus(UA_STATUSCODE_BADENCODINGERROR);
+        }
+        const auto& member = type.members[selection - 1];  // NOLINT(*-pointer-arithmetic)
+        const auto& memberType = getMemberTypeOrThrow(member);
+        const auto* ptr = static_cast<const std::byte*>(src) + member.padding;  // NOLINT
+        bool first = true;
+        if (options_.reversible) {
+            buffer_.put('{');
+            writeKey("SwitchField", first);
+            writeInteger(selection);
+            writeKey("Value", first);
+        }
+        if (member.isArray) {
+            writeArray(load<const void*>(ptr + sizeof(size_t)), load<size_t>(ptr), memberType);
+        } else {
+            encode(ptr, memberType);
+        }
+        if (options_.reversible) {
+            buffer_.put('}');
+        }
+    }
+
+    JsonBuffer& buffer_;
+    const JsonEncodingOptions& options_;
+    size_t depth_{0};
+};
+
+}  // namespace
+
+/* ----------------------------------------- Internals ------------------------------------------ */
+
+namespace detail {
+
+std::string encodeJson(
+    const void* src, const UA_DataType& type, const JsonEncodingOptions& options
+) {
+    std::string result;
+    JsonBuffer buffer(result, 0);
+    JsonWriter(buffer, options).encode(src, type);
+    result.resize(buffer.size());
+    return result;
+}
+
+Span<char> encodeJson(
+    const void* src, const UA_DataType& type, Span<char> buffer, const JsonEncodingOptions& options
+) {
+    JsonBuffer output(buffer);
+    JsonWriter(output, options).encode(src, type);
+    return buffer.first(output.size());
+}
+
+}  // namespace detail
+
+/* ---------------------------------------- JsonEncoder ----------------------------------------- */
+
+JsonEncoder::JsonEncoder(JsonEncodingOptions options, size_t capacity)
+    : options_(options),
+      buffer_(capacity, '\0') {}
+
+void JsonEncoder::reserve(size_t capacity) {
+    if (capacity > buffer_.size()) {
+        buffer_.resize(capacity);
+    }
+}
+
+void JsonEncoder::appendImpl(const void* src, const UA_DataType& type) {
+    // size is only updated on success, a failed encoding leaves the previous objects intact
+    JsonBuffer buffer(buffer_, size_);
+    JsonWriter(buffer, options_).encode(src, type);
+    buffer.put('\n');
+    size_ = buffer.size();
+}
+
+}  // namespace opcua
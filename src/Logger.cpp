@@ -1,6 +1,7 @@
 #include "open62541pp/Logger.h"
 
 #include <cstdarg>  // va_list
+#include <cstdio>
 #include <string>
 
 #include "open62541pp/Client.h"
@@ -10,6 +11,24 @@
 
 namespace opcua {
 
+int LogRecord::formatTo(char* buffer, size_t size) const noexcept {
+    va_list args{};  // NOLINT
+    copyArgs(args);
+    const int length = std::vsnprintf(buffer, size, format_, args);  // NOLINT
+    va_end(args);  // NOLINT
+    return length;
+}
+
+std::string LogRecord::format() const {
+    const int length = formatTo(nullptr, 0);
+    if (length <= 0) {
+        return {};
+    }
+    std::string result(length, ' ');
+    formatTo(result.data(), result.size() + 1);
+    return result;
+}
+
 inline static const UA_Logger& getLogger(UA_Client& client) {
     return UA_Client_getConfig(&client)->logger;
 }
@@ -30,6 +49,9 @@ template <typename T>
 inline static void logImpl(
     T& serverOrClient, LogLevel level, LogCategory category, std::string_view msg
 ) {
+    if (level < logLevelMin) {
+        return;
+    }
     const auto& logger = getLogger(serverOrClient);
     if (logger.log == nullptr) {
         return;
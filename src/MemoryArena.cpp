@@ -0,0 +1,158 @@
+#include "open62541pp/MemoryArena.h"
+
+#include <algorithm>  // max, min
+#include <cstring>  // memcpy, memset
+#include <limits>
+#include <new>  // bad_alloc
+
+namespace opcua {
+
+/* ----------------------------------------- MemoryArena ---------------------------------------- */
+
+// each block is prefixed with its size to support reallocate
+static constexpr size_t blockHeaderSize = alignof(std::max_align_t);
+
+static constexpr size_t alignUp(size_t size) noexcept {
+    constexpr size_t alignment = alignof(std::max_align_t);
+    return (size + alignment - 1) & ~(alignment - 1);
+}
+
+static size_t getBlockSize(const void* ptr) noexcept {
+    size_t size{};
+    std::memcpy(&size, static_cast<const std::byte*>(ptr) - blockHeaderSize, sizeof(size));
+    return size;
+}
+
+MemoryArena::MemoryArena(size_t chunkSize)
+    : chunkSize_(alignUp(std::max(chunkSize, blockHeaderSize))) {}
+
+MemoryArena::Chunk& MemoryArena::chunkFor(size_t size) {
+    if (!chunks_.empty()) {
+        auto& chunk = chunks_.back();
+        if (chunk.size - chunk.used >= size) {
+            return chunk;
+        }
+    }
+    const size_t newSize = std::max(size, chunkSize_);
+    chunks_.push_back({std::make_unique<std::byte[]>(newSize), newSize, 0});  // NOLINT
+    return chunks_.back();
+}
+
+void* MemoryArena::allocate(size_t size) {
+    const size_t blockSize = blockHeaderSize + alignUp(size);
+    auto& chunk = chunkFor(blockSize);
+    std::byte* block = chunk.data.get() + chunk.used;  // NOLINT
+    std::memcpy(block, &size, sizeof(size));
+    chunk.used += blockSize;
+    bytesAllocated_ += size;
+    return block + blockHeaderSize;  // NOLINT
+}
+
+void* MemoryArena::reallocate(void* ptr, size_t size) {
+    void* result = allocate(size);
+    if (ptr != nullptr) {
+        std::memcpy(result, ptr, std::min(size, getBlockSize(ptr)));
+    }
+    return result;
+}
+
+bool MemoryArena::owns(const void* ptr) const noexcept {
+    const auto* p = static_cast<const std::byte*>(ptr);
+    return std::any_of(chunks_.begin(), chunks_.end(), [&](const Chunk& chunk) {
+        return p >= chunk.data.get() && p < chunk.data.get() + chunk.used;  // NOLINT
+    });
+}
+
+void MemoryArena::release() noexcept {
+    if (!chunks_.empty()) {
+        chunks_.erase(chunks_.begin() + 1, chunks_.end());
+        chunks_.front().used = 0;
+    }
+    bytesAllocated_ = 0;
+}
+
+/* -------------------------------------- MemoryArenaScope -------------------------------------- */
+
+#ifdef UA_ENABLE_MALLOC_SINGLETON
+
+static thread_local MemoryArenaScope* currentScope = nullptr;  // NOLINT
+
+MemoryArenaScope::MemoryArenaScope(MemoryArena& arena) noexcept
+    : arena_(arena),
+      previousScope_(currentScope),
+      previousMalloc_(UA_mallocSingleton),
+      previousFree_(UA_freeSingleton),
+      previousCalloc_(UA_callocSingleton),
+      previousRealloc_(UA_reallocSingleton) {
+    currentScope = this;
+    UA_mallocSingleton = mallocImpl;
+    UA_freeSingleton = freeImpl;
+    UA_callocSingleton = callocImpl;
+    UA_reallocSingleton = reallocImpl;
+}
+
+MemoryArenaScope::~MemoryArenaScope() {
+    UA_mallocSingleton = previousMalloc_;
+    UA_freeSingleton = previousFree_;
+    UA_callocSingleton = previousCalloc_;
+    UA_reallocSingleton = previousRealloc_;
+    currentScope = previousScope_;
+}
+
+const MemoryArenaScope* MemoryArenaScope::findOwner(const void* ptr) noexcept {
+    for (const auto* scope = currentScope; scope != nullptr; scope = scope->previousScope_) {
+        if (scope->arena_.owns(ptr)) {
+            return scope;
+        }
+    }
+    return nullptr;
+}
+
+const MemoryArenaScope& MemoryArenaScope::outermost() noexcept {
+    const auto* scope = currentScope;
+    while (scope->previousScope_ != nullptr) {
+        scope = scope->previousScope_;
+    }
+    return *scope;
+}
+
+void* MemoryArenaScope::mallocImpl(size_t size) noexcept {
+    try {
+        return currentScope->arena_.allocate(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void MemoryArenaScope::freeImpl(void* ptr) noexcept {
+    if (ptr == nullptr || findOwner(ptr) != nullptr) {
+        return;  // released by the arena
+    }
+    outermost().previousFree_(ptr);
+}
+
+void* MemoryArenaScope::callocImpl(size_t count, size_t size) noexcept {
+    if (size != 0 && count > std::numeric_limits<size_t>::max() / size) {
+        return nullptr;  // overflow
+    }
+    void* ptr = mallocImpl(count * size);
+    if (ptr != nullptr) {
+        std::memset(ptr, 0, count * size);
+    }
+    return ptr;
+}
+
+void* MemoryArenaScope::reallocImpl(void* ptr, size_t size) noexcept {
+    if (ptr != nullptr && findOwner(ptr) == nullptr) {
+        return outermost().previousRealloc_(ptr, size);
+    }
+    try {
+        return currentScope->arena_.reallocate(ptr, size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+#endif
+
+}  // namespace opcua
@@ -0,0 +1,160 @@
+#include "open62541pp/MemoryStatistics.h"
+
+#include <algorithm>  // max
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "open62541pp/Client.h"
+#include "open62541pp/Config.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/detail/ClientContext.h"
+#include "open62541pp/detail/MemoryAccounting.h"
+#include "open62541pp/detail/ServerContext.h"
+#include "open62541pp/open62541.h"
+
+namespace opcua {
+
+std::string_view getMemoryCategoryName(MemoryCategory category) noexcept {
+    switch (category) {
+    case MemoryCategory::NativeAllocation:
+        return "NativeAllocation";
+    case MemoryCategory::NativeCopy:
+        return "NativeCopy";
+    case MemoryCategory::NodeContext:
+        return "NodeContext";
+    case MemoryCategory::SubscriptionContext:
+        return "SubscriptionContext";
+    case MemoryCategory::MonitoredItemContext:
+        return "MonitoredItemContext";
+    }
+    return "Unknown";
+}
+
+/* ----------------------------------------- Recording ------------------------------------------ */
+
+namespace detail {
+
+namespace {
+
+struct NativeCounters {
+    std::atomic<uint64_t> allocations{0};
+    std::atomic<uint64_t> bytes{0};
+};
+
+// number of enabled switches of all servers and clients, skip the recording if zero
+std::atomic<size_t> enabledSwitches{0};
+
+// native categories: NativeAllocation, NativeCopy
+std::array<NativeCounters, 2> nativeCounters{};
+
+NativeCounters* getNativeCounters(MemoryCategory category) noexcept {
+    const auto index = static_cast<size_t>(category);
+    return index < nativeCounters.size() ? &nativeCounters[index] : nullptr;
+}
+
+}  // namespace
+
+bool isMemoryAccountingActive() noexcept {
+    return enabledSwitches.load(std::memory_order_relaxed) > 0;
+}
+
+void recordNativeAllocation(MemoryCategory category, size_t bytes) noexcept {
+    if (auto* counters = getNativeCounters(category)) {
+        counters->allocations.fetch_add(1, std::memory_order_relaxed);
+        counters->bytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+}
+
+void recordNativeCopy(const void* data, size_t size, const UA_DataType& type) noexcept {
+    // scalars are copied by value, only the members are allocated
+    size_t bytes = size * type.memSize;
+    if (!type.pointerFree) {
+        const auto* it = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < std::max<size_t>(size, 1); ++i, it += type.memSize) {
+            bytes += UA_calcSizeBinary(it, &type);
+        }
+    }
+    recordNativeAllocation(MemoryCategory::NativeCopy, bytes);
+}
+
+MemoryCategoryStatistics getNativeMemoryStatistics(MemoryCategory category) noexcept {
+    MemoryCategoryStatistics result;
+    result.category = category;
+    if (const auto* counters = getNativeCounters(category)) {
+        result.allocations = counters->allocations.load(std::memory_order_relaxed);
+        result.allocatedBytes = counters->bytes.load(std::memory_order_relaxed);
+    }
+    return result;
+}
+
+void MemoryAccountingSwitch::setEnabled(bool enabled) noexcept {
+    if (enabled_.exchange(enabled, std::memory_order_relaxed) == enabled) {
+        return;
+    }
+    if (enabled) {
+        enabledSwitches.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        enabledSwitches.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+}  // namespace detail
+
+/* ---------------------------------------- Server/Client --------------------------------------- */
+
+static void addNativeMemoryStatistics(MemoryStatistics& statistics) {
+    statistics.categories.push_back(
+        detail::getNativeMemoryStatistics(MemoryCategory::NativeAllocation)
+    );
+    statistics.categories.push_back(detail::getNativeMemoryStatistics(MemoryCategory::NativeCopy));
+}
+
+void Server::setMemoryAccountingEnabled(bool enabled) {
+    detail::getContext(*this).memoryAccounting.setEnabled(enabled);
+}
+
+bool Server::isMemoryAccountingEnabled() {
+    return detail::getContext(*this).memoryAccounting.isEnabled();
+}
+
+MemoryStatistics Server::getMemoryStatistics() {
+    auto& context = detail::getContext(*this);
+    MemoryStatistics statistics;
+    addNativeMemoryStatistics(statistics);
+    statistics.categories.push_back(context.nodeContexts.getMemoryCounter().snapshot(
+        MemoryCategory::NodeContext, sizeof(detail::NodeContext)
+    ));
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+    statistics.categories.push_back(context.monitoredItems.getMemoryCounter().snapshot(
+        MemoryCategory::MonitoredItemContext, sizeof(services::detail::MonitoredItemContext)
+    ));
+#endif
+    return statistics;
+}
+
+void Client::setMemoryAccountingEnabled(bool enabled) {
+    detail::getContext(*this).memoryAccounting.setEnabled(enabled);
+}
+
+bool Client::isMemoryAccountingEnabled() {
+    return detail::getContext(*this).memoryAccounting.isEnabled();
+}
+
+MemoryStatistics Client::getMemoryStatistics() {
+    [[maybe_unused]] auto& context = detail::getContext(*this);
+    MemoryStatistics statistics;
+    addNativeMemoryStatistics(statistics);
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+    statistics.categories.push_back(context.subscriptions.getMemoryCounter().snapshot(
+        MemoryCategory::SubscriptionContext, sizeof(services::detail::SubscriptionContext)
+    ));
+    statistics.categories.push_back(context.monitoredItems.getMemoryCounter().snapshot(
+        MemoryCategory::MonitoredItemContext, sizeof(services::detail::MonitoredItemContext)
+    ));
+#endif
+    return statistics;
+}
+
+}  // namespace opcua
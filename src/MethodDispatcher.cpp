@@ -0,0 +1,181 @@
+#include "open62541pp/MethodDispatcher.h"
+
+#ifdef UAPP_HAS_ASYNC_OPERATIONS
+
+#include <utility>  // move
+
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/open62541.h"
+
+namespace opcua {
+
+// the notify callback only receives the native server, map it back to the dispatcher
+static std::mutex registryMutex;  // NOLINT
+static std::unordered_map<UA_Server*, MethodDispatcher*> registry;  // NOLINT
+
+static void setResult(UA_Server* server, UA_CallMethodResult&& result, void* context) noexcept {
+    UA_AsyncOperationResponse response{};
+    response.callMethodResult = result;
+    UA_Server_setAsyncOperationResult(server, &response, context);  // copies the result
+    UA_CallMethodResult_clear(&result);
+}
+
+MethodDispatcher::MethodDispatcher(Server& server, size_t threadCount)
+    : server_(server) {
+    {
+        std::lock_guard lock(registryMutex);
+        if (!registry.emplace(server.handle(), this).second) {
+            throw BadStatus(UA_STATUSCODE_BADINVALIDSTATE);
+        }
+    }
+    UA_Server_getConfig(server.handle())->asyncOperationNotifyCallback = notify;
+    notifications_ = threadCount;  // fetch operations queued before the dispatcher was created
+    threads_.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; ++i) {
+        threads_.emplace_back([this] { work(); });
+    }
+}
+
+MethodDispatcher::~MethodDispatcher() {
+    {
+        std::lock_guard lock(registryMutex);
+        registry.erase(server_.handle());
+    }
+    UA_Server_getConfig(server_.handle())->asyncOperationNotifyCallback = nullptr;
+    {
+        std::lock_guard lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    for (auto& thread : threads_) {
+        thread.join();
+    }
+    for (auto& [id, method] : methods_) {
+        UA_Server_setMethodNodeAsync(server_.handle(), id, false);
+        for (auto& call : method.deferred) {
+            UA_CallMethodResult result;
+            UA_CallMethodResult_init(&result);
+            result.statusCode = UA_STATUSCODE_BADSHUTDOWN;
+            setResult(server_.handle(), std::move(result), call.context);
+        }
+    }
+}
+
+void MethodDispatcher::dispatch(const NodeId& methodId, size_t maxConcurrency) {
+    {
+        std::lock_guard lock(mutex_);
+        methods_[methodId].maxConcurrency = maxConcurrency;
+    }
+    throwIfBad(UA_Server_setMethodNodeAsync(server_.handle(), methodId, true));
+}
+
+size_t MethodDispatcher::getDeferredCount() const {
+    std::lock_guard lock(mutex_);
+    size_t count = 0;
+    for (const auto& [id, method] : methods_) {
+        count += method.deferred.size();
+    }
+    return count;
+}
+
+void MethodDispatcher::notify(UA_Server* server) noexcept {
+    std::lock_guard registryLock(registryMutex);
+    const auto it = registry.find(server);
+    if (it == registry.end()) {
+        return;
+    }
+    auto& dispatcher = *it->second;
+    {
+        std::lock_guard lock(dispatcher.mutex_);
+        ++dispatcher.notifications_;
+    }
+    dispatcher.cv_.notify_one();
+}
+
+bool MethodDispatcher::takeDeferred(Call& call) {
+    for (auto& [id, method] : methods_) {
+        if (!method.deferred.empty() &&
+            (method.maxConcurrency == 0 || method.running < method.maxConcurrency)) {
+            call = std::move(method.deferred.front());
+            method.deferred.pop_front();
+            ++method.running;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool MethodDispatcher::acquire(Call& call) {
+    const auto it = methods_.find(call.request.getMethodId());
+    if (it == methods_.end()) {
+        return true;  // not dispatched by this dispatcher (unlimited)
+    }
+    auto& method = it->second;
+    if (method.maxConcurrency > 0 && method.running >= method.maxConcurrency) {
+        method.deferred.push_back(std::move(call));
+        return false;
+    }
+    ++method.running;
+    return true;
+}
+
+void MethodDispatcher::release(const NodeId& methodId) {
+    const auto it = methods_.find(methodId);
+    if (it == methods_.end()) {
+        return;
+    }
+    --it->second.running;
+    if (!it->second.deferred.empty()) {
+        cv_.notify_one();
+    }
+}
+
+void MethodDispatcher::work() {
+    std::unique_lock lock(mutex_);
+    while (true) {
+        Call call{};
+        bool ready = takeDeferred(call);
+        if (!ready) {
+            cv_.wait(lock, [&] { return stop_ || notifications_ > 0 || takeDeferred(call); });
+            if (stop_) {
+                return;
+            }
+            ready = call.context != nullptr;  // deferred call taken by the wait predicate
+        }
+        if (!ready) {
+            --notifications_;
+            lock.unlock();
+            UA_AsyncOperationType type{};
+            const UA_AsyncOperationRequest* request = nullptr;
+            void* context = nullptr;
+            const bool fetched = UA_Server_getAsyncOperationNonBlocking(
+                server_.handle(), &type, &request, &context, nullptr
+            );
+            lock.lock();
+            if (!fetched || type != UA_ASYNCOPERATIONTYPE_CALL) {
+                continue;
+            }
+            // copy the request, the server discards it if the operation times out
+            call = {CallMethodRequest(request->callMethodRequest), context};
+            if (!acquire(call)) {
+                continue;
+            }
+        }
+        lock.unlock();
+        execute(call);
+        lock.lock();
+        release(call.request.getMethodId());
+    }
+}
+
+void MethodDispatcher::execute(Call& call) {
+    // UA_Server_call validates the arguments and invokes the method callback without holding the
+    // server lock, the callback writes the output arguments directly into the result
+    auto* server = server_.handle();
+    setResult(server, UA_Server_call(server, call.request.handle()), call.context);
+}
+
+}  // namespace opcua
+
+#endif
@@ -0,0 +1,183 @@
+#include "open62541pp/ModelChangeTracker.h"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+
+#include <unordered_set>
+#include <utility>  // move, swap
+
+#include "open62541pp/AttributeCache.h"
+#include "open62541pp/BrowsePathResolver.h"
+#include "open62541pp/Client.h"
+#include "open62541pp/MonitoredItem.h"
+#include "open62541pp/Subscription.h"
+#include "open62541pp/types/Composed.h"  // BrowseDescription, EventFilter
+#include "open62541pp/types/Variant.h"
+
+namespace opcua {
+
+struct ModelChangeTracker::State {
+    std::vector<ModelChange> changes;
+    bool stale = true;
+};
+
+/// Decode the `Changes` field of a GeneralModelChangeEventType event.
+static bool decodeChanges(const Variant& changes, std::vector<ModelChange>& result) {
+    if (!changes.isType(UA_TYPES[UA_TYPES_MODELCHANGESTRUCTUREDATATYPE])) {
+        return false;
+    }
+    const auto* items = static_cast<const UA_ModelChangeStructureDataType*>(changes.data());
+    const size_t count = changes.isScalar() ? 1 : changes.getArrayLength();
+    for (size_t i = 0; i < count; ++i) {
+        const auto& item = items[i];  // NOLINT
+        result.push_back(
+            {asWrapper<NodeId>(item.affected), asWrapper<NodeId>(item.affectedType), item.verb}
+        );
+    }
+    return count > 0;
+}
+
+ModelChangeTracker::ModelChangeTracker(
+    Client& client, std::vector<NodeId> roots, services::BrowseRecursiveOptions options
+)
+    : client_(&client),
+      roots_(std::move(roots)),
+      options_(options),
+      state_(std::make_shared<State>()) {}
+
+MonitoredItem<Client> ModelChangeTracker::subscribe(Subscription<Client>& subscription) {
+    const EventFilter eventFilter(
+        {
+            {ObjectTypeId::BaseEventType, {{0, "EventType"}}, AttributeId::Value},
+            {ObjectTypeId::GeneralModelChangeEventType, {{0, "Changes"}}, AttributeId::Value},
+        },
+        {}
+    );
+    return subscription.subscribeEvent(
+        ObjectId::Server,
+        eventFilter,
+        [weakState = std::weak_ptr<State>(state_)](
+            const MonitoredItem<Client>& /* item */, Span<const Variant> eventFields
+        ) {
+            auto state = weakState.lock();
+            if (state == nullptr || eventFields.size() < 2 || !eventFields[0].isType<NodeId>()) {
+                return;
+            }
+            const auto& eventType = eventFields[0].getScalar<NodeId>();
+            if (eventType != NodeId(ObjectTypeId::BaseModelChangeEventType) &&
+                eventType != NodeId(ObjectTypeId::GeneralModelChangeEventType)) {
+                return;
+            }
+            if (!decodeChanges(eventFields[1], state->changes)) {
+                state->stale = true;  // affected nodes unknown
+            }
+        }
+    );
+}
+
+void ModelChangeTracker::addBrowsePathResolver(BrowsePathResolver& resolver) {
+    resolvers_.push_back(&resolver);
+}
+
+void ModelChangeTracker::invalidate() noexcept {
+    state_->stale = true;
+}
+
+Span<const ModelChange> ModelChangeTracker::getPendingChanges() const noexcept {
+    return state_->changes;
+}
+
+bool ModelChangeTracker::isStale() const noexcept {
+    return state_->stale;
+}
+
+size_t ModelChangeTracker::update(const ModelChangeHandler& handler) {
+    auto& state = *state_;
+    if (!state.stale && state.changes.empty()) {
+        return 0;
+    }
+
+    // collect the changed subtrees, deleted nodes are not browsed
+    std::vector<NodeId> subtrees;
+    std::vector<NodeId> deleted;
+    std::unordered_set<NodeId> visited;
+    for (const auto& change : state.changes) {
+        if (change.has(ModelChangeVerb::NodeDeleted)) {
+            deleted.push_back(change.affected);
+            visited.insert(change.affected);
+        }
+    }
+    if (state.stale) {
+        subtrees = roots_;
+    } else {
+        constexpr uint8_t structural = static_cast<uint8_t>(ModelChangeVerb::NodeAdded) |
+                                       static_cast<uint8_t>(ModelChangeVerb::ReferenceAdded) |
+                                       static_cast<uint8_t>(ModelChangeVerb::ReferenceDeleted);
+        for (const auto& change : state.changes) {
+            if ((change.verb & structural) != 0 && visited.insert(change.affected).second) {
+                subtrees.push_back(change.affected);
+            }
+        }
+    }
+
+    // invalidate the caches
+    const bool structuralChange = state.stale || !subtrees.empty() || !deleted.empty();
+    if (auto* cache = client_->getAttributeCache()) {
+        if (state.stale) {
+            cache->clear();
+        } else {
+            for (const auto& change : state.changes) {
+                cache->invalidate(change.affected);
+            }
+        }
+    }
+    if (structuralChange) {
+        for (auto* resolver : resolvers_) {
+            resolver->invalidate();
+        }
+    }
+    if (!deleted.empty()) {
+        client_->unregisterNodes(deleted);  // ignores nodes, that are not registered
+    }
+
+    // apply the changes, events received while browsing are queued for the next update
+    std::vector<ModelChange> changes;
+    std::swap(changes, state.changes);
+    state.stale = false;
+    try {
+        for (const auto& id : deleted) {
+            if (handler.onNodeDeleted) {
+                handler.onNodeDeleted(id);
+            }
+        }
+        size_t browsed = 0;
+        for (const auto& id : subtrees) {
+            if (handler.onSubtreeChanged) {
+                handler.onSubtreeChanged(id);
+            }
+            const BrowseDescription bd(
+                id, BrowseDirection::Forward, ReferenceTypeId::HierarchicalReferences
+            );
+            browsed += services::browseRecursive(
+                *client_,
+                bd,
+                [&](const NodeId& sourceId, const ReferenceDescription& reference) {
+                    if (handler.onReference) {
+                        handler.onReference(sourceId, reference);
+                    }
+                },
+                options_
+            );
+        }
+        return browsed;
+    } catch (...) {
+        // keep the changes for the next update
+        changes.insert(changes.end(), state.changes.begin(), state.changes.end());
+        std::swap(changes, state.changes);
+        state.stale = true;
+        throw;
+    }
+}
+
+}  // namespace opcua
+
+#endif
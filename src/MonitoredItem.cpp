@@ -61,14 +61,12 @@ inline static auto& getMonitoredItemContext(
 
 template <typename T>
 const NodeId& MonitoredItem<T>::getNodeId() const {
-    return getMonitoredItemContext(connection_, subscriptionId_, monitoredItemId_)
-        .itemToMonitor.getNodeId();
+    return getMonitoredItemContext(connection_, subscriptionId_, monitoredItemId_).nodeId;
 }
 
 template <typename T>
 AttributeId MonitoredItem<T>::getAttributeId() const {
-    return getMonitoredItemContext(connection_, subscriptionId_, monitoredItemId_)
-        .itemToMonitor.getAttributeId();
+    return getMonitoredItemContext(connection_, subscriptionId_, monitoredItemId_).attributeId;
 }
 
 /* ----------------------------------- Server specializations ----------------------------------- */
@@ -87,6 +85,17 @@ void MonitoredItem<Server>::deleteMonitoredItem() {
 
 /* ----------------------------------- Client specializations ----------------------------------- */
 
+template <>
+uint32_t MonitoredItem<Client>::getClientHandle() const {
+    return getMonitoredItemContext(connection_, subscriptionId_, monitoredItemId_).clientHandle;
+}
+
+template <>
+MonitoredItemStatistics MonitoredItem<Client>::getStatistics() const {
+    return getMonitoredItemContext(connection_, subscriptionId_, monitoredItemId_)
+        .statistics.snapshot();
+}
+
 template <>
 void MonitoredItem<Client>::setMonitoringParameters(MonitoringParameters& parameters) {
     services::modifyMonitoredItem(connection_, subscriptionId_, monitoredItemId_, parameters);
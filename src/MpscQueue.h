@@ -0,0 +1,70 @@
+#pragma once
+
+#include <atomic>
+#include <optional>
+#include <utility>  // move
+
+namespace opcua::detail {
+
+/**
+ * Lock-free, unbounded multi-producer single-consumer queue (intrusive node-based).
+ * push can be called from any thread, pop only from a single consumer thread.
+ * @see https://www.1024cores.net/home/lock-free-algorithms/queues/non-intrusive-mpsc-node-based-queue
+ */
+template <typename T>
+class MpscQueue {
+public:
+    MpscQueue()
+        : head_(new Node),
+          tail_(head_.load(std::memory_order_relaxed)) {}
+
+    ~MpscQueue() {
+        while (pop().has_value()) {
+        }
+        delete tail_;  // NOLINT
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue(MpscQueue&&) noexcept = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+    MpscQueue& operator=(MpscQueue&&) noexcept = delete;
+
+    /// Push value (thread-safe, wait-free).
+    void push(T value) {
+        auto* node = new Node;  // NOLINT
+        node->value.emplace(std::move(value));
+        Node* prev = head_.exchange(node, std::memory_order_acq_rel);
+        prev->next.store(node, std::memory_order_release);
+    }
+
+    /// Pop value (consumer thread only).
+    /// @return Value or `std::nullopt` if the queue is empty (or a push is not completed yet)
+    std::optional<T> pop() {
+        Node* tail = tail_;
+        Node* next = tail->next.load(std::memory_order_acquire);
+        if (next == nullptr) {
+            return std::nullopt;
+        }
+        std::optional<T> value(std::move(next->value));
+        next->value.reset();
+        tail_ = next;  // next becomes the new stub node
+        delete tail;  // NOLINT
+        return value;
+    }
+
+    /// Check if the queue is empty (consumer thread only).
+    bool empty() const noexcept {
+        return tail_->next.load(std::memory_order_acquire) == nullptr;
+    }
+
+private:
+    struct Node {
+        std::atomic<Node*> next{nullptr};
+        std::optional<T> value;
+    };
+
+    std::atomic<Node*> head_;  // last pushed node, producers
+    Node* tail_;  // stub node, consumer
+};
+
+}  // namespace opcua::detail
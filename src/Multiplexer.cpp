@@ -0,0 +1,171 @@
+#include "open62541pp/Multiplexer.h"
+
+#include <algorithm>  // min, push_heap, pop_heap, remove_if, make_heap
+#include <functional>  // greater
+#include <utility>  // move
+
+#include "open62541pp/Client.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Server.h"
+
+namespace opcua {
+
+Multiplexer::Multiplexer(MultiplexerOptions options)
+    : options_(std::move(options)) {
+    const size_t threads = std::max<size_t>(options_.threads, 1);
+    threads_.reserve(threads);
+    for (size_t i = 0; i < threads; ++i) {
+        threads_.emplace_back([this] { work(); });
+    }
+}
+
+Multiplexer::~Multiplexer() {
+    {
+        const std::lock_guard lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    for (auto& thread : threads_) {
+        thread.join();
+    }
+}
+
+void Multiplexer::add(Server& server) {
+    add(&server, [&server] {
+        return Clock::duration(std::chrono::milliseconds(server.runIterate()));
+    });
+}
+
+void Multiplexer::add(Client& client) {
+    add(&client, [&client] {
+        client.runIterate(0);  // poll without waiting
+        return Clock::duration::max();  // limited by maxInterval
+    });
+}
+
+void Multiplexer::remove(Server& server) {
+    remove(static_cast<const void*>(&server));
+}
+
+void Multiplexer::remove(Client& client) {
+    remove(static_cast<const void*>(&client));
+}
+
+void Multiplexer::wake(Server& server) {
+    wake(static_cast<const void*>(&server));
+}
+
+void Multiplexer::wake(Client& client) {
+    wake(static_cast<const void*>(&client));
+}
+
+size_t Multiplexer::size() const {
+    const std::lock_guard lock(mutex_);
+    return entries_.size();
+}
+
+void Multiplexer::add(const void* instance, std::function<Clock::duration()> iterate) {
+    {
+        const std::lock_guard lock(mutex_);
+        auto& entry = entries_[instance];
+        if (entry != nullptr) {
+            throw BadStatus(UA_STATUSCODE_BADALREADYEXISTS);
+        }
+        entry = std::make_unique<Entry>();
+        entry->instance = instance;
+        entry->iterate = std::move(iterate);
+        schedule(*entry, Clock::now());
+    }
+    cv_.notify_one();
+}
+
+void Multiplexer::remove(const void* instance) {
+    std::unique_lock lock(mutex_);
+    const auto it = entries_.find(instance);
+    if (it == entries_.end()) {
+        return;
+    }
+    auto* entry = it->second.get();
+    if (entry->busy) {
+        if (entry->worker == std::this_thread::get_id()) {
+            entry->removed = true;  // erased by the worker after the iteration
+            return;
+        }
+        idle_.wait(lock, [&] { return !entry->busy; });
+    }
+    erase(*entry);
+}
+
+void Multiplexer::erase(Entry& entry) {
+    queue_.erase(
+        std::remove_if(
+            queue_.begin(), queue_.end(), [&](const Schedule& s) { return s.entry == &entry; }
+        ),
+        queue_.end()
+    );
+    std::make_heap(queue_.begin(), queue_.end(), std::greater<>{});
+    entries_.erase(entry.instance);
+}
+
+void Multiplexer::wake(const void* instance) {
+    {
+        const std::lock_guard lock(mutex_);
+        const auto it = entries_.find(instance);
+        if (it == entries_.end() || it->second->busy) {
+            return;  // rescheduled after the running iteration
+        }
+        schedule(*it->second, Clock::now());
+    }
+    cv_.notify_one();
+}
+
+void Multiplexer::schedule(Entry& entry, Clock::time_point due) {
+    queue_.push_back({due, &entry, ++entry.generation});
+    std::push_heap(queue_.begin(), queue_.end(), std::greater<>{});
+}
+
+void Multiplexer::work() {
+    std::unique_lock lock(mutex_);
+    while (!stop_) {
+        if (queue_.empty()) {
+            cv_.wait(lock);
+            continue;
+        }
+        const auto due = queue_.front().due;
+        if (Clock::now() < due) {
+            cv_.wait_until(lock, due);
+            continue;
+        }
+        std::pop_heap(queue_.begin(), queue_.end(), std::greater<>{});
+        const auto next = queue_.back();
+        queue_.pop_back();
+        auto& entry = *next.entry;
+        if (next.generation != entry.generation) {
+            continue;  // outdated by wake
+        }
+
+        entry.busy = true;
+        entry.worker = std::this_thread::get_id();
+        lock.unlock();
+        Clock::duration interval = options_.maxInterval;
+        try {
+            interval = std::min(entry.iterate(), interval);
+        } catch (...) {
+            if (options_.onException) {
+                options_.onException(std::current_exception());
+            }
+        }
+        lock.lock();
+        entry.busy = false;
+        entry.worker = {};
+
+        if (entry.removed) {
+            erase(entry);  // removed within its own iteration
+        } else {
+            schedule(entry, Clock::now() + interval);
+        }
+        idle_.notify_all();
+    }
+}
+
+}  // namespace opcua
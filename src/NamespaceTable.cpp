@@ -0,0 +1,58 @@
+#include "open62541pp/NamespaceTable.h"
+
+#include <utility>  // move
+
+namespace opcua {
+
+NamespaceTable::NamespaceTable(std::vector<std::string> uris)
+    : uris_(std::move(uris)) {
+    buildIndex();
+}
+
+NamespaceTable::NamespaceTable(const NamespaceTable& other)
+    : uris_(other.uris_) {
+    buildIndex();
+}
+
+NamespaceTable& NamespaceTable::operator=(const NamespaceTable& other) {
+    if (this != &other) {
+        uris_ = other.uris_;
+        buildIndex();
+    }
+    return *this;
+}
+
+void NamespaceTable::buildIndex() {
+    index_.clear();
+    index_.reserve(uris_.size());
+    for (size_t i = 0; i < uris_.size(); ++i) {
+        index_.emplace(uris_[i], static_cast<uint16_t>(i));  // first occurrence wins
+    }
+}
+
+std::optional<uint16_t> NamespaceTable::find(std::string_view uri) const noexcept {
+    const auto it = index_.find(uri);
+    if (it == index_.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+std::optional<NodeId> NamespaceTable::resolve(const ExpandedNodeId& id) const {
+    if (!id.isLocal()) {
+        return std::nullopt;
+    }
+    const auto uri = id.getNamespaceUri();
+    if (uri.empty()) {
+        return id.getNodeId();
+    }
+    const auto namespaceIndex = find(uri);
+    if (!namespaceIndex.has_value()) {
+        return std::nullopt;
+    }
+    NodeId result(id.getNodeId());
+    result->namespaceIndex = *namespaceIndex;
+    return result;
+}
+
+}  // namespace opcua
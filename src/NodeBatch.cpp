@@ -0,0 +1,431 @@
+#include "open62541pp/NodeBatch.h"
+
+#include <algorithm>  // min
+#include <memory>
+#include <unordered_map>
+#include <utility>  // move, swap
+
+#include "open62541pp/Client.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/detail/ScopeExit.h"
+#include "open62541pp/detail/ServerContext.h"
+#include "open62541pp/services/detail/ClientService.h"
+#include "open62541pp/services/detail/ResponseHandling.h"
+
+#include "NodeInsertion.h"
+#include "open62541_impl.h"
+#include "services/RequestChunking.h"
+
+namespace opcua {
+
+/* ------------------------------------------- Server ------------------------------------------- */
+
+/// Remove the nodes and references added by a failed commit, errors are ignored.
+static void rollback(
+    Server& server,
+    const std::vector<detail::NodeRecord>& records,
+    const detail::NodeInsertionResult& result,
+    Span<const AddReferencesItem* const> references
+) {
+    for (const auto* ref : references) {
+        UA_Server_deleteReference(
+            server.handle(),
+            *ref->getSourceNodeId().handle(),
+            *ref->getReferenceTypeId().handle(),
+            ref->getIsForward(),
+            *ref->getTargetNodeId().handle(),
+            true  // deleteBidirectional
+        );
+    }
+    // references of existing nodes are not deleted with the inserted nodes
+    for (const auto& [node, reference] : result.foreignReferences) {
+        const auto& ref = records[node].references[reference];
+        UA_Server_deleteReference(
+            server.handle(),
+            *records[node].id.handle(),
+            *ref.type.handle(),
+            ref.forward,
+            *ExpandedNodeId(ref.target).handle(),
+            true  // deleteBidirectional
+        );
+    }
+    for (size_t i = records.size(); i-- > 0;) {
+        if (result.inserted[i]) {
+            UA_Server_deleteNode(server.handle(), *records[i].id.handle(), true);
+        }
+    }
+}
+
+template <>
+std::vector<NodeId> NodeBatch<Server>::commit() {
+    const auto nodes = std::move(nodes_);
+    const auto references = std::move(references_);
+    clear();
+    if (options_.assignNodeIds) {
+        throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+    }
+    // external references and rollbacks change the address space after the insertion as well
+    const auto invalidateOnExit = detail::ScopeExit([&] {
+        detail::getContext(connection_).notifyAddressSpaceChange();
+    });
+
+    std::vector<detail::NodeRecord> records;
+    records.reserve(nodes.size());
+    std::unordered_map<NodeId, size_t> index;
+    index.reserve(nodes.size());
+    for (const auto& item : nodes) {
+        const auto& id = item.getRequestedNewNodeId().getNodeId();
+        if (id.isNull()) {
+            throw BadStatus(UA_STATUSCODE_BADNODEIDINVALID);
+        }
+        auto& record = records.emplace_back();
+        record.nodeClass = item.getNodeClass();
+        record.id = id;
+        record.browseName = item.getBrowseName();
+        record.parentId = item.getParentNodeId().getNodeId();
+        record.attributes = item.getNodeAttributes();
+        record.references.push_back({item.getReferenceTypeId(), record.parentId, false});
+        if (const auto& typeDefinition = item.getTypeDefinition().getNodeId();
+            !typeDefinition.isNull()) {
+            record.references.push_back(
+                {NodeId(ReferenceTypeId::HasTypeDefinition), typeDefinition, true}
+            );
+        }
+        index.emplace(id, records.size() - 1);
+    }
+
+    // references with a source in the batch are inserted with the nodes
+    std::vector<const AddReferencesItem*> external;
+    for (const auto& ref : references) {
+        const auto it = index.find(ref.getSourceNodeId());
+        if (it == index.end()) {
+            external.push_back(&ref);
+        } else {
+            records[it->second].references.push_back(
+                {ref.getReferenceTypeId(), ref.getTargetNodeId().getNodeId(), ref.getIsForward()}
+            );
+        }
+    }
+
+    const auto result = detail::insertNodes(connection_, records);
+    StatusCode status = result.errors.empty() ? StatusCode{} : result.errors.front().second;
+    size_t added = 0;
+    while (status.isGood() && added < external.size()) {
+        const auto& ref = *external[added];
+        status = UA_Server_addReference(
+            connection_.handle(),
+            *ref.getSourceNodeId().handle(),
+            *ref.getReferenceTypeId().handle(),
+            *ref.getTargetNodeId().handle(),
+            ref.getIsForward()
+        );
+        added += status.isGood() ? 1 : 0;
+    }
+    if (status.isBad()) {
+        rollback(connection_, records, result, {external.data(), added});
+        throw BadStatus(status);
+    }
+
+    std::vector<NodeId> ids;
+    ids.reserve(records.size());
+    for (auto& record : records) {
+        ids.push_back(std::move(record.id));
+    }
+    return ids;
+}
+
+/* ------------------------------------------- Client ------------------------------------------- */
+
+namespace {
+
+constexpr size_t npos = static_cast<size_t>(-1);
+constexpr size_t defaultChunkSize = 1000;
+
+using BatchCompletion = std::function<void(StatusCode, std::vector<NodeId>&)>;
+
+struct ClientBatchState {
+    Client* client;
+    bool assignNodeIds;
+    std::vector<AddNodesItem> nodes;
+    std::vector<AddReferencesItem> references;
+    std::unordered_map<NodeId, size_t> index;  // node ids of the batch
+    std::vector<size_t> parents;  // index of the parent in the batch or npos
+    std::vector<std::vector<size_t>> levels;  // node indices by depth in the batch
+    std::vector<NodeId> ids;  // added node ids
+    BatchCompletion onComplete;
+    size_t limit = defaultChunkSize;
+    size_t level = 0;
+    size_t next = 0;  // next node of the level or next reference
+    size_t inFlight = 0;
+    bool referencesStage = false;
+    StatusCode error;
+    bool done = false;
+};
+
+using ClientBatchStatePtr = std::shared_ptr<ClientBatchState>;
+
+void sendNext(const ClientBatchStatePtr& state);
+
+void finish(ClientBatchState& state) {
+    const bool pending = !state.referencesStage || state.next < state.references.size();
+    if (state.done || state.inFlight > 0 || (pending && state.error.isGood())) {
+        return;
+    }
+    state.done = true;
+    if (state.onComplete) {
+        state.onComplete(state.error, state.ids);
+    }
+}
+
+void setError(ClientBatchState& state, StatusCode code) {
+    if (state.error.isGood()) {
+        state.error = code;
+    }
+}
+
+/// Map a node id of the batch to the node id added by the server.
+const UA_NodeId* mapNodeId(const ClientBatchState& state, const NodeId& id) {
+    const auto it = state.index.find(id);
+    return it == state.index.end() ? id.handle() : state.ids[it->second].handle();
+}
+
+void sendNodes(const ClientBatchStatePtr& state) {
+    const auto& level = state->levels[state->level];
+    const size_t count = std::min(state->limit, level.size() - state->next);
+    std::vector<size_t> chunk(level.begin() + state->next, level.begin() + state->next + count);
+    state->next += count;
+
+    // shallow copies, the request is encoded when sent
+    std::vector<UA_AddNodesItem> items(chunk.size());
+    for (size_t i = 0; i < chunk.size(); ++i) {
+        const size_t node = chunk[i];
+        items[i] = *state->nodes[node].handle();
+        if (state->parents[node] != npos) {
+            items[i].parentNodeId.nodeId = *state->ids[state->parents[node]].handle();
+        }
+        if (state->assignNodeIds) {
+            items[i].requestedNewNodeId.nodeId =
+                UA_NODEID_NUMERIC(items[i].requestedNewNodeId.nodeId.namespaceIndex, 0);
+        }
+    }
+    UA_AddNodesRequest request{};
+    request.nodesToAddSize = items.size();
+    request.nodesToAdd = items.data();
+
+    ++state->inFlight;
+    services::detail::sendRequest<UA_AddNodesRequest, UA_AddNodesResponse>(
+        *state->client,
+        request,
+        services::detail::WrapResponse<AddNodesResponse>{},
+        [state, chunk = std::move(chunk)](StatusCode code, AddNodesResponse& response) {
+            --state->inFlight;
+            if (state->done) {
+                return;
+            }
+            if (code.isGood()) {
+                code = response->responseHeader.serviceResult;
+            }
+            if (code.isGood() && response->resultsSize != chunk.size()) {
+                code = UA_STATUSCODE_BADUNEXPECTEDERROR;
+            }
+            if (code.isBad()) {
+                setError(*state, code);
+            } else {
+                for (size_t i = 0; i < chunk.size(); ++i) {
+                    auto& result = response->results[i];  // NOLINT
+                    if (StatusCode(result.statusCode).isBad()) {
+                        setError(*state, result.statusCode);
+                    } else if (!UA_NodeId_isNull(&result.addedNodeId)) {
+                        std::swap(*state->ids[chunk[i]].handle(), result.addedNodeId);
+                    } else if (!state->assignNodeIds) {
+                        state->ids[chunk[i]] =
+                            state->nodes[chunk[i]].getRequestedNewNodeId().getNodeId();
+                    }
+                }
+            }
+            sendNext(state);
+            finish(*state);
+        }
+    );
+}
+
+void sendReferences(const ClientBatchStatePtr& state) {
+    const size_t begin = state->next;
+    const size_t count = std::min(state->limit, state->references.size() - begin);
+    state->next += count;
+
+    // shallow copies, the request is encoded when sent
+    std::vector<UA_AddReferencesItem> items(count);
+    for (size_t i = 0; i < count; ++i) {
+        const auto& ref = state->references[begin + i];
+        items[i] = *ref.handle();
+        items[i].sourceNodeId = *mapNodeId(*state, ref.getSourceNodeId());
+        if (ref.getTargetNodeId().isLocal()) {
+            items[i].targetNodeId.nodeId = *mapNodeId(*state, ref.getTargetNodeId().getNodeId());
+        }
+    }
+    UA_AddReferencesRequest request{};
+    request.referencesToAddSize = items.size();
+    request.referencesToAdd = items.data();
+
+    ++state->inFlight;
+    services::detail::sendRequest<UA_AddReferencesRequest, UA_AddReferencesResponse>(
+        *state->client,
+        request,
+        services::detail::WrapResponse<AddReferencesResponse>{},
+        [state, count](StatusCode code, AddReferencesResponse& response) {
+            --state->inFlight;
+            if (state->done) {
+                return;
+            }
+            if (code.isGood()) {
+                code = response->responseHeader.serviceResult;
+            }
+            if (code.isGood() && response->resultsSize != count) {
+                code = UA_STATUSCODE_BADUNEXPECTEDERROR;
+            }
+            if (code.isBad()) {
+                setError(*state, code);
+            } else {
+                for (const auto& result : response.getResults()) {
+                    if (result.isBad()) {
+                        setError(*state, result);
+                    }
+                }
+            }
+            sendNext(state);
+            finish(*state);
+        }
+    );
+}
+
+void sendNext(const ClientBatchStatePtr& state) {
+    while (state->error.isGood() && state->inFlight < services::detail::maxChunksInFlight) {
+        if (!state->referencesStage) {
+            if (state->level < state->levels.size() &&
+                state->next < state->levels[state->level].size()) {
+                sendNodes(state);
+                continue;
+            }
+            if (state->inFlight > 0) {
+                return;  // the next level depends on the node ids of this level
+            }
+            if (state->level + 1 < state->levels.size()) {
+                ++state->level;
+            } else {
+                state->referencesStage = true;
+            }
+            state->next = 0;
+            continue;
+        }
+        if (state->next >= state->references.size()) {
+            return;
+        }
+        sendReferences(state);
+    }
+}
+
+/// Group the nodes by their depth in the hierarchy of batch nodes.
+void resolveLevels(ClientBatchState& state) {
+    const size_t size = state.nodes.size();
+    for (size_t i = 0; i < size; ++i) {
+        const auto& id = state.nodes[i].getRequestedNewNodeId().getNodeId();
+        if (id.isNull()) {
+            throw BadStatus(UA_STATUSCODE_BADNODEIDINVALID);
+        }
+        state.index.emplace(id, i);
+    }
+    state.parents.resize(size, npos);
+    for (size_t i = 0; i < size; ++i) {
+        const auto it = state.index.find(state.nodes[i].getParentNodeId().getNodeId());
+        if (it != state.index.end()) {
+            state.parents[i] = it->second;
+        }
+    }
+    std::vector<size_t> depths(size, npos);
+    std::vector<size_t> path;
+    for (size_t i = 0; i < size; ++i) {
+        path.clear();
+        size_t node = i;
+        while (node != npos && depths[node] == npos) {
+            if (path.size() == size) {
+                throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);  // cyclic parents
+            }
+            path.push_back(node);
+            node = state.parents[node];
+        }
+        size_t depth = node == npos ? 0 : depths[node] + 1;
+        for (auto it = path.rbegin(); it != path.rend(); ++it) {
+            depths[*it] = depth++;
+        }
+        if (state.levels.size() <= depths[i]) {
+            state.levels.resize(depths[i] + 1);
+        }
+        state.levels[depths[i]].push_back(i);
+    }
+}
+
+ClientBatchStatePtr startClientBatch(
+    Client& client,
+    bool assignNodeIds,
+    std::vector<AddNodesItem> nodes,
+    std::vector<AddReferencesItem> references,
+    BatchCompletion onComplete
+) {
+    auto state = std::make_shared<ClientBatchState>();
+    state->client = &client;
+    state->assignNodeIds = assignNodeIds;
+    state->nodes = std::move(nodes);
+    state->references = std::move(references);
+    state->onComplete = std::move(onComplete);
+    resolveLevels(*state);
+    state->ids.resize(state->nodes.size());
+    const uint32_t serverLimit = services::detail::getOperationLimit(
+        client, &OperationLimits::maxNodesPerNodeManagement
+    );
+    if (serverLimit > 0) {
+        state->limit = serverLimit;
+    }
+    sendNext(state);
+    finish(*state);  // empty batch
+    return state;
+}
+
+}  // namespace
+
+template <>
+std::vector<NodeId> NodeBatch<Client>::commit() {
+    auto nodes = std::move(nodes_);
+    auto references = std::move(references_);
+    clear();
+    // the state is shared with the handlers, responses might arrive after an exception
+    auto state = startClientBatch(
+        connection_, options_.assignNodeIds, std::move(nodes), std::move(references), {}
+    );
+    const auto stopOnExit = detail::ScopeExit([&] { state->done = true; });
+    while (!state->done) {
+        connection_.runIterate(100);
+    }
+    throwIfBad(state->error);
+    return std::move(state->ids);
+}
+
+template <>
+void NodeBatch<Client>::commitAsync(
+    std::function<void(StatusCode status, std::vector<NodeId>& ids)> onComplete
+) {
+    auto nodes = std::move(nodes_);
+    auto references = std::move(references_);
+    clear();
+    startClientBatch(
+        connection_,
+        options_.assignNodeIds,
+        std::move(nodes),
+        std::move(references),
+        std::move(onComplete)
+    );
+}
+
+}  // namespace opcua
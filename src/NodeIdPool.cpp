@@ -0,0 +1,22 @@
+#include "open62541pp/NodeIdPool.h"
+
+namespace opcua {
+
+InternedNodeId NodeIdPool::intern(const NodeId& id) {
+    std::lock_guard lock(mutex_);
+    // references to the elements of unordered_set stay valid after rehashing
+    const auto& pooled = *ids_.insert(id).first;
+    return {pooled, pooled.hash()};
+}
+
+InternedNodeId NodeIdPool::intern(uint16_t namespaceIndex, std::string_view identifier) {
+    // lookup with a non-owning view, no allocation if already pooled
+    return intern(NodeIdView(namespaceIndex, identifier).get());
+}
+
+size_t NodeIdPool::size() const {
+    std::lock_guard lock(mutex_);
+    return ids_.size();
+}
+
+}  // namespace opcua
@@ -0,0 +1,424 @@
+#include "NodeInsertion.h"
+
+#include <array>
+#include <cstdint>
+#include <cstring>  // memcpy, memset
+#include <unordered_map>
+#include <unordered_set>
+
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/TypeWrapper.h"  // asWrapper
+#include "open62541pp/detail/ServerContext.h"
+#include "open62541pp/detail/helper.h"  // allocate
+
+#include "open62541_impl.h"
+
+namespace opcua::detail {
+
+namespace {
+
+constexpr size_t npos = static_cast<size_t>(-1);
+
+/// Parent and type definition of a node, resolved from its references.
+struct ResolvedNode {
+    NodeId parentId;
+    NodeId referenceType;
+    NodeId typeDefinition;
+    size_t parentReference{npos};  // index of the reference added with the node
+    size_t typeReference{npos};
+    std::array<size_t, 4> dependencies{npos, npos, npos, npos};
+};
+
+std::unordered_set<NodeId> getHierarchicalReferenceTypes(const std::vector<NodeRecord>& nodes) {
+    std::unordered_set<NodeId> types{
+        ReferenceTypeId::HierarchicalReferences,
+        ReferenceTypeId::HasChild,
+        ReferenceTypeId::Organizes,
+        ReferenceTypeId::HasEventSource,
+        ReferenceTypeId::Aggregates,
+        ReferenceTypeId::HasSubtype,
+        ReferenceTypeId::HasProperty,
+        ReferenceTypeId::HasComponent,
+        ReferenceTypeId::HasNotifier,
+        ReferenceTypeId::HasOrderedComponent,
+    };
+    // subtypes of the inserted nodes, repeat until no further subtypes are found
+    bool found = true;
+    while (found) {
+        found = false;
+        for (const auto& node : nodes) {
+            if (node.nodeClass != NodeClass::ReferenceType || types.count(node.id) > 0) {
+                continue;
+            }
+            for (const auto& ref : node.references) {
+                if (!ref.forward && ref.type == NodeId(ReferenceTypeId::HasSubtype) &&
+                    types.count(ref.target) > 0) {
+                    types.insert(node.id);
+                    found = true;
+                    break;
+                }
+            }
+        }
+    }
+    return types;
+}
+
+const NodeId* getDataType(const NodeRecord& node) noexcept {
+    const auto* type = node.attributes.getDecodedDataType();
+    const auto* data = node.attributes.getDecodedData();
+    if (type == &UA_TYPES[UA_TYPES_VARIABLEATTRIBUTES]) {
+        return asWrapper<NodeId>(&static_cast<const UA_VariableAttributes*>(data)->dataType);
+    }
+    if (type == &UA_TYPES[UA_TYPES_VARIABLETYPEATTRIBUTES]) {
+        return asWrapper<NodeId>(&static_cast<const UA_VariableTypeAttributes*>(data)->dataType);
+    }
+    return nullptr;
+}
+
+std::vector<ResolvedNode> resolveNodes(const std::vector<NodeRecord>& nodes) {
+    const auto hierarchical = getHierarchicalReferenceTypes(nodes);
+    std::unordered_map<NodeId, size_t> index;
+    index.reserve(nodes.size());
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        index.emplace(nodes[i].id, i);
+    }
+    auto find = [&](const NodeId* id) {
+        if (id == nullptr) {
+            return npos;
+        }
+        const auto it = index.find(*id);
+        return it == index.end() ? npos : it->second;
+    };
+
+    std::vector<ResolvedNode> resolved(nodes.size());
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        const auto& node = nodes[i];
+        auto& result = resolved[i];
+        const auto& refs = node.references;
+        const bool isType = isTypeNodeClass(node.nodeClass);
+        for (size_t j = 0; j < refs.size(); ++j) {
+            const auto& ref = refs[j];
+            if (ref.forward) {
+                if (!isType && result.typeReference == npos &&
+                    ref.type == NodeId(ReferenceTypeId::HasTypeDefinition)) {
+                    result.typeReference = j;
+                }
+                continue;
+            }
+            const bool isParent =
+                isType ? ref.type == NodeId(ReferenceTypeId::HasSubtype)
+                       : (node.parentId.isNull() || ref.target == node.parentId) &&
+                             hierarchical.count(ref.type) > 0;
+            if (isParent && result.parentReference == npos) {
+                result.parentReference = j;
+            }
+        }
+        if (result.parentReference != npos) {
+            result.parentId = refs[result.parentReference].target;
+            result.referenceType = refs[result.parentReference].type;
+        }
+        if (result.typeReference != npos) {
+            result.typeDefinition = refs[result.typeReference].target;
+        }
+        result.dependencies = {
+            find(&result.parentId),
+            find(&result.referenceType),
+            find(&result.typeDefinition),
+            find(getDataType(node)),
+        };
+    }
+    return resolved;
+}
+
+/// Order nodes after their dependencies (depth-first, cycles are broken arbitrarily).
+std::vector<size_t> sortNodes(const std::vector<ResolvedNode>& resolved) {
+    std::vector<size_t> order;
+    order.reserve(resolved.size());
+    std::vector<uint8_t> visited(resolved.size(), 0);
+    std::vector<std::pair<size_t, size_t>> stack;  // node, next dependency
+    for (size_t root = 0; root < resolved.size(); ++root) {
+        if (visited[root] != 0) {
+            continue;
+        }
+        visited[root] = 1;
+        stack.emplace_back(root, 0);
+        while (!stack.empty()) {
+            auto& [node, next] = stack.back();
+            const auto& dependencies = resolved[node].dependencies;
+            if (next < dependencies.size()) {
+                const size_t dependency = dependencies[next++];
+                if (dependency != npos && visited[dependency] == 0) {
+                    visited[dependency] = 1;
+                    stack.emplace_back(dependency, 0);
+                }
+            } else {
+                order.push_back(node);
+                stack.pop_back();
+            }
+        }
+    }
+    return order;
+}
+
+StatusCode addNodeBegin(Server& server, const NodeRecord& node, const ResolvedNode& resolved) {
+    const auto* attributeType = node.attributes.getDecodedDataType();
+    if (attributeType == nullptr) {
+        return UA_STATUSCODE_BADNODEATTRIBUTESINVALID;
+    }
+    return UA_Server_addNode_begin(
+        server.handle(),
+        static_cast<UA_NodeClass>(node.nodeClass),
+        *node.id.handle(),
+        *resolved.parentId.handle(),
+        *resolved.referenceType.handle(),
+        *node.browseName.handle(),
+        *resolved.typeDefinition.handle(),
+        node.attributes.getDecodedData(),
+        attributeType,
+        nullptr,  // nodeContext
+        nullptr  // outNewNodeId
+    );
+}
+
+UA_DataValue readNative(UA_Server* server, const UA_NodeId& id, UA_AttributeId attributeId) {
+    UA_ReadValueId item;
+    UA_ReadValueId_init(&item);
+    item.nodeId = id;
+    item.attributeId = attributeId;
+    return UA_Server_read(server, &item, UA_TIMESTAMPSTORETURN_NEITHER);
+}
+
+/// Read a scalar attribute, the member is left unchanged if the attribute can not be read.
+template <typename T>
+void readMember(
+    UA_Server* server, const UA_NodeId& id, UA_AttributeId attributeId, T& member, int typeIndex
+) {
+    const UA_DataType& type = UA_TYPES[typeIndex];  // NOLINT
+    UA_DataValue dv = readNative(server, id, attributeId);
+    if (dv.hasValue && UA_Variant_hasScalarType(&dv.value, &type)) {
+        UA_clear(&member, &type);
+        std::memcpy(&member, dv.value.data, sizeof(T));  // steal the content
+        UA_free(dv.value.data);  // NOLINT
+        dv.value.data = nullptr;
+    }
+    UA_DataValue_clear(&dv);
+}
+
+template <typename Attributes>
+void readCommonMembers(UA_Server* server, const UA_NodeId& id, Attributes& attr) {
+    readMember(server, id, UA_ATTRIBUTEID_DISPLAYNAME, attr.displayName, UA_TYPES_LOCALIZEDTEXT);
+    readMember(server, id, UA_ATTRIBUTEID_DESCRIPTION, attr.description, UA_TYPES_LOCALIZEDTEXT);
+    readMember(server, id, UA_ATTRIBUTEID_WRITEMASK, attr.writeMask, UA_TYPES_UINT32);
+    readMember(server, id, UA_ATTRIBUTEID_USERWRITEMASK, attr.userWriteMask, UA_TYPES_UINT32);
+}
+
+template <typename Attributes>
+void readValueMembers(
+    UA_Server* server, const UA_NodeId& id, Attributes& attr, bool withValue
+) {
+    if (withValue) {
+        UA_DataValue dv = readNative(server, id, UA_ATTRIBUTEID_VALUE);
+        if (dv.hasValue) {
+            attr.value = dv.value;  // steal the variant
+            std::memset(&dv.value, 0, sizeof(UA_Variant));  // NOLINT
+        }
+        UA_DataValue_clear(&dv);
+    }
+    readMember(server, id, UA_ATTRIBUTEID_DATATYPE, attr.dataType, UA_TYPES_NODEID);
+    readMember(server, id, UA_ATTRIBUTEID_VALUERANK, attr.valueRank, UA_TYPES_INT32);
+    UA_DataValue dv = readNative(server, id, UA_ATTRIBUTEID_ARRAYDIMENSIONS);
+    if (dv.hasValue && dv.value.type == &UA_TYPES[UA_TYPES_UINT32] &&
+        !UA_Variant_isScalar(&dv.value) && dv.value.arrayLength > 0) {
+        attr.arrayDimensions = static_cast<UA_UInt32*>(dv.value.data);  // steal the array
+        attr.arrayDimensionsSize = dv.value.arrayLength;
+        dv.value.data = nullptr;
+        dv.value.arrayLength = 0;
+    }
+    UA_DataValue_clear(&dv);
+}
+
+void readAttributes(
+    UA_Server* server, const UA_NodeId& id, NodeClass nodeClass, void* attributes, bool withValue
+) {
+    switch (nodeClass) {
+    case NodeClass::Object: {
+        auto& attr = *static_cast<UA_ObjectAttributes*>(attributes);
+        readCommonMembers(server, id, attr);
+        readMember(server, id, UA_ATTRIBUTEID_EVENTNOTIFIER, attr.eventNotifier, UA_TYPES_BYTE);
+        break;
+    }
+    case NodeClass::Variable: {
+        auto& attr = *static_cast<UA_VariableAttributes*>(attributes);
+        readCommonMembers(server, id, attr);
+        readValueMembers(server, id, attr, withValue);
+        readMember(server, id, UA_ATTRIBUTEID_ACCESSLEVEL, attr.accessLevel, UA_TYPES_BYTE);
+        readMember(
+            server, id, UA_ATTRIBUTEID_USERACCESSLEVEL, attr.userAccessLevel, UA_TYPES_BYTE
+        );
+        readMember(
+            server,
+            id,
+            UA_ATTRIBUTEID_MINIMUMSAMPLINGINTERVAL,
+            attr.minimumSamplingInterval,
+            UA_TYPES_DOUBLE
+        );
+        readMember(server, id, UA_ATTRIBUTEID_HISTORIZING, attr.historizing, UA_TYPES_BOOLEAN);
+        break;
+    }
+    case NodeClass::Method: {
+        auto& attr = *static_cast<UA_MethodAttributes*>(attributes);
+        readCommonMembers(server, id, attr);
+        readMember(server, id, UA_ATTRIBUTEID_EXECUTABLE, attr.executable, UA_TYPES_BOOLEAN);
+        readMember(
+            server, id, UA_ATTRIBUTEID_USEREXECUTABLE, attr.userExecutable, UA_TYPES_BOOLEAN
+        );
+        break;
+    }
+    case NodeClass::ObjectType: {
+        auto& attr = *static_cast<UA_ObjectTypeAttributes*>(attributes);
+        readCommonMembers(server, id, attr);
+        readMember(server, id, UA_ATTRIBUTEID_ISABSTRACT, attr.isAbstract, UA_TYPES_BOOLEAN);
+        break;
+    }
+    case NodeClass::VariableType: {
+        auto& attr = *static_cast<UA_VariableTypeAttributes*>(attributes);
+        readCommonMembers(server, id, attr);
+        readValueMembers(server, id, attr, withValue);
+        readMember(server, id, UA_ATTRIBUTEID_ISABSTRACT, attr.isAbstract, UA_TYPES_BOOLEAN);
+        break;
+    }
+    case NodeClass::ReferenceType: {
+        auto& attr = *static_cast<UA_ReferenceTypeAttributes*>(attributes);
+        readCommonMembers(server, id, attr);
+        readMember(server, id, UA_ATTRIBUTEID_ISABSTRACT, attr.isAbstract, UA_TYPES_BOOLEAN);
+        readMember(server, id, UA_ATTRIBUTEID_SYMMETRIC, attr.symmetric, UA_TYPES_BOOLEAN);
+        readMember(
+            server, id, UA_ATTRIBUTEID_INVERSENAME, attr.inverseName, UA_TYPES_LOCALIZEDTEXT
+        );
+        break;
+    }
+    case NodeClass::DataType: {
+        auto& attr = *static_cast<UA_DataTypeAttributes*>(attributes);
+        readCommonMembers(server, id, attr);
+        readMember(server, id, UA_ATTRIBUTEID_ISABSTRACT, attr.isAbstract, UA_TYPES_BOOLEAN);
+        break;
+    }
+    case NodeClass::View: {
+        auto& attr = *static_cast<UA_ViewAttributes*>(attributes);
+        readCommonMembers(server, id, attr);
+        readMember(
+            server, id, UA_ATTRIBUTEID_CONTAINSNOLOOPS, attr.containsNoLoops, UA_TYPES_BOOLEAN
+        );
+        readMember(server, id, UA_ATTRIBUTEID_EVENTNOTIFIER, attr.eventNotifier, UA_TYPES_BYTE);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+}  // namespace
+
+const UA_DataType* getAttributesType(NodeClass nodeClass) noexcept {
+    switch (nodeClass) {
+    case NodeClass::Object:
+        return &UA_TYPES[UA_TYPES_OBJECTATTRIBUTES];
+    case NodeClass::Variable:
+        return &UA_TYPES[UA_TYPES_VARIABLEATTRIBUTES];
+    case NodeClass::Method:
+        return &UA_TYPES[UA_TYPES_METHODATTRIBUTES];
+    case NodeClass::ObjectType:
+        return &UA_TYPES[UA_TYPES_OBJECTTYPEATTRIBUTES];
+    case NodeClass::VariableType:
+        return &UA_TYPES[UA_TYPES_VARIABLETYPEATTRIBUTES];
+    case NodeClass::ReferenceType:
+        return &UA_TYPES[UA_TYPES_REFERENCETYPEATTRIBUTES];
+    case NodeClass::DataType:
+        return &UA_TYPES[UA_TYPES_DATATYPEATTRIBUTES];
+    case NodeClass::View:
+        return &UA_TYPES[UA_TYPES_VIEWATTRIBUTES];
+    default:
+        return nullptr;
+    }
+}
+
+ExtensionObject readNodeAttributes(
+    Server& server, const NodeId& id, NodeClass nodeClass, bool withValue
+) {
+    const auto* type = getAttributesType(nodeClass);
+    if (type == nullptr) {
+        throw BadStatus(UA_STATUSCODE_BADNODECLASSINVALID);
+    }
+    ExtensionObject result;
+    auto& eo = *result.handle();  // owns the attributes from here on
+    eo.encoding = UA_EXTENSIONOBJECT_DECODED;
+    eo.content.decoded.type = type;
+    eo.content.decoded.data = allocate<void>(*type);
+    readAttributes(server.handle(), id, nodeClass, eo.content.decoded.data, withValue);
+    return result;
+}
+
+NodeInsertionResult insertNodes(Server& server, const std::vector<NodeRecord>& nodes) {
+    NodeInsertionResult result;
+    const auto resolved = resolveNodes(nodes);
+    const auto order = sortNodes(resolved);
+
+    // 1. add nodes with parent and type definition references, without type checks
+    auto& begun = result.inserted;
+    begun.assign(nodes.size(), false);
+    for (const size_t i : order) {
+        const auto status = addNodeBegin(server, nodes[i], resolved[i]);
+        if (status.isBad()) {
+            result.errors.emplace_back(nodes[i].id, status);
+        }
+        begun[i] = status.isGood();
+    }
+
+    // 2. add the remaining references, now that all targets exist
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        const auto& refs = nodes[i].references;
+        for (size_t j = 0; j < refs.size(); ++j) {
+            if (begun[i] && (j == resolved[i].parentReference || j == resolved[i].typeReference)) {
+                continue;
+            }
+            const auto status = UA_Server_addReference(
+                server.handle(),
+                *nodes[i].id.handle(),
+                *refs[j].type.handle(),
+                *ExpandedNodeId(refs[j].target).handle(),
+                refs[j].forward
+            );
+            if (status == UA_STATUSCODE_GOOD) {
+                ++result.references;
+                if (!begun[i]) {
+                    result.foreignReferences.emplace_back(i, j);
+                }
+            } else if (status != UA_STATUSCODE_BADDUPLICATEREFERENCENOTALLOWED) {
+                result.errors.emplace_back(nodes[i].id, status);
+            }
+        }
+    }
+
+    // 3. finish nodes with type checks and constructors, types first
+    for (const bool types : {true, false}) {
+        for (const size_t i : order) {
+            if (!begun[i] || isTypeNodeClass(nodes[i].nodeClass) != types) {
+                continue;
+            }
+            const StatusCode status = UA_Server_addNode_finish(
+                server.handle(), *nodes[i].id.handle()
+            );
+            if (status.isBad()) {
+                result.errors.emplace_back(nodes[i].id, status);
+            } else {
+                ++result.nodes;
+            }
+        }
+    }
+    getContext(server).notifyAddressSpaceChange();
+    return result;
+}
+
+}  // namespace opcua::detail
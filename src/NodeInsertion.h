@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>  // pair
+#include <vector>
+
+#include "open62541pp/Common.h"  // NodeClass
+#include "open62541pp/open62541.h"
+#include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/ExtensionObject.h"
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua {
+class Server;
+}  // namespace opcua
+
+namespace opcua::detail {
+
+struct NodeRecordReference {
+    NodeId type;
+    NodeId target;
+    bool forward;
+};
+
+/// Node to insert with all its references, e.g. parsed from a nodeset or a snapshot.
+struct NodeRecord {
+    NodeClass nodeClass;
+    NodeId id;
+    QualifiedName browseName;
+    NodeId parentId;  // preferred parent, the first inverse hierarchical reference if null
+    ExtensionObject attributes;  // decoded node attributes of the node class
+    std::vector<NodeRecordReference> references;
+};
+
+struct NodeInsertionResult {
+    size_t nodes{0};
+    size_t references{0};
+    std::vector<std::pair<NodeId, StatusCode>> errors;
+    std::vector<bool> inserted;  // per node, added with UA_Server_addNode_begin
+    /// References added to nodes that were not inserted (e.g. existing nodes), as indices of the
+    /// node and its reference. Not removed with the inserted nodes on rollback.
+    std::vector<std::pair<size_t, size_t>> foreignReferences;
+};
+
+/**
+ * Insert many nodes in bulk.
+ *
+ * Parent and type definition of each node are resolved from its references, the nodes are sorted
+ * after their dependencies (parent, reference type, type definition and data type) and added with
+ * `UA_Server_addNode_begin`. The remaining references are added once all nodes exist and
+ * `UA_Server_addNode_finish` (type checks, constructors, mandatory children) runs last, types
+ * first.
+ */
+NodeInsertionResult insertNodes(Server& server, const std::vector<NodeRecord>& nodes);
+
+/// Data type of the node attributes of the node class (e.g. `UA_ObjectAttributes`).
+const UA_DataType* getAttributesType(NodeClass nodeClass) noexcept;
+
+/**
+ * Read the attributes of an existing node into a decoded ExtensionObject of the node class'
+ * attributes type. Attributes that can not be read are left zero-initialized.
+ * @param withValue Read the value of variables and variable types, skipped otherwise
+ * @exception BadStatus (BadNodeClassInvalid) If the node class is unspecified
+ */
+ExtensionObject readNodeAttributes(
+    Server& server, const NodeId& id, NodeClass nodeClass, bool withValue = true
+);
+
+constexpr bool isTypeNodeClass(NodeClass nodeClass) noexcept {
+    return nodeClass == NodeClass::ObjectType || nodeClass == NodeClass::VariableType ||
+           nodeClass == NodeClass::ReferenceType || nodeClass == NodeClass::DataType;
+}
+
+}  // namespace opcua::detail
@@ -0,0 +1,1355 @@
+#include "open62541pp/NodeSetImporter.h"
+
+#include <algorithm>  // min
+#include <array>
+#include <charconv>  // from_chars
+#include <cstdint>
+#include <cstdlib>  // strtod
+#include <cstring>  // memcpy
+#include <fstream>
+#include <iterator>  // istreambuf_iterator
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>  // move
+
+#include "open62541pp/Common.h"  // NodeClass
+#include "open62541pp/Config.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/detail/helper.h"  // allocNativeString
+#include "open62541pp/types/Variant.h"
+
+#include "NodeInsertion.h"
+#include "open62541_impl.h"
+
+namespace opcua {
+
+namespace {
+
+[[noreturn]] void throwDecodingError() {
+    throw BadStatus(UA_STATUSCODE_BADDECODINGERROR);
+}
+
+constexpr bool isSpace(char c) noexcept {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+std::string_view trim(std::string_view str) noexcept {
+    while (!str.empty() && isSpace(str.front())) {
+        str.remove_prefix(1);
+    }
+    while (!str.empty() && isSpace(str.back())) {
+        str.remove_suffix(1);
+    }
+    return str;
+}
+
+std::string_view stripPrefix(std::string_view name) noexcept {
+    const auto pos = name.find(':');
+    return pos == std::string_view::npos ? name : name.substr(pos + 1);
+}
+
+template <typename T>
+bool parseInteger(std::string_view str, T& value, int base = 10) noexcept {
+    str = trim(str);
+    if (!str.empty() && str.front() == '+') {
+        str.remove_prefix(1);
+    }
+    const auto* end = str.data() + str.size();  // NOLINT
+    const auto result = std::from_chars(str.data(), end, value, base);
+    return !str.empty() && result.ec == std::errc{} && result.ptr == end;
+}
+
+bool parseDouble(std::string_view str, double& value) {
+    const std::string copy(trim(str));  // null-terminated for strtod
+    char* end = nullptr;
+    value = std::strtod(copy.c_str(), &end);
+    return !copy.empty() && end == copy.c_str() + copy.size();  // NOLINT
+}
+
+bool parseBoolean(std::string_view str, bool& value) noexcept {
+    str = trim(str);
+    if (str == "true" || str == "1") {
+        value = true;
+        return true;
+    }
+    if (str == "false" || str == "0") {
+        value = false;
+        return true;
+    }
+    return false;
+}
+
+void appendUtf8(uint32_t code, std::string& out) {
+    if (code < 0x80) {
+        out += static_cast<char>(code);
+    } else if (code < 0x800) {
+        out += static_cast<char>(0xC0 | (code >> 6));
+        out += static_cast<char>(0x80 | (code & 0x3F));
+    } else if (code < 0x10000) {
+        out += static_cast<char>(0xE0 | (code >> 12));
+        out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (code & 0x3F));
+    } else {
+        out += static_cast<char>(0xF0 | (code >> 18));
+        out += static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (code & 0x3F));
+    }
+}
+
+/// Append text with decoded character and entity references.
+void appendDecoded(std::string_view raw, std::string& out) {
+    while (!raw.empty()) {
+        const auto amp = raw.find('&');
+        out.append(raw.substr(0, amp));
+        if (amp == std::string_view::npos) {
+            return;
+        }
+        raw.remove_prefix(amp);
+        const auto semicolon = raw.find(';');
+        if (semicolon == std::string_view::npos) {
+            throwDecodingError();
+        }
+        const auto entity = raw.substr(1, semicolon - 1);
+        raw.remove_prefix(semicolon + 1);
+        if (entity == "lt") {
+            out += '<';
+        } else if (entity == "gt") {
+            out += '>';
+        } else if (entity == "amp") {
+            out += '&';
+        } else if (entity == "quot") {
+            out += '"';
+        } else if (entity == "apos") {
+            out += '\'';
+        } else if (entity.size() > 1 && entity[0] == '#') {
+            uint32_t code = 0;
+            const bool hex = entity[1] == 'x' || entity[1] == 'X';
+            if (!parseInteger(entity.substr(hex ? 2 : 1), code, hex ? 16 : 10)) {
+                throwDecodingError();
+            }
+            appendUtf8(code, out);
+        } else {
+            throwDecodingError();
+        }
+    }
+}
+
+/**
+ * Minimal pull parser for XML documents.
+ * Comments, processing instructions and the document type declaration are skipped. Element names
+ * are returned without namespace prefix. The document must outlive the reader.
+ */
+class XmlReader {
+public:
+    enum class Event { Start, End, Text, Eof };
+
+    explicit XmlReader(std::string_view xml) noexcept
+        : xml_(xml) {}
+
+    Event next() {
+        if (pendingEnd_) {
+            pendingEnd_ = false;
+            return Event::End;
+        }
+        while (pos_ < xml_.size()) {
+            if (xml_[pos_] != '<') {
+                const auto end = std::min(xml_.find('<', pos_), xml_.size());
+                text_.clear();
+                appendDecoded(xml_.substr(pos_, end - pos_), text_);
+                pos_ = end;
+                return Event::Text;
+            }
+            const auto rest = xml_.substr(pos_);
+            if (rest.substr(0, 4) == "<!--") {
+                pos_ = find("-->", pos_ + 4) + 3;
+            } else if (rest.substr(0, 9) == "<![CDATA[") {
+                const auto end = find("]]>", pos_ + 9);
+                text_.assign(xml_.substr(pos_ + 9, end - pos_ - 9));
+                pos_ = end + 3;
+                return Event::Text;
+            } else if (rest.substr(0, 2) == "<?") {
+                pos_ = find("?>", pos_ + 2) + 2;
+            } else if (rest.substr(0, 2) == "<!") {
+                pos_ = find(">", pos_ + 2) + 1;
+            } else if (rest.substr(0, 2) == "</") {
+                const auto end = find(">", pos_ + 2);
+                name_ = stripPrefix(trim(xml_.substr(pos_ + 2, end - pos_ - 2)));
+                pos_ = end + 1;
+                return Event::End;
+            } else {
+                return readStartTag();
+            }
+        }
+        return Event::Eof;
+    }
+
+    /// Name of the current start or end element.
+    std::string_view name() const noexcept {
+        return name_;
+    }
+
+    /// Decoded text of the current text event.
+    const std::string& text() const noexcept {
+        return text_;
+    }
+
+    /// Decoded attribute of the current start element.
+    std::optional<std::string> attribute(std::string_view key) const {
+        auto attributes = attributes_;
+        while (true) {
+            attributes = trim(attributes);
+            const auto equal = attributes.find('=');
+            if (equal == std::string_view::npos) {
+                return std::nullopt;
+            }
+            const auto currentKey = trim(attributes.substr(0, equal));
+            attributes = trim(attributes.substr(equal + 1));
+            if (attributes.empty() || (attributes[0] != '"' && attributes[0] != '\'')) {
+                throwDecodingError();
+            }
+            const auto end = attributes.find(attributes[0], 1);
+            if (end == std::string_view::npos) {
+                throwDecodingError();
+            }
+            if (currentKey == key) {
+                std::string value;
+                appendDecoded(attributes.substr(1, end - 1), value);
+                return value;
+            }
+            attributes.remove_prefix(end + 1);
+        }
+    }
+
+    /// Read the text content of the current element (after a start event) until its end.
+    /// Text of nested elements is ignored.
+    std::string readText() {
+        std::string result;
+        size_t depth = 0;
+        while (true) {
+            switch (next()) {
+            case Event::Text:
+                if (depth == 0) {
+                    result += text_;
+                }
+                break;
+            case Event::Start:
+                ++depth;
+                break;
+            case Event::End:
+                if (depth == 0) {
+                    return result;
+                }
+                --depth;
+                break;
+            case Event::Eof:
+                throwDecodingError();
+            }
+        }
+    }
+
+    /// Skip the current element (after a start event) until its end.
+    void skip() {
+        size_t depth = 0;
+        while (true) {
+            switch (next()) {
+            case Event::Text:
+                break;
+            case Event::Start:
+                ++depth;
+                break;
+            case Event::End:
+                if (depth == 0) {
+                    return;
+                }
+                --depth;
+                break;
+            case Event::Eof:
+                throwDecodingError();
+            }
+        }
+    }
+
+    /// Advance to the next child element of the current element.
+    /// Return `false` at the end of the current element, text is ignored.
+    /// Each child must be consumed until its end (e.g. with readText or skip).
+    bool nextChild() {
+        while (true) {
+            switch (next()) {
+            case Event::Text:
+                break;
+            case Event::Start:
+                return true;
+            case Event::End:
+                return false;
+            case Event::Eof:
+                throwDecodingError();
+            }
+        }
+    }
+
+    /// Skip the remaining children of the current element.
+    void skipChildren() {
+        while (nextChild()) {
+            skip();
+        }
+    }
+
+private:
+    size_t find(std::string_view token, size_t pos) const {
+        const auto result = xml_.find(token, pos);
+        if (result == std::string_view::npos) {
+            throwDecodingError();
+        }
+        return result;
+    }
+
+    Event readStartTag() {
+        // find end of tag, '>' might be part of attribute values
+        size_t end = pos_ + 1;
+        char quote = 0;
+        for (; end < xml_.size(); ++end) {
+            const char c = xml_[end];
+            if (quote != 0) {
+                quote = (c == quote) ? 0 : quote;
+            } else if (c == '"' || c == '\'') {
+                quote = c;
+            } else if (c == '>') {
+                break;
+            }
+        }
+        if (end >= xml_.size()) {
+            throwDecodingError();
+        }
+        auto tag = xml_.substr(pos_ + 1, end - pos_ - 1);
+        pos_ = end + 1;
+        pendingEnd_ = !tag.empty() && tag.back() == '/';
+        if (pendingEnd_) {
+            tag.remove_suffix(1);
+        }
+        size_t nameEnd = 0;
+        while (nameEnd < tag.size() && !isSpace(tag[nameEnd])) {
+            ++nameEnd;
+        }
+        if (nameEnd == 0) {
+            throwDecodingError();
+        }
+        name_ = stripPrefix(tag.substr(0, nameEnd));
+        attributes_ = tag.substr(nameEnd);
+        return Event::Start;
+    }
+
+    std::string_view xml_;
+    size_t pos_{0};
+    std::string_view name_;
+    std::string_view attributes_;
+    std::string text_;
+    bool pendingEnd_{false};  // end event of a self-closing element
+};
+
+/* ------------------------------------------ Decoding ------------------------------------------ */
+
+bool decodeBase64(std::string_view str, std::vector<uint8_t>& bytes) {
+    bytes.clear();
+    bytes.reserve(str.size() * 3 / 4);
+    uint32_t buffer = 0;
+    int bits = 0;
+    for (const char c : str) {
+        uint32_t value = 0;
+        if (c >= 'A' && c <= 'Z') {
+            value = c - 'A';
+        } else if (c >= 'a' && c <= 'z') {
+            value = c - 'a' + 26;
+        } else if (c >= '0' && c <= '9') {
+            value = c - '0' + 52;
+        } else if (c == '+') {
+            value = 62;
+        } else if (c == '/') {
+            value = 63;
+        } else if (c == '=') {
+            break;
+        } else if (isSpace(c)) {
+            continue;
+        } else {
+            return false;
+        }
+        buffer = (buffer << 6U) | value;
+        bits += 6;
+        if (bits >= 8) {
+            bits -= 8;
+            bytes.push_back(static_cast<uint8_t>(buffer >> static_cast<uint32_t>(bits)));
+        }
+    }
+    return true;
+}
+
+bool parseGuid(std::string_view str, UA_Guid& guid) noexcept {
+    // format: C496578A-0DFE-4B8F-870A-745238C6AEAE
+    str = trim(str);
+    if (str.size() != 36 || str[8] != '-' || str[13] != '-' || str[18] != '-' || str[23] != '-') {
+        return false;
+    }
+    bool ok = parseInteger(str.substr(0, 8), guid.data1, 16) &&
+              parseInteger(str.substr(9, 4), guid.data2, 16) &&
+              parseInteger(str.substr(14, 4), guid.data3, 16);
+    for (size_t i = 0; i < 8 && ok; ++i) {
+        const size_t offset = i < 2 ? 19 + 2 * i : 24 + 2 * (i - 2);
+        ok = parseInteger(str.substr(offset, 2), guid.data4[i], 16);  // NOLINT
+    }
+    return ok;
+}
+
+constexpr int64_t daysFromCivil(int64_t year, int64_t month, int64_t day) noexcept {
+    // https://howardhinnant.github.io/date_algorithms.html#days_from_civil
+    year -= month <= 2 ? 1 : 0;
+    const int64_t era = (year >= 0 ? year : year - 399) / 400;
+    const int64_t yoe = year - era * 400;
+    const int64_t doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    const int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+bool parseDateTime(std::string_view str, UA_DateTime& dt) noexcept {
+    // format: 2024-01-31T12:00:00.123Z, optional fraction and time zone offset
+    str = trim(str);
+    int64_t year = 0;
+    int64_t month = 0;
+    int64_t day = 0;
+    int64_t hour = 0;
+    int64_t minute = 0;
+    int64_t second = 0;
+    if (str.size() < 19 || str[4] != '-' || str[7] != '-' || str[10] != 'T' || str[13] != ':' ||
+        str[16] != ':' || !parseInteger(str.substr(0, 4), year) ||
+        !parseInteger(str.substr(5, 2), month) || !parseInteger(str.substr(8, 2), day) ||
+        !parseInteger(str.substr(11, 2), hour) || !parseInteger(str.substr(14, 2), minute) ||
+        !parseInteger(str.substr(17, 2), second)) {
+        return false;
+    }
+    str.remove_prefix(19);
+    int64_t fraction = 0;  // in 100 ns
+    if (!str.empty() && str[0] == '.') {
+        str.remove_prefix(1);
+        int64_t scale = UA_DATETIME_SEC;
+        while (!str.empty() && str[0] >= '0' && str[0] <= '9') {
+            scale /= 10;
+            fraction += (str[0] - '0') * scale;
+            str.remove_prefix(1);
+        }
+    }
+    int64_t offset = 0;  // in minutes
+    if (str.size() == 6 && (str[0] == '+' || str[0] == '-') && str[3] == ':') {
+        int64_t offsetHours = 0;
+        int64_t offsetMinutes = 0;
+        if (!parseInteger(str.substr(1, 2), offsetHours) ||
+            !parseInteger(str.substr(4, 2), offsetMinutes)) {
+            return false;
+        }
+        offset = (str[0] == '-' ? -1 : 1) * (offsetHours * 60 + offsetMinutes);
+    } else if (!str.empty() && str != "Z") {
+        return false;
+    }
+    const int64_t seconds = daysFromCivil(year, month, day) * 86400 + hour * 3600 + minute * 60 +
+                            second - offset * 60;
+    dt = UA_DATETIME_UNIX_EPOCH + seconds * UA_DATETIME_SEC + fraction;
+    return true;
+}
+
+const UA_DataType* getMemberType(const UA_DataTypeMember& member) noexcept {
+#if UAPP_OPEN62541_VER_GE(1, 3)
+    return member.memberType;
+#else
+    return member.namespaceZero ? &UA_TYPES[member.memberTypeIndex] : nullptr;  // NOLINT
+#endif
+}
+
+/// Find a type of namespace zero by its name in the XML encoding.
+const UA_DataType* findType(std::string_view name) {
+    static const auto types = [] {
+        std::unordered_map<std::string_view, const UA_DataType*> map;
+#ifdef UA_ENABLE_TYPEDESCRIPTION
+        for (size_t i = 0; i < UA_TYPES_COUNT; ++i) {
+            map.emplace(UA_TYPES[i].typeName, &UA_TYPES[i]);  // NOLINT
+        }
+#else
+        // builtin types only, in the order of their type indices
+        constexpr std::array<std::string_view, UA_TYPES_DIAGNOSTICINFO> names{
+            "Boolean",       "SByte",           "Byte",       "Int16",      "UInt16",
+            "Int32",         "UInt32",          "Int64",      "UInt64",     "Float",
+            "Double",        "String",          "DateTime",   "Guid",       "ByteString",
+            "XmlElement",    "NodeId",          "ExpandedNodeId", "StatusCode", "QualifiedName",
+            "LocalizedText", "ExtensionObject", "DataValue",  "Variant",
+        };
+        for (size_t i = 0; i < names.size(); ++i) {
+            map.emplace(names[i], &UA_TYPES[i]);  // NOLINT
+        }
+#endif
+        return map;
+    }();
+    const auto it = types.find(name);
+    return it == types.end() ? nullptr : it->second;
+}
+
+/**
+ * Growable buffer of values of one data type, moved into an array or scalar Variant.
+ * Values are relocated with memcpy, which is valid for all open62541 types.
+ */
+class ValueBuffer {
+public:
+    ValueBuffer() = default;
+
+    ~ValueBuffer() {
+        for (size_t i = 0; i < size_; ++i) {
+            UA_clear(at(i), type_);
+        }
+    }
+
+    ValueBuffer(const ValueBuffer&) = delete;
+    ValueBuffer(ValueBuffer&&) noexcept = delete;
+    ValueBuffer& operator=(const ValueBuffer&) = delete;
+    ValueBuffer& operator=(ValueBuffer&&) noexcept = delete;
+
+    /// Append an initialized value, `nullptr` if the buffer has another type.
+    void* append(const UA_DataType* type) {
+        if (type_ == nullptr) {
+            type_ = type;
+        }
+        if (type_ != type) {
+            return nullptr;
+        }
+        data_.resize((size_ + 1) * type_->memSize);
+        void* value = at(size_++);
+        UA_init(value, type_);
+        return value;
+    }
+
+    /// Remove the last value.
+    void pop() noexcept {
+        UA_clear(at(--size_), type_);
+    }
+
+    /// Move the values into a new array, `emptyType` is used if the buffer is empty.
+    void* releaseArray(const UA_DataType* emptyType, size_t& size) {
+        const auto* type = type_ == nullptr ? emptyType : type_;
+        void* array = UA_Array_new(size_, type);
+        if (array == nullptr) {
+            throw std::bad_alloc();
+        }
+        if (size_ > 0) {
+            std::memcpy(array, data_.data(), size_ * type->memSize);
+        }
+        size = size_;
+        size_ = 0;
+        return array;
+    }
+
+    void moveToArray(Variant& variant, const UA_DataType* emptyType) {
+        const auto* type = type_ == nullptr ? emptyType : type_;
+        size_t size = 0;
+        void* array = releaseArray(emptyType, size);
+        UA_Variant_setArray(variant.handle(), array, size, type);
+    }
+
+    void moveToScalar(Variant& variant) {
+        void* scalar = UA_new(type_);
+        if (scalar == nullptr) {
+            throw std::bad_alloc();
+        }
+        std::memcpy(scalar, data_.data(), type_->memSize);
+        UA_Variant_setScalar(variant.handle(), scalar, type_);
+        size_ = 0;
+    }
+
+private:
+    void* at(size_t index) noexcept {
+        return data_.data() + index * type_->memSize;  // NOLINT
+    }
+
+    const UA_DataType* type_{nullptr};
+    std::vector<uint8_t> data_;
+    size_t size_{0};
+};
+
+/* ------------------------------------------- Nodes -------------------------------------------- */
+
+struct NodeSetNode {
+    NodeClass nodeClass;
+    NodeId id;
+    QualifiedName browseName;
+    NodeId parentId;  // ParentNodeId attribute
+    LocalizedText displayName;
+    LocalizedText description;
+    LocalizedText inverseName;
+    NodeId dataType{DataTypeId::BaseDataType};
+    int32_t valueRank{-1};
+    std::vector<uint32_t> arrayDimensions;
+    uint8_t accessLevel{1};
+    uint8_t userAccessLevel{1};
+    double minimumSamplingInterval{0.0};
+    bool historizing{false};
+    bool isAbstract{false};
+    bool symmetric{false};
+    bool containsNoLoops{false};
+    bool executable{true};
+    bool userExecutable{true};
+    uint8_t eventNotifier{0};
+    Variant value;
+    std::vector<detail::NodeRecordReference> references;
+};
+
+std::optional<NodeClass> getNodeClass(std::string_view element) noexcept {
+    if (element == "UAObject") {
+        return NodeClass::Object;
+    }
+    if (element == "UAVariable") {
+        return NodeClass::Variable;
+    }
+    if (element == "UAMethod") {
+        return NodeClass::Method;
+    }
+    if (element == "UAObjectType") {
+        return NodeClass::ObjectType;
+    }
+    if (element == "UAVariableType") {
+        return NodeClass::VariableType;
+    }
+    if (element == "UAReferenceType") {
+        return NodeClass::ReferenceType;
+    }
+    if (element == "UADataType") {
+        return NodeClass::DataType;
+    }
+    if (element == "UAView") {
+        return NodeClass::View;
+    }
+    return std::nullopt;
+}
+
+/// Parser of NodeSet2 documents, nodes are collected and inserted afterwards.
+class NodeSetParser {
+public:
+    NodeSetParser(Server& server, std::string_view xml)
+        : server_(server),
+          reader_(xml) {}
+
+    std::vector<NodeSetNode> parse() {
+        // root element
+        if (!reader_.nextChild() || reader_.name() != "UANodeSet") {
+            throwDecodingError();
+        }
+        while (reader_.nextChild()) {
+            const auto name = reader_.name();
+            if (name == "NamespaceUris") {
+                parseNamespaceUris();
+            } else if (name == "Aliases") {
+                parseAliases();
+            } else if (const auto nodeClass = getNodeClass(name)) {
+                parseNode(*nodeClass);
+            } else {
+                reader_.skip();  // Models, ServerUris, Extensions
+            }
+        }
+        return std::move(nodes_);
+    }
+
+    const std::vector<std::pair<NodeId, StatusCode>>& getErrors() const noexcept {
+        return errors_;
+    }
+
+private:
+    void parseNamespaceUris() {
+        while (reader_.nextChild()) {
+            if (reader_.name() == "Uri") {
+                namespaces_.push_back(server_.registerNamespace(trim(reader_.readText())));
+            } else {
+                reader_.skip();
+            }
+        }
+    }
+
+    void parseAliases() {
+        while (reader_.nextChild()) {
+            if (reader_.name() == "Alias") {
+                auto alias = reader_.attribute("Alias");
+                if (!alias) {
+                    throwDecodingError();
+                }
+                aliases_.insert_or_assign(std::move(*alias), parseNodeId(reader_.readText()));
+            } else {
+                reader_.skip();
+            }
+        }
+    }
+
+    uint16_t mapNamespace(std::string_view index) const {
+        uint16_t value = 0;
+        if (!parseInteger(index, value) || value >= namespaces_.size()) {
+            throwDecodingError();
+        }
+        return namespaces_[value];
+    }
+
+    NodeId parseNodeId(std::string_view str) {
+        str = trim(str);
+        if (str.find('=') == std::string_view::npos) {
+            const auto it = aliases_.find(std::string(str));
+            if (it == aliases_.end()) {
+                throwDecodingError();
+            }
+            return it->second;
+        }
+        uint16_t ns = 0;
+        if (str.substr(0, 3) == "ns=" || str.substr(0, 4) == "nsu=") {
+            const auto semicolon = str.find(';');
+            if (semicolon == std::string_view::npos) {
+                throwDecodingError();
+            }
+            ns = str[2] == '='
+                     ? mapNamespace(str.substr(3, semicolon - 3))
+                     : server_.registerNamespace(str.substr(4, semicolon - 4));
+            str.remove_prefix(semicolon + 1);
+        }
+        if (str.size() < 2 || str[1] != '=') {
+            throwDecodingError();
+        }
+        const auto identifier = str.substr(2);
+        switch (str[0]) {
+        case 'i': {
+            uint32_t numeric = 0;
+            if (!parseInteger(identifier, numeric)) {
+                throwDecodingError();
+            }
+            return {ns, numeric};
+        }
+        case 's':
+            return {ns, identifier};
+        case 'g': {
+            Guid guid;
+            if (!parseGuid(identifier, *guid.handle())) {
+                throwDecodingError();
+            }
+            return {ns, guid};
+        }
+        case 'b': {
+            std::vector<uint8_t> bytes;
+            if (!decodeBase64(identifier, bytes)) {
+                throwDecodingError();
+            }
+            return {ns, ByteString(bytes)};
+        }
+        default:
+            throwDecodingError();
+        }
+    }
+
+    QualifiedName parseQualifiedName(std::string_view str) const {
+        const auto colon = str.find(':');
+        uint16_t index = 0;  // only checked, mapped below
+        if (colon != std::string_view::npos && parseInteger(str.substr(0, colon), index)) {
+            return {mapNamespace(str.substr(0, colon)), str.substr(colon + 1)};
+        }
+        return {0, str};
+    }
+
+    LocalizedText parseLocalizedText() {
+        const auto locale = reader_.attribute("Locale");
+        const auto text = reader_.readText();
+        return {locale.value_or(""), text, false};
+    }
+
+    void parseNode(NodeClass nodeClass) {
+        auto& node = nodes_.emplace_back();
+        node.nodeClass = nodeClass;
+        const auto id = reader_.attribute("NodeId");
+        const auto browseName = reader_.attribute("BrowseName");
+        if (!id || !browseName) {
+            throwDecodingError();
+        }
+        node.id = parseNodeId(*id);
+        node.browseName = parseQualifiedName(*browseName);
+        if (const auto value = reader_.attribute("ParentNodeId")) {
+            node.parentId = parseNodeId(*value);
+        }
+        if (const auto value = reader_.attribute("DataType")) {
+            node.dataType = parseNodeId(*value);
+        }
+        parseAttribute("ValueRank", node.valueRank);
+        if (const auto value = reader_.attribute("ArrayDimensions")) {
+            std::string_view dimensions(*value);
+            while (!trim(dimensions).empty()) {
+                const auto comma = std::min(dimensions.find(','), dimensions.size());
+                auto& dimension = node.arrayDimensions.emplace_back();
+                if (!parseInteger(dimensions.substr(0, comma), dimension)) {
+                    throwDecodingError();
+                }
+                dimensions.remove_prefix(std::min(comma + 1, dimensions.size()));
+            }
+        }
+        parseAttribute("AccessLevel", node.accessLevel);
+        node.userAccessLevel = node.accessLevel;
+        parseAttribute("UserAccessLevel", node.userAccessLevel);
+        parseAttribute("EventNotifier", node.eventNotifier);
+        if (const auto value = reader_.attribute("MinimumSamplingInterval")) {
+            if (!parseDouble(*value, node.minimumSamplingInterval)) {
+                throwDecodingError();
+            }
+        }
+        parseAttribute("Historizing", node.historizing);
+        parseAttribute("IsAbstract", node.isAbstract);
+        parseAttribute("Symmetric", node.symmetric);
+        parseAttribute("ContainsNoLoops", node.containsNoLoops);
+        parseAttribute("Executable", node.executable);
+        node.userExecutable = node.executable;
+        parseAttribute("UserExecutable", node.userExecutable);
+
+        bool hasDisplayName = false;
+        while (reader_.nextChild()) {
+            const auto name = reader_.name();
+            if (name == "DisplayName" && !hasDisplayName) {
+                node.displayName = parseLocalizedText();  // first (default) locale
+                hasDisplayName = true;
+            } else if (name == "Description" && node.description.getText().empty()) {
+                node.description = parseLocalizedText();
+            } else if (name == "InverseName" && node.inverseName.getText().empty()) {
+                node.inverseName = parseLocalizedText();
+            } else if (name == "References") {
+                parseReferences(node);
+            } else if (name == "Value") {
+                parseValue(node);
+            } else {
+                reader_.skip();  // Definition, RolePermissions, Extensions, ...
+            }
+        }
+        if (!hasDisplayName) {
+            node.displayName = LocalizedText("", node.browseName.getName(), false);
+        }
+    }
+
+    template <typename T>
+    void parseAttribute(std::string_view key, T& value) const {
+        const auto attribute = reader_.attribute(key);
+        if (!attribute) {
+            return;
+        }
+        bool ok = false;
+        if constexpr (std::is_same_v<T, bool>) {
+            ok = parseBoolean(*attribute, value);
+        } else {
+            ok = parseInteger(*attribute, value);
+        }
+        if (!ok) {
+            throwDecodingError();
+        }
+    }
+
+    void parseReferences(NodeSetNode& node) {
+        while (reader_.nextChild()) {
+            if (reader_.name() != "Reference") {
+                reader_.skip();
+                continue;
+            }
+            auto& reference = node.references.emplace_back();
+            const auto type = reader_.attribute("ReferenceType");
+            if (!type) {
+                throwDecodingError();
+            }
+            reference.type = parseNodeId(*type);
+            reference.forward = true;
+            parseAttribute("IsForward", reference.forward);
+            reference.target = parseNodeId(reader_.readText());
+        }
+    }
+
+    void parseValue(NodeSetNode& node) {
+        if (!reader_.nextChild()) {
+            return;  // empty value
+        }
+        const StatusCode status = readVariant(node.value);
+        reader_.skipChildren();
+        if (status.isBad()) {
+            node.value = Variant();
+            errors_.emplace_back(node.id, status);
+        }
+    }
+
+    /// Read a scalar or array (ListOf...) variant of the current element.
+    StatusCode readVariant(Variant& variant) {
+        auto name = reader_.name();
+        const bool isArray = name.substr(0, 6) == "ListOf";
+        if (isArray) {
+            name.remove_prefix(6);
+        }
+        const auto* type = findType(name);
+        if (type == nullptr) {
+            reader_.skip();
+            return UA_STATUSCODE_BADDATAENCODINGUNSUPPORTED;
+        }
+        // extension objects are stored decoded with the type of their body
+        const bool unwrap = type->typeKind == UA_DATATYPEKIND_EXTENSIONOBJECT;
+        ValueBuffer buffer;
+        auto readElement = [&]() -> StatusCode {
+            if (!unwrap) {
+                void* value = buffer.append(type);
+                const auto status = readTyped(type, value);
+                if (status.isBad()) {
+                    buffer.pop();
+                }
+                return status;
+            }
+            UA_ExtensionObject eo;
+            UA_ExtensionObject_init(&eo);
+            StatusCode status = readTyped(type, &eo);
+            if (status.isGood() && eo.encoding == UA_EXTENSIONOBJECT_DECODED) {
+                void* value = buffer.append(eo.content.decoded.type);
+                if (value != nullptr) {
+                    std::memcpy(value, eo.content.decoded.data, eo.content.decoded.type->memSize);
+                    UA_free(eo.content.decoded.data);  // shallow, the content is moved
+                    return UA_STATUSCODE_GOOD;
+                }
+            }
+            UA_ExtensionObject_clear(&eo);
+            return status.isBad() ? status : UA_STATUSCODE_BADDATAENCODINGUNSUPPORTED;
+        };
+        if (!isArray) {
+            const auto status = readElement();
+            if (status.isGood()) {
+                buffer.moveToScalar(variant);
+            }
+            return status;
+        }
+        while (reader_.nextChild()) {
+            const auto status = readElement();
+            if (status.isBad()) {
+                reader_.skipChildren();
+                return status;
+            }
+        }
+        buffer.moveToArray(variant, type);
+        return UA_STATUSCODE_GOOD;
+    }
+
+    /// Read a value of the given type from the current element until its end.
+    /// On failure the value might be partially decoded and must be cleared.
+    StatusCode readTyped(const UA_DataType* type, void* value) {  // NOLINT, recursive
+        switch (type->typeKind) {
+        case UA_DATATYPEKIND_BOOLEAN:
+            return readText([&](auto text) {
+                return parseBoolean(text, *static_cast<bool*>(value));
+            });
+        case UA_DATATYPEKIND_SBYTE:
+            return readInteger<UA_SByte>(value);
+        case UA_DATATYPEKIND_BYTE:
+            return readInteger<UA_Byte>(value);
+        case UA_DATATYPEKIND_INT16:
+            return readInteger<UA_Int16>(value);
+        case UA_DATATYPEKIND_UINT16:
+            return readInteger<UA_UInt16>(value);
+        case UA_DATATYPEKIND_INT32:
+            return readInteger<UA_Int32>(value);
+        case UA_DATATYPEKIND_UINT32:
+            return readInteger<UA_UInt32>(value);
+        case UA_DATATYPEKIND_INT64:
+            return readInteger<UA_Int64>(value);
+        case UA_DATATYPEKIND_UINT64:
+            return readInteger<UA_UInt64>(value);
+        case UA_DATATYPEKIND_FLOAT:
+            return readText([&](auto text) {
+                double number = 0.0;
+                if (!parseDouble(text, number)) {
+                    return false;
+                }
+                *static_cast<UA_Float*>(value) = static_cast<UA_Float>(number);
+                return true;
+            });
+        case UA_DATATYPEKIND_DOUBLE:
+            return readText([&](auto text) {
+                return parseDouble(text, *static_cast<double*>(value));
+            });
+        case UA_DATATYPEKIND_STRING:
+            *static_cast<UA_String*>(value) = detail::allocNativeString(reader_.readText());
+            return UA_STATUSCODE_GOOD;
+        case UA_DATATYPEKIND_BYTESTRING:
+            return readText([&](auto text) {
+                std::vector<uint8_t> bytes;
+                if (!decodeBase64(text, bytes)) {
+                    return false;
+                }
+                *static_cast<UA_ByteString*>(value) = detail::allocNativeString(
+                    {reinterpret_cast<const char*>(bytes.data()), bytes.size()}  // NOLINT
+                );
+                return true;
+            });
+        case UA_DATATYPEKIND_DATETIME:
+            return readText([&](auto text) {
+                return parseDateTime(text, *static_cast<UA_DateTime*>(value));
+            });
+        case UA_DATATYPEKIND_GUID:
+            return readMembers([&](auto name) -> std::optional<StatusCode> {
+                if (name != "String") {
+                    return std::nullopt;
+                }
+                return readText([&](auto text) {
+                    return parseGuid(text, *static_cast<UA_Guid*>(value));
+                });
+            });
+        case UA_DATATYPEKIND_NODEID:
+        case UA_DATATYPEKIND_EXPANDEDNODEID: {
+            auto* nodeId = type->typeKind == UA_DATATYPEKIND_NODEID
+                               ? static_cast<UA_NodeId*>(value)
+                               : &static_cast<UA_ExpandedNodeId*>(value)->nodeId;
+            return readMembers([&](auto name) -> std::optional<StatusCode> {
+                if (name != "Identifier") {
+                    return std::nullopt;
+                }
+                UA_NodeId_clear(nodeId);
+                return UA_NodeId_copy(parseNodeId(reader_.readText()).handle(), nodeId);
+            });
+        }
+        case UA_DATATYPEKIND_STATUSCODE:
+            return readMembers([&](auto name) -> std::optional<StatusCode> {
+                if (name != "Code") {
+                    return std::nullopt;
+                }
+                return readInteger<UA_StatusCode>(value);
+            });
+        case UA_DATATYPEKIND_QUALIFIEDNAME: {
+            auto* qn = static_cast<UA_QualifiedName*>(value);
+            return readMembers([&](auto name) -> std::optional<StatusCode> {
+                if (name == "NamespaceIndex") {
+                    qn->namespaceIndex = mapNamespace(reader_.readText());
+                    return UA_STATUSCODE_GOOD;
+                }
+                if (name == "Name") {
+                    UA_String_clear(&qn->name);
+                    qn->name = detail::allocNativeString(reader_.readText());
+                    return UA_STATUSCODE_GOOD;
+                }
+                return std::nullopt;
+            });
+        }
+        case UA_DATATYPEKIND_LOCALIZEDTEXT: {
+            auto* lt = static_cast<UA_LocalizedText*>(value);
+            return readMembers([&](auto name) -> std::optional<StatusCode> {
+                UA_String* member = nullptr;
+                if (name == "Locale") {
+                    member = &lt->locale;
+                } else if (name == "Text") {
+                    member = &lt->text;
+                } else {
+                    return std::nullopt;
+                }
+                UA_String_clear(member);
+                *member = detail::allocNativeString(reader_.readText());
+                return UA_STATUSCODE_GOOD;
+            });
+        }
+        case UA_DATATYPEKIND_EXTENSIONOBJECT:
+            return readExtensionObject(*static_cast<UA_ExtensionObject*>(value));
+        case UA_DATATYPEKIND_ENUM:
+            // format: Name_Value
+            return readText([&](auto text) {
+                const auto underscore = text.rfind('_');
+                return parseInteger(
+                    underscore == std::string_view::npos ? text : text.substr(underscore + 1),
+                    *static_cast<UA_Int32*>(value)
+                );
+            });
+        case UA_DATATYPEKIND_STRUCTURE:
+            return readStructure(type, value);
+        default:
+            reader_.skip();
+            return UA_STATUSCODE_BADDATAENCODINGUNSUPPORTED;
+        }
+    }
+
+    template <typename Parse>
+    StatusCode readText(Parse&& parse) {
+        const auto text = reader_.readText();
+        return parse(std::string_view(text)) ? UA_STATUSCODE_GOOD : UA_STATUSCODE_BADDECODINGERROR;
+    }
+
+    template <typename T>
+    StatusCode readInteger(void* value) {
+        return readText([&](auto text) { return parseInteger(text, *static_cast<T*>(value)); });
+    }
+
+    /// Read the child elements of the current element until its end.
+    /// `read` consumes a known member and returns its status, `std::nullopt` for unknown members.
+    template <typename Read>
+    StatusCode readMembers(Read&& read) {
+        StatusCode result = UA_STATUSCODE_GOOD;
+        while (reader_.nextChild()) {
+            const auto status = read(reader_.name());
+            if (!status) {
+                reader_.skip();
+            } else if (result.isGood()) {
+                result = *status;
+            }
+        }
+        return result;
+    }
+
+    StatusCode readExtensionObject(UA_ExtensionObject& eo) {
+        StatusCode status = UA_STATUSCODE_BADDATAENCODINGUNSUPPORTED;
+        while (reader_.nextChild()) {
+            if (reader_.name() != "Body" || eo.encoding != UA_EXTENSIONOBJECT_ENCODED_NOBODY) {
+                reader_.skip();  // TypeId, the type is derived from the body element
+                continue;
+            }
+            if (!reader_.nextChild()) {
+                continue;  // empty body
+            }
+            const auto* type = findType(reader_.name());
+            if (type == nullptr || type->typeKind != UA_DATATYPEKIND_STRUCTURE) {
+                reader_.skip();
+                reader_.skipChildren();
+                continue;
+            }
+            void* data = UA_new(type);
+            if (data == nullptr) {
+                throw std::bad_alloc();
+            }
+            status = readTyped(type, data);
+            reader_.skipChildren();
+            if (status.isBad()) {
+                UA_delete(data, type);
+                continue;
+            }
+            eo.encoding = UA_EXTENSIONOBJECT_DECODED;
+            eo.content.decoded.type = type;
+            eo.content.decoded.data = data;
+        }
+        return status;
+    }
+
+    StatusCode readStructure(const UA_DataType* type, void* value) {  // NOLINT, recursive
+#ifdef UA_ENABLE_TYPEDESCRIPTION
+        StatusCode status = UA_STATUSCODE_GOOD;
+        while (reader_.nextChild()) {
+            // find member and its memory location
+            auto ptr = reinterpret_cast<uintptr_t>(value);  // NOLINT
+            const UA_DataTypeMember* member = nullptr;
+            for (size_t i = 0; i < type->membersSize; ++i) {
+                const auto& current = type->members[i];  // NOLINT
+                ptr += current.padding;
+                if (reader_.name() == current.memberName) {
+                    member = &current;
+                    break;
+                }
+                ptr += current.isArray ? sizeof(size_t) + sizeof(void*)
+                                       : getMemberType(current)->memSize;
+            }
+            const auto* memberType = member == nullptr ? nullptr : getMemberType(*member);
+            if (memberType == nullptr || status.isBad()) {
+                reader_.skip();
+                continue;
+            }
+            if (!member->isArray) {
+                status = readTyped(memberType, reinterpret_cast<void*>(ptr));  // NOLINT
+                continue;
+            }
+            // array members: ListOf... elements are the array elements
+            auto& size = *reinterpret_cast<size_t*>(ptr);  // NOLINT
+            auto& data = *reinterpret_cast<void**>(ptr + sizeof(size_t));  // NOLINT
+            UA_Array_delete(data, size, memberType);
+            size = 0;
+            data = nullptr;
+            ValueBuffer buffer;
+            while (status.isGood() && reader_.nextChild()) {
+                void* element = buffer.append(memberType);
+                status = readTyped(memberType, element);
+                if (status.isBad()) {
+                    buffer.pop();
+                    reader_.skipChildren();
+                }
+            }
+            if (status.isGood()) {
+                data = buffer.releaseArray(memberType, size);
+            }
+        }
+        return status;
+#else
+        (void)type;
+        (void)value;
+        reader_.skip();
+        return UA_STATUSCODE_BADDATAENCODINGUNSUPPORTED;
+#endif
+    }
+
+    Server& server_;
+    XmlReader reader_;
+    std::vector<uint16_t> namespaces_{0};  // server namespace indices of the nodeset
+    std::unordered_map<std::string, NodeId> aliases_;
+    std::vector<NodeSetNode> nodes_;
+    std::vector<std::pair<NodeId, StatusCode>> errors_;
+};
+
+/* ------------------------------------------ Records ------------------------------------------- */
+
+/// Move the native value out of a wrapper, the wrapper is left empty.
+template <typename T>
+auto take(T& wrapper) noexcept {
+    auto native = *wrapper.handle();
+    std::memset(wrapper.handle(), 0, sizeof(native));  // initialized state
+    return native;
+}
+
+template <typename Attributes>
+Attributes& createAttributes(
+    detail::NodeRecord& record, const Attributes& defaults, const UA_DataType& type
+) {
+    auto* attr = detail::allocate<Attributes>(type);
+    *attr = defaults;  // without allocated members
+    auto& eo = *record.attributes.handle();
+    eo.encoding = UA_EXTENSIONOBJECT_DECODED;
+    eo.content.decoded.type = &type;
+    eo.content.decoded.data = attr;
+    return *attr;
+}
+
+template <typename Attributes>
+Attributes& createAttributes(
+    detail::NodeRecord& record,
+    NodeSetNode& node,
+    const Attributes& defaults,
+    const UA_DataType& type
+) {
+    auto& attr = createAttributes(record, defaults, type);
+    attr.displayName = take(node.displayName);
+    attr.description = take(node.description);
+    return attr;
+}
+
+template <typename Attributes>
+void setValueAttributes(Attributes& attr, NodeSetNode& node) {
+    attr.value = take(node.value);
+    attr.dataType = take(node.dataType);
+    attr.valueRank = node.valueRank;
+    if (!node.arrayDimensions.empty()) {
+        attr.arrayDimensions = detail::copyArray(
+            node.arrayDimensions.data(), node.arrayDimensions.size(), UA_TYPES[UA_TYPES_UINT32]
+        );
+        attr.arrayDimensionsSize = node.arrayDimensions.size();
+    }
+}
+
+/// Convert a parsed node to a record for insertion, parsed values are moved.
+detail::NodeRecord toRecord(NodeSetNode& node) {
+    detail::NodeRecord record;
+    record.nodeClass = node.nodeClass;
+    record.id = std::move(node.id);
+    record.browseName = std::move(node.browseName);
+    record.parentId = std::move(node.parentId);
+    record.references = std::move(node.references);
+    switch (node.nodeClass) {
+    case NodeClass::Object: {
+        auto& attr = createAttributes(
+            record, node, UA_ObjectAttributes_default, UA_TYPES[UA_TYPES_OBJECTATTRIBUTES]
+        );
+        attr.eventNotifier = node.eventNotifier;
+        break;
+    }
+    case NodeClass::Variable: {
+        auto& attr = createAttributes(
+            record, node, UA_VariableAttributes_default, UA_TYPES[UA_TYPES_VARIABLEATTRIBUTES]
+        );
+        setValueAttributes(attr, node);
+        attr.accessLevel = node.accessLevel;
+        attr.userAccessLevel = node.userAccessLevel;
+        attr.minimumSamplingInterval = node.minimumSamplingInterval;
+        attr.historizing = node.historizing;
+        break;
+    }
+    case NodeClass::Method: {
+        auto& attr = createAttributes(
+            record, node, UA_MethodAttributes_default, UA_TYPES[UA_TYPES_METHODATTRIBUTES]
+        );
+        attr.executable = node.executable;
+        attr.userExecutable = node.userExecutable;
+        break;
+    }
+    case NodeClass::ObjectType: {
+        auto& attr = createAttributes(
+            record, node, UA_ObjectTypeAttributes_default, UA_TYPES[UA_TYPES_OBJECTTYPEATTRIBUTES]
+        );
+        attr.isAbstract = node.isAbstract;
+        break;
+    }
+    case NodeClass::VariableType: {
+        auto& attr = createAttributes(
+            record,
+            node,
+            UA_VariableTypeAttributes_default,
+            UA_TYPES[UA_TYPES_VARIABLETYPEATTRIBUTES]
+        );
+        setValueAttributes(attr, node);
+        attr.isAbstract = node.isAbstract;
+        break;
+    }
+    case NodeClass::ReferenceType: {
+        auto& attr = createAttributes(
+            record,
+            node,
+            UA_ReferenceTypeAttributes_default,
+            UA_TYPES[UA_TYPES_REFERENCETYPEATTRIBUTES]
+        );
+        attr.isAbstract = node.isAbstract;
+        attr.symmetric = node.symmetric;
+        attr.inverseName = take(node.inverseName);
+        break;
+    }
+    case NodeClass::DataType: {
+        auto& attr = createAttributes(
+            record, node, UA_DataTypeAttributes_default, UA_TYPES[UA_TYPES_DATATYPEATTRIBUTES]
+        );
+        attr.isAbstract = node.isAbstract;
+        break;
+    }
+    case NodeClass::View: {
+        auto& attr = createAttributes(
+            record, node, UA_ViewAttributes_default, UA_TYPES[UA_TYPES_VIEWATTRIBUTES]
+        );
+        attr.containsNoLoops = node.containsNoLoops;
+        attr.eventNotifier = node.eventNotifier;
+        break;
+    }
+    default:
+        break;  // reported on insertion
+    }
+    return record;
+}
+
+}  // namespace
+
+NodeSetImportResult importNodeSet(Server& server, std::string_view xml) {
+    NodeSetParser parser(server, xml);
+    auto nodes = parser.parse();
+    std::vector<detail::NodeRecord> records;
+    records.reserve(nodes.size());
+    for (auto& node : nodes) {
+        records.push_back(toRecord(node));
+    }
+    nodes.clear();
+
+    auto inserted = detail::insertNodes(server, records);
+    NodeSetImportResult result;
+    result.nodes = inserted.nodes;
+    result.references = inserted.references;
+    result.errors = parser.getErrors();
+    result.errors.insert(result.errors.end(), inserted.errors.begin(), inserted.errors.end());
+    return result;
+}
+
+NodeSetImportResult importNodeSetFile(Server& server, const fs::path& filepath) {
+    std::ifstream fp(filepath, std::ios::binary);
+    if (!fp) {
+        throw BadStatus(UA_STATUSCODE_BADRESOURCEUNAVAILABLE);
+    }
+    const std::string xml((std::istreambuf_iterator<char>(fp)), std::istreambuf_iterator<char>());
+    return importNodeSet(server, xml);
+}
+
+}  // namespace opcua
@@ -0,0 +1,178 @@
+#include "open62541pp/NodeView.h"
+
+#include <utility>  // exchange
+
+#include "open62541pp/Config.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/TypeWrapper.h"  // asWrapper
+
+#include "open62541_impl.h"
+
+#ifdef UAPP_HAS_BORROWED_NODESTORE
+
+namespace opcua {
+
+static const UA_Node& asNode(const void* node) noexcept {
+    return *static_cast<const UA_Node*>(node);
+}
+
+static UA_Nodestore& getNodestore(Server& server) noexcept {
+    return UA_Server_getConfig(server.handle())->nodestore;
+}
+
+NodeView::NodeView(Server& server, const NodeId& id)
+    : server_(&server),
+      node_(getNodestore(server).getNode(getNodestore(server).context, id.handle())) {
+    if (node_ == nullptr) {
+        throw BadStatus(UA_STATUSCODE_BADNODEIDUNKNOWN);
+    }
+}
+
+void NodeView::release() noexcept {
+    if (node_ != nullptr) {
+        auto& nodestore = getNodestore(*server_);
+        nodestore.releaseNode(nodestore.context, static_cast<const UA_Node*>(node_));
+        node_ = nullptr;
+    }
+}
+
+NodeView::~NodeView() {
+    release();
+}
+
+NodeView::NodeView(NodeView&& other) noexcept
+    : server_(other.server_),
+      node_(std::exchange(other.node_, nullptr)) {}
+
+NodeView& NodeView::operator=(NodeView&& other) noexcept {
+    if (this != &other) {
+        release();
+        server_ = other.server_;
+        node_ = std::exchange(other.node_, nullptr);
+    }
+    return *this;
+}
+
+/// Check the node class of the node, throw BadAttributeIdInvalid on mismatch.
+static const UA_Node& asNodeOfClass(const void* node, UA_NodeClass mask) {
+    const auto& native = asNode(node);
+    if ((native.head.nodeClass & mask) == 0) {
+        throw BadStatus(UA_STATUSCODE_BADATTRIBUTEIDINVALID);
+    }
+    return native;
+}
+
+const NodeId& NodeView::getNodeId() const noexcept {
+    return asWrapper<NodeId>(asNode(node_).head.nodeId);
+}
+
+NodeClass NodeView::getNodeClass() const noexcept {
+    return static_cast<NodeClass>(asNode(node_).head.nodeClass);
+}
+
+const QualifiedName& NodeView::getBrowseName() const noexcept {
+    return asWrapper<QualifiedName>(asNode(node_).head.browseName);
+}
+
+const LocalizedText& NodeView::getDisplayName() const noexcept {
+    return asWrapper<LocalizedText>(asNode(node_).head.displayName);
+}
+
+const LocalizedText& NodeView::getDescription() const noexcept {
+    return asWrapper<LocalizedText>(asNode(node_).head.description);
+}
+
+Bitmask<WriteMask> NodeView::getWriteMask() const noexcept {
+    return asNode(node_).head.writeMask;
+}
+
+bool NodeView::getIsAbstract() const {
+    const auto& node = asNodeOfClass(
+        node_,
+        static_cast<UA_NodeClass>(
+            UA_NODECLASS_OBJECTTYPE | UA_NODECLASS_VARIABLETYPE | UA_NODECLASS_REFERENCETYPE |
+            UA_NODECLASS_DATATYPE
+        )
+    );
+    switch (node.head.nodeClass) {
+    case UA_NODECLASS_OBJECTTYPE:
+        return node.objectTypeNode.isAbstract;
+    case UA_NODECLASS_VARIABLETYPE:
+        return node.variableTypeNode.isAbstract;
+    case UA_NODECLASS_REFERENCETYPE:
+        return node.referenceTypeNode.isAbstract;
+    default:
+        return node.dataTypeNode.isAbstract;
+    }
+}
+
+bool NodeView::getSymmetric() const {
+    return asNodeOfClass(node_, UA_NODECLASS_REFERENCETYPE).referenceTypeNode.symmetric;
+}
+
+const LocalizedText& NodeView::getInverseName() const {
+    return asWrapper<LocalizedText>(
+        asNodeOfClass(node_, UA_NODECLASS_REFERENCETYPE).referenceTypeNode.inverseName
+    );
+}
+
+bool NodeView::getContainsNoLoops() const {
+    return asNodeOfClass(node_, UA_NODECLASS_VIEW).viewNode.containsNoLoops;
+}
+
+Bitmask<EventNotifier> NodeView::getEventNotifier() const {
+    const auto& node =
+        asNodeOfClass(node_, static_cast<UA_NodeClass>(UA_NODECLASS_OBJECT | UA_NODECLASS_VIEW));
+    return node.head.nodeClass == UA_NODECLASS_OBJECT ? node.objectNode.eventNotifier
+                                                      : node.viewNode.eventNotifier;
+}
+
+// UA_VariableNode and UA_VariableTypeNode share the layout of the value attributes
+// (UA_NODE_VARIABLEATTRIBUTES)
+static const UA_VariableNode& asVariableOrVariableType(const void* node) {
+    constexpr auto mask =
+        static_cast<UA_NodeClass>(UA_NODECLASS_VARIABLE | UA_NODECLASS_VARIABLETYPE);
+    return asNodeOfClass(node, mask).variableNode;
+}
+
+const Variant& NodeView::getValue() const {
+    const auto& node = asVariableOrVariableType(node_);
+    if (node.valueSource != UA_VALUESOURCE_DATA || node.value.data.callback.onRead != nullptr) {
+        throw BadStatus(UA_STATUSCODE_BADNOTREADABLE);
+    }
+    return asWrapper<Variant>(node.value.data.value.value);
+}
+
+const NodeId& NodeView::getDataType() const {
+    return asWrapper<NodeId>(asVariableOrVariableType(node_).dataType);
+}
+
+ValueRank NodeView::getValueRank() const {
+    return static_cast<ValueRank>(asVariableOrVariableType(node_).valueRank);
+}
+
+Span<const uint32_t> NodeView::getArrayDimensions() const {
+    const auto& node = asVariableOrVariableType(node_);
+    return {node.arrayDimensions, node.arrayDimensionsSize};
+}
+
+Bitmask<AccessLevel> NodeView::getAccessLevel() const {
+    return asNodeOfClass(node_, UA_NODECLASS_VARIABLE).variableNode.accessLevel;
+}
+
+double NodeView::getMinimumSamplingInterval() const {
+    return asNodeOfClass(node_, UA_NODECLASS_VARIABLE).variableNode.minimumSamplingInterval;
+}
+
+bool NodeView::getHistorizing() const {
+    return asNodeOfClass(node_, UA_NODECLASS_VARIABLE).variableNode.historizing;
+}
+
+bool NodeView::getExecutable() const {
+    return asNodeOfClass(node_, UA_NODECLASS_METHOD).methodNode.executable;
+}
+
+}  // namespace opcua
+
+#endif
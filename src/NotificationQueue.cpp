@@ -0,0 +1,50 @@
+#include "open62541pp/NotificationQueue.h"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+#include <thread>
+
+namespace opcua {
+
+NotificationQueue::NotificationQueue(size_t capacity, QueueOverflow overflow)
+    : queue_(capacity),
+      overflow_(overflow) {}
+
+services::DataChangeBatchCallback NotificationQueue::sink() {
+    return [this](uint32_t /* subId */, Span<Notification> notifications) {
+        for (auto& notification : notifications) {
+            push(notification);
+        }
+    };
+}
+
+bool NotificationQueue::push(Notification& notification) {
+    if (queue_.tryPush(notification)) {
+        return true;
+    }
+    switch (overflow_) {
+    case QueueOverflow::DropOldest:
+        do {
+            if (queue_.tryPop().has_value()) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+            }
+        } while (!queue_.tryPush(notification));
+        return false;
+    case QueueOverflow::Block:
+        do {
+            std::this_thread::yield();
+        } while (!queue_.tryPush(notification));
+        return true;
+    default:
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+}
+
+std::optional<NotificationQueue::Notification> NotificationQueue::pop() {
+    return queue_.tryPop();
+}
+
+}  // namespace opcua
+
+#endif
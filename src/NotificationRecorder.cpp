@@ -0,0 +1,325 @@
+#include "open62541pp/NotificationRecorder.h"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+#include <algorithm>  // max
+#include <chrono>
+#include <cstring>  // memcpy
+#include <thread>  // this_thread::sleep_until
+#include <utility>  // move
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define UAPP_HAS_MMAP
+#endif
+
+#include "open62541pp/Client.h"
+#include "open62541pp/Encoding.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/MonitoredItem.h"
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/DateTime.h"
+
+namespace opcua {
+
+namespace detail {
+
+// layout: header | records, each record: RecordHeader | binary encoded DataValue | padding
+struct RecordingHeader {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t reserved;
+    uint64_t size;  // end of the recorded data in bytes, including the header
+    uint64_t count;  // number of records
+};
+
+}  // namespace detail
+
+namespace {
+
+struct RecordHeader {
+    uint32_t length;  // length of the encoded DataValue
+    uint32_t subscriptionId;
+    uint32_t monitoredItemId;
+    uint32_t reserved;
+    int64_t time;  // receive time (DateTime)
+};
+
+constexpr uint64_t recordingMagic = 0x314345524E505041;  // "APPNREC1"
+constexpr uint32_t recordingVersion = 1;
+constexpr size_t headerSize = 64;
+constexpr size_t recordHeaderSize = sizeof(RecordHeader);
+constexpr size_t alignment = 8;
+
+static_assert(sizeof(detail::RecordingHeader) <= headerSize);
+static_assert(recordHeaderSize % alignment == 0);
+
+constexpr size_t alignUp(size_t size) noexcept {
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+bool isValid(const detail::RecordingHeader& header, size_t fileSize) noexcept {
+    return header.magic == recordingMagic && header.version == recordingVersion &&
+           header.size >= headerSize && header.size <= fileSize;
+}
+
+}  // namespace
+
+/* ------------------------------------ NotificationRecorder ------------------------------------ */
+
+NotificationRecorder::NotificationRecorder(
+    [[maybe_unused]] const std::string& path, [[maybe_unused]] size_t capacity
+) {
+#ifdef UAPP_HAS_MMAP
+    fd_ = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);  // NOLINT
+    if (fd_ < 0) {
+        throw BadStatus(UA_STATUSCODE_BADRESOURCEUNAVAILABLE);
+    }
+    try {
+        struct stat st {};
+        const size_t fileSize = ::fstat(fd_, &st) == 0 ? static_cast<size_t>(st.st_size) : 0;
+        if (fileSize > 0) {
+            // append to an existing recording, validate the header before the file is touched
+            detail::RecordingHeader header{};
+            const auto bytes = ::pread(fd_, &header, sizeof(header), 0);
+            if (fileSize < headerSize || bytes != static_cast<ssize_t>(sizeof(header)) ||
+                !isValid(header, fileSize)) {
+                throw BadStatus(UA_STATUSCODE_BADINVALIDSTATE);
+            }
+            owned_ = true;
+            resize(alignUp(fileSize));
+        } else {
+            owned_ = true;
+            resize(alignUp(std::max(capacity, 2 * headerSize)));
+            *header_ = {recordingMagic, recordingVersion, 0, headerSize, 0};
+        }
+    } catch (...) {
+        close();
+        throw;
+    }
+#else
+    throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+#endif
+}
+
+NotificationRecorder::~NotificationRecorder() {
+    close();
+}
+
+void NotificationRecorder::close() noexcept {
+#ifdef UAPP_HAS_MMAP
+    const size_t recordedSize = header_ != nullptr ? header_->size : 0;
+    if (mapping_ != nullptr) {
+        ::munmap(mapping_, mappingSize_);
+        mapping_ = nullptr;
+        header_ = nullptr;
+    }
+    if (fd_ >= 0) {
+        // only truncate recordings with a header written or validated by the recorder
+        if (owned_ && recordedSize > 0) {
+            [[maybe_unused]] const int result = ::ftruncate(fd_, static_cast<off_t>(recordedSize));
+        }
+        ::close(fd_);
+        fd_ = -1;
+    }
+#endif
+}
+
+void NotificationRecorder::resize([[maybe_unused]] size_t size) {
+#ifdef UAPP_HAS_MMAP
+    if (::ftruncate(fd_, static_cast<off_t>(size)) != 0) {
+        throw BadStatus(UA_STATUSCODE_BADRESOURCEUNAVAILABLE);
+    }
+    void* mapping = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (mapping == MAP_FAILED) {  // NOLINT
+        throw BadStatus(UA_STATUSCODE_BADRESOURCEUNAVAILABLE);
+    }
+    if (mapping_ != nullptr) {
+        ::munmap(mapping_, mappingSize_);
+    }
+    mapping_ = mapping;
+    mappingSize_ = size;
+    header_ = static_cast<detail::RecordingHeader*>(mapping);
+#endif
+}
+
+void NotificationRecorder::recordImpl(
+    uint32_t subscriptionId, uint32_t monitoredItemId, const DataValue& value
+) {
+    RecordHeader record{0, subscriptionId, monitoredItemId, 0, DateTime::now().get()};
+    while (true) {
+        const size_t offset = header_->size;
+        auto* base = static_cast<uint8_t*>(mapping_) + offset;  // NOLINT(*-pointer-arithmetic)
+        const size_t available = mappingSize_ - offset;
+        if (available > recordHeaderSize) {
+            try {
+                // encode directly into the mapping, grow the file if the value does not fit
+                const auto encoded = detail::encodeBinary(
+                    value.handle(),
+                    UA_TYPES[UA_TYPES_DATAVALUE],
+                    Span<uint8_t>(base + recordHeaderSize, available - recordHeaderSize)  // NOLINT
+                );
+                const size_t recordSize = alignUp(recordHeaderSize + encoded.size());
+                if (recordSize <= available) {
+                    record.length = static_cast<uint32_t>(encoded.size());
+                    std::memcpy(base, &record, recordHeaderSize);
+                    // publish the record by updating the header
+                    header_->size = offset + recordSize;
+                    header_->count += 1;
+                    return;
+                }
+            } catch (const BadStatus& e) {
+                if (e.code() != UA_STATUSCODE_BADENCODINGLIMITSEXCEEDED) {
+                    throw;
+                }
+            }
+        }
+        resize(2 * mappingSize_);
+    }
+}
+
+void NotificationRecorder::record(
+    uint32_t subscriptionId, uint32_t monitoredItemId, const DataValue& value
+) {
+    const std::lock_guard lock(mutex_);
+    recordImpl(subscriptionId, monitoredItemId, value);
+}
+
+DataChangeCallback<Client> NotificationRecorder::wrap(DataChangeCallback<Client> callback) {
+    return [this, callback = std::move(callback)](
+               const MonitoredItem<Client>& item, const DataValue& value
+           ) {
+        record(item.getSubscriptionId(), item.getMonitoredItemId(), value);
+        if (callback) {
+            callback(item, value);
+        }
+    };
+}
+
+DataChangeBatchCallback NotificationRecorder::wrapBatch(DataChangeBatchCallback callback) {
+    return [this, callback = std::move(callback)](
+               uint32_t subId, Span<MonitoredItemNotification> notifications
+           ) {
+        {
+            // single lock per batch
+            const std::lock_guard lock(mutex_);
+            for (const auto& notification : notifications) {
+                recordImpl(
+                    notification.subscriptionId, notification.monitoredItemId, notification.value
+                );
+            }
+        }
+        if (callback) {
+            callback(subId, notifications);
+        }
+    };
+}
+
+size_t NotificationRecorder::count() const {
+    const std::lock_guard lock(mutex_);
+    return header_->count;
+}
+
+size_t NotificationRecorder::size() const {
+    const std::lock_guard lock(mutex_);
+    return header_->size;
+}
+
+void NotificationRecorder::flush() {
+#ifdef UAPP_HAS_MMAP
+    const std::lock_guard lock(mutex_);
+    ::msync(mapping_, header_->size, MS_SYNC);
+#endif
+}
+
+/* ------------------------------------ NotificationReplayer ------------------------------------ */
+
+NotificationReplayer::NotificationReplayer([[maybe_unused]] const std::string& path) {
+#ifdef UAPP_HAS_MMAP
+    const int fd = ::open(path.c_str(), O_RDONLY);  // NOLINT
+    if (fd < 0) {
+        throw BadStatus(UA_STATUSCODE_BADRESOURCEUNAVAILABLE);
+    }
+    struct stat st {};
+    const size_t fileSize = ::fstat(fd, &st) == 0 ? static_cast<size_t>(st.st_size) : 0;
+    if (fileSize < headerSize) {
+        ::close(fd);
+        throw BadStatus(UA_STATUSCODE_BADINVALIDSTATE);
+    }
+    void* mapping = ::mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);  // the mapping keeps the file open
+    if (mapping == MAP_FAILED) {  // NOLINT
+        throw BadStatus(UA_STATUSCODE_BADRESOURCEUNAVAILABLE);
+    }
+    mapping_ = mapping;
+    mappingSize_ = fileSize;
+    header_ = static_cast<const detail::RecordingHeader*>(mapping);
+    if (!isValid(*header_, fileSize)) {
+        ::munmap(mapping_, mappingSize_);
+        throw BadStatus(UA_STATUSCODE_BADINVALIDSTATE);
+    }
+    // records are read once in order
+    ::posix_madvise(mapping_, mappingSize_, POSIX_MADV_SEQUENTIAL);
+#else
+    throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+#endif
+}
+
+NotificationReplayer::~NotificationReplayer() {
+#ifdef UAPP_HAS_MMAP
+    if (mapping_ != nullptr) {
+        ::munmap(mapping_, mappingSize_);
+    }
+#endif
+}
+
+size_t NotificationReplayer::count() const noexcept {
+    return header_->count;
+}
+
+size_t NotificationReplayer::replay(
+    Client& client, const DataChangeCallback<Client>& callback, const ReplayOptions& options
+) const {
+    using Ticks = std::chrono::duration<double, std::ratio<1, 10'000'000>>;  // DateTime resolution
+    const auto* base = static_cast<const uint8_t*>(mapping_);
+    const size_t end = header_->size;
+    const auto start = std::chrono::steady_clock::now();
+    int64_t startTime = 0;
+    DataValue value;
+    size_t replayed = 0;
+    size_t offset = headerSize;
+    while (offset + recordHeaderSize <= end && replayed < header_->count) {
+        RecordHeader record{};
+        std::memcpy(&record, base + offset, recordHeaderSize);  // NOLINT(*-pointer-arithmetic)
+        if (record.length > end - offset - recordHeaderSize) {
+            throw BadStatus(UA_STATUSCODE_BADDECODINGERROR);
+        }
+        if (options.speed > 0) {
+            if (replayed == 0) {
+                startTime = record.time;
+            }
+            const Ticks elapsed(static_cast<double>(record.time - startTime) / options.speed);
+            std::this_thread::sleep_until(
+                start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(elapsed)
+            );
+        }
+        UA_DataValue_clear(value.handle());
+        detail::decodeBinary(
+            Span<const uint8_t>(base + offset + recordHeaderSize, record.length),  // NOLINT
+            value.handle(),
+            UA_TYPES[UA_TYPES_DATAVALUE]
+        );
+        const MonitoredItem<Client> item(client, record.subscriptionId, record.monitoredItemId);
+        callback(item, value);
+        offset += alignUp(recordHeaderSize + record.length);
+        ++replayed;
+    }
+    return replayed;
+}
+
+}  // namespace opcua
+
+#endif
@@ -0,0 +1,248 @@
+#include "open62541pp/ParallelCopy.h"
+
+#include <algorithm>  // max, min
+#include <atomic>
+#include <cstddef>
+#include <cstring>  // memcpy
+#include <memory>
+#include <vector>
+
+#include "open62541pp/Config.h"
+#include "open62541pp/detail/ParallelCopy.h"
+
+#include "WorkerPool.h"
+#include "open62541_impl.h"
+
+namespace opcua {
+
+static std::atomic<size_t> parallelThreads{0};  // NOLINT(*-avoid-non-const-global-variables)
+static std::atomic<size_t> parallelThreshold{10000};  // NOLINT(*-avoid-non-const-global-variables)
+
+void setParallelCopy(size_t threads, size_t minElements) {
+    if (threads > 0) {
+        WorkerPool::instance().reserve(threads);
+    }
+    parallelThreshold = std::max<size_t>(minElements, 1);
+    parallelThreads = threads;
+}
+
+namespace detail {
+
+bool isParallelCopyActive() noexcept {
+    return parallelThreads.load(std::memory_order_relaxed) > 0;
+}
+
+size_t getParallelCopyThreshold() noexcept {
+    return parallelThreshold.load(std::memory_order_relaxed);
+}
+
+static bool isLargeArray(size_t size, const UA_DataType& type) noexcept {
+    return !type.pointerFree && isParallelCopyActive() && size >= getParallelCopyThreshold();
+}
+
+UA_StatusCode forEachChunkParallel(
+    size_t size, const std::function<UA_StatusCode(size_t, size_t)>& func
+) noexcept {
+    const size_t chunks = std::min(parallelThreads.load(std::memory_order_relaxed) + 1, size);
+    if (chunks <= 1) {
+        return func(0, size);
+    }
+    const size_t chunkSize = (size + chunks - 1) / chunks;
+    std::atomic<UA_StatusCode> result{UA_STATUSCODE_GOOD};
+    try {
+        WorkerPool::instance().run(chunks, [&](size_t i) {
+            const size_t begin = i * chunkSize;
+            const size_t end = std::min(begin + chunkSize, size);
+            if (begin >= end) {
+                return;
+            }
+            const UA_StatusCode status = func(begin, end);
+            if (status != UA_STATUSCODE_GOOD) {
+                UA_StatusCode expected = UA_STATUSCODE_GOOD;
+                result.compare_exchange_strong(expected, status);
+            }
+        });
+    } catch (...) {
+        return UA_STATUSCODE_BADOUTOFMEMORY;  // tasks could not be scheduled
+    }
+    return result.load();
+}
+
+static void* getElement(const void* array, size_t index, const UA_DataType& type) noexcept {
+    // NOLINTNEXTLINE(*-pointer-arithmetic, *-const-cast)
+    return const_cast<std::byte*>(static_cast<const std::byte*>(array) + index * type.memSize);
+}
+
+UA_StatusCode copyArrayParallel(
+    const void* src, size_t size, void** dst, const UA_DataType& type
+) noexcept {
+    if (!isLargeArray(size, type)) {
+        return UA_Array_copy(src, size, dst, &type);
+    }
+    void* array = UA_Array_new(size, &type);
+    if (array == nullptr) {
+        return UA_STATUSCODE_BADOUTOFMEMORY;
+    }
+    const auto status = forEachChunkParallel(size, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const auto code = UA_copy(getElement(src, i, type), getElement(array, i, type), &type);
+            if (code != UA_STATUSCODE_GOOD) {
+                return code;
+            }
+        }
+        return UA_StatusCode{UA_STATUSCODE_GOOD};
+    });
+    if (status != UA_STATUSCODE_GOOD) {
+        UA_Array_delete(array, size, &type);  // elements are copied or zero-initialized
+        return status;
+    }
+    *dst = array;
+    return UA_STATUSCODE_GOOD;
+}
+
+void deleteArrayParallel(void* array, size_t size, const UA_DataType& type) noexcept {
+    if (!isLargeArray(size, type)) {
+        UA_Array_delete(array, size, &type);
+        return;
+    }
+    const auto status = forEachChunkParallel(size, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            UA_clear(getElement(array, i, type), &type);
+        }
+        return UA_StatusCode{UA_STATUSCODE_GOOD};
+    });
+    if (status != UA_STATUSCODE_GOOD) {
+        UA_Array_delete(array, size, &type);  // cleared elements are zeroed
+        return;
+    }
+    UA_free(array);
+}
+
+/* ---------------------------------------- Large arrays ---------------------------------------- */
+
+/// Array of an object, referenced by the offsets of the size and data members within the object.
+struct LargeArray {
+    size_t sizeOffset;
+    size_t dataOffset;
+    const UA_DataType* type;
+};
+
+template <typename T>
+static T& getMember(void* native, size_t offset) noexcept {
+    // NOLINTNEXTLINE(*-pointer-arithmetic)
+    return *static_cast<T*>(static_cast<void*>(static_cast<std::byte*>(native) + offset));
+}
+
+static size_t getOffset(const void* native, const void* member) noexcept {
+    return static_cast<size_t>(
+        static_cast<const std::byte*>(member) - static_cast<const std::byte*>(native)
+    );
+}
+
+static void findLargeArrays(
+    const void* root, const void* native, const UA_DataType& type, std::vector<LargeArray>& arrays
+) {
+    if (type.typeKind == UA_DATATYPEKIND_VARIANT) {
+        const auto& variant = *static_cast<const UA_Variant*>(native);
+        if (variant.type != nullptr && variant.storageType == UA_VARIANT_DATA &&
+            !UA_Variant_isScalar(&variant) && isLargeArray(variant.arrayLength, *variant.type)) {
+            arrays.push_back({
+                getOffset(root, &variant.arrayLength),
+                getOffset(root, &variant.data),
+                variant.type,
+            });
+        }
+        return;
+    }
+    if (type.typeKind == UA_DATATYPEKIND_DATAVALUE) {
+        const auto& dv = *static_cast<const UA_DataValue*>(native);
+        findLargeArrays(root, &dv.value, UA_TYPES[UA_TYPES_VARIANT], arrays);
+        return;
+    }
+#if UAPP_OPEN62541_VER_GE(1, 3)
+    if (type.typeKind != UA_DATATYPEKIND_STRUCTURE) {
+        return;  // optional fields and unions have a different layout
+    }
+    const auto* ptr = static_cast<const std::byte*>(native);
+    for (size_t i = 0; i < type.membersSize; ++i) {
+        const auto& member = type.members[i];  // NOLINT(*-pointer-arithmetic)
+        const auto& memberType = *member.memberType;
+        ptr += member.padding;  // NOLINT(*-pointer-arithmetic)
+        if (member.isArray) {
+            const auto& size = *static_cast<const size_t*>(static_cast<const void*>(ptr));
+            if (isLargeArray(size, memberType)) {
+                arrays.push_back(
+                    {getOffset(root, ptr), getOffset(root, ptr + sizeof(size_t)), &memberType}
+                );
+            }
+            ptr += sizeof(size_t) + sizeof(void*);  // NOLINT(*-pointer-arithmetic)
+        } else {
+            findLargeArrays(root, ptr, memberType, arrays);  // variant and data value members
+            ptr += memberType.memSize;  // NOLINT(*-pointer-arithmetic)
+        }
+    }
+#endif
+}
+
+static std::vector<LargeArray> findLargeArrays(const void* native, const UA_DataType& type) {
+    std::vector<LargeArray> arrays;
+    findLargeArrays(native, native, type, arrays);
+    return arrays;
+}
+
+UA_StatusCode copyParallel(const void* src, void* dst, const UA_DataType& type) noexcept {
+    try {
+        const auto arrays = findLargeArrays(src, type);
+        if (arrays.empty()) {
+            return UA_copy(src, dst, &type);
+        }
+        // copy the object without the large arrays
+        auto shallow = std::make_unique<std::byte[]>(type.memSize);  // NOLINT(*-avoid-c-arrays)
+        std::memcpy(shallow.get(), src, type.memSize);
+        for (const auto& array : arrays) {
+            getMember<size_t>(shallow.get(), array.sizeOffset) = 0;
+            getMember<void*>(shallow.get(), array.dataOffset) = nullptr;
+        }
+        const auto status = UA_copy(shallow.get(), dst, &type);
+        if (status != UA_STATUSCODE_GOOD) {
+            return status;
+        }
+        // copy the large arrays in parallel
+        auto* srcPtr = const_cast<void*>(src);  // NOLINT(*-const-cast), not modified
+        for (const auto& array : arrays) {
+            const size_t size = getMember<size_t>(srcPtr, array.sizeOffset);
+            void* copied = nullptr;
+            const auto code = copyArrayParallel(
+                getMember<void*>(srcPtr, array.dataOffset), size, &copied, *array.type
+            );
+            if (code != UA_STATUSCODE_GOOD) {
+                UA_clear(dst, &type);
+                return code;
+            }
+            getMember<size_t>(dst, array.sizeOffset) = size;
+            getMember<void*>(dst, array.dataOffset) = copied;
+        }
+        return UA_STATUSCODE_GOOD;
+    } catch (...) {
+        return UA_STATUSCODE_BADOUTOFMEMORY;
+    }
+}
+
+void clearParallel(void* native, const UA_DataType& type) noexcept {
+    try {
+        for (const auto& array : findLargeArrays(native, type)) {
+            auto& size = getMember<size_t>(native, array.sizeOffset);
+            auto& data = getMember<void*>(native, array.dataOffset);
+            deleteArrayParallel(data, size, *array.type);
+            size = 0;
+            data = nullptr;
+        }
+    } catch (...) {  // NOLINT(*-empty-catch)
+        // cleared sequentially
+    }
+    UA_clear(native, &type);
+}
+
+}  // namespace detail
+
+}  // namespace opcua
@@ -0,0 +1,85 @@
+#include "open62541pp/PreparedRead.h"
+
+#include <algorithm>  // equal
+#include <cstring>  // memcpy
+
+#include "open62541pp/Client.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/TypeWrapper.h"
+#include "open62541pp/services/Attribute.h"
+
+#include "open62541_impl.h"
+
+namespace opcua {
+
+PreparedRead::PreparedRead(
+    Client& client, Span<const ReadValueId> items, TimestampsToReturn timestamps
+)
+    : client_(client),
+      items_(items.begin(), items.end()),
+      results_(items.size()) {
+    request_.timestampsToReturn = static_cast<UA_TimestampsToReturn>(timestamps);
+    request_.nodesToReadSize = items_.size();
+    request_.nodesToRead = asNative(items_.data());
+}
+
+static size_t getElementCount(const UA_Variant& variant) noexcept {
+    return UA_Variant_isScalar(&variant) ? 1 : variant.arrayLength;
+}
+
+static bool hasSameLayout(const UA_Variant& target, const UA_Variant& source) noexcept {
+    if (target.type == nullptr || target.type != source.type || !target.type->pointerFree) {
+        return false;
+    }
+    if (target.storageType != UA_VARIANT_DATA) {
+        return false;
+    }
+    const size_t count = getElementCount(target);
+    if (count == 0 || count != getElementCount(source)) {
+        return false;  // empty arrays or different sizes
+    }
+    return std::equal(
+        target.arrayDimensions,
+        target.arrayDimensions + target.arrayDimensionsSize,  // NOLINT
+        source.arrayDimensions,
+        source.arrayDimensions + source.arrayDimensionsSize  // NOLINT
+    );
+}
+
+/// Refresh the target with the source, the source is consumed.
+/// @return `true` if the data was copied into the existing buffer of the target
+static bool refresh(UA_DataValue& target, UA_DataValue& source) noexcept {
+    const bool inPlace = target.hasValue && source.hasValue &&
+                         hasSameLayout(target.value, source.value);
+    if (inPlace) {
+        std::memcpy(
+            target.value.data,
+            source.value.data,
+            getElementCount(source.value) * source.value.type->memSize
+        );
+        UA_Variant value = target.value;  // keep the buffer of the target
+        UA_Variant_clear(&source.value);
+        target = source;  // status, timestamps and flags
+        target.value = value;
+    } else {
+        UA_DataValue_clear(&target);
+        target = source;  // take ownership
+    }
+    source = {};
+    return inPlace;
+}
+
+void PreparedRead::execute() {
+    auto response = services::read(client_, asWrapper<ReadRequest>(request_));
+    throwIfBad(response->responseHeader.serviceResult);
+    if (response->resultsSize != results_.size()) {
+        throw BadStatus(UA_STATUSCODE_BADUNEXPECTEDERROR);
+    }
+    size_t inPlaceCount = 0;
+    for (size_t i = 0; i < results_.size(); ++i) {
+        inPlaceCount += refresh(*results_[i].handle(), response->results[i]) ? 1 : 0;  // NOLINT
+    }
+    inPlaceCount_ = inPlaceCount;
+}
+
+}  // namespace opcua
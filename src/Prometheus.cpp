@@ -0,0 +1,67 @@
+#include "Prometheus.h"
+
+#include <algorithm>  // max
+#include <array>
+#include <cstdint>
+#include <cstdio>  // snprintf
+
+namespace opcua::detail {
+
+void appendPrometheusNumber(std::string& out, double value) {
+    std::array<char, 32> buffer{};
+    const int length = std::snprintf(buffer.data(), buffer.size(), "%.9g", value);
+    out.append(buffer.data(), std::max(length, 0));
+}
+
+void appendPrometheusLabelValue(std::string& out, std::string_view value) {
+    out += '"';
+    for (const char c : value) {
+        if (c == '\\' || c == '"') {
+            out += '\\';
+            out += c;
+        } else if (c == '\n') {
+            out += "\\n";
+        } else {
+            out += c;
+        }
+    }
+    out += '"';
+}
+
+void appendPrometheusHeader(
+    std::string& out, std::string_view name, std::string_view type, std::string_view help
+) {
+    out.append("# HELP ").append(name).append(" ").append(help).append("\n");
+    out.append("# TYPE ").append(name).append(" ").append(type).append("\n");
+}
+
+void appendPrometheusSample(
+    std::string& out, std::string_view name, std::string_view labels, double value
+) {
+    out.append(name).append("{").append(labels).append("} ");
+    appendPrometheusNumber(out, value);
+    out += '\n';
+}
+
+void appendPrometheusHistogram(
+    std::string& out, std::string_view name, const std::string& labels, const LatencyHistogram& h
+) {
+    const std::string bucket = std::string(name) + "_bucket";
+    uint64_t cumulative = 0;
+    for (size_t i = 0; i < h.buckets.size(); ++i) {
+        cumulative += h.buckets[i];
+        std::string le;
+        if (i < LatencyHistogram::bounds.size()) {
+            appendPrometheusNumber(le, LatencyHistogram::bounds[i]);
+        } else {
+            le = "+Inf";
+        }
+        appendPrometheusSample(
+            out, bucket, labels + ",le=\"" + le + "\"", static_cast<double>(cumulative)
+        );
+    }
+    appendPrometheusSample(out, std::string(name) + "_sum", labels, h.sum);
+    appendPrometheusSample(out, std::string(name) + "_count", labels, static_cast<double>(h.count));
+}
+
+}  // namespace opcua::detail
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include "open62541pp/ServerMetrics.h"  // LatencyHistogram
+
+namespace opcua::detail {
+
+/* Helper to format metrics in the Prometheus text exposition format. */
+
+void appendPrometheusNumber(std::string& out, double value);
+
+/// Append a quoted and escaped label value.
+void appendPrometheusLabelValue(std::string& out, std::string_view value);
+
+/// Append the `HELP` and `TYPE` lines of a metric.
+void appendPrometheusHeader(
+    std::string& out, std::string_view name, std::string_view type, std::string_view help
+);
+
+void appendPrometheusSample(
+    std::string& out, std::string_view name, std::string_view labels, double value
+);
+
+/// Append the cumulative buckets, sum and count of a histogram.
+void appendPrometheusHistogram(
+    std::string& out, std::string_view name, const std::string& labels, const LatencyHistogram& h
+);
+
+}  // namespace opcua::detail
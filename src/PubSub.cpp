@@ -0,0 +1,464 @@
+#include "open62541pp/PubSub.h"
+
+#ifdef UA_ENABLE_PUBSUB
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>  // move
+#include <vector>
+
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/ValueStore.h"
+#include "open62541pp/detail/ScopeExit.h"
+#include "open62541pp/detail/ServerContext.h"
+#include "open62541pp/detail/helper.h"  // toNativeString
+#include "open62541pp/types/DataValue.h"
+
+#include "open62541_impl.h"
+
+namespace opcua {
+
+static constexpr std::string_view getTransportProfileUri(PubSubTransport transport) noexcept {
+    switch (transport) {
+    case PubSubTransport::EthernetUadp:
+        return "http://opcfoundation.org/UA-Profile/Transport/pubsub-eth-uadp";
+    case PubSubTransport::UdpUadp:
+    default:
+        return "http://opcfoundation.org/UA-Profile/Transport/pubsub-udp-uadp";
+    }
+}
+
+/// Add the transport layer to the server config once (<= v1.3, provided by the event loop since).
+static void addTransportLayer([[maybe_unused]] Server& server, PubSubTransport transport) {
+#if UAPP_OPEN62541_VER_LE(1, 3)
+    auto& context = detail::getContext(server);
+    const auto flag = 1U << static_cast<unsigned>(transport);
+    const std::lock_guard lock(context.mutex);
+    if ((context.pubSubTransports & flag) != 0) {
+        return;
+    }
+    auto* config = UA_Server_getConfig(server.handle());
+    if (transport == PubSubTransport::UdpUadp) {
+        throwIfBad(UA_ServerConfig_addPubSubTransportLayer(config, UA_PubSubTransportLayerUDPMP()));
+    } else {
+#ifdef UA_ENABLE_PUBSUB_ETH_UADP
+        throwIfBad(
+            UA_ServerConfig_addPubSubTransportLayer(config, UA_PubSubTransportLayerEthernet())
+        );
+#else
+        throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+#endif
+    }
+    context.pubSubTransports |= flag;
+#else
+#ifndef UA_ENABLE_PUBSUB_ETH_UADP
+    if (transport == PubSubTransport::EthernetUadp) {
+        throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+    }
+#endif
+#endif
+}
+
+/* ---------------------------------------- DataSetWriter --------------------------------------- */
+
+DataSetWriter::DataSetWriter(Server& server, NodeId id, NodeId publishedDataSetId) noexcept
+    : server_(&server),
+      id_(std::move(id)),
+      publishedDataSetId_(std::move(publishedDataSetId)) {}
+
+void DataSetWriter::remove() {
+    throwIfBad(UA_Server_removeDataSetWriter(server_->handle(), id_));
+    throwIfBad(UA_Server_removePublishedDataSet(server_->handle(), publishedDataSetId_));
+}
+
+/* ----------------------------------------- WriterGroup ---------------------------------------- */
+
+WriterGroup::WriterGroup(Server& server, NodeId id) noexcept
+    : server_(&server),
+      id_(std::move(id)) {}
+
+static bool isFixedSize(UA_Server* server, const NodeId& writerGroupId) {
+    UA_WriterGroupConfig config{};
+    throwIfBad(UA_Server_getWriterGroupConfig(server, writerGroupId, &config));
+    const bool fixedSize = config.rtLevel == UA_PUBSUB_RT_FIXED_SIZE;
+    UA_WriterGroupConfig_clear(&config);
+    return fixedSize;
+}
+
+DataSetWriter WriterGroup::addDataSetWriter(const DataSetWriterConfig& config) {
+    auto* server = server_->handle();
+    const bool fixedSize = isFixedSize(server, id_);
+
+    UA_PublishedDataSetConfig dataSetConfig{};
+    dataSetConfig.publishedDataSetType = UA_PUBSUB_DATASET_PUBLISHEDITEMS;
+    dataSetConfig.name = detail::toNativeString(config.name);
+    NodeId dataSetId;
+    throwIfBad(UA_Server_addPublishedDataSet(server, &dataSetConfig, dataSetId.handle()).addResult);
+    auto removeDataSet = detail::ScopeExit([&] {
+        UA_Server_removePublishedDataSet(server, dataSetId);
+    });
+
+    for (const auto& field : config.fields) {
+        const auto alias = field.toString();
+        UA_DataSetFieldConfig fieldConfig{};
+        fieldConfig.dataSetFieldType = UA_PUBSUB_DATASETFIELD_VARIABLE;
+        auto& variable = fieldConfig.field.variable;
+        variable.fieldNameAlias = detail::toNativeString(alias);
+        variable.publishParameters.publishedVariable = field;
+        variable.publishParameters.attributeId = UA_ATTRIBUTEID_VALUE;
+        // sample the value directly from the external value backend of the node
+        variable.rtValueSource.rtInformationModelNode = fixedSize;
+        NodeId fieldId;
+        throwIfBad(UA_Server_addDataSetField(server, dataSetId, &fieldConfig, fieldId.handle())
+                       .result);
+    }
+
+    UA_UadpDataSetWriterMessageDataType message{};
+    message.dataSetMessageContentMask = static_cast<UA_UadpDataSetMessageContentMask>(
+        UA_UADPDATASETMESSAGECONTENTMASK_SEQUENCENUMBER
+    );
+    UA_DataSetWriterConfig writerConfig{};
+    writerConfig.name = detail::toNativeString(config.name);
+    writerConfig.dataSetWriterId = config.dataSetWriterId;
+    writerConfig.keyFrameCount = 10;
+    writerConfig.messageSettings.encoding = UA_EXTENSIONOBJECT_DECODED;
+    writerConfig.messageSettings.content.decoded.type =
+        &UA_TYPES[UA_TYPES_UADPDATASETWRITERMESSAGEDATATYPE];
+    writerConfig.messageSettings.content.decoded.data = &message;
+    NodeId writerId;
+    throwIfBad(
+        UA_Server_addDataSetWriter(server, id_, dataSetId, &writerConfig, writerId.handle())
+    );
+
+    removeDataSet.release();
+    return {*server_, std::move(writerId), std::move(dataSetId)};
+}
+
+void WriterGroup::start() {
+    auto* server = server_->handle();
+    throwIfBad(UA_Server_freezeWriterGroupConfiguration(server, id_));
+#if UAPP_OPEN62541_VER_GE(1, 4)
+    throwIfBad(UA_Server_enableWriterGroup(server, id_));
+#else
+    throwIfBad(UA_Server_setWriterGroupOperational(server, id_));
+#endif
+}
+
+void WriterGroup::stop() {
+    auto* server = server_->handle();
+#if UAPP_OPEN62541_VER_GE(1, 4)
+    throwIfBad(UA_Server_disableWriterGroup(server, id_));
+#else
+    throwIfBad(UA_Server_setWriterGroupDisabled(server, id_));
+#endif
+    throwIfBad(UA_Server_unfreezeWriterGroupConfiguration(server, id_));
+}
+
+void WriterGroup::remove() {
+    throwIfBad(UA_Server_removeWriterGroup(server_->handle(), id_));
+}
+
+/* ---------------------------------------- DataSetReader --------------------------------------- */
+
+namespace {
+
+/// Decoding targets of a data set reader, referenced by the native target variables.
+struct DataSetReaderContext {
+    struct Field {
+        DataSetReaderContext* reader{};
+        bool last{false};
+        ValueSlot* slot{};
+        std::vector<std::byte> buffer;  // target memory if not provided by the user
+        DataValue value;  // references the target memory (UA_VARIANT_DATA_NODELETE)
+        UA_DataValue* native{value.handle()};  // UA_FieldTargetVariable::externalDataValue
+    };
+
+    Server* server{};
+    std::vector<std::unique_ptr<Field>> fields;  // stable addresses
+    std::function<void()> onMessage;
+    std::vector<NodeId> backendNodes;  // target nodes with external value backends of the fields
+};
+
+/// Reset the external value backends of the target nodes before the fields are released.
+void resetValueBackends(UA_Server* server, DataSetReaderContext& context) noexcept {
+    for (const auto& id : context.backendNodes) {
+        UA_ValueBackend backend{};
+        backend.backendType = UA_VALUEBACKENDTYPE_NONE;
+        UA_Server_setVariableNode_valueBackend(server, id, backend);  // node might be deleted
+    }
+    context.backendNodes.clear();
+}
+
+}  // namespace
+
+DataSetReader::DataSetReader(Server& server, NodeId id) noexcept
+    : server_(&server),
+      id_(std::move(id)) {}
+
+void DataSetReader::remove() {
+    throwIfBad(UA_Server_removeDataSetReader(server_->handle(), id_));
+    auto& context = detail::getContext(*server_);
+    const std::lock_guard lock(context.mutex);
+    const auto it = context.dataSetReaders.find(id_);
+    if (it != context.dataSetReaders.end()) {
+        resetValueBackends(
+            server_->handle(), *std::static_pointer_cast<DataSetReaderContext>(it->second)
+        );
+        context.dataSetReaders.erase(it);
+    }
+}
+
+/* ----------------------------------------- ReaderGroup ---------------------------------------- */
+
+ReaderGroup::ReaderGroup(Server& server, NodeId id) noexcept
+    : server_(&server),
+      id_(std::move(id)) {}
+
+static UA_Byte getBuiltInType(const UA_DataType& dataType) noexcept {
+    if (dataType.typeKind == UA_DATATYPEKIND_ENUM) {
+        return UA_TYPES_INT32 + 1;
+    }
+    if (dataType.typeKind > UA_DATATYPEKIND_DIAGNOSTICINFO) {
+        return UA_TYPES_EXTENSIONOBJECT + 1;
+    }
+    return static_cast<UA_Byte>(dataType.typeKind + 1);
+}
+
+/// Called by the server after a field was decoded into the target memory.
+static void afterFieldDecoded(
+    [[maybe_unused]] UA_Server* server,
+    [[maybe_unused]] const UA_NodeId* readerId,
+    [[maybe_unused]] const UA_NodeId* readerGroupId,
+    [[maybe_unused]] const UA_NodeId* targetId,
+    void* targetContext,
+    [[maybe_unused]] UA_DataValue** value
+) {
+    auto* field = static_cast<DataSetReaderContext::Field*>(targetContext);
+    if (field == nullptr) {
+        return;
+    }
+    auto& reader = *field->reader;
+    detail::getContext(*reader.server).exceptionCatcher.invoke([&] {
+        if (field->slot != nullptr) {
+            field->slot->publish(field->value);  // owning copy
+        }
+        if (field->last && reader.onMessage) {
+            reader.onMessage();
+        }
+    });
+}
+
+DataSetReader ReaderGroup::addDataSetReader(const DataSetReaderConfig& config) {
+    auto* server = server_->handle();
+    auto context = std::make_shared<DataSetReaderContext>();
+    context->server = server_;
+    context->onMessage = config.onMessage;
+
+    std::vector<UA_FieldMetaData> fieldsMetaData(config.fields.size());
+    std::vector<std::string> fieldNames(config.fields.size());
+    for (size_t i = 0; i < config.fields.size(); ++i) {
+        const auto& field = config.fields[i];
+        if (field.dataType == nullptr) {
+            throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+        }
+        auto& target =
+            *context->fields.emplace_back(std::make_unique<DataSetReaderContext::Field>());
+        target.reader = context.get();
+        target.last = i + 1 == config.fields.size();
+        target.slot = field.slot;
+        void* data = field.target;
+        if (data == nullptr) {
+            target.buffer.resize(field.dataType->memSize);
+            data = target.buffer.data();
+        }
+        UA_Variant_setScalar(&target.native->value, data, field.dataType);
+        target.native->value.storageType = UA_VARIANT_DATA_NODELETE;
+        target.native->hasValue = true;
+
+        fieldNames[i] = "Field " + std::to_string(i);
+        auto& metaData = fieldsMetaData[i];
+        metaData.name = detail::toNativeString(fieldNames[i]);
+        metaData.dataType = field.dataType->typeId;
+        metaData.builtInType = getBuiltInType(*field.dataType);
+        metaData.valueRank = UA_VALUERANK_SCALAR;
+    }
+
+    UA_UadpDataSetReaderMessageDataType message{};
+    message.networkMessageContentMask = static_cast<UA_UadpNetworkMessageContentMask>(
+        UA_UADPNETWORKMESSAGECONTENTMASK_PUBLISHERID |
+        UA_UADPNETWORKMESSAGECONTENTMASK_GROUPHEADER |
+        UA_UADPNETWORKMESSAGECONTENTMASK_WRITERGROUPID |
+        UA_UADPNETWORKMESSAGECONTENTMASK_SEQUENCENUMBER |
+        UA_UADPNETWORKMESSAGECONTENTMASK_PAYLOADHEADER
+    );
+    message.dataSetMessageContentMask = static_cast<UA_UadpDataSetMessageContentMask>(
+        UA_UADPDATASETMESSAGECONTENTMASK_SEQUENCENUMBER
+    );
+
+    UA_DataSetReaderConfig readerConfig{};
+    readerConfig.name = detail::toNativeString(config.name);
+#if UAPP_OPEN62541_VER_GE(1, 4)
+    readerConfig.publisherId.idType = UA_PUBLISHERIDTYPE_UINT16;
+    readerConfig.publisherId.id.uint16 = config.publisherId;
+#else
+    UA_UInt16 publisherId = config.publisherId;
+    UA_Variant_setScalar(&readerConfig.publisherId, &publisherId, &UA_TYPES[UA_TYPES_UINT16]);
+#endif
+    readerConfig.writerGroupId = config.writerGroupId;
+    readerConfig.dataSetWriterId = config.dataSetWriterId;
+    readerConfig.dataSetMetaData.name = detail::toNativeString(config.name);
+    readerConfig.dataSetMetaData.fieldsSize = fieldsMetaData.size();
+    readerConfig.dataSetMetaData.fields = fieldsMetaData.data();
+    readerConfig.messageSettings.encoding = UA_EXTENSIONOBJECT_DECODED;
+    readerConfig.messageSettings.content.decoded.type =
+        &UA_TYPES[UA_TYPES_UADPDATASETREADERMESSAGEDATATYPE];
+    readerConfig.messageSettings.content.decoded.data = &message;
+    NodeId readerId;
+    throwIfBad(UA_Server_addDataSetReader(server, id_, &readerConfig, readerId.handle()));
+    auto removeReader = detail::ScopeExit([&] { UA_Server_removeDataSetReader(server, readerId); });
+
+    // decode directly into the target memory, followed by the batch callback after the last field
+    std::vector<UA_FieldTargetVariable> targets(config.fields.size());
+    for (size_t i = 0; i < config.fields.size(); ++i) {
+        auto& field = *context->fields[i];
+        auto& target = targets[i];
+        target.targetVariable.attributeId = UA_ATTRIBUTEID_VALUE;
+        target.targetVariable.targetNodeId = config.fields[i].targetNodeId;
+        target.externalDataValue = &field.native;
+        target.targetVariableContext = &field;
+        target.afterWrite = afterFieldDecoded;
+    }
+    throwIfBad(UA_Server_DataSetReader_createTargetVariables(
+        server, readerId, targets.size(), targets.data()
+    ));
+
+    // expose the decoded values in the address space without copies
+    auto resetBackends = detail::ScopeExit([&] { resetValueBackends(server, *context); });
+    for (size_t i = 0; i < config.fields.size(); ++i) {
+        if (config.fields[i].targetNodeId.isNull()) {
+            continue;
+        }
+        UA_ValueBackend backend{};
+        backend.backendType = UA_VALUEBACKENDTYPE_EXTERNAL;
+        backend.backend.external.value = &context->fields[i]->native;
+        throwIfBad(
+            UA_Server_setVariableNode_valueBackend(server, config.fields[i].targetNodeId, backend)
+        );
+        context->backendNodes.push_back(config.fields[i].targetNodeId);
+    }
+
+    {
+        auto& serverContext = detail::getContext(*server_);
+        const std::lock_guard lock(serverContext.mutex);
+        serverContext.dataSetReaders.insert_or_assign(readerId, std::move(context));
+    }
+    resetBackends.release();
+    removeReader.release();
+    return {*server_, std::move(readerId)};
+}
+
+void ReaderGroup::start() {
+    auto* server = server_->handle();
+    throwIfBad(UA_Server_freezeReaderGroupConfiguration(server, id_));
+#if UAPP_OPEN62541_VER_GE(1, 4)
+    throwIfBad(UA_Server_enableReaderGroup(server, id_));
+#else
+    throwIfBad(UA_Server_setReaderGroupOperational(server, id_));
+#endif
+}
+
+void ReaderGroup::stop() {
+    auto* server = server_->handle();
+#if UAPP_OPEN62541_VER_GE(1, 4)
+    throwIfBad(UA_Server_disableReaderGroup(server, id_));
+#else
+    throwIfBad(UA_Server_setReaderGroupDisabled(server, id_));
+#endif
+    throwIfBad(UA_Server_unfreezeReaderGroupConfiguration(server, id_));
+}
+
+void ReaderGroup::remove() {
+    throwIfBad(UA_Server_removeReaderGroup(server_->handle(), id_));
+}
+
+/* -------------------------------------- PubSubConnection -------------------------------------- */
+
+PubSubConnection::PubSubConnection(Server& server, NodeId id) noexcept
+    : server_(&server),
+      id_(std::move(id)) {}
+
+WriterGroup PubSubConnection::addWriterGroup(const WriterGroupConfig& config) {
+    UA_UadpWriterGroupMessageDataType message{};
+    message.networkMessageContentMask = static_cast<UA_UadpNetworkMessageContentMask>(
+        UA_UADPNETWORKMESSAGECONTENTMASK_PUBLISHERID |
+        UA_UADPNETWORKMESSAGECONTENTMASK_GROUPHEADER |
+        UA_UADPNETWORKMESSAGECONTENTMASK_WRITERGROUPID |
+        UA_UADPNETWORKMESSAGECONTENTMASK_SEQUENCENUMBER |
+        UA_UADPNETWORKMESSAGECONTENTMASK_PAYLOADHEADER
+    );
+    UA_WriterGroupConfig groupConfig{};
+    groupConfig.name = detail::toNativeString(config.name);
+    groupConfig.writerGroupId = config.writerGroupId;
+    groupConfig.publishingInterval = config.publishingInterval;
+    groupConfig.encodingMimeType = UA_PUBSUB_ENCODING_UADP;
+    groupConfig.rtLevel = config.fixedSize ? UA_PUBSUB_RT_FIXED_SIZE : UA_PUBSUB_RT_NONE;
+    groupConfig.messageSettings.encoding = UA_EXTENSIONOBJECT_DECODED;
+    groupConfig.messageSettings.content.decoded.type =
+        &UA_TYPES[UA_TYPES_UADPWRITERGROUPMESSAGEDATATYPE];
+    groupConfig.messageSettings.content.decoded.data = &message;
+    NodeId id;
+    throwIfBad(UA_Server_addWriterGroup(server_->handle(), id_, &groupConfig, id.handle()));
+    return {*server_, std::move(id)};
+}
+
+ReaderGroup PubSubConnection::addReaderGroup(const ReaderGroupConfig& config) {
+    UA_ReaderGroupConfig groupConfig{};
+    groupConfig.name = detail::toNativeString(config.name);
+    groupConfig.rtLevel = UA_PUBSUB_RT_FIXED_SIZE;
+    NodeId id;
+    throwIfBad(UA_Server_addReaderGroup(server_->handle(), id_, &groupConfig, id.handle()));
+    return {*server_, std::move(id)};
+}
+
+void PubSubConnection::remove() {
+    throwIfBad(UA_Server_removePubSubConnection(server_->handle(), id_));
+}
+
+/* ------------------------------------------- Server ------------------------------------------- */
+
+PubSubConnection Server::addPubSubConnection(const PubSubConnectionConfig& config) {
+    addTransportLayer(*this, config.transport);
+
+    UA_NetworkAddressUrlDataType address{};
+    address.networkInterface = detail::toNativeString(config.networkInterface);
+    address.url = detail::toNativeString(config.address);
+
+    UA_PubSubConnectionConfig connectionConfig{};
+    connectionConfig.name = detail::toNativeString(config.name);
+    connectionConfig.transportProfileUri =
+        detail::toNativeString(getTransportProfileUri(config.transport));
+    UA_Variant_setScalar(
+        &connectionConfig.address, &address, &UA_TYPES[UA_TYPES_NETWORKADDRESSURLDATATYPE]
+    );
+#if UAPP_OPEN62541_VER_GE(1, 4)
+    connectionConfig.publisherId.idType = UA_PUBLISHERIDTYPE_UINT16;
+    connectionConfig.publisherId.id.uint16 = config.publisherId;
+#else
+    connectionConfig.enabled = true;
+    connectionConfig.publisherIdType = UA_PUBSUB_PUBLISHERID_NUMERIC;
+    connectionConfig.publisherId.numeric = config.publisherId;
+#endif
+
+    NodeId id;
+    throwIfBad(UA_Server_addPubSubConnection(handle(), &connectionConfig, id.handle()));
+    return {*this, std::move(id)};
+}
+
+}  // namespace opcua
+
+#endif
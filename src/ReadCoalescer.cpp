@@ -0,0 +1,136 @@
+#include "open62541pp/ReadCoalescer.h"
+
+#include <algorithm>  // min
+#include <iterator>  // make_move_iterator
+#include <utility>  // move, exchange
+
+#include "open62541pp/Client.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/detail/ClientContext.h"
+#include "open62541pp/services/Attribute.h"
+
+namespace opcua {
+
+static uint32_t readMaxNodesPerRead(Client& client) noexcept {
+    if (!client.isConnected()) {
+        return 0;
+    }
+    try {
+        return client.getOperationLimits().maxNodesPerRead;
+    } catch (...) {
+        return 0;  // limit unknown
+    }
+}
+
+ReadCoalescer::ReadCoalescer(Client& client, ReadCoalescerOptions options)
+    : client_(client),
+      options_(options),
+      maxNodesPerRead_(readMaxNodesPerRead(client)) {}
+
+ReadCoalescer::~ReadCoalescer() {
+    cancelFlush();
+}
+
+void ReadCoalescer::add(const NodeId& id, AttributeId attributeId, Handler&& handler) {
+    items_.emplace_back(id, attributeId);
+    handlers_.push_back(std::move(handler));
+    if (options_.maxBatchSize > 0 && handlers_.size() >= options_.maxBatchSize) {
+        flush();
+    } else if (handlers_.size() == 1) {
+        scheduleFlush();
+    }
+}
+
+void ReadCoalescer::scheduleFlush() {
+    const auto window = std::chrono::duration_cast<DateTime::UaDuration>(options_.window);
+    throwIfBad(UA_Client_addTimedCallback(
+        client_.handle(),
+        flushCallback,
+        this,
+        UA_DateTime_nowMonotonic() + window.count(),
+        &callbackId_
+    ));
+}
+
+void ReadCoalescer::cancelFlush() noexcept {
+    if (callbackId_ != 0) {
+        UA_Client_removeCallback(client_.handle(), callbackId_);
+        callbackId_ = 0;
+    }
+}
+
+void ReadCoalescer::flushCallback(UA_Client* client, void* data) {
+    auto* self = static_cast<ReadCoalescer*>(data);
+    self->callbackId_ = 0;  // timed callbacks are removed after execution
+    detail::getContext(client).exceptionCatcher.invoke([self] { self->flush(); });
+}
+
+static void dispatchReadResponse(
+    detail::ExceptionCatcher& catcher,
+    Span<std::function<void(StatusCode, DataValue&)>> handlers,
+    StatusCode code,
+    ReadResponse& response
+) {
+    if (code.isGood()) {
+        code = response->responseHeader.serviceResult;
+    }
+    auto results = response.getResults();
+    if (code.isGood() && results.size() != handlers.size()) {
+        code = UA_STATUSCODE_BADUNEXPECTEDERROR;
+    }
+    for (size_t i = 0; i < handlers.size(); ++i) {
+        if (code.isBad()) {
+            DataValue empty;
+            catcher.invoke(handlers[i], code, empty);
+            continue;
+        }
+        auto& result = results[i];
+        StatusCode itemCode;
+        if (result->hasStatus && StatusCode(result->status).isBad()) {
+            itemCode = result->status;
+        } else if (!result->hasValue) {
+            itemCode = UA_STATUSCODE_BADUNEXPECTEDERROR;
+        }
+        catcher.invoke(handlers[i], itemCode, result);
+    }
+}
+
+void ReadCoalescer::flush() {
+    cancelFlush();
+    const auto items = std::exchange(items_, {});
+    auto handlers = std::exchange(handlers_, {});
+    const size_t limits[] = {maxNodesPerRead_, options_.maxBatchSize};  // NOLINT
+    size_t chunkSize = items.size();
+    for (const size_t limit : limits) {
+        if (limit > 0) {
+            chunkSize = std::min(chunkSize, limit);
+        }
+    }
+    auto& catcher = detail::getContext(client_).exceptionCatcher;
+    for (size_t offset = 0; offset < items.size(); offset += chunkSize) {
+        const size_t count = std::min(chunkSize, items.size() - offset);
+        auto batch = std::make_shared<std::vector<Handler>>(
+            std::make_move_iterator(handlers.begin() + offset),
+            std::make_move_iterator(handlers.begin() + offset + count)
+        );
+        try {
+            services::readAsync(
+                client_,
+                Span<const ReadValueId>(items.data() + offset, count),  // NOLINT
+                options_.timestamps,
+                [batch, &catcher](StatusCode code, ReadResponse& response) {
+                    dispatchReadResponse(catcher, *batch, code, response);
+                }
+            );
+        } catch (const BadStatus& e) {
+            // request could not be sent
+            for (auto& handler : *batch) {
+                DataValue empty;
+                catcher.invoke(handler, e.code(), empty);
+            }
+        }
+    }
+}
+
+}  // namespace opcua
@@ -0,0 +1,292 @@
+#include "open62541pp/RoleAccessControl.h"
+
+#include <algorithm>  // find
+#include <utility>  // move
+
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Session.h"
+#include "open62541pp/services/View.h"  // browseRecursive
+#include "open62541pp/types/Composed.h"
+#include "open62541pp/types/ExtensionObject.h"
+
+namespace opcua {
+
+static std::vector<Login> toLogins(const std::vector<RoleLogin>& roleLogins) {
+    std::vector<Login> logins;
+    logins.reserve(roleLogins.size());
+    for (const auto& roleLogin : roleLogins) {
+        logins.push_back(roleLogin.login);
+    }
+    return logins;
+}
+
+RoleAccessControl::RoleAccessControl(bool allowAnonymous, std::vector<RoleLogin> logins)
+    : AccessControlDefault(allowAnonymous, toLogins(logins)),
+      roleLogins_(std::move(logins)) {}
+
+void RoleAccessControl::PermissionSet::grant(
+    RoleMask roles, Bitmask<Permission> permissions
+) noexcept {
+    if (permissions.allOf(Permission::Browse)) {
+        browse |= roles;
+    }
+    if (permissions.allOf(Permission::Read)) {
+        read |= roles;
+    }
+    if (permissions.allOf(Permission::Write)) {
+        write |= roles;
+    }
+    if (permissions.allOf(Permission::Call)) {
+        call |= roles;
+    }
+}
+
+RoleMask RoleAccessControl::PermissionSet::get(Permission permission) const noexcept {
+    switch (permission) {
+    case Permission::Browse:
+        return browse;
+    case Permission::Read:
+        return read;
+    case Permission::Write:
+        return write;
+    case Permission::Call:
+        return call;
+    default:
+        return 0;
+    }
+}
+
+bool RoleAccessControl::PermissionSet::operator==(const PermissionSet& other) const noexcept {
+    return browse == other.browse && read == other.read && write == other.write &&
+           call == other.call;
+}
+
+void RoleAccessControl::allowNamespace(
+    RoleMask roles, uint16_t namespaceIndex, Bitmask<Permission> permissions
+) {
+    if (namespaceIndex >= namespaceRules_.size()) {
+        namespaceRules_.resize(namespaceIndex + 1U);
+    }
+    namespaceRules_[namespaceIndex].grant(roles, permissions);
+}
+
+void RoleAccessControl::allowSubtree(
+    RoleMask roles, const NodeId& rootId, Bitmask<Permission> permissions
+) {
+    subtreeRules_.push_back({roles, rootId, permissions});
+}
+
+RoleAccessControl::SetIndex RoleAccessControl::intern(const PermissionSet& set) {
+    // few distinct sets, linear search is sufficient
+    const auto it = std::find(sets_.begin(), sets_.end(), set);
+    if (it != sets_.end()) {
+        return static_cast<SetIndex>(it - sets_.begin());
+    }
+    if (sets_.size() >= noSet) {
+        throw BadStatus(UA_STATUSCODE_BADOUTOFRANGE);
+    }
+    sets_.push_back(set);
+    return static_cast<SetIndex>(sets_.size() - 1);
+}
+
+void RoleAccessControl::assign(const NodeId& id, SetIndex index) {
+    constexpr uint32_t maxDenseId = 1U << 20U;  // larger numeric ids are hashed
+    if (id.getIdentifierType() == NodeIdType::Numeric) {
+        const auto numericId = id.getIdentifierAs<uint32_t>();
+        if (numericId < maxDenseId) {
+            if (id.getNamespaceIndex() >= numericSets_.size()) {
+                numericSets_.resize(id.getNamespaceIndex() + 1U);
+            }
+            auto& dense = numericSets_[id.getNamespaceIndex()];
+            if (numericId >= dense.size()) {
+                dense.resize(numericId + 1U, noSet);
+            }
+            dense[numericId] = index;
+            return;
+        }
+    }
+    otherSets_[id] = index;
+}
+
+void RoleAccessControl::compile(Server& server) {
+    sets_.clear();
+    namespaceSets_.clear();
+    numericSets_.clear();
+    otherSets_.clear();
+
+    const PermissionSet empty{};
+    intern(empty);  // index 0
+    namespaceSets_.reserve(namespaceRules_.size());
+    for (const auto& set : namespaceRules_) {
+        namespaceSets_.push_back(intern(set));
+    }
+    const auto getNamespaceSet = [&](uint16_t namespaceIndex) {
+        return namespaceIndex < namespaceRules_.size() ? namespaceRules_[namespaceIndex] : empty;
+    };
+
+    // accumulate the subtree rules per node, starting with the rules of the namespace
+    std::unordered_map<NodeId, PermissionSet> nodes;
+    for (const auto& rule : subtreeRules_) {
+        const auto grant = [&](const NodeId& id) {
+            auto [it, inserted] = nodes.try_emplace(id);
+            if (inserted) {
+                it->second = getNamespaceSet(id.getNamespaceIndex());
+            }
+            it->second.grant(rule.roles, rule.permissions);
+        };
+        grant(rule.rootId);
+        const BrowseDescription bd(
+            rule.rootId, BrowseDirection::Forward, ReferenceTypeId::HierarchicalReferences
+        );
+        for (const auto& descendant : services::browseRecursive(server, bd)) {
+            if (descendant.isLocal()) {
+                grant(descendant.getNodeId());
+            }
+        }
+    }
+    for (const auto& [id, set] : nodes) {
+        assign(id, intern(set));
+    }
+    invalidate();  // cached decisions of the sessions are based on the previous rules
+}
+
+const RoleAccessControl::PermissionSet& RoleAccessControl::lookup(const NodeId& id) const noexcept {
+    static const PermissionSet empty{};
+    SetIndex index = noSet;
+    const auto namespaceIndex = id.getNamespaceIndex();
+    if (id.getIdentifierType() == NodeIdType::Numeric && namespaceIndex < numericSets_.size()) {
+        const auto numericId = id.getIdentifierAs<uint32_t>();
+        const auto& dense = numericSets_[namespaceIndex];
+        if (numericId < dense.size()) {
+            index = dense[numericId];
+        }
+    }
+    if (index == noSet && !otherSets_.empty()) {
+        if (const auto it = otherSets_.find(id); it != otherSets_.end()) {
+            index = it->second;
+        }
+    }
+    if (index == noSet && namespaceIndex < namespaceSets_.size()) {
+        index = namespaceSets_[namespaceIndex];
+    }
+    return index < sets_.size() ? sets_[index] : empty;
+}
+
+RoleMask RoleAccessControl::getSessionRoles(const Session& session) const noexcept {
+    const auto it = sessionRoles_.find(session.getSessionId());
+    return it == sessionRoles_.end() ? 0 : it->second;
+}
+
+RoleMask RoleAccessControl::getGrantedRoles(
+    const NodeId& nodeId, Permission permission
+) const noexcept {
+    return lookup(nodeId).get(permission);
+}
+
+bool RoleAccessControl::isGranted(
+    Session& session, const NodeId& id, Permission permission
+) const noexcept {
+    return (lookup(id).get(permission) & getSessionRoles(session)) != 0;
+}
+
+StatusCode RoleAccessControl::activateSession(
+    Session& session,
+    const EndpointDescription& endpointDescription,
+    const ByteString& secureChannelRemoteCertificate,
+    const ExtensionObject& userIdentityToken
+) {
+    const auto status = AccessControlDefault::activateSession(
+        session, endpointDescription, secureChannelRemoteCertificate, userIdentityToken
+    );
+    if (status.isBad()) {
+        return status;
+    }
+    RoleMask roles = anonymousRoles_;
+    if (const auto* token = userIdentityToken.getDecodedData<UserNameIdentityToken>();
+        token != nullptr) {
+        roles = 0;
+        for (const auto& roleLogin : roleLogins_) {
+            if (roleLogin.login.username == token->getUserName() &&
+                roleLogin.login.password == token->getPassword()) {
+                roles = roleLogin.roles;
+                break;
+            }
+        }
+    }
+    sessionRoles_[session.getSessionId()] = roles;
+    return status;
+}
+
+void RoleAccessControl::closeSession(Session& session) {
+    sessionRoles_.erase(session.getSessionId());
+}
+
+Bitmask<WriteMask> RoleAccessControl::getUserRightsMask(Session& session, const NodeId& nodeId) {
+    return isGranted(session, nodeId, Permission::Write) ? 0xFFFFFFFF : 0;
+}
+
+Bitmask<AccessLevel> RoleAccessControl::getUserAccessLevel(
+    Session& session, const NodeId& nodeId
+) {
+    const auto& set = lookup(nodeId);
+    const RoleMask roles = getSessionRoles(session);
+    Bitmask<AccessLevel> accessLevel = AccessLevel::None;
+    if ((set.read & roles) != 0) {
+        accessLevel |= AccessLevel::CurrentRead | AccessLevel::HistoryRead;
+    }
+    if ((set.write & roles) != 0) {
+        accessLevel |= AccessLevel::CurrentWrite | AccessLevel::HistoryWrite;
+    }
+    return accessLevel;
+}
+
+bool RoleAccessControl::getUserExecutable(Session& session, const NodeId& methodId) {
+    return isGranted(session, methodId, Permission::Call);
+}
+
+bool RoleAccessControl::getUserExecutableOnObject(
+    Session& session, const NodeId& methodId, [[maybe_unused]] const NodeId& objectId
+) {
+    return isGranted(session, methodId, Permission::Call);
+}
+
+bool RoleAccessControl::allowAddNode(Session& session, const AddNodesItem& item) {
+    return isGranted(session, item.getParentNodeId().getNodeId(), Permission::Write);
+}
+
+bool RoleAccessControl::allowAddReference(Session& session, const AddReferencesItem& item) {
+    return isGranted(session, item.getSourceNodeId(), Permission::Write);
+}
+
+bool RoleAccessControl::allowDeleteNode(Session& session, const DeleteNodesItem& item) {
+    return isGranted(session, item.getNodeId(), Permission::Write);
+}
+
+bool RoleAccessControl::allowDeleteReference(Session& session, const DeleteReferencesItem& item) {
+    return isGranted(session, item.getSourceNodeId(), Permission::Write);
+}
+
+bool RoleAccessControl::allowBrowseNode(Session& session, const NodeId& nodeId) {
+    return isGranted(session, nodeId, Permission::Browse);
+}
+
+bool RoleAccessControl::allowHistoryUpdate(
+    Session& session,
+    const NodeId& nodeId,
+    [[maybe_unused]] PerformUpdateType performInsertReplace,
+    [[maybe_unused]] const DataValue& value
+) {
+    return isGranted(session, nodeId, Permission::Write);
+}
+
+bool RoleAccessControl::allowHistoryDelete(
+    Session& session,
+    const NodeId& nodeId,
+    [[maybe_unused]] DateTime startTimestamp,
+    [[maybe_unused]] DateTime endTimestamp,
+    [[maybe_unused]] bool isDeleteModified
+) {
+    return isGranted(session, nodeId, Permission::Write);
+}
+
+}  // namespace opcua
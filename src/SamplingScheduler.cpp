@@ -0,0 +1,161 @@
+#include "open62541pp/SamplingScheduler.h"
+
+#include <algorithm>  // max, remove_if, stable_sort
+#include <iterator>  // next
+#include <utility>  // move
+
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/detail/ScopeExit.h"
+#include "open62541pp/detail/ServerContext.h"
+#include "open62541pp/open62541.h"
+
+namespace opcua {
+
+SamplingScheduler::SamplingScheduler(
+    Server& server, std::chrono::milliseconds resolution, size_t wheelSize
+)
+    : server_(server),
+      resolution_(std::max(resolution, std::chrono::milliseconds(1))),
+      wheel_(std::max<size_t>(wheelSize, 1)) {
+    throwIfBad(UA_Server_addRepeatedCallback(
+        server.handle(),
+        onTick,
+        this,
+        static_cast<double>(resolution_.count()),
+        &callbackId_
+    ));
+}
+
+SamplingScheduler::~SamplingScheduler() {
+    UA_Server_removeRepeatedCallback(server_.handle(), callbackId_);
+}
+
+SamplingScheduler::GroupId SamplingScheduler::addGroup(
+    std::chrono::milliseconds interval, Span<const NodeId> ids, Provider provider, uint8_t priority
+) {
+    const auto id = nextId_++;
+    auto& group = groups_[id];
+    const auto ticks = (interval.count() + resolution_.count() - 1) / resolution_.count();
+    group.intervalTicks = static_cast<uint64_t>(std::max<int64_t>(ticks, 1));
+    group.ids.assign(ids.begin(), ids.end());
+    group.values.resize(ids.size());
+    group.provider = std::move(provider);
+    group.priority = priority;
+    // align groups of the same interval to the same ticks
+    group.nextTick = (tick_ / group.intervalTicks + 1) * group.intervalTicks;
+    schedule(id, group.nextTick);
+    return id;
+}
+
+void SamplingScheduler::removeGroup(GroupId id) noexcept {
+    if (dispatching_) {
+        // the provider of the group might be running, erase after the dispatch
+        const auto it = groups_.find(id);
+        if (it != groups_.end() && !it->second.removed) {
+            it->second.removed = true;
+            ++removedCount_;
+        }
+        return;
+    }
+    groups_.erase(id);  // wheel entries are skipped lazily
+}
+
+void SamplingScheduler::eraseRemoved() noexcept {
+    dispatching_ = false;
+    if (removedCount_ == 0) {
+        return;
+    }
+    for (auto it = groups_.begin(); it != groups_.end();) {
+        it = it->second.removed ? groups_.erase(it) : std::next(it);
+    }
+    removedCount_ = 0;
+}
+
+void SamplingScheduler::onTick([[maybe_unused]] UA_Server* server, void* data) noexcept {
+    auto* scheduler = static_cast<SamplingScheduler*>(data);
+    detail::getContext(scheduler->server_).exceptionCatcher.invoke([scheduler] {
+        scheduler->tick();
+    });
+}
+
+void SamplingScheduler::schedule(GroupId id, uint64_t tick) {
+    wheel_[tick % wheel_.size()].push_back(id);
+}
+
+void SamplingScheduler::tick() {
+    ++tick_;
+    due_.clear();
+    std::swap(due_, wheel_[tick_ % wheel_.size()]);
+    // deferred groups of the previous tick first, removed groups are skipped
+    ready_.clear();
+    std::swap(ready_, deferred_);
+    ready_.erase(
+        std::remove_if(
+            ready_.begin(), ready_.end(), [&](GroupId id) { return groups_.count(id) == 0; }
+        ),
+        ready_.end()
+    );
+    for (const auto id : due_) {
+        const auto it = groups_.find(id);
+        if (it == groups_.end()) {
+            continue;  // removed
+        }
+        auto& group = it->second;
+        if (group.nextTick > tick_) {
+            schedule(id, group.nextTick);  // due in a later round of the wheel
+            continue;
+        }
+        group.nextTick += group.intervalTicks;
+        schedule(id, group.nextTick);
+        if (!group.deferred) {
+            ready_.push_back(id);
+        }
+    }
+    std::stable_sort(ready_.begin(), ready_.end(), [&](GroupId lhs, GroupId rhs) {
+        return groups_.at(lhs).priority > groups_.at(rhs).priority;
+    });
+
+    const auto timestamp = DateTime::now();
+    const auto start = std::chrono::steady_clock::now();
+    dispatching_ = true;
+    const auto eraseOnExit = detail::ScopeExit([&] { eraseRemoved(); });
+    for (size_t i = 0; i < ready_.size(); ++i) {
+        const auto it = groups_.find(ready_[i]);
+        if (it == groups_.end() || it->second.removed) {
+            continue;  // removed by a provider
+        }
+        auto& group = it->second;
+        const bool exceeded = tickBudget_.count() > 0 && i > 0 &&
+                              std::chrono::steady_clock::now() - start >= tickBudget_;
+        if (exceeded) {
+            group.deferred = true;
+            deferred_.push_back(ready_[i]);
+            ++deferredCount_;
+            continue;
+        }
+        group.deferred = false;
+        sample(group, timestamp);
+    }
+}
+
+void SamplingScheduler::sample(Group& group, DateTime timestamp) {
+    for (auto& value : group.values) {
+        value->hasSourceTimestamp = false;  // reset timestamps of the previous sample
+    }
+    group.provider(group.ids, group.values);
+    UA_WriteValue item{};
+    item.attributeId = UA_ATTRIBUTEID_VALUE;
+    for (size_t i = 0; i < group.ids.size(); ++i) {
+        auto& value = group.values[i];
+        if (!value.hasSourceTimestamp()) {
+            value.setSourceTimestamp(timestamp);
+        }
+        // shallow copies, UA_Server_write copies the value into the node
+        item.nodeId = *group.ids[i].handle();
+        item.value = *value.handle();
+        UA_Server_write(server_.handle(), &item);
+    }
+}
+
+}  // namespace opcua
@@ -1,16 +1,23 @@
 #include "open62541pp/Server.h"
 
+#include <algorithm>  // max
 #include <atomic>
 #include <cassert>
+#include <chrono>
 #include <cstddef>
+#include <functional>
+#include <memory>
 #include <mutex>
-#include <utility>  // move
+#include <string>
+#include <utility>  // as_const, move
+#include <vector>
 
 #include "open62541pp/AccessControl.h"
 #include "open62541pp/Config.h"
 #include "open62541pp/DataType.h"
 #include "open62541pp/ErrorHandling.h"
 #include "open62541pp/Event.h"
+#include "open62541pp/NamespaceTable.h"
 #include "open62541pp/Node.h"
 #include "open62541pp/Session.h"
 #include "open62541pp/TypeWrapper.h"
@@ -23,6 +30,8 @@
 #include "open62541pp/types/DataValue.h"
 #include "open62541pp/types/Variant.h"
 
+#include "CertificateVerificationCache.h"
+#include "CryptoOffload.h"
 #include "CustomAccessControl.h"
 #include "CustomDataTypes.h"
 #include "CustomLogger.h"
@@ -40,6 +49,69 @@ inline static UA_ServerConfig* getConfig(Server* server) noexcept {
     return UA_Server_getConfig(server->handle());
 }
 
+static void deliverWriteNotifications(detail::ServerContext& context) {
+    if (!context.hasWriteNotifications.exchange(false, std::memory_order_acquire)) {
+        return;
+    }
+    // groups are never removed, the context lock is not held during the callbacks
+    for (size_t i = 0;; ++i) {
+        detail::WriteNotificationGroup* group = nullptr;
+        {
+            const std::lock_guard lock(context.mutex);
+            if (i >= context.writeNotificationGroups.size()) {
+                break;
+            }
+            group = context.writeNotificationGroups[i].get();
+        }
+        {
+            const std::lock_guard lock(group->mutex);
+            std::swap(group->pending, group->delivering);
+        }
+        if (!group->delivering.empty()) {
+            context.exceptionCatcher.invoke(
+                group->callback, Span<const WriteNotification>(group->delivering)
+            );
+            group->delivering.clear();
+        }
+    }
+}
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+static void deliverDataChangeNotifications(detail::ServerContext& context) {
+    if (!context.hasDataChangeNotifications.exchange(false, std::memory_order_acquire)) {
+        return;
+    }
+    // groups might be removed concurrently, the context lock is not held during the callbacks
+    std::vector<std::shared_ptr<detail::DataChangeNotificationGroup>> groups;
+    {
+        const std::lock_guard lock(context.mutex);
+        groups = context.dataChangeNotificationGroups;
+    }
+    for (const auto& group : groups) {
+        {
+            const std::lock_guard lock(group->mutex);
+            std::swap(group->pending, group->delivering);
+        }
+        if (!group->delivering.empty()) {
+            context.exceptionCatcher.invoke(
+                group->callback,
+                0U,
+                Span<services::MonitoredItemNotification>(group->delivering)
+            );
+            group->delivering.clear();
+        }
+    }
+}
+#endif
+
+static void deliverNotifications(detail::ServerContext& context) {
+    const detail::TraceScope trace(context.metrics, ServerTracepoint::NotificationDelivery);
+    deliverWriteNotifications(context);
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+    deliverDataChangeNotifications(context);
+#endif
+}
+
 /* ----------------------------------------- Connection ----------------------------------------- */
 
 class Server::Connection {
@@ -74,8 +146,11 @@ public:
         if (!running_) {
             runStartup();
         }
+        const detail::TraceScope trace(context_.metrics, ServerTracepoint::Iteration);
+        context_.admission.nextIteration();
         auto interval = UA_Server_run_iterate(handle(), false /* don't wait */);
-        context_.exceptionCatcher.rethrow();
+        deliverNotifications(context_);
+        rethrow();
         return interval;
     }
 
@@ -87,9 +162,12 @@ public:
         const std::lock_guard<std::mutex> lock(mutex_);
         try {
             while (running_) {
+                const detail::TraceScope trace(context_.metrics, ServerTracepoint::Iteration);
+                context_.admission.nextIteration();
                 // https://github.com/open62541/open62541/blob/master/examples/server_mainloop.c
                 UA_Server_run_iterate(handle(), true /* wait for messages in the networklayer */);
-                context_.exceptionCatcher.rethrow();
+                deliverNotifications(context_);
+                rethrow();
             }
         } catch (...) {
             running_ = false;
@@ -109,6 +187,15 @@ public:
         return running_;
     }
 
+    void rethrow() {
+        if (context_.exceptionCatcher.hasException() && context_.metrics.isTracing()) {
+            context_.metrics.trace(
+                {ServerTracepoint::ExceptionRethrow, {}, std::chrono::steady_clock::now(), {}}
+            );
+        }
+        context_.exceptionCatcher.rethrow();
+    }
+
     UA_Server* handle() noexcept {
         return server_;
     }
@@ -133,12 +220,21 @@ public:
         return customLogger_;
     }
 
+#ifdef UA_ENABLE_ENCRYPTION
+    auto& getCertificateVerificationCache() noexcept {
+        return certificateVerificationCache_;
+    }
+#endif
+
 private:
     UA_Server* server_;
     detail::ServerContext context_;
     CustomAccessControl customAccessControl_;
     CustomDataTypes customDataTypes_;
     CustomLogger customLogger_;
+#ifdef UA_ENABLE_ENCRYPTION
+    CertificateVerificationCache certificateVerificationCache_;
+#endif
     std::atomic<bool> running_{false};
     std::mutex mutex_;
 };
@@ -206,8 +302,16 @@ Server::Server(
 }
 #endif
 
-void Server::setLogger(Logger logger) {
-    connection_->getCustomLogger().setLogger(std::move(logger));
+void Server::setLogger(Logger logger, const LogFilter& filter) {
+    connection_->getCustomLogger().setLogger(std::move(logger), filter);
+}
+
+void Server::setAsyncLogger(Logger logger, const AsyncLoggerOptions& options) {
+    connection_->getCustomLogger().setAsyncLogger(std::move(logger), options);
+}
+
+void Server::setStructuredLogger(StructuredLogger logger, const LogFilter& filter) {
+    connection_->getCustomLogger().setStructuredLogger(std::move(logger), filter);
 }
 
 // copy to endpoints needed, see: https://github.com/open62541/open62541/issues/1175
@@ -241,6 +345,24 @@ void Server::setProductUri(std::string_view uri) {
     copyApplicationDescriptionToEndpoints(getConfig(this));
 }
 
+void Server::setTransportSettings(const TransportSettings& settings) {
+    auto* config = getConfig(this);
+#if UAPP_OPEN62541_VER_GE(1, 4)
+    config->tcpBufSize = std::max(settings.sendBufferSize, settings.recvBufferSize);
+    config->tcpMaxMsgSize = settings.maxMessageSize;
+    config->tcpMaxChunks = settings.maxChunkCount;
+#else
+    // remote limits are taken from the Hello message of the client
+    for (size_t i = 0; i < config->networkLayersSize; ++i) {
+        auto& connectionConfig = config->networkLayers[i].localConnectionConfig;
+        connectionConfig.sendBufferSize = settings.sendBufferSize;
+        connectionConfig.recvBufferSize = settings.recvBufferSize;
+        connectionConfig.localMaxMessageSize = settings.maxMessageSize;
+        connectionConfig.localMaxChunkCount = settings.maxChunkCount;
+    }
+#endif
+}
+
 void Server::setAccessControl(AccessControlBase& accessControl) {
     connection_->getCustomAccessControl().setAccessControl(accessControl);
 }
@@ -249,64 +371,276 @@ void Server::setAccessControl(std::unique_ptr<AccessControlBase> accessControl)
     connection_->getCustomAccessControl().setAccessControl(std::move(accessControl));
 }
 
+#ifdef UA_ENABLE_ENCRYPTION
+void Server::setCertificateValidationCache(std::chrono::seconds ttl, size_t maxEntries) {
+    auto& cache = connection_->getCertificateVerificationCache();
+    cache.install(*getConfig(this));
+    cache.setOptions(ttl, maxEntries);
+}
+
+void Server::setTrustList(
+    Span<const ByteString> trustList,
+    Span<const ByteString> issuerList,
+    Span<const ByteString> revocationList
+) {
+    auto& cache = connection_->getCertificateVerificationCache();
+    cache.install(*getConfig(this));
+    cache.setTrustList(trustList, issuerList, revocationList);
+}
+#endif
+
+#ifdef UAPP_HAS_CRYPTO_OFFLOAD
+void Server::setAsymmetricCryptoOffload(size_t threads) {
+    opcua::setAsymmetricCryptoOffload(*getConfig(this), threads);
+}
+#endif
+
+#ifdef UA_ENABLE_WEBSOCKET_SERVER
+void Server::addWebSocketEndpoint(
+    uint16_t port, const ByteString& certificate, const ByteString& privateKey
+) {
+    auto* config = getConfig(this);
+    const bool secure = !certificate.empty() || !privateKey.empty();
+#if UAPP_OPEN62541_VER_GE(1, 4)
+    // connection managers of the event loop are selected by the scheme of the server URLs
+    if (secure) {
+        throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+    }
+    const String url(std::string("opc.ws://:").append(std::to_string(port)));
+    throwIfBad(UA_Array_appendCopy(
+        reinterpret_cast<void**>(&config->serverUrls),  // NOLINT
+        &config->serverUrlsSize,
+        url.handle(),
+        &UA_TYPES[UA_TYPES_STRING]
+    ));
+#elif UAPP_OPEN62541_VER_GE(1, 2)
+    throwIfBad(UA_ServerConfig_addNetworkLayerWS(
+        config,
+        port,
+        0,  // default send buffer size
+        0,  // default receive buffer size
+        secure ? certificate.handle() : nullptr,
+        secure ? privateKey.handle() : nullptr
+    ));
+#else
+    if (secure) {
+        throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+    }
+    throwIfBad(UA_ServerConfig_addNetworkLayerWS(config, port, 0, 0));
+#endif
+}
+#endif
+
 std::vector<Session> Server::getSessions() const {
     return connection_->getCustomAccessControl().getSessions();
 }
 
+void Server::forEachSession(const std::function<void(Session&)>& func) {
+    connection_->getCustomAccessControl().forEachSession(func);
+}
+
+Session* Server::getCurrentSession() noexcept {
+    auto* entry = detail::SessionScope::getCurrent();
+    if (entry == nullptr || entry->session.getConnection() != *this) {
+        return nullptr;
+    }
+    return &entry->session;
+}
+
+/// Invoke a function with the cached namespace table under the lock of the server context.
+template <typename Func>
+static auto withNamespaceTable(Server& server, Func&& func) {
+    auto& context = detail::getContext(server);
+    const std::lock_guard lock(context.mutex);
+    if (!context.namespaceTable.has_value()) {
+        context.namespaceTable.emplace(
+            services::readValue(server, NodeIdView(0, UA_NS0ID_SERVER_NAMESPACEARRAY))
+                .getArrayCopy<std::string>()
+        );
+    }
+    return func(std::as_const(*context.namespaceTable));
+}
+
 std::vector<std::string> Server::getNamespaceArray() {
-    return services::readValue(*this, {0, UA_NS0ID_SERVER_NAMESPACEARRAY})
-        .getArrayCopy<std::string>();
+    return withNamespaceTable(*this, [](const NamespaceTable& table) { return table.getUris(); });
+}
+
+NamespaceTable Server::getNamespaceTable() {
+    return withNamespaceTable(*this, [](const NamespaceTable& table) { return table; });
+}
+
+static void resetNamespaceTable(detail::ServerContext& context) {
+    const std::lock_guard lock(context.mutex);
+    context.namespaceTable.reset();
+}
+
+uint16_t Server::getNamespaceIndex(std::string_view uri) {
+    const auto find = [&](const NamespaceTable& table) { return table.find(uri); };
+    auto index = withNamespaceTable(*this, find);
+    if (!index.has_value()) {
+        resetNamespaceTable(connection_->getContext());  // namespace might be added since
+        index = withNamespaceTable(*this, find);
+    }
+    if (!index.has_value()) {
+        throw BadStatus(UA_STATUSCODE_BADNOTFOUND);
+    }
+    return *index;
+}
+
+NodeId Server::resolveNodeId(const ExpandedNodeId& id) {
+    if (!id.isLocal()) {
+        throw BadStatus(UA_STATUSCODE_BADNODEIDUNKNOWN);
+    }
+    const auto uri = id.getNamespaceUri();
+    if (uri.empty()) {
+        return id.getNodeId();
+    }
+    NodeId result(id.getNodeId());
+    result->namespaceIndex = getNamespaceIndex(uri);
+    return result;
 }
 
 uint16_t Server::registerNamespace(std::string_view uri) {
-    return UA_Server_addNamespace(handle(), std::string(uri).c_str());
+    const auto namespaceIndex = UA_Server_addNamespace(handle(), std::string(uri).c_str());
+    resetNamespaceTable(connection_->getContext());
+    return namespaceIndex;
 }
 
 void Server::setCustomDataTypes(std::vector<DataType> dataTypes) {
     connection_->getCustomDataTypes().setCustomDataTypes(std::move(dataTypes));
 }
 
+void Server::setPassthroughDataTypes(std::vector<DataType> dataTypes) {
+    connection_->getCustomDataTypes().setPassthroughDataTypes(std::move(dataTypes));
+}
+
+void Server::setDataTypeRegistry(std::shared_ptr<const DataTypeRegistry> registry) {
+    connection_->getCustomDataTypes().setRegistry(std::move(registry));
+}
+
+std::shared_ptr<const DataTypeRegistry> Server::getDataTypeRegistry() const noexcept {
+    return connection_->getCustomDataTypes().getRegistry();
+}
+
+const UA_DataType* Server::findDataType(const NodeId& id) const noexcept {
+    return connection_->getCustomDataTypes().find(id);
+}
+
 static void valueCallbackOnRead(
-    [[maybe_unused]] UA_Server* server,
+    UA_Server* server,
     [[maybe_unused]] const UA_NodeId* sessionId,
-    [[maybe_unused]] void* sessionContext,
+    void* sessionContext,
     [[maybe_unused]] const UA_NodeId* nodeId,
     void* nodeContext,
     [[maybe_unused]] const UA_NumericRange* range,
     const UA_DataValue* value
 ) noexcept {
     assert(nodeContext != nullptr && value != nullptr);
-    auto& cb = static_cast<detail::NodeContext*>(nodeContext)->valueCallback.onBeforeRead;
-    if (cb) {
+    const detail::SessionScope scope(server, sessionContext);
+    auto* context = static_cast<detail::NodeContext*>(nodeContext);
+    const auto* callback = context->valueCallback();
+    if (callback != nullptr && callback->onBeforeRead) {
+        const auto& cb = callback->onBeforeRead;
+        const auto period = callback->minRefreshPeriod;
+        if (period.count() > 0) {
+            // skip the refresh if the stored value is recent enough
+            const auto now = std::chrono::steady_clock::now();
+            auto& lastRefresh = *context->lastRefresh();
+            if (lastRefresh.has_value() && now - *lastRefresh < period) {
+                return;
+            }
+            lastRefresh = now;
+        }
         detail::tryInvoke([&] { cb(asWrapper<DataValue>(*value)); });
     }
 }
 
 static void valueCallbackOnWrite(
-    [[maybe_unused]] UA_Server* server,
+    UA_Server* server,
     [[maybe_unused]] const UA_NodeId* sessionId,
-    [[maybe_unused]] void* sessionContext,
+    void* sessionContext,
     [[maybe_unused]] const UA_NodeId* nodeId,
     void* nodeContext,
     [[maybe_unused]] const UA_NumericRange* range,
     const UA_DataValue* value
 ) noexcept {
     assert(nodeContext != nullptr && value != nullptr);
-    auto& cb = static_cast<detail::NodeContext*>(nodeContext)->valueCallback.onAfterWrite;
-    if (cb) {
-        detail::tryInvoke([&] { cb(asWrapper<DataValue>(*value)); });
+    const detail::SessionScope scope(server, sessionContext);
+    const auto* callback = static_cast<detail::NodeContext*>(nodeContext)->valueCallback();
+    if (callback != nullptr && callback->onAfterWrite) {
+        detail::tryInvoke([&] { callback->onAfterWrite(asWrapper<DataValue>(*value)); });
     }
 }
 
+/**
+ * Check that the node context of a node can be replaced by its NodeContext.
+ * Backend objects and bulk registrations install other node context types (backend object,
+ * KeyedNodeContext, context blocks), which are cast by their bound native callbacks. Combining them
+ * with other callbacks would mix the context types.
+ * @exception BadStatus (BadInvalidState) If the node is bound to another node context
+ */
+static void checkNodeContextReplaceable(Server& server, const NodeId& id) {
+    void* current = nullptr;
+    throwIfBad(UA_Server_getNodeContext(server.handle(), id, &current));
+    if (current != nullptr && current != detail::getContext(server).nodeContexts.find(id)) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDSTATE);
+    }
+}
+
+static void setValueCallbackNative(
+    Server& server, const NodeId& id, detail::NodeContext& nodeContext
+) {
+    // install only the hooks with callbacks, skip trampolines with empty callbacks
+    UA_ValueCallback callbackNative{};
+    const auto* callback = nodeContext.valueCallback();
+    if (callback != nullptr && callback->onBeforeRead) {
+        callbackNative.onRead = valueCallbackOnRead;
+    }
+    if (callback != nullptr && callback->onAfterWrite) {
+        callbackNative.onWrite = valueCallbackOnWrite;
+    }
+    throwIfBad(UA_Server_setVariableNode_valueCallback(server.handle(), id, callbackNative));
+}
+
 void Server::setVariableNodeValueCallback(const NodeId& id, ValueCallback callback) {
+    checkNodeContextReplaceable(*this, id);
     auto* nodeContext = detail::getContext(*this).nodeContexts[id];
-    nodeContext->valueCallback = std::move(callback);
+    nodeContext->setValueCallback(std::move(callback));
     throwIfBad(UA_Server_setNodeContext(handle(), id, nodeContext));
 
-    UA_ValueCallback callbackNative;
-    callbackNative.onRead = valueCallbackOnRead;
-    callbackNative.onWrite = valueCallbackOnWrite;
-    throwIfBad(UA_Server_setVariableNode_valueCallback(handle(), id, callbackNative));
+    setValueCallbackNative(*this, id, *nodeContext);
+}
+
+void Server::addWriteNotificationCallback(
+    Span<const NodeId> ids, std::function<void(Span<const WriteNotification>)> callback
+) {
+    for (const auto& id : ids) {
+        checkNodeContextReplaceable(*this, id);
+    }
+    auto& context = detail::getContext(*this);
+    auto group = std::make_unique<detail::WriteNotificationGroup>();
+    group->callback = std::move(callback);
+    auto* groupPtr = group.get();
+    {
+        const std::lock_guard lock(context.mutex);
+        context.writeNotificationGroups.push_back(std::move(group));
+    }
+    for (const auto& id : ids) {
+        auto* nodeContext = context.nodeContexts[id];
+        // keep the onBeforeRead callback of the node
+        auto* current = nodeContext->valueCallback();
+        ValueCallback valueCallback = current != nullptr ? std::move(*current) : ValueCallback{};
+        valueCallback.onAfterWrite = [&context, groupPtr, id](const DataValue& value) {
+            {
+                const std::lock_guard lock(groupPtr->mutex);
+                groupPtr->pending.push_back({id, value});
+            }
+            context.hasWriteNotifications.store(true, std::memory_order_release);
+        };
+        nodeContext->setValueCallback(std::move(valueCallback));
+        throwIfBad(UA_Server_setNodeContext(handle(), id, nodeContext));
+        setValueCallbackNative(*this, id, *nodeContext);
+    }
 }
 
 inline static NumericRange asRange(const UA_NumericRange* range) noexcept {
@@ -314,9 +648,9 @@ inline static NumericRange asRange(const UA_NumericRange* range) noexcept {
 }
 
 static UA_StatusCode valueSourceRead(
-    [[maybe_unused]] UA_Server* server,
+    UA_Server* server,
     [[maybe_unused]] const UA_NodeId* sessionId,
-    [[maybe_unused]] void* sessionContext,
+    void* sessionContext,
     [[maybe_unused]] const UA_NodeId* nodeId,
     void* nodeContext,
     UA_Boolean includeSourceTimestamp,
@@ -324,35 +658,74 @@ static UA_StatusCode valueSourceRead(
     UA_DataValue* value
 ) noexcept {
     assert(nodeContext != nullptr && value != nullptr);
-    auto& callback = static_cast<detail::NodeContext*>(nodeContext)->dataSource.read;
-    if (callback) {
-        return detail::tryInvokeGetStatus(
-            callback, asWrapper<DataValue>(*value), asRange(range), includeSourceTimestamp
-        );
+    if (const auto status = detail::admitOperation(server, sessionContext, true);
+        status != UA_STATUSCODE_GOOD) {
+        return status;
     }
-    return UA_STATUSCODE_BADINTERNALERROR;
+    const detail::SessionScope scope(server, sessionContext);
+    const detail::CallbackTimer timer(
+        detail::getMetricsRecorder(server), MetricsCallback::DataSourceRead
+    );
+    const auto* dataSource = static_cast<detail::NodeContext*>(nodeContext)->dataSource();
+    if (dataSource == nullptr || !dataSource->read) {
+        return UA_STATUSCODE_BADINTERNALERROR;
+    }
+    auto& dv = asWrapper<DataValue>(*value);
+    const bool applyReadRange = dataSource->applyReadRange && range != nullptr;
+    const auto status = detail::tryInvokeGetStatus(
+        dataSource->read,
+        dv,
+        applyReadRange ? NumericRange() : asRange(range),
+        includeSourceTimestamp
+    );
+    if (status.isBad()) {
+        return status;
+    }
+    if (dataSource->autoSourceTimestamp && includeSourceTimestamp && !dv.hasSourceTimestamp()) {
+        dv.setSourceTimestamp(DateTime::nowCoarse());
+    }
+    if (!applyReadRange) {
+        return status;
+    }
+    return detail::tryInvokeGetStatus([&] {
+        auto& var = dv.getValue();
+        var = var->storageType == UA_VARIANT_DATA_NODELETE
+            ? var.getRange<VariantPolicy::ReferenceIfPossible>(asRange(range))
+            : var.getRange(asRange(range));
+    });
 }
 
 static UA_StatusCode valueSourceWrite(
-    [[maybe_unused]] UA_Server* server,
+    UA_Server* server,
     [[maybe_unused]] const UA_NodeId* sessionId,
-    [[maybe_unused]] void* sessionContext,
+    void* sessionContext,
     [[maybe_unused]] const UA_NodeId* nodeId,
     void* nodeContext,
     const UA_NumericRange* range,
     const UA_DataValue* value
 ) noexcept {
     assert(nodeContext != nullptr && value != nullptr);
-    auto& callback = static_cast<detail::NodeContext*>(nodeContext)->dataSource.write;
-    if (callback) {
-        return detail::tryInvokeGetStatus(callback, asWrapper<DataValue>(*value), asRange(range));
+    if (const auto status = detail::admitOperation(server, sessionContext, false);
+        status != UA_STATUSCODE_GOOD) {
+        return status;
+    }
+    const detail::SessionScope scope(server, sessionContext);
+    const detail::CallbackTimer timer(
+        detail::getMetricsRecorder(server), MetricsCallback::DataSourceWrite
+    );
+    const auto* dataSource = static_cast<detail::NodeContext*>(nodeContext)->dataSource();
+    if (dataSource != nullptr && dataSource->write) {
+        return detail::tryInvokeGetStatus(
+            dataSource->write, asWrapper<DataValue>(*value), asRange(range)
+        );
     }
     return UA_STATUSCODE_BADINTERNALERROR;
 }
 
 void Server::setVariableNodeValueBackend(const NodeId& id, ValueBackendDataSource backend) {
+    checkNodeContextReplaceable(*this, id);
     auto* nodeContext = detail::getContext(*this).nodeContexts[id];
-    nodeContext->dataSource = std::move(backend);
+    nodeContext->setDataSource(std::move(backend));
     throwIfBad(UA_Server_setNodeContext(handle(), id, nodeContext));
 
     UA_DataSource dataSourceNative;
@@ -361,6 +734,94 @@ void Server::setVariableNodeValueBackend(const NodeId& id, ValueBackendDataSourc
     throwIfBad(UA_Server_setVariableNode_dataSource(handle(), id, dataSourceNative));
 }
 
+#if UAPP_OPEN62541_VER_GE(1, 2)
+void Server::setVariableNodeValueBackend(const NodeId& id, ValueBackendExternal& backend) {
+    UA_ValueBackend backendNative{};
+    backendNative.backendType = UA_VALUEBACKENDTYPE_EXTERNAL;
+    backendNative.backend.external.value = backend.handle();
+    throwIfBad(UA_Server_setVariableNode_valueBackend(handle(), id, backendNative));
+}
+#endif
+
+template <typename GetContext>
+static void setDataSources(Server& server, Span<const NodeId> ids, GetContext&& getContext) {
+    UA_DataSource dataSourceNative;
+    dataSourceNative.read = valueSourceRead;
+    dataSourceNative.write = valueSourceWrite;
+    auto& nodeContexts = detail::getContext(server).nodeContexts;
+    for (size_t i = 0; i < ids.size(); ++i) {
+        const auto& id = ids[i];
+        throwIfBad(UA_Server_setNodeContext(server.handle(), id, getContext(i)));
+        throwIfBad(UA_Server_setVariableNode_dataSource(server.handle(), id, dataSourceNative));
+        nodeContexts.erase(id);  // replaced by the bulk context
+    }
+}
+
+template <typename T>
+static T* addContextBlock(
+    detail::ServerContext& context, std::vector<detail::NodeContextBlock<T>>& blocks, size_t size
+) {
+    auto block = std::make_unique<T[]>(size);
+    const std::lock_guard lock(context.mutex);
+    blocks.push_back({std::move(block), size});
+    return blocks.back().data.get();
+}
+
+void Server::setVariableNodeValueBackends(Span<const NodeId> ids, ValueBackendDataSource backend) {
+    for (const auto& id : ids) {
+        checkNodeContextReplaceable(*this, id);  // before the block is allocated
+    }
+    auto& context = detail::getContext(*this);
+    auto* shared = addContextBlock(context, context.nodeContextBlocks, 1);
+    shared->setDataSource(std::move(backend));
+    setDataSources(*this, ids, [shared](size_t) { return shared; });
+}
+
+void Server::setVariableNodeValueBackends(
+    Span<const NodeId> ids, const std::function<ValueBackendDataSource(const NodeId& id)>& factory
+) {
+    for (const auto& id : ids) {
+        checkNodeContextReplaceable(*this, id);  // before the block is allocated
+    }
+    auto& context = detail::getContext(*this);
+    auto* block = addContextBlock(context, context.nodeContextBlocks, ids.size());
+    setDataSources(*this, ids, [&](size_t i) {
+        block[i].setDataSource(factory(ids[i]));  // NOLINT
+        return &block[i];  // NOLINT
+    });
+}
+
+void Server::setVariableNodeDataSource(
+    const NodeId& id, const UA_DataSource& dataSource, void* context
+) {
+    checkNodeContextReplaceable(*this, id);
+    throwIfBad(UA_Server_setNodeContext(handle(), id, context));
+    throwIfBad(UA_Server_setVariableNode_dataSource(handle(), id, dataSource));
+    detail::getContext(*this).nodeContexts.erase(id);  // replaced by the backend object
+}
+
+void Server::setVariableNodeDataSources(
+    Span<const NodeId> ids,
+    Span<const uint64_t> keys,
+    const UA_DataSource& dataSource,
+    void* backend
+) {
+    if (ids.size() != keys.size()) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+    }
+    for (const auto& id : ids) {
+        checkNodeContextReplaceable(*this, id);
+    }
+    auto& context = detail::getContext(*this);
+    auto* block = addContextBlock(context, context.keyedNodeContextBlocks, ids.size());
+    for (size_t i = 0; i < ids.size(); ++i) {
+        block[i] = {backend, keys[i]};  // NOLINT
+        throwIfBad(UA_Server_setNodeContext(handle(), ids[i], &block[i]));  // NOLINT
+        throwIfBad(UA_Server_setVariableNode_dataSource(handle(), ids[i], dataSource));
+        context.nodeContexts.erase(ids[i]);  // replaced by the keyed context
+    }
+}
+
 #ifdef UA_ENABLE_SUBSCRIPTIONS
 Subscription<Server> Server::createSubscription() noexcept {
     return {*this, 0U};
@@ -373,6 +834,18 @@ Event Server::createEvent(const NodeId& eventType) {
 }
 #endif
 
+void Server::setBrowseCacheEnabled(bool enabled, size_t capacity) {
+    detail::getContext(*this).browseCache.setEnabled(enabled, capacity);
+}
+
+void Server::invalidateBrowseCache() {
+    detail::getContext(*this).browseCache.invalidate();
+}
+
+void Server::setMaxBrowseContinuationPoints(size_t maxPerSession) {
+    detail::getContext(*this).browseContinuations.setMaxPerSession(maxPerSession);
+}
+
 uint16_t Server::runIterate() {
     return connection_->runIterate();
 }
@@ -435,6 +908,10 @@ ServerContext& getContext(Server& server) noexcept {
     return server.connection_->getContext();
 }
 
+CustomAccessControl& getCustomAccessControl(Server& server) noexcept {
+    return server.connection_->getCustomAccessControl();
+}
+
 }  // namespace detail
 
 }  // namespace opcua
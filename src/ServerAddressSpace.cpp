@@ -0,0 +1,404 @@
+#include <algorithm>  // min
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <functional>  // less
+#include <iterator>  // istreambuf_iterator
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define UAPP_HAS_MMAP
+#endif
+
+#include "open62541pp/Config.h"
+#include "open62541pp/Encoding.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/detail/ServerContext.h"
+#include "open62541pp/detail/helper.h"  // allocate
+#include "open62541pp/services/Attribute_highlevel.h"
+#include "open62541pp/services/View.h"
+
+#include "NodeInsertion.h"
+#include "open62541_impl.h"
+
+namespace opcua {
+
+#if UAPP_OPEN62541_VER_GE(1, 3)
+
+// file layout (binary encoded):
+// header: magic (UInt32) | version (UInt32) | node count (UInt64) | namespace count (UInt32) |
+//         namespace URIs (String)...
+// record: node class (NodeClass) | node id (NodeId) | browse name (QualifiedName) |
+//         attributes (XAttributes of the node class) | reference count (UInt32) |
+//         references (type (NodeId) | forward (Boolean) | target (NodeId))... |
+//         keyed (Boolean) | key (UInt64)
+static constexpr uint32_t snapshotMagic = 0x53415041;  // "APAS"
+static constexpr uint32_t snapshotVersion = 1;
+static constexpr size_t flushSize = 1024 * 1024;
+
+/* -------------------------------------------- Save -------------------------------------------- */
+
+/// Collect all nodes outside of namespace zero in the hierarchy below the root folder.
+static std::vector<NodeId> collectNodes(Server& server) {
+    std::vector<NodeId> result;
+    std::unordered_set<NodeId> visited{NodeId(ObjectId::RootFolder)};
+    std::deque<NodeId> queue{NodeId(ObjectId::RootFolder)};
+    while (!queue.empty()) {
+        const auto refs = services::browseAll(
+            server,
+            BrowseDescription(
+                queue.front(),
+                BrowseDirection::Forward,
+                ReferenceTypeId::HierarchicalReferences,
+                true,
+                NodeClass::Unspecified,
+                BrowseResultMask::None
+            )
+        );
+        queue.pop_front();
+        for (const auto& ref : refs) {
+            const auto& target = ref.getNodeId();
+            if (!target.isLocal() || !visited.insert(target.getNodeId()).second) {
+                continue;
+            }
+            if (target.getNodeId().getNamespaceIndex() != 0) {
+                result.push_back(target.getNodeId());
+            }
+            queue.push_back(target.getNodeId());
+        }
+    }
+    return result;
+}
+
+static const detail::KeyedNodeContext* findKeyedContext(Server& server, const NodeId& id) {
+    void* nodeContext = nullptr;
+    if (UA_Server_getNodeContext(server.handle(), id, &nodeContext) != UA_STATUSCODE_GOOD ||
+        nodeContext == nullptr) {
+        return nullptr;
+    }
+    auto& context = detail::getContext(server);
+    const std::lock_guard lock(context.mutex);
+    const std::less<const void*> less;
+    for (const auto& block : context.keyedNodeContextBlocks) {
+        const auto* begin = block.data.get();
+        const auto* end = begin + block.size;  // NOLINT
+        if (!less(nodeContext, begin) && less(nodeContext, end)) {
+            return static_cast<const detail::KeyedNodeContext*>(nodeContext);
+        }
+    }
+    return nullptr;
+}
+
+static void appendRecord(
+    Server& server, const NodeId& id, const std::unordered_set<NodeId>& saved, BatchEncoder& out
+) {
+    const QualifiedName browseName = services::readBrowseName(server, id);
+    const NodeClass nodeClass = services::readNodeClass(server, id);
+    const auto* keyed = findKeyedContext(server, id);
+    const auto attributes = detail::readNodeAttributes(server, id, nodeClass, keyed == nullptr);
+
+    out.append(nodeClass, UA_TYPES[UA_TYPES_NODECLASS]);
+    out.append(id);
+    out.append(browseName);
+    out.append(
+        *static_cast<const uint8_t*>(attributes.getDecodedData()),
+        *attributes.getDecodedDataType()
+    );
+
+    // all inverse references (they identify the parent) and forward references to nodes outside
+    // of the snapshot, forward references between saved nodes are restored by the inverse side
+    const auto refs = services::browseAll(
+        server,
+        BrowseDescription(
+            id,
+            BrowseDirection::Both,
+            ReferenceTypeId::References,
+            true,
+            NodeClass::Unspecified,
+            BrowseResultMask::ReferenceTypeId | BrowseResultMask::IsForward
+        )
+    );
+    std::vector<const ReferenceDescription*> stored;
+    stored.reserve(refs.size());
+    for (const auto& ref : refs) {
+        const auto& target = ref.getNodeId();
+        if (target.isLocal() && (!ref.getIsForward() || saved.count(target.getNodeId()) == 0)) {
+            stored.push_back(&ref);
+        }
+    }
+    out.append(static_cast<uint32_t>(stored.size()), UA_TYPES[UA_TYPES_UINT32]);
+    for (const auto* ref : stored) {
+        out.append(ref->getReferenceTypeId());
+        out.append(ref->getIsForward(), UA_TYPES[UA_TYPES_BOOLEAN]);
+        out.append(ref->getNodeId().getNodeId());
+    }
+
+    out.append(keyed != nullptr, UA_TYPES[UA_TYPES_BOOLEAN]);
+    out.append(keyed != nullptr ? keyed->key : uint64_t{0}, UA_TYPES[UA_TYPES_UINT64]);
+}
+
+static void flush(std::ofstream& file, BatchEncoder& encoder) {
+    const auto data = encoder.data();
+    file.write(
+        reinterpret_cast<const char*>(data.data()),  // NOLINT
+        static_cast<std::streamsize>(data.size())
+    );
+    if (!file) {
+        throw BadStatus(UA_STATUSCODE_BADRESOURCEUNAVAILABLE);
+    }
+    encoder.clear();
+}
+
+/* -------------------------------------------- Load -------------------------------------------- */
+
+/// Read-only view of a file, memory-mapped if supported.
+class FileView {
+public:
+    explicit FileView(const fs::path& filepath) {
+#ifdef UAPP_HAS_MMAP
+        const int fd = ::open(filepath.c_str(), O_RDONLY);  // NOLINT
+        if (fd < 0) {
+            throw BadStatus(UA_STATUSCODE_BADRESOURCEUNAVAILABLE);
+        }
+        struct stat st {};
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            throw BadStatus(UA_STATUSCODE_BADRESOURCEUNAVAILABLE);
+        }
+        const auto size = static_cast<size_t>(st.st_size);
+        if (size > 0) {
+            void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping == MAP_FAILED) {  // NOLINT
+                ::close(fd);
+                throw BadStatus(UA_STATUSCODE_BADRESOURCEUNAVAILABLE);
+            }
+            ::madvise(mapping, size, MADV_SEQUENTIAL);
+            mapping_ = mapping;
+            data_ = {static_cast<const uint8_t*>(mapping), size};
+        }
+        ::close(fd);  // the mapping keeps the file open
+#else
+        std::ifstream file(filepath, std::ios::binary);
+        if (!file) {
+            throw BadStatus(UA_STATUSCODE_BADRESOURCEUNAVAILABLE);
+        }
+        buffer_.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        data_ = {reinterpret_cast<const uint8_t*>(buffer_.data()), buffer_.size()};  // NOLINT
+#endif
+    }
+
+    ~FileView() {
+#ifdef UAPP_HAS_MMAP
+        if (mapping_ != nullptr) {
+            ::munmap(mapping_, data_.size());
+        }
+#endif
+    }
+
+    FileView(const FileView&) = delete;
+    FileView(FileView&&) = delete;
+    FileView& operator=(const FileView&) = delete;
+    FileView& operator=(FileView&&) = delete;
+
+    Span<const uint8_t> data() const noexcept {
+        return data_;
+    }
+
+private:
+    Span<const uint8_t> data_;
+#ifdef UAPP_HAS_MMAP
+    void* mapping_{nullptr};
+#else
+    std::vector<char> buffer_;
+#endif
+};
+
+class SnapshotReader {
+public:
+    explicit SnapshotReader(Span<const uint8_t> data)
+        : data_(data) {}
+
+    template <typename T>
+    void read(T& dst, const UA_DataType& type) {
+        offset_ += detail::decodeBinary(data_.subview(offset_), &dst, type);
+    }
+
+    template <typename T>
+    T read(int typeIndex) {
+        T result{};
+        read(result, UA_TYPES[typeIndex]);  // NOLINT
+        return result;
+    }
+
+    template <typename T>
+    T read() {
+        T result;
+        read(*result.handle(), getDataType<T>());
+        return result;
+    }
+
+private:
+    Span<const uint8_t> data_;
+    size_t offset_{0};
+};
+
+class NamespaceMapping {
+public:
+    NamespaceMapping(Server& server, const std::vector<std::string>& uris) {
+        indices_.reserve(uris.size());
+        for (size_t i = 0; i < uris.size(); ++i) {
+            // namespace zero and the server's application namespace are kept
+            indices_.push_back(
+                i < 2 ? static_cast<uint16_t>(i) : server.registerNamespace(uris[i])
+            );
+        }
+    }
+
+    void apply(UA_NodeId& id) const {
+        id.namespaceIndex = map(id.namespaceIndex);
+    }
+
+    void apply(UA_QualifiedName& name) const {
+        name.namespaceIndex = map(name.namespaceIndex);
+    }
+
+private:
+    uint16_t map(uint16_t index) const {
+        if (index >= indices_.size()) {
+            throw BadStatus(UA_STATUSCODE_BADDECODINGERROR);
+        }
+        return indices_[index];
+    }
+
+    std::vector<uint16_t> indices_;
+};
+
+static UA_NodeId* getDataTypeMember(NodeClass nodeClass, void* attributes) noexcept {
+    if (nodeClass == NodeClass::Variable) {
+        return &static_cast<UA_VariableAttributes*>(attributes)->dataType;
+    }
+    if (nodeClass == NodeClass::VariableType) {
+        return &static_cast<UA_VariableTypeAttributes*>(attributes)->dataType;
+    }
+    return nullptr;
+}
+
+static void readRecord(
+    SnapshotReader& in,
+    const NamespaceMapping& namespaces,
+    detail::NodeRecord& record,
+    AddressSpaceLoadResult& result
+) {
+    record.nodeClass = in.read<NodeClass>(UA_TYPES_NODECLASS);
+    record.id = in.read<NodeId>();
+    namespaces.apply(*record.id.handle());
+    record.browseName = in.read<QualifiedName>();
+    namespaces.apply(*record.browseName.handle());
+
+    const auto* attributesType = detail::getAttributesType(record.nodeClass);
+    if (attributesType == nullptr) {
+        throw BadStatus(UA_STATUSCODE_BADDECODINGERROR);
+    }
+    auto* attributes = detail::allocate<void>(*attributesType);
+    auto& eo = *record.attributes.handle();  // owns the attributes from here on
+    eo.encoding = UA_EXTENSIONOBJECT_DECODED;
+    eo.content.decoded.type = attributesType;
+    eo.content.decoded.data = attributes;
+    in.read(*static_cast<uint8_t*>(attributes), *attributesType);
+    if (auto* dataType = getDataTypeMember(record.nodeClass, attributes)) {
+        namespaces.apply(*dataType);
+    }
+
+    const auto refCount = in.read<uint32_t>(UA_TYPES_UINT32);
+    record.references.resize(refCount);
+    for (auto& ref : record.references) {
+        ref.type = in.read<NodeId>();
+        namespaces.apply(*ref.type.handle());
+        ref.forward = in.read<bool>(UA_TYPES_BOOLEAN);
+        ref.target = in.read<NodeId>();
+        namespaces.apply(*ref.target.handle());
+    }
+
+    const auto keyed = in.read<bool>(UA_TYPES_BOOLEAN);
+    const auto key = in.read<uint64_t>(UA_TYPES_UINT64);
+    if (keyed) {
+        result.keyedIds.push_back(record.id);
+        result.keys.push_back(key);
+    }
+}
+
+#endif
+
+void Server::saveAddressSpace([[maybe_unused]] const fs::path& filepath) {
+#if UAPP_OPEN62541_VER_GE(1, 3)
+    const auto ids = collectNodes(*this);
+    const std::unordered_set<NodeId> saved(ids.begin(), ids.end());
+
+    std::ofstream file(filepath, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        throw BadStatus(UA_STATUSCODE_BADRESOURCEUNAVAILABLE);
+    }
+    BatchEncoder encoder(flushSize);
+    encoder.append(snapshotMagic, UA_TYPES[UA_TYPES_UINT32]);
+    encoder.append(snapshotVersion, UA_TYPES[UA_TYPES_UINT32]);
+    encoder.append(static_cast<uint64_t>(ids.size()), UA_TYPES[UA_TYPES_UINT64]);
+    const auto namespaces = getNamespaceArray();
+    encoder.append(static_cast<uint32_t>(namespaces.size()), UA_TYPES[UA_TYPES_UINT32]);
+    for (const auto& uri : namespaces) {
+        encoder.append(String(uri));
+    }
+    for (const auto& id : ids) {
+        appendRecord(*this, id, saved, encoder);
+        if (encoder.size() >= flushSize) {
+            flush(file, encoder);
+        }
+    }
+    flush(file, encoder);
+#else
+    throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+#endif
+}
+
+AddressSpaceLoadResult Server::loadAddressSpace([[maybe_unused]] const fs::path& filepath) {
+#if UAPP_OPEN62541_VER_GE(1, 3)
+    const FileView file(filepath);
+    SnapshotReader in(file.data());
+    if (file.data().size() < 2 * sizeof(uint32_t) ||
+        in.read<uint32_t>(UA_TYPES_UINT32) != snapshotMagic ||
+        in.read<uint32_t>(UA_TYPES_UINT32) != snapshotVersion) {
+        throw BadStatus(UA_STATUSCODE_BADDECODINGERROR);
+    }
+    const auto nodeCount = in.read<uint64_t>(UA_TYPES_UINT64);
+    std::vector<std::string> uris(in.read<uint32_t>(UA_TYPES_UINT32));
+    for (auto& uri : uris) {
+        uri = std::string(in.read<String>().get());
+    }
+    const NamespaceMapping namespaces(*this, uris);
+
+    AddressSpaceLoadResult result;
+    std::vector<detail::NodeRecord> records;
+    records.reserve(static_cast<size_t>(std::min<uint64_t>(nodeCount, file.data().size())));
+    for (uint64_t i = 0; i < nodeCount; ++i) {
+        readRecord(in, namespaces, records.emplace_back(), result);
+    }
+
+    auto inserted = detail::insertNodes(*this, records);
+    result.nodes = inserted.nodes;
+    result.references = inserted.references;
+    result.errors = std::move(inserted.errors);
+    return result;
+#else
+    throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+#endif
+}
+
+}  // namespace opcua
@@ -0,0 +1,435 @@
+#include "open62541pp/ServerMetrics.h"
+
+#include <algorithm>  // lower_bound, max
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>  // move
+#include <vector>
+
+#include "open62541pp/Config.h"
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/detail/MetricsRecorder.h"
+#include "open62541pp/detail/ServerContext.h"
+#include "open62541pp/detail/helper.h"  // toString
+#include "open62541pp/types/Variant.h"
+
+#include "CustomAccessControl.h"  // findServer
+#include "Prometheus.h"
+#include "open62541_impl.h"
+
+namespace opcua {
+
+/* ----------------------------------------- Recording ------------------------------------------ */
+
+namespace detail {
+
+static constexpr auto boundsNanoseconds = [] {
+    std::array<uint64_t, LatencyHistogram::bounds.size()> result{};
+    for (size_t i = 0; i < result.size(); ++i) {
+        result[i] = static_cast<uint64_t>(LatencyHistogram::bounds[i] * 1e9 + 0.5);
+    }
+    return result;
+}();
+
+// number of active recorders (metrics or tracing) of all servers, skip the lookup if zero
+static std::atomic<size_t> enabledRecorders{0};
+
+void AtomicLatencyHistogram::record(std::chrono::nanoseconds duration) noexcept {
+    const auto nanoseconds = static_cast<uint64_t>(std::max<int64_t>(duration.count(), 0));
+    const auto it = std::lower_bound(
+        boundsNanoseconds.begin(), boundsNanoseconds.end(), nanoseconds
+    );
+    buckets_[it - boundsNanoseconds.begin()].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sumNanoseconds_.fetch_add(nanoseconds, std::memory_order_relaxed);
+}
+
+LatencyHistogram AtomicLatencyHistogram::snapshot() const noexcept {
+    LatencyHistogram result;
+    for (size_t i = 0; i < buckets_.size(); ++i) {
+        result.buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+    }
+    result.count = count_.load(std::memory_order_relaxed);
+    result.sum = static_cast<double>(sumNanoseconds_.load(std::memory_order_relaxed)) * 1e-9;
+    return result;
+}
+
+void AtomicLatencyHistogram::reset() noexcept {
+    for (auto& bucket : buckets_) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    count_.store(0, std::memory_order_relaxed);
+    sumNanoseconds_.store(0, std::memory_order_relaxed);
+}
+
+MetricsRecorder::~MetricsRecorder() {
+    const std::lock_guard lock(mutex_);
+    const bool wasActive = isActive();
+    enabled_.store(false, std::memory_order_relaxed);
+    tracing_.store(false, std::memory_order_relaxed);
+    updateActive(wasActive);
+}
+
+void MetricsRecorder::updateActive(bool wasActive) noexcept {
+    const bool active = isActive();
+    if (active && !wasActive) {
+        enabledRecorders.fetch_add(1, std::memory_order_relaxed);
+    } else if (!active && wasActive) {
+        enabledRecorders.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+void MetricsRecorder::setEnabled(bool enabled) noexcept {
+    const std::lock_guard lock(mutex_);
+    const bool wasActive = isActive();
+    enabled_.store(enabled, std::memory_order_relaxed);
+    updateActive(wasActive);
+}
+
+void MetricsRecorder::setTraceCallback(ServerTraceCallback callback, ExceptionCatcher& catcher) {
+    std::shared_ptr<const ServerTraceCallback> ptr;
+    if (callback) {
+        ptr = std::make_shared<const ServerTraceCallback>(std::move(callback));
+    }
+    const std::lock_guard lock(mutex_);
+    const bool wasActive = isActive();
+    traceCallback_ = std::move(ptr);
+    catcher_ = &catcher;
+    tracing_.store(traceCallback_ != nullptr, std::memory_order_relaxed);
+    updateActive(wasActive);
+}
+
+void MetricsRecorder::recordService(
+    MetricsService service, Clock::time_point start, Clock::time_point end, bool error
+) noexcept {
+    if (isEnabled()) {
+        auto& metrics = services_[static_cast<size_t>(service)];
+        metrics.requests.fetch_add(1, std::memory_order_relaxed);
+        if (error) {
+            metrics.errors.fetch_add(1, std::memory_order_relaxed);
+        }
+        metrics.latency.record(end - start);
+    }
+    if (isTracing()) {
+        trace({ServerTracepoint::Service, service, start, end - start});
+    }
+}
+
+void MetricsRecorder::recordCallback(
+    MetricsCallback callback, Clock::time_point start, Clock::time_point end
+) noexcept {
+    static constexpr std::array<ServerTracepoint, 3> tracepoints{
+        ServerTracepoint::DataSourceRead,
+        ServerTracepoint::DataSourceWrite,
+        ServerTracepoint::Method,
+    };
+    if (isEnabled()) {
+        callbacks_[static_cast<size_t>(callback)].record(end - start);
+    }
+    if (isTracing()) {
+        trace({tracepoints[static_cast<size_t>(callback)], {}, start, end - start});
+    }
+}
+
+void MetricsRecorder::trace(const ServerTraceEvent& event) noexcept {
+    std::shared_ptr<const ServerTraceCallback> callback;
+    ExceptionCatcher* catcher = nullptr;
+    {
+        const std::lock_guard lock(mutex_);
+        callback = traceCallback_;
+        catcher = catcher_;
+    }
+    if (callback != nullptr) {
+        catcher->invoke(*callback, event);
+    }
+}
+
+void MetricsRecorder::snapshot(ServerMetrics& metrics) const noexcept {
+    for (size_t i = 0; i < services_.size(); ++i) {
+        metrics.services[i].requests = services_[i].requests.load(std::memory_order_relaxed);
+        metrics.services[i].errors = services_[i].errors.load(std::memory_order_relaxed);
+        metrics.services[i].latency = services_[i].latency.snapshot();
+    }
+    for (size_t i = 0; i < callbacks_.size(); ++i) {
+        metrics.callbacks[i] = callbacks_[i].snapshot();
+    }
+}
+
+void MetricsRecorder::reset() noexcept {
+    for (auto& service : services_) {
+        service.requests.store(0, std::memory_order_relaxed);
+        service.errors.store(0, std::memory_order_relaxed);
+        service.latency.reset();
+    }
+    for (auto& callback : callbacks_) {
+        callback.reset();
+    }
+}
+
+MetricsRecorder* getMetricsRecorder(Server& server) noexcept {
+    auto& recorder = getContext(server).metrics;
+    return recorder.isActive() ? &recorder : nullptr;
+}
+
+MetricsRecorder* getMetricsRecorder(UA_Server* server) noexcept {
+    if (enabledRecorders.load(std::memory_order_relaxed) == 0) {
+        return nullptr;
+    }
+    auto* wrapper = findServer(server);
+    return wrapper != nullptr ? getMetricsRecorder(*wrapper) : nullptr;
+}
+
+}  // namespace detail
+
+/* ------------------------------------------ Sessions ------------------------------------------ */
+
+#ifdef UA_ENABLE_DIAGNOSTICS
+static void readSessionMetrics(Server& server, ServerMetrics& metrics) {
+    using Counter = UA_ServiceCounterDataType UA_SessionDiagnosticsDataType::*;
+    static constexpr std::array<Counter, 5> serviceCounters{
+        &UA_SessionDiagnosticsDataType::readCount,
+        &UA_SessionDiagnosticsDataType::writeCount,
+        &UA_SessionDiagnosticsDataType::browseCount,
+        &UA_SessionDiagnosticsDataType::callCount,
+        &UA_SessionDiagnosticsDataType::publishCount,
+    };
+
+    Variant value;
+    const NodeId id(
+        VariableId::Server_ServerDiagnostics_SessionsDiagnosticsSummary_SessionDiagnosticsArray
+    );
+    const auto status = UA_Server_readValue(server.handle(), id, value.handle());
+    if (UA_StatusCode_isBad(status) ||
+        value->type != &UA_TYPES[UA_TYPES_SESSIONDIAGNOSTICSDATATYPE]) {
+        return;
+    }
+    const auto* sessions = static_cast<const UA_SessionDiagnosticsDataType*>(value->data);
+    for (size_t i = 0; i < value->arrayLength; ++i) {
+        const auto& session = sessions[i];  // NOLINT
+        for (size_t j = 0; j < serviceCounters.size(); ++j) {
+            metrics.services[j].remoteRequests += (session.*serviceCounters[j]).totalCount;
+            metrics.services[j].remoteErrors += (session.*serviceCounters[j]).errorCount;
+        }
+        SessionMetrics& item = metrics.sessions.emplace_back();
+        item.sessionId = NodeId(session.sessionId);
+        item.sessionName = detail::toString(session.sessionName);
+        item.requests = session.totalRequestCount.totalCount;
+        item.errors = session.totalRequestCount.errorCount;
+        item.subscriptions = session.currentSubscriptionsCount;
+        item.monitoredItems = session.currentMonitoredItemsCount;
+        item.publishRequestsQueued = session.currentPublishRequestsInQueue;
+    }
+}
+#endif
+
+/* ----------------------------------------- Prometheus ----------------------------------------- */
+
+static constexpr std::array<const char*, 5> serviceNames{
+    "read", "write", "browse", "call", "publish"
+};
+
+static constexpr std::array<const char*, 3> callbackNames{
+    "datasource_read", "datasource_write", "method"
+};
+
+std::string toPrometheus(const ServerMetrics& metrics) {
+    std::string out;
+    const auto serviceLabels = [](size_t i, const char* origin = nullptr) {
+        std::string labels = std::string("service=\"") + serviceNames[i] + '"';
+        if (origin != nullptr) {
+            labels.append(",origin=\"").append(origin).append("\"");
+        }
+        return labels;
+    };
+
+    detail::appendPrometheusHeader(
+        out, "opcua_server_service_requests_total", "counter", "Local service requests."
+    );
+    for (size_t i = 0; i < metrics.services.size(); ++i) {
+        const auto& service = metrics.services[i];
+        const auto* name = "opcua_server_service_requests_total";
+        detail::appendPrometheusSample(
+            out, name, serviceLabels(i, "local"), static_cast<double>(service.requests)
+        );
+    }
+
+    detail::appendPrometheusHeader(
+        out, "opcua_server_service_errors_total", "counter", "Failed local service requests."
+    );
+    for (size_t i = 0; i < metrics.services.size(); ++i) {
+        const auto& service = metrics.services[i];
+        const auto* name = "opcua_server_service_errors_total";
+        detail::appendPrometheusSample(
+            out, name, serviceLabels(i, "local"), static_cast<double>(service.errors)
+        );
+    }
+
+    // remote counts only cover the open sessions and decrease when sessions are closed
+    detail::appendPrometheusHeader(
+        out,
+        "opcua_server_service_session_requests",
+        "gauge",
+        "Service requests of the open client sessions."
+    );
+    for (size_t i = 0; i < metrics.services.size(); ++i) {
+        detail::appendPrometheusSample(
+            out,
+            "opcua_server_service_session_requests",
+            serviceLabels(i),
+            static_cast<double>(metrics.services[i].remoteRequests)
+        );
+    }
+
+    detail::appendPrometheusHeader(
+        out,
+        "opcua_server_service_session_errors",
+        "gauge",
+        "Failed service requests of the open client sessions."
+    );
+    for (size_t i = 0; i < metrics.services.size(); ++i) {
+        detail::appendPrometheusSample(
+            out,
+            "opcua_server_service_session_errors",
+            serviceLabels(i),
+            static_cast<double>(metrics.services[i].remoteErrors)
+        );
+    }
+
+    detail::appendPrometheusHeader(
+        out,
+        "opcua_server_service_duration_seconds",
+        "histogram",
+        "Latency of local service requests."
+    );
+    for (size_t i = 0; i < metrics.services.size(); ++i) {
+        detail::appendPrometheusHistogram(
+            out,
+            "opcua_server_service_duration_seconds",
+            serviceLabels(i),
+            metrics.services[i].latency
+        );
+    }
+
+    detail::appendPrometheusHeader(
+        out, "opcua_server_callback_duration_seconds", "histogram", "Duration of user callbacks."
+    );
+    for (size_t i = 0; i < metrics.callbacks.size(); ++i) {
+        detail::appendPrometheusHistogram(
+            out,
+            "opcua_server_callback_duration_seconds",
+            std::string("callback=\"") + callbackNames[i] + '"',
+            metrics.callbacks[i]
+        );
+    }
+
+    detail::appendPrometheusHeader(
+        out,
+        "opcua_server_admission_rejected_total",
+        "counter",
+        "Operations rejected by the admission control."
+    );
+    detail::appendPrometheusSample(
+        out,
+        "opcua_server_admission_rejected_total",
+        "limit=\"operations_per_session\"",
+        static_cast<double>(metrics.admission.rejectedOperations)
+    );
+    detail::appendPrometheusSample(
+        out,
+        "opcua_server_admission_rejected_total",
+        "limit=\"reads_per_iteration\"",
+        static_cast<double>(metrics.admission.rejectedReads)
+    );
+
+    if (metrics.sessions.empty()) {
+        return out;
+    }
+    std::vector<std::string> sessionLabels;
+    sessionLabels.reserve(metrics.sessions.size());
+    for (const auto& session : metrics.sessions) {
+        std::string labels = "session=";
+        detail::appendPrometheusLabelValue(labels, session.sessionId.toString());
+        labels += ",name=";
+        detail::appendPrometheusLabelValue(labels, session.sessionName);
+        sessionLabels.push_back(std::move(labels));
+    }
+    const auto appendSessions = [&](std::string_view name,
+                                    std::string_view type,
+                                    std::string_view help,
+                                    auto&& getValue) {
+        detail::appendPrometheusHeader(out, name, type, help);
+        for (size_t i = 0; i < metrics.sessions.size(); ++i) {
+            detail::appendPrometheusSample(
+                out, name, sessionLabels[i], static_cast<double>(getValue(metrics.sessions[i]))
+            );
+        }
+    };
+    appendSessions(
+        "opcua_server_session_requests_total",
+        "counter",
+        "Requests of the session.",
+        [](const SessionMetrics& s) { return s.requests; }
+    );
+    appendSessions(
+        "opcua_server_session_errors_total",
+        "counter",
+        "Failed requests of the session.",
+        [](const SessionMetrics& s) { return s.errors; }
+    );
+    appendSessions(
+        "opcua_server_session_subscriptions",
+        "gauge",
+        "Subscriptions of the session.",
+        [](const SessionMetrics& s) { return s.subscriptions; }
+    );
+    appendSessions(
+        "opcua_server_session_monitored_items",
+        "gauge",
+        "Monitored items of the session.",
+        [](const SessionMetrics& s) { return s.monitoredItems; }
+    );
+    appendSessions(
+        "opcua_server_session_publish_requests_queued",
+        "gauge",
+        "Publish requests queued for notifications.",
+        [](const SessionMetrics& s) { return s.publishRequestsQueued; }
+    );
+    return out;
+}
+
+/* ------------------------------------------- Server ------------------------------------------- */
+
+void Server::setMetricsEnabled(bool enabled) {
+    detail::getContext(*this).metrics.setEnabled(enabled);
+}
+
+bool Server::isMetricsEnabled() {
+    return detail::getContext(*this).metrics.isEnabled();
+}
+
+ServerMetrics Server::getMetrics() {
+    ServerMetrics metrics;
+    detail::getContext(*this).metrics.snapshot(metrics);
+    detail::getContext(*this).admission.snapshot(metrics.admission);
+#ifdef UA_ENABLE_DIAGNOSTICS
+    readSessionMetrics(*this, metrics);
+#endif
+    return metrics;
+}
+
+void Server::resetMetrics() {
+    detail::getContext(*this).metrics.reset();
+    detail::getContext(*this).admission.reset();
+}
+
+void Server::setTraceCallback(ServerTraceCallback callback) {
+    auto& context = detail::getContext(*this);
+    context.metrics.setTraceCallback(std::move(callback), context.exceptionCatcher);
+}
+
+}  // namespace opcua
@@ -1,5 +1,6 @@
 #include "open62541pp/Session.h"
 
+#include <atomic>
 #include <string>
 #include <utility>
 
@@ -11,6 +12,7 @@
 #include "open62541pp/types/NodeId.h"
 #include "open62541pp/types/Variant.h"
 
+#include "CustomAccessControl.h"
 #include "open62541_impl.h"
 
 namespace opcua {
@@ -31,6 +33,40 @@ const NodeId& Session::getSessionId() const noexcept {
     return sessionId_;
 }
 
+size_t detail::allocateSessionSlot() noexcept {
+    static std::atomic<size_t> count{0};
+    return count.fetch_add(1, std::memory_order_relaxed);
+}
+
+static SessionEntry* findEntry(const Session& session) noexcept {
+    // the session of the current callback is resolved without lookup
+    auto* entry = detail::SessionScope::getCurrent();
+    if (entry != nullptr && &entry->session == &session) {
+        return entry;
+    }
+    auto& server = const_cast<Server&>(session.getConnection());  // NOLINT, lookup only
+    return detail::getCustomAccessControl(server).findSession(session.getSessionId());
+}
+
+void Session::setSlot(size_t index, std::shared_ptr<void> context) {
+    auto* entry = findEntry(*this);
+    if (entry == nullptr) {
+        throw BadStatus(UA_STATUSCODE_BADSESSIONIDINVALID);
+    }
+    if (index >= entry->slots.size()) {
+        entry->slots.resize(index + 1);
+    }
+    entry->slots[index] = std::move(context);
+}
+
+void* Session::getSlot(size_t index) const noexcept {
+    const auto* entry = findEntry(*this);
+    if (entry == nullptr || index >= entry->slots.size()) {
+        return nullptr;
+    }
+    return entry->slots[index].get();
+}
+
 // ignore namespace index for v1.3, v1.4 uses qualified keys
 [[maybe_unused]] inline static std::string unqualifiedKey(const QualifiedName& key) {
     return std::string{key.getName()};
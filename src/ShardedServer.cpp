@@ -0,0 +1,213 @@
+#include "open62541pp/ShardedServer.h"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Node.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/ValueBackend.h"
+#include "open62541pp/services/Attribute_highlevel.h"
+#include "open62541pp/services/View.h"
+
+#include "open62541_impl.h"
+
+namespace opcua {
+
+/// Server of a shard, only accessed by its worker thread.
+struct ShardedServer::Shard {
+    Shard()
+        : thread([this] { work(); }) {}
+
+    ~Shard() {
+        {
+            const std::lock_guard lock(mutex);
+            stop = true;
+        }
+        cv.notify_one();
+        thread.join();
+    }
+
+    Shard(const Shard&) = delete;
+    Shard(Shard&&) noexcept = delete;
+    Shard& operator=(const Shard&) = delete;
+    Shard& operator=(Shard&&) noexcept = delete;
+
+    void work() {
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock lock(mutex);
+                cv.wait(lock, [&] { return stop || !tasks.empty(); });
+                if (tasks.empty()) {
+                    return;  // stopped and drained
+                }
+                task = std::move(tasks.front());
+                tasks.pop_front();
+            }
+            task();
+        }
+    }
+
+    Server server;  // constructed before the thread
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<std::function<void()>> tasks;
+    bool stop{false};
+    std::thread thread;
+};
+
+ShardedServer::ShardedServer(ShardedServerOptions options)
+    : front_(std::make_unique<Server>(options.port)) {
+    if (options.shards == 0) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+    }
+    shards_.reserve(options.shards);
+    for (size_t i = 0; i < options.shards; ++i) {
+        shards_.push_back(std::make_unique<Shard>());
+    }
+}
+
+ShardedServer::~ShardedServer() = default;
+
+size_t ShardedServer::getShardIndex(const NodeId& id) const noexcept {
+    const auto ns = id.getNamespaceIndex();
+    return ns < namespaceShards_.size() ? namespaceShards_[ns] : 0;
+}
+
+uint16_t ShardedServer::registerNamespace(std::string_view uri, size_t shard) {
+    if (shard >= shards_.size()) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+    }
+    const auto ns = front_->registerNamespace(uri);
+    for (size_t i = 0; i < shards_.size(); ++i) {
+        const auto shardNs = execute(i, [&](Server& server) {
+            return server.registerNamespace(uri);
+        });
+        if (shardNs != ns) {
+            throw BadStatus(UA_STATUSCODE_BADINTERNALERROR);  // namespace arrays diverged
+        }
+    }
+    if (namespaceShards_.size() <= ns) {
+        namespaceShards_.resize(ns + 1, 0);
+    }
+    namespaceShards_[ns] = shard;
+    return ns;
+}
+
+Server& ShardedServer::getShard(size_t index) {
+    return shards_.at(index)->server;
+}
+
+void ShardedServer::post(size_t shard, std::function<void()> task) {
+    auto& s = *shards_.at(shard);
+    {
+        const std::lock_guard lock(s.mutex);
+        s.tasks.push_back(std::move(task));
+    }
+    s.cv.notify_one();
+}
+
+template <typename Item, typename Result, typename Process>
+std::vector<Result> ShardedServer::dispatch(Span<const Item> items, Process&& process) {
+    std::vector<std::vector<size_t>> indices(shards_.size());
+    for (size_t i = 0; i < items.size(); ++i) {
+        indices[getShardIndex(items[i].getNodeId())].push_back(i);
+    }
+
+    std::vector<Result> results(items.size());
+    std::vector<std::future<void>> pending;
+    for (size_t shard = 0; shard < shards_.size(); ++shard) {
+        if (indices[shard].empty()) {
+            continue;
+        }
+        auto task = std::make_shared<std::packaged_task<void()>>([&, shard] {
+            auto& server = getShard(shard);
+            for (const size_t i : indices[shard]) {
+                results[i] = process(server, items[i]);
+            }
+        });
+        pending.push_back(task->get_future());
+        post(shard, [task] { (*task)(); });
+    }
+    // wait for all shards before rethrowing, the tasks reference the local state
+    std::exception_ptr exception;
+    for (auto& future : pending) {
+        try {
+            future.get();
+        } catch (...) {
+            exception = std::current_exception();
+        }
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+    return results;
+}
+
+std::vector<DataValue> ShardedServer::read(
+    Span<const ReadValueId> items, TimestampsToReturn timestamps
+) {
+    return dispatch<ReadValueId, DataValue>(items, [&](Server& server, const ReadValueId& item) {
+        return DataValue(UA_Server_read(
+            server.handle(), item.handle(), static_cast<UA_TimestampsToReturn>(timestamps)
+        ));
+    });
+}
+
+std::vector<StatusCode> ShardedServer::write(Span<const WriteValue> items) {
+    return dispatch<WriteValue, StatusCode>(items, [](Server& server, const WriteValue& item) {
+        return StatusCode(UA_Server_write(server.handle(), item.handle()));
+    });
+}
+
+std::vector<BrowseResult> ShardedServer::browse(
+    Span<const BrowseDescription> items, uint32_t maxReferences
+) {
+    return dispatch<BrowseDescription, BrowseResult>(
+        items,
+        [&](Server& server, const BrowseDescription& item) {
+            return services::browse(server, item, maxReferences);
+        }
+    );
+}
+
+void ShardedServer::expose(const NodeId& parentId, const NodeId& id) {
+    const size_t shard = getShardIndex(id);
+    QualifiedName browseName;
+    VariableAttributes attributes;
+    execute(shard, [&](Server& server) {
+        browseName = services::readBrowseName(server, id);
+        attributes.setDisplayName(services::readDisplayName(server, id));
+        attributes.setDataType(services::readDataType(server, id));
+        attributes.setValueRank(services::readValueRank(server, id));
+        attributes.setAccessLevel(services::readAccessLevel(server, id));
+    });
+    front_->getNode(parentId).addVariable(id, browseName.getName(), attributes);
+
+    ValueBackendDataSource backend;
+    backend.applyReadRange = true;
+    backend.read = [this, shard, id](DataValue& value, const NumericRange&, bool timestamp) {
+        value = execute(shard, [&](Server& server) {
+            const ReadValueId item(id, AttributeId::Value);
+            return DataValue(UA_Server_read(
+                server.handle(),
+                item.handle(),
+                timestamp ? UA_TIMESTAMPSTORETURN_SOURCE : UA_TIMESTAMPSTORETURN_NEITHER
+            ));
+        });
+        return value.hasStatus() ? value.getStatus() : StatusCode(UA_STATUSCODE_GOOD);
+    };
+    backend.write = [this, shard, id](const DataValue& value, const NumericRange& range) {
+        return execute(shard, [&](Server& server) {
+            const WriteValue item(id, AttributeId::Value, range.toString(), value);
+            return StatusCode(UA_Server_write(server.handle(), item.handle()));
+        });
+    };
+    front_->setVariableNodeValueBackend(id, std::move(backend));
+}
+
+}  // namespace opcua
@@ -0,0 +1,72 @@
+#include "open62541pp/SharedSampler.h"
+
+#include <utility>  // move
+
+#include "open62541pp/Server.h"
+#include "open62541pp/open62541.h"
+#include "open62541pp/types/DateTime.h"
+
+namespace opcua {
+
+void SharedSampler::registerNode(Server& server, const NodeId& id, ValueBackendDataSource source) {
+    auto& entry = entries_[id];
+    if (entry == nullptr) {
+        entry = std::make_unique<Entry>();
+    }
+    entry->source = std::move(source);
+    entry->valid = false;
+
+    ValueBackendDataSource backend;
+    backend.read = [this, ptr = entry.get()](DataValue& dv, const NumericRange&, bool timestamp) {
+        return read(*ptr, dv, timestamp);
+    };
+    if (entry->source.write) {
+        backend.write = [ptr = entry.get()](const DataValue& dv, const NumericRange& range) {
+            ptr->valid = false;
+            return ptr->source.write(dv, range);
+        };
+    }
+    backend.applyReadRange = true;  // ranges are extracted from the copy of the shared sample
+    server.setVariableNodeValueBackend(id, std::move(backend));
+}
+
+void SharedSampler::invalidate(const NodeId& id) noexcept {
+    if (const auto it = entries_.find(id); it != entries_.end()) {
+        it->second->valid = false;
+    }
+}
+
+StatusCode SharedSampler::read(Entry& entry, DataValue& value, bool timestamp) {
+    const auto now = Clock::now();
+    if (entry.valid && now - entry.sampledAt < maxAge_) {
+        ++sharedReads_;
+    } else {
+        DataValue sample;
+        ++sourceReads_;
+        const auto status = entry.source.read(sample, {}, true);
+        if (status.isBad()) {
+            entry.valid = false;
+            return status;
+        }
+        if (entry.source.autoSourceTimestamp && !sample.hasSourceTimestamp()) {
+            sample.setSourceTimestamp(DateTime::nowCoarse());
+        }
+        entry.sample = sample;  // deep copy, the data source might return non-owned memory
+        entry.sampledAt = now;
+        entry.valid = true;
+    }
+    // deep copy, the sample is replaced by the next source read while the server might still use it
+    UA_DataValue& native = *value.handle();
+    UA_DataValue_clear(&native);
+    if (const auto status = UA_DataValue_copy(entry.sample.handle(), &native);
+        status != UA_STATUSCODE_GOOD) {
+        return status;
+    }
+    if (!timestamp) {
+        native.hasSourceTimestamp = false;
+        native.hasSourcePicoseconds = false;
+    }
+    return UA_STATUSCODE_GOOD;
+}
+
+}  // namespace opcua
@@ -0,0 +1,83 @@
+#include "open62541pp/StaticValueCache.h"
+
+#include <utility>  // move
+
+#include "open62541pp/Encoding.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/ValueBackend.h"
+#include "open62541pp/open62541.h"
+#include "open62541pp/services/Attribute.h"
+
+namespace opcua {
+
+static void setCachedValue(DataValue& cached, DataValue value) noexcept {
+    cached = std::move(value);
+    cached->hasServerTimestamp = false;
+    cached->hasServerPicoseconds = false;
+}
+
+void StaticValueCache::registerNode(Server& server, const NodeId& id) {
+    auto value = services::readDataValue(server, id);
+    auto& entry = entries_[id];
+    if (entry == nullptr) {
+        entry = std::make_unique<Entry>();
+    }
+    setCachedValue(entry->value, std::move(value));
+    entry->encodedValid = false;
+
+    ValueBackendDataSource backend;
+    backend.read = [ptr = entry.get()](DataValue& dv, const NumericRange&, bool timestamp) {
+        // deep copy, the cached value is replaced by writes and setValue
+        UA_DataValue& native = *dv.handle();
+        UA_DataValue_clear(&native);
+        if (const auto status = UA_DataValue_copy(ptr->value.handle(), &native);
+            status != UA_STATUSCODE_GOOD) {
+            return StatusCode(status);
+        }
+        if (!timestamp) {
+            native.hasSourceTimestamp = false;
+            native.hasSourcePicoseconds = false;
+        }
+        return StatusCode(UA_STATUSCODE_GOOD);
+    };
+    backend.write = [ptr = entry.get()](const DataValue& dv, const NumericRange& range) {
+        if (!range.empty()) {
+            return StatusCode(UA_STATUSCODE_BADWRITENOTSUPPORTED);
+        }
+        setCachedValue(ptr->value, dv);
+        ptr->encodedValid = false;
+        return StatusCode(UA_STATUSCODE_GOOD);
+    };
+    backend.applyReadRange = true;
+    server.setVariableNodeValueBackend(id, std::move(backend));
+}
+
+void StaticValueCache::setValue(const NodeId& id, DataValue value) {
+    auto& entry = getEntry(id);
+    setCachedValue(entry.value, std::move(value));
+    entry.encodedValid = false;
+}
+
+const DataValue& StaticValueCache::getValue(const NodeId& id) const {
+    return getEntry(id).value;
+}
+
+Span<const uint8_t> StaticValueCache::getEncoded(const NodeId& id) {
+    auto& entry = getEntry(id);
+    if (!entry.encodedValid) {
+        entry.encoded = encodeBinary(entry.value.getValue());
+        entry.encodedValid = true;
+    }
+    return {entry.encoded->data, entry.encoded->length};
+}
+
+StaticValueCache::Entry& StaticValueCache::getEntry(const NodeId& id) const {
+    const auto it = entries_.find(id);
+    if (it == entries_.end()) {
+        throw BadStatus(UA_STATUSCODE_BADNODEIDUNKNOWN);
+    }
+    return *it->second;
+}
+
+}  // namespace opcua
@@ -43,18 +43,14 @@ MonitoredItem<T> Subscription<T>::subscribeDataChange(
 
 template <typename T>
 std::vector<MonitoredItem<T>> Subscription<T>::getMonitoredItems() {
-    auto& monitoredItems = opcua::detail::getContext(connection_).monitoredItems;
-    monitoredItems.eraseStale();
-    auto lock = monitoredItems.acquireLock();
-    const auto& map = monitoredItems.underlying();
+    const auto& monitoredItems = opcua::detail::getContext(connection_).monitoredItems;
     std::vector<MonitoredItem<T>> result;
-    result.reserve(map.size());
-    for (const auto& [subMonId, _] : map) {
+    monitoredItems.forEach([&](const auto& subMonId, const auto& /* context */) {
         const auto [subId, monId] = subMonId;
         if (subId == subscriptionId_) {
             result.emplace_back(connection_, subId, monId);
         }
-    }
+    });
     return result;
 }
 
@@ -108,6 +104,15 @@ Subscription<Client>::Subscription(Client& connection, uint32_t subscriptionId)
     : connection_(connection),
       subscriptionId_(subscriptionId) {}
 
+template <>
+SubscriptionStatistics Subscription<Client>::getStatistics() const {
+    const auto* context = detail::getContext(connection_).subscriptions.find(subscriptionId_);
+    if (context == nullptr) {
+        throw BadStatus(UA_STATUSCODE_BADSUBSCRIPTIONIDINVALID);
+    }
+    return context->statistics->snapshot();
+}
+
 template <>
 void Subscription<Client>::setSubscriptionParameters(SubscriptionParameters& parameters) {
     services::modifySubscription(connection_, subscriptionId_, parameters);
@@ -142,6 +147,28 @@ MonitoredItem<Client> Subscription<Client>::subscribeDataChange(
     return {connection_, subscriptionId_, monitoredItemId};
 }
 
+template <>
+std::vector<MonitoredItemResult> Subscription<Client>::subscribeDataChangeMany(
+    Span<const ReadValueId> itemsToMonitor,
+    MonitoringMode monitoringMode,
+    const MonitoringParameters& parameters,
+    DataChangeCallback<Client> onDataChange
+) {
+    return services::createMonitoredItemsDataChange(
+        connection_,
+        subscriptionId_,
+        itemsToMonitor,
+        monitoringMode,
+        parameters,
+        [connectionPtr = &connection_, callback = std::move(onDataChange)](
+            uint32_t subId, uint32_t monId, const DataValue& value
+        ) {
+            const MonitoredItem<Client> monitoredItem(*connectionPtr, subId, monId);
+            callback(monitoredItem, value);
+        }
+    );
+}
+
 template <>
 MonitoredItem<Client> Subscription<Client>::subscribeEvent(
     const NodeId& id,
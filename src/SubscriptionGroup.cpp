@@ -0,0 +1,196 @@
+#include "open62541pp/SubscriptionGroup.h"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+#include <algorithm>  // find_if, max, min_element
+#include <utility>  // move
+
+#include "open62541pp/Client.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/MonitoredItem.h"
+#include "open62541pp/types/DataValue.h"
+
+namespace opcua {
+
+SubscriptionGroup::SubscriptionGroup(
+    Client& client, size_t maxItemsPerSubscription, SubscriptionParameters parameters
+)
+    : client_(client),
+      maxItemsPerSubscription_(std::max<size_t>(maxItemsPerSubscription, 1)),
+      parameters_(parameters) {}
+
+SubscriptionGroup::~SubscriptionGroup() {
+    for (const auto& [key, shards] : buckets_) {
+        for (const auto& shard : shards) {
+            try {
+                services::deleteSubscription(client_, shard.subscriptionId);
+            } catch (...) {
+                // ignore, e.g. if the client is disconnected
+            }
+        }
+    }
+}
+
+SubscriptionGroup::Shard& SubscriptionGroup::acquireShard(const BucketKey& key) {
+    auto& shards = buckets_[key];
+    auto it = std::min_element(shards.begin(), shards.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.count < rhs.count;
+    });
+    if (it != shards.end() && it->count < maxItemsPerSubscription_) {
+        return *it;
+    }
+    SubscriptionParameters parameters = parameters_;
+    parameters.priority = key.second;
+    if (key.first > 0.0) {
+        parameters.publishingInterval = key.first;
+    }
+    const uint32_t subscriptionId = services::createSubscription(client_, parameters);
+    return shards.emplace_back(Shard{subscriptionId, 0});
+}
+
+void SubscriptionGroup::releaseShard(const BucketKey& key, uint32_t subscriptionId) {
+    auto& shards = buckets_[key];
+    auto it = std::find_if(shards.begin(), shards.end(), [&](const auto& shard) {
+        return shard.subscriptionId == subscriptionId;
+    });
+    if (it == shards.end()) {
+        return;
+    }
+    if (it->count > 0) {
+        --it->count;
+    }
+    if (it->count == 0) {
+        shards.erase(it);
+        services::deleteSubscription(client_, subscriptionId);
+    }
+    if (shards.empty()) {
+        buckets_.erase(key);
+    }
+}
+
+void SubscriptionGroup::createMonitoredItem(uint32_t itemId, Item& item) {
+    auto& shard = acquireShard(item.key);
+    const uint32_t subscriptionId = shard.subscriptionId;
+    ++shard.count;  // reserve
+    try {
+        item.monitoredItemId = services::createMonitoredItemDataChange(
+            client_,
+            subscriptionId,
+            item.itemToMonitor,
+            item.monitoringMode,
+            item.parameters,
+            [itemId, callback = item.callback](uint32_t, uint32_t, const DataValue& value) {
+                if (*callback) {
+                    (*callback)(itemId, value);
+                }
+            }
+        );
+    } catch (...) {
+        releaseShard(item.key, subscriptionId);
+        throw;
+    }
+    item.subscriptionId = subscriptionId;
+}
+
+uint32_t SubscriptionGroup::subscribeDataChange(
+    const ReadValueId& itemToMonitor,
+    MonitoringParameters& parameters,
+    DataChangeCallback onDataChange,
+    uint8_t priority,
+    MonitoringMode monitoringMode
+) {
+    Item item{
+        itemToMonitor,
+        monitoringMode,
+        parameters,
+        std::make_shared<DataChangeCallback>(std::move(onDataChange)),
+        {parameters.samplingInterval, priority},
+        0U,
+        0U,
+    };
+    const uint32_t itemId = nextItemId_++;
+    createMonitoredItem(itemId, item);
+    parameters = item.parameters;  // revised
+    items_.emplace(itemId, std::move(item));
+    return itemId;
+}
+
+void SubscriptionGroup::unsubscribe(uint32_t itemId) {
+    const auto it = items_.find(itemId);
+    if (it == items_.end()) {
+        throw BadStatus(UA_STATUSCODE_BADMONITOREDITEMIDINVALID);
+    }
+    const Item& item = it->second;
+    services::deleteMonitoredItem(client_, item.subscriptionId, item.monitoredItemId);
+    const auto key = item.key;
+    const auto subscriptionId = item.subscriptionId;
+    items_.erase(it);
+    releaseShard(key, subscriptionId);
+}
+
+size_t SubscriptionGroup::rebalance() {
+    size_t moved = 0;
+    std::vector<BucketKey> keys;
+    keys.reserve(buckets_.size());
+    for (const auto& [key, shards] : buckets_) {
+        keys.push_back(key);
+    }
+    for (const auto& key : keys) {
+        for (;;) {
+            auto& shards = buckets_.at(key);
+            size_t total = 0;
+            for (const auto& shard : shards) {
+                total += shard.count;
+            }
+            const size_t required = (total + maxItemsPerSubscription_ - 1) /
+                                    maxItemsPerSubscription_;
+            if (shards.size() <= required) {
+                break;
+            }
+            // empty the least filled subscription
+            const auto source = std::min_element(
+                shards.begin(), shards.end(), [](const auto& lhs, const auto& rhs) {
+                    return lhs.count < rhs.count;
+                }
+            );
+            const uint32_t sourceId = source->subscriptionId;
+            source->count = maxItemsPerSubscription_;  // exclude from acquireShard
+            for (auto& [itemId, item] : items_) {
+                if (item.key != key || item.subscriptionId != sourceId) {
+                    continue;
+                }
+                services::deleteMonitoredItem(client_, sourceId, item.monitoredItemId);
+                createMonitoredItem(itemId, item);
+                ++moved;
+            }
+            auto& remaining = buckets_.at(key);
+            remaining.erase(std::find_if(remaining.begin(), remaining.end(), [&](const auto& s) {
+                return s.subscriptionId == sourceId;
+            }));
+            services::deleteSubscription(client_, sourceId);
+        }
+    }
+    return moved;
+}
+
+MonitoredItem<Client> SubscriptionGroup::getMonitoredItem(uint32_t itemId) {
+    const auto it = items_.find(itemId);
+    if (it == items_.end()) {
+        throw BadStatus(UA_STATUSCODE_BADMONITOREDITEMIDINVALID);
+    }
+    return {client_, it->second.subscriptionId, it->second.monitoredItemId};
+}
+
+std::vector<Subscription<Client>> SubscriptionGroup::getSubscriptions() {
+    std::vector<Subscription<Client>> result;
+    for (const auto& [key, shards] : buckets_) {
+        for (const auto& shard : shards) {
+            result.emplace_back(client_, shard.subscriptionId);
+        }
+    }
+    return result;
+}
+
+}  // namespace opcua
+
+#endif
@@ -0,0 +1,196 @@
+#include "open62541pp/SubscriptionTuner.h"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+#include <algorithm>  // clamp, max
+#include <cmath>  // abs, ceil
+#include <utility>  // move, pair
+#include <vector>
+
+#include "open62541pp/Client.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/DateTime.h"
+
+namespace opcua {
+
+// status code bits of data values, see Part 4, 7.39.1
+static constexpr uint32_t infoTypeMask = 0x00000C00;
+static constexpr uint32_t infoTypeDataValue = 0x00000400;
+static constexpr uint32_t overflowBit = 0x00000080;
+
+static bool hasOverflow(const DataValue& value) noexcept {
+    if (!value.hasStatus()) {
+        return false;
+    }
+    const uint32_t status = value.getStatus();
+    return (status & infoTypeMask) == infoTypeDataValue && (status & overflowBit) != 0;
+}
+
+SubscriptionTuner::SubscriptionTuner(
+    Subscription<Client> subscription,
+    const SubscriptionParameters& parameters,
+    SubscriptionTuning tuning
+)
+    : subscription_(std::move(subscription)),
+      parameters_(parameters),
+      tuning_(tuning),
+      since_(std::chrono::steady_clock::now()) {}
+
+void SubscriptionTuner::addMonitoredItem(
+    uint32_t monitoredItemId, const MonitoringParameters& parameters
+) {
+    const std::lock_guard lock(mutex_);
+    items_[monitoredItemId] = Item{parameters, false};
+}
+
+void SubscriptionTuner::removeMonitoredItem(uint32_t monitoredItemId) {
+    const std::lock_guard lock(mutex_);
+    items_.erase(monitoredItemId);
+}
+
+void SubscriptionTuner::observeLocked(
+    uint32_t monitoredItemId, const DataValue& value, int64_t now
+) {
+    ++notificationCount_;
+    if (value.hasServerTimestamp() || value.hasSourceTimestamp()) {
+        const int64_t timestamp = value.hasServerTimestamp() ? value.getServerTimestamp().get()
+                                                             : value.getSourceTimestamp().get();
+        // clocks of client and server may differ, ignore negative latencies
+        latencySum_ += static_cast<double>(std::max<int64_t>(now - timestamp, 0)) /
+                       UA_DATETIME_MSEC;
+        ++latencyCount_;
+    }
+    if (hasOverflow(value)) {
+        ++overflowCount_;
+        if (auto it = items_.find(monitoredItemId); it != items_.end()) {
+            it->second.overflow = true;
+        }
+    }
+}
+
+void SubscriptionTuner::observe(uint32_t monitoredItemId, const DataValue& value) {
+    const int64_t now = DateTime::nowCoarse().get();
+    const std::lock_guard lock(mutex_);
+    observeLocked(monitoredItemId, value, now);
+}
+
+void SubscriptionTuner::observe(Span<const services::MonitoredItemNotification> notifications) {
+    const int64_t now = DateTime::nowCoarse().get();
+    const std::lock_guard lock(mutex_);
+    for (const auto& notification : notifications) {
+        observeLocked(notification.monitoredItemId, notification.value, now);
+    }
+}
+
+SubscriptionStatistics SubscriptionTuner::getStatisticsLocked() const {
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - since_;
+    SubscriptionStatistics statistics;
+    statistics.notificationCount = notificationCount_;
+    statistics.notificationRate =
+        elapsed.count() > 0.0 ? static_cast<double>(notificationCount_) / elapsed.count() : 0.0;
+    statistics.meanLatency =
+        latencyCount_ > 0 ? latencySum_ / static_cast<double>(latencyCount_) : 0.0;
+    statistics.overflowCount = overflowCount_;
+    return statistics;
+}
+
+SubscriptionStatistics SubscriptionTuner::getStatistics() const {
+    const std::lock_guard lock(mutex_);
+    return getStatisticsLocked();
+}
+
+void SubscriptionTuner::resetLocked() {
+    since_ = std::chrono::steady_clock::now();
+    notificationCount_ = 0;
+    latencyCount_ = 0;
+    latencySum_ = 0.0;
+    overflowCount_ = 0;
+    for (auto& [id, item] : items_) {
+        item.overflow = false;
+    }
+}
+
+MonitoringParameters SubscriptionTuner::getMonitoringParameters(uint32_t monitoredItemId) const {
+    const std::lock_guard lock(mutex_);
+    const auto it = items_.find(monitoredItemId);
+    if (it == items_.end()) {
+        throw BadStatus(UA_STATUSCODE_BADMONITOREDITEMIDINVALID);
+    }
+    return it->second.parameters;
+}
+
+bool SubscriptionTuner::adjust() {
+    // take a snapshot of the statistics, the services are called without the lock
+    SubscriptionStatistics statistics;
+    bool hasLatency = false;
+    std::vector<std::pair<uint32_t, MonitoringParameters>> overflowed;
+    {
+        const std::lock_guard lock(mutex_);
+        statistics = getStatisticsLocked();
+        hasLatency = latencyCount_ > 0;
+        for (const auto& [id, item] : items_) {
+            if (item.overflow && item.parameters.queueSize < tuning_.maxQueueSize) {
+                overflowed.emplace_back(id, item.parameters);
+            }
+        }
+        resetLocked();
+    }
+    if (statistics.notificationCount == 0) {
+        return false;
+    }
+
+    bool modified = false;
+    for (auto& [id, parameters] : overflowed) {
+        parameters.queueSize = std::clamp(
+            std::max<uint32_t>(parameters.queueSize, 1) * 2,
+            tuning_.minQueueSize,
+            tuning_.maxQueueSize
+        );
+        services::modifyMonitoredItem(
+            subscription_.getConnection(), subscription_.getSubscriptionId(), id, parameters
+        );
+        const std::lock_guard lock(mutex_);
+        if (auto it = items_.find(id); it != items_.end()) {
+            it->second.parameters = parameters;
+        }
+        modified = true;
+    }
+
+    SubscriptionParameters parameters = parameters_;
+    const bool tooSlow = statistics.overflowCount > 0 ||
+                         statistics.meanLatency > tuning_.targetLatency;
+    const bool tooFast = hasLatency && statistics.meanLatency < tuning_.targetLatency / 2;
+    if (tooSlow) {
+        parameters.publishingInterval /= 2;
+    } else if (tooFast) {
+        parameters.publishingInterval *= 1.5;
+    }
+    parameters.publishingInterval = std::clamp(
+        parameters.publishingInterval, tuning_.minPublishingInterval, tuning_.maxPublishingInterval
+    );
+    if (tuning_.maxNotificationsPerPublish > 0) {
+        const double expected = statistics.notificationRate * parameters.publishingInterval / 1000;
+        parameters.maxNotificationsPerPublish = std::clamp(
+            static_cast<uint32_t>(std::ceil(2 * expected)),
+            tuning_.minNotificationsPerPublish,
+            tuning_.maxNotificationsPerPublish
+        );
+    }
+
+    // ignore changes of the publishing interval below 1 %
+    const bool intervalChanged =
+        std::abs(parameters.publishingInterval - parameters_.publishingInterval) >
+        parameters_.publishingInterval / 100;
+    if (intervalChanged ||
+        parameters.maxNotificationsPerPublish != parameters_.maxNotificationsPerPublish) {
+        subscription_.setSubscriptionParameters(parameters);
+        parameters_ = parameters;
+        modified = true;
+    }
+    return modified;
+}
+
+}  // namespace opcua
+
+#endif
@@ -0,0 +1,58 @@
+#include "open62541pp/ValueStore.h"
+
+#include <memory>
+#include <utility>  // move
+
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/ValueBackend.h"
+#include "open62541pp/open62541.h"
+
+namespace opcua {
+
+static StatusCode readSlot(ValueSlot& slot, DataValue& dv, bool timestamp) noexcept {
+    const auto& latest = slot.acquire();
+    if (!latest->hasValue) {
+        return UA_STATUSCODE_BADWAITINGFORINITIALDATA;
+    }
+    // deep copy, the acquired buffer is reused by the producer after the next acquire
+    UA_DataValue& native = *dv.handle();
+    UA_DataValue_clear(&native);
+    const auto status = UA_DataValue_copy(latest.handle(), &native);
+    if (status != UA_STATUSCODE_GOOD) {
+        return status;
+    }
+    native.hasServerTimestamp = false;
+    if (!timestamp) {
+        native.hasSourceTimestamp = false;
+        native.hasSourcePicoseconds = false;
+    }
+    return UA_STATUSCODE_GOOD;  // status of the published value is returned in the DataValue
+}
+
+ValueSlot& ValueStore::registerNode(Server& server, const NodeId& id) {
+    auto& slot = slots_[id];
+    if (slot == nullptr) {
+        slot = std::make_unique<ValueSlot>();
+    }
+    ValueBackendDataSource backend;
+    backend.read = [ptr = slot.get()](DataValue& dv, const NumericRange&, bool timestamp) {
+        return readSlot(*ptr, dv, timestamp);
+    };
+    backend.write = [](const DataValue&, const NumericRange&) -> StatusCode {
+        return UA_STATUSCODE_BADNOTWRITABLE;
+    };
+    backend.applyReadRange = true;
+    server.setVariableNodeValueBackend(id, std::move(backend));
+    return *slot;
+}
+
+ValueSlot& ValueStore::getSlot(const NodeId& id) {
+    const auto it = slots_.find(id);
+    if (it == slots_.end()) {
+        throw BadStatus(UA_STATUSCODE_BADNODEIDUNKNOWN);
+    }
+    return *it->second;
+}
+
+}  // namespace opcua
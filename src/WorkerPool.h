@@ -0,0 +1,132 @@
+#pragma once
+
+#include <algorithm>  // min
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>  // forward, move
+#include <vector>
+
+namespace opcua {
+
+/// Process-wide worker pool, grows on demand.
+/// Shared by crypto offload, parallel copy and asynchronous credential verification.
+class WorkerPool {
+public:
+    static WorkerPool& instance() {
+        static WorkerPool pool;
+        return pool;
+    }
+
+    ~WorkerPool() {
+        {
+            const std::lock_guard lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+        for (auto& thread : threads_) {
+            thread.join();
+        }
+    }
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool(WorkerPool&&) noexcept = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+    WorkerPool& operator=(WorkerPool&&) noexcept = delete;
+
+    void reserve(size_t threads) {
+        const std::lock_guard lock(mutex_);
+        while (threads_.size() < threads) {
+            threads_.emplace_back([this] { work(); });
+        }
+    }
+
+    /// Enqueue a task without waiting for its completion.
+    /// Reserve at least one thread before, tasks are only processed by the worker threads.
+    void post(std::function<void()> task) {
+        {
+            const std::lock_guard lock(mutex_);
+            tasks_.push_back(std::move(task));
+        }
+        cv_.notify_one();
+    }
+
+    /// Invoke `func(i)` for all indices `i < count`, the calling thread participates.
+    /// Returns when all invocations are completed.
+    template <typename Func>
+    void run(size_t count, Func&& func) {
+        if (count == 0) {
+            return;
+        }
+        // helpers started after completion find no indices left and only access the shared state
+        struct State {
+            std::atomic<size_t> next{0};
+            size_t count{};
+            std::function<void(size_t)> func;
+            std::mutex mutex;
+            std::condition_variable cv;
+            size_t completed{0};
+        };
+        auto state = std::make_shared<State>();
+        state->count = count;
+        state->func = std::forward<Func>(func);
+
+        auto process = [](State& s) {
+            size_t processed = 0;
+            for (size_t i = s.next++; i < s.count; i = s.next++) {
+                s.func(i);
+                ++processed;
+            }
+            if (processed > 0) {
+                const std::lock_guard lock(s.mutex);
+                s.completed += processed;
+                if (s.completed == s.count) {
+                    s.cv.notify_one();
+                }
+            }
+        };
+
+        {
+            const std::lock_guard lock(mutex_);
+            const size_t helpers = std::min(count - 1, threads_.size());
+            for (size_t i = 0; i < helpers; ++i) {
+                tasks_.emplace_back([state, process] { process(*state); });
+            }
+        }
+        cv_.notify_all();
+        process(*state);
+        std::unique_lock lock(state->mutex);
+        state->cv.wait(lock, [&] { return state->completed == state->count; });
+    }
+
+private:
+    WorkerPool() = default;
+
+    void work() {
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock lock(mutex_);
+                cv_.wait(lock, [&] { return stop_ || !tasks_.empty(); });
+                if (stop_) {
+                    return;
+                }
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
+            task();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool stop_ = false;
+    std::deque<std::function<void()>> tasks_;
+    std::vector<std::thread> threads_;
+};
+
+}  // namespace opcua
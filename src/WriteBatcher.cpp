@@ -0,0 +1,161 @@
+#include "open62541pp/WriteBatcher.h"
+
+#include <algorithm>  // lower_bound, min, stable_sort
+#include <iterator>  // make_move_iterator
+#include <utility>  // move, exchange
+
+#include "open62541pp/Client.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/detail/ClientContext.h"
+#include "open62541pp/services/Attribute.h"
+
+namespace opcua {
+
+static uint32_t readMaxNodesPerWrite(Client& client) noexcept {
+    if (!client.isConnected()) {
+        return 0;
+    }
+    try {
+        return client.getOperationLimits().maxNodesPerWrite;
+    } catch (...) {
+        return 0;  // limit unknown
+    }
+}
+
+WriteBatcher::WriteBatcher(Client& client, WriteBatcherOptions options)
+    : client_(client),
+      options_(options),
+      maxNodesPerWrite_(readMaxNodesPerWrite(client)) {}
+
+WriteBatcher::~WriteBatcher() {
+    cancelFlush();
+}
+
+void WriteBatcher::add(
+    const NodeId& id, AttributeId attributeId, const DataValue& value, Handler&& handler
+) {
+    if (options_.deduplicate) {
+        const auto [it, inserted] = index_.try_emplace(Key{id, attributeId}, items_.size());
+        if (!inserted) {
+            items_[it->second].getValue() = value;  // last value wins
+            handlers_.emplace_back(it->second, std::move(handler));
+            return;
+        }
+    }
+    items_.emplace_back(id, attributeId, std::string_view{}, value);
+    handlers_.emplace_back(items_.size() - 1, std::move(handler));
+    if (options_.maxBatchSize > 0 && items_.size() >= options_.maxBatchSize) {
+        flush();
+    } else if (items_.size() == 1) {
+        scheduleFlush();
+    }
+}
+
+void WriteBatcher::scheduleFlush() {
+    const auto window = std::chrono::duration_cast<DateTime::UaDuration>(options_.window);
+    throwIfBad(UA_Client_addTimedCallback(
+        client_.handle(),
+        flushCallback,
+        this,
+        UA_DateTime_nowMonotonic() + window.count(),
+        &callbackId_
+    ));
+}
+
+void WriteBatcher::cancelFlush() noexcept {
+    if (callbackId_ != 0) {
+        UA_Client_removeCallback(client_.handle(), callbackId_);
+        callbackId_ = 0;
+    }
+}
+
+void WriteBatcher::flushCallback(UA_Client* client, void* data) {
+    auto* self = static_cast<WriteBatcher*>(data);
+    self->callbackId_ = 0;  // timed callbacks are removed after execution
+    detail::getContext(client).exceptionCatcher.invoke([self] { self->flush(); });
+}
+
+namespace {
+
+using HandlerWithIndex = std::pair<size_t, std::function<void(StatusCode)>>;
+
+struct WriteBatch {
+    size_t offset;
+    std::vector<HandlerWithIndex> handlers;
+};
+
+void dispatchWriteResponse(
+    detail::ExceptionCatcher& catcher,
+    const WriteBatch& batch,
+    size_t count,
+    StatusCode code,
+    WriteResponse& response
+) {
+    if (code.isGood()) {
+        code = response->responseHeader.serviceResult;
+    }
+    auto results = response.getResults();
+    if (code.isGood() && results.size() != count) {
+        code = UA_STATUSCODE_BADUNEXPECTEDERROR;
+    }
+    for (const auto& [index, handler] : batch.handlers) {
+        catcher.invoke(handler, code.isBad() ? code : results[index - batch.offset]);
+    }
+}
+
+}  // namespace
+
+void WriteBatcher::flush() {
+    cancelFlush();
+    const auto items = std::exchange(items_, {});
+    auto handlers = std::exchange(handlers_, {});
+    index_.clear();
+
+    // group handlers by item index, replaced writes are appended out of order
+    std::stable_sort(handlers.begin(), handlers.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.first < rhs.first;
+    });
+
+    const size_t limits[] = {maxNodesPerWrite_, options_.maxBatchSize};  // NOLINT
+    size_t chunkSize = items.size();
+    for (const size_t limit : limits) {
+        if (limit > 0) {
+            chunkSize = std::min(chunkSize, limit);
+        }
+    }
+    auto& catcher = detail::getContext(client_).exceptionCatcher;
+    auto first = handlers.begin();
+    for (size_t offset = 0; offset < items.size(); offset += chunkSize) {
+        const size_t count = std::min(chunkSize, items.size() - offset);
+        const auto last = std::lower_bound(
+            first,
+            handlers.end(),
+            offset + count,
+            [](const auto& h, size_t i) { return h.first < i; }
+        );
+        auto batch = std::make_shared<WriteBatch>(WriteBatch{
+            offset,
+            std::vector<HandlerWithIndex>(
+                std::make_move_iterator(first), std::make_move_iterator(last)
+            ),
+        });
+        first = last;
+        try {
+            services::writeAsync(
+                client_,
+                Span<const WriteValue>(items.data() + offset, count),  // NOLINT
+                [batch, count, &catcher](StatusCode code, WriteResponse& response) {
+                    dispatchWriteResponse(catcher, *batch, count, code, response);
+                }
+            );
+        } catch (const BadStatus& e) {
+            // request could not be sent
+            for (const auto& item : batch->handlers) {
+                catcher.invoke(item.second, StatusCode(e.code()));
+            }
+        }
+    }
+}
+
+}  // namespace opcua
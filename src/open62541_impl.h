@@ -24,6 +24,9 @@
 #if __has_include(<open62541/plugin/create_certificate.h>)  // since v1.3
 #include <open62541/plugin/create_certificate.h>
 #endif
+#ifdef UA_ENABLE_ENCRYPTION
+#include <open62541/plugin/pki_default.h>
+#endif
 
 // client
 // #include <open62541/client.h>  // included in open62541.h
@@ -39,6 +42,21 @@
 #include <open62541/server_config.h>
 #endif
 #include <open62541/server_config_default.h>
+#ifdef UA_ENABLE_PUBSUB
+#include <open62541/server_pubsub.h>
+#if __has_include(<open62541/plugin/pubsub_udp.h>)  // transport layers until v1.3
+#include <open62541/plugin/pubsub_udp.h>
+#endif
+#if defined(UA_ENABLE_PUBSUB_ETH_UADP) && __has_include(<open62541/plugin/pubsub_ethernet.h>)
+#include <open62541/plugin/pubsub_ethernet.h>
+#endif
+#endif
+#ifdef UA_ENABLE_HISTORIZING
+#include <open62541/plugin/historydata/history_data_backend.h>
+#include <open62541/plugin/historydata/history_data_gathering_default.h>
+#include <open62541/plugin/historydata/history_database_default.h>
+#include <open62541/plugin/historydatabase.h>
+#endif
 
 #endif
 
@@ -1,19 +1,48 @@
 #include "open62541pp/services/Attribute.h"
 
+#include <algorithm>  // find
+#include <array>
+#include <cstdint>  // SIZE_MAX
+#include <memory>
+#include <string>
+#include <utility>  // exchange, move, swap
+
+#include "open62541pp/AttributeCache.h"
+#include "open62541pp/Client.h"
 #include "open62541pp/Server.h"
+#include "open62541pp/detail/MetricsRecorder.h"
+#include "open62541pp/detail/ScopeExit.h"
+#include "open62541pp/detail/ServerContext.h"
+#include "open62541pp/services/Attribute_highlevel.h"  // readArrayDimensions
+#include "open62541pp/services/View.h"  // browseInto
+#include "open62541pp/services/detail/ClientService.h"  // withRegisteredNodes
 
 #include "../open62541_impl.h"
+#include "RequestChunking.h"
 
 namespace opcua::services {
 
 ReadResponse read(Client& client, const ReadRequest& request) {
-    return readAsync(client, request, detail::SyncOperation{});
+    return detail::withRegisteredNodes(client, *request.handle(), [&](const auto& substituted) {
+        return detail::sendChunkedRequest(
+            client,
+            substituted,
+            detail::getOperationLimit(client, &OperationLimits::maxNodesPerRead),
+            &UA_ReadRequest::nodesToReadSize,
+            &UA_ReadRequest::nodesToRead,
+            &UA_ReadResponse::resultsSize,
+            &UA_ReadResponse::results
+        );
+    });
 }
 
 template <>
 DataValue readAttribute<Server>(
     Server& server, const NodeId& id, AttributeId attributeId, TimestampsToReturn timestamps
 ) {
+    const opcua::detail::ServiceTimer timer(
+        opcua::detail::getMetricsRecorder(server), MetricsService::Read
+    );
     const auto item = detail::createReadValueId(id, attributeId);
     auto result = UA_Server_read(
         server.handle(), &item, static_cast<UA_TimestampsToReturn>(timestamps)
@@ -26,22 +55,521 @@ template <>
 DataValue readAttribute<Client>(
     Client& client, const NodeId& id, AttributeId attributeId, TimestampsToReturn timestamps
 ) {
-    return readAttributeAsync(client, id, attributeId, timestamps, detail::SyncOperation{});
+    auto* cache = client.getAttributeCache();
+    if (cache == nullptr || timestamps != TimestampsToReturn::Neither ||
+        !cache->isCached(attributeId)) {
+        return readAttributeAsync(client, id, attributeId, timestamps, detail::SyncOperation{});
+    }
+    if (auto cached = cache->get(id, attributeId)) {
+        return std::move(*cached);
+    }
+    auto result = readAttributeAsync(client, id, attributeId, timestamps, detail::SyncOperation{});
+    cache->put(id, attributeId, result);
+    return result;
 }
 
+/* ------------------------------------ Multiple attributes ------------------------------------- */
+
+namespace detail {
+
+struct NodeAttributesSnapshotAccess {
+    static void setStatus(
+        NodeAttributesSnapshot& snapshot, AttributeId attributeId, UA_StatusCode code
+    ) noexcept {
+        const auto index = static_cast<size_t>(attributeId);
+        snapshot.statuses_[index] = code;
+        snapshot.requested_[index] = true;
+    }
+};
+
+}  // namespace detail
+
+static void checkAttributeIds(Span<const AttributeId> attributeIds) {
+    for (const auto attributeId : attributeIds) {
+        if (attributeId < AttributeId::NodeId || attributeId > AttributeId::UserExecutable) {
+            throw BadStatus(UA_STATUSCODE_BADATTRIBUTEIDINVALID);
+        }
+    }
+}
+
+/// Move the scalar of the variant into the field (swap for types with dynamic memory).
+template <typename Native, typename Field>
+static bool takeScalar(UA_Variant& variant, UA_UInt32 typeIndex, Field& field) noexcept {
+    if (!UA_Variant_hasScalarType(&variant, &UA_TYPES[typeIndex])) {
+        return false;
+    }
+    auto& native = *static_cast<Native*>(variant.data);
+    if constexpr (opcua::detail::isTypeWrapper<Field>) {
+        std::swap(*field.handle(), native);
+    } else {
+        field = static_cast<Field>(native);
+    }
+    return true;
+}
+
+static bool takeAttribute(
+    NodeAttributesSnapshot& snapshot, AttributeId attributeId, UA_Variant& variant
+) {
+    switch (attributeId) {
+    case AttributeId::NodeId:
+        return takeScalar<UA_NodeId>(variant, UA_TYPES_NODEID, snapshot.nodeId);
+    case AttributeId::NodeClass:
+        // enums are decoded as Int32 by the client
+        return takeScalar<UA_NodeClass>(variant, UA_TYPES_NODECLASS, snapshot.nodeClass) ||
+               takeScalar<UA_Int32>(variant, UA_TYPES_INT32, snapshot.nodeClass);
+    case AttributeId::BrowseName:
+        return takeScalar<UA_QualifiedName>(variant, UA_TYPES_QUALIFIEDNAME, snapshot.browseName);
+    case AttributeId::DisplayName:
+        return takeScalar<UA_LocalizedText>(variant, UA_TYPES_LOCALIZEDTEXT, snapshot.displayName);
+    case AttributeId::Description:
+        return takeScalar<UA_LocalizedText>(variant, UA_TYPES_LOCALIZEDTEXT, snapshot.description);
+    case AttributeId::WriteMask:
+        return takeScalar<UA_UInt32>(variant, UA_TYPES_UINT32, snapshot.writeMask);
+    case AttributeId::UserWriteMask:
+        return takeScalar<UA_UInt32>(variant, UA_TYPES_UINT32, snapshot.userWriteMask);
+    case AttributeId::IsAbstract:
+        return takeScalar<UA_Boolean>(variant, UA_TYPES_BOOLEAN, snapshot.isAbstract);
+    case AttributeId::Symmetric:
+        return takeScalar<UA_Boolean>(variant, UA_TYPES_BOOLEAN, snapshot.symmetric);
+    case AttributeId::InverseName:
+        return takeScalar<UA_LocalizedText>(variant, UA_TYPES_LOCALIZEDTEXT, snapshot.inverseName);
+    case AttributeId::ContainsNoLoops:
+        return takeScalar<UA_Boolean>(variant, UA_TYPES_BOOLEAN, snapshot.containsNoLoops);
+    case AttributeId::EventNotifier:
+        return takeScalar<UA_Byte>(variant, UA_TYPES_BYTE, snapshot.eventNotifier);
+    case AttributeId::Value:
+        std::swap(*snapshot.value.handle(), variant);
+        return true;
+    case AttributeId::DataType:
+        return takeScalar<UA_NodeId>(variant, UA_TYPES_NODEID, snapshot.dataType);
+    case AttributeId::ValueRank:
+        return takeScalar<UA_Int32>(variant, UA_TYPES_INT32, snapshot.valueRank);
+    case AttributeId::ArrayDimensions: {
+        if (variant.type != &UA_TYPES[UA_TYPES_UINT32] || UA_Variant_isScalar(&variant)) {
+            return false;
+        }
+        const auto* dimensions = static_cast<const uint32_t*>(variant.data);
+        snapshot.arrayDimensions.assign(dimensions, dimensions + variant.arrayLength);  // NOLINT
+        return true;
+    }
+    case AttributeId::AccessLevel:
+        return takeScalar<UA_Byte>(variant, UA_TYPES_BYTE, snapshot.accessLevel);
+    case AttributeId::UserAccessLevel:
+        return takeScalar<UA_Byte>(variant, UA_TYPES_BYTE, snapshot.userAccessLevel);
+    case AttributeId::MinimumSamplingInterval:
+        return takeScalar<UA_Double>(variant, UA_TYPES_DOUBLE, snapshot.minimumSamplingInterval);
+    case AttributeId::Historizing:
+        return takeScalar<UA_Boolean>(variant, UA_TYPES_BOOLEAN, snapshot.historizing);
+    case AttributeId::Executable:
+        return takeScalar<UA_Boolean>(variant, UA_TYPES_BOOLEAN, snapshot.executable);
+    case AttributeId::UserExecutable:
+        return takeScalar<UA_Boolean>(variant, UA_TYPES_BOOLEAN, snapshot.userExecutable);
+    default:
+        return false;
+    }
+}
+
+/// Move the result of a read operation into the snapshot.
+static void assignResult(
+    NodeAttributesSnapshot& snapshot, AttributeId attributeId, UA_DataValue& result
+) {
+    UA_StatusCode code = result.hasStatus ? result.status : UA_STATUSCODE_GOOD;
+    if (!UA_StatusCode_isBad(code)) {
+        if (!result.hasValue && attributeId != AttributeId::Value) {
+            code = UA_STATUSCODE_BADNODATA;
+        } else if (!takeAttribute(snapshot, attributeId, result.value)) {
+            code = UA_STATUSCODE_BADTYPEMISMATCH;
+        }
+    }
+    detail::NodeAttributesSnapshotAccess::setStatus(snapshot, attributeId, code);
+}
+
+/// Read the attributes of the snapshots, the node ids are taken from the snapshots.
+static void readInto(
+    Server& server, Span<NodeAttributesSnapshot> snapshots, Span<const AttributeId> attributeIds
+) {
+    const opcua::detail::ServiceTimer timer(
+        opcua::detail::getMetricsRecorder(server), MetricsService::Read
+    );
+    for (auto& snapshot : snapshots) {
+        for (const auto attributeId : attributeIds) {
+            const auto item = detail::createReadValueId(snapshot.nodeId, attributeId);
+            UA_DataValue result = UA_Server_read(
+                server.handle(), &item, UA_TIMESTAMPSTORETURN_NEITHER
+            );
+            assignResult(snapshot, attributeId, result);
+            UA_DataValue_clear(&result);
+        }
+    }
+}
+
+static void readInto(
+    Client& client, Span<NodeAttributesSnapshot> snapshots, Span<const AttributeId> attributeIds
+) {
+    std::vector<UA_ReadValueId> items;
+    items.reserve(snapshots.size() * attributeIds.size());
+    for (const auto& snapshot : snapshots) {
+        for (const auto attributeId : attributeIds) {
+            items.push_back(detail::createReadValueId(snapshot.nodeId, attributeId));  // shallow
+        }
+    }
+    UA_ReadRequest request{};
+    request.timestampsToReturn = UA_TIMESTAMPSTORETURN_NEITHER;
+    request.nodesToReadSize = items.size();
+    request.nodesToRead = items.data();
+    auto response = read(client, asWrapper<ReadRequest>(request));
+    throwIfBad(response->responseHeader.serviceResult);
+    if (response->resultsSize != items.size()) {
+        throw BadStatus(UA_STATUSCODE_BADUNEXPECTEDERROR);
+    }
+    size_t index = 0;
+    for (auto& snapshot : snapshots) {
+        for (const auto attributeId : attributeIds) {
+            assignResult(snapshot, attributeId, response->results[index++]);  // NOLINT
+        }
+    }
+}
+
+template <typename T>
+std::vector<NodeAttributesSnapshot> readAttributes(
+    T& connection, Span<const NodeId> ids, Span<const AttributeId> attributeIds
+) {
+    checkAttributeIds(attributeIds);
+    std::vector<NodeAttributesSnapshot> snapshots(ids.size());
+    for (size_t i = 0; i < ids.size(); ++i) {
+        snapshots[i].nodeId = ids[i];
+    }
+    readInto(connection, snapshots, attributeIds);
+    return snapshots;
+}
+
+namespace {
+
+/// Attributes that are part of the target info of browse results.
+constexpr std::array<AttributeId, 4> browsedAttributes{
+    AttributeId::NodeId,
+    AttributeId::NodeClass,
+    AttributeId::BrowseName,
+    AttributeId::DisplayName,
+};
+
+/// Browse projection into snapshots, the target info of the references is moved into the fields.
+struct SnapshotProjection {
+    static constexpr Bitmask<BrowseResultMask> resultMask = BrowseResultMask::TargetInfo;
+
+    std::vector<NodeAttributesSnapshot> snapshots;
+    std::vector<ExpandedNodeId> typeDefinitions;
+
+    void add(ReferenceDescription& ref) {
+        if (!ref.getNodeId().isLocal()) {
+            return;
+        }
+        auto& snapshot = snapshots.emplace_back();
+        std::swap(*snapshot.nodeId.handle(), ref->nodeId.nodeId);
+        snapshot.nodeClass = ref.getNodeClass();
+        std::swap(*snapshot.browseName.handle(), ref->browseName);
+        std::swap(*snapshot.displayName.handle(), ref->displayName);
+        for (const auto attributeId : browsedAttributes) {
+            detail::NodeAttributesSnapshotAccess::setStatus(
+                snapshot, attributeId, UA_STATUSCODE_GOOD
+            );
+        }
+        std::swap(*typeDefinitions.emplace_back().handle(), ref->typeDefinition);
+    }
+};
+
+}  // namespace
+
+template <typename T>
+std::vector<BrowsedNode> browseWithAttributes(
+    T& connection, const BrowseDescription& bd, Span<const AttributeId> attributeIds
+) {
+    checkAttributeIds(attributeIds);
+    SnapshotProjection projection;
+    browseInto(connection, bd, projection);
+
+    // read the attributes that are not part of the browse results with a single request
+    std::vector<AttributeId> remaining;
+    for (const auto attributeId : attributeIds) {
+        const bool browsed = std::find(
+                                 browsedAttributes.begin(), browsedAttributes.end(), attributeId
+                             ) != browsedAttributes.end();
+        if (!browsed) {
+            remaining.push_back(attributeId);
+        }
+    }
+    if (!projection.snapshots.empty() && !remaining.empty()) {
+        readInto(connection, projection.snapshots, remaining);
+    }
+
+    std::vector<BrowsedNode> nodes(projection.snapshots.size());
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        nodes[i].attributes = std::move(projection.snapshots[i]);
+        nodes[i].typeDefinition = std::move(projection.typeDefinitions[i]);
+    }
+    return nodes;
+}
+
+std::vector<bool> existMany(Client& client, Span<const NodeId> ids) {
+    if (ids.empty()) {
+        return {};
+    }
+    std::vector<UA_ReadValueId> items(ids.size());
+    for (size_t i = 0; i < ids.size(); ++i) {
+        items[i].nodeId = *ids[i].handle();  // shallow copy
+        items[i].attributeId = UA_ATTRIBUTEID_NODECLASS;
+    }
+    UA_ReadRequest request{};
+    request.timestampsToReturn = UA_TIMESTAMPSTORETURN_NEITHER;
+    request.nodesToReadSize = items.size();
+    request.nodesToRead = items.data();
+    const auto response = read(client, asWrapper<ReadRequest>(request));
+    throwIfBad(response->responseHeader.serviceResult);
+    if (response->resultsSize != ids.size()) {
+        throw BadStatus(UA_STATUSCODE_BADUNEXPECTEDERROR);
+    }
+    std::vector<bool> exist(ids.size());
+    for (size_t i = 0; i < ids.size(); ++i) {
+        const UA_DataValue& result = response->results[i];  // NOLINT
+        exist[i] = !result.hasStatus || result.status == UA_STATUSCODE_GOOD;
+    }
+    return exist;
+}
+
+std::vector<bool> existMany(Server& server, Span<const NodeId> ids) {
+    std::vector<bool> exist(ids.size());
+    void* context{};
+    for (size_t i = 0; i < ids.size(); ++i) {
+        exist[i] = UA_Server_getNodeContext(server.handle(), *ids[i].handle(), &context) ==
+                   UA_STATUSCODE_GOOD;
+    }
+    return exist;
+}
+
+namespace {
+
+struct ArrayStreamState {
+    std::array<ReadResponse, detail::maxChunksInFlight> responses;  // ring buffer of chunks
+    std::array<bool, detail::maxChunksInFlight> received{};
+};
+
+struct ArrayStreamCallbackData {
+    std::shared_ptr<ArrayStreamState> state;  // shared, callbacks may outlive the stream
+    size_t slot;
+};
+
+std::string toIndexRange(size_t first, size_t last) {
+    return first == last ? std::to_string(first)
+                         : std::to_string(first) + ':' + std::to_string(last);
+}
+
+}  // namespace
+
+size_t detail::readArrayStreaming(
+    Client& client,
+    const NodeId& id,
+    size_t chunkElements,
+    const std::function<void(const Variant& chunk)>& sink
+) {
+    if (chunkElements == 0) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+    }
+    const auto dimensions = readArrayDimensions(client, id);
+    if (dimensions.size() > 1) {
+        throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+    }
+    // maximum length of the array, unbounded if unknown
+    const size_t chunkCount = (dimensions.empty() || dimensions[0] == 0)
+                                  ? SIZE_MAX
+                                  : (dimensions[0] + chunkElements - 1) / chunkElements;
+
+    auto state = std::make_shared<ArrayStreamState>();
+    auto callback = [](UA_Client*, void* userdata, uint32_t /* reqId */, void* responsePtr) {
+        std::unique_ptr<ArrayStreamCallbackData> data{
+            static_cast<ArrayStreamCallbackData*>(userdata)
+        };
+        auto& response = *data->state->responses.at(data->slot).handle();
+        if (responsePtr != nullptr) {
+            response = std::exchange(*static_cast<UA_ReadResponse*>(responsePtr), {});
+        } else {
+            response.responseHeader.serviceResult = UA_STATUSCODE_BADUNEXPECTEDERROR;
+        }
+        data->state->received.at(data->slot) = true;
+    };
+    const auto send = [&](size_t chunk) {
+        const size_t first = chunk * chunkElements;
+        auto indexRange = toIndexRange(first, first + chunkElements - 1);
+        UA_ReadValueId item{};
+        item.nodeId = *id.handle();  // shallow copy
+        item.attributeId = UA_ATTRIBUTEID_VALUE;
+        item.indexRange.length = indexRange.size();
+        item.indexRange.data = reinterpret_cast<UA_Byte*>(indexRange.data());  // NOLINT
+        UA_ReadRequest request{};
+        request.timestampsToReturn = UA_TIMESTAMPSTORETURN_NEITHER;
+        request.nodesToReadSize = 1;
+        request.nodesToRead = &item;
+        const size_t slot = chunk % maxChunksInFlight;
+        auto data = std::make_unique<ArrayStreamCallbackData>(ArrayStreamCallbackData{state, slot});
+        throwIfBad(__UA_Client_AsyncService(
+            client.handle(),
+            &request,
+            &UA_TYPES[UA_TYPES_READREQUEST],
+            callback,
+            &UA_TYPES[UA_TYPES_READRESPONSE],
+            data.get(),
+            nullptr
+        ));
+        data.release();  // NOLINT, ownership transferred to callback
+    };
+
+    size_t total = 0;
+    size_t sent = 0;
+    for (size_t next = 0; next < chunkCount; ++next) {
+        while (sent < chunkCount && sent - next < maxChunksInFlight) {
+            send(sent++);
+        }
+        const size_t slot = next % maxChunksInFlight;
+        while (!state->received[slot]) {
+            throwIfBad(UA_Client_run_iterate(client.handle(), 10));
+        }
+        // take the response, the slot is reused by the next chunks
+        const ReadResponse response = std::exchange(state->responses[slot], {});
+        state->received[slot] = false;
+        throwIfBad(response->responseHeader.serviceResult);
+        if (response->resultsSize != 1) {
+            throw BadStatus(UA_STATUSCODE_BADUNEXPECTEDERROR);
+        }
+        const UA_DataValue& dv = response->results[0];  // NOLINT
+        if (dv.hasStatus && dv.status == UA_STATUSCODE_BADINDEXRANGENODATA) {
+            break;  // end of the array
+        }
+        throwIfBad(dv.hasStatus ? dv.status : UA_STATUSCODE_GOOD);
+        if (!dv.hasValue) {
+            throw BadStatus(UA_STATUSCODE_BADNODATA);
+        }
+        const auto& chunk = asWrapper<Variant>(dv.value);
+        sink(chunk);
+        total += dv.value.arrayLength;
+        if (dv.value.arrayLength < chunkElements) {
+            break;  // last chunk
+        }
+    }
+    return total;
+}
+
+// explicit template instantiation
+template std::vector<NodeAttributesSnapshot> readAttributes<Server>(
+    Server&, Span<const NodeId>, Span<const AttributeId>
+);
+template std::vector<NodeAttributesSnapshot> readAttributes<Client>(
+    Client&, Span<const NodeId>, Span<const AttributeId>
+);
+template std::vector<BrowsedNode> browseWithAttributes<Server>(
+    Server&, const BrowseDescription&, Span<const AttributeId>
+);
+template std::vector<BrowsedNode> browseWithAttributes<Client>(
+    Client&, const BrowseDescription&, Span<const AttributeId>
+);
+
 WriteResponse write(Client& client, const WriteRequest& request) {
-    return writeAsync(client, request, detail::SyncOperation{});
+    if (auto* cache = client.getAttributeCache()) {
+        for (const auto& item : request.getNodesToWrite()) {
+            cache->invalidate(item.getNodeId(), item.getAttributeId());
+        }
+    }
+    return detail::withRegisteredNodes(client, *request.handle(), [&](const auto& substituted) {
+        return detail::sendChunkedRequest(
+            client,
+            substituted,
+            detail::getOperationLimit(client, &OperationLimits::maxNodesPerWrite),
+            &UA_WriteRequest::nodesToWriteSize,
+            &UA_WriteRequest::nodesToWrite,
+            &UA_WriteResponse::resultsSize,
+            &UA_WriteResponse::results
+        );
+    });
 }
 
 template <>
 void writeAttribute<Server>(
     Server& server, const NodeId& id, AttributeId attributeId, const DataValue& value
 ) {
+    const opcua::detail::ServiceTimer timer(
+        opcua::detail::getMetricsRecorder(server), MetricsService::Write
+    );
     const auto item = detail::createWriteValue(id, attributeId, value);
     const auto status = UA_Server_write(server.handle(), &item);
+    if (attributeId == AttributeId::BrowseName || attributeId == AttributeId::DisplayName) {
+        opcua::detail::getContext(server).notifyAddressSpaceChange();  // part of browse results
+    }
     throwIfBad(status);
 }
 
+void withDataValue(
+    Server& server, const NodeId& id, const std::function<void(const DataValue& value)>& visitor
+) {
+#ifdef UAPP_HAS_BORROWED_NODESTORE
+    auto& nodestore = UA_Server_getConfig(server.handle())->nodestore;
+    const UA_Node* node = nodestore.getNode(nodestore.context, id.handle());
+    if (node == nullptr) {
+        throw BadStatus(UA_STATUSCODE_BADNODEIDUNKNOWN);
+    }
+    const auto releaseNode = opcua::detail::ScopeExit([&] {
+        nodestore.releaseNode(nodestore.context, node);
+    });
+    if (node->head.nodeClass != UA_NODECLASS_VARIABLE) {
+        throw BadStatus(UA_STATUSCODE_BADNODECLASSINVALID);
+    }
+    const auto& variable = node->variableNode;
+    const bool stored = variable.valueSource == UA_VALUESOURCE_DATA &&
+                        variable.value.data.callback.onRead == nullptr;
+    if (stored) {
+        visitor(asWrapper<DataValue>(variable.value.data.value));
+        return;
+    }
+#endif
+    visitor(readDataValue(server, id));
+}
+
+template <typename T, typename SetValue>
+static std::vector<StatusCode> writeValuesImpl(
+    Server& server, Span<const NodeId> ids, Span<const T> values, SetValue&& setValue
+) {
+    if (ids.size() != values.size()) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+    }
+    // a single request with multiple operations, failed operations are no service errors
+    const opcua::detail::ServiceTimer timer(
+        opcua::detail::getMetricsRecorder(server), MetricsService::Write
+    );
+    std::vector<StatusCode> results(ids.size());
+    UA_WriteValue item{};
+    item.attributeId = UA_ATTRIBUTEID_VALUE;
+    for (size_t i = 0; i < ids.size(); ++i) {
+        item.nodeId = *ids[i].handle();  // shallow copy
+        setValue(item.value, values[i]);
+        results[i] = UA_Server_write(server.handle(), &item);
+    }
+    return results;
+}
+
+std::vector<StatusCode> writeValues(
+    Server& server, Span<const NodeId> ids, Span<const Variant> values
+) {
+    return writeValuesImpl(server, ids, values, [](UA_DataValue& dv, const Variant& value) {
+        dv.value = *value.handle();  // shallow copy
+        dv.hasValue = true;
+    });
+}
+
+std::vector<StatusCode> writeDataValues(
+    Server& server, Span<const NodeId> ids, Span<const DataValue> values
+) {
+    return writeValuesImpl(server, ids, values, [](UA_DataValue& dv, const DataValue& value) {
+        dv = *value.handle();  // shallow copy
+    });
+}
+
 template <>
 void writeAttribute<Client>(
     Client& client, const NodeId& id, AttributeId attributeId, const DataValue& value
@@ -49,4 +577,89 @@ void writeAttribute<Client>(
     writeAttributeAsync(client, id, attributeId, value, detail::SyncOperation{});
 }
 
+template <>
+Result<DataValue> tryReadAttribute<Server>(
+    Server& server, const NodeId& id, AttributeId attributeId, TimestampsToReturn timestamps
+) {
+    const opcua::detail::ServiceTimer timer(
+        opcua::detail::getMetricsRecorder(server), MetricsService::Read
+    );
+    const auto item = detail::createReadValueId(id, attributeId);
+    DataValue result = UA_Server_read(
+        server.handle(), &item, static_cast<UA_TimestampsToReturn>(timestamps)
+    );
+    const auto code = detail::getReadResultStatus(*result.handle());
+    if (code.isBad()) {
+        return BadResult(code);
+    }
+    return {code, std::move(result)};
+}
+
+template <>
+Result<DataValue> tryReadAttribute<Client>(
+    Client& client, const NodeId& id, AttributeId attributeId, TimestampsToReturn timestamps
+) {
+    auto* cache = client.getAttributeCache();
+    const bool cached = cache != nullptr && timestamps == TimestampsToReturn::Neither &&
+                        cache->isCached(attributeId);
+    if (cached) {
+        if (auto value = cache->get(id, attributeId)) {
+            return std::move(*value);
+        }
+    }
+    auto item = detail::createReadValueId(id, attributeId);
+    const auto request = detail::createReadRequest(timestamps, item);
+    auto result = detail::sendRequest<UA_ReadRequest, UA_ReadResponse>(
+        client, request, detail::tryGetReadResult, detail::SyncOperation{}
+    );
+    if (cached && !result.code().isBad()) {
+        cache->put(id, attributeId, *result);
+    }
+    return result;
+}
+
+template <>
+Result<void> tryWriteAttribute<Server>(
+    Server& server, const NodeId& id, AttributeId attributeId, const DataValue& value
+) {
+    const opcua::detail::ServiceTimer timer(
+        opcua::detail::getMetricsRecorder(server), MetricsService::Write
+    );
+    const auto item = detail::createWriteValue(id, attributeId, value);
+    const StatusCode code = UA_Server_write(server.handle(), &item);
+    if (attributeId == AttributeId::BrowseName || attributeId == AttributeId::DisplayName) {
+        opcua::detail::getContext(server).notifyAddressSpaceChange();  // part of browse results
+    }
+    if (code.isBad()) {
+        return BadResult(code);
+    }
+    return {};
+}
+
+template <>
+Result<void> tryWriteAttribute<Client>(
+    Client& client, const NodeId& id, AttributeId attributeId, const DataValue& value
+) {
+    if (auto* cache = client.getAttributeCache()) {
+        cache->invalidate(id, attributeId);
+    }
+    auto item = detail::createWriteValue(id, attributeId, value);
+    const auto request = detail::createWriteRequest(item);
+    return detail::sendRequest<UA_WriteRequest, UA_WriteResponse>(
+        client,
+        request,
+        [](UA_WriteResponse& response) -> Result<void> {
+            auto code = detail::getSingleResultStatus(response);
+            if (!code.isBad()) {
+                code = *response.results;
+            }
+            if (code.isBad()) {
+                return BadResult(code);
+            }
+            return {};
+        },
+        detail::SyncOperation{}
+    );
+}
+
 }  // namespace opcua::services
@@ -0,0 +1,223 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+#include <string_view>
+
+#include "open62541pp/AddressSpaceIndex.h"
+#include "open62541pp/Common.h"  // AttributeId, BrowseDirection, FilterOperator
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/Composed.h"
+#include "open62541pp/types/ExtensionObject.h"
+#include "open62541pp/types/NodeId.h"
+#include "open62541pp/types/Variant.h"
+
+#include "../open62541_impl.h"
+
+// content filter helpers shared by the local query service and EventFilterSet
+namespace opcua::services::detail {
+
+/// Resolve a relative path from a node to the first local target.
+inline std::optional<NodeId> resolvePath(
+    Server& server, const NodeId& id, const RelativePath& path
+) {
+    if (path.getElements().empty()) {
+        return id;
+    }
+    const BrowsePath browsePath(id, path);
+    const BrowsePathResult result = UA_Server_translateBrowsePathToNodeIds(
+        server.handle(), browsePath.handle()
+    );
+    for (const auto& target : result.getTargets()) {
+        if (target.getTargetId().isLocal()) {
+            return target.getTargetId().getNodeId();
+        }
+    }
+    return std::nullopt;
+}
+
+/// Relative path of hierarchical references from a browse path, e.g. of SimpleAttributeOperand.
+inline RelativePath toRelativePath(Span<const QualifiedName> browsePath) {
+    std::vector<RelativePathElement> elements;
+    elements.reserve(browsePath.size());
+    for (const auto& name : browsePath) {
+        elements.emplace_back(ReferenceTypeId::HierarchicalReferences, false, true, name);
+    }
+    return RelativePath(elements);
+}
+
+/// Get the type definition of a node, a null NodeId if not found.
+inline NodeId readTypeDefinition(Server& server, const NodeId& id) {
+    const BrowseDescription bd(
+        id,
+        BrowseDirection::Forward,
+        ReferenceTypeId::HasTypeDefinition,
+        false,
+        NodeClass::Unspecified,
+        BrowseResultMask::None
+    );
+    const BrowseResult result = UA_Server_browse(server.handle(), 1, bd.handle());
+    const auto refs = result.getReferences();
+    return refs.empty() ? NodeId() : refs[0].getNodeId().getNodeId();
+}
+
+/* ------------------------------------------ Compare ------------------------------------------- */
+
+inline std::optional<double> toNumber(const Variant& value) {
+    if (!value.isScalar()) {
+        return std::nullopt;
+    }
+    const void* data = value.data();
+    switch (value.getDataType()->typeKind) {
+    case UA_DATATYPEKIND_BOOLEAN:
+        return *static_cast<const UA_Boolean*>(data) ? 1.0 : 0.0;
+    case UA_DATATYPEKIND_SBYTE:
+        return *static_cast<const UA_SByte*>(data);
+    case UA_DATATYPEKIND_BYTE:
+        return *static_cast<const UA_Byte*>(data);
+    case UA_DATATYPEKIND_INT16:
+        return *static_cast<const UA_Int16*>(data);
+    case UA_DATATYPEKIND_UINT16:
+        return *static_cast<const UA_UInt16*>(data);
+    case UA_DATATYPEKIND_INT32:
+    case UA_DATATYPEKIND_ENUM:
+        return *static_cast<const UA_Int32*>(data);
+    case UA_DATATYPEKIND_UINT32:
+        return *static_cast<const UA_UInt32*>(data);
+    case UA_DATATYPEKIND_INT64:
+        return static_cast<double>(*static_cast<const UA_Int64*>(data));
+    case UA_DATATYPEKIND_UINT64:
+        return static_cast<double>(*static_cast<const UA_UInt64*>(data));
+    case UA_DATATYPEKIND_FLOAT:
+        return *static_cast<const UA_Float*>(data);
+    case UA_DATATYPEKIND_DOUBLE:
+        return *static_cast<const UA_Double*>(data);
+    default:
+        return std::nullopt;
+    }
+}
+
+inline std::optional<std::string_view> toText(const Variant& value) {
+    if (!value.isScalar()) {
+        return std::nullopt;
+    }
+    if (value.isType<String>()) {
+        return value.getScalar<String>().get();
+    }
+    if (value.isType<LocalizedText>()) {
+        return value.getScalar<LocalizedText>().getText();
+    }
+    if (value.isType<QualifiedName>()) {
+        return value.getScalar<QualifiedName>().getName();
+    }
+    return std::nullopt;
+}
+
+/// Three-way comparison, `std::nullopt` if the values are not comparable.
+inline std::optional<int> compare(const Variant& lhs, const Variant& rhs) {
+    if (lhs.isEmpty() || rhs.isEmpty()) {
+        return std::nullopt;
+    }
+    if (const auto a = toNumber(lhs), b = toNumber(rhs); a && b) {
+        return (*a < *b) ? -1 : (*a > *b) ? 1 : 0;
+    }
+    if (const auto a = toText(lhs), b = toText(rhs); a && b) {
+        const int result = a->compare(*b);
+        return (result < 0) ? -1 : (result > 0) ? 1 : 0;
+    }
+    if (lhs.isScalar() && rhs.isScalar() && lhs.isType<NodeId>() && rhs.isType<NodeId>()) {
+        const auto& a = lhs.getScalar<NodeId>();
+        const auto& b = rhs.getScalar<NodeId>();
+        return (a < b) ? -1 : (b < a) ? 1 : 0;
+    }
+    return std::nullopt;
+}
+
+/// Match the `%` (any string) and `_` (any character) wildcards of the Like operator.
+inline bool matchLike(std::string_view text, std::string_view pattern) {
+    size_t t = 0;
+    size_t p = 0;
+    size_t starPattern = std::string_view::npos;
+    size_t starText = 0;
+    while (t < text.size()) {
+        if (p < pattern.size() && pattern[p] == '%') {
+            starPattern = p++;
+            starText = t;
+        } else if (p < pattern.size() && (pattern[p] == '_' || pattern[p] == text[t])) {
+            ++t;
+            ++p;
+        } else if (starPattern != std::string_view::npos) {
+            p = starPattern + 1;
+            t = ++starText;
+        } else {
+            return false;
+        }
+    }
+    while (p < pattern.size() && pattern[p] == '%') {
+        ++p;
+    }
+    return p == pattern.size();
+}
+
+/* ------------------------------------------- Filter ------------------------------------------- */
+
+/// Validate the operator and operands of a content filter element.
+inline StatusCode validateElement(Span<const ContentFilterElement> elements, size_t index) {
+    const auto& element = elements[index];
+    const auto operands = element.getFilterOperands();
+    const auto count = operands.size();
+    bool validCount = false;
+    switch (element.getFilterOperator()) {
+    case FilterOperator::IsNull:
+    case FilterOperator::Not:
+    case FilterOperator::OfType:
+        validCount = (count == 1);
+        break;
+    case FilterOperator::Equals:
+    case FilterOperator::GreaterThan:
+    case FilterOperator::LessThan:
+    case FilterOperator::GreaterThanOrEqual:
+    case FilterOperator::LessThanOrEqual:
+    case FilterOperator::Like:
+    case FilterOperator::And:
+    case FilterOperator::Or:
+        validCount = (count == 2);
+        break;
+    case FilterOperator::Between:
+        validCount = (count == 3);
+        break;
+    case FilterOperator::InList:
+        validCount = (count >= 2);
+        break;
+    default:
+        return UA_STATUSCODE_BADFILTEROPERATORUNSUPPORTED;
+    }
+    if (!validCount) {
+        return UA_STATUSCODE_BADFILTEROPERANDCOUNTMISMATCH;
+    }
+    for (const auto& operand : operands) {
+        if (const auto* op = operand.getDecodedData<ElementOperand>()) {
+            // only forward references, rules out cycles
+            if (op->getIndex() <= index || op->getIndex() >= elements.size()) {
+                return UA_STATUSCODE_BADFILTEROPERANDINVALID;
+            }
+        } else if (operand.getDecodedData<LiteralOperand>() == nullptr &&
+                   operand.getDecodedData<SimpleAttributeOperand>() == nullptr &&
+                   operand.getDecodedData<AttributeOperand>() == nullptr) {
+            return UA_STATUSCODE_BADFILTEROPERANDINVALID;
+        }
+    }
+    if (element.getFilterOperator() == FilterOperator::OfType) {
+        const auto* literal = operands[0].getDecodedData<LiteralOperand>();
+        if (literal == nullptr || !literal->getValue().isType<NodeId>()) {
+            return UA_STATUSCODE_BADFILTEROPERANDINVALID;
+        }
+    }
+    return UA_STATUSCODE_GOOD;
+}
+
+}  // namespace opcua::services::detail
@@ -0,0 +1,309 @@
+#include "open62541pp/services/History.h"
+
+#include <algorithm>  // min, max
+#include <deque>
+#include <exception>
+#include <memory>
+#include <utility>  // move, swap
+#include <vector>
+
+#include "open62541pp/Client.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/TypeWrapper.h"
+#include "open62541pp/detail/ScopeExit.h"
+#include "open62541pp/services/detail/ClientService.h"
+#include "open62541pp/services/detail/ResponseHandling.h"
+
+#include "../open62541_impl.h"
+#include "RequestChunking.h"
+
+namespace opcua::services {
+
+namespace {
+
+using HistoryReadResponse = TypeWrapper<UA_HistoryReadResponse, UA_TYPES_HISTORYREADRESPONSE>;
+
+struct HistoryReadState {
+    Client* client;
+    std::vector<NodeId> ids;
+    HistoryReadRawOptions options;
+    HistoryReadRawCallback callback;
+    std::function<void(StatusCode, size_t)> onComplete;
+    size_t limit = 0;
+    size_t maxInFlight = 0;
+    size_t nextNode = 0;  // next node without request
+    std::deque<std::pair<size_t, ByteString>> continuations;
+    size_t inFlight = 0;
+    size_t count = 0;
+    StatusCode error;
+    std::exception_ptr exception;
+    bool done = false;
+
+    // columns, reused for all batches
+    std::vector<Variant> values;
+    std::vector<StatusCode> statusCodes;
+    std::vector<DateTime> sourceTimestamps;
+    std::vector<DateTime> serverTimestamps;
+};
+
+using HistoryReadStatePtr = std::shared_ptr<HistoryReadState>;
+
+void sendHistoryReads(const HistoryReadStatePtr& state);
+
+UA_ReadRawModifiedDetails makeDetails(const HistoryReadRawOptions& options) {
+    UA_ReadRawModifiedDetails details{};
+    details.isReadModified = false;
+    details.startTime = options.startTime.get();
+    details.endTime = options.endTime.get();
+    details.numValuesPerNode = options.numValuesPerNode;
+    details.returnBounds = options.returnBounds;
+    return details;
+}
+
+/// Release the continuation points left after an error or abort (fire and forget).
+void releaseContinuationPoints(HistoryReadState& state) noexcept {
+    if (state.continuations.empty()) {
+        return;
+    }
+    try {
+        // shallow copies, the request is encoded when sent
+        std::vector<UA_HistoryReadValueId> items(state.continuations.size());
+        for (size_t i = 0; i < items.size(); ++i) {
+            items[i].nodeId = *state.ids[state.continuations[i].first].handle();
+            items[i].continuationPoint = *state.continuations[i].second.handle();
+        }
+        UA_ReadRawModifiedDetails details = makeDetails(state.options);
+        UA_HistoryReadRequest request{};
+        request.historyReadDetails.encoding = UA_EXTENSIONOBJECT_DECODED_NODELETE;
+        request.historyReadDetails.content.decoded.type =
+            &UA_TYPES[UA_TYPES_READRAWMODIFIEDDETAILS];
+        request.historyReadDetails.content.decoded.data = &details;
+        request.releaseContinuationPoints = true;
+        request.nodesToReadSize = items.size();
+        request.nodesToRead = items.data();
+        detail::sendRequest<UA_HistoryReadRequest, UA_HistoryReadResponse>(
+            *state.client,
+            request,
+            detail::WrapResponse<HistoryReadResponse>{},
+            [](StatusCode, HistoryReadResponse&) {}
+        );
+    } catch (...) {  // NOLINT(bugprone-empty-catch)
+        // disconnected, the continuation points were released with the session
+    }
+    state.continuations.clear();
+}
+
+void finish(HistoryReadState& state) {
+    const bool pending = !state.continuations.empty() || state.nextNode < state.ids.size();
+    if (state.done || state.inFlight > 0 || (pending && state.error.isGood())) {
+        return;
+    }
+    state.done = true;
+    releaseContinuationPoints(state);  // left after errors
+    if (state.onComplete) {
+        state.onComplete(state.error, state.count);
+    }
+}
+
+void dispatchBatch(
+    HistoryReadState& state, size_t nodeIndex, UA_HistoryReadResult& result, bool last
+) {
+    HistoryReadBatch batch{};
+    batch.nodeIndex = nodeIndex;
+    batch.status = result.statusCode;
+    batch.last = last;
+
+    size_t size = 0;
+    UA_DataValue* dataValues = nullptr;
+    const auto& data = result.historyData;
+    if (StatusCode(result.statusCode).isGood() && data.encoding >= UA_EXTENSIONOBJECT_DECODED &&
+        data.content.decoded.type == &UA_TYPES[UA_TYPES_HISTORYDATA]) {
+        auto* historyData = static_cast<UA_HistoryData*>(data.content.decoded.data);
+        size = historyData->dataValuesSize;
+        dataValues = historyData->dataValues;
+    }
+
+    state.values.resize(size);
+    state.statusCodes.resize(size);
+    state.sourceTimestamps.resize(size);
+    state.serverTimestamps.resize(size);
+    for (size_t i = 0; i < size; ++i) {
+        auto& dv = dataValues[i];  // NOLINT
+        // move the value out of the response
+        auto& value = *state.values[i].handle();
+        UA_Variant_clear(&value);
+        std::swap(value, dv.value);
+        state.statusCodes[i] = dv.hasStatus ? dv.status : UA_STATUSCODE_GOOD;
+        state.sourceTimestamps[i] = DateTime(dv.hasSourceTimestamp ? dv.sourceTimestamp : 0);
+        state.serverTimestamps[i] = DateTime(dv.hasServerTimestamp ? dv.serverTimestamp : 0);
+    }
+    batch.values = state.values;
+    batch.statusCodes = state.statusCodes;
+    batch.sourceTimestamps = state.sourceTimestamps;
+    batch.serverTimestamps = state.serverTimestamps;
+    state.count += size;
+    state.callback(batch);
+}
+
+void processResponse(
+    const HistoryReadStatePtr& state,
+    const std::vector<size_t>& nodes,
+    StatusCode code,
+    HistoryReadResponse& response
+) {
+    --state->inFlight;
+    if (code.isGood()) {
+        code = response->responseHeader.serviceResult;
+    }
+    if (code.isBad()) {
+        if (state->error.isGood()) {
+            state->error = code;
+        }
+        finish(*state);
+        return;
+    }
+    Span<UA_HistoryReadResult> results{response->results, response->resultsSize};
+    const size_t size = std::min(nodes.size(), results.size());
+
+    std::vector<bool> last(size, true);
+    for (size_t i = 0; i < size; ++i) {
+        auto& continuationPoint = results[i].continuationPoint;
+        if (continuationPoint.length > 0 && StatusCode(results[i].statusCode).isGood()) {
+            ByteString owned;
+            std::swap(*owned.handle(), continuationPoint);  // move out of the response
+            state->continuations.emplace_back(nodes[i], std::move(owned));
+            last[i] = false;
+        }
+    }
+    if (state->done) {
+        releaseContinuationPoints(*state);  // response after an abort
+        return;
+    }
+    // pipeline the next requests first, the server prepares the next batches meanwhile
+    sendHistoryReads(state);
+
+    try {
+        for (size_t i = 0; i < size && state->error.isGood(); ++i) {
+            dispatchBatch(*state, nodes[i], results[i], last[i]);
+        }
+    } catch (...) {
+        state->exception = std::current_exception();
+        state->error = UA_STATUSCODE_BADINTERNALERROR;
+    }
+    finish(*state);
+}
+
+void sendHistoryRead(const HistoryReadStatePtr& state) {
+    std::vector<size_t> nodes;
+    std::vector<ByteString> continuationPoints;
+    while (!state->continuations.empty() && nodes.size() < state->limit) {
+        auto& [node, continuationPoint] = state->continuations.front();
+        nodes.push_back(node);
+        continuationPoints.push_back(std::move(continuationPoint));
+        state->continuations.pop_front();
+    }
+    if (nodes.empty()) {
+        while (state->nextNode < state->ids.size() && nodes.size() < state->limit) {
+            nodes.push_back(state->nextNode++);
+        }
+    }
+
+    // shallow copies, the request is encoded when sent
+    std::vector<UA_HistoryReadValueId> items(nodes.size());
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        items[i].nodeId = *state->ids[nodes[i]].handle();
+        if (!continuationPoints.empty()) {
+            items[i].continuationPoint = *continuationPoints[i].handle();
+        }
+    }
+    const auto& options = state->options;
+    UA_ReadRawModifiedDetails details = makeDetails(options);
+
+    UA_HistoryReadRequest request{};
+    request.historyReadDetails.encoding = UA_EXTENSIONOBJECT_DECODED_NODELETE;
+    request.historyReadDetails.content.decoded.type = &UA_TYPES[UA_TYPES_READRAWMODIFIEDDETAILS];
+    request.historyReadDetails.content.decoded.data = &details;
+    request.timestampsToReturn = static_cast<UA_TimestampsToReturn>(options.timestampsToReturn);
+    request.releaseContinuationPoints = false;
+    request.nodesToReadSize = items.size();
+    request.nodesToRead = items.data();
+
+    ++state->inFlight;
+    detail::sendRequest<UA_HistoryReadRequest, UA_HistoryReadResponse>(
+        *state->client,
+        request,
+        detail::WrapResponse<HistoryReadResponse>{},
+        [state, nodes = std::move(nodes)](StatusCode code, HistoryReadResponse& response) {
+            processResponse(state, nodes, code, response);
+        }
+    );
+}
+
+void sendHistoryReads(const HistoryReadStatePtr& state) {
+    while (state->error.isGood() && state->inFlight < state->maxInFlight &&
+           (!state->continuations.empty() || state->nextNode < state->ids.size())) {
+        sendHistoryRead(state);
+    }
+}
+
+HistoryReadStatePtr startHistoryRead(
+    Client& connection,
+    Span<const NodeId> ids,
+    const HistoryReadRawOptions& options,
+    HistoryReadRawCallback callback,
+    std::function<void(StatusCode, size_t)> onComplete
+) {
+    auto state = std::make_shared<HistoryReadState>();
+    state->client = &connection;
+    state->ids.assign(ids.begin(), ids.end());
+    state->options = options;
+    state->callback = std::move(callback);
+    state->onComplete = std::move(onComplete);
+    state->limit = std::max<size_t>(options.maxNodesPerRequest, 1);
+    const uint32_t serverLimit = detail::getOperationLimit(
+        connection, &OperationLimits::maxNodesPerHistoryReadData
+    );
+    if (serverLimit > 0) {
+        state->limit = std::min<size_t>(state->limit, serverLimit);
+    }
+    state->maxInFlight = std::max<size_t>(options.maxRequestsInFlight, 1);
+    sendHistoryReads(state);
+    finish(*state);  // no nodes
+    return state;
+}
+
+}  // namespace
+
+size_t historyReadRaw(
+    Client& connection,
+    Span<const NodeId> ids,
+    const HistoryReadRawOptions& options,
+    const HistoryReadRawCallback& callback
+) {
+    // the state is shared with the handlers, responses might arrive after an exception
+    auto state = startHistoryRead(connection, ids, options, callback, {});
+    const auto stopOnExit = opcua::detail::ScopeExit([&] {
+        state->done = true;
+        releaseContinuationPoints(*state);  // left after exceptions of runIterate
+    });
+    while (!state->done) {
+        connection.runIterate(100);
+    }
+    if (state->exception) {
+        std::rethrow_exception(state->exception);
+    }
+    throwIfBad(state->error);
+    return state->count;
+}
+
+void historyReadRawAsync(
+    Client& connection,
+    Span<const NodeId> ids,
+    const HistoryReadRawOptions& options,
+    HistoryReadRawCallback callback,
+    std::function<void(StatusCode status, size_t count)> onComplete
+) {
+    startHistoryRead(connection, ids, options, std::move(callback), std::move(onComplete));
+}
+
+}  // namespace opcua::services
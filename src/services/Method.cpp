@@ -3,9 +3,11 @@
 #ifdef UA_ENABLE_METHODCALLS
 
 #include "open62541pp/Server.h"
+#include "open62541pp/detail/MetricsRecorder.h"
 #include "open62541pp/types/Composed.h"
 
 #include "../open62541_impl.h"
+#include "RequestChunking.h"
 
 namespace opcua::services {
 
@@ -16,6 +18,9 @@ std::vector<Variant> call(
     const NodeId& methodId,
     Span<const Variant> inputArguments
 ) {
+    const opcua::detail::ServiceTimer timer(
+        opcua::detail::getMetricsRecorder(server), MetricsService::Call
+    );
     UA_CallMethodRequest item = detail::createCallMethodRequest(objectId, methodId, inputArguments);
     CallMethodResult result = UA_Server_call(server.handle(), &item);
     return detail::getOutputArguments(result);
@@ -31,6 +36,58 @@ std::vector<Variant> call(
     return callAsync(client, objectId, methodId, inputArguments, detail::SyncOperation{});
 }
 
+template <>
+Result<std::vector<Variant>> tryCall(
+    Server& server,
+    const NodeId& objectId,
+    const NodeId& methodId,
+    Span<const Variant> inputArguments
+) {
+    const opcua::detail::ServiceTimer timer(
+        opcua::detail::getMetricsRecorder(server), MetricsService::Call
+    );
+    UA_CallMethodRequest item = detail::createCallMethodRequest(objectId, methodId, inputArguments);
+    CallMethodResult result = UA_Server_call(server.handle(), &item);
+    return detail::tryGetOutputArguments(*result.handle());
+}
+
+template <>
+Result<std::vector<Variant>> tryCall(
+    Client& client,
+    const NodeId& objectId,
+    const NodeId& methodId,
+    Span<const Variant> inputArguments
+) {
+    UA_CallMethodRequest item = detail::createCallMethodRequest(objectId, methodId, inputArguments);
+    UA_CallRequest request{};
+    request.methodsToCall = &item;
+    request.methodsToCallSize = 1;
+    return detail::sendRequest<UA_CallRequest, UA_CallResponse>(
+        client,
+        request,
+        [](UA_CallResponse& response) -> Result<std::vector<Variant>> {
+            if (const auto code = detail::getSingleResultStatus(response); code.isBad()) {
+                return BadResult(code);
+            }
+            return detail::tryGetOutputArguments(*response.results);
+        },
+        detail::SyncOperation{}
+    );
+}
+
+CallResponse callMany(Client& client, Span<const CallMethodRequest> methodsToCall) {
+    const auto request = detail::createCallRequest(methodsToCall);
+    return detail::sendChunkedRequest(
+        client,
+        request,
+        detail::getOperationLimit(client, &OperationLimits::maxNodesPerMethodCall),
+        &UA_CallRequest::methodsToCallSize,
+        &UA_CallRequest::methodsToCall,
+        &UA_CallResponse::resultsSize,
+        &UA_CallResponse::results
+    );
+}
+
 }  // namespace opcua::services
 
 #endif
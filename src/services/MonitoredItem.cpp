@@ -2,10 +2,14 @@
 
 #ifdef UA_ENABLE_SUBSCRIPTIONS
 
-#include <algorithm>  // for_each_n
+#include <algorithm>  // find, for_each_n, min, remove_if, stable_sort
 #include <cstddef>
 #include <memory>
-#include <utility>  // move
+#include <mutex>
+#include <iterator>  // make_move_iterator
+#include <utility>  // move, pair
+#include <variant>
+#include <vector>
 
 #include "open62541pp/Client.h"
 #include "open62541pp/Common.h"  // MonitoringMode
@@ -22,9 +26,90 @@
 #include "open62541pp/types/Variant.h"
 
 #include "../open62541_impl.h"
+#include "RequestChunking.h"
 
 namespace opcua::services {
 
+/// Invoke `func(offset, count)` for consecutive chunks of at most `limit` items (0 = unlimited).
+template <typename Func>
+static void forEachChunk(size_t total, uint32_t limit, Func&& func) {
+    const size_t chunkSize = limit == 0 ? total : limit;
+    for (size_t offset = 0; offset < total; offset += chunkSize) {
+        func(offset, std::min(chunkSize, total - offset));
+    }
+}
+
+static uint32_t getMonitoredItemsLimit(Client& client) noexcept {
+    return detail::getOperationLimit(client, &OperationLimits::maxMonitoredItemsPerCall);
+}
+
+static MonitoredItemResult createMonitoredItemResult(
+    StatusCode status, uint32_t monitoredItemId, const MonitoringParameters& requested
+) {
+    MonitoredItemResult item;
+    item.statusCode = status;
+    item.monitoredItemId = monitoredItemId;
+    item.parameters = requested;
+    return item;
+}
+
+template <typename Result>
+static MonitoredItemResult toMonitoredItemResult(
+    const Result& result, uint32_t monitoredItemId, const MonitoringParameters& requested
+) {
+    auto item = createMonitoredItemResult(result.statusCode, monitoredItemId, requested);
+    if (result.statusCode == UA_STATUSCODE_GOOD) {
+        detail::reviseMonitoringParameters(item.parameters, result);
+    }
+    return item;
+}
+
+/// Assign a dense client handle to the context of a created monitored item and store it.
+static uint32_t insertMonitoredItemContext(
+    opcua::detail::ClientContext& clientContext,
+    uint32_t subscriptionId,
+    uint32_t monitoredItemId,
+    std::unique_ptr<detail::MonitoredItemContext>&& context
+) {
+    const uint32_t clientHandle = clientContext.monitoredItemHandles.acquire();
+    context->clientHandle = clientHandle;
+    context->handlePool = &clientContext.monitoredItemHandles;
+    clientContext.monitoredItems.insert({subscriptionId, monitoredItemId}, std::move(context));
+    return clientHandle;
+}
+
+/// Record the definition of a created monitored item if subscription recovery is enabled.
+static void recordMonitoredItem(
+    opcua::detail::ClientContext& clientContext,
+    uint32_t subscriptionId,
+    uint32_t monitoredItemId,
+    const ReadValueId& itemToMonitor,
+    MonitoringMode monitoringMode,
+    const MonitoringParameters& parameters,
+    const detail::MonitoredItemContext& context
+) {
+    if (auto& registry = clientContext.subscriptionRegistry) {
+        registry->addMonitoredItem(
+            subscriptionId,
+            monitoredItemId,
+            {itemToMonitor,
+             monitoringMode,
+             parameters,
+             context.notificationCallback,
+             context.deleteCallback}
+        );
+    }
+}
+
+template <typename Func>
+static void updateMonitoredItemRecord(
+    Client& client, uint32_t subscriptionId, uint32_t monitoredItemId, Func&& func
+) {
+    if (auto& registry = opcua::detail::getContext(client).subscriptionRegistry) {
+        registry->updateMonitoredItem(subscriptionId, monitoredItemId, func);
+    }
+}
+
 uint32_t createMonitoredItemDataChange(
     Client& client,
     uint32_t subscriptionId,
@@ -36,8 +121,9 @@ uint32_t createMonitoredItemDataChange(
 ) {
     auto context = std::make_unique<detail::MonitoredItemContext>();
     context->catcher = &opcua::detail::getContext(client).exceptionCatcher;
-    context->itemToMonitor = itemToMonitor;
-    context->dataChangeCallback = std::move(dataChangeCallback);
+    context->nodeId = itemToMonitor.getNodeId();
+    context->attributeId = itemToMonitor.getAttributeId();
+    context->notificationCallback = std::move(dataChangeCallback);
     context->deleteCallback = std::move(deleteCallback);
 
     using Result = TypeWrapper<UA_MonitoredItemCreateResult, UA_TYPES_MONITOREDITEMCREATERESULT>;
@@ -54,12 +140,103 @@ uint32_t createMonitoredItemDataChange(
     detail::reviseMonitoringParameters(parameters, asNative(result));
 
     const auto monitoredItemId = result->monitoredItemId;
-    opcua::detail::getContext(client).monitoredItems.insert(
-        {subscriptionId, monitoredItemId}, std::move(context)
+    auto& clientContext = opcua::detail::getContext(client);
+    recordMonitoredItem(
+        clientContext,
+        subscriptionId,
+        monitoredItemId,
+        itemToMonitor,
+        monitoringMode,
+        parameters,
+        *context
     );
+    insertMonitoredItemContext(clientContext, subscriptionId, monitoredItemId, std::move(context));
     return monitoredItemId;
 }
 
+std::vector<MonitoredItemResult> createMonitoredItemsDataChange(
+    Client& client,
+    uint32_t subscriptionId,
+    Span<const ReadValueId> itemsToMonitor,
+    MonitoringMode monitoringMode,
+    const MonitoringParameters& parameters,
+    DataChangeNotificationCallback dataChangeCallback,
+    DeleteMonitoredItemCallback deleteCallback
+) {
+    auto& clientContext = opcua::detail::getContext(client);
+    std::vector<MonitoredItemResult> results;
+    results.reserve(itemsToMonitor.size());
+
+    const uint32_t limit = getMonitoredItemsLimit(client);
+    forEachChunk(itemsToMonitor.size(), limit, [&](size_t offset, size_t count) {
+        std::vector<UA_MonitoredItemCreateRequest> items;
+        std::vector<std::unique_ptr<detail::MonitoredItemContext>> contexts;
+        std::vector<void*> contextPtrs;
+        items.reserve(count);
+        contexts.reserve(count);
+        contextPtrs.reserve(count);
+        for (const auto& itemToMonitor : itemsToMonitor.subview(offset, count)) {
+            items.push_back(
+                detail::createMonitoredItemCreateRequest(itemToMonitor, monitoringMode, parameters)
+            );
+            auto& context = contexts.emplace_back(std::make_unique<detail::MonitoredItemContext>());
+            context->catcher = &clientContext.exceptionCatcher;
+            context->nodeId = itemToMonitor.getNodeId();
+            context->attributeId = itemToMonitor.getAttributeId();
+            context->notificationCallback = dataChangeCallback;
+            context->deleteCallback = deleteCallback;
+            contextPtrs.push_back(context.get());
+        }
+        std::vector<UA_Client_DataChangeNotificationCallback> callbacks(
+            count, detail::MonitoredItemContext::dataChangeCallbackNativeClient
+        );
+        std::vector<UA_Client_DeleteMonitoredItemCallback> deleteCallbacks(
+            count, detail::MonitoredItemContext::deleteCallbackNative
+        );
+
+        UA_CreateMonitoredItemsRequest request{};
+        request.subscriptionId = subscriptionId;
+        request.timestampsToReturn = static_cast<UA_TimestampsToReturn>(parameters.timestamps);
+        request.itemsToCreateSize = count;
+        request.itemsToCreate = items.data();
+
+        using Response =
+            TypeWrapper<UA_CreateMonitoredItemsResponse, UA_TYPES_CREATEMONITOREDITEMSRESPONSE>;
+        const Response response = UA_Client_MonitoredItems_createDataChanges(
+            client.handle(), request, contextPtrs.data(), callbacks.data(), deleteCallbacks.data()
+        );
+        const UA_StatusCode serviceResult = response->responseHeader.serviceResult;
+        for (size_t i = 0; i < count; ++i) {
+            if (serviceResult != UA_STATUSCODE_GOOD || i >= response->resultsSize) {
+                const StatusCode status = serviceResult != UA_STATUSCODE_GOOD
+                                              ? serviceResult
+                                              : UA_STATUSCODE_BADUNEXPECTEDERROR;
+                results.push_back(createMonitoredItemResult(status, 0U, parameters));
+                continue;
+            }
+            const auto& result = response->results[i];  // NOLINT
+            auto& item = results.emplace_back(
+                toMonitoredItemResult(result, result.monitoredItemId, parameters)
+            );
+            if (result.statusCode == UA_STATUSCODE_GOOD) {
+                recordMonitoredItem(
+                    clientContext,
+                    subscriptionId,
+                    result.monitoredItemId,
+                    itemsToMonitor[offset + i],
+                    monitoringMode,
+                    item.parameters,
+                    *contexts[i]
+                );
+                item.clientHandle = insertMonitoredItemContext(
+                    clientContext, subscriptionId, result.monitoredItemId, std::move(contexts[i])
+                );
+            }
+        }
+    });
+    return results;
+}
+
 uint32_t createMonitoredItemDataChange(
     Server& server,
     const ReadValueId& itemToMonitor,
@@ -69,8 +246,9 @@ uint32_t createMonitoredItemDataChange(
 ) {
     auto context = std::make_unique<detail::MonitoredItemContext>();
     context->catcher = &opcua::detail::getContext(server).exceptionCatcher;
-    context->itemToMonitor = itemToMonitor;
-    context->dataChangeCallback = std::move(dataChangeCallback);
+    context->nodeId = itemToMonitor.getNodeId();
+    context->attributeId = itemToMonitor.getAttributeId();
+    context->notificationCallback = std::move(dataChangeCallback);
 
     using Result = TypeWrapper<UA_MonitoredItemCreateResult, UA_TYPES_MONITOREDITEMCREATERESULT>;
     const Result result = UA_Server_createDataChangeMonitoredItem(
@@ -90,6 +268,79 @@ uint32_t createMonitoredItemDataChange(
     return monitoredItemId;
 }
 
+/// Remove the data change notification group from the server context.
+/// Pending notifications are dropped, the group is kept alive during the delivery.
+static void removeDataChangeNotificationGroup(
+    opcua::detail::ServerContext& serverContext,
+    const opcua::detail::DataChangeNotificationGroup* group
+) {
+    const std::lock_guard lock(serverContext.mutex);
+    auto& groups = serverContext.dataChangeNotificationGroups;
+    groups.erase(
+        std::remove_if(
+            groups.begin(), groups.end(), [&](const auto& item) { return item.get() == group; }
+        ),
+        groups.end()
+    );
+}
+
+std::vector<MonitoredItemResult> createMonitoredItemsDataChange(
+    Server& server,
+    Span<const ReadValueId> itemsToMonitor,
+    MonitoringMode monitoringMode,
+    const MonitoringParameters& parameters,
+    DataChangeBatchCallback dataChangeBatchCallback
+) {
+    auto& serverContext = opcua::detail::getContext(server);
+    auto group = std::make_shared<opcua::detail::DataChangeNotificationGroup>();
+    group->callback = std::move(dataChangeBatchCallback);
+    {
+        const std::lock_guard lock(serverContext.mutex);
+        serverContext.dataChangeNotificationGroups.push_back(group);
+    }
+    // data changes might be sampled outside of the server loop, e.g. by local writes
+    const DataChangeNotificationCallback collect =
+        [&serverContext, group](uint32_t, uint32_t monId, const DataValue& value) {
+            {
+                const std::lock_guard lock(group->mutex);
+                group->pending.push_back({0U, monId, opcua::detail::HandlePool::invalid, value});
+            }
+            serverContext.hasDataChangeNotifications.store(true, std::memory_order_release);
+        };
+
+    std::vector<MonitoredItemResult> results;
+    results.reserve(itemsToMonitor.size());
+    for (const auto& itemToMonitor : itemsToMonitor) {
+        auto context = std::make_unique<detail::MonitoredItemContext>();
+        context->catcher = &serverContext.exceptionCatcher;
+        context->nodeId = itemToMonitor.getNodeId();
+        context->attributeId = itemToMonitor.getAttributeId();
+        context->notificationCallback = collect;
+
+        using Result =
+            TypeWrapper<UA_MonitoredItemCreateResult, UA_TYPES_MONITOREDITEMCREATERESULT>;
+        const Result result = UA_Server_createDataChangeMonitoredItem(
+            server.handle(),
+            static_cast<UA_TimestampsToReturn>(parameters.timestamps),
+            detail::createMonitoredItemCreateRequest(itemToMonitor, monitoringMode, parameters),
+            context.get(),
+            context->dataChangeCallbackNativeServer
+        );
+        results.push_back(
+            toMonitoredItemResult(asNative(result), result->monitoredItemId, parameters)
+        );
+        if (result->statusCode == UA_STATUSCODE_GOOD) {
+            serverContext.monitoredItems.insert({0U, result->monitoredItemId}, std::move(context));
+            const std::lock_guard lock(serverContext.mutex);
+            group->monitoredItemIds.push_back(result->monitoredItemId);
+        }
+    }
+    if (group->monitoredItemIds.empty()) {
+        removeDataChangeNotificationGroup(serverContext, group.get());
+    }
+    return results;
+}
+
 uint32_t createMonitoredItemEvent(
     Client& client,
     uint32_t subscriptionId,
@@ -101,8 +352,9 @@ uint32_t createMonitoredItemEvent(
 ) {
     auto context = std::make_unique<detail::MonitoredItemContext>();
     context->catcher = &opcua::detail::getContext(client).exceptionCatcher;
-    context->itemToMonitor = itemToMonitor;
-    context->eventCallback = std::move(eventCallback);
+    context->nodeId = itemToMonitor.getNodeId();
+    context->attributeId = itemToMonitor.getAttributeId();
+    context->notificationCallback = std::move(eventCallback);
     context->deleteCallback = std::move(deleteCallback);
 
     using Result = TypeWrapper<UA_MonitoredItemCreateResult, UA_TYPES_MONITOREDITEMCREATERESULT>;
@@ -119,9 +371,17 @@ uint32_t createMonitoredItemEvent(
     detail::reviseMonitoringParameters(parameters, asNative(result));
 
     const auto monitoredItemId = result->monitoredItemId;
-    opcua::detail::getContext(client).monitoredItems.insert(
-        {subscriptionId, monitoredItemId}, std::move(context)
+    auto& clientContext = opcua::detail::getContext(client);
+    recordMonitoredItem(
+        clientContext,
+        subscriptionId,
+        monitoredItemId,
+        itemToMonitor,
+        monitoringMode,
+        parameters,
+        *context
     );
+    insertMonitoredItemContext(clientContext, subscriptionId, monitoredItemId, std::move(context));
     return monitoredItemId;
 }
 
@@ -139,6 +399,60 @@ void modifyMonitoredItem(
     auto& result = detail::getSingleResult(asNative(response));
     throwIfBad(result.statusCode);
     detail::reviseMonitoringParameters(parameters, result);
+    updateMonitoredItemRecord(client, subscriptionId, monitoredItemId, [&](auto& record) {
+        record.parameters = parameters;
+    });
+}
+
+std::vector<MonitoredItemResult> modifyMonitoredItems(
+    Client& client,
+    uint32_t subscriptionId,
+    Span<const uint32_t> monitoredItemIds,
+    const MonitoringParameters& parameters
+) {
+    const auto& monitoredItems = opcua::detail::getContext(client).monitoredItems;
+    std::vector<MonitoredItemResult> results;
+    results.reserve(monitoredItemIds.size());
+    const uint32_t limit = getMonitoredItemsLimit(client);
+    forEachChunk(monitoredItemIds.size(), limit, [&](size_t offset, size_t count) {
+        std::vector<UA_MonitoredItemModifyRequest> items;
+        items.reserve(count);
+        for (const auto monitoredItemId : monitoredItemIds.subview(offset, count)) {
+            items.push_back(detail::createMonitoredItemModifyRequest(monitoredItemId, parameters));
+        }
+        UA_ModifyMonitoredItemsRequest request{};
+        request.subscriptionId = subscriptionId;
+        request.timestampsToReturn = static_cast<UA_TimestampsToReturn>(parameters.timestamps);
+        request.itemsToModifySize = count;
+        request.itemsToModify = items.data();
+
+        using Response =
+            TypeWrapper<UA_ModifyMonitoredItemsResponse, UA_TYPES_MODIFYMONITOREDITEMSRESPONSE>;
+        const Response response = UA_Client_MonitoredItems_modify(client.handle(), request);
+        const UA_StatusCode serviceResult = response->responseHeader.serviceResult;
+        for (size_t i = 0; i < count; ++i) {
+            const auto monitoredItemId = items[i].monitoredItemId;
+            if (serviceResult != UA_STATUSCODE_GOOD || i >= response->resultsSize) {
+                const StatusCode status = serviceResult != UA_STATUSCODE_GOOD
+                                              ? serviceResult
+                                              : UA_STATUSCODE_BADUNEXPECTEDERROR;
+                results.push_back(createMonitoredItemResult(status, monitoredItemId, parameters));
+                continue;
+            }
+            auto& item = results.emplace_back(
+                toMonitoredItemResult(response->results[i], monitoredItemId, parameters)  // NOLINT
+            );
+            if (const auto* context = monitoredItems.find({subscriptionId, monitoredItemId})) {
+                item.clientHandle = context->clientHandle;
+            }
+            if (item.statusCode.isGood()) {
+                updateMonitoredItemRecord(client, subscriptionId, monitoredItemId, [&](auto& r) {
+                    r.parameters = item.parameters;
+                });
+            }
+        }
+    });
+    return results;
 }
 
 void setMonitoringMode(
@@ -154,6 +468,41 @@ void setMonitoringMode(
         },
         detail::SyncOperation{}
     );
+    updateMonitoredItemRecord(client, subscriptionId, monitoredItemId, [&](auto& record) {
+        record.monitoringMode = monitoringMode;
+    });
+}
+
+std::vector<StatusCode> setMonitoringMode(
+    Client& client,
+    uint32_t subscriptionId,
+    Span<const uint32_t> monitoredItemIds,
+    MonitoringMode monitoringMode
+) {
+    const auto request =
+        detail::createSetMonitoringModeRequest(subscriptionId, monitoredItemIds, monitoringMode);
+    using Response = TypeWrapper<UA_SetMonitoringModeResponse, UA_TYPES_SETMONITORINGMODERESPONSE>;
+    const Response response = detail::sendChunkedRequest(
+        client,
+        request,
+        getMonitoredItemsLimit(client),
+        &UA_SetMonitoringModeRequest::monitoredItemIdsSize,
+        &UA_SetMonitoringModeRequest::monitoredItemIds,
+        &UA_SetMonitoringModeResponse::resultsSize,
+        &UA_SetMonitoringModeResponse::results
+    );
+    throwIfBad(response->responseHeader.serviceResult);
+    std::vector<StatusCode> results(
+        response->results, response->results + response->resultsSize  // NOLINT
+    );
+    for (size_t i = 0; i < results.size() && i < monitoredItemIds.size(); ++i) {
+        if (results[i].isGood()) {
+            updateMonitoredItemRecord(client, subscriptionId, monitoredItemIds[i], [&](auto& r) {
+                r.monitoringMode = monitoringMode;
+            });
+        }
+    }
+    return results;
 }
 
 void setTriggering(
@@ -181,13 +530,246 @@ void deleteMonitoredItem(Client& client, uint32_t subscriptionId, uint32_t monit
     const auto status = UA_Client_MonitoredItems_deleteSingle(
         client.handle(), subscriptionId, monitoredItemId
     );
+    if (auto& registry = opcua::detail::getContext(client).subscriptionRegistry) {
+        registry->removeMonitoredItem(subscriptionId, monitoredItemId);
+    }
     throwIfBad(status);
 }
 
+std::vector<StatusCode> deleteMonitoredItems(
+    Client& client, uint32_t subscriptionId, Span<const uint32_t> monitoredItemIds
+) {
+    std::vector<StatusCode> results;
+    results.reserve(monitoredItemIds.size());
+    const uint32_t limit = getMonitoredItemsLimit(client);
+    forEachChunk(monitoredItemIds.size(), limit, [&](size_t offset, size_t count) {
+        const auto chunk = monitoredItemIds.subview(offset, count);
+        UA_DeleteMonitoredItemsRequest request{};
+        request.subscriptionId = subscriptionId;
+        request.monitoredItemIdsSize = chunk.size();
+        request.monitoredItemIds = const_cast<uint32_t*>(chunk.data());  // NOLINT
+
+        using Response =
+            TypeWrapper<UA_DeleteMonitoredItemsResponse, UA_TYPES_DELETEMONITOREDITEMSRESPONSE>;
+        const Response response = UA_Client_MonitoredItems_delete(client.handle(), request);
+        const UA_StatusCode serviceResult = response->responseHeader.serviceResult;
+        for (size_t i = 0; i < count; ++i) {
+            if (serviceResult != UA_STATUSCODE_GOOD) {
+                results.emplace_back(serviceResult);
+            } else if (i >= response->resultsSize) {
+                results.emplace_back(UA_STATUSCODE_BADUNEXPECTEDERROR);
+            } else {
+                results.emplace_back(response->results[i]);  // NOLINT
+            }
+        }
+    });
+    if (auto& registry = opcua::detail::getContext(client).subscriptionRegistry) {
+        for (size_t i = 0; i < results.size(); ++i) {
+            if (results[i].isGood()) {
+                registry->removeMonitoredItem(subscriptionId, monitoredItemIds[i]);
+            }
+        }
+    }
+    return results;
+}
+
 void deleteMonitoredItem(Server& server, uint32_t monitoredItemId) {
     const auto status = UA_Server_deleteMonitoredItem(server.handle(), monitoredItemId);
     throwIfBad(status);
-    opcua::detail::getContext(server).monitoredItems.erase({0U, monitoredItemId});
+    auto& serverContext = opcua::detail::getContext(server);
+    serverContext.monitoredItems.erase({0U, monitoredItemId});
+    // remove the notification group of batched data change items with its last item
+    std::shared_ptr<opcua::detail::DataChangeNotificationGroup> emptyGroup;
+    {
+        const std::lock_guard lock(serverContext.mutex);
+        for (const auto& group : serverContext.dataChangeNotificationGroups) {
+            auto& ids = group->monitoredItemIds;
+            const auto it = std::find(ids.begin(), ids.end(), monitoredItemId);
+            if (it != ids.end()) {
+                ids.erase(it);
+                if (ids.empty()) {
+                    emptyGroup = group;
+                }
+                break;
+            }
+        }
+    }
+    if (emptyGroup != nullptr) {
+        removeDataChangeNotificationGroup(serverContext, emptyGroup.get());
+    }
+}
+
+
+/// Recreate the monitored item records of the same kind and timestamps in the new subscription.
+static void recreateMonitoredItems(
+    Client& client,
+    uint32_t subscriptionId,
+    Span<std::pair<uint32_t, opcua::detail::MonitoredItemRecord>*> records,
+    bool events,
+    RecoveredSubscription& recovered
+) {
+    auto& clientContext = opcua::detail::getContext(client);
+    const uint32_t limit = getMonitoredItemsLimit(client);
+    forEachChunk(records.size(), limit, [&](size_t offset, size_t count) {
+        const auto chunk = records.subview(offset, count);
+        std::vector<UA_MonitoredItemCreateRequest> items;
+        std::vector<std::unique_ptr<detail::MonitoredItemContext>> contexts;
+        std::vector<void*> contextPtrs;
+        items.reserve(count);
+        contexts.reserve(count);
+        contextPtrs.reserve(count);
+        for (const auto* entry : chunk) {
+            const auto& record = entry->second;
+            items.push_back(detail::createMonitoredItemCreateRequest(
+                record.itemToMonitor, record.monitoringMode, record.parameters
+            ));
+            auto& context = contexts.emplace_back(std::make_unique<detail::MonitoredItemContext>());
+            context->catcher = &clientContext.exceptionCatcher;
+            context->nodeId = record.itemToMonitor.getNodeId();
+            context->attributeId = record.itemToMonitor.getAttributeId();
+            context->notificationCallback = record.notificationCallback;
+            context->deleteCallback = record.deleteCallback;
+            contextPtrs.push_back(context.get());
+        }
+        std::vector<UA_Client_DeleteMonitoredItemCallback> deleteCallbacks(
+            count, detail::MonitoredItemContext::deleteCallbackNative
+        );
+
+        UA_CreateMonitoredItemsRequest request{};
+        request.subscriptionId = subscriptionId;
+        request.timestampsToReturn =
+            static_cast<UA_TimestampsToReturn>(chunk[0]->second.parameters.timestamps);
+        request.itemsToCreateSize = count;
+        request.itemsToCreate = items.data();
+
+        using Response =
+            TypeWrapper<UA_CreateMonitoredItemsResponse, UA_TYPES_CREATEMONITOREDITEMSRESPONSE>;
+        Response response;
+        if (events) {
+            std::vector<UA_Client_EventNotificationCallback> callbacks(
+                count, detail::MonitoredItemContext::eventCallbackNative
+            );
+            response = UA_Client_MonitoredItems_createEvents(
+                client.handle(),
+                request,
+                contextPtrs.data(),
+                callbacks.data(),
+                deleteCallbacks.data()
+            );
+        } else {
+            std::vector<UA_Client_DataChangeNotificationCallback> callbacks(
+                count, detail::MonitoredItemContext::dataChangeCallbackNativeClient
+            );
+            response = UA_Client_MonitoredItems_createDataChanges(
+                client.handle(),
+                request,
+                contextPtrs.data(),
+                callbacks.data(),
+                deleteCallbacks.data()
+            );
+        }
+        const UA_StatusCode serviceResult = response->responseHeader.serviceResult;
+        for (size_t i = 0; i < count; ++i) {
+            auto& [previousId, record] = *chunk[i];
+            recovered.previousMonitoredItemIds.push_back(previousId);
+            if (serviceResult != UA_STATUSCODE_GOOD || i >= response->resultsSize) {
+                const StatusCode status = serviceResult != UA_STATUSCODE_GOOD
+                                              ? serviceResult
+                                              : UA_STATUSCODE_BADUNEXPECTEDERROR;
+                recovered.monitoredItems.push_back(
+                    createMonitoredItemResult(status, 0U, record.parameters)
+                );
+                continue;
+            }
+            const auto& result = response->results[i];  // NOLINT
+            auto& item = recovered.monitoredItems.emplace_back(
+                toMonitoredItemResult(result, result.monitoredItemId, record.parameters)
+            );
+            if (result.statusCode == UA_STATUSCODE_GOOD) {
+                record.parameters = item.parameters;
+                recordMonitoredItem(
+                    clientContext,
+                    subscriptionId,
+                    result.monitoredItemId,
+                    record.itemToMonitor,
+                    record.monitoringMode,
+                    record.parameters,
+                    *contexts[i]
+                );
+                item.clientHandle = insertMonitoredItemContext(
+                    clientContext, subscriptionId, result.monitoredItemId, std::move(contexts[i])
+                );
+            }
+        }
+    });
+}
+
+std::vector<RecoveredSubscription> recoverSubscriptions(Client& client) {
+    auto& clientContext = opcua::detail::getContext(client);
+    auto& registry = clientContext.subscriptionRegistry;
+    if (!registry) {
+        return {};
+    }
+    auto lost = registry->takeLost([&](uint32_t subId) {
+        const auto* context = clientContext.subscriptions.find(subId);
+        return context == nullptr || context->stale;
+    });
+
+    std::vector<RecoveredSubscription> results;
+    results.reserve(lost.size());
+    for (auto& [previousId, record] : lost) {
+        auto& recovered = results.emplace_back();
+        recovered.previousSubscriptionId = previousId;
+        try {
+            recovered.subscriptionId = createSubscription(
+                client,
+                record.parameters,
+                record.publishingEnabled,
+                record.deleteCallback,
+                record.batchCallback
+            );
+        } catch (const BadStatus& e) {
+            recovered.statusCode = e.code();
+            registry->addSubscription(previousId, std::move(record));  // retry on next call
+            continue;
+        }
+
+        // group the items by kind and timestamps, each group is created with batched requests
+        using Entry = std::pair<uint32_t, opcua::detail::MonitoredItemRecord>;
+        std::vector<Entry> items(
+            std::make_move_iterator(record.monitoredItems.begin()),
+            std::make_move_iterator(record.monitoredItems.end())
+        );
+        const auto groupKey = [](const Entry* entry) {
+            using EventCallback = detail::MonitoredItemContext::EventCallback;
+            const bool isEvent =
+                std::holds_alternative<EventCallback>(entry->second.notificationCallback);
+            return std::pair(isEvent, entry->second.parameters.timestamps);
+        };
+        std::vector<Entry*> entries;
+        entries.reserve(items.size());
+        for (auto& entry : items) {
+            entries.push_back(&entry);
+        }
+        std::stable_sort(entries.begin(), entries.end(), [&](const Entry* lhs, const Entry* rhs) {
+            return groupKey(lhs) < groupKey(rhs);
+        });
+        for (size_t begin = 0; begin < entries.size();) {
+            size_t end = begin + 1;
+            while (end < entries.size() && groupKey(entries[end]) == groupKey(entries[begin])) {
+                ++end;
+            }
+            recreateMonitoredItems(
+                client,
+                recovered.subscriptionId,
+                Span<Entry*>(entries).subview(begin, end - begin),
+                groupKey(entries[begin]).first,
+                recovered
+            );
+            begin = end;
+        }
+    }
+    return results;
 }
 
 }  // namespace opcua::services
@@ -1,6 +1,9 @@
 #include "open62541pp/services/NodeManagement.h"
 
+#include <algorithm>  // any_of, remove_if
 #include <cassert>
+#include <unordered_set>
+#include <vector>
 
 #include "open62541pp/ErrorHandling.h"
 #include "open62541pp/Server.h"
@@ -8,25 +11,60 @@
 #include "open62541pp/detail/Result.h"  // tryInvoke
 #include "open62541pp/detail/ServerContext.h"
 #include "open62541pp/detail/helper.h"
+#include "open62541pp/services/View.h"
 
+#include "../CustomAccessControl.h"  // SessionScope
 #include "../open62541_impl.h"
+#include "RequestChunking.h"
 
 namespace opcua::services {
 
 AddNodesResponse addNodes(Client& client, const AddNodesRequest& request) {
-    return addNodesAsync(client, request, detail::SyncOperation{});
+    return detail::sendChunkedRequest(
+        client,
+        *request.handle(),
+        detail::getOperationLimit(client, &OperationLimits::maxNodesPerNodeManagement),
+        &UA_AddNodesRequest::nodesToAddSize,
+        &UA_AddNodesRequest::nodesToAdd,
+        &UA_AddNodesResponse::resultsSize,
+        &UA_AddNodesResponse::results
+    );
 }
 
 AddReferencesResponse addReferences(Client& client, const AddReferencesRequest& request) {
-    return addReferencesAsync(client, request, detail::SyncOperation{});
+    return detail::sendChunkedRequest(
+        client,
+        *request.handle(),
+        detail::getOperationLimit(client, &OperationLimits::maxNodesPerNodeManagement),
+        &UA_AddReferencesRequest::referencesToAddSize,
+        &UA_AddReferencesRequest::referencesToAdd,
+        &UA_AddReferencesResponse::resultsSize,
+        &UA_AddReferencesResponse::results
+    );
 }
 
 DeleteNodesResponse deleteNodes(Client& client, const DeleteNodesRequest& request) {
-    return deleteNodesAsync(client, request, detail::SyncOperation{});
+    return detail::sendChunkedRequest(
+        client,
+        *request.handle(),
+        detail::getOperationLimit(client, &OperationLimits::maxNodesPerNodeManagement),
+        &UA_DeleteNodesRequest::nodesToDeleteSize,
+        &UA_DeleteNodesRequest::nodesToDelete,
+        &UA_DeleteNodesResponse::resultsSize,
+        &UA_DeleteNodesResponse::results
+    );
 }
 
 DeleteReferencesResponse deleteReferences(Client& client, const DeleteReferencesRequest& request) {
-    return deleteReferencesAsync(client, request, detail::SyncOperation{});
+    return detail::sendChunkedRequest(
+        client,
+        *request.handle(),
+        detail::getOperationLimit(client, &OperationLimits::maxNodesPerNodeManagement),
+        &UA_DeleteReferencesRequest::referencesToDeleteSize,
+        &UA_DeleteReferencesRequest::referencesToDelete,
+        &UA_DeleteReferencesResponse::resultsSize,
+        &UA_DeleteReferencesResponse::results
+    );
 }
 
 template <>
@@ -54,6 +92,7 @@ NodeId addNode<Server>(
         nullptr,  // nodeContext
         addedNodeId.handle()
     );
+    opcua::detail::getContext(server).notifyAddressSpaceChange();
     throwIfBad(status);
     return addedNodeId;
 }
@@ -85,9 +124,9 @@ NodeId addNode<Client>(
 #ifdef UA_ENABLE_METHODCALLS
 
 static UA_StatusCode methodCallback(
-    [[maybe_unused]] UA_Server* server,
+    UA_Server* server,
     [[maybe_unused]] const UA_NodeId* sessionId,
-    [[maybe_unused]] void* sessionContext,
+    void* sessionContext,
     [[maybe_unused]] const UA_NodeId* methodId,
     void* methodContext,
     [[maybe_unused]] const UA_NodeId* objectId,
@@ -98,11 +137,19 @@ static UA_StatusCode methodCallback(
     UA_Variant* output
 ) noexcept {
     assert(methodContext != nullptr);
-    const auto* nodeContext = static_cast<opcua::detail::NodeContext*>(methodContext);
-    const auto& callback = nodeContext->methodCallback;
-    if (callback) {
+    if (const auto status = opcua::detail::admitOperation(server, sessionContext, false);
+        status != UA_STATUSCODE_GOOD) {
+        return status;
+    }
+    const opcua::detail::SessionScope scope(server, sessionContext);
+    const opcua::detail::CallbackTimer timer(
+        opcua::detail::getMetricsRecorder(server), MetricsCallback::Method
+    );
+    auto* nodeContext = static_cast<opcua::detail::NodeContext*>(methodContext);
+    const auto* callback = nodeContext->methodCallback();
+    if (callback != nullptr && *callback) {
         return opcua::detail::tryInvokeGetStatus(
-            callback,
+            *callback,
             Span<const Variant>{asWrapper<Variant>(input), inputSize},
             Span<Variant>{asWrapper<Variant>(output), outputSize}
         );
@@ -123,7 +170,7 @@ NodeId addMethod(
     const NodeId& referenceType
 ) {
     auto* nodeContext = opcua::detail::getContext(server).nodeContexts[id];
-    nodeContext->methodCallback = std::move(callback);
+    nodeContext->setMethodCallback(std::move(callback));
     NodeId outputNodeId;
     const auto status = UA_Server_addMethodNode(
         server.handle(),
@@ -140,6 +187,7 @@ NodeId addMethod(
         nodeContext,
         outputNodeId.handle()  // outNewNodeId
     );
+    opcua::detail::getContext(server).notifyAddressSpaceChange();
     throwIfBad(status);
     return outputNodeId;
 }
@@ -186,6 +234,7 @@ void addReference<Server>(
         {targetId, {}, 0},
         forward  // isForward
     );
+    opcua::detail::getContext(server).notifyAddressSpaceChange();
     throwIfBad(status);
 }
 
@@ -205,6 +254,7 @@ void addReference<Client>(
 template <>
 void deleteNode<Server>(Server& server, const NodeId& id, bool deleteReferences) {
     const auto status = UA_Server_deleteNode(server.handle(), id, deleteReferences);
+    opcua::detail::getContext(server).notifyAddressSpaceChange();
     throwIfBad(status);
 }
 
@@ -213,6 +263,91 @@ void deleteNode<Client>(Client& client, const NodeId& id, bool deleteReferences)
     return deleteNodeAsync(client, id, deleteReferences, detail::SyncOperation{});
 }
 
+size_t deleteSubtree(Server& server, const NodeId& rootId) {
+    const auto descendants = browseRecursive(
+        server,
+        BrowseDescription(
+            rootId,
+            BrowseDirection::Forward,
+            ReferenceTypeId::HierarchicalReferences,
+            true,
+            NodeClass::Unspecified,
+            BrowseResultMask::None
+        )
+    );
+    std::vector<NodeId> ids;
+    ids.reserve(descendants.size() + 1);
+    ids.push_back(rootId);
+    std::unordered_set<NodeId> subtree{rootId};
+    for (const auto& target : descendants) {
+        if (target.isLocal() && target.getNodeId().getNamespaceIndex() != 0 &&
+            subtree.insert(target.getNodeId()).second) {
+            ids.push_back(target.getNodeId());
+        }
+    }
+
+    // keep nodes with a hierarchical parent outside of the subtree (e.g. shared by Organizes) and
+    // their descendants, repeated until no more nodes are excluded
+    std::vector<std::vector<NodeId>> parents(ids.size());
+    for (size_t i = 1; i < ids.size(); ++i) {
+        const auto result = browse(
+            server,
+            BrowseDescription(
+                ids[i],
+                BrowseDirection::Inverse,
+                ReferenceTypeId::HierarchicalReferences,
+                true,
+                NodeClass::Unspecified,
+                BrowseResultMask::None
+            )
+        );
+        for (const auto& ref : result.getReferences()) {
+            parents[i].push_back(ref.getNodeId().getNodeId());
+        }
+    }
+    for (bool excluded = true; excluded;) {
+        excluded = false;
+        for (size_t i = 1; i < ids.size(); ++i) {
+            if (subtree.count(ids[i]) == 0) {
+                continue;
+            }
+            const bool shared = std::any_of(
+                parents[i].begin(),
+                parents[i].end(),
+                [&](const NodeId& parentId) { return subtree.count(parentId) == 0; }
+            );
+            if (shared) {
+                subtree.erase(ids[i]);
+                excluded = true;
+            }
+        }
+    }
+    ids.erase(
+        std::remove_if(
+            ids.begin(), ids.end(), [&](const NodeId& id) { return subtree.count(id) == 0; }
+        ),
+        ids.end()
+    );
+
+    // reverse discovery order: children before their parents, the root node last
+    std::vector<NodeId> deleted;
+    deleted.reserve(ids.size());
+    StatusCode error;
+    for (auto it = ids.rbegin(); it != ids.rend(); ++it) {
+        const StatusCode status = UA_Server_deleteNode(server.handle(), *it->handle(), true);
+        if (status.isGood()) {
+            deleted.push_back(*it);
+        } else if (error.isGood() && (status != UA_STATUSCODE_BADNODEIDUNKNOWN || *it == rootId)) {
+            error = status;  // unknown descendants might be removed with their parent already
+        }
+    }
+    auto& context = opcua::detail::getContext(server);
+    context.nodeContexts.erase(deleted.begin(), deleted.end());
+    context.notifyAddressSpaceChange();
+    throwIfBad(error);
+    return deleted.size();
+}
+
 template <>
 void deleteReference<Server>(
     Server& server,
@@ -225,6 +360,7 @@ void deleteReference<Server>(
     const auto status = UA_Server_deleteReference(
         server.handle(), sourceId, referenceType, isForward, {targetId, {}, 0}, deleteBidirectional
     );
+    opcua::detail::getContext(server).notifyAddressSpaceChange();
     throwIfBad(status);
 }
 
@@ -0,0 +1,460 @@
+#include "open62541pp/services/Query.h"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+#include <cstdint>
+#include <cstring>  // memcpy
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <utility>  // as_const, move, pair
+#include <vector>
+
+#include "open62541pp/AddressSpaceIndex.h"
+#include "open62541pp/Client.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/TypeWrapper.h"
+#include "open62541pp/detail/ScopeExit.h"
+#include "open62541pp/detail/ServerContext.h"
+#include "open62541pp/detail/helper.h"
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/ExtensionObject.h"
+#include "open62541pp/types/Variant.h"
+
+#include "../open62541_impl.h"
+#include "ContentFilter.h"
+
+namespace opcua::detail {
+
+/// Open continuation points of local queries, oldest first.
+struct QueryState {
+    struct Cursor {
+        QueryFirstRequest request;
+        std::vector<std::pair<size_t, NodeId>> candidates;  // node type index, node id
+        size_t next = 0;
+    };
+
+    static constexpr size_t maxContinuationPoints = 16;
+
+    std::mutex mutex;
+    uint64_t lastId = 0;
+    std::deque<std::pair<ByteString, Cursor>> cursors;
+};
+
+}  // namespace opcua::detail
+
+namespace opcua::services {
+
+QueryFirstResponse queryFirst(Client& connection, const QueryFirstRequest& request) {
+    return queryFirstAsync(connection, request, detail::SyncOperation{});
+}
+
+QueryNextResponse queryNext(Client& connection, const QueryNextRequest& request) {
+    return queryNextAsync(connection, request, detail::SyncOperation{});
+}
+
+namespace {
+
+using QueryCursor = opcua::detail::QueryState::Cursor;
+
+using detail::compare;
+using detail::matchLike;
+using detail::readTypeDefinition;
+using detail::resolvePath;
+using detail::toRelativePath;
+using detail::toText;
+using detail::validateElement;
+
+/* ------------------------------------------ Operands ------------------------------------------ */
+
+DataValue readRelative(
+    Server& server,
+    const NodeId& id,
+    const RelativePath& path,
+    AttributeId attributeId,
+    std::string_view indexRange
+) {
+    const auto target = resolvePath(server, id, path);
+    if (!target.has_value()) {
+        DataValue dv;
+        dv->hasStatus = true;
+        dv->status = UA_STATUSCODE_BADNOMATCH;
+        return dv;
+    }
+    const ReadValueId rv(*target, attributeId, indexRange);
+    return UA_Server_read(server.handle(), rv.handle(), UA_TIMESTAMPSTORETURN_NEITHER);
+}
+
+/* ------------------------------------------- Filter ------------------------------------------- */
+
+/// Evaluates a validated content filter for a node, NULL results are represented as nullopt.
+class FilterEvaluator {
+public:
+    FilterEvaluator(Server& server, Span<const ContentFilterElement> elements, const NodeId& id)
+        : server_(server),
+          elements_(elements),
+          id_(id) {}
+
+    bool matches() {
+        return elements_.empty() || evaluate(0).value_or(false);
+    }
+
+private:
+    std::optional<bool> evaluate(size_t index) {
+        const auto& element = elements_[index];
+        const auto operands = element.getFilterOperands();
+        switch (element.getFilterOperator()) {
+        case FilterOperator::Equals:
+            return compareOperands(operands, [](int r) { return r == 0; });
+        case FilterOperator::IsNull:
+            return resolve(operands[0]).isEmpty();
+        case FilterOperator::GreaterThan:
+            return compareOperands(operands, [](int r) { return r > 0; });
+        case FilterOperator::LessThan:
+            return compareOperands(operands, [](int r) { return r < 0; });
+        case FilterOperator::GreaterThanOrEqual:
+            return compareOperands(operands, [](int r) { return r >= 0; });
+        case FilterOperator::LessThanOrEqual:
+            return compareOperands(operands, [](int r) { return r <= 0; });
+        case FilterOperator::Like: {
+            const auto value = resolve(operands[0]);
+            const auto pattern = resolve(operands[1]);
+            const auto text = toText(value);
+            const auto patternText = toText(pattern);
+            if (!text || !patternText) {
+                return std::nullopt;
+            }
+            return matchLike(*text, *patternText);
+        }
+        case FilterOperator::Not: {
+            const auto value = toBool(resolve(operands[0]));
+            return value ? std::optional(!*value) : std::nullopt;
+        }
+        case FilterOperator::Between: {
+            const auto value = resolve(operands[0]);
+            const auto lower = compare(value, resolve(operands[1]));
+            const auto upper = compare(value, resolve(operands[2]));
+            if (!lower || !upper) {
+                return std::nullopt;
+            }
+            return *lower >= 0 && *upper <= 0;
+        }
+        case FilterOperator::InList: {
+            const auto value = resolve(operands[0]);
+            for (size_t i = 1; i < operands.size(); ++i) {
+                if (compare(value, resolve(operands[i])) == 0) {
+                    return true;
+                }
+            }
+            return false;
+        }
+        case FilterOperator::And: {
+            const auto lhs = toBool(resolve(operands[0]));
+            if (lhs == false) {
+                return false;
+            }
+            const auto rhs = toBool(resolve(operands[1]));
+            if (rhs == false) {
+                return false;
+            }
+            return (lhs && rhs) ? std::optional(true) : std::nullopt;
+        }
+        case FilterOperator::Or: {
+            const auto lhs = toBool(resolve(operands[0]));
+            if (lhs == true) {
+                return true;
+            }
+            const auto rhs = toBool(resolve(operands[1]));
+            if (rhs == true) {
+                return true;
+            }
+            return (lhs && rhs) ? std::optional(false) : std::nullopt;
+        }
+        case FilterOperator::OfType: {
+            const auto& type = operands[0].getDecodedData<LiteralOperand>()->getValue();
+            const auto typeDefinition = readTypeDefinition(server_, id_);
+            return !typeDefinition.isNull() &&
+                   server_.getAddressSpaceIndex().isInSubtree(
+                       typeDefinition, type.getScalar<NodeId>()
+                   );
+        }
+        default:
+            return std::nullopt;  // rejected by validateElement
+        }
+    }
+
+    template <typename Predicate>
+    std::optional<bool> compareOperands(Span<const ExtensionObject> operands, Predicate&& pred) {
+        const auto result = compare(resolve(operands[0]), resolve(operands[1]));
+        return result ? std::optional(pred(*result)) : std::nullopt;
+    }
+
+    static std::optional<bool> toBool(const Variant& value) {
+        if (value.isScalar() && value.isType<bool>()) {
+            return value.getScalar<bool>();
+        }
+        return std::nullopt;
+    }
+
+    Variant resolve(const ExtensionObject& operand) {
+        if (const auto* op = operand.getDecodedData<LiteralOperand>()) {
+            return op->getValue();
+        }
+        if (const auto* op = operand.getDecodedData<ElementOperand>()) {
+            const auto result = evaluate(op->getIndex());
+            return result ? Variant::fromScalar(*result) : Variant();
+        }
+        DataValue dv;
+        if (const auto* op = operand.getDecodedData<SimpleAttributeOperand>()) {
+            dv = readRelative(
+                server_,
+                id_,
+                toRelativePath(op->getBrowsePath()),
+                op->getAttributeId(),
+                op->getIndexRange().get()
+            );
+        } else if (const auto* op = operand.getDecodedData<AttributeOperand>()) {
+            dv = readRelative(
+                server_, id_, op->getBrowsePath(), op->getAttributeId(), op->getIndexRange().get()
+            );
+        }
+        if (dv.getStatus().isBad()) {
+            return {};
+        }
+        return std::move(dv.getValue());
+    }
+
+    Server& server_;
+    Span<const ContentFilterElement> elements_;
+    const NodeId& id_;
+};
+
+/* ------------------------------------------ Results ------------------------------------------- */
+
+template <typename T, typename Native>
+void moveArray(std::vector<T>& src, Native*& dst, size_t& dstSize) {
+    dst = opcua::detail::allocateArray<Native>(src.size(), getDataType<T>());
+    dstSize = src.size();
+    for (size_t i = 0; i < src.size(); ++i) {
+        asWrapper<T>(dst[i]) = std::move(src[i]);  // NOLINT
+    }
+}
+
+QueryDataSet makeDataSet(Server& server, const NodeTypeDescription& nodeType, const NodeId& id) {
+    std::vector<Variant> values;
+    for (const auto& description : nodeType.getDataToReturn()) {
+        auto dv = readRelative(
+            server,
+            id,
+            description.getRelativePath(),
+            description.getAttributeId(),
+            description.getIndexRange().get()
+        );
+        if (dv.getStatus().isBad()) {
+            values.push_back(
+                Variant::fromScalar(dv.getStatus().get(), UA_TYPES[UA_TYPES_STATUSCODE])
+            );
+        } else {
+            values.push_back(std::move(dv.getValue()));
+        }
+    }
+    QueryDataSet dataSet;
+    dataSet.getNodeId() = ExpandedNodeId(id);
+    dataSet.getTypeDefinitionNode() = ExpandedNodeId(readTypeDefinition(server, id));
+    moveArray(values, dataSet->values, dataSet->valuesSize);
+    return dataSet;
+}
+
+std::vector<QueryDataSet> nextDataSets(Server& server, QueryCursor& cursor) {
+    const auto& request = std::as_const(cursor.request);
+    const auto nodeTypes = request.getNodeTypes();
+    const auto elements = request.getFilter().getElements();
+    const uint32_t limit = request.getMaxDataSetsToReturn();
+    std::vector<QueryDataSet> dataSets;
+    while (cursor.next < cursor.candidates.size() && (limit == 0 || dataSets.size() < limit)) {
+        const auto& [nodeTypeIndex, id] = cursor.candidates[cursor.next++];
+        if (FilterEvaluator(server, elements, id).matches()) {
+            dataSets.push_back(makeDataSet(server, nodeTypes[nodeTypeIndex], id));
+        }
+    }
+    return dataSets;
+}
+
+opcua::detail::QueryState& getQueryState(Server& server) {
+    auto& context = opcua::detail::getContext(server);
+    const std::lock_guard lock(context.mutex);
+    if (context.queryState == nullptr) {
+        context.queryState = std::make_shared<opcua::detail::QueryState>();
+    }
+    return *context.queryState;
+}
+
+/// Store the cursor if candidates are left and return its continuation point.
+ByteString storeCursor(Server& server, QueryCursor&& cursor) {
+    if (cursor.next >= cursor.candidates.size()) {
+        return {};
+    }
+    auto& state = getQueryState(server);
+    const std::lock_guard lock(state.mutex);
+    const uint64_t id = ++state.lastId;
+    ByteString continuationPoint;
+    continuationPoint->data = opcua::detail::allocateArray<UA_Byte>(
+        sizeof(id), UA_TYPES[UA_TYPES_BYTE]
+    );
+    continuationPoint->length = sizeof(id);
+    std::memcpy(continuationPoint->data, &id, sizeof(id));
+    if (state.cursors.size() >= opcua::detail::QueryState::maxContinuationPoints) {
+        state.cursors.pop_front();
+    }
+    state.cursors.emplace_back(continuationPoint, std::move(cursor));
+    return continuationPoint;
+}
+
+std::optional<QueryCursor> takeCursor(Server& server, const ByteString& continuationPoint) {
+    auto& state = getQueryState(server);
+    const std::lock_guard lock(state.mutex);
+    for (auto it = state.cursors.begin(); it != state.cursors.end(); ++it) {
+        if (it->first == continuationPoint) {
+            auto cursor = std::move(it->second);
+            state.cursors.erase(it);
+            return cursor;
+        }
+    }
+    return std::nullopt;
+}
+
+}  // namespace
+
+QueryFirstResponse queryFirst(Server& connection, const QueryFirstRequest& request) {
+    QueryFirstResponse response;
+    auto& serviceResult = response->responseHeader.serviceResult;
+    const auto nodeTypes = request.getNodeTypes();
+    if (nodeTypes.empty()) {
+        serviceResult = UA_STATUSCODE_BADNOTHINGTODO;
+        return response;
+    }
+
+    // validate the filter
+    const auto elements = request.getFilter().getElements();
+    std::vector<StatusCode> elementStatus(elements.size());
+    bool filterValid = true;
+    for (size_t i = 0; i < elements.size(); ++i) {
+        elementStatus[i] = validateElement(elements, i);
+        filterValid &= elementStatus[i].isGood();
+    }
+    if (!filterValid) {
+        auto& filterResult = response->filterResult;
+        filterResult.elementResults = opcua::detail::allocateArray<UA_ContentFilterElementResult>(
+            elements.size(), UA_TYPES[UA_TYPES_CONTENTFILTERELEMENTRESULT]
+        );
+        filterResult.elementResultsSize = elements.size();
+        for (size_t i = 0; i < elements.size(); ++i) {
+            filterResult.elementResults[i].statusCode = elementStatus[i];  // NOLINT
+        }
+        serviceResult = UA_STATUSCODE_BADCONTENTFILTERINVALID;
+        return response;
+    }
+
+    // collect the candidates with the address space index
+    auto& index = connection.getAddressSpaceIndex();
+    const auto& viewId = request.getView().getViewId();
+    const NodeId rootId = viewId.isNull() ? NodeId(ObjectId::RootFolder) : viewId;
+    if (!index.contains(rootId)) {
+        serviceResult = UA_STATUSCODE_BADVIEWIDUNKNOWN;
+        return response;
+    }
+    QueryCursor cursor{request, {}, 0};
+    std::vector<ParsingResult> parsingResults(nodeTypes.size());
+    bool parsingValid = true;
+    for (size_t i = 0; i < nodeTypes.size(); ++i) {
+        const auto& nodeType = nodeTypes[i];
+        const auto& type = nodeType.getTypeDefinitionNode();
+        if (!type.isLocal() || !index.contains(type.getNodeId())) {
+            parsingResults[i]->statusCode = UA_STATUSCODE_BADNODEIDUNKNOWN;
+            parsingValid = false;
+            continue;
+        }
+        for (auto& id : index.findByTypeDefinition(
+                 type.getNodeId(), rootId, nodeType.getIncludeSubTypes()
+             )) {
+            cursor.candidates.emplace_back(i, std::move(id));
+        }
+    }
+    if (!parsingValid) {
+        moveArray(parsingResults, response->parsingResults, response->parsingResultsSize);
+        serviceResult = UA_STATUSCODE_BADINVALIDARGUMENT;
+        return response;
+    }
+
+    auto dataSets = nextDataSets(connection, cursor);
+    moveArray(dataSets, response->queryDataSets, response->queryDataSetsSize);
+    response.getContinuationPoint() = storeCursor(connection, std::move(cursor));
+    return response;
+}
+
+QueryNextResponse queryNext(Server& connection, const QueryNextRequest& request) {
+    QueryNextResponse response;
+    auto cursor = takeCursor(connection, request.getContinuationPoint());
+    if (!cursor.has_value()) {
+        response->responseHeader.serviceResult = UA_STATUSCODE_BADCONTINUATIONPOINTINVALID;
+        return response;
+    }
+    if (request.getReleaseContinuationPoint()) {
+        return response;
+    }
+    auto dataSets = nextDataSets(connection, *cursor);
+    moveArray(dataSets, response->queryDataSets, response->queryDataSetsSize);
+    response.getRevisedContinuationPoint() = storeCursor(connection, std::move(*cursor));
+    return response;
+}
+
+template <typename T>
+size_t queryAll(
+    T& connection, const QueryFirstRequest& request, const QueryDataSetCallback& callback
+) {
+    ByteString continuationPoint;
+    // release the continuation point if the callback throws
+    const auto releaseOnExit = opcua::detail::ScopeExit([&]() noexcept {
+        if (continuationPoint.empty()) {
+            return;
+        }
+        try {
+            queryNext(connection, QueryNextRequest({}, true, continuationPoint));
+        } catch (...) {  // NOLINT(bugprone-empty-catch)
+        }
+    });
+    size_t count = 0;
+    const auto process = [&](Span<QueryDataSet> dataSets) {
+        for (auto& dataSet : dataSets) {
+            callback(dataSet);
+            ++count;
+        }
+    };
+
+    auto first = queryFirst(connection, request);
+    throwIfBad(first.getResponseHeader().getServiceResult());
+    for (const auto& result : first.getParsingResults()) {
+        throwIfBad(result.getStatusCode());
+    }
+    continuationPoint = std::move(first.getContinuationPoint());
+    process(first.getQueryDataSets());
+    while (!continuationPoint.empty()) {
+        auto next = queryNext(connection, QueryNextRequest({}, false, continuationPoint));
+        continuationPoint = {};  // consumed by the request
+        throwIfBad(next.getResponseHeader().getServiceResult());
+        continuationPoint = std::move(next.getRevisedContinuationPoint());
+        process(next.getQueryDataSets());
+    }
+    return count;
+}
+
+// explicit template instantiation
+template size_t queryAll<Server>(Server&, const QueryFirstRequest&, const QueryDataSetCallback&);
+template size_t queryAll<Client>(Client&, const QueryFirstRequest&, const QueryDataSetCallback&);
+
+}  // namespace opcua::services
+
+#endif
@@ -0,0 +1,215 @@
+#pragma once
+
+#include <algorithm>  // min
+#include <cstddef>
+#include <cstdint>
+#include <cstring>  // memcpy
+#include <memory>
+#include <utility>  // exchange
+#include <vector>
+
+#include "open62541pp/Client.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/TypeRegistry.h"
+#include "open62541pp/detail/helper.h"  // clear
+#include "open62541pp/open62541.h"
+
+namespace opcua::services::detail {
+
+/// Maximum number of chunks of a request, that are sent at a time.
+inline constexpr size_t maxChunksInFlight = 4;
+
+/// Get an operation limit of the connected server, 0 if unlimited or unknown.
+inline uint32_t getOperationLimit(Client& client, uint32_t OperationLimits::*limit) noexcept {
+    try {
+        return client.getOperationLimits().*limit;
+    } catch (...) {
+        return 0;
+    }
+}
+
+template <typename Response>
+struct ChunkState {
+    explicit ChunkState(size_t count)
+        : responses(count),
+          received(count, false) {}
+
+    ~ChunkState() {
+        for (auto& response : responses) {
+            opcua::detail::clear(response, getDataType<Response>());
+        }
+    }
+
+    ChunkState(const ChunkState&) = delete;
+    ChunkState(ChunkState&&) noexcept = delete;
+    ChunkState& operator=(const ChunkState&) = delete;
+    ChunkState& operator=(ChunkState&&) noexcept = delete;
+
+    std::vector<Response> responses;
+    std::vector<bool> received;
+    size_t completed = 0;
+};
+
+/// Set the status code of a result of a failed chunk.
+inline void setResultStatus(UA_StatusCode& result, UA_StatusCode status) noexcept {
+    result = status;
+}
+
+inline void setResultStatus(UA_DataValue& result, UA_StatusCode status) noexcept {
+    result.hasStatus = true;
+    result.status = status;
+}
+
+template <typename Result>
+inline void setResultStatus(Result& result, UA_StatusCode status) noexcept {
+    result.statusCode = status;
+}
+
+template <typename Response>
+struct ChunkCallbackData {
+    std::shared_ptr<ChunkState<Response>> state;  // shared, callbacks may outlive the request
+    size_t index;
+};
+
+/**
+ * Send a request and split it into multiple requests if the number of items exceeds `limit`.
+ *
+ * Up to `maxChunksInFlight` chunks are sent at a time and the client is iterated until all
+ * responses are received. The results are reassembled in the order of the request items.
+ * The items of failed chunks (bad service result, unexpected number of results, not sent or not
+ * received) get results with the bad status code of the chunk, the results of the other chunks
+ * are kept. The response header is taken from the first successful chunk, or from the first
+ * failed chunk if all chunks failed (without results).
+ * The returned native response is owned by the caller.
+ */
+template <typename Request, typename Response, typename Item, typename Result>
+Response sendChunkedRequest(
+    Client& client,
+    const Request& request,
+    uint32_t limit,
+    size_t Request::*itemsSize,
+    Item* Request::*items,
+    size_t Response::*resultsSize,
+    Result* Response::*results
+) {
+    Response response{};
+    const size_t total = request.*itemsSize;
+    if (limit == 0 || total <= limit) {
+        __UA_Client_Service(
+            client.handle(), &request, &getDataType<Request>(), &response, &getDataType<Response>()
+        );
+        return response;
+    }
+
+    const size_t chunkCount = (total + limit - 1) / limit;
+    auto state = std::make_shared<ChunkState<Response>>(chunkCount);
+    auto callback = [](UA_Client*, void* userdata, uint32_t /* reqId */, void* responsePtr) {
+        std::unique_ptr<ChunkCallbackData<Response>> data{
+            static_cast<ChunkCallbackData<Response>*>(userdata)
+        };
+        auto& chunkResponse = data->state->responses.at(data->index);
+        if (responsePtr != nullptr) {
+            chunkResponse = std::exchange(*static_cast<Response*>(responsePtr), {});
+        } else {
+            chunkResponse.responseHeader.serviceResult = UA_STATUSCODE_BADUNEXPECTEDERROR;
+        }
+        data->state->received[data->index] = true;
+        ++data->state->completed;
+    };
+
+    UA_StatusCode status = UA_STATUSCODE_GOOD;
+    size_t sent = 0;
+    while (state->completed < chunkCount) {
+        while (status == UA_STATUSCODE_GOOD && sent < chunkCount &&
+               sent - state->completed < maxChunksInFlight) {
+            const size_t offset = sent * limit;
+            Request chunk = request;  // shallow copy, items are shared with the original request
+            chunk.*items = request.*items + offset;  // NOLINT
+            chunk.*itemsSize = std::min<size_t>(limit, total - offset);
+            auto data = std::make_unique<ChunkCallbackData<Response>>(
+                ChunkCallbackData<Response>{state, sent}
+            );
+            status = __UA_Client_AsyncService(
+                client.handle(),
+                &chunk,
+                &getDataType<Request>(),
+                callback,
+                &getDataType<Response>(),
+                data.get(),
+                nullptr
+            );
+            if (status == UA_STATUSCODE_GOOD) {
+                data.release();  // NOLINT, ownership transferred to callback
+                ++sent;
+            }
+        }
+        if (state->completed == sent && status != UA_STATUSCODE_GOOD) {
+            break;  // nothing in flight anymore
+        }
+        const UA_StatusCode iterateStatus = UA_Client_run_iterate(client.handle(), 10);
+        if (iterateStatus != UA_STATUSCODE_GOOD) {
+            status = iterateStatus;
+            break;  // pending callbacks keep the shared state alive
+        }
+    }
+
+    // status of the chunks, bad if the chunk failed
+    const auto getChunkStatus = [&](size_t index) -> UA_StatusCode {
+        if (!state->received[index]) {
+            return status != UA_STATUSCODE_GOOD ? status : UA_STATUSCODE_BADUNEXPECTEDERROR;
+        }
+        const auto& chunkResponse = state->responses[index];
+        if (chunkResponse.responseHeader.serviceResult != UA_STATUSCODE_GOOD) {
+            return chunkResponse.responseHeader.serviceResult;
+        }
+        const size_t chunkSize = std::min<size_t>(limit, total - index * limit);
+        if (chunkResponse.*resultsSize != chunkSize) {
+            return UA_STATUSCODE_BADUNEXPECTEDERROR;
+        }
+        return UA_STATUSCODE_GOOD;
+    };
+    std::vector<UA_StatusCode> chunkStatus(chunkCount);
+    size_t firstGood = chunkCount;
+    for (size_t i = 0; i < chunkCount; ++i) {
+        chunkStatus[i] = getChunkStatus(i);
+        if (chunkStatus[i] == UA_STATUSCODE_GOOD && firstGood == chunkCount) {
+            firstGood = i;
+        }
+    }
+    if (firstGood == chunkCount) {
+        if (state->received.front()) {
+            response.responseHeader = std::exchange(state->responses.front().responseHeader, {});
+        }
+        response.responseHeader.serviceResult = chunkStatus.front();
+        return response;
+    }
+    response.responseHeader = std::exchange(state->responses[firstGood].responseHeader, {});
+
+    auto* merged = static_cast<Result*>(UA_calloc(total, sizeof(Result)));
+    if (merged == nullptr) {
+        response.responseHeader.serviceResult = UA_STATUSCODE_BADOUTOFMEMORY;
+        return response;
+    }
+    for (size_t i = 0; i < chunkCount; ++i) {
+        const size_t position = i * limit;
+        const size_t count = std::min<size_t>(limit, total - position);
+        if (chunkStatus[i] != UA_STATUSCODE_GOOD) {
+            for (size_t j = position; j < position + count; ++j) {
+                setResultStatus(merged[j], chunkStatus[i]);  // NOLINT
+            }
+            continue;  // results of failed chunks are cleared with the chunk state
+        }
+        auto& chunkResponse = state->responses[i];
+        // move results by memcpy, the chunk arrays are freed without clearing the members
+        // NOLINTNEXTLINE
+        std::memcpy(merged + position, chunkResponse.*results, count * sizeof(Result));
+        UA_free(chunkResponse.*results);  // NOLINT
+        chunkResponse.*results = nullptr;
+        chunkResponse.*resultsSize = 0;
+    }
+    response.*results = merged;
+    response.*resultsSize = total;
+    return response;
+}
+
+}  // namespace opcua::services::detail
@@ -23,11 +23,15 @@ uint32_t createSubscription(
     Client& client,
     SubscriptionParameters& parameters,
     bool publishingEnabled,
-    DeleteSubscriptionCallback deleteCallback
+    DeleteSubscriptionCallback deleteCallback,
+    DataChangeBatchCallback dataChangeBatchCallback
 ) {
+    auto& clientContext = opcua::detail::getContext(client);
     auto context = std::make_unique<detail::SubscriptionContext>();
-    context->catcher = &opcua::detail::getContext(client).exceptionCatcher;
+    context->catcher = &clientContext.exceptionCatcher;
     context->deleteCallback = std::move(deleteCallback);
+    context->batchCallback = std::move(dataChangeBatchCallback);
+    context->pendingBatches = &clientContext.pendingDataChangeBatches;
 
     using Response =
         TypeWrapper<UA_CreateSubscriptionResponse, UA_TYPES_CREATESUBSCRIPTIONRESPONSE>;
@@ -35,14 +39,20 @@ uint32_t createSubscription(
         client.handle(),
         detail::createCreateSubscriptionRequest(parameters, publishingEnabled),
         context.get(),
-        nullptr,  // statusChangeCallback
+        context->statusChangeCallbackNative,
         context->deleteCallbackNative
     );
     throwIfBad(response->responseHeader.serviceResult);
     detail::reviseSubscriptionParameters(parameters, asNative(response));
 
     const auto subscriptionId = response->subscriptionId;
-    opcua::detail::getContext(client).subscriptions.insert(subscriptionId, std::move(context));
+    if (auto& registry = clientContext.subscriptionRegistry) {
+        registry->addSubscription(
+            subscriptionId,
+            {parameters, publishingEnabled, context->deleteCallback, context->batchCallback, {}}
+        );
+    }
+    clientContext.subscriptions.insert(subscriptionId, std::move(context));
     return subscriptionId;
 }
 
@@ -56,6 +66,11 @@ void modifySubscription(
     );
     throwIfBad(response->responseHeader.serviceResult);
     detail::reviseSubscriptionParameters(parameters, asNative(response));
+    if (auto& registry = opcua::detail::getContext(client).subscriptionRegistry) {
+        registry->updateSubscription(subscriptionId, [&](auto& record) {
+            record.parameters = parameters;
+        });
+    }
 }
 
 void setPublishingMode(Client& client, uint32_t subscriptionId, bool publishing) {
@@ -67,10 +82,18 @@ void setPublishingMode(Client& client, uint32_t subscriptionId, bool publishing)
         },
         detail::SyncOperation{}
     );
+    if (auto& registry = opcua::detail::getContext(client).subscriptionRegistry) {
+        registry->updateSubscription(subscriptionId, [&](auto& record) {
+            record.publishingEnabled = publishing;
+        });
+    }
 }
 
 void deleteSubscription(Client& client, uint32_t subscriptionId) {
     const auto status = UA_Client_Subscriptions_deleteSingle(client.handle(), subscriptionId);
+    if (auto& registry = opcua::detail::getContext(client).subscriptionRegistry) {
+        registry->removeSubscription(subscriptionId);
+    }
     throwIfBad(status);
 }
 
@@ -1,29 +1,115 @@
 #include "open62541pp/services/View.h"
 
+#include <algorithm>  // min, max, move
 #include <cstddef>  // size_t
+#include <deque>
+#include <functional>  // hash
+#include <memory>
+#include <string_view>
+#include <unordered_set>
+#include <utility>  // move
 
 #include "open62541pp/Client.h"
 #include "open62541pp/ErrorHandling.h"
 #include "open62541pp/NodeIds.h"
 #include "open62541pp/Server.h"
+#include "open62541pp/Session.h"
 #include "open62541pp/TypeWrapper.h"
+#include "open62541pp/detail/ScopeExit.h"
+#include "open62541pp/detail/ServerContext.h"
+#include "open62541pp/detail/helper.h"
 #include "open62541pp/services/detail/ClientService.h"
 #include "open62541pp/services/detail/ResponseHandling.h"
 #include "open62541pp/types/Builtin.h"
 
 #include "../open62541_impl.h"
+#include "RequestChunking.h"
 
 namespace opcua::services {
 
 BrowseResponse browse(Client& connection, const BrowseRequest& request) {
-    return browseAsync(connection, request, detail::SyncOperation{});
+    return detail::sendChunkedRequest(
+        connection,
+        *request.handle(),
+        detail::getOperationLimit(connection, &OperationLimits::maxNodesPerBrowse),
+        &UA_BrowseRequest::nodesToBrowseSize,
+        &UA_BrowseRequest::nodesToBrowse,
+        &UA_BrowseResponse::resultsSize,
+        &UA_BrowseResponse::results
+    );
+}
+
+namespace {
+
+NodeId getCurrentSessionId(Server& connection) {
+    const auto* session = connection.getCurrentSession();
+    return session != nullptr ? session->getSessionId() : NodeId();
+}
+
+BrowseResult makeBadResult(StatusCode code) {
+    BrowseResult result;
+    result->statusCode = code;
+    return result;
 }
 
+/// Move the next page of references out of the cursor.
+BrowseResult takePage(opcua::detail::BrowseContinuations::Cursor& cursor) {
+    auto refs = cursor.result.getReferences();
+    const size_t end = std::min(refs.size(), cursor.next + cursor.maxReferences);
+    BrowseResult page;
+    page->references = opcua::detail::allocateArray<UA_ReferenceDescription>(
+        end - cursor.next, UA_TYPES[UA_TYPES_REFERENCEDESCRIPTION]
+    );
+    page->referencesSize = end - cursor.next;
+    std::move(refs.begin() + cursor.next, refs.begin() + end, page.getReferences().begin());
+    cursor.next = end;
+    return page;
+}
+
+BrowseResult browseComplete(Server& connection, const BrowseDescription& bd) {
+    auto& cache = opcua::detail::getContext(connection).browseCache;
+    if (!cache.isEnabled()) {
+        return UA_Server_browse(connection.handle(), 0, bd.handle());
+    }
+    if (auto cached = cache.find(bd)) {
+        return std::move(*cached);
+    }
+    const auto generation = cache.getGeneration();
+    BrowseResult result = UA_Server_browse(connection.handle(), 0, bd.handle());
+    if (result.getStatusCode().isGood() && result.getContinuationPoint().empty()) {
+        cache.insert(bd, result, generation);
+    }
+    return result;
+}
+
+}  // namespace
+
 template <>
 BrowseResult browse<Server>(
     Server& connection, const BrowseDescription& bd, uint32_t maxReferences
 ) {
-    return UA_Server_browse(connection.handle(), maxReferences, bd.handle());
+    opcua::detail::ServiceTimer timer(
+        opcua::detail::getMetricsRecorder(connection), MetricsService::Browse
+    );
+    BrowseResult result = browseComplete(connection, bd);
+    timer.setError(result.getStatusCode().isBad());
+    if (maxReferences == 0 || result.getReferences().size() <= maxReferences ||
+        result.getStatusCode().isBad()) {
+        return result;
+    }
+    // keep the complete references, the pages are moved out with browseNext
+    opcua::detail::BrowseContinuations::Cursor cursor{
+        getCurrentSessionId(connection), std::move(result), 0, maxReferences
+    };
+    BrowseResult page = takePage(cursor);
+    auto continuationPoint = opcua::detail::getContext(connection).browseContinuations.open(
+        std::move(cursor)
+    );
+    if (!continuationPoint.has_value()) {
+        return makeBadResult(UA_STATUSCODE_BADNOCONTINUATIONPOINTS);
+    }
+    page.getContinuationPoint() = std::move(*continuationPoint);
+    return page;
 }
 
 template <>
@@ -41,9 +127,26 @@ template <>
 BrowseResult browseNext<Server>(
     Server& connection, bool releaseContinuationPoint, const ByteString& continuationPoint
 ) {
-    return UA_Server_browseNext(
-        connection.handle(), releaseContinuationPoint, continuationPoint.handle()
-    );
+    using opcua::detail::BrowseContinuations;
+    if (!BrowseContinuations::isOwned(continuationPoint)) {
+        return UA_Server_browseNext(
+            connection.handle(), releaseContinuationPoint, continuationPoint.handle()
+        );
+    }
+    auto& continuations = opcua::detail::getContext(connection).browseContinuations;
+    auto cursor = continuations.take(getCurrentSessionId(connection), continuationPoint);
+    if (!cursor.has_value()) {
+        return makeBadResult(UA_STATUSCODE_BADCONTINUATIONPOINTINVALID);
+    }
+    if (releaseContinuationPoint) {
+        return {};
+    }
+    BrowseResult page = takePage(*cursor);
+    if (cursor->next < cursor->result.getReferences().size()) {
+        continuations.restore(continuationPoint, std::move(*cursor));
+        page.getContinuationPoint() = continuationPoint;
+    }
+    return page;
 }
 
 template <>
@@ -58,7 +161,17 @@ BrowseResult browseNext<Client>(
 TranslateBrowsePathsToNodeIdsResponse translateBrowsePathsToNodeIds(
     Client& connection, const TranslateBrowsePathsToNodeIdsRequest& request
 ) {
-    return translateBrowsePathsToNodeIdsAsync(connection, request, detail::SyncOperation{});
+    return detail::sendChunkedRequest(
+        connection,
+        *request.handle(),
+        detail::getOperationLimit(
+            connection, &OperationLimits::maxNodesPerTranslateBrowsePathsToNodeIds
+        ),
+        &UA_TranslateBrowsePathsToNodeIdsRequest::browsePathsSize,
+        &UA_TranslateBrowsePathsToNodeIdsRequest::browsePaths,
+        &UA_TranslateBrowsePathsToNodeIdsResponse::resultsSize,
+        &UA_TranslateBrowsePathsToNodeIdsResponse::results
+    );
 }
 
 template <>
@@ -98,4 +211,249 @@ std::vector<ExpandedNodeId> browseRecursive(Server& connection, const BrowseDesc
     return result;
 }
 
+void BrowseProjection::add(ReferenceDescription& ref) {
+    auto& target = ref.getNodeId();
+    if (!target.isLocal()) {
+        return;
+    }
+    nodeIds.push_back(std::move(target.getNodeId()));
+    nodeClasses.push_back(ref.getNodeClass());
+    browseNameIndices.push_back(intern(ref.getBrowseName()));
+}
+
+void BrowseProjection::clear() noexcept {
+    nodeIds.clear();
+    nodeClasses.clear();
+    browseNameIndices.clear();
+    browseNames.clear();
+    browseNameIndex_.clear();
+}
+
+uint32_t BrowseProjection::intern(const QualifiedName& browseName) {
+    const size_t hash = std::hash<std::string_view>{}(browseName.getName()) * 31 +
+                        browseName.getNamespaceIndex();
+    auto& candidates = browseNameIndex_[hash];
+    for (const uint32_t index : candidates) {
+        if (browseNames[index] == browseName) {
+            return index;
+        }
+    }
+    const auto index = static_cast<uint32_t>(browseNames.size());
+    browseNames.push_back(browseName);
+    candidates.push_back(index);
+    return index;
+}
+
+namespace {
+
+struct BrowseRecursiveState {
+    BrowseRecursiveState(const BrowseDescription& bd, BrowseRecursiveCallback cb)
+        : description(bd),
+          nodeClassMask(bd->nodeClassMask),
+          callback(std::move(cb)) {
+        description->nodeClassMask = 0;  // recurse into all node classes, filter on callback
+    }
+
+    BrowseDescription description;
+    uint32_t nodeClassMask;
+    BrowseRecursiveCallback callback;
+    std::unordered_set<NodeId> visited;
+    std::deque<NodeId> pending;
+    std::deque<std::pair<NodeId, ByteString>> continuations;
+    size_t inFlight = 0;
+    StatusCode error;
+    bool stopped = false;
+};
+
+using BrowseRecursiveStatePtr = std::shared_ptr<BrowseRecursiveState>;
+
+void processBrowseResults(
+    BrowseRecursiveState& state, const std::vector<NodeId>& sources, Span<BrowseResult> results
+) {
+    for (size_t i = 0; i < std::min(sources.size(), results.size()); ++i) {
+        auto& result = results[i];
+        const auto status = result.getStatusCode();
+        if (status == UA_STATUSCODE_BADNOCONTINUATIONPOINTS &&
+            (state.inFlight > 0 || !state.continuations.empty())) {
+            state.pending.push_back(sources[i]);  // retry after continuation points are released
+            continue;
+        }
+        if (status.isBad()) {
+            continue;
+        }
+        for (const auto& ref : result.getReferences()) {
+            const auto nodeClass = static_cast<uint32_t>(ref.getNodeClass());
+            if (state.nodeClassMask == 0 || (state.nodeClassMask & nodeClass) != 0) {
+                state.callback(sources[i], ref);
+            }
+            const auto& target = ref.getNodeId();
+            if (target.isLocal() && state.visited.insert(target.getNodeId()).second) {
+                state.pending.push_back(target.getNodeId());
+            }
+        }
+        if (!result.getContinuationPoint().empty()) {
+            state.continuations.emplace_back(sources[i], std::move(result.getContinuationPoint()));
+        }
+    }
+}
+
+/// Release the continuation points of an aborted crawl with BrowseNext (fire and forget).
+void releaseContinuationPoints(Client& client, std::vector<ByteString>&& continuationPoints) {
+    if (continuationPoints.empty()) {
+        return;
+    }
+    UA_BrowseNextRequest request{};
+    request.releaseContinuationPoints = true;
+    request.continuationPointsSize = continuationPoints.size();
+    request.continuationPoints = asNative(continuationPoints.data());
+    detail::sendRequest<UA_BrowseNextRequest, UA_BrowseNextResponse>(
+        client,
+        request,
+        detail::WrapResponse<BrowseNextResponse>{},
+        [](StatusCode, BrowseNextResponse&) {}
+    );
+}
+
+void releaseContinuationPoints(Client& client, BrowseRecursiveState& state) noexcept {
+    try {
+        std::vector<ByteString> continuationPoints;
+        for (auto& continuation : state.continuations) {
+            continuationPoints.push_back(std::move(continuation.second));
+        }
+        state.continuations.clear();
+        releaseContinuationPoints(client, std::move(continuationPoints));
+    } catch (...) {  // NOLINT(bugprone-empty-catch)
+        // disconnected, the continuation points were released with the session
+    }
+}
+
+template <typename Response>
+auto makeBrowseHandler(
+    Client& client, BrowseRecursiveStatePtr state, std::vector<NodeId>&& sources
+) {
+    return [&client, state = std::move(state), sources = std::move(sources)](
+               StatusCode code, Response& response
+           ) {
+        --state->inFlight;
+        if (state->stopped) {
+            // responses after an abort, release their continuation points
+            if (code.isGood()) {
+                for (auto& result : response.getResults()) {
+                    if (!result.getContinuationPoint().empty()) {
+                        state->continuations.emplace_back(
+                            NodeId(), std::move(result.getContinuationPoint())
+                        );
+                    }
+                }
+            }
+            releaseContinuationPoints(client, *state);
+            return;
+        }
+        if (code.isGood()) {
+            code = response.getResponseHeader().getServiceResult();
+        }
+        if (code.isBad()) {
+            if (state->error.isGood()) {
+                state->error = code;
+            }
+            return;
+        }
+        processBrowseResults(*state, sources, response.getResults());
+    };
+}
+
+void sendBrowse(
+    Client& client, const BrowseRecursiveStatePtr& state, size_t limit, uint32_t maxReferences
+) {
+    std::vector<NodeId> sources;
+    while (!state->pending.empty() && sources.size() < limit) {
+        sources.push_back(std::move(state->pending.front()));
+        state->pending.pop_front();
+    }
+    // shallow copies, the node ids are owned by the sources moved into the handler
+    std::vector<UA_BrowseDescription> items(sources.size(), *state->description.handle());
+    for (size_t i = 0; i < sources.size(); ++i) {
+        items[i].nodeId = *sources[i].handle();
+    }
+    UA_BrowseRequest request{};
+    request.requestedMaxReferencesPerNode = maxReferences;
+    request.nodesToBrowseSize = items.size();
+    request.nodesToBrowse = items.data();
+    detail::sendRequest<UA_BrowseRequest, UA_BrowseResponse>(
+        client,
+        request,
+        detail::WrapResponse<BrowseResponse>{},
+        makeBrowseHandler<BrowseResponse>(client, state, std::move(sources))
+    );
+    ++state->inFlight;
+}
+
+void sendBrowseNext(Client& client, const BrowseRecursiveStatePtr& state, size_t limit) {
+    std::vector<NodeId> sources;
+    std::vector<ByteString> continuationPoints;
+    while (!state->continuations.empty() && sources.size() < limit) {
+        auto& [source, continuationPoint] = state->continuations.front();
+        sources.push_back(std::move(source));
+        continuationPoints.push_back(std::move(continuationPoint));
+        state->continuations.pop_front();
+    }
+    UA_BrowseNextRequest request{};
+    request.releaseContinuationPoints = false;
+    request.continuationPointsSize = continuationPoints.size();
+    request.continuationPoints = asNative(continuationPoints.data());
+    detail::sendRequest<UA_BrowseNextRequest, UA_BrowseNextResponse>(
+        client,
+        request,
+        detail::WrapResponse<BrowseNextResponse>{},
+        makeBrowseHandler<BrowseNextResponse>(client, state, std::move(sources))
+    );
+    ++state->inFlight;
+}
+
+}  // namespace
+
+size_t browseRecursive(
+    Client& connection,
+    const BrowseDescription& bd,
+    const BrowseRecursiveCallback& callback,
+    const BrowseRecursiveOptions& options
+) {
+    // the state is shared with the handlers, responses might arrive after an exception
+    auto state = std::make_shared<BrowseRecursiveState>(bd, callback);
+    const auto stopOnExit = opcua::detail::ScopeExit([&] {
+        // continuation points are left after errors and exceptions of the callback
+        state->stopped = true;
+        releaseContinuationPoints(connection, *state);
+    });
+
+    size_t limit = std::max<size_t>(options.maxNodesPerRequest, 1);
+    const uint32_t serverLimit = detail::getOperationLimit(
+        connection, &OperationLimits::maxNodesPerBrowse
+    );
+    if (serverLimit > 0) {
+        limit = std::min<size_t>(limit, serverLimit);
+    }
+    const size_t maxInFlight = std::max<size_t>(options.maxRequestsInFlight, 1);
+
+    state->visited.insert(bd.getNodeId());
+    state->pending.push_back(bd.getNodeId());
+    while (true) {
+        while (state->error.isGood() && state->inFlight < maxInFlight) {
+            if (!state->continuations.empty()) {
+                sendBrowseNext(connection, state, limit);
+            } else if (!state->pending.empty()) {
+                sendBrowse(connection, state, limit, options.maxReferencesPerNode);
+            } else {
+                break;
+            }
+        }
+        if (state->inFlight == 0) {
+            break;
+        }
+        connection.runIterate(100);
+    }
+    throwIfBad(state->error);
+    return state->visited.size();
+}
+
 }  // namespace opcua::services
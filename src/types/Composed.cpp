@@ -548,4 +548,50 @@ AggregateFilter::AggregateFilter(
 
 #endif
 
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+QueryDataDescription::QueryDataDescription(
+    RelativePath relativePath, AttributeId attributeId, std::string_view indexRange
+) {
+    assign(std::move(relativePath), handle()->relativePath);
+    assign(attributeId, handle()->attributeId);
+    assign(indexRange, handle()->indexRange);
+}
+
+NodeTypeDescription::NodeTypeDescription(
+    ExpandedNodeId typeDefinitionNode,
+    bool includeSubTypes,
+    Span<const QueryDataDescription> dataToReturn
+) {
+    assign(std::move(typeDefinitionNode), handle()->typeDefinitionNode);
+    assign(includeSubTypes, handle()->includeSubTypes);
+    assignArray(dataToReturn, handle()->dataToReturn, handle()->dataToReturnSize);
+}
+
+QueryFirstRequest::QueryFirstRequest(
+    RequestHeader requestHeader,
+    ViewDescription view,
+    Span<const NodeTypeDescription> nodeTypes,
+    ContentFilter filter,
+    uint32_t maxDataSetsToReturn,
+    uint32_t maxReferencesToReturn
+) {
+    assign(std::move(requestHeader), handle()->requestHeader);
+    assign(std::move(view), handle()->view);
+    assignArray(nodeTypes, handle()->nodeTypes, handle()->nodeTypesSize);
+    assign(std::move(filter), handle()->filter);
+    assign(maxDataSetsToReturn, handle()->maxDataSetsToReturn);
+    assign(maxReferencesToReturn, handle()->maxReferencesToReturn);
+}
+
+QueryNextRequest::QueryNextRequest(
+    RequestHeader requestHeader, bool releaseContinuationPoint, ByteString continuationPoint
+) {
+    assign(std::move(requestHeader), handle()->requestHeader);
+    assign(releaseContinuationPoint, handle()->releaseContinuationPoint);
+    assign(std::move(continuationPoint), handle()->continuationPoint);
+}
+
+#endif
+
 }  // namespace opcua
@@ -1,6 +1,7 @@
 #include "open62541pp/types/DateTime.h"
 
-#include <ctime>  // gmtime, localtime
+#include <algorithm>  // max
+#include <ctime>  // clock_gettime, gmtime, localtime
 #include <iomanip>  // put_time
 #include <sstream>
 
@@ -10,6 +11,24 @@ DateTime DateTime::now() noexcept {
     return DateTime(UA_DateTime_now());  // NOLINT
 }
 
+DateTime DateTime::nowCoarse() noexcept {
+#ifdef CLOCK_REALTIME_COARSE
+    timespec ts{};
+    if (clock_gettime(CLOCK_REALTIME_COARSE, &ts) == 0) {
+        return DateTime(
+            UA_DATETIME_UNIX_EPOCH + ts.tv_sec * UA_DATETIME_SEC + ts.tv_nsec / 100  // NOLINT
+        );
+    }
+#endif
+    return now();
+}
+
+DateTime DateTime::nowMonotonic() noexcept {
+    static thread_local int64_t last = 0;  // NOLINT
+    last = std::max(nowCoarse().get(), last + 1);
+    return DateTime(last);  // NOLINT
+}
+
 DateTime DateTime::fromUnixTime(int64_t unixTime) noexcept {
     return DateTime(UA_DateTime_fromUnixTime(unixTime));  // NOLINT
 }
@@ -1,5 +1,7 @@
 #include "open62541pp/types/ExtensionObject.h"
 
+#include "open62541pp/Config.h"
+#include "open62541pp/Encoding.h"
 #include "open62541pp/ErrorHandling.h"
 #include "open62541pp/types/Builtin.h"
 #include "open62541pp/types/NodeId.h"
@@ -78,4 +80,49 @@ const void* ExtensionObject::getDecodedData() const noexcept {
     return nullptr;
 }
 
+static bool isBinaryEncodingId(const UA_NodeId& id, const UA_DataType& type) noexcept {
+#if UAPP_OPEN62541_VER_GE(1, 2)
+    return UA_NodeId_equal(&id, &type.binaryEncodingId);
+#else
+    return id.namespaceIndex == type.typeId.namespaceIndex &&
+           id.identifierType == UA_NODEIDTYPE_NUMERIC &&
+           id.identifier.numeric == type.binaryEncodingId;  // NOLINT
+#endif
+}
+
+static void* decodeBody(const UA_ByteString& body, const UA_DataType& type) noexcept {
+    void* data = UA_new(&type);
+    if (data == nullptr) {
+        return nullptr;
+    }
+    try {
+        detail::decodeBinary(Span<const uint8_t>(body.data, body.length), data, type);
+        return data;
+    } catch (...) {
+        UA_delete(data, &type);
+        return nullptr;
+    }
+}
+
+void* ExtensionObject::getDecodedData(const UA_DataType& type) noexcept {
+    auto& native = *handle();
+    if (native.encoding == UA_EXTENSIONOBJECT_ENCODED_BYTESTRING &&
+        isBinaryEncodingId(native.content.encoded.typeId, type)) {  // NOLINT
+        void* data = decodeBody(native.content.encoded.body, type);  // NOLINT
+        if (data == nullptr) {
+            return nullptr;
+        }
+        // replace encoded content with the decoded data, the result is cached by the object itself
+        UA_NodeId_clear(&native.content.encoded.typeId);  // NOLINT
+        UA_ByteString_clear(&native.content.encoded.body);  // NOLINT
+        native.encoding = UA_EXTENSIONOBJECT_DECODED;
+        native.content.decoded.type = &type;  // NOLINT
+        native.content.decoded.data = data;  // NOLINT
+    }
+    if (getDecodedDataType() == &type) {
+        return getDecodedData();
+    }
+    return nullptr;
+}
+
 }  // namespace opcua
@@ -1,6 +1,11 @@
 #include "open62541pp/types/NodeId.h"
 
+#include <algorithm>  // min
+#include <array>
 #include <cassert>
+#include <charconv>  // from_chars, to_chars
+#include <cstring>  // memcpy
+#include <utility>  // move
 
 #include "open62541pp/detail/helper.h"
 
@@ -67,29 +72,276 @@ std::variant<uint32_t, String, Guid, ByteString> NodeId::getIdentifier() const {
     }
 }
 
-std::string NodeId::toString() const {
-    std::string result;
-    const auto ns = getNamespaceIndex();
-    if (ns > 0) {
-        result.append("ns=").append(std::to_string(ns)).append(";");
+namespace {
+
+constexpr std::string_view base64Digits =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+/// Output into a fixed buffer, counts the required size if the buffer is too small.
+class StringWriter {
+public:
+    explicit StringWriter(Span<char> buffer) noexcept
+        : buffer_(buffer) {}
+
+    size_t size() const noexcept {
+        return size_;
+    }
+
+    bool overflow() const noexcept {
+        return size_ > buffer_.size();
+    }
+
+    void write(char c) noexcept {
+        if (size_ < buffer_.size()) {
+            buffer_[size_] = c;
+        }
+        ++size_;
+    }
+
+    void write(std::string_view str) noexcept {
+        if (size_ + str.size() <= buffer_.size() && !str.empty()) {
+            std::memcpy(buffer_.data() + size_, str.data(), str.size());  // NOLINT
+        }
+        size_ += str.size();
+    }
+
+    void writeNumber(uint32_t value) noexcept {
+        std::array<char, 10> digits{};
+        const auto* end = std::to_chars(digits.data(), digits.data() + digits.size(), value).ptr;
+        write(std::string_view(digits.data(), end - digits.data()));
+    }
+
+    /// Write hexadecimal number with padded zeros (uppercase).
+    void writeHex(uint32_t value, size_t width) noexcept {
+        constexpr std::string_view hexDigits = "0123456789ABCDEF";
+        for (size_t i = width; i > 0; --i) {
+            write(hexDigits[(value >> (4 * (i - 1))) & 0xFU]);
+        }
+    }
+
+    void writeBase64(const UA_ByteString& bs) noexcept {
+        const uint8_t* data = bs.data;
+        size_t remaining = bs.length;
+        while (remaining > 0) {
+            const size_t count = std::min<size_t>(remaining, 3);
+            uint32_t triple = 0;
+            for (size_t i = 0; i < 3; ++i) {
+                triple = (triple << 8U) | (i < count ? data[i] : 0U);  // NOLINT
+            }
+            for (size_t i = 0; i < 4; ++i) {
+                write(i <= count ? base64Digits[(triple >> (18 - 6 * i)) & 0x3FU] : '=');
+            }
+            data += count;  // NOLINT
+            remaining -= count;
+        }
     }
-    switch (getIdentifierType()) {
-    case NodeIdType::Numeric:
-        result.append("i=").append(std::to_string(getIdentifierAs<uint32_t>()));
+
+private:
+    Span<char> buffer_;
+    size_t size_{0};
+};
+
+void format(const UA_NodeId& id, StringWriter& writer) noexcept {
+    if (id.namespaceIndex > 0) {
+        writer.write("ns=");
+        writer.writeNumber(id.namespaceIndex);
+        writer.write(';');
+    }
+    switch (id.identifierType) {
+    case UA_NODEIDTYPE_NUMERIC:
+        writer.write("i=");
+        writer.writeNumber(id.identifier.numeric);  // NOLINT
         break;
-    case NodeIdType::String:
-        result.append("s=").append(getIdentifierAs<String>().get());
+    case UA_NODEIDTYPE_STRING:
+        writer.write("s=");
+        writer.write(detail::toStringView(id.identifier.string));  // NOLINT
         break;
-    case NodeIdType::Guid:
-        result.append("g=").append(getIdentifierAs<Guid>().toString());
+    case UA_NODEIDTYPE_GUID: {
+        // <Data1>-<Data2>-<Data3>-<Data4[0:1]>-<Data4[2:7]>
+        const auto& guid = id.identifier.guid;  // NOLINT
+        writer.write("g=");
+        writer.writeHex(guid.data1, 8);
+        writer.write('-');
+        writer.writeHex(guid.data2, 4);
+        writer.write('-');
+        writer.writeHex(guid.data3, 4);
+        writer.write('-');
+        for (size_t i = 0; i < 8; ++i) {
+            if (i == 2) {
+                writer.write('-');
+            }
+            writer.writeHex(guid.data4[i], 2);  // NOLINT
+        }
         break;
-    case NodeIdType::ByteString:
-        result.append("b=").append(getIdentifierAs<ByteString>().toBase64());
+    }
+    case UA_NODEIDTYPE_BYTESTRING:
+        writer.write("b=");
+        writer.writeBase64(id.identifier.byteString);  // NOLINT
+        break;
+    default:
         break;
     }
+}
+
+/// Parse the complete string as unsigned number.
+template <typename T>
+bool parseNumber(std::string_view str, T& value, int base = 10) noexcept {
+    const auto* end = str.data() + str.size();  // NOLINT
+    const auto [ptr, ec] = std::from_chars(str.data(), end, value, base);
+    return ec == std::errc() && ptr == end;
+}
+
+bool parseGuid(std::string_view str, UA_Guid& guid) noexcept {
+    // 8-4-4-4-12 hexadecimal digits
+    if (str.size() != 36 || str[8] != '-' || str[13] != '-' || str[18] != '-' || str[23] != '-') {
+        return false;
+    }
+    bool ok = parseNumber(str.substr(0, 8), guid.data1, 16) &&
+              parseNumber(str.substr(9, 4), guid.data2, 16) &&
+              parseNumber(str.substr(14, 4), guid.data3, 16);
+    for (size_t i = 0; ok && i < 8; ++i) {
+        const size_t offset = i < 2 ? 19 + 2 * i : 24 + 2 * (i - 2);
+        ok = parseNumber(str.substr(offset, 2), guid.data4[i], 16);  // NOLINT
+    }
+    return ok;
+}
+
+/// Allocate a native string, an empty string is stored as an empty, non-null string.
+UA_StatusCode allocString(std::string_view str, UA_String& dst) noexcept {
+    if (str.empty()) {
+        dst.data = static_cast<UA_Byte*>(UA_EMPTY_ARRAY_SENTINEL);
+        return UA_STATUSCODE_GOOD;
+    }
+    dst.data = static_cast<UA_Byte*>(UA_malloc(str.size()));
+    if (dst.data == nullptr) {
+        return UA_STATUSCODE_BADOUTOFMEMORY;
+    }
+    std::memcpy(dst.data, str.data(), str.size());
+    dst.length = str.size();
+    return UA_STATUSCODE_GOOD;
+}
+
+int decodeBase64Digit(char c) noexcept {
+    const auto pos = base64Digits.find(c);
+    return pos == std::string_view::npos ? -1 : static_cast<int>(pos);
+}
+
+UA_StatusCode decodeBase64(std::string_view str, UA_ByteString& dst) noexcept {
+    if (str.size() % 4 != 0) {
+        return UA_STATUSCODE_BADNODEIDINVALID;
+    }
+    size_t padding = 0;
+    while (padding < 2 && padding < str.size() && str[str.size() - 1 - padding] == '=') {
+        ++padding;
+    }
+    const size_t length = str.size() / 4 * 3 - padding;
+    if (length == 0) {
+        dst.data = static_cast<UA_Byte*>(UA_EMPTY_ARRAY_SENTINEL);
+        return UA_STATUSCODE_GOOD;
+    }
+    auto* data = static_cast<UA_Byte*>(UA_malloc(length));
+    if (data == nullptr) {
+        return UA_STATUSCODE_BADOUTOFMEMORY;
+    }
+    size_t size = 0;
+    for (size_t i = 0; i < str.size(); i += 4) {
+        uint32_t quad = 0;
+        for (size_t j = 0; j < 4; ++j) {
+            const char c = str[i + j];
+            const bool isPadding = c == '=' && i + j >= str.size() - padding;
+            const int digit = isPadding ? 0 : decodeBase64Digit(c);
+            if (digit < 0) {
+                UA_free(data);
+                return UA_STATUSCODE_BADNODEIDINVALID;
+            }
+            quad = (quad << 6U) | static_cast<uint32_t>(digit);
+        }
+        for (size_t j = 0; j < 3 && size < length; ++j) {
+            data[size++] = static_cast<UA_Byte>(quad >> (16 - 8 * j));  // NOLINT
+        }
+    }
+    dst.data = data;
+    dst.length = length;
+    return UA_STATUSCODE_GOOD;
+}
+
+}  // namespace
+
+std::string NodeId::toString() const {
+    // most NodeIds fit into the local buffer, otherwise format again with the required size
+    std::array<char, 64> local{};
+    StringWriter writer(local);
+    format(*handle(), writer);
+    if (!writer.overflow()) {
+        return {local.data(), writer.size()};
+    }
+    std::string result(writer.size(), '\0');
+    StringWriter resultWriter(result);
+    format(*handle(), resultWriter);
     return result;
 }
 
+Result<std::string_view> NodeId::toString(Span<char> buffer) const noexcept {
+    StringWriter writer(buffer);
+    format(*handle(), writer);
+    if (writer.overflow()) {
+        return BadResult(UA_STATUSCODE_BADENCODINGLIMITSEXCEEDED);
+    }
+    return std::string_view(buffer.data(), writer.size());
+}
+
+Result<NodeId> NodeId::parse(std::string_view str) noexcept {
+    constexpr UA_StatusCode invalid = UA_STATUSCODE_BADNODEIDINVALID;
+    UA_NodeId native{};
+    if (str.substr(0, 3) == "ns=") {
+        const auto end = str.find(';');
+        if (end == std::string_view::npos ||
+            !parseNumber(str.substr(3, end - 3), native.namespaceIndex)) {
+            return BadResult(invalid);
+        }
+        str.remove_prefix(end + 1);
+    }
+    if (str.size() < 2 || str[1] != '=') {
+        return BadResult(invalid);
+    }
+    const char type = str[0];
+    str.remove_prefix(2);
+    UA_StatusCode status = UA_STATUSCODE_GOOD;
+    switch (type) {
+    case 'i':
+        native.identifierType = UA_NODEIDTYPE_NUMERIC;
+        status = parseNumber(str, native.identifier.numeric) ? status : invalid;  // NOLINT
+        break;
+    case 's':
+        native.identifierType = UA_NODEIDTYPE_STRING;
+        status = allocString(str, native.identifier.string);  // NOLINT
+        break;
+    case 'g':
+        native.identifierType = UA_NODEIDTYPE_GUID;
+        status = parseGuid(str, native.identifier.guid) ? status : invalid;  // NOLINT
+        break;
+    case 'b':
+        native.identifierType = UA_NODEIDTYPE_BYTESTRING;
+        status = decodeBase64(str, native.identifier.byteString);  // NOLINT
+        break;
+    default:
+        status = invalid;
+    }
+    if (status != UA_STATUSCODE_GOOD) {
+        return BadResult(status);
+    }
+    return NodeId(std::move(native));
+}
+
+std::vector<Result<NodeId>> NodeId::parseMany(Span<const std::string_view> strings) {
+    std::vector<Result<NodeId>> results;
+    results.reserve(strings.size());
+    for (const auto str : strings) {
+        results.push_back(parse(str));
+    }
+    return results;
+}
+
 /* --------------------------------------- ExpandedNodeId --------------------------------------- */
 
 ExpandedNodeId::ExpandedNodeId(const NodeId& id) {
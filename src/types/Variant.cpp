@@ -1,5 +1,6 @@
 #include "open62541pp/types/Variant.h"
 
+#include "open62541pp/ErrorHandling.h"
 #include "open62541pp/detail/helper.h"
 #include "open62541pp/overloads/comparison.h"
 #include "open62541pp/types/NodeId.h"
@@ -102,6 +103,64 @@ Span<const uint32_t> Variant::getArrayDimensions() const noexcept {
     return {handle()->arrayDimensions, handle()->arrayDimensionsSize};
 }
 
+Variant Variant::getRangeCopy(const NumericRange& range) const {
+    Variant result;
+    const UA_NumericRange native{
+        range.get().size(),
+        const_cast<UA_NumericRangeDimension*>(range.get().data()),  // NOLINT
+    };
+    throwIfBad(UA_Variant_copyRange(handle(), result.handle(), native));
+    return result;
+}
+
+std::optional<Variant> Variant::getRangeReference(const NumericRange& range) const {
+    const auto& dims = range.get();
+    if (!isArray() || dims.empty()) {
+        return std::nullopt;
+    }
+    const auto arrayDims = getArrayDimensions();
+    const size_t rank = arrayDims.empty() ? 1 : arrayDims.size();
+    if (dims.size() != rank) {
+        return std::nullopt;
+    }
+    const auto extent = [&](size_t dim) -> size_t {
+        return arrayDims.empty() ? getArrayLength() : arrayDims[dim];
+    };
+    const auto isFull = [&](size_t dim) {
+        return dims[dim].min == 0 && size_t{dims[dim].max} + 1 == extent(dim);
+    };
+
+    // number of elements per index of the first dimension
+    size_t blockSize = 1;
+    for (size_t dim = 1; dim < rank; ++dim) {
+        if (!isFull(dim)) {
+            return std::nullopt;
+        }
+        blockSize *= extent(dim);
+    }
+    const auto& first = dims[0];
+    if (first.min > first.max || first.max >= extent(0)) {
+        return std::nullopt;
+    }
+    if (rank > 1 && !isFull(0)) {
+        return std::nullopt;
+    }
+
+    const auto* type = getDataType();
+    Variant result;
+    result->type = type;
+    result->storageType = UA_VARIANT_DATA_NODELETE;
+    const size_t offset = first.min * blockSize * type->memSize;
+    result->data = static_cast<uint8_t*>(handle()->data) + offset;  // NOLINT
+    result->arrayLength = (size_t{first.max} - first.min + 1) * blockSize;
+    if (rank > 1) {
+        // not freed (NODELETE)
+        result->arrayDimensionsSize = handle()->arrayDimensionsSize;
+        result->arrayDimensions = handle()->arrayDimensions;
+    }
+    return result;
+}
+
 void Variant::checkIsScalar() const {
     if (!isScalar()) {
         throw BadVariantAccess("Variant is not a scalar");
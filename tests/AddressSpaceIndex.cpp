@@ -0,0 +1,93 @@
+#include <algorithm>  // count
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/AddressSpaceIndex.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Node.h"
+#include "open62541pp/Server.h"
+
+#include "helper/stringify.h"
+
+using namespace opcua;
+
+TEST_CASE("AddressSpaceIndex") {
+    Server server;
+
+    // two lines with analog items and a derived analog item type
+    auto objects = server.getObjectsNode();
+    auto line1 = objects.addFolder({1, "Line1"}, "Line1");
+    auto line2 = objects.addFolder({1, "Line2"}, "Line2");
+    server.getNode(VariableTypeId::AnalogItemType)
+        .addVariableType({1, "TemperatureType"}, "TemperatureType");
+    const auto addItem = [](Node<Server>& parent, const NodeId& id, const NodeId& type) {
+        parent.addVariable(id, "Value", {}, type);
+    };
+    addItem(line1, {1, "Line1.A"}, VariableTypeId::AnalogItemType);
+    addItem(line1, {1, "Line1.B"}, {1, "TemperatureType"});
+    addItem(line2, {1, "Line2.A"}, VariableTypeId::AnalogItemType);
+
+    auto& index = server.getAddressSpaceIndex();
+    CHECK(&index == &server.getAddressSpaceIndex());
+    CHECK(index.size() > 0);
+
+    SUBCASE("Subtree") {
+        CHECK(index.contains({1, "Line1.A"}));
+        CHECK(index.isInSubtree({1, "Line1.A"}, {1, "Line1"}));
+        CHECK(index.isInSubtree({1, "Line1.A"}, ObjectId::ObjectsFolder));
+        CHECK_FALSE(index.isInSubtree({1, "Line1.A"}, {1, "Line2"}));
+        CHECK_FALSE(index.isInSubtree({1, "Unknown"}, {1, "Line1"}));
+        const auto subtree = index.getSubtree({1, "Line1"});
+        CHECK(subtree.front() == NodeId(1, "Line1"));
+        CHECK(std::count(subtree.begin(), subtree.end(), NodeId(1, "Line1.A")) == 1);
+        CHECK(std::count(subtree.begin(), subtree.end(), NodeId(1, "Line1.B")) == 1);
+        CHECK(std::count(subtree.begin(), subtree.end(), NodeId(1, "Line2.A")) == 0);
+        CHECK_THROWS_WITH(index.getSubtree({1, "Unknown"}), "BadNodeIdUnknown");
+    }
+
+    SUBCASE("Type definition") {
+        const NodeId analogItemType(VariableTypeId::AnalogItemType);
+        CHECK(
+            index.findByTypeDefinition(analogItemType, {1, "Line1"}) ==
+            std::vector<NodeId>{{1, "Line1.A"}}
+        );
+        CHECK(
+            index.findByTypeDefinition(analogItemType, {1, "Line1"}, true) ==
+            std::vector<NodeId>{{1, "Line1.A"}, {1, "Line1.B"}}
+        );
+        const NodeId objectsId(ObjectId::ObjectsFolder);
+        CHECK(index.findByTypeDefinition(analogItemType, objectsId).size() == 2);
+        CHECK(index.findByTypeDefinition(analogItemType, objectsId, true).size() == 3);
+        CHECK(index.findByTypeDefinition({1, "UnknownType"}).empty());
+    }
+
+    SUBCASE("Browse name") {
+        CHECK(
+            index.findByBrowseName({1, "Value"}, {1, "Line2"}) ==
+            std::vector<NodeId>{{1, "Line2.A"}}
+        );
+        CHECK(index.findByBrowseName({1, "Value"}).size() == 3);
+        CHECK(index.findByBrowseName({2, "Value"}).empty());
+        CHECK(
+            index.findByBrowseName({0, "Objects"}) ==
+            std::vector<NodeId>{{0, UA_NS0ID_OBJECTSFOLDER}}
+        );
+    }
+
+    SUBCASE("Maintained with changes") {
+        addItem(line2, {1, "Line2.B"}, VariableTypeId::AnalogItemType);
+        CHECK(index.findByBrowseName({1, "Value"}, {1, "Line2"}).size() == 2);
+
+        line1.deleteNode();
+        CHECK_FALSE(index.contains({1, "Line1"}));
+        CHECK(index.findByBrowseName({1, "Value"}).size() == 2);
+    }
+
+    SUBCASE("Native changes require rebuild") {
+        UA_Server_deleteNode(server.handle(), *NodeId(1, "Line2.A").handle(), true);
+        CHECK(index.contains({1, "Line2.A"}));
+        index.rebuild();
+        CHECK_FALSE(index.contains({1, "Line2.A"}));
+    }
+}
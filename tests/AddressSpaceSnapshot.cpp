@@ -0,0 +1,73 @@
+#include <thread>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/AddressSpaceSnapshot.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/services/Attribute.h"
+#include "open62541pp/services/NodeManagement.h"
+
+using namespace opcua;
+
+TEST_CASE("AddressSpaceSnapshot") {
+    Server server;
+    const NodeId objectId{1, 1000};
+    const NodeId variableId{1, 1001};
+    const NodeId otherId{1, 1002};
+    services::addObject(server, ObjectId::ObjectsFolder, objectId, "Object");
+    services::addVariable(server, objectId, variableId, "Variable");
+    services::addVariable(server, objectId, otherId, "Other");
+    services::writeValue(server, variableId, Variant::fromScalar(1));
+
+    AddressSpaceSnapshot snapshot({objectId, {1, 9999}});  // unknown root is skipped
+    CHECK(snapshot.get()->size() == 0);
+
+    CHECK(snapshot.refresh(server) == 3);
+    const auto view = snapshot.get();
+    CHECK(view->size() == 3);
+    CHECK(view->getRoots().size() == 2);
+    CHECK(view->getNodes().at(0)->id == objectId);
+    CHECK(view->find({1, 9999}) == nullptr);
+
+    const auto* object = view->find(objectId);
+    REQUIRE(object != nullptr);
+    CHECK(object->nodeClass == NodeClass::Object);
+    CHECK(object->browseName == QualifiedName(1, "Object"));
+    CHECK(object->children.size() == 2);
+
+    const auto* variable = view->find(variableId);
+    REQUIRE(variable != nullptr);
+    CHECK(variable->nodeClass == NodeClass::Variable);
+    CHECK(variable->value.getValue().getScalarCopy<int>() == 1);
+
+    SUBCASE("Unchanged nodes are shared") {
+        CHECK(snapshot.refresh(server) == 0);
+        const auto view2 = snapshot.get();
+        CHECK(view2 != view);
+        CHECK(view2->find(variableId) == variable);
+    }
+
+    SUBCASE("Changed nodes are copied") {
+        services::writeValue(server, variableId, Variant::fromScalar(2));
+        CHECK(snapshot.refresh(server) == 1);
+        const auto view2 = snapshot.get();
+        CHECK(view2->find(variableId)->value.getValue().getScalarCopy<int>() == 2);
+        CHECK(view2->find(otherId) == view->find(otherId));
+        // old view is unchanged
+        CHECK(variable->value.getValue().getScalarCopy<int>() == 1);
+    }
+
+    SUBCASE("Concurrent readers") {
+        std::thread reader([&] {
+            for (int i = 0; i < 100; ++i) {
+                const auto current = snapshot.get();
+                CHECK(current->size() == 3);
+            }
+        });
+        for (int i = 0; i < 100; ++i) {
+            services::writeValue(server, variableId, Variant::fromScalar(i));
+            snapshot.refresh(server);
+        }
+        reader.join();
+    }
+}
@@ -0,0 +1,92 @@
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/Aggregator.h"
+#include "open62541pp/Client.h"
+#include "open62541pp/Node.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/services/Attribute.h"
+#include "open62541pp/services/Attribute_highlevel.h"
+
+#include "helper/Runner.h"
+
+using namespace opcua;
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+TEST_CASE("Aggregator") {
+    Server downstream(4841);
+    const auto remoteNs = downstream.registerNamespace("urn:plc");
+    const NodeId remoteId{remoteNs, "temperature"};
+    downstream.getObjectsNode().addVariable(
+        remoteId,
+        "Temperature",
+        VariableAttributes{}
+            .setDataType<double>()
+            .setAccessLevel(AccessLevel::CurrentRead | AccessLevel::CurrentWrite)
+            .setValueScalar(21.5)
+    );
+    ServerRunner runner(downstream);
+
+    Client client;
+    client.connect("opc.tcp://localhost:4841");
+
+    Server server;
+    AggregatorOptions options;
+    StatusCode writeResult = UA_STATUSCODE_BADWAITINGFORINITIALDATA;
+    options.onWriteResult = [&](const NodeId&, StatusCode code) { writeResult = code; };
+    auto aggregatorPtr = std::make_unique<Aggregator>(server, options);
+    auto& aggregator = *aggregatorPtr;
+    const auto source = aggregator.addSource(client, "plc1/");
+    CHECK(aggregator.getSourceCount() == 1);
+
+    const auto localId = aggregator.getLocalId(source, remoteId);
+    CHECK(localId.getNamespaceIndex() == server.getNamespaceIndex("plc1/urn:plc"));
+    CHECK(localId.getIdentifierAs<String>() == String("temperature"));
+    CHECK_THROWS_AS(aggregator.getLocalId(source, NodeId(999, 1)), BadStatus);
+
+    const std::vector<NodeId> remoteIds{remoteId, NodeId(remoteNs, "unknown"), ObjectId::Server};
+    const auto localIds = aggregator.mirror(source, ObjectId::ObjectsFolder, remoteIds);
+    REQUIRE(localIds.size() == 3);
+    CHECK(localIds[0] == localId);
+    CHECK(localIds[1].isNull());  // unknown
+    CHECK(localIds[2].isNull());  // not a variable
+    CHECK(aggregator.size() == 1);
+    CHECK(services::readBrowseName(server, localId).getName() == "Temperature");
+
+    auto runUntil = [&](auto&& predicate) {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while (!predicate() && std::chrono::steady_clock::now() < deadline) {
+            client.runIterate(10);
+        }
+        return predicate();
+    };
+
+    SUBCASE("Reads are served from the mirrored cache") {
+        CHECK(runUntil([&] {
+            const auto dv = services::readDataValue(server, localId);
+            return dv.hasValue() && dv.getValue().getScalar<double>() == 21.5;
+        }));
+    }
+
+    SUBCASE("Writes are forwarded") {
+        services::writeValue(server, localId, Variant::fromScalar(42.0));
+        CHECK(runUntil([&] { return writeResult.isGood(); }));
+        CHECK(services::readValue(client, remoteId).getScalar<double>() == 42.0);
+        CHECK(runUntil([&] {
+            return services::readValue(server, localId).getScalar<double>() == 42.0;
+        }));
+    }
+
+    SUBCASE("Destroy before the server and the client") {
+        CHECK(client.getSubscriptions().size() == 1);
+        aggregatorPtr.reset();
+        CHECK(client.getSubscriptions().empty());
+        CHECK_THROWS_AS(services::readDataValue(server, localId), BadStatus);
+    }
+}
+
+#endif
@@ -0,0 +1,133 @@
+#include <cstdint>
+#include <memory>
+#include <utility>  // move
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/Server.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/open62541.h"
+#include "open62541pp/services/Attribute_highlevel.h"
+#include "open62541pp/services/NodeManagement.h"
+#include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/Variant.h"
+
+#include "helper/AllocationCounter.h"
+
+using namespace opcua;
+
+// Allocation budgets of hot paths. The allocations are counted before the checks, which allocate
+// themselves. Native allocations are only counted with UA_ENABLE_MALLOC_SINGLETON.
+
+TEST_CASE("AllocationScope") {
+    SUBCASE("Count operator new") {
+        AllocationScope scope;
+        auto ptr = std::make_unique<int64_t>(11);
+        const auto allocations = scope.getAllocations();
+        const auto bytes = scope.getBytes();
+        CHECK(allocations == 1);
+        CHECK(bytes >= sizeof(int64_t));
+    }
+
+    SUBCASE("Count native allocations") {
+        if (!isNativeAllocationCounted()) {
+            return;
+        }
+        AllocationScope scope;
+        auto* value = UA_Int32_new();
+        const auto allocations = scope.getAllocations();
+        UA_Int32_delete(value);
+        CHECK(allocations == 1);
+    }
+
+    SUBCASE("Nested scopes") {
+        AllocationScope outer;
+        std::vector<int> first(10);
+        AllocationScope inner;
+        std::vector<int> second(10);
+        const auto allocationsInner = inner.getAllocations();
+        const auto allocationsOuter = outer.getAllocations();
+        CHECK(allocationsInner == 1);
+        CHECK(allocationsOuter == 2);
+    }
+}
+
+TEST_CASE("Allocation budget of Variant") {
+    double value = 11.11;
+    String string("open62541pp");
+
+    SUBCASE("Reference scalar") {
+        AllocationScope scope;
+        auto var = Variant::fromScalar<VariantPolicy::Reference>(value);
+        const auto allocations = scope.getAllocations();
+        CHECK(allocations == 0);
+    }
+
+    SUBCASE("Copy scalar") {
+        AllocationScope scope;
+        auto var = Variant::fromScalar<VariantPolicy::Copy>(value);
+        const auto allocations = scope.getAllocations();
+        CHECK(allocations <= 1);
+    }
+
+    SUBCASE("Reference scalar if possible") {
+        AllocationScope scope;
+        auto var = Variant::fromScalar<VariantPolicy::ReferenceIfPossible>(string);
+        const auto allocations = scope.getAllocations();
+        CHECK(allocations == 0);
+    }
+
+    SUBCASE("Access scalar") {
+        const auto var = Variant::fromScalar(value);
+        AllocationScope scope;
+        const auto& scalar = var.getScalar<double>();
+        const auto allocations = scope.getAllocations();
+        CHECK(scalar == value);
+        CHECK(allocations == 0);
+    }
+
+    SUBCASE("Move") {
+        auto var = Variant::fromScalar(string);
+        AllocationScope scope;
+        Variant moved(std::move(var));
+        var = std::move(moved);
+        const auto allocations = scope.getAllocations();
+        CHECK(allocations == 0);
+    }
+}
+
+TEST_CASE("Allocation budget of server reads") {
+    Server server;
+    const NodeId id(1, 1000);
+    services::addVariable(
+        server,
+        ObjectId::ObjectsFolder,
+        id,
+        "Variable",
+        VariableAttributes{}.setDataType<double>().setValueScalar(0.0)
+    );
+
+    SUBCASE("readValue with zero-copy data source") {
+        struct Backend {
+            StatusCode read(DataValue& dv, Span<const NumericRangeDimension>, bool) noexcept {
+                dv.getValue().setScalar(data);
+                return UA_STATUSCODE_GOOD;
+            }
+
+            double data = 11.11;
+        };
+
+        Backend backend;
+        server.setVariableNodeValueBackend(id, backend);
+        (void)services::readValue(server, id);  // warm up
+
+        AllocationScope scope;
+        auto value = services::readValue(server, id);
+        const auto allocations = scope.getAllocations();
+        CHECK(value.getScalar<double>() == backend.data);
+        // open62541 copies values not owned by the data source's variant (one allocation)
+        CHECK(allocations <= 1);
+    }
+}
@@ -0,0 +1,86 @@
+#include <chrono>
+#include <functional>
+#include <future>
+#include <thread>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/asio.h"
+#include "open62541pp/services/Attribute_highlevel.h"
+
+#include "helper/Runner.h"
+
+using namespace opcua;
+using namespace std::chrono_literals;
+
+TEST_CASE("Asio (future completion token)") {
+    SUBCASE("Completed within the initiation") {
+        std::future<int> future = asyncInitiate<int>(
+            [](auto handler) { std::invoke(handler, StatusCode(UA_STATUSCODE_GOOD), 11); },
+            net::use_future
+        );
+        CHECK(future.get() == 11);
+    }
+
+    SUBCASE("Completed by another thread") {
+        std::function<void(StatusCode, int)> complete;
+        std::future<int> future = asyncInitiate<int>(
+            [&](auto handler) { complete = handler; }, net::use_future
+        );
+        CHECK(future.wait_for(0s) == std::future_status::timeout);
+        std::thread([&] { complete(UA_STATUSCODE_GOOD, 11); }).join();
+        CHECK(future.get() == 11);
+    }
+
+    SUBCASE("Bad status") {
+        std::future<void> future = asyncInitiate<void>(
+            [](auto handler) { std::invoke(handler, StatusCode(UA_STATUSCODE_BADINTERNALERROR)); },
+            net::use_future
+        );
+        CHECK_THROWS_AS(future.get(), BadStatus);
+    }
+}
+
+TEST_CASE("AsioServerDriver") {
+    net::io_context io;
+    Server server;
+    AsioServerDriver driver(io.get_executor(), server);
+    CHECK_FALSE(driver.isRunning());
+
+    driver.start();
+    CHECK(driver.isRunning());
+    io.run_for(50ms);
+    CHECK(server.isRunning());
+
+    driver.stop();
+    CHECK_FALSE(driver.isRunning());
+    io.restart();
+    io.run();  // returns without pending iterations
+}
+
+TEST_CASE("AsioClientDriver") {
+    Server server;
+    ServerRunner serverRunner(server);
+    Client client;
+    client.connect("opc.tcp://localhost:4840");
+
+    net::io_context io;
+    AsioClientDriver driver(io.get_executor(), client);
+    driver.start();
+    CHECK(driver.isRunning());
+
+    auto future = services::readValueAsync(
+        client, VariableId::Server_ServerStatus_State, net::use_future
+    );
+    driver.wakeup();
+    const auto deadline = std::chrono::steady_clock::now() + 5s;
+    while (future.wait_for(0s) != std::future_status::ready &&
+           std::chrono::steady_clock::now() < deadline) {
+        io.run_one_for(10ms);
+    }
+    REQUIRE(future.wait_for(0s) == std::future_status::ready);
+    CHECK(future.get().isScalar());
+
+    driver.stop();
+    CHECK_FALSE(driver.isRunning());
+}
@@ -0,0 +1,81 @@
+#include <chrono>
+#include <optional>
+#include <thread>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/AsyncDataSource.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/services/Attribute.h"
+#include "open62541pp/services/NodeManagement.h"
+
+using namespace opcua;
+
+TEST_CASE("AsyncDataSource") {
+    Server server;
+    const NodeId id{1, 1000};
+    services::addVariable(server, ObjectId::ObjectsFolder, id, "Variable", VariableAttributes{});
+
+    int requests = 0;
+    std::optional<AsyncReadCompletion> pending;
+    auto readDevice = [&](AsyncReadCompletion completion) {
+        ++requests;
+        pending = completion;
+    };
+
+    SUBCASE("Deferred completion") {
+        AsyncDataSource source(readDevice);
+        source.registerNode(server, id);
+        CHECK_THROWS_WITH(services::readValue(server, id), "BadWaitingForInitialData");
+        CHECK_THROWS_WITH(services::readValue(server, id), "BadWaitingForInitialData");
+        CHECK(requests == 1);  // single pending device read
+        REQUIRE(pending.has_value());
+        pending->complete(DataValue::fromScalar(11));
+        pending->complete(DataValue::fromScalar(22));  // ignored
+        CHECK(services::readValue(server, id).getScalar<int>() == 11);
+        CHECK(requests == 1);  // served from cache
+        CHECK(source.getCached().has_value());
+    }
+
+    SUBCASE("Cache fallback") {
+        AsyncDataSource source(readDevice, {std::chrono::milliseconds(0)});
+        source.registerNode(server, id);
+        source.refresh();
+        pending->complete(DataValue::fromScalar(11));
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        const auto dv = services::readDataValue(server, id);
+        CHECK(dv.getValue().getScalar<int>() == 11);
+        CHECK(dv.getStatus() == UA_STATUSCODE_UNCERTAINLASTUSABLEVALUE);
+        CHECK(requests == 2);
+    }
+
+    SUBCASE("Failed device read") {
+        AsyncDataSource source(readDevice);
+        source.registerNode(server, id);
+        source.refresh();
+        pending->fail(UA_STATUSCODE_BADCOMMUNICATIONERROR);
+        CHECK_THROWS_WITH(services::readValue(server, id), "BadCommunicationError");
+    }
+
+    SUBCASE("Wait for completion from other thread") {
+        AsyncDataSource source(
+            [](AsyncReadCompletion completion) {
+                std::thread([completion] {
+                    completion.complete(DataValue::fromScalar(33));
+                }).detach();
+            },
+            {std::chrono::milliseconds(1000), std::chrono::milliseconds(5000)}
+        );
+        source.registerNode(server, id);
+        CHECK(services::readValue(server, id).getScalar<int>() == 33);
+    }
+
+    SUBCASE("Read function throws") {
+        AsyncDataSource source([](const AsyncReadCompletion&) {
+            throw BadStatus(UA_STATUSCODE_BADTIMEOUT);
+        });
+        source.registerNode(server, id);
+        CHECK_THROWS_WITH(services::readValue(server, id), "BadTimeout");
+    }
+}
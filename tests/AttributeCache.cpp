@@ -0,0 +1,118 @@
+#include <chrono>
+#include <thread>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/AttributeCache.h"
+#include "open62541pp/Client.h"
+#include "open62541pp/Node.h"
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/services/Attribute.h"
+#include "open62541pp/services/NodeManagement.h"
+
+#include "helper/ServerClientSetup.h"
+
+using namespace opcua;
+
+TEST_CASE("AttributeCache") {
+    const NodeId id1(1, 1000);
+    const NodeId id2(1, 1001);
+    const auto value = DataValue::fromScalar(LocalizedText("en-US", "Name"));
+
+    SUBCASE("Configured attributes") {
+        AttributeCache cache({10, std::chrono::milliseconds(0), {AttributeId::DisplayName}});
+        CHECK(cache.isCached(AttributeId::DisplayName));
+        CHECK_FALSE(cache.isCached(AttributeId::Value));
+        cache.put(id1, AttributeId::Value, value);
+        CHECK(cache.size() == 0);
+    }
+
+    SUBCASE("Get and put") {
+        AttributeCache cache;
+        CHECK_FALSE(cache.get(id1, AttributeId::DisplayName).has_value());
+        CHECK(cache.misses() == 1);
+        cache.put(id1, AttributeId::DisplayName, value);
+        CHECK(cache.size() == 1);
+        const auto cached = cache.get(id1, AttributeId::DisplayName);
+        CHECK(cached.has_value());
+        CHECK(cached->getValue().getScalar<LocalizedText>().getText() == "Name");
+        CHECK(cache.hits() == 1);
+    }
+
+    SUBCASE("LRU eviction") {
+        AttributeCache cache({2});
+        cache.put(id1, AttributeId::DisplayName, value);
+        cache.put(id2, AttributeId::DisplayName, value);
+        CHECK(cache.get(id1, AttributeId::DisplayName).has_value());  // id2 least recently used
+        cache.put(id1, AttributeId::BrowseName, value);
+        CHECK(cache.size() == 2);
+        CHECK(cache.get(id1, AttributeId::DisplayName).has_value());
+        CHECK_FALSE(cache.get(id2, AttributeId::DisplayName).has_value());
+    }
+
+    SUBCASE("Expiry") {
+        AttributeCache cache({10, std::chrono::milliseconds(1)});
+        cache.put(id1, AttributeId::DisplayName, value);
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        CHECK_FALSE(cache.get(id1, AttributeId::DisplayName).has_value());
+        CHECK(cache.size() == 0);
+    }
+
+    SUBCASE("Invalidate") {
+        AttributeCache cache;
+        cache.put(id1, AttributeId::DisplayName, value);
+        cache.put(id1, AttributeId::BrowseName, value);
+        cache.put(id2, AttributeId::DisplayName, value);
+        cache.invalidate(id1, AttributeId::BrowseName);
+        CHECK(cache.size() == 2);
+        cache.invalidate(id1);
+        CHECK(cache.size() == 1);
+        cache.clear();
+        CHECK(cache.size() == 0);
+    }
+}
+
+TEST_CASE("AttributeCache (client)") {
+    ServerClientSetup setup;
+    auto& server = setup.server;
+    auto& client = setup.client;
+    const NodeId id{1, 1000};
+    services::addVariable(server, ObjectId::ObjectsFolder, id, "Variable");
+    setup.client.connect(setup.endpointUrl);
+
+    CHECK(client.getAttributeCache() == nullptr);
+    auto& cache = client.enableAttributeCache();
+    CHECK(client.getAttributeCache() == &cache);
+
+    Node node(client, id);
+    SUBCASE("Read through cache") {
+        CHECK(node.readDisplayName().getText() == "Variable");
+        CHECK(cache.misses() == 1);
+        CHECK(node.readDisplayName().getText() == "Variable");
+        CHECK(cache.hits() == 1);
+        CHECK(cache.size() == 1);
+
+        // not cached
+        CHECK_NOTHROW(node.readValue());
+        CHECK(cache.size() == 1);
+    }
+
+    SUBCASE("Invalidate on write") {
+        node.readDisplayName();
+        node.writeDisplayName({"en-US", "Renamed"});
+        CHECK(cache.size() == 0);
+        CHECK(node.readDisplayName().getText() == "Renamed");
+    }
+
+    SUBCASE("Clear on disconnect") {
+        node.readDisplayName();
+        client.disconnect();
+        CHECK(cache.size() == 0);
+    }
+
+    SUBCASE("Disable") {
+        client.disableAttributeCache();
+        CHECK(client.getAttributeCache() == nullptr);
+        CHECK(node.readDisplayName().getText() == "Variable");
+    }
+}
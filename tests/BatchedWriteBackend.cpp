@@ -0,0 +1,99 @@
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/BatchedWriteBackend.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/services/Attribute.h"
+#include "open62541pp/services/NodeManagement.h"
+
+using namespace opcua;
+
+TEST_CASE("BatchedWriteBackend") {
+    Server server;
+    const std::vector<NodeId> ids{{1, 1000}, {1, 1001}, {1, 1002}};
+    const std::vector<uint64_t> keys{40001, 40002, 40003};
+    for (const auto& id : ids) {
+        VariableAttributes attributes;
+        attributes.setAccessLevel(AccessLevel::CurrentRead | AccessLevel::CurrentWrite);
+        services::addVariable(server, ObjectId::ObjectsFolder, id, "Variable", attributes);
+    }
+
+    std::vector<std::vector<BatchedWrite>> batches;
+    std::optional<BatchedWriteCompletion> pending;
+    BatchedWriteBackend backend(server, [&](auto writes, BatchedWriteCompletion completion) {
+        batches.push_back(std::move(writes));
+        pending = completion;
+    });
+    backend.registerNodes(ids, keys);
+
+    CHECK_THROWS_WITH(services::readValue(server, ids[0]), "BadWaitingForInitialData");
+    backend.setValue(keys[0], DataValue::fromScalar(0));
+    CHECK(services::readValue(server, ids[0]).getScalar<int>() == 0);
+
+    SUBCASE("Writes of one iteration are handed over as one batch") {
+        services::writeValue(server, ids[0], Variant::fromScalar(1));
+        services::writeValue(server, ids[1], Variant::fromScalar(2));
+        services::writeValue(server, ids[2], Variant::fromScalar(3));
+        CHECK(backend.getQueuedWrites() == 3);
+        CHECK(batches.empty());
+        CHECK(services::readValue(server, ids[1]).getScalar<int>() == 2);  // shadow
+
+        server.runIterate();
+        REQUIRE(batches.size() == 1);
+        REQUIRE(batches[0].size() == 3);
+        CHECK(batches[0][0].key == keys[0]);
+        CHECK(batches[0][2].key == keys[2]);
+        CHECK(batches[0][2].value.getValue().getScalar<int>() == 3);
+        CHECK(batches[0][2].range.empty());
+        CHECK(backend.getQueuedWrites() == 0);
+        CHECK(backend.getPendingBatches() == 1);
+
+        const std::vector<StatusCode> results{
+            UA_STATUSCODE_GOOD, UA_STATUSCODE_BADOUTOFRANGE, UA_STATUSCODE_GOOD
+        };
+        pending->complete(results);
+        pending->fail(UA_STATUSCODE_BADCOMMUNICATIONERROR);  // ignored
+        CHECK(backend.getPendingBatches() == 0);
+        CHECK(services::readDataValue(server, ids[0]).getStatus().isGood());
+        CHECK(services::readDataValue(server, ids[1]).getStatus() == UA_STATUSCODE_BADOUTOFRANGE);
+    }
+
+    SUBCASE("Failed batch keeps newer values") {
+        services::writeValue(server, ids[0], Variant::fromScalar(1));
+        services::writeValue(server, ids[1], Variant::fromScalar(2));
+        backend.flush();
+        REQUIRE(batches.size() == 1);
+        services::writeValue(server, ids[1], Variant::fromScalar(22));  // next batch
+        pending->fail(UA_STATUSCODE_BADCOMMUNICATIONERROR);
+        CHECK(
+            services::readDataValue(server, ids[0]).getStatus() ==
+            UA_STATUSCODE_BADCOMMUNICATIONERROR
+        );
+        CHECK(services::readDataValue(server, ids[1]).getStatus().isGood());
+        CHECK(backend.getQueuedWrites() == 1);
+    }
+}
+
+TEST_CASE("BatchedWriteBackend destroyed before the server") {
+    Server server;
+    const NodeId id{1, 1000};
+    VariableAttributes attributes;
+    attributes.setAccessLevel(AccessLevel::CurrentRead | AccessLevel::CurrentWrite);
+    services::addVariable(server, ObjectId::ObjectsFolder, id, "Variable", attributes);
+
+    size_t batches = 0;
+    {
+        BatchedWriteBackend backend(server, [&](auto, BatchedWriteCompletion) { batches++; });
+        const uint64_t key = 40001;
+        backend.registerNodes({id}, {key});
+        services::writeValue(server, id, Variant::fromScalar(1));  // schedules the flush
+    }
+    server.runIterate();
+    CHECK(batches == 0);
+    CHECK_THROWS_AS(services::readValue(server, id), BadStatus);
+}
@@ -0,0 +1,78 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/detail/BlockPool.h"
+
+using namespace opcua;
+
+TEST_CASE("BlockPool") {
+    detail::BlockPool pool;
+
+    SUBCASE("Reuse released blocks") {
+        void* ptr1 = pool.allocate(40, alignof(std::max_align_t));
+        CHECK(pool.freeBlocks() == 0);
+        pool.deallocate(ptr1, 40, alignof(std::max_align_t));
+        CHECK(pool.freeBlocks() == 1);
+        void* ptr2 = pool.allocate(64, alignof(std::max_align_t));  // same size class
+        CHECK(ptr2 == ptr1);
+        CHECK(pool.freeBlocks() == 0);
+        pool.deallocate(ptr2, 64, alignof(std::max_align_t));
+    }
+
+    SUBCASE("Separate size classes") {
+        void* small = pool.allocate(16, alignof(std::max_align_t));
+        pool.deallocate(small, 16, alignof(std::max_align_t));
+        void* large = pool.allocate(200, alignof(std::max_align_t));
+        CHECK(large != small);
+        pool.deallocate(large, 200, alignof(std::max_align_t));
+        CHECK(pool.freeBlocks() == 2);
+    }
+
+    SUBCASE("Large objects use global allocator") {
+        void* ptr = pool.allocate(4096, alignof(std::max_align_t));
+        pool.deallocate(ptr, 4096, alignof(std::max_align_t));
+        CHECK(pool.freeBlocks() == 0);
+    }
+
+    SUBCASE("Limit free blocks") {
+        std::array<void*, detail::BlockPool::maxFreeBlocks + 1> blocks{};
+        for (auto& block : blocks) {
+            block = pool.allocate(8, alignof(std::max_align_t));
+        }
+        for (auto* block : blocks) {
+            pool.deallocate(block, 8, alignof(std::max_align_t));
+        }
+        CHECK(pool.freeBlocks() == detail::BlockPool::maxFreeBlocks);
+    }
+
+    SUBCASE("makePooled") {
+        auto ptr = detail::makePooled<std::string>(pool, "pooled string exceeding small buffers");
+        CHECK(*ptr == "pooled string exceeding small buffers");
+        ptr.reset();
+        CHECK(pool.freeBlocks() == 1);
+    }
+}
+
+TEST_CASE("SlabAllocator") {
+    detail::SlabAllocator<std::array<uint64_t, 3>, 4> allocator;
+    CHECK(allocator.slabCount() == 0);
+
+    std::array<void*, 5> ptrs{};
+    for (auto& ptr : ptrs) {
+        ptr = allocator.allocate();
+    }
+    CHECK(allocator.slabCount() == 2);
+    // slots of a slab are contiguous
+    CHECK(static_cast<std::byte*>(ptrs[1]) - static_cast<std::byte*>(ptrs[0]) == 24);
+
+    allocator.deallocate(ptrs[2]);
+    CHECK(allocator.allocate() == ptrs[2]);  // reuse released slot
+    CHECK(allocator.slabCount() == 2);
+    for (auto* ptr : ptrs) {
+        allocator.deallocate(ptr);
+    }
+}
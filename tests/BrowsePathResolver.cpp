@@ -0,0 +1,101 @@
+#include <string>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/BrowsePathResolver.h"
+#include "open62541pp/Event.h"
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/Subscription.h"
+#include "open62541pp/services/NodeManagement.h"
+
+#include "helper/ServerClientSetup.h"
+
+using namespace opcua;
+
+TEST_CASE("BrowsePathResolver") {
+    ServerClientSetup setup;
+    auto& server = setup.server;
+    auto& client = setup.client;
+
+    // Objects/Line1/Motor{1,2,3}/{Speed,Torque}
+    const NodeId lineId{1, "Line1"};
+    services::addFolder(server, ObjectId::ObjectsFolder, lineId, "Line1");
+    std::vector<std::vector<QualifiedName>> paths;
+    std::vector<NodeId> expected;
+    for (int i = 1; i <= 3; ++i) {
+        const std::string motor = "Motor" + std::to_string(i);
+        const NodeId motorId{1, motor};
+        services::addObject(server, lineId, motorId, motor);
+        for (const std::string variable : {"Speed", "Torque"}) {
+            const NodeId variableId{1, motor + "." + variable};
+            services::addVariable(server, motorId, variableId, variable);
+            paths.push_back({{1, "Line1"}, {1, motor}, {1, variable}});
+            expected.push_back(variableId);
+        }
+    }
+
+    setup.client.connect(setup.endpointUrl);
+    BrowsePathResolver resolver(client);
+    CHECK(resolver.cachedSegments() == 0);
+    CHECK(resolver.requestCount() == 0);
+
+    SUBCASE("Resolve batch level by level") {
+        CHECK(resolver.resolvePaths(ObjectId::ObjectsFolder, paths) == expected);
+        CHECK(resolver.requestCount() == 3);  // one request per level
+        CHECK(resolver.cachedSegments() == 1 + 3 + 6);
+
+        // cached
+        CHECK(resolver.resolvePaths(ObjectId::ObjectsFolder, paths) == expected);
+        CHECK(resolver.requestCount() == 3);
+    }
+
+    SUBCASE("Resolve single path with cached prefix") {
+        resolver.resolvePath(ObjectId::ObjectsFolder, {{1, "Line1"}});
+        CHECK(resolver.requestCount() == 1);
+        const NodeId id = resolver.resolvePath(ObjectId::ObjectsFolder, paths.at(0));
+        CHECK(id == expected.at(0));
+        CHECK(resolver.requestCount() == 3);  // Motor1, Speed
+    }
+
+    SUBCASE("Unresolved paths") {
+        const std::vector<std::vector<QualifiedName>> invalidPaths{
+            {{1, "Line1"}, {1, "Motor9"}, {1, "Speed"}},
+            {{1, "Line1"}, {1, "Motor9"}, {1, "Torque"}},
+            {{1, "Line1"}, {1, "Motor1"}, {1, "Speed"}},
+        };
+        const auto ids = resolver.resolvePaths(ObjectId::ObjectsFolder, invalidPaths);
+        CHECK(ids.at(0).isNull());
+        CHECK(ids.at(1).isNull());
+        CHECK(ids.at(2) == expected.at(0));
+        CHECK(resolver.requestCount() == 3);
+
+        // unresolved segments are cached
+        CHECK(resolver.resolvePath(ObjectId::ObjectsFolder, invalidPaths.at(0)).isNull());
+        CHECK(resolver.requestCount() == 3);
+    }
+
+    SUBCASE("Invalidate") {
+        resolver.resolvePaths(ObjectId::ObjectsFolder, paths);
+        resolver.invalidate();
+        CHECK(resolver.cachedSegments() == 0);
+        CHECK(resolver.resolvePaths(ObjectId::ObjectsFolder, paths) == expected);
+        CHECK(resolver.requestCount() == 6);
+    }
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+    SUBCASE("Invalidate on model change") {
+        auto sub = client.createSubscription();
+        resolver.invalidateOnModelChange(sub);
+        resolver.resolvePaths(ObjectId::ObjectsFolder, paths);
+        CHECK(resolver.cachedSegments() > 0);
+
+        Event event(server, ObjectTypeId::GeneralModelChangeEventType);
+        event.trigger();
+        for (int i = 0; i < 100 && resolver.cachedSegments() > 0; ++i) {
+            client.runIterate(10);
+        }
+        CHECK(resolver.cachedSegments() == 0);
+    }
+#endif
+}
@@ -1,12 +1,23 @@
 #include <chrono>
+#include <cstdio>  // remove
+#include <future>
+#include <mutex>
+#include <string>
 #include <string_view>
 #include <thread>
+#include <utility>  // exchange
+#include <vector>
 
 #include <doctest/doctest.h>
 
 #include "open62541pp/AccessControl.h"
 #include "open62541pp/Client.h"
+#include "open62541pp/ConnectionCache.h"
 #include "open62541pp/Server.h"
+#include "open62541pp/Subscription.h"
+#include "open62541pp/detail/ClientContext.h"
+#include "open62541pp/services/Attribute.h"
+#include "open62541pp/services/detail/ClientService.h"  // withRegisteredNodes
 
 #include "open62541_impl.h"
 
@@ -131,6 +142,189 @@ TEST_CASE("Client run/stop") {
     CHECK_FALSE(client.isRunning());
 }
 
+TEST_CASE("Client connection cache") {
+    Server server;
+    ServerRunner serverRunner(server);
+
+    Client client;
+    CHECK_THROWS_AS(client.reconnect(), BadStatus);
+    client.connect(localServerUrl);
+    const auto cache = client.getConnectionCache();
+    CHECK(cache.endpointUrl == localServerUrl);
+    CHECK(cache.namespaceArray == client.getNamespaceArray());
+#if UAPP_OPEN62541_VER_GE(1, 1)
+    CHECK(!cache.endpoint.getEndpointUrl().empty());
+#endif
+
+    SUBCASE("Reconnect") {
+        client.reconnect();
+        CHECK(client.isConnected());
+    }
+
+    SUBCASE("Seed client") {
+        Client seeded;
+        seeded.setConnectionCache(cache);
+        seeded.connect(localServerUrl);
+        CHECK(seeded.isConnected());
+        CHECK(seeded.getNamespaceArray() == cache.namespaceArray);
+    }
+
+#if UAPP_OPEN62541_VER_GE(1, 3)
+    SUBCASE("Save and load") {
+        const char* path = "connection.cache";
+        saveConnectionCache(path, cache);
+        const auto loaded = loadConnectionCache(path);
+        std::remove(path);
+        REQUIRE(loaded.has_value());
+        CHECK(loaded->endpointUrl == cache.endpointUrl);
+        CHECK(loaded->endpoint.getEndpointUrl() == cache.endpoint.getEndpointUrl());
+        CHECK(loaded->namespaceArray == cache.namespaceArray);
+    }
+#endif
+
+    SUBCASE("Load missing file") {
+        CHECK_FALSE(loadConnectionCache("missing.cache").has_value());
+    }
+}
+
+TEST_CASE("Client registered nodes") {
+    Server server;
+    ServerRunner serverRunner(server);
+    Client client;
+    const NodeId id(0, UA_NS0ID_SERVER);
+    const std::vector<NodeId> ids{id};
+
+    // registered before connect, registered with the server on connect
+    client.registerNodes(ids);
+    CHECK(client.getRegisteredNodeId(id) == id);
+    client.connect(localServerUrl);
+    CHECK_FALSE(client.getRegisteredNodeId(id).isNull());
+
+    const auto dv = services::readAttribute(client, id, AttributeId::BrowseName);
+    CHECK(dv.getValue().getScalar<QualifiedName>().getName() == "Server");
+
+    // open62541 returns the original node ids as aliases, fake an alias to observe substitution
+    auto& registry = detail::getContext(client).registeredNodes;
+    const NodeId alias(0, UA_NS0ID_SERVER_SERVERSTATUS);
+    const NodeId registered = std::exchange(registry.at(id), alias);
+    CHECK(client.getRegisteredNodeId(id) == alias);
+
+    SUBCASE("Substituted in requests") {
+        const NodeId other(0, UA_NS0ID_OBJECTSFOLDER);
+        std::vector<UA_ReadValueId> items(2);
+        items[0].nodeId = *id.handle();
+        items[1].nodeId = *other.handle();
+        UA_ReadRequest request{};
+        request.nodesToReadSize = items.size();
+        request.nodesToRead = items.data();
+        std::vector<NodeId> sent;
+        services::detail::withRegisteredNodes(client, request, [&](const UA_ReadRequest& r) {
+            for (size_t i = 0; i < r.nodesToReadSize; ++i) {
+                sent.emplace_back(r.nodesToRead[i].nodeId);  // NOLINT
+            }
+        });
+        CHECK(sent == std::vector<NodeId>{alias, other});
+        CHECK(asWrapper<NodeId>(items[0].nodeId) == id);  // original request unchanged
+    }
+
+    SUBCASE("Substituted in sync requests") {
+        const auto result = services::readAttribute(client, id, AttributeId::BrowseName);
+        CHECK(result.getValue().getScalar<QualifiedName>().getName() == "ServerStatus");
+    }
+
+    SUBCASE("Substituted in async requests") {
+        auto future = services::readAttributeAsync(
+            client, id, AttributeId::BrowseName, TimestampsToReturn::Neither, useFuture
+        );
+        while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            client.runIterate(10);
+        }
+        CHECK(future.get().getValue().getScalar<QualifiedName>().getName() == "ServerStatus");
+    }
+
+    registry.at(id) = registered;
+    client.unregisterNodes(ids);
+    CHECK(client.getRegisteredNodeId(id) == id);
+}
+
+TEST_CASE("Client background network thread") {
+    Server server;
+    ServerRunner serverRunner(server);
+    Client client;
+    client.connect(localServerUrl);
+    client.runInBackground();
+    CHECK(client.isRunning());
+    CHECK_FALSE(client.isNetworkThread());
+
+    SUBCASE("Submit from other threads") {
+        std::vector<std::future<bool>> futures;
+        std::vector<std::thread> threads;
+        std::mutex mutex;
+        for (int i = 0; i < 4; ++i) {
+            threads.emplace_back([&] {
+                auto future = client.submit([](Client& c) { return c.isNetworkThread(); });
+                const std::lock_guard lock(mutex);
+                futures.push_back(std::move(future));
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        for (auto& future : futures) {
+            CHECK(future.get());
+        }
+    }
+
+    SUBCASE("Async service initiated on network thread") {
+        std::promise<std::string> promise;
+        client.post([&] {
+            services::readAttributeAsync(
+                client,
+                NodeId(0, UA_NS0ID_SERVER),
+                AttributeId::BrowseName,
+                TimestampsToReturn::Neither,
+                [&](StatusCode code, DataValue& dv) {
+                    CHECK(code.isGood());
+                    CHECK(client.isNetworkThread());
+                    promise.set_value(
+                        std::string(dv.getValue().getScalar<QualifiedName>().getName())
+                    );
+                }
+            );
+        });
+        CHECK(promise.get_future().get() == "Server");
+    }
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+    SUBCASE("Batched data change delivery") {
+        std::promise<void> delivered;
+        bool notified = false;
+        auto future = client.submit([&](Client& c) {
+            auto sub = c.createSubscription(
+                SubscriptionParameters{},
+                [&](uint32_t, Span<services::MonitoredItemNotification>) {
+                    if (!std::exchange(notified, true)) {
+                        delivered.set_value();
+                    }
+                }
+            );
+            sub.subscribeDataChange(
+                VariableId::Server_ServerStatus_CurrentTime,
+                AttributeId::Value,
+                [](const auto&, const DataValue&) {}
+            );
+            return sub;
+        });
+        auto sub = future.get();
+        CHECK(delivered.get_future().wait_for(5s) == std::future_status::ready);
+        client.submit([&](Client&) { sub.deleteSubscription(); }).get();
+    }
+#endif
+
+    client.stop();
+    CHECK_FALSE(client.isRunning());
+}
+
 TEST_CASE("Client state callbacks") {
     Server server;
     ServerRunner serverRunner(server);
@@ -177,6 +371,15 @@ TEST_CASE("Client configuration") {
         client.setTimeout(333);
         CHECK(config->timeout == 333);
     }
+
+    SUBCASE("Set transport settings") {
+        client.setTransportSettings(TransportSettings::largePayload());
+        CHECK(config->localConnectionConfig.sendBufferSize == (1U << 20U));
+        CHECK(config->localConnectionConfig.recvBufferSize == (1U << 20U));
+        client.setTransportSettings(TransportSettings::lowLatency());
+        CHECK(config->localConnectionConfig.localMaxMessageSize == 65535);
+        CHECK(config->localConnectionConfig.localMaxChunkCount == 1);
+    }
 }
 
 TEST_CASE("Client methods") {
@@ -192,3 +395,155 @@ TEST_CASE("Client methods") {
         CHECK(namespaces.at(1) == "urn:open62541.server.application");
     }
 }
+
+TEST_CASE("Client operation limits") {
+    Server server;
+    auto* config = UA_Server_getConfig(server.handle());
+    config->maxNodesPerRead = 5;
+    config->maxNodesPerWrite = 7;
+    ServerRunner serverRunner(server);
+    Client client;
+    client.connect(localServerUrl);
+
+    SUBCASE("Get operation limits") {
+        const auto& limits = client.getOperationLimits();
+        CHECK(limits.maxNodesPerRead == 5);
+        CHECK(limits.maxNodesPerWrite == 7);
+    }
+
+    SUBCASE("Chunked read of oversized request") {
+        std::vector<ReadValueId> items;
+        for (uint32_t i = 0; i < 12; ++i) {
+            items.emplace_back(NodeId(0, UA_NS0ID_SERVER + i), AttributeId::NodeId);
+        }
+        const ReadRequest request({}, 0.0, TimestampsToReturn::Neither, items);
+        const auto response = services::read(client, request);
+        CHECK(response.getResponseHeader().getServiceResult().isGood());
+        const auto results = response.getResults();
+        CHECK(results.size() == items.size());
+        for (size_t i = 0; i < results.size(); ++i) {
+            if (results[i].getStatus().isGood()) {
+                CHECK(results[i].getValue().getScalar<NodeId>() == items[i].getNodeId());
+            }
+        }
+    }
+}
+
+TEST_CASE("Client request window") {
+    Server server;
+    ServerRunner serverRunner(server);
+    Client client;
+    client.connect(localServerUrl);
+    client.setRequestWindow(1, 3);
+
+    std::vector<int> order;
+    auto readAsync = [&](int tag) {
+        services::readAttributeAsync(
+            client,
+            NodeId(0, UA_NS0ID_SERVER),
+            AttributeId::BrowseName,
+            TimestampsToReturn::Neither,
+            [&order, tag](StatusCode code, DataValue&) {
+                CHECK(code.isGood());
+                order.push_back(tag);
+            }
+        );
+    };
+
+    readAsync(0);
+    CHECK(client.getRequestsInFlight() == 1);
+    CHECK(client.getRequestsQueued() == 0);
+    readAsync(1);
+    readAsync(2);
+    client.setRequestPriority(RequestPriority::High);
+    readAsync(3);
+    client.setRequestPriority(RequestPriority::Normal);
+    CHECK(client.getRequestsInFlight() == 1);
+    CHECK(client.getRequestsQueued() == 3);
+
+    // back-pressure
+    CHECK_THROWS_AS(readAsync(4), BadStatus);
+
+    while (order.size() < 4) {
+        client.runIterate(10);
+    }
+    CHECK(order == std::vector<int>{0, 3, 1, 2});
+    CHECK(client.getRequestsInFlight() == 0);
+    CHECK(client.getRequestsQueued() == 0);
+
+    SUBCASE("Disable window with queued requests") {
+        order.clear();
+        readAsync(0);
+        readAsync(1);
+        readAsync(2);
+        CHECK(client.getRequestsQueued() == 2);
+        client.setRequestWindow(0);
+        CHECK(client.getRequestsQueued() == 0);
+        CHECK(client.getRequestsInFlight() == 3);
+        while (order.size() < 3) {
+            client.runIterate(10);
+        }
+        CHECK(order == std::vector<int>{0, 1, 2});
+    }
+}
+
+TEST_CASE("Client request options") {
+    Server server;
+    ServerRunner serverRunner(server);
+    Client client;
+    client.connect(localServerUrl);
+    const NodeId id(0, UA_NS0ID_SERVER_SERVERSTATUS_CURRENTTIME);
+
+    SUBCASE("Timeout") {
+        auto future = services::readAttributeAsync(
+            client,
+            id,
+            AttributeId::Value,
+            TimestampsToReturn::Neither,
+            withRequestOptions({std::chrono::milliseconds(500)}, useFuture)
+        );
+        while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            client.runIterate(10);
+        }
+        CHECK(future.get().getStatus().isGood());
+    }
+
+    SUBCASE("Cancel outstanding request") {
+        CancellationToken cancellation;
+        std::vector<StatusCode> codes;
+        services::readAttributeAsync(
+            client,
+            id,
+            AttributeId::Value,
+            TimestampsToReturn::Neither,
+            withRequestOptions({{}, cancellation}, [&](StatusCode code, DataValue&) {
+                codes.push_back(code);
+            })
+        );
+        CHECK(cancellation.outstanding() == 1);
+        cancellation.cancel();
+        CHECK(cancellation.outstanding() == 0);
+        REQUIRE(codes.size() == 1);
+        CHECK(codes[0] == UA_STATUSCODE_BADREQUESTCANCELLEDBYCLIENT);
+
+        // late response is discarded
+        for (int i = 0; i < 10; ++i) {
+            client.runIterate(10);
+        }
+        CHECK(codes.size() == 1);
+    }
+
+    SUBCASE("Cancelled token") {
+        CancellationToken cancellation;
+        cancellation.cancel();
+        auto future = services::readAttributeAsync(
+            client,
+            id,
+            AttributeId::Value,
+            TimestampsToReturn::Neither,
+            withRequestOptions({{}, cancellation}, useFuture)
+        );
+        CHECK(future.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+        CHECK_THROWS_AS(future.get(), BadStatus);
+    }
+}
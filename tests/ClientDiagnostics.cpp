@@ -0,0 +1,118 @@
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/Client.h"
+#include "open62541pp/ClientDiagnostics.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/detail/DiagnosticsSampler.h"
+#include "open62541pp/services/Attribute_highlevel.h"
+#include "open62541pp/services/detail/ClientService.h"
+
+#include "helper/Runner.h"
+
+using namespace opcua;
+
+TEST_CASE("DiagnosticsSampler") {
+    detail::DiagnosticsSampler sampler;
+    CHECK_FALSE(sampler.isEnabled());
+
+    const NodeId id(VariableId::Server_ServerStatus_State);
+    UA_ReadValueId item{};
+    item.nodeId = *id.handle();
+    UA_ReadRequest request{};
+    request.nodesToRead = &item;
+    request.nodesToReadSize = 1;
+
+    const auto service = detail::getClientServiceIndex<UA_ReadResponse>();
+    const auto countSampled = [&](size_t requests) {
+        size_t sampled = 0;
+        for (size_t i = 0; i < requests; ++i) {
+            sampled += sampler.sample(service, request).has_value() ? 1 : 0;
+        }
+        return sampled;
+    };
+
+    SUBCASE("Interval") {
+        DiagnosticsSampling sampling;
+        sampling.interval = 4;
+        sampling.returnDiagnostics = 0x1F;
+        sampler.configure(sampling, [](const RequestDiagnostics&) {});
+        CHECK(sampler.isEnabled());
+        CHECK(sampler.sample(service, request) == 0x1F);
+        CHECK(countSampled(12) == 3);
+    }
+
+    SUBCASE("Services") {
+        DiagnosticsSampling sampling;
+#ifdef UA_ENABLE_TYPEDESCRIPTION
+        sampling.services = {"Read"};
+        sampler.configure(sampling, [](const RequestDiagnostics&) {});
+        CHECK(countSampled(3) == 3);
+#endif
+        sampling.services = {"Write"};
+        sampler.configure(sampling, [](const RequestDiagnostics&) {});
+        CHECK(countSampled(3) == 0);
+    }
+
+    SUBCASE("Nodes") {
+        DiagnosticsSampling sampling;
+        sampling.nodes = {NodeId(1, 1000)};
+        sampler.configure(sampling, [](const RequestDiagnostics&) {});
+        CHECK(countSampled(1) == 0);
+        sampling.nodes.push_back(id);
+        sampler.configure(sampling, [](const RequestDiagnostics&) {});
+        CHECK(countSampled(1) == 1);
+    }
+
+    SUBCASE("Disable with empty callback") {
+        DiagnosticsSampling sampling;
+        sampling.interval = 1;
+        sampler.configure(sampling, {});
+        CHECK_FALSE(sampler.isEnabled());
+        CHECK(countSampled(1) == 0);
+    }
+}
+
+TEST_CASE("Client diagnostics sampling") {
+    Server server;
+    ServerRunner serverRunner(server);
+    Client client;
+    client.connect("opc.tcp://localhost:4840");
+
+    std::vector<std::string> services;
+    std::vector<size_t> operations;
+    DiagnosticsSampling sampling;
+    sampling.interval = 1;
+    client.setDiagnosticsSampling(sampling, [&](const RequestDiagnostics& diagnostics) {
+        services.emplace_back(diagnostics.service);
+        operations.push_back(diagnostics.operationDiagnostics.size());
+    });
+
+    SUBCASE("Sampled requests") {
+        // diagnostics are optional, the server might not return any
+        const auto value = services::readValue(client, VariableId::Server_ServerStatus_State);
+        CHECK_FALSE(value.isEmpty());
+    }
+
+    SUBCASE("Deliver returned diagnostics") {
+        UA_DiagnosticInfo infos[2]{};
+        infos[1].hasSymbolicId = true;
+        infos[1].symbolicId = 0;
+        UA_ReadResponse response{};
+        response.diagnosticInfos = infos;
+        response.diagnosticInfosSize = 2;
+        services::detail::deliverDiagnostics(client.handle(), response);
+        REQUIRE(operations.size() == 1);
+        CHECK(operations[0] == 2);
+#ifdef UA_ENABLE_TYPEDESCRIPTION
+        CHECK(services[0] == "Read");
+#endif
+
+        UA_ReadResponse empty{};
+        services::detail::deliverDiagnostics(client.handle(), empty);
+        CHECK(operations.size() == 1);
+    }
+}
@@ -0,0 +1,117 @@
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/Client.h"
+#include "open62541pp/ClientMetrics.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/services/Attribute_highlevel.h"
+
+#include "helper/Runner.h"
+
+using namespace opcua;
+
+constexpr std::string_view localServerUrl{"opc.tcp://localhost:4840"};
+
+TEST_CASE("ClientMetrics") {
+    Server server;
+    ServerRunner serverRunner(server);
+    Client client;
+    client.connect(localServerUrl);
+    const NodeId id(VariableId::Server_ServerStatus_State);
+
+    SUBCASE("Disabled by default") {
+        CHECK_FALSE(client.isMetricsEnabled());
+        services::readValue(client, id);
+        CHECK(client.getMetrics().services.empty());
+    }
+
+    SUBCASE("Sync and async requests") {
+        client.setMetricsEnabled(true);
+        CHECK(client.isMetricsEnabled());
+
+        services::readValue(client, id);
+        auto future = services::readValueAsync(client, id);
+        CHECK(client.getMetrics().inFlight == 1);
+        client.runIterate();
+        future.get();
+
+        auto metrics = client.getMetrics();
+        REQUIRE(metrics.services.size() == 1);
+        const auto& read = metrics.services[0];
+#ifdef UA_ENABLE_TYPEDESCRIPTION
+        CHECK(read.service == "Read");
+        CHECK(metrics.findService("Read") == &read);
+#endif
+        CHECK(read.requests == 2);
+        CHECK(read.badStatus == 0);
+        CHECK(read.timeouts == 0);
+        CHECK(read.latency.count == 2);
+        CHECK(read.latency.sum > 0);
+        CHECK(metrics.inFlight == 0);
+        CHECK(metrics.maxInFlight == 1);
+
+        client.resetMetrics();
+        metrics = client.getMetrics();
+        CHECK(metrics.services.empty());
+        CHECK(metrics.maxInFlight == 0);
+
+        client.setMetricsEnabled(false);
+        services::readValue(client, id);
+        CHECK(client.getMetrics().services.empty());
+    }
+
+    SUBCASE("Request tracer") {
+        struct Tracer : RequestTracer {
+            void* startSpan(const RequestSpan& span) override {
+                services.emplace_back(span.service);
+                return &services.back();
+            }
+
+            void endSpan(void* handle, const RequestSpan& span) override {
+                CHECK(handle == &services.back());
+                CHECK(span.end >= span.start);
+                statuses.push_back(span.status);
+            }
+
+            std::vector<std::string> services;
+            std::vector<StatusCode> statuses;
+        };
+
+        auto tracer = std::make_shared<Tracer>();
+        client.setRequestTracer(tracer);
+        services::readValue(client, id);
+        CHECK(client.getMetrics().services.empty());  // tracing without metrics
+        REQUIRE(tracer->services.size() == 1);
+#ifdef UA_ENABLE_TYPEDESCRIPTION
+        CHECK(tracer->services[0] == "Read");
+#endif
+        REQUIRE(tracer->statuses.size() == 1);
+        CHECK(tracer->statuses[0].isGood());
+
+        client.setRequestTracer(nullptr);
+        services::readValue(client, id);
+        CHECK(tracer->services.size() == 1);
+    }
+
+    SUBCASE("Prometheus export") {
+        client.setMetricsEnabled(true);
+        services::readValue(client, id);
+        const auto text = toPrometheus(client.getMetrics());
+        const auto contains = [&](std::string_view line) {
+            return text.find(line) != std::string::npos;
+        };
+        CHECK(contains("# TYPE opcua_client_requests_total counter\n"));
+        CHECK(contains("# TYPE opcua_client_request_duration_seconds histogram\n"));
+        CHECK(contains("opcua_client_requests_in_flight 0\n"));
+#ifdef UA_ENABLE_TYPEDESCRIPTION
+        CHECK(contains(R"(opcua_client_requests_total{service="Read"} 1)"));
+        CHECK(contains(
+            R"(opcua_client_request_duration_seconds_bucket{service="Read",le="+Inf"} 1)"
+        ));
+#endif
+    }
+}
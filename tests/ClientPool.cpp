@@ -0,0 +1,70 @@
+#include <string>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/ClientPool.h"
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/services/Attribute.h"
+
+#include "helper/Runner.h"
+
+using namespace opcua;
+
+constexpr std::string_view localServerUrl{"opc.tcp://localhost:4840"};
+
+TEST_CASE("ClientPool") {
+    Server server;
+    ServerRunner serverRunner(server);
+    ClientPool pool({std::string(localServerUrl)}, {2});
+    CHECK(pool.size() == 2);
+    CHECK(pool.getEndpointUrl(1) == localServerUrl);
+
+    SUBCASE("Acquire without connection") {
+        CHECK(pool.connectedCount() == 0);
+        CHECK_THROWS_AS(pool.acquire(), BadStatus);
+    }
+
+    SUBCASE("Dispatch to least-loaded member") {
+        CHECK(pool.connect() == 2);
+        CHECK(pool.connectedCount() == 2);
+        int completed = 0;
+        auto readAsync = [&](Client& client) {
+            services::readAttributeAsync(
+                client,
+                NodeId(ObjectId::Server),
+                AttributeId::BrowseName,
+                TimestampsToReturn::Neither,
+                [&](StatusCode code, DataValue&) {
+                    CHECK(code.isGood());
+                    ++completed;
+                }
+            );
+            return &client;
+        };
+        Client* first = pool.dispatch(readAsync);
+        Client* second = pool.dispatch(readAsync);
+        CHECK(first != second);
+        CHECK(first->getRequestsInFlight() == 1);
+        CHECK(second->getRequestsInFlight() == 1);
+        while (completed < 2) {
+            pool.runIterate(10);
+        }
+        CHECK(first->getRequestsInFlight() == 0);
+    }
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+    SUBCASE("Spread subscriptions") {
+        pool.connect();
+        auto sub1 = pool.createSubscription();
+        auto sub2 = pool.createSubscription();
+        CHECK(sub1.getConnection() != sub2.getConnection());
+    }
+#endif
+
+    SUBCASE("Disconnect") {
+        pool.connect();
+        pool.disconnect();
+        CHECK(pool.connectedCount() == 0);
+    }
+}
@@ -0,0 +1,96 @@
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/ConditionStore.h"
+#include "open62541pp/Config.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/services/Attribute_highlevel.h"
+#include "open62541pp/services/View.h"
+#include "open62541pp/types/Composed.h"  // BrowsePathResult
+
+using namespace opcua;
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+TEST_CASE("ConditionStore") {
+    Server server;
+    ConditionStore store(server);
+
+    const auto id1 = store.addCondition({ObjectId::Server, "Server", "Condition1"});
+    const auto id2 = store.addCondition({ObjectId::Server, "Server", "Condition2"});
+    CHECK(store.size() == 2);
+    CHECK(store.getDefinition(id2).conditionName == "Condition2");
+    CHECK_FALSE(store.getState(id1).isRetained());
+    CHECK(store.getRetained().empty());
+    CHECK(store.refresh() == 0);
+
+    SUBCASE("Invalid identifier") {
+        CHECK_THROWS_WITH(store.getState(2), "BadInvalidArgument");
+        CHECK_THROWS_WITH(store.setActive(2, true, 100), "BadInvalidArgument");
+        CHECK_THROWS_WITH(store.acknowledge(2), "BadInvalidArgument");
+    }
+
+    SUBCASE("State transitions") {
+        store.setActive(id1, true, 500, {"", "Active"});
+        auto state = store.getState(id1);
+        CHECK(state.active);
+        CHECK_FALSE(state.acked);
+        CHECK_FALSE(state.confirmed);
+        CHECK(state.severity == 500);
+        CHECK(state.isRetained());
+        CHECK(store.getRetained() == std::vector<uint32_t>{id1});
+
+        store.acknowledge(id1);
+        CHECK(store.getState(id1).acked);
+        CHECK_THROWS_WITH(store.acknowledge(id1), "BadConditionBranchAlreadyAcked");
+
+        store.setActive(id1, false, 100);
+        CHECK(store.getState(id1).isRetained());  // not confirmed
+        CHECK(store.refresh() == 1);
+
+        store.confirm(id1);
+        CHECK_THROWS_WITH(store.confirm(id1), "BadConditionBranchAlreadyConfirmed");
+        CHECK_FALSE(store.getState(id1).isRetained());
+    }
+
+    SUBCASE("Condition nodes") {
+        store.setActive(id1, true, 500);
+        store.acknowledge(id1);
+        const auto& conditionId = store.getConditionId(id1);
+        CHECK(conditionId == store.getConditionId(id1));
+        CHECK(conditionId != store.getConditionId(id2));  // materialized on demand
+
+        const auto readStateId = [&](std::string_view state) {
+            const QualifiedName path[] = {{0, state}, {0, "Id"}};
+            const auto result = services::browseSimplifiedBrowsePath(server, conditionId, path);
+            REQUIRE(result.getTargets().size() == 1);
+            return services::readValue(server, result.getTargets()[0].getTargetId().getNodeId())
+                .getScalar<bool>();
+        };
+        CHECK(readStateId("ActiveState"));
+        CHECK(readStateId("AckedState"));
+        CHECK_FALSE(readStateId("ConfirmedState"));
+    }
+
+    SUBCASE("Bulk transitions") {
+        const std::vector<uint32_t> ids{id1, id2, 99};
+        const auto activated = store.setActive(ids, true, 700);
+        REQUIRE(activated.size() == 3);
+        CHECK(activated[0].isGood());
+        CHECK(activated[1].isGood());
+        CHECK(activated[2] == UA_STATUSCODE_BADINVALIDARGUMENT);
+        CHECK(store.getRetained().size() == 2);
+        CHECK(store.refresh() == 2);
+
+        const auto acked = store.acknowledge(ids);
+        CHECK(acked[0].isGood());
+        CHECK(acked[1].isGood());
+        CHECK(store.acknowledge(ids)[0] == UA_STATUSCODE_BADCONDITIONBRANCHALREADYACKED);
+        CHECK(store.getState(id2).acked);
+    }
+}
+#endif
@@ -0,0 +1,102 @@
+#include <cstdint>
+#include <utility>  // pair
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/detail/ContextMap.h"
+#include "open62541pp/detail/Staleable.h"
+
+using namespace opcua::detail;
+
+namespace {
+
+struct Context : Staleable {
+    int value = 0;
+};
+
+}  // namespace
+
+TEST_CASE("ContextMap") {
+    ContextMap<std::pair<uint32_t, uint32_t>, Context> map;
+
+    SUBCASE("Insert, find and erase") {
+        map[{1, 1}]->value = 11;
+        CHECK(map.contains({1, 1}));
+        CHECK(map.find({1, 1})->value == 11);
+        CHECK(map.find({1, 2}) == nullptr);
+        CHECK(map.size() == 1);
+        CHECK(map.erase({1, 1}) == 1);
+        CHECK(map.erase({1, 1}) == 0);
+        CHECK(map.size() == 0);
+    }
+
+    SUBCASE("Reclaim stale objects at next insertion") {
+        auto* item = map[{1, 1}];
+        map[{1, 2}];
+        item->markStale();
+        item->markStale();  // enqueued once
+        size_t visited = 0;
+        map.forEach([&](const auto&, const Context&) { ++visited; });
+        CHECK(visited == 1);  // stale objects are skipped
+        CHECK(map.size() == 2);
+
+        map[{2, 1}];
+        CHECK_FALSE(map.contains({1, 1}));
+        CHECK(map.size() == 2);
+    }
+
+    SUBCASE("Reuse allocations of reclaimed objects") {
+        auto* item = map[{1, 1}];
+        item->value = 42;
+        item->markStale();
+        CHECK(map.reclaim() == 1);
+        auto* reused = map[{2, 1}];
+        CHECK(reused == item);
+        CHECK(reused->value == 0);
+        CHECK_FALSE(reused->stale);
+    }
+
+    SUBCASE("Erase stale object before reclamation") {
+        map[{1, 1}]->markStale();
+        CHECK(map.erase({1, 1}) == 1);
+        CHECK(map.reclaim() == 1);
+        CHECK(map.size() == 0);
+    }
+
+    SUBCASE("Replace stale object in place") {
+        auto* item = map[{1, 1}];
+        item->markStale();
+        auto* replaced = map[{1, 1}];  // reclaimed and reused before the lookup
+        CHECK_FALSE(replaced->stale);
+        CHECK(map.contains({1, 1}));
+        CHECK(map.size() == 1);
+    }
+
+    SUBCASE("Count owned objects") {
+        const auto snapshot = [&] {
+            return map.getMemoryCounter().snapshot(opcua::MemoryCategory::NodeContext, 10);
+        };
+        auto* item = map[{1, 1}];
+        map[{1, 2}];
+        CHECK(snapshot().allocations == 2);
+        CHECK(snapshot().objects == 2);
+        CHECK(snapshot().currentBytes == 20);
+
+        item->markStale();
+        CHECK(map.reclaim() == 1);
+        CHECK(snapshot().objects == 2);  // recycled objects are still owned
+        map[{2, 1}];
+        CHECK(snapshot().allocations == 2);
+
+        CHECK(map.erase({1, 2}) == 1);
+        CHECK(snapshot().objects == 1);
+        CHECK(snapshot().peakBytes == 20);
+    }
+
+    SUBCASE("Erase stale objects without reclamation list") {
+        map[{1, 1}]->stale = true;
+        map[{1, 2}];
+        CHECK(map.eraseStale() == 1);
+        CHECK(map.size() == 1);
+    }
+}
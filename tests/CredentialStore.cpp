@@ -0,0 +1,206 @@
+#include <doctest/doctest.h>
+
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "open62541pp/AccessControl.h"
+#include "open62541pp/CredentialStore.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/Session.h"
+#include "open62541pp/types/ExtensionObject.h"
+
+#include "helper/stringify.h"
+
+#include "CredentialHash.h"
+
+using namespace opcua;
+
+static std::string toHex(const detail::Sha256Digest& digest) {
+    static constexpr std::string_view digits = "0123456789abcdef";
+    std::string result;
+    for (const auto byte : digest) {
+        result.push_back(digits[byte >> 4U]);
+        result.push_back(digits[byte & 0x0fU]);
+    }
+    return result;
+}
+
+TEST_CASE("HMAC-SHA256 (RFC 4231)") {
+    // test case 1
+    CHECK(
+        toHex(detail::hmacSha256(std::string(20, '\x0b'), "Hi There")) ==
+        "b0344c61d8db38535ca8afceaf0bf12b881dc200c9833da726e9376c2e32cff7"
+    );
+    // test case 2
+    CHECK(
+        toHex(detail::hmacSha256("Jefe", "what do ya want for nothing?")) ==
+        "5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843"
+    );
+    // test case 6, key larger than the block size
+    CHECK(
+        toHex(detail::hmacSha256(
+            std::string(131, '\xaa'), "Test Using Larger Than Block-Size Key - Hash Key First"
+        )) == "60e431591ee0b67f0d8a26aacbf5b77f8e0bc6213728c5140546040f0ee37f54"
+    );
+}
+
+TEST_CASE("PBKDF2-HMAC-SHA256") {
+    CHECK_THROWS_AS(detail::pbkdf2HmacSha256("password", "salt", 0), BadStatus);
+    CHECK(
+        toHex(detail::pbkdf2HmacSha256("password", "salt", 1)) ==
+        "120fb6cffcf8b32c43e7225256c4f837a86548c92ccc35480805987cb70be17b"
+    );
+    CHECK(
+        toHex(detail::pbkdf2HmacSha256("password", "salt", 2)) ==
+        "ae4d0c95af6b46d32d0adff928f06dd02a303f8ef3c251dfd6e2d85a95474c43"
+    );
+    CHECK(
+        toHex(detail::pbkdf2HmacSha256("password", "salt", 4096)) ==
+        "c5e478d59288c841aa530db6845c4c8d962893a001ce4e11a4963873aa98134a"
+    );
+    CHECK(
+        toHex(detail::pbkdf2HmacSha256(
+            "passwordPASSWORDpassword", "saltSALTsaltSALTsaltSALTsaltSALTsalt", 4096
+        )) == "348c89dbcbd32b2f32d814b8116e84cf2b17347ebc1800181c4e2a1fb8dd53e1"
+    );
+}
+
+TEST_CASE("PasswordHash") {
+    CHECK_THROWS_AS(PasswordHash::derive("secret", 0), BadStatus);
+
+    const auto hash = PasswordHash::derive("secret", 100);
+    CHECK(hash.iterations == 100);
+    CHECK(hash.matches("secret"));
+    CHECK_FALSE(hash.matches("Secret"));
+    CHECK_FALSE(hash.matches(""));
+
+    // random salt
+    const auto other = PasswordHash::derive("secret", 100);
+    CHECK(other.salt != hash.salt);
+    CHECK(other.key != hash.key);
+    CHECK(other.matches("secret"));
+
+    CHECK_FALSE(PasswordHash{}.matches(""));
+}
+
+TEST_CASE("CredentialStore") {
+    CredentialStoreOptions options;
+    options.iterations = 100;
+    CredentialStore store(options);
+    store.addUser("alice", "secret");
+    store.addUser("bob", PasswordHash::derive("password", 50));
+    CHECK(store.size() == 2);
+
+    SUBCASE("Verify") {
+        CHECK(store.verify("alice", "secret"));
+        CHECK(store.verify("bob", "password"));
+        CHECK_FALSE(store.verify("alice", "password"));
+        CHECK_FALSE(store.verify("unknown", "secret"));
+    }
+
+    SUBCASE("Verification cache") {
+        CHECK(store.verify("alice", "secret"));
+        CHECK(store.getCacheHits() == 0);
+        CHECK(store.verify("alice", "secret"));
+        CHECK(store.getCacheHits() == 1);
+        // wrong password is never served from the cache
+        CHECK_FALSE(store.verify("alice", "wrong"));
+        CHECK(store.getCacheHits() == 1);
+
+        store.clearCache();
+        CHECK(store.verify("alice", "secret"));
+        CHECK(store.getCacheHits() == 1);
+    }
+
+    SUBCASE("Cache disabled") {
+        CredentialStoreOptions uncachedOptions;
+        uncachedOptions.iterations = 100;
+        uncachedOptions.cacheDuration = {};
+        CredentialStore uncached(uncachedOptions);
+        uncached.addUser("alice", "secret");
+        CHECK(uncached.verify("alice", "secret"));
+        CHECK(uncached.verify("alice", "secret"));
+        CHECK(uncached.getCacheHits() == 0);
+    }
+
+    SUBCASE("Replace and remove users") {
+        CHECK(store.verify("alice", "secret"));
+        store.addUser("alice", "changed");
+        CHECK_FALSE(store.verify("alice", "secret"));
+        CHECK(store.verify("alice", "changed"));
+
+        store.removeUser("alice");
+        CHECK(store.size() == 1);
+        CHECK_FALSE(store.verify("alice", "changed"));
+    }
+
+    SUBCASE("Verify async") {
+        auto valid = store.verifyAsync("alice", "secret");
+        auto invalid = store.verifyAsync("bob", "secret");
+        CHECK(valid.get());
+        CHECK_FALSE(invalid.get());
+    }
+
+    SUBCASE("Verify async on a single thread") {
+        CredentialStoreOptions singleOptions;
+        singleOptions.iterations = 100;
+        singleOptions.asyncThreads = 1;
+        std::vector<std::future<bool>> futures;
+        {
+            CredentialStore single(singleOptions);
+            single.addUser("alice", "secret");
+            for (size_t i = 0; i < 32; ++i) {
+                futures.push_back(single.verifyAsync("alice", i % 2 == 0 ? "secret" : "wrong"));
+            }
+        }  // waits for the pending verifications
+        for (size_t i = 0; i < futures.size(); ++i) {
+            CHECK(futures[i].get() == (i % 2 == 0));
+        }
+    }
+}
+
+TEST_CASE("AccessControlDefault with CredentialStore") {
+    Server server;
+    auto store = std::make_shared<CredentialStore>(CredentialStoreOptions{100});
+    store->addUser("username", "password");
+
+    AccessControlDefault ac(false);
+    ac.setCredentialStore(store);
+
+    const auto userTokenPolicies = ac.getUserTokenPolicies();
+    CHECK(userTokenPolicies.size() == 1);
+    CHECK(userTokenPolicies.at(0).getTokenType() == UserTokenType::Username);
+
+    Session session(server, NodeId{});
+    const EndpointDescription endpointDescription{};
+    const ByteString secureChannelRemoteCertificate{};
+
+    const auto activateSessionWithToken = [&](const ExtensionObject& userIdentityToken) {
+        return ac.activateSession(
+            session, endpointDescription, secureChannelRemoteCertificate, userIdentityToken
+        );
+    };
+
+    UserNameIdentityToken token;
+    token.getPolicyId() = String("open62541-username-policy");
+    token.getUserName() = String("username");
+    token.getPassword() = ByteString("wrongpassword");
+    CHECK_EQ(
+        activateSessionWithToken(ExtensionObject::fromDecoded(token)),
+        UA_STATUSCODE_BADUSERACCESSDENIED
+    );
+
+    token.getPassword() = ByteString("password");
+    CHECK_EQ(activateSessionWithToken(ExtensionObject::fromDecoded(token)), UA_STATUSCODE_GOOD);
+
+    token.getUserName() = String("unknown");
+    CHECK_EQ(
+        activateSessionWithToken(ExtensionObject::fromDecoded(token)),
+        UA_STATUSCODE_BADUSERACCESSDENIED
+    );
+}
@@ -1,4 +1,7 @@
+#include <chrono>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include <doctest/doctest.h>
 
@@ -50,6 +53,59 @@ TEST_CASE("Create certificate") {
     }
 }
 
+TEST_CASE("Create certificates with separate key generation") {
+    const std::vector<String> subject{String{"C=DE"}, String{"CN=open62541ppDevice@localhost"}};
+    const std::vector<String> subjectAltName{String{"DNS:localhost"}, String{"URI:urn:device"}};
+
+    SUBCASE("Generate private keys") {
+        const auto keys = crypto::generatePrivateKeys(3, 2048, crypto::CertificateFormat::PEM, 2);
+        CHECK(keys.size() == 3);
+        for (const auto& key : keys) {
+            CHECK(std::string_view(key).substr(0, 10) == "-----BEGIN");
+        }
+        CHECK(keys.at(0) != keys.at(1));
+    }
+
+    SUBCASE("Sign existing private key") {
+        for (auto format : {crypto::CertificateFormat::DER, crypto::CertificateFormat::PEM}) {
+            const auto key = crypto::generatePrivateKeys(1, 2048, format).at(0);
+            CHECK(!crypto::createCertificate(subject, subjectAltName, key).empty());
+        }
+        CHECK_THROWS_AS(
+            crypto::createCertificate(subject, subjectAltName, ByteString("invalid")),
+            CreateCertificateError
+        );
+        CHECK_THROWS_AS(
+            crypto::createCertificate({}, {}, crypto::generatePrivateKeys(1).at(0)),
+            CreateCertificateError
+        );
+    }
+
+    SUBCASE("Batch") {
+        const std::vector<crypto::CertificateRequest> requests(4, {subject, subjectAltName});
+        const auto results = crypto::createCertificates(requests, 2048);
+        CHECK(results.size() == 4);
+        for (const auto& result : results) {
+            CHECK(!result.privateKey.empty());
+            CHECK(!result.certificate.empty());
+        }
+    }
+
+    SUBCASE("Private key pool") {
+        crypto::PrivateKeyPool pool(2048);
+        CHECK(pool.size() == 0);
+        pool.fill(2);
+        CHECK(pool.size() == 2);
+        const auto result = pool.createCertificate(subject, subjectAltName);
+        CHECK(!result.privateKey.empty());
+        CHECK(!result.certificate.empty());
+        CHECK(pool.size() == 1);
+        CHECK(!pool.acquire().empty());
+        CHECK(!pool.acquire().empty());  // empty pool, generated on demand
+        CHECK(pool.size() == 0);
+    }
+}
+
 TEST_CASE("Encrypted connection server/client") {
     const std::string serverApplicationUri = "urn:open62541.server.application";  // default
     const std::string clientApplicationUri = "urn:unconfigured:application";  // default
@@ -102,6 +158,69 @@ TEST_CASE("Encrypted connection server/client") {
         client.setSecurityMode(MessageSecurityMode::SignAndEncrypt);
         CHECK_NOTHROW(client.connect("opc.tcp://localhost:4840"));
     }
+
+#ifdef UAPP_HAS_CRYPTO_OFFLOAD
+    SUBCASE("Connect with offloaded asymmetric decryption") {
+        Server server(
+            4840, certServer.certificate, certServer.privateKey, {certClient.certificate}, {}, {}
+        );
+        server.setAsymmetricCryptoOffload(4);
+        ServerRunner serverRunner(server);
+
+        Client client(certClient.certificate, certClient.privateKey, {certServer.certificate}, {});
+        client.setSecurityMode(MessageSecurityMode::SignAndEncrypt);
+        CHECK_NOTHROW(client.connect("opc.tcp://localhost:4840"));
+    }
+#endif
+
+    SUBCASE("Update trust list at runtime") {
+        // empty trust lists accept all certificates, trust only the server certificate first
+        Server server(
+            4840, certServer.certificate, certServer.privateKey, {certServer.certificate}, {}, {}
+        );
+        server.setCertificateValidationCache(std::chrono::seconds(60));
+        ServerRunner serverRunner(server);
+
+        const auto connect = [&] {
+            Client client(
+                certClient.certificate, certClient.privateKey, {certServer.certificate}, {}
+            );
+            client.setSecurityMode(MessageSecurityMode::SignAndEncrypt);
+            client.connect("opc.tcp://localhost:4840");
+            client.disconnect();
+        };
+
+        CHECK_THROWS(connect());
+        server.setTrustList({certServer.certificate, certClient.certificate}, {});
+        CHECK_NOTHROW(connect());
+        CHECK_NOTHROW(connect());  // cached
+        // cached validation must be invalidated
+        server.setTrustList({certServer.certificate}, {});
+        CHECK_THROWS(connect());
+    }
+
+    SUBCASE("Invalid trust list keeps the current trust list") {
+        Server server(
+            4840, certServer.certificate, certServer.privateKey, {certServer.certificate}, {}, {}
+        );
+        ServerRunner serverRunner(server);
+
+        const auto connect = [&] {
+            Client client(
+                certClient.certificate, certClient.privateKey, {certServer.certificate}, {}
+            );
+            client.setSecurityMode(MessageSecurityMode::SignAndEncrypt);
+            client.connect("opc.tcp://localhost:4840");
+            client.disconnect();
+        };
+
+        CHECK_THROWS(connect());
+        const ByteString malformed("no DER certificate");
+        CHECK_THROWS_AS(server.setTrustList({certClient.certificate, malformed}, {}), BadStatus);
+        CHECK_THROWS(connect());  // client certificate still not trusted, no accept-all fallback
+        server.setTrustList({certServer.certificate, certClient.certificate}, {});
+        CHECK_NOTHROW(connect());
+    }
 }
 
 #endif  // ifdef UAPP_CREATE_CERTIFICATE
@@ -293,6 +293,58 @@ TEST_CASE("CustomAccessControl") {
         CHECK(customAccessControl.getSessions().empty());
     }
 
+    SUBCASE("Cache access decisions") {
+        class AccessControlCounting : public AccessControlDefault {
+        public:
+            Bitmask<AccessLevel> getUserAccessLevel(Session& session, const NodeId& nodeId)
+                override {
+                ++count;
+                return AccessControlDefault::getUserAccessLevel(session, nodeId);
+            }
+
+            size_t count = 0;
+        };
+
+        AccessControlCounting accessControl;
+        accessControl.setDecisionCacheEnabled(true);
+        customAccessControl.setAccessControl(accessControl);
+
+        NodeId sessionId(0, 1000);
+        void* sessionContext = nullptr;
+        native.activateSession(
+            server.handle(),
+            &native,
+            nullptr,  // endpoint description
+            nullptr,  // secure channel remote certificate
+            sessionId.handle(),  // session id
+            nullptr,  // user identity token
+            &sessionContext
+        );
+        CHECK(sessionContext != nullptr);
+
+        const NodeId nodeId(1, 1000);
+        auto getUserAccessLevel = [&](void* context) {
+            return native.getUserAccessLevel(
+                server.handle(), &native, sessionId.handle(), context, nodeId.handle(), nullptr
+            );
+        };
+        const auto accessLevel = getUserAccessLevel(sessionContext);
+        CHECK(getUserAccessLevel(sessionContext) == accessLevel);
+        CHECK(getUserAccessLevel(nullptr) == accessLevel);  // lookup by session id
+        CHECK(accessControl.count == 1);
+
+        accessControl.invalidate();
+        getUserAccessLevel(sessionContext);
+        CHECK(accessControl.count == 2);
+
+        accessControl.setDecisionCacheEnabled(false);
+        getUserAccessLevel(sessionContext);
+        CHECK(accessControl.count == 3);
+
+        native.closeSession(server.handle(), &native, sessionId.handle(), sessionContext);
+        CHECK(customAccessControl.getSessions().empty());
+    }
+
     SUBCASE("Copy user token policies to endpoints") {
         CHECK(config->endpointsSize > 0);
 
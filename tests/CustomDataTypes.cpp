@@ -25,3 +25,39 @@ TEST_CASE("CustomDataTypes") {
     CHECK(dataTypeArray->types[1] == UA_TYPES[UA_TYPES_FLOAT]);
     CHECK(dataTypeArray->types[2] == UA_TYPES[UA_TYPES_STRING]);
 }
+
+TEST_CASE("CustomDataTypes find") {
+    const UA_DataTypeArray* dataTypeArray = nullptr;
+    CustomDataTypes customDataTypes(&dataTypeArray);
+
+    DataType custom(UA_TYPES[UA_TYPES_INT32]);
+    custom.setTypeId({1, 1000});
+    custom.setBinaryEncodingId({1, 1001});
+    customDataTypes.setCustomDataTypes({custom});
+
+    CHECK(customDataTypes.find({1, 1000}) == &dataTypeArray->types[0]);
+    CHECK(customDataTypes.find({1, 1001}) == &dataTypeArray->types[0]);
+    CHECK(customDataTypes.find({0, UA_NS0ID_FLOAT}) == &UA_TYPES[UA_TYPES_FLOAT]);
+    CHECK(customDataTypes.find({1, 9999}) == nullptr);
+}
+
+TEST_CASE("CustomDataTypes passthrough") {
+    const UA_DataTypeArray* dataTypeArray = nullptr;
+    CustomDataTypes customDataTypes(&dataTypeArray);
+
+    DataType custom(UA_TYPES[UA_TYPES_INT32]);
+    custom.setTypeId({1, 1000});
+    custom.setBinaryEncodingId({1, 1001});
+    DataType passthrough(UA_TYPES[UA_TYPES_INT32]);
+    passthrough.setTypeId({1, 2000});
+    passthrough.setBinaryEncodingId({1, 2001});
+    customDataTypes.setPassthroughDataTypes({passthrough});
+    customDataTypes.setCustomDataTypes({custom});
+
+    // passthrough data types are not passed to the decoder
+    CHECK(dataTypeArray->typesSize == 1);
+    CHECK(customDataTypes.find({1, 1001}) == &dataTypeArray->types[0]);
+    const auto* found = customDataTypes.find({1, 2001});
+    REQUIRE(found != nullptr);
+    CHECK(DataType(*found).getTypeId() == NodeId(1, 2000));
+}
@@ -172,7 +172,41 @@ TEST_CASE("DataTypeBuilder") {
                 .addField<&Point::z>("z")
                 .build();
 
-        checkDataTypeEqual(dt, pointType);
+        // packed struct of floats is overlayable if floats are overlayable on this platform
+        DataType expected(pointType);
+        expected.setOverlayable(UA_TYPES[UA_TYPES_FLOAT].overlayable);
+        checkDataTypeEqual(dt, expected);
+    }
+
+    SUBCASE("Struct with padding is not overlayable") {
+        struct Padded {
+            uint8_t a;
+            uint32_t b;
+        };
+
+        const auto dt = DataTypeBuilder<Padded>::createStructure("Padded", {1, 1003}, {1, 3})
+                            .addField<&Padded::a>("a")
+                            .addField<&Padded::b>("b")
+                            .build();
+
+        CHECK(dt.getPointerFree() == true);
+        CHECK(dt.getOverlayable() == false);
+    }
+
+    SUBCASE("Packed struct of integers is overlayable") {
+        struct Sample {
+            uint32_t x;
+            uint32_t y;
+            uint32_t ts;
+        };
+
+        const auto dt = DataTypeBuilder<Sample>::createStructure("Sample", {1, 1004}, {1, 4})
+                            .addField<&Sample::x>("x")
+                            .addField<&Sample::y>("y")
+                            .addField<&Sample::ts>("ts")
+                            .build();
+
+        CHECK(dt.getOverlayable() == static_cast<bool>(UA_TYPES[UA_TYPES_UINT32].overlayable));
     }
 
     SUBCASE("Struct with array") {
@@ -335,3 +369,25 @@ TEST_CASE("DataTypeBuilder") {
         CHECK(dtNative == dtWrapper);
     }
 }
+
+TEST_CASE("buildDataTypeOnce") {
+    int calls = 0;
+    const auto build = [&] {
+        ++calls;
+        return DataTypeBuilder<Point>::createStructure("Point", {1, 1001}, {1, 1})
+            .addField<&Point::x>("x")
+            .addField<&Point::y>("y")
+            .addField<&Point::z>("z")
+            .build();
+    };
+    const DataType& dt1 = buildDataTypeOnce<Point>(build);
+    const DataType& dt2 = buildDataTypeOnce<Point>(build);
+    CHECK(calls == 1);
+    CHECK(&dt1 == &dt2);
+    CHECK(dt1.getMembers().size() == 3);
+
+    // keyed on the built type, not on the build function
+    const DataType& dt3 = buildDataTypeOnce<Point>([&] { return build(); });
+    CHECK(calls == 1);
+    CHECK(&dt3 == &dt1);
+}
@@ -0,0 +1,213 @@
+#include <string>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/Config.h"
+#include "open62541pp/DataTypeBuilder.h"
+#include "open62541pp/DataTypeDiscovery.h"
+#include "open62541pp/Encoding.h"
+#include "open62541pp/TypeRegistry.h"  // UA_StructureDefinition, UA_EnumDefinition
+#include "open62541pp/services/NodeManagement.h"
+
+#include "helper/ServerClientSetup.h"
+
+using namespace opcua;
+
+#if UAPP_OPEN62541_VER_GE(1, 3)
+struct FieldDescription {
+    const char* name;
+    NodeId dataType;
+    int32_t valueRank = UA_VALUERANK_SCALAR;
+    bool isOptional = false;
+};
+
+static DiscoveredDataType createStructure(
+    const NodeId& typeId,
+    const char* name,
+    const std::vector<FieldDescription>& fields,
+    UA_StructureType structureType = UA_STRUCTURETYPE_STRUCTURE
+) {
+    UA_StructureDefinition sd{};
+    sd.defaultEncodingId = UA_NODEID_NUMERIC(
+        typeId.getNamespaceIndex(), 10000 + typeId.handle()->identifier.numeric
+    );
+    sd.structureType = structureType;
+    sd.fieldsSize = fields.size();
+    sd.fields = static_cast<UA_StructureField*>(
+        UA_Array_new(fields.size(), &UA_TYPES[UA_TYPES_STRUCTUREFIELD])
+    );
+    for (size_t i = 0; i < fields.size(); ++i) {
+        sd.fields[i].name = UA_STRING_ALLOC(fields[i].name);
+        UA_NodeId_copy(fields[i].dataType.handle(), &sd.fields[i].dataType);
+        sd.fields[i].valueRank = fields[i].valueRank;
+        sd.fields[i].isOptional = fields[i].isOptional;
+    }
+    Variant definition;
+    definition.setScalarCopy(sd);
+    UA_StructureDefinition_clear(&sd);
+    return {typeId, name, std::move(definition)};
+}
+
+static DiscoveredDataType createEnum(const NodeId& typeId, const char* name) {
+    UA_EnumDefinition ed{};
+    Variant definition;
+    definition.setScalarCopy(ed);
+    return {typeId, name, std::move(definition)};
+}
+
+TEST_CASE("createDataTypeRegistry") {
+    const NodeId doubleId(DataTypeId::Double);
+    const NodeId byteId(DataTypeId::Byte);
+    const NodeId stringId(DataTypeId::String);
+
+    SUBCASE("Structure") {
+        const std::vector<DiscoveredDataType> definitions{
+            createStructure({1, 1}, "Point", {{"x", doubleId}, {"y", doubleId}}),
+        };
+        const auto registry = createDataTypeRegistry(definitions);
+        REQUIRE(registry->getDataTypes().size() == 1);
+        const auto& dt = registry->getDataTypes()[0];
+        CHECK(dt.getTypeId() == NodeId(1, 1));
+        CHECK(dt.getBinaryEncodingId() == NodeId(1, 10001));
+        CHECK(dt.getTypeKind() == UA_DATATYPEKIND_STRUCTURE);
+        CHECK(dt.getMemSize() == 2 * sizeof(double));
+        CHECK(dt.getPointerFree());
+        REQUIRE(dt.getMembers().size() == 2);
+        CHECK(dt.getMembers()[0].padding == 0);
+        CHECK(dt.getMembers()[1].padding == 0);
+        CHECK(registry->find({1, 10001}) == asNative(&dt));
+    }
+
+    SUBCASE("Padding and arrays") {
+        const std::vector<DiscoveredDataType> definitions{
+            createStructure(
+                {1, 1},
+                "Sample",
+                {{"flag", byteId}, {"value", doubleId}, {"names", stringId, 1}}
+            ),
+        };
+        const auto registry = createDataTypeRegistry(definitions);
+        REQUIRE(registry->getDataTypes().size() == 1);
+        const auto& dt = registry->getDataTypes()[0];
+        CHECK(dt.getMemSize() == 8 + sizeof(double) + sizeof(size_t) + sizeof(void*));
+        CHECK_FALSE(dt.getPointerFree());
+        REQUIRE(dt.getMembers().size() == 3);
+        CHECK(dt.getMembers()[1].padding == 7);
+        CHECK(dt.getMembers()[2].isArray);
+    }
+
+    SUBCASE("Optional fields and unions") {
+        const std::vector<DiscoveredDataType> definitions{
+            createStructure(
+                {1, 1},
+                "Optional",
+                {{"value", doubleId, UA_VALUERANK_SCALAR, true}},
+                UA_STRUCTURETYPE_STRUCTUREWITHOPTIONALFIELDS
+            ),
+            createStructure(
+                {1, 2}, "Union", {{"a", byteId}, {"b", doubleId}}, UA_STRUCTURETYPE_UNION
+            ),
+        };
+        const auto registry = createDataTypeRegistry(definitions);
+        REQUIRE(registry->getDataTypes().size() == 2);
+        const auto& optional = registry->getDataTypes()[0];
+        CHECK(optional.getTypeKind() == UA_DATATYPEKIND_OPTSTRUCT);
+        CHECK(optional.getMemSize() == sizeof(void*));
+        CHECK(optional.getMembers()[0].isOptional);
+        const auto& uni = registry->getDataTypes()[1];
+        CHECK(uni.getTypeKind() == UA_DATATYPEKIND_UNION);
+        CHECK(uni.getMemSize() == 16);
+        CHECK(uni.getMembers()[0].padding == 8);
+        CHECK(uni.getMembers()[1].padding == 8);
+    }
+
+    SUBCASE("Nested custom types") {
+        const std::vector<DiscoveredDataType> definitions{
+            createStructure({1, 1}, "Outer", {{"inner", {1, 2}}, {"kind", {1, 3}}}),
+            createStructure({1, 2}, "Inner", {{"x", doubleId}}),
+            createEnum({1, 3}, "Kind"),
+            createStructure({1, 4}, "Node", {{"children", {1, 4}, 1}}),  // self reference
+        };
+        const auto registry = createDataTypeRegistry(definitions);
+        REQUIRE(registry->getDataTypes().size() == 4);
+        const auto* outer = registry->find({1, 1});
+        const auto* inner = registry->find({1, 2});
+        const auto* kind = registry->find({1, 3});
+        const auto* node = registry->find({1, 4});
+        REQUIRE(outer != nullptr);
+        CHECK(outer->memSize == 16);
+        CHECK(outer->members[0].memberType == inner);
+        CHECK(outer->members[1].memberType == kind);
+        CHECK(kind->typeKind == UA_DATATYPEKIND_ENUM);
+        CHECK(node->members[0].memberType == node);
+    }
+
+    SUBCASE("Unsupported definitions are skipped with their dependents") {
+        const std::vector<DiscoveredDataType> definitions{
+            createStructure({1, 1}, "Unknown", {{"x", {1, 999}}}),
+            createStructure({1, 2}, "Dependent", {{"unknown", {1, 1}, 1}}),
+            createStructure({1, 3}, "Matrix", {{"values", doubleId, 2}}),
+            createStructure({1, 4}, "Valid", {{"x", doubleId}}),
+        };
+        const auto registry = createDataTypeRegistry(definitions);
+        REQUIRE(registry->getDataTypes().size() == 1);
+        CHECK(registry->getDataTypes()[0].getTypeId() == NodeId(1, 4));
+    }
+
+    SUBCASE("Decode with created data type") {
+        const std::vector<DiscoveredDataType> definitions{
+            createStructure({1, 1}, "Sample", {{"value", doubleId}, {"name", stringId}}),
+        };
+        const auto registry = createDataTypeRegistry(definitions);
+        const auto& dt = registry->getDataTypes()[0];
+        struct Sample {
+            double value;
+            UA_String name;
+        };
+        REQUIRE(dt.getMemSize() == sizeof(Sample));
+        Sample sample{1.5, UA_STRING(const_cast<char*>("test"))};  // NOLINT
+        const auto encoded = encodeBinary(sample, dt);
+        BinaryDecoder decoder;
+        decoder.append({encoded->data, encoded->length});
+        auto decoded = decoder.next<Sample>(dt);
+        REQUIRE(decoded.has_value());
+        CHECK(decoded->value == 1.5);
+        CHECK(detail::toStringView(decoded->name) == "test");
+        UA_clear(&*decoded, dt.handle());
+    }
+}
+#endif
+
+#if UAPP_OPEN62541_VER_GE(1, 4) && defined(UA_ENABLE_TYPEDESCRIPTION)
+TEST_CASE("discoverDataTypes") {
+    struct Point {
+        double x;
+        double y;
+    };
+
+    ServerClientSetup setup;
+    const auto ns = setup.server.registerNamespace("http://open62541pp.org/test/types/");
+    const auto pointType = DataTypeBuilder<Point>::createStructure("Point", {ns, 5000}, {ns, 5001})
+                               .addField<&Point::x>("x")
+                               .addField<&Point::y>("y")
+                               .build();
+    setup.server.setCustomDataTypes({pointType});
+    services::addDataType(setup.server, DataTypeId::Structure, {ns, 5000}, "Point");
+    setup.client.connect(setup.endpointUrl);
+
+    const std::vector<std::string> namespaceUris{"http://open62541pp.org/test/types/"};
+    const auto registry = discoverDataTypes(setup.client, namespaceUris);
+    REQUIRE(registry->getDataTypes().size() == 1);
+    const auto& dt = registry->getDataTypes()[0];
+    CHECK(dt.getTypeId() == NodeId(ns, 5000));
+    CHECK(dt.getBinaryEncodingId() == NodeId(ns, 5001));
+    CHECK(dt.getMemSize() == sizeof(Point));
+    CHECK(std::string(dt.getTypeName()) == "Point");
+
+    setup.client.setDataTypeRegistry(registry);
+    CHECK(setup.client.findDataType({ns, 5001}) == asNative(&dt));
+
+    CHECK_THROWS(discoverDataTypes(setup.client, std::vector<std::string>{"http://unknown"}));
+}
+#endif
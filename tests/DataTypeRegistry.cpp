@@ -0,0 +1,108 @@
+#include <memory>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/Client.h"
+#include "open62541pp/DataType.h"
+#include "open62541pp/DataTypeRegistry.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/open62541.h"
+
+#include "CustomDataTypes.h"
+
+using namespace opcua;
+
+TEST_CASE("DataTypeRegistry") {
+    DataType custom(UA_TYPES[UA_TYPES_INT32]);
+    custom.setTypeId({1, 1000});
+    custom.setBinaryEncodingId({1, 1001});
+    DataType passthrough(UA_TYPES[UA_TYPES_INT32]);
+    passthrough.setTypeId({1, 2000});
+    passthrough.setBinaryEncodingId({1, 2001});
+
+    const auto registry = std::make_shared<const DataTypeRegistry>(
+        std::vector<DataType>{custom}, std::vector<DataType>{passthrough}
+    );
+
+    SUBCASE("Data types and lookup") {
+        CHECK(registry->getDataTypes().size() == 1);
+        CHECK(registry->getPassthroughDataTypes().size() == 1);
+        CHECK(registry->array()->next == nullptr);
+        CHECK(registry->array()->typesSize == 1);
+        CHECK(registry->find({1, 1000}) == &registry->array()->types[0]);
+        CHECK(registry->find({1, 1001}) == &registry->array()->types[0]);
+        REQUIRE(registry->find({1, 2001}) != nullptr);
+        CHECK(DataType(*registry->find({1, 2001})).getTypeId() == NodeId(1, 2000));
+        CHECK(registry->find({0, UA_NS0ID_FLOAT}) == nullptr);
+    }
+
+    SUBCASE("Shared by CustomDataTypes") {
+        const UA_DataTypeArray* array1 = nullptr;
+        const UA_DataTypeArray* array2 = nullptr;
+        CustomDataTypes customDataTypes1(&array1);
+        CustomDataTypes customDataTypes2(&array2);
+        customDataTypes1.setRegistry(registry);
+        customDataTypes2.setRegistry(registry);
+
+        CHECK(array1 == registry->array());
+        CHECK(array2 == registry->array());
+        CHECK(customDataTypes1.find({1, 1001}) == customDataTypes2.find({1, 1001}));
+        CHECK(customDataTypes1.find({0, UA_NS0ID_FLOAT}) == &UA_TYPES[UA_TYPES_FLOAT]);
+        CHECK(registry.use_count() == 3);
+
+        customDataTypes1.setRegistry(nullptr);
+        CHECK(array1 == nullptr);
+        CHECK(customDataTypes1.find({1, 1001}) == nullptr);
+        CHECK(registry.use_count() == 2);
+    }
+
+    SUBCASE("Compose") {
+        const UA_DataTypeArray* array = nullptr;
+        CustomDataTypes customDataTypes(&array);
+        customDataTypes.setRegistry(registry);
+        customDataTypes.setPassthroughDataTypes({});
+        CHECK(customDataTypes.getRegistry() != registry);
+        CHECK(registry.use_count() == 2);  // kept alive by the composed registry
+
+        // custom data types are not copied
+        CHECK(array->types == registry->array()->types);
+        CHECK(customDataTypes.find({1, 1001}) == registry->find({1, 1001}));
+        CHECK(customDataTypes.find({1, 2001}) == nullptr);
+
+        // composing repeatedly only keeps the owners of the data types alive
+        customDataTypes.setPassthroughDataTypes({passthrough});
+        customDataTypes.setPassthroughDataTypes({passthrough});
+        CHECK(registry.use_count() == 2);
+        CHECK(customDataTypes.find({1, 1001}) == registry->find({1, 1001}));
+        REQUIRE(customDataTypes.find({1, 2001}) != nullptr);
+        CHECK(customDataTypes.find({1, 2001}) != registry->find({1, 2001}));
+
+        customDataTypes.setCustomDataTypes({});
+        CHECK(registry.use_count() == 1);
+        CHECK(array->typesSize == 0);
+        CHECK(customDataTypes.find({1, 1001}) == nullptr);
+        CHECK(customDataTypes.find({1, 2001}) != nullptr);
+    }
+
+    SUBCASE("Attach to server and clients") {
+        Server server;
+        Client client1;
+        Client client2;
+        server.setDataTypeRegistry(registry);
+        client1.setDataTypeRegistry(registry);
+        client2.setDataTypeRegistry(registry);
+
+        CHECK(server.getDataTypeRegistry() == registry);
+        CHECK(client1.getDataTypeRegistry() == registry);
+        CHECK(server.findDataType({1, 1000}) == registry->find({1, 1000}));
+        CHECK(client1.findDataType({1, 1000}) == client2.findDataType({1, 1000}));
+        CHECK(client2.findDataType({1, 2000}) == registry->find({1, 2000}));
+
+        // data types set per instance replace the shared registry
+        client2.setCustomDataTypes({custom});
+        CHECK(client2.getDataTypeRegistry() != registry);
+        CHECK(client2.findDataType({1, 1000}) != registry->find({1, 1000}));
+        CHECK(client2.findDataType({1, 2000}) != nullptr);  // passthrough types are kept
+    }
+}
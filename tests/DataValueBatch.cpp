@@ -0,0 +1,54 @@
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/DataValueBatch.h"
+#include "open62541pp/ErrorHandling.h"
+
+using namespace opcua;
+
+TEST_CASE("DataValueBatch") {
+    const std::vector<NodeId> ids{{1, 1000}, {1, "string"}, {1, 1002}};
+    const std::vector<double> values{1.1, 2.2, 3.3};
+    const std::vector<DateTime> timestamps{DateTime(1), DateTime(2), DateTime(3)};
+
+    SUBCASE("Size mismatch") {
+        const std::vector<double> tooShort{1.1};
+        CHECK_THROWS_AS(DataValueBatch::create<double>(ids, tooShort), BadStatus);
+        CHECK_THROWS_AS(
+            DataValueBatch::create<double>(
+                ids, values, Span<const DateTime>(timestamps).first(1)
+            ),
+            BadStatus
+        );
+    }
+
+    SUBCASE("Empty") {
+        const auto batch = DataValueBatch::create<double>({}, {});
+        CHECK(batch.empty());
+        CHECK(batch.writeValues().empty());
+    }
+
+    SUBCASE("Values with timestamps") {
+        const auto batch = DataValueBatch::create<double>(ids, values, timestamps);
+        REQUIRE(batch.size() == 3);
+        const auto writeValues = batch.writeValues();
+        for (size_t i = 0; i < batch.size(); ++i) {
+            CHECK(writeValues[i].getNodeId() == ids[i]);
+            CHECK(writeValues[i].getAttributeId() == AttributeId::Value);
+            CHECK(batch[i].getValue().getScalar<double>() == values[i]);
+            CHECK(batch[i].getValue().data() != &values[i]);  // copied into the batch
+            CHECK(batch[i].getSourceTimestamp() == timestamps[i]);
+            CHECK_FALSE(batch[i].hasStatus());
+        }
+        // payloads are stored contiguously
+        CHECK(batch[1].getValue().data() == &batch[0].getValue().getScalar<double>() + 1);
+    }
+
+    SUBCASE("Values with status codes") {
+        const std::vector<StatusCode> statuses(3, UA_STATUSCODE_BADINTERNALERROR);
+        const auto batch = DataValueBatch::create<double>(ids, values, {}, statuses);
+        CHECK_FALSE(batch[0].hasSourceTimestamp());
+        CHECK(batch[2].getStatus() == UA_STATUSCODE_BADINTERNALERROR);
+    }
+}
@@ -0,0 +1,75 @@
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/DeadbandWriter.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/services/Attribute.h"
+#include "open62541pp/services/NodeManagement.h"
+
+using namespace opcua;
+
+TEST_CASE("DeadbandWriter") {
+    Server server;
+    const NodeId id{1, 1000};
+    services::addVariable(server, ObjectId::ObjectsFolder, id, "Variable");
+    DeadbandWriter writer(server);
+
+    auto readDouble = [&] { return services::readValue(server, id).getScalarCopy<double>(); };
+
+    SUBCASE("Without deadband") {
+        CHECK(writer.writeValue(id, Variant::fromScalar(1.0)));
+        CHECK(writer.writeValue(id, Variant::fromScalar(1.0)));
+        CHECK(writer.getDroppedCount() == 0);
+    }
+
+    SUBCASE("None") {
+        writer.setDeadband(id, DeadbandType::None);
+        CHECK(writer.writeValue(id, Variant::fromScalar(1.0)));
+        CHECK_FALSE(writer.writeValue(id, Variant::fromScalar(1.0)));
+        CHECK(writer.writeValue(id, Variant::fromScalar(1.1)));
+        CHECK(writer.getDroppedCount() == 1);
+    }
+
+    SUBCASE("Absolute") {
+        writer.setDeadband(id, DeadbandType::Absolute, 0.5);
+        CHECK(writer.writeValue(id, Variant::fromScalar(20.0)));
+        CHECK_FALSE(writer.writeValue(id, Variant::fromScalar(20.3)));
+        CHECK_FALSE(writer.writeValue(id, Variant::fromScalar(20.5)));
+        CHECK(readDouble() == 20.0);
+        // drift is compared to the last written value
+        CHECK(writer.writeValue(id, Variant::fromScalar(20.6)));
+        CHECK(readDouble() == 20.6);
+        CHECK(writer.getDroppedCount() == 2);
+
+        // non-numeric values are passed through
+        CHECK(writer.writeValue(id, Variant::fromScalar(String("text"))));
+
+        writer.removeDeadband(id);
+        CHECK(writer.writeValue(id, Variant::fromScalar(20.6)));
+    }
+
+    SUBCASE("Percent") {
+        CHECK_THROWS_AS(writer.setDeadband(id, DeadbandType::Percent, 10.0), BadStatus);
+        writer.setDeadband(id, DeadbandType::Percent, 10.0, 50.0);  // threshold 5
+        CHECK(writer.writeValue(id, Variant::fromScalar(int32_t{0})));
+        CHECK_FALSE(writer.writeValue(id, Variant::fromScalar(int32_t{5})));
+        CHECK(writer.writeValue(id, Variant::fromScalar(int32_t{6})));
+    }
+
+    SUBCASE("writeValues") {
+        const NodeId id2{1, 1001};
+        services::addVariable(server, ObjectId::ObjectsFolder, id2, "Variable2");
+        writer.setDeadband(id, DeadbandType::Absolute, 1.0);
+        writer.setDeadband(id2, DeadbandType::Absolute, 1.0);
+
+        const std::vector<NodeId> ids{id, id2};
+        CHECK(writer.writeValues(ids, {Variant::fromScalar(1.0), Variant::fromScalar(2.0)}) == 2);
+        CHECK(writer.writeValues(ids, {Variant::fromScalar(1.5), Variant::fromScalar(5.0)}) == 1);
+        CHECK(readDouble() == 1.0);
+        CHECK(writer.getDroppedCount() == 1);
+
+        CHECK_THROWS_AS(writer.writeValues(ids, {Variant::fromScalar(1.0)}), BadStatus);
+    }
+}
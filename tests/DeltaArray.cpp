@@ -0,0 +1,117 @@
+#include <algorithm>  // fill
+#include <cstdint>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/DeltaArray.h"
+#include "open62541pp/Encoding.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/types/Variant.h"
+
+using namespace opcua;
+
+static const DeltaArrayFrame& getFrame(const Variant& var) {
+    return *static_cast<const DeltaArrayFrame*>(var.data());
+}
+
+TEST_CASE("DeltaArray") {
+    const DataType frameType = createDeltaArrayFrameDataType({1, 4000}, {1, 4001});
+    CHECK(frameType.getMemSize() == sizeof(DeltaArrayFrame));
+    CHECK(frameType.getMembers().size() == 5);
+
+    DeltaArrayOptions options;
+    options.keyframeInterval = 3;
+    options.mergeGap = 1;
+    DeltaArrayEncoder encoder(*frameType.handle(), options);
+    DeltaArrayDecoder decoder(frameType.getTypeId());
+
+    std::vector<float> data(100, 0.0F);
+
+    SUBCASE("Keyframe and deltas") {
+        const auto frame1 = encoder.encode(Variant::fromArray(data));
+        CHECK(getFrame(frame1).keyframe);
+        CHECK(getFrame(frame1).arrayLength == 100);
+        CHECK(decoder.decode(frame1));
+        CHECK(decoder.getArray().getArrayCopy<float>() == data);
+
+        data[10] = 1.0F;
+        data[12] = 2.0F;  // merged with the range of index 10
+        data[50] = 3.0F;
+        const auto frame2 = encoder.encode(Variant::fromArray(data));
+        const auto& delta = getFrame(frame2);
+        CHECK_FALSE(delta.keyframe);
+        CHECK(std::vector<uint32_t>(delta.ranges, delta.ranges + delta.rangesSize) ==
+              std::vector<uint32_t>{10, 3, 50, 1});
+        CHECK(delta.values.arrayLength == 4);
+        CHECK(decoder.decode(frame2));
+        CHECK(decoder.getArray().getArrayCopy<float>() == data);
+
+        // unchanged array, empty delta
+        const auto frame3 = encoder.encode(Variant::fromArray(data));
+        CHECK_FALSE(getFrame(frame3).keyframe);
+        CHECK(getFrame(frame3).rangesSize == 0);
+        CHECK(decoder.decode(frame3));
+
+        // periodic keyframe
+        encoder.encode(Variant::fromArray(data));
+        const auto frame5 = encoder.encode(Variant::fromArray(data));
+        CHECK(getFrame(frame5).keyframe);
+    }
+
+    SUBCASE("Keyframe if many elements changed") {
+        encoder.encode(Variant::fromArray(data));
+        std::fill(data.begin(), data.end(), 1.0F);
+        CHECK(getFrame(encoder.encode(Variant::fromArray(data))).keyframe);
+    }
+
+    SUBCASE("Keyframe if the length changed") {
+        encoder.encode(Variant::fromArray(data));
+        data.resize(10);
+        CHECK(getFrame(encoder.encode(Variant::fromArray(data))).keyframe);
+    }
+
+    SUBCASE("Wait for keyframe after missing frames") {
+        CHECK(decoder.decode(encoder.encode(Variant::fromArray(data))));
+        data[0] = 1.0F;
+        encoder.encode(Variant::fromArray(data));  // lost
+        data[1] = 1.0F;
+        CHECK_FALSE(decoder.decode(encoder.encode(Variant::fromArray(data))));
+        encoder.forceKeyframe();
+        CHECK(decoder.decode(encoder.encode(Variant::fromArray(data))));
+        CHECK(decoder.getArray().getArrayCopy<float>() == data);
+    }
+
+    SUBCASE("Binary encoding") {
+        encoder.encode(Variant::fromArray(data));
+        data[42] = 1.0F;
+        const auto frame = encoder.encode(Variant::fromArray(data));
+        const auto encoded = encodeBinary(frame.data(), *frameType.handle());
+
+        DeltaArrayFrame decoded{};
+        decodeBinary({encoded->data, encoded->length}, &decoded, *frameType.handle());
+        CHECK(decoded.sequenceNumber == getFrame(frame).sequenceNumber);
+        CHECK(decoded.rangesSize == 2);
+        CHECK(decoded.ranges[0] == 42);
+        CHECK(decoded.values.arrayLength == 1);
+        UA_clear(&decoded, frameType.handle());
+    }
+
+    SUBCASE("Invalid values") {
+        CHECK_THROWS_AS(encoder.encode(Variant::fromScalar(1.0F)), BadStatus);
+        CHECK_THROWS_AS(decoder.decode(Variant::fromScalar(1.0F)), BadStatus);
+    }
+
+    SUBCASE("Keyframe of a type with pointers") {
+        Variant frame;
+        auto* native = static_cast<DeltaArrayFrame*>(UA_new(frameType.handle()));
+        UA_Variant_setScalar(frame.handle(), native, frameType.handle());  // take ownership
+        native->keyframe = true;
+        native->arrayLength = 2;
+        const std::vector<String> strings{String("a"), String("b")};
+        UA_Variant_setArrayCopy(
+            &native->values, strings.data(), strings.size(), &UA_TYPES[UA_TYPES_STRING]
+        );
+        CHECK_THROWS_WITH_AS(decoder.decode(frame), "BadTypeMismatch", BadStatus);
+    }
+}
@@ -0,0 +1,114 @@
+#include <algorithm>  // equal
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/Config.h"
+#include "open62541pp/Encoding.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/Variant.h"
+
+using namespace opcua;
+
+#if UAPP_OPEN62541_VER_GE(1, 3)
+static Span<const uint8_t> asBytes(const ByteString& bytes) {
+    return {bytes->data, bytes->length};
+}
+
+TEST_CASE("Binary encoding") {
+    SUBCASE("Encode/decode scalar") {
+        const int32_t value = 11;
+        const ByteString encoded = encodeBinary(value);
+        CHECK(encoded->length == 4);
+        CHECK(decodeBinary<int32_t>(asBytes(encoded)) == 11);
+    }
+
+    SUBCASE("Encode/decode wrapper type") {
+        const auto value = DataValue::fromScalar(String("test"));
+        const ByteString encoded = encodeBinary(value);
+        const auto decoded = decodeBinary<DataValue>(asBytes(encoded));
+        CHECK(decoded.getValue().getScalarCopy<std::string>() == "test");
+    }
+
+    SUBCASE("Encode into buffer") {
+        std::array<uint8_t, 16> buffer{};
+        const auto used = encodeBinary(String("abc"), Span<uint8_t>(buffer));
+        CHECK(used.data() == buffer.data());
+        CHECK(used.size() == 7);  // length prefix + data
+        CHECK(decodeBinary<String>(used) == String("abc"));
+    }
+
+    SUBCASE("Encode into too small buffer") {
+        std::array<uint8_t, 2> buffer{};
+        CHECK_THROWS_AS(encodeBinary(String("abc"), Span<uint8_t>(buffer)), BadStatus);
+    }
+
+    SUBCASE("Decode invalid data") {
+        const std::vector<uint8_t> data{1, 2};
+        CHECK_THROWS_AS(decodeBinary<int32_t>(data), BadStatus);
+    }
+}
+
+TEST_CASE("calcSizeBinary") {
+    CHECK(calcSizeBinary(int32_t{1}) == 4);
+    CHECK(calcSizeBinary(String("abc")) == 7);
+    const auto dv = DataValue::fromScalar(11.11);
+    CHECK(calcSizeBinary(dv) == encodeBinary(dv)->length);
+}
+
+TEST_CASE("BatchEncoder") {
+    BatchEncoder encoder;
+    CHECK(encoder.size() == 0);
+    CHECK(encoder.data().empty());
+
+    const auto dv = DataValue::fromScalar(11.11);
+    const ByteString encoded = encodeBinary(dv);
+    encoder.append(dv);
+    encoder.append(Variant::fromScalar(int32_t{1}));
+    CHECK(encoder.size() == encoded->length + calcSizeBinary(Variant::fromScalar(int32_t{1})));
+    CHECK(std::equal(
+        encoded->data, encoded->data + encoded->length, encoder.data().begin()  // NOLINT
+    ));
+
+    SUBCASE("Reuse buffer after clear") {
+        const auto* data = encoder.data().data();
+        const size_t capacity = encoder.capacity();
+        encoder.clear();
+        CHECK(encoder.size() == 0);
+        encoder.append(dv);
+        CHECK(encoder.data().data() == data);
+        CHECK(encoder.capacity() == capacity);
+    }
+
+    SUBCASE("Initial capacity") {
+        BatchEncoder reserved(1024);
+        CHECK(reserved.capacity() == 1024);
+        reserved.append(dv);
+        CHECK(reserved.capacity() == 1024);
+    }
+}
+
+TEST_CASE("BinaryDecoder") {
+    BinaryDecoder decoder;
+    const ByteString first = encodeBinary(String("first"));
+    const ByteString second = encodeBinary(String("second"));
+    const auto firstBytes = asBytes(first);
+    const auto secondBytes = asBytes(second);
+
+    CHECK_FALSE(decoder.next<String>().has_value());
+
+    decoder.append(firstBytes.first(3));
+    CHECK_FALSE(decoder.next<String>().has_value());
+    CHECK(decoder.available() == 3);
+
+    decoder.append(firstBytes.subview(3));
+    decoder.append(secondBytes);
+    CHECK(decoder.next<String>() == String("first"));
+    CHECK(decoder.next<String>() == String("second"));
+    CHECK_FALSE(decoder.next<String>().has_value());
+    CHECK(decoder.available() == 0);
+}
+#endif
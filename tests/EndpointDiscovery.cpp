@@ -0,0 +1,68 @@
+#include <algorithm>  // find_if
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/EndpointDiscovery.h"
+#include "open62541pp/Server.h"
+
+#include "helper/Runner.h"
+
+using namespace opcua;
+
+TEST_CASE("EndpointDiscovery") {
+    Server server;
+    ServerRunner serverRunner(server);
+
+    const std::string serverUrl{"opc.tcp://localhost:4840"};
+    const std::string offlineUrl{"opc.tcp://localhost:4999"};
+    const std::vector<std::string> urls{serverUrl, offlineUrl, serverUrl};
+
+    EndpointDiscovery discovery({4, std::chrono::milliseconds(500)});
+    CHECK_FALSE(discovery.getCached(serverUrl).has_value());
+
+    const auto find = [](const auto& results, const std::string& url) {
+        return std::find_if(results.begin(), results.end(), [&](const auto& result) {
+            return result.endpointUrl == url;
+        });
+    };
+
+    SUBCASE("Scan") {
+        const auto results = discovery.scan(urls);
+        CHECK(results.size() == 2);  // duplicates are probed once
+
+        const auto online = find(results, serverUrl);
+        REQUIRE(online != results.end());
+        CHECK(online->status.isGood());
+        CHECK_FALSE(online->endpoints.empty());
+        CHECK_FALSE(online->cached);
+
+        const auto offline = find(results, offlineUrl);
+        REQUIRE(offline != results.end());
+        CHECK(offline->status.isBad());
+        CHECK(offline->endpoints.empty());
+    }
+
+    SUBCASE("Cache endpoints between scans") {
+        discovery.scan(urls);
+        CHECK(discovery.getCached(serverUrl).has_value());
+        CHECK_FALSE(discovery.getCached(offlineUrl).has_value());
+
+        const auto results = discovery.scan(urls);
+        CHECK(results.size() == 2);
+        CHECK(find(results, serverUrl)->cached);
+        CHECK_FALSE(find(results, offlineUrl)->cached);
+
+        discovery.clearCache();
+        CHECK_FALSE(discovery.getCached(serverUrl).has_value());
+    }
+
+    SUBCASE("Exception in callback") {
+        CHECK_THROWS(discovery.scan(urls, [](EndpointDiscoveryResult&) {
+            throw std::runtime_error("error");
+        }));
+    }
+}
@@ -1,4 +1,5 @@
 #include <memory>
+#include <vector>
 
 #include <doctest/doctest.h>
 
@@ -6,6 +7,9 @@
 #include "open62541pp/Event.h"
 #include "open62541pp/Server.h"
 #include "open62541pp/services/Attribute.h"
+#include "open62541pp/services/View.h"
+#include "open62541pp/types/Composed.h"
+#include "open62541pp/types/Variant.h"
 
 using namespace opcua;
 
@@ -41,6 +45,31 @@ TEST_CASE("Event") {
         CHECK(event.trigger() != event.trigger());  // unique event ids
     }
 
+    SUBCASE("Reuse event with resolved properties") {
+        Event event(server);
+        for (uint16_t severity = 1; severity <= 3; ++severity) {
+            CHECK_NOTHROW(event.writeSeverity(severity));
+        }
+        const auto result = services::browseSimplifiedBrowsePath(
+            server, event.getNodeId(), {{0, "Severity"}}
+        );
+        REQUIRE(result.getTargets().size() == 1);
+        const auto severityId = result.getTargets()[0].getTargetId().getNodeId();
+        CHECK(services::readValue(server, severityId).getScalarCopy<uint16_t>() == 3);
+
+        CHECK_THROWS_WITH(
+            event.writeProperty({0, "UnknownProperty"}, Variant::fromScalar(1)), "BadNoMatch"
+        );
+
+        const std::vector<uint16_t> severities{100, 200, 300};
+        const auto eventIds = event.triggerMany(severities.size(), [&](Event& e, size_t i) {
+            e.writeSeverity(severities[i]);
+        });
+        CHECK(eventIds.size() == 3);
+        CHECK(eventIds[0] != eventIds[1]);
+        CHECK(services::readValue(server, severityId).getScalarCopy<uint16_t>() == 300);
+    }
+
     SUBCASE("Equality") {
         auto event1 = server.createEvent();
         auto event2 = server.createEvent();
@@ -0,0 +1,80 @@
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/Config.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/EventFilterBuilder.h"
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/Composed.h"
+#include "open62541pp/types/Variant.h"
+
+using namespace opcua;
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+TEST_CASE("EventFilterBuilder") {
+    EventFilterBuilder builder;
+    const auto severity = builder.select<uint16_t>("Severity");
+    const auto message = builder.select<LocalizedText>("Message");
+    const auto enabled = builder.select<bool>("EnabledState/Id", ObjectTypeId::ConditionType);
+    const auto custom = builder.select(
+        "Custom", SimpleAttributeOperand(NodeId(1, 1000), {{1, "Custom"}}, AttributeId::Value)
+    );
+
+    SUBCASE("Select clauses") {
+        CHECK(severity.index == 0);
+        CHECK(message.index == 1);
+        CHECK(enabled.index == 2);
+        CHECK(custom.index == 3);
+
+        const auto filter = builder.build();
+        const auto selectClauses = filter.getSelectClauses();
+        REQUIRE(selectClauses.size() == 4);
+        CHECK(selectClauses[0].getTypeDefinitionId() == NodeId(ObjectTypeId::BaseEventType));
+        CHECK(selectClauses[0].getBrowsePath().size() == 1);
+        CHECK(selectClauses[0].getBrowsePath()[0] == QualifiedName(0, "Severity"));
+        CHECK(selectClauses[0].getAttributeId() == AttributeId::Value);
+        CHECK(selectClauses[2].getTypeDefinitionId() == NodeId(ObjectTypeId::ConditionType));
+        REQUIRE(selectClauses[2].getBrowsePath().size() == 2);
+        CHECK(selectClauses[2].getBrowsePath()[0] == QualifiedName(0, "EnabledState"));
+        CHECK(selectClauses[2].getBrowsePath()[1] == QualifiedName(0, "Id"));
+        CHECK(selectClauses[3].getBrowsePath()[0] == QualifiedName(1, "Custom"));
+    }
+
+    SUBCASE("Invalid names") {
+        CHECK_THROWS_AS(builder.select("Severity"), BadStatus);
+        CHECK_THROWS_AS(builder.select(""), BadStatus);
+        CHECK_THROWS_AS(builder.select("EnabledState/"), BadStatus);
+        CHECK(builder.getFieldMap().size() == 4);
+    }
+
+    SUBCASE("Field map") {
+        const auto& fields = builder.getFieldMap();
+        CHECK(fields.size() == 4);
+        CHECK(fields.find("Message") == 1);
+        CHECK(fields.find("EnabledState/Id") == 2);
+        CHECK_FALSE(fields.find("Time").has_value());
+        CHECK(fields.getNames()[3] == "Custom");
+    }
+
+    SUBCASE("EventView") {
+        const std::vector<Variant> eventFields{
+            Variant::fromScalar(uint16_t{500}),
+            Variant::fromScalar(LocalizedText("", "Alarm")),
+            Variant::fromScalar(uint16_t{1}),  // wrong type
+        };
+        const EventView event(builder.getFieldMap(), eventFields);
+        CHECK(event.size() == 3);
+        CHECK(event.get(severity) == uint16_t{500});
+        CHECK(event.get(message).value().getText() == "Alarm");
+        CHECK_FALSE(event.get(enabled).has_value());
+        CHECK(event[custom].isEmpty());  // missing field
+        CHECK(event.get<uint16_t>("Severity") == uint16_t{500});
+        CHECK(event["Unknown"].isEmpty());
+        CHECK_FALSE(event.get<Variant>("Custom").has_value());
+    }
+}
+#endif
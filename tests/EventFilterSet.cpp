@@ -0,0 +1,121 @@
+#include <cstdint>
+#include <string>
+#include <utility>  // move
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/Config.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Event.h"
+#include "open62541pp/EventFilterSet.h"
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/Composed.h"
+#include "open62541pp/types/Variant.h"
+
+using namespace opcua;
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+TEST_CASE("EventFilterSet") {
+    Server server;
+    EventFilterSet filters(server);
+
+    const SimpleAttributeOperand severity(
+        ObjectTypeId::BaseEventType, {{0, "Severity"}}, AttributeId::Value
+    );
+    const SimpleAttributeOperand sourceName(
+        ObjectTypeId::BaseEventType, {{0, "SourceName"}}, AttributeId::Value
+    );
+    const SimpleAttributeOperand missing(
+        ObjectTypeId::BaseEventType, {{1, "Missing"}}, AttributeId::Value
+    );
+    const std::vector<SimpleAttributeOperand> select{severity, sourceName};
+    const auto makeFilter = [&](ContentFilter whereClause) {
+        return EventFilter(select, std::move(whereClause));
+    };
+
+    Event event(server);
+    event.writeSeverity(500).writeSourceName("Boiler");
+
+    const auto evaluate = [&] {
+        std::vector<size_t> matched;
+        const auto count = filters.evaluate(
+            event,
+            [&](size_t filterId, Span<const Variant> eventFields) {
+                CHECK(eventFields.size() == 2);
+                CHECK(eventFields[1].getScalarCopy<std::string>() == "Boiler");
+                matched.push_back(filterId);
+            }
+        );
+        CHECK(count == matched.size());
+        return matched;
+    };
+
+    SUBCASE("Deduplication") {
+        const auto filter = makeFilter(
+            {{FilterOperator::GreaterThan, {severity, LiteralOperand(uint16_t{200})}}}
+        );
+        const auto id1 = filters.add(filter);
+        const auto id2 = filters.add(filter);
+        CHECK(id1 == id2);
+        CHECK(filters.size() == 1);
+        CHECK(filters.getFieldCount() == 2);  // severity operand shared with select clause
+        CHECK(evaluate() == std::vector<size_t>{id1});
+
+        filters.remove(id1);
+        CHECK(filters.size() == 1);
+        filters.remove(id2);
+        CHECK(filters.size() == 0);
+        CHECK(filters.getFieldCount() == 0);
+        CHECK_THROWS_WITH(filters.remove(id1), "BadInvalidArgument");
+        CHECK(evaluate().empty());
+    }
+
+    SUBCASE("Where clauses") {
+        using Ids = std::vector<size_t>;
+        const auto all = filters.add(makeFilter({}));
+        const auto high = filters.add(makeFilter(
+            {{FilterOperator::GreaterThanOrEqual, {severity, LiteralOperand(uint16_t{800})}}}
+        ));
+        const auto source = filters.add(makeFilter(
+            {{FilterOperator::Like, {sourceName, LiteralOperand(String("Boil%"))}}}
+        ));
+        const ContentFilterElement medium(
+            FilterOperator::Between,
+            {severity, LiteralOperand(uint16_t{400}), LiteralOperand(uint16_t{600})}
+        );
+        const ContentFilterElement boiler(
+            FilterOperator::InList,
+            {sourceName, LiteralOperand(String("Pump")), LiteralOperand(String("Boiler"))}
+        );
+        const auto combined = filters.add(makeFilter(medium && boiler));
+        const auto ofType = filters.add(makeFilter(
+            {{FilterOperator::OfType, {LiteralOperand(NodeId(ObjectTypeId::BaseEventType))}}}
+        ));
+        const auto isNull = filters.add(makeFilter({{FilterOperator::IsNull, {missing}}}));
+        filters.add(makeFilter({{FilterOperator::Equals, {missing, LiteralOperand(1)}}}));
+        CHECK(filters.size() == 7);
+        CHECK(filters.getFieldCount() == 3);
+
+        CHECK(evaluate() == Ids{all, source, combined, ofType, isNull});
+        event.writeSeverity(900);
+        CHECK(evaluate() == Ids{all, high, source, ofType, isNull});
+    }
+
+    SUBCASE("Invalid filters") {
+        CHECK_THROWS_WITH(filters.add(EventFilter({}, {})), "BadEventFilterInvalid");
+        CHECK_THROWS_WITH(
+            filters.add(makeFilter({{FilterOperator::Equals, {severity}}})),
+            "BadFilterOperandCountMismatch"
+        );
+        CHECK_THROWS_WITH(
+            filters.add(makeFilter({{FilterOperator::And, {ElementOperand(0), severity}}})),
+            "BadFilterOperandInvalid"
+        );
+        CHECK(filters.size() == 0);
+    }
+}
+#endif
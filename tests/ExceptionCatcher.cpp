@@ -1,5 +1,8 @@
 #include <exception>
 #include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
 
 #include <doctest/doctest.h>
 
@@ -29,6 +32,19 @@ TEST_CASE("ExceptionCatcher") {
         CHECK_THROWS_AS_MESSAGE(catcher.rethrow(), std::runtime_error, "Error");
     }
 
+    SUBCASE("Invoke noexcept callback") {
+        int calls = 0;
+        auto callback = [&]() noexcept { ++calls; };
+        catcher.invoke(callback);
+        CHECK(calls == 1);
+
+        auto wrapped = catcher.wrapCallback(callback);
+        static_assert(std::is_nothrow_invocable_v<decltype(wrapped)>);
+        wrapped();
+        CHECK(calls == 2);
+        CHECK_FALSE(catcher.hasException());
+    }
+
     SUBCASE("Wrap callback") {
         auto wrapped = catcher.wrapCallback([](bool error) {
             if (error) {
@@ -43,4 +59,19 @@ TEST_CASE("ExceptionCatcher") {
         CHECK(catcher.hasException());
         CHECK_THROWS_AS_MESSAGE(catcher.rethrow(), std::runtime_error, "Error");
     }
+
+    SUBCASE("Set exceptions from other threads") {
+        std::vector<std::thread> threads;
+        for (int i = 0; i < 4; ++i) {
+            threads.emplace_back([&] {
+                catcher.invoke([] { throw std::runtime_error("Error"); });
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        CHECK(catcher.hasException());
+        CHECK_THROWS_AS(catcher.rethrow(), std::runtime_error);
+        CHECK_FALSE(catcher.hasException());
+    }
 }
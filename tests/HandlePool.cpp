@@ -0,0 +1,28 @@
+#include <doctest/doctest.h>
+
+#include "open62541pp/detail/HandlePool.h"
+
+using namespace opcua::detail;
+
+TEST_CASE("HandlePool") {
+    HandlePool pool;
+    CHECK(pool.size() == 0);
+    CHECK(pool.acquire() == 0);
+    CHECK(pool.acquire() == 1);
+    CHECK(pool.acquire() == 2);
+    CHECK(pool.size() == 3);
+
+    SUBCASE("Reuse released handles") {
+        pool.release(1);
+        pool.release(0);
+        CHECK(pool.acquire() == 0);
+        CHECK(pool.acquire() == 1);
+        CHECK(pool.acquire() == 3);
+        CHECK(pool.size() == 4);
+    }
+
+    SUBCASE("Ignore invalid handle") {
+        pool.release(HandlePool::invalid);
+        CHECK(pool.acquire() == 3);
+    }
+}
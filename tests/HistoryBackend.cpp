@@ -0,0 +1,130 @@
+#include <cstdio>  // remove
+#include <string>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/HistoryBackend.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/services/Attribute.h"
+#include "open62541pp/services/NodeManagement.h"
+
+using namespace opcua;
+
+static DataValue sample(double value, int64_t timestamp) {
+    auto dv = DataValue::fromScalar(value);
+    dv.setSourceTimestamp(DateTime(timestamp));
+    return dv;
+}
+
+TEST_CASE("HistoryRingBuffer") {
+    CHECK_THROWS_AS(HistoryRingBuffer(0), BadStatus);
+
+    HistoryRingBuffer buffer(4);
+    CHECK(buffer.size() == 0);
+    CHECK(buffer.capacity() == 4);
+    CHECK(buffer.getDataType() == nullptr);
+
+    SUBCASE("Append and overwrite oldest") {
+        for (int64_t i = 1; i <= 6; ++i) {
+            CHECK(buffer.insert(sample(static_cast<double>(i), i * 10)).isGood());
+        }
+        CHECK(buffer.size() == 4);
+        CHECK(buffer.getDataType() == &UA_TYPES[UA_TYPES_DOUBLE]);
+        CHECK(buffer.getTimestamp(0).get() == 30);
+        CHECK(buffer.getTimestamp(3).get() == 60);
+        CHECK(buffer.getDataValue(0).getValue().getScalarCopy<double>() == 3.0);
+        CHECK(buffer.getDataValue(0).getSourceTimestamp().get() == 30);
+    }
+
+    SUBCASE("Insert in timestamp order") {
+        CHECK(buffer.insert(sample(1.0, 10)).isGood());
+        CHECK(buffer.insert(sample(3.0, 30)).isGood());
+        CHECK(buffer.insert(sample(2.0, 20)).isGood());
+        CHECK(buffer.getDataValue(1).getValue().getScalarCopy<double>() == 2.0);
+
+        CHECK(buffer.insert(sample(5.0, 20)) == UA_STATUSCODE_BADENTRYEXISTS);
+        CHECK(buffer.insert(sample(5.0, 20), true).isGood());
+        CHECK(buffer.getDataValue(1).getValue().getScalarCopy<double>() == 5.0);
+
+        CHECK(buffer.replace(sample(6.0, 25)) == UA_STATUSCODE_BADNOENTRYEXISTS);
+        CHECK(buffer.replace(sample(6.0, 30)).isGood());
+        CHECK(buffer.getDataValue(2).getValue().getScalarCopy<double>() == 6.0);
+    }
+
+    SUBCASE("Binary search") {
+        for (int64_t i = 1; i <= 4; ++i) {
+            buffer.insert(sample(0.0, i * 10));
+        }
+        CHECK(buffer.lowerBound(DateTime(5)) == 0);
+        CHECK(buffer.lowerBound(DateTime(20)) == 1);
+        CHECK(buffer.upperBound(DateTime(20)) == 2);
+        CHECK(buffer.lowerBound(DateTime(45)) == 4);
+    }
+
+    SUBCASE("Remove") {
+        for (int64_t i = 1; i <= 4; ++i) {
+            buffer.insert(sample(static_cast<double>(i), i * 10));
+        }
+        CHECK(buffer.remove(DateTime(20), DateTime(40)) == 2);
+        CHECK(buffer.size() == 2);
+        CHECK(buffer.getTimestamp(1).get() == 40);
+        buffer.clear();
+        CHECK(buffer.size() == 0);
+    }
+
+    SUBCASE("Unsupported values") {
+        const auto text = DataValue::fromScalar(String("text"));
+        CHECK(buffer.insert(text) == UA_STATUSCODE_BADTYPEMISMATCH);
+        CHECK(buffer.insert(sample(1.0, 10)).isGood());
+        CHECK(buffer.insert(DataValue::fromScalar(1)) == UA_STATUSCODE_BADTYPEMISMATCH);
+
+        DataValue bad;
+        bad.setStatus(UA_STATUSCODE_BADCOMMUNICATIONERROR);
+        bad.setSourceTimestamp(DateTime(20));
+        CHECK(buffer.insert(bad).isGood());
+        CHECK_FALSE(buffer.getDataValue(1).hasValue());
+        CHECK(buffer.getDataValue(1).getStatus() == UA_STATUSCODE_BADCOMMUNICATIONERROR);
+    }
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+TEST_CASE("HistoryRingBuffer memory-mapped file") {
+    const std::string path = "open62541pp_test_history.bin";
+    std::remove(path.c_str());
+    {
+        HistoryRingBuffer buffer(8, path);
+        buffer.insert(sample(1.0, 10));
+        buffer.insert(sample(2.0, 20));
+        buffer.flush();
+    }
+    {
+        HistoryRingBuffer buffer(8, path);  // reopen
+        CHECK(buffer.size() == 2);
+        CHECK(buffer.getDataValue(1).getValue().getScalarCopy<double>() == 2.0);
+    }
+    CHECK_THROWS_AS(HistoryRingBuffer(16, path), BadStatus);  // capacity mismatch
+    std::remove(path.c_str());
+}
+#endif
+
+#ifdef UA_ENABLE_HISTORIZING
+TEST_CASE("HistoryBackend") {
+    Server server;
+    const NodeId id{1, 1000};
+    services::addVariable(server, ObjectId::ObjectsFolder, id, "Variable");
+
+    HistoryBackend history;
+    auto& buffer = history.registerNode(server, id, {});
+    CHECK(history.size() == 1);
+    CHECK(&history.getBuffer(id) == &buffer);
+    CHECK_THROWS_AS(history.getBuffer({1, 9999}), BadStatus);
+    CHECK(services::readHistorizing(server, id));
+    CHECK(services::readAccessLevel(server, id).allOf(AccessLevel::HistoryRead));
+
+    services::writeDataValue(server, id, sample(1.0, 10));
+    services::writeDataValue(server, id, sample(2.0, 20));
+    CHECK(buffer.size() == 2);
+    CHECK(buffer.getDataValue(1).getValue().getScalarCopy<double>() == 2.0);
+}
+#endif
@@ -0,0 +1,79 @@
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/Client.h"
+#include "open62541pp/Config.h"
+#include "open62541pp/HotStandby.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/types/Composed.h"
+#include "open62541pp/types/DataValue.h"
+
+#include "helper/Runner.h"
+
+using namespace opcua;
+using namespace std::literals::chrono_literals;
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+TEST_CASE("HotStandby") {
+    // both clients connect to the same server to emulate a redundant server pair
+    Server server;
+    ServerRunner serverRunner(server);
+    Client primary;
+    Client secondary;
+    primary.connect("opc.tcp://localhost:4840");
+    secondary.connect("opc.tcp://localhost:4840");
+
+    HotStandbyOptions options;
+    options.parameters.publishingInterval = 20.0;
+    HotStandby standby(primary, secondary, options);
+
+    std::vector<const Client*> notified;
+    const std::vector<ReadValueId> items{
+        {VariableId::Server_ServerStatus_CurrentTime, AttributeId::Value}
+    };
+    MonitoringParameters parameters{};
+    parameters.samplingInterval = 20.0;
+    const auto results = standby.subscribeDataChange(
+        items, parameters, [&](const MonitoredItem<Client>& item, const DataValue& /* dv */) {
+            notified.push_back(&item.getConnection());
+        }
+    );
+    REQUIRE(results.size() == 1);
+    CHECK(results[0].statusCode.isGood());
+
+    const auto runFor = [&](std::chrono::milliseconds duration) {
+        const auto until = std::chrono::steady_clock::now() + duration;
+        while (std::chrono::steady_clock::now() < until) {
+            if (primary.isConnected()) {
+                primary.runIterate(5);
+            }
+            secondary.runIterate(5);
+            standby.check();
+        }
+    };
+
+    runFor(200ms);
+    CHECK(!standby.isFailedOver());
+    CHECK(&standby.getActiveClient() == &primary);
+    REQUIRE(!notified.empty());
+    for (const auto* client : notified) {
+        CHECK(client == &primary);  // standby items are sampling only
+    }
+
+    notified.clear();
+    primary.disconnect();
+    CHECK(standby.check());
+    CHECK(standby.isFailedOver());
+    CHECK(&standby.getActiveClient() == &secondary);
+    CHECK_FALSE(standby.check());
+
+    runFor(200ms);
+    REQUIRE(!notified.empty());
+    for (const auto* client : notified) {
+        CHECK(client == &secondary);
+    }
+}
+#endif
@@ -0,0 +1,110 @@
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>  // move
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/InstantiationTemplate.h"
+#include "open62541pp/Node.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/ValueBackend.h"
+
+using namespace opcua;
+
+TEST_CASE("InstantiationTemplate") {
+    Server server;
+
+    // MotorType with mandatory Speed variable and Status object (with mandatory Code variable)
+    // and an optional Description property
+    auto motorType = server.getNode(ObjectTypeId::BaseObjectType)
+                         .addObjectType({1, "MotorType"}, "MotorType");
+    motorType.addVariable({1, "MotorType.Speed"}, "Speed", VariableAttributes{}.setValueScalar(1.5))
+        .addModellingRule(ModellingRule::Mandatory);
+    motorType.addObject({1, "MotorType.Status"}, "Status")
+        .addModellingRule(ModellingRule::Mandatory)
+        .addVariable({1, "MotorType.Status.Code"}, "Code")
+        .addModellingRule(ModellingRule::Mandatory);
+    motorType.addProperty({1, "MotorType.Description"}, "Description")
+        .addModellingRule(ModellingRule::Optional);
+
+    SUBCASE("Invalid object type") {
+        CHECK_THROWS_AS(InstantiationTemplate(server, {1, "Unknown"}), BadStatus);
+        CHECK_THROWS_AS_MESSAGE(
+            InstantiationTemplate(server, ObjectId::ObjectsFolder),
+            BadStatus,
+            "BadNodeClassInvalid"
+        );
+    }
+
+    SUBCASE("Mandatory children") {
+        InstantiationTemplate motorTemplate(server, {1, "MotorType"});
+        CHECK(motorTemplate.getObjectType() == NodeId(1, "MotorType"));
+        CHECK(motorTemplate.getChildCount() == 3);
+        const auto speed = motorTemplate.findChild({{1, "Speed"}});
+        const auto code = motorTemplate.findChild({{1, "Status"}, {1, "Code"}});
+        REQUIRE(speed.has_value());
+        REQUIRE(code.has_value());
+        CHECK_FALSE(motorTemplate.findChild({{1, "Description"}}).has_value());
+        CHECK(motorTemplate.getChildId({1, "Motor"}, *code) == NodeId(1, "Motor.Status.Code"));
+        CHECK(
+            motorTemplate.getChildId({1, 100}, *speed) ==
+            NodeId(1, static_cast<uint32_t>(101 + *speed))
+        );
+    }
+
+    SUBCASE("Instantiate in bulk") {
+        InstantiationTemplate motorTemplate(server, {1, "MotorType"});
+        const std::vector<NodeId> ids{{1, "Motor1"}, {1, "Motor2"}};
+        const std::vector<QualifiedName> names{{1, "Motor1"}, {1, "Motor2"}};
+        const auto variables = motorTemplate.instantiate(ObjectId::ObjectsFolder, ids, names);
+        CHECK(variables.size() == 4);
+
+        for (const auto& id : ids) {
+            auto motor = server.getNode(id);
+            CHECK(motor.readNodeClass() == NodeClass::Object);
+            CHECK(motor.browseParent().getNodeId() == NodeId(ObjectId::ObjectsFolder));
+            auto speed = motor.browseChild({{1, "Speed"}});
+            const std::string name(id.getIdentifierAs<String>());
+            CHECK(speed.getNodeId() == NodeId(1, name + ".Speed"));
+            CHECK(speed.readValueScalar<double>() == 1.5);
+            CHECK(motor.browseChild({{1, "Status"}, {1, "Code"}}).exists());
+            CHECK_THROWS(motor.browseChild({{1, "Description"}}));
+        }
+
+        CHECK_THROWS_AS_MESSAGE(
+            motorTemplate.instantiate(ObjectId::ObjectsFolder, ids, names),
+            BadStatus,
+            "BadNodeIdExists"
+        );
+        CHECK_THROWS_AS_MESSAGE(
+            motorTemplate.instantiate(ObjectId::ObjectsFolder, {ids.data(), 1}, {}),
+            BadStatus,
+            "BadInvalidArgument"
+        );
+    }
+
+    SUBCASE("Instantiate with shared data source") {
+        auto& motorTemplate = server.getInstantiationTemplate({1, "MotorType"});
+        CHECK(&server.getInstantiationTemplate({1, "MotorType"}) == &motorTemplate);
+
+        size_t reads = 0;
+        ValueBackendDataSource backend;
+        backend.read = [&](DataValue& value, const NumericRange&, bool) {
+            ++reads;
+            value.setValue(Variant::fromScalar(42.0));
+            return UA_STATUSCODE_GOOD;
+        };
+        const std::vector<NodeId> ids{{1, 1000}};
+        const std::vector<QualifiedName> names{{1, "Motor"}};
+        const auto variables =
+            motorTemplate.instantiate(ObjectId::ObjectsFolder, ids, names, std::move(backend));
+        REQUIRE(variables.size() == 2);
+        for (const auto& id : variables) {
+            CHECK(server.getNode(id).readValueScalar<double>() == 42.0);
+        }
+        CHECK(reads == 2);
+    }
+}
@@ -0,0 +1,154 @@
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/DataTypeBuilder.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/JsonEncoding.h"
+#include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/DateTime.h"
+#include "open62541pp/types/NodeId.h"
+#include "open62541pp/types/Variant.h"
+
+using namespace opcua;
+
+static const JsonEncodingOptions nonReversible{false};
+
+TEST_CASE("JSON encoding") {
+    SUBCASE("Numbers") {
+        CHECK(encodeJson(true) == "true");
+        CHECK(encodeJson(int32_t{-11}) == "-11");
+        CHECK(encodeJson(uint16_t{65535}) == "65535");
+        CHECK(encodeJson(int64_t{-1}) == "\"-1\"");
+        CHECK(encodeJson(1.5) == "1.5");
+        CHECK(encodeJson(0.1F) == "0.1");
+        CHECK(encodeJson(std::numeric_limits<double>::quiet_NaN()) == "\"NaN\"");
+        CHECK(encodeJson(-std::numeric_limits<double>::infinity()) == "\"-Infinity\"");
+    }
+
+    SUBCASE("Strings") {
+        CHECK(encodeJson(String("a\"b\\c\n\x01")) == "\"a\\\"b\\\\c\\n\\u0001\"");
+        CHECK(encodeJson(String()) == "null");
+        CHECK(encodeJson(ByteString("abcd")) == "\"YWJjZA==\"");
+        CHECK(encodeJson(NodeId(1, "name")) == "\"ns=1;s=name\"");
+        CHECK(encodeJson(NodeId(0, 85)) == "\"i=85\"");
+        CHECK(encodeJson(QualifiedName(2, "name")) == "{\"Name\":\"name\",\"Uri\":2}");
+        CHECK(encodeJson(LocalizedText("en", "text")) == "{\"Locale\":\"en\",\"Text\":\"text\"}");
+    }
+
+    SUBCASE("DateTime") {
+        CHECK(encodeJson(DateTime::fromUnixTime(0)) == "\"1970-01-01T00:00:00Z\"");
+        CHECK(encodeJson(DateTime(DateTime::fromUnixTime(1).get() + 1234500)) ==
+              "\"1970-01-01T00:00:01.12345Z\"");
+        CHECK(encodeJson(DateTime(0)) == "\"0001-01-01T00:00:00Z\"");
+    }
+
+    SUBCASE("Variant") {
+        CHECK(encodeJson(Variant()) == "null");
+        CHECK(encodeJson(Variant::fromScalar(11.5)) == "{\"Type\":11,\"Body\":11.5}");
+        std::vector<int32_t> array{1, 2, 3};
+        CHECK(encodeJson(Variant::fromArray(array)) == "{\"Type\":6,\"Body\":[1,2,3]}");
+        CHECK(encodeJson(Variant::fromArray(array), nonReversible) == "[1,2,3]");
+    }
+
+    SUBCASE("DataValue") {
+        const DataValue dv(
+            Variant::fromScalar(11),
+            DateTime::fromUnixTime(0),
+            {},
+            {},
+            {},
+            StatusCode(UA_STATUSCODE_BADINTERNALERROR)
+        );
+        CHECK(
+            encodeJson(dv) ==
+            "{\"Value\":{\"Type\":6,\"Body\":11},\"Status\":2147614720,"
+            "\"SourceTimestamp\":\"1970-01-01T00:00:00Z\"}"
+        );
+        CHECK(
+            encodeJson(dv, nonReversible) ==
+            "{\"Value\":11,\"Status\":{\"Code\":2147614720,\"Symbol\":\"BadInternalError\"},"
+            "\"SourceTimestamp\":\"1970-01-01T00:00:00Z\"}"
+        );
+    }
+
+    SUBCASE("Encode into buffer") {
+        std::array<char, 16> buffer{};
+        const auto used = encodeJson(String("abc"), Span<char>(buffer));
+        CHECK(used.data() == buffer.data());
+        CHECK(std::string(used.data(), used.size()) == "\"abc\"");
+    }
+
+    SUBCASE("Encode into buffer with exact fit") {
+        // shorter than the worst case width of the values
+        std::array<char, 8> buffer{};
+        const auto used = encodeJson(int32_t{1}, Span<char>(buffer));
+        CHECK(std::string(used.data(), used.size()) == "1");
+        std::array<char, 22> dateBuffer{};
+        const auto date = encodeJson(DateTime::fromUnixTime(0), Span<char>(dateBuffer));
+        CHECK(std::string(date.data(), date.size()) == "\"1970-01-01T00:00:00Z\"");
+    }
+
+    SUBCASE("Encode into too small buffer") {
+        std::array<char, 2> buffer{};
+        CHECK_THROWS_AS(encodeJson(String("abc"), Span<char>(buffer)), BadStatus);
+    }
+}
+
+#ifdef UA_ENABLE_TYPEDESCRIPTION
+TEST_CASE("JSON encoding of custom types") {
+    struct Point {
+        float x;
+        float y;
+    };
+
+    const auto pointType = DataTypeBuilder<Point>::createStructure("Point", {1, 4242}, {1, 4243})
+                               .addField<&Point::x>("x")
+                               .addField<&Point::y>("y")
+                               .build();
+
+    const Point point{1.0F, 2.5F};
+    CHECK(encodeJson(point, pointType) == "{\"x\":1,\"y\":2.5}");
+    CHECK(
+        encodeJson(Variant::fromScalar(point, pointType)) ==
+        "{\"Type\":22,\"Body\":{\"TypeId\":\"ns=1;i=4242\",\"Body\":{\"x\":1,\"y\":2.5}}}"
+    );
+    CHECK(
+        encodeJson(Variant::fromScalar(point, pointType), nonReversible) ==
+        "{\"x\":1,\"y\":2.5}"
+    );
+}
+#endif
+
+TEST_CASE("JsonEncoder") {
+    JsonEncoder encoder;
+    CHECK(encoder.size() == 0);
+    encoder.reserve(64);
+    CHECK(encoder.capacity() >= 64);
+
+    encoder.append(DataValue::fromScalar(1));
+    encoder.append(DataValue::fromScalar(2));
+    CHECK(
+        encoder.data() ==
+        "{\"Value\":{\"Type\":6,\"Body\":1}}\n{\"Value\":{\"Type\":6,\"Body\":2}}\n"
+    );
+
+    // failed encoding keeps the previous objects
+    const auto size = encoder.size();
+    UA_NodeId unknownId{};
+    unknownId.identifierType = static_cast<UA_NodeIdType>(99);
+    CHECK_THROWS_AS(encoder.append(unknownId, UA_TYPES[UA_TYPES_NODEID]), BadStatus);
+    CHECK(encoder.size() == size);
+
+    // buffer is reused
+    const auto capacity = encoder.capacity();
+    encoder.clear();
+    CHECK(encoder.size() == 0);
+    encoder.append(DataValue::fromScalar(3));
+    CHECK(encoder.capacity() == capacity);
+}
@@ -1,4 +1,10 @@
+#include <atomic>
+#include <chrono>
+#include <cstdarg>  // va_list
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include <doctest/doctest.h>
 
@@ -34,3 +40,172 @@ TEST_CASE_TEMPLATE("Log with custom logger", T, Server, Client) {
     CHECK(lastLogCategory == LogCategory::Server);
     CHECK(lastMessage == "Message from native");
 }
+
+TEST_CASE_TEMPLATE("Log with filter", T, Server, Client) {
+    T serverOrClient;
+
+    static std::vector<std::string> messages;
+    messages.clear();
+
+    LogFilter filter;
+    filter.minLevel = LogLevel::Info;
+    filter.categories =
+        logCategoryMask(LogCategory::Server) | logCategoryMask(LogCategory::Userland);
+    serverOrClient.setLogger(
+        [](LogLevel, LogCategory, std::string_view message) {
+            messages.emplace_back(message);
+        },
+        filter
+    );
+
+    log(serverOrClient, LogLevel::Debug, LogCategory::Server, "Level below minimum");
+    log(serverOrClient, LogLevel::Error, LogCategory::Network, "Category not in mask");
+    log(serverOrClient, LogLevel::Info, LogCategory::Server, "Server");
+    log(serverOrClient.handle(), LogLevel::Fatal, LogCategory::Userland, "Userland");
+    CHECK(messages == std::vector<std::string>{"Server", "Userland"});
+
+    CHECK(LogFilter{}.accepts(LogLevel::Fatal, LogCategory::Network));
+    CHECK(
+        LogFilter{}.accepts(LogLevel::Trace, LogCategory::Network) ==
+        (logLevelMin == LogLevel::Trace)
+    );
+}
+
+static void logRecord(const StructuredLogger& logger, const char* format, ...) {
+    va_list args{};  // NOLINT
+    va_start(args, format);  // NOLINT
+    logger(LogRecord(LogLevel::Info, LogCategory::Userland, format, args));
+    va_end(args);  // NOLINT
+}
+
+TEST_CASE("LogRecord") {
+    std::string format;
+    std::string message;
+    std::string truncated;
+    const StructuredLogger logger = [&](const LogRecord& record) {
+        CHECK(record.getLevel() == LogLevel::Info);
+        CHECK(record.getCategory() == LogCategory::Userland);
+        format = record.getFormat();
+        message = record.format();
+        message = record.format();  // arguments are copied, format again
+        char buffer[6]{};
+        CHECK(record.formatTo(buffer, sizeof(buffer)) == static_cast<int>(message.size()));
+        truncated = buffer;
+    };
+    logRecord(logger, "%s %d %.1f", "value", 42, 1.5);
+    CHECK(format == "%s %d %.1f");
+    CHECK(message == "value 42 1.5");
+    CHECK(truncated == "value");
+}
+
+TEST_CASE_TEMPLATE("Log with structured logger", T, Server, Client) {
+    T serverOrClient;
+
+    static std::vector<std::string> formats;
+    static std::vector<std::string> messages;
+    formats.clear();
+    messages.clear();
+
+    LogFilter filter;
+    filter.minLevel = LogLevel::Info;
+    serverOrClient.setStructuredLogger(
+        [](const LogRecord& record) {
+            formats.emplace_back(record.getFormat());
+            messages.push_back(record.format());
+        },
+        filter
+    );
+
+    // passing a nullptr should do nothing
+    serverOrClient.setStructuredLogger(nullptr);
+
+    log(serverOrClient, LogLevel::Debug, LogCategory::Userland, "Filtered");
+    log(serverOrClient, LogLevel::Info, LogCategory::Userland, "Message");
+    CHECK(formats == std::vector<std::string>{"Message"});
+    CHECK(messages == std::vector<std::string>{"Message"});
+
+    // replaced by a logger of formatted messages
+    std::vector<std::string> formatted;
+    serverOrClient.setLogger([&](LogLevel, LogCategory, std::string_view message) {
+        formatted.emplace_back(message);
+    });
+    log(serverOrClient, LogLevel::Info, LogCategory::Userland, "Formatted");
+    CHECK(messages.size() == 1);
+    CHECK(formatted == std::vector<std::string>{"Formatted"});
+}
+
+TEST_CASE_TEMPLATE("Log with asynchronous logger", T, Server, Client) {
+    struct Entry {
+        LogLevel level;
+        LogCategory category;
+        std::string message;
+    };
+
+    // declared before the server/client to outlive its logging thread
+    std::mutex mutex;
+    std::vector<Entry> entries;
+    T serverOrClient;
+    const auto waitForEntries = [&](size_t count) {
+        for (int i = 0; i < 200; ++i) {
+            {
+                const std::lock_guard lock(mutex);
+                if (entries.size() >= count) {
+                    return;
+                }
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    };
+
+    AsyncLoggerOptions options;
+    options.filter.minLevel = LogLevel::Info;
+    serverOrClient.setAsyncLogger(
+        [&](LogLevel level, LogCategory category, std::string_view message) {
+            const std::lock_guard lock(mutex);
+            entries.push_back({level, category, std::string(message)});
+        },
+        options
+    );
+
+    // passing a nullptr should do nothing
+    serverOrClient.setAsyncLogger(nullptr);
+
+    log(serverOrClient, LogLevel::Debug, LogCategory::Userland, "Filtered");
+    log(serverOrClient, LogLevel::Info, LogCategory::Userland, "First");
+    log(serverOrClient.handle(), LogLevel::Warning, LogCategory::Server, "Second");
+    log(serverOrClient, LogLevel::Error, LogCategory::Userland, std::string(1000, 'x'));
+    waitForEntries(3);
+
+    const std::lock_guard lock(mutex);
+    REQUIRE(entries.size() == 3);
+    CHECK(entries[0].level == LogLevel::Info);
+    CHECK(entries[0].category == LogCategory::Userland);
+    CHECK(entries[0].message == "First");
+    CHECK(entries[1].level == LogLevel::Warning);
+    CHECK(entries[1].category == LogCategory::Server);
+    CHECK(entries[1].message == "Second");
+    CHECK(entries[2].level == LogLevel::Error);
+    CHECK(entries[2].message == std::string(AsyncLoggerOptions::maxMessageLength, 'x'));
+}
+
+TEST_CASE_TEMPLATE("Replace asynchronous logger while logging", T, Server, Client) {
+    std::atomic<size_t> count{0};
+    T serverOrClient;
+    const auto logger = [&](LogLevel, LogCategory, std::string_view) { ++count; };
+    serverOrClient.setAsyncLogger(logger);
+
+    std::atomic<bool> stop{false};
+    std::thread producer([&] {
+        while (!stop) {
+            log(serverOrClient, LogLevel::Warning, LogCategory::Userland, "Message");
+        }
+    });
+    for (int i = 0; i < 10; ++i) {
+        serverOrClient.setAsyncLogger(logger);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    stop = true;
+    producer.join();
+    serverOrClient.setLogger(logger);  // stop the worker, drain the remaining messages
+    CHECK(count > 0);
+}
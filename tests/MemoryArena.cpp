@@ -0,0 +1,77 @@
+#include <cstdint>
+#include <cstring>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/MemoryArena.h"
+#include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/Composed.h"
+
+using namespace opcua;
+
+TEST_CASE("MemoryArena") {
+    MemoryArena arena(1024);
+
+    SUBCASE("Allocate") {
+        void* ptr1 = arena.allocate(10);
+        void* ptr2 = arena.allocate(20);
+        CHECK(ptr1 != nullptr);
+        CHECK(ptr2 != nullptr);
+        CHECK(ptr1 != ptr2);
+        CHECK(reinterpret_cast<uintptr_t>(ptr1) % alignof(std::max_align_t) == 0);
+        CHECK(reinterpret_cast<uintptr_t>(ptr2) % alignof(std::max_align_t) == 0);
+        CHECK(arena.owns(ptr1));
+        CHECK(arena.owns(ptr2));
+        CHECK(arena.bytesAllocated() == 30);
+    }
+
+    SUBCASE("Allocate larger than chunk size") {
+        void* ptr = arena.allocate(4096);
+        CHECK(arena.owns(ptr));
+    }
+
+    SUBCASE("Reallocate") {
+        auto* ptr = static_cast<char*>(arena.allocate(4));
+        std::memcpy(ptr, "abc", 4);
+        auto* resized = static_cast<char*>(arena.reallocate(ptr, 100));
+        CHECK(std::strcmp(resized, "abc") == 0);
+    }
+
+    SUBCASE("Foreign pointer") {
+        int value = 0;
+        CHECK_FALSE(arena.owns(&value));
+    }
+
+    SUBCASE("Release") {
+        void* ptr = arena.allocate(10);
+        arena.release();
+        CHECK_FALSE(arena.owns(ptr));
+        CHECK(arena.bytesAllocated() == 0);
+    }
+}
+
+#ifdef UA_ENABLE_MALLOC_SINGLETON
+TEST_CASE("MemoryArenaScope") {
+    MemoryArena arena;
+    const String original("test");
+    {
+        MemoryArenaScope scope(arena);
+        String copy = original;
+        CHECK(arena.owns(copy->data));
+        CHECK(copy == original);
+
+        SUBCASE("Calloc overflow") {
+            CHECK(UA_calloc(SIZE_MAX / 2 + 1, 2) == nullptr);
+        }
+
+        SUBCASE("Nested scope") {
+            MemoryArena inner;
+            MemoryArenaScope innerScope(inner);
+            String innerCopy = copy;
+            CHECK(inner.owns(innerCopy->data));
+        }
+    }
+    CHECK(arena.bytesAllocated() > 0);
+    arena.release();
+}
+#endif
@@ -0,0 +1,94 @@
+#include <doctest/doctest.h>
+
+#include "open62541pp/Client.h"
+#include "open62541pp/MemoryStatistics.h"
+#include "open62541pp/Node.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/ValueBackend.h"
+#include "open62541pp/detail/helper.h"
+#include "open62541pp/types/NodeId.h"
+
+#include "open62541_impl.h"
+
+using namespace opcua;
+
+TEST_CASE("MemoryStatistics") {
+    Server server;
+
+    SUBCASE("Category names") {
+        CHECK(getMemoryCategoryName(MemoryCategory::NativeAllocation) == "NativeAllocation");
+        CHECK(getMemoryCategoryName(MemoryCategory::NodeContext) == "NodeContext");
+    }
+
+    SUBCASE("Node contexts") {
+        const auto before = server.getMemoryStatistics();
+        REQUIRE(before.findCategory(MemoryCategory::NodeContext) != nullptr);
+        CHECK(before.findCategory(MemoryCategory::SubscriptionContext) == nullptr);
+
+        const NodeId id{1, 1000};
+        server.getObjectsNode().addVariable(id, "testVariable");
+        server.setVariableNodeValueCallback(id, ValueCallback{});
+
+        const auto after = server.getMemoryStatistics();
+        const auto* nodeContexts = after.findCategory(MemoryCategory::NodeContext);
+        REQUIRE(nodeContexts != nullptr);
+        CHECK(nodeContexts->objects > before.findCategory(MemoryCategory::NodeContext)->objects);
+        CHECK(nodeContexts->currentBytes > 0);
+        CHECK(nodeContexts->peakBytes >= nodeContexts->currentBytes);
+        CHECK(nodeContexts->allocations >= nodeContexts->objects);
+        CHECK(after.currentBytes() >= nodeContexts->currentBytes);
+    }
+
+    SUBCASE("Native allocations and copies") {
+        const auto getCategory = [&](MemoryCategory category) {
+            return *server.getMemoryStatistics().findCategory(category);
+        };
+        const auto& stringType = UA_TYPES[UA_TYPES_STRING];
+        const UA_String str = UA_STRING_STATIC("abc");
+
+        CHECK_FALSE(server.isMemoryAccountingEnabled());
+        auto allocations = getCategory(MemoryCategory::NativeAllocation).allocations;
+        auto copies = getCategory(MemoryCategory::NativeCopy).allocations;
+        (void)detail::allocateUniquePtr<UA_String>(stringType);
+        {
+            UA_String copied = detail::copy(str, stringType);
+            UA_clear(&copied, &stringType);
+        }
+        CHECK(getCategory(MemoryCategory::NativeAllocation).allocations == allocations);
+        CHECK(getCategory(MemoryCategory::NativeCopy).allocations == copies);
+
+        server.setMemoryAccountingEnabled(true);
+        CHECK(server.isMemoryAccountingEnabled());
+        const auto allocated = getCategory(MemoryCategory::NativeAllocation);
+        (void)detail::allocateUniquePtr<UA_String>(stringType);
+        const auto allocatedAfter = getCategory(MemoryCategory::NativeAllocation);
+        CHECK(allocatedAfter.allocations == allocated.allocations + 1);
+        CHECK(allocatedAfter.allocatedBytes == allocated.allocatedBytes + sizeof(UA_String));
+
+        const auto copied = getCategory(MemoryCategory::NativeCopy);
+        {
+            UA_String copy = detail::copy(str, stringType);
+            UA_clear(&copy, &stringType);
+        }
+        CHECK(getCategory(MemoryCategory::NativeCopy).allocations == copied.allocations + 1);
+        CHECK(getCategory(MemoryCategory::NativeCopy).allocatedBytes > copied.allocatedBytes);
+        CHECK(getCategory(MemoryCategory::NativeCopy).objects == 0);  // totals only
+
+        server.setMemoryAccountingEnabled(false);
+        allocations = getCategory(MemoryCategory::NativeAllocation).allocations;
+        (void)detail::allocateUniquePtr<UA_String>(stringType);
+        CHECK(getCategory(MemoryCategory::NativeAllocation).allocations == allocations);
+    }
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+    SUBCASE("Client contexts") {
+        Client client;
+        const auto statistics = client.getMemoryStatistics();
+        const auto* subscriptions = statistics.findCategory(MemoryCategory::SubscriptionContext);
+        REQUIRE(subscriptions != nullptr);
+        CHECK(subscriptions->objects == 0);
+        CHECK(statistics.findCategory(MemoryCategory::MonitoredItemContext) != nullptr);
+        CHECK(statistics.findCategory(MemoryCategory::NodeContext) == nullptr);
+    }
+#endif
+}
@@ -0,0 +1,82 @@
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/Client.h"
+#include "open62541pp/Config.h"
+#include "open62541pp/MethodDispatcher.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/services/Attribute.h"
+#include "open62541pp/services/Method.h"
+#include "open62541pp/services/NodeManagement.h"
+
+#include "helper/ServerClientSetup.h"
+
+using namespace opcua;
+
+#ifdef UAPP_HAS_ASYNC_OPERATIONS
+TEST_CASE("MethodDispatcher") {
+    ServerClientSetup setup;
+    setup.client.connect(setup.endpointUrl);
+
+    const NodeId objectsId{ObjectId::ObjectsFolder};
+    const NodeId methodId{1, 1000};
+    std::atomic<int> running{0};
+    std::atomic<int> maxRunning{0};
+    std::atomic<bool> release{false};
+    services::addMethod(
+        setup.server,
+        objectsId,
+        methodId,
+        "slow",
+        [&](Span<const Variant> inputs, Span<Variant> outputs) {
+            const int current = ++running;
+            int expected = maxRunning;
+            while (current > expected && !maxRunning.compare_exchange_weak(expected, current)) {
+            }
+            while (!release) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            --running;
+            outputs[0].setScalarCopy(inputs[0].getScalarCopy<int32_t>() + 1);
+        },
+        {Argument("x", {}, DataTypeId::Int32, ValueRank::Scalar)},
+        {Argument("y", {}, DataTypeId::Int32, ValueRank::Scalar)}
+    );
+
+    SUBCASE("Single dispatcher per server") {
+        MethodDispatcher dispatcher(setup.server, 1);
+        CHECK(dispatcher.getThreadCount() == 1);
+        CHECK_THROWS(MethodDispatcher(setup.server, 1));
+    }
+
+    SUBCASE("Server loop is not blocked") {
+        MethodDispatcher dispatcher(setup.server, 2);
+        dispatcher.dispatch(methodId, 1);
+
+        std::vector<std::future<std::vector<Variant>>> futures;
+        for (int32_t i = 0; i < 3; ++i) {
+            futures.push_back(std::async(std::launch::async, [&, i] {
+                Client client;
+                client.connect(setup.endpointUrl);
+                return services::call(client, objectsId, methodId, {Variant::fromScalar(i)});
+            }));
+        }
+        // other services are processed while the method is running
+        while (running == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        CHECK_NOTHROW(services::readValue(setup.client, VariableId::Server_ServerStatus_State));
+        release = true;
+        for (int32_t i = 0; i < 3; ++i) {
+            CHECK(futures[i].get().at(0).getScalar<int32_t>() == i + 1);
+        }
+        CHECK(maxRunning == 1);  // concurrency limit
+        CHECK(dispatcher.getDeferredCount() == 0);
+    }
+}
+#endif
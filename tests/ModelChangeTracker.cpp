@@ -0,0 +1,134 @@
+#include <map>
+#include <set>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/AttributeCache.h"
+#include "open62541pp/BrowsePathResolver.h"
+#include "open62541pp/Config.h"
+#include "open62541pp/Event.h"
+#include "open62541pp/ModelChangeTracker.h"
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/Subscription.h"
+#include "open62541pp/services/NodeManagement.h"
+#include "open62541pp/types/Variant.h"
+
+#include "helper/ServerClientSetup.h"
+
+using namespace opcua;
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+TEST_CASE("ModelChangeTracker") {
+    ServerClientSetup setup;
+    auto& server = setup.server;
+    auto& client = setup.client;
+
+    // Objects/Line/Motor{1,2}
+    const NodeId lineId{1, "Line"};
+    const NodeId motor1Id{1, "Motor1"};
+    const NodeId motor2Id{1, "Motor2"};
+    services::addFolder(server, ObjectId::ObjectsFolder, lineId, "Line");
+    services::addObject(server, lineId, motor1Id, "Motor1");
+    services::addObject(server, lineId, motor2Id, "Motor2");
+    setup.client.connect(setup.endpointUrl);
+
+    ModelChangeTracker tracker(client, {lineId});
+    auto sub = client.createSubscription();
+    tracker.subscribe(sub);
+
+    // mirror of the hierarchical references
+    std::map<NodeId, std::set<NodeId>> mirror;
+    std::vector<NodeId> changedSubtrees;
+    std::vector<NodeId> deletedNodes;
+    ModelChangeHandler handler;
+    handler.onSubtreeChanged = [&](const NodeId& id) {
+        changedSubtrees.push_back(id);
+        mirror.erase(id);
+    };
+    handler.onReference = [&](const NodeId& sourceId, const ReferenceDescription& reference) {
+        mirror[sourceId].insert(reference.getNodeId().getNodeId());
+    };
+    handler.onNodeDeleted = [&](const NodeId& id) {
+        deletedNodes.push_back(id);
+        mirror.erase(id);
+    };
+
+    CHECK(tracker.isStale());
+    CHECK(tracker.update(handler) == 3);
+    CHECK_FALSE(tracker.isStale());
+    CHECK(changedSubtrees == std::vector<NodeId>{lineId});
+    CHECK(mirror[lineId] == std::set<NodeId>{motor1Id, motor2Id});
+    CHECK(tracker.update(handler) == 0);  // no pending changes
+
+    const auto triggerChanges = [&](const std::vector<UA_ModelChangeStructureDataType>& changes) {
+        Event event(server, ObjectTypeId::GeneralModelChangeEventType);
+        event.writeProperty(
+            {0, "Changes"},
+            Variant::fromArray(changes, UA_TYPES[UA_TYPES_MODELCHANGESTRUCTUREDATATYPE])
+        );
+        event.trigger();
+        for (int i = 0; i < 100 && tracker.getPendingChanges().size() < changes.size(); ++i) {
+            client.runIterate(10);
+        }
+        REQUIRE(tracker.getPendingChanges().size() == changes.size());
+    };
+
+    SUBCASE("Incremental update") {
+        const NodeId motor3Id{1, "Motor3"};
+        services::addObject(server, lineId, motor3Id, "Motor3");
+        services::deleteNode(server, motor1Id);
+        changedSubtrees.clear();
+
+        auto& cache = client.enableAttributeCache();
+        cache.put(motor1Id, AttributeId::DisplayName, DataValue());
+        cache.put(motor2Id, AttributeId::DisplayName, DataValue());
+        BrowsePathResolver resolver(client);
+        tracker.addBrowsePathResolver(resolver);
+        const std::vector<QualifiedName> path{{1, "Line"}, {1, "Motor2"}};
+        CHECK(resolver.resolvePath(ObjectId::ObjectsFolder, path) == motor2Id);
+        CHECK(resolver.cachedSegments() > 0);
+        client.registerNodes({motor1Id});
+
+        triggerChanges({
+            {*motor3Id.handle(), {}, static_cast<uint8_t>(ModelChangeVerb::NodeAdded)},
+            {*lineId.handle(), {}, static_cast<uint8_t>(ModelChangeVerb::ReferenceAdded)},
+            {*motor1Id.handle(), {}, static_cast<uint8_t>(ModelChangeVerb::NodeDeleted)},
+        });
+        const auto pending = tracker.getPendingChanges();
+        CHECK(pending[0].affected == motor3Id);
+        CHECK(pending[0].has(ModelChangeVerb::NodeAdded));
+        CHECK_FALSE(pending[0].has(ModelChangeVerb::NodeDeleted));
+
+        CHECK(tracker.update(handler) == 4);  // Motor3 subtree + Line subtree
+        CHECK(tracker.getPendingChanges().empty());
+        CHECK(changedSubtrees == std::vector<NodeId>{motor3Id, lineId});
+        CHECK(deletedNodes == std::vector<NodeId>{motor1Id});
+        CHECK(mirror[lineId] == std::set<NodeId>{motor2Id, motor3Id});
+        CHECK(cache.size() == 1);  // Motor2 not affected
+        CHECK(resolver.cachedSegments() == 0);
+        CHECK(client.getRegisteredNodeId(motor1Id) == motor1Id);
+    }
+
+    SUBCASE("Events without changes mark the mirror as stale") {
+        Event event(server, ObjectTypeId::BaseModelChangeEventType);
+        event.trigger();
+        for (int i = 0; i < 100 && !tracker.isStale(); ++i) {
+            client.runIterate(10);
+        }
+        CHECK(tracker.isStale());
+        changedSubtrees.clear();
+        CHECK(tracker.update(handler) == 3);
+        CHECK(changedSubtrees == std::vector<NodeId>{lineId});
+    }
+
+    SUBCASE("Data type changes only invalidate caches") {
+        triggerChanges({
+            {*motor2Id.handle(), {}, static_cast<uint8_t>(ModelChangeVerb::DataTypeChanged)},
+        });
+        changedSubtrees.clear();
+        CHECK(tracker.update(handler) == 0);
+        CHECK(changedSubtrees.empty());
+    }
+}
+#endif
@@ -0,0 +1,53 @@
+#include <thread>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "MpscQueue.h"
+
+using namespace opcua;
+
+TEST_CASE("MpscQueue") {
+    detail::MpscQueue<int> queue;
+
+    SUBCASE("Empty") {
+        CHECK(queue.empty());
+        CHECK_FALSE(queue.pop().has_value());
+    }
+
+    SUBCASE("FIFO order") {
+        queue.push(1);
+        queue.push(2);
+        CHECK_FALSE(queue.empty());
+        CHECK(queue.pop().value() == 1);
+        CHECK(queue.pop().value() == 2);
+        CHECK(queue.empty());
+    }
+
+    SUBCASE("Multiple producers") {
+        constexpr int producers = 4;
+        constexpr int itemsPerProducer = 10000;
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; ++p) {
+            threads.emplace_back([&queue, p] {
+                for (int i = 0; i < itemsPerProducer; ++i) {
+                    queue.push(p * itemsPerProducer + i);
+                }
+            });
+        }
+        std::vector<int> last(producers, -1);
+        int received = 0;
+        while (received < producers * itemsPerProducer) {
+            if (auto value = queue.pop()) {
+                const int producer = *value / itemsPerProducer;
+                CHECK(*value > last.at(producer));  // ordered per producer
+                last.at(producer) = *value;
+                ++received;
+            }
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        CHECK(queue.empty());
+    }
+}
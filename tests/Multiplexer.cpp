@@ -0,0 +1,80 @@
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/Client.h"
+#include "open62541pp/Multiplexer.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/services/Attribute_highlevel.h"
+
+using namespace opcua;
+
+TEST_CASE("Multiplexer") {
+    SUBCASE("Many servers with few threads") {
+        std::vector<std::unique_ptr<Server>> servers;
+        for (uint16_t port = 4850; port < 4858; ++port) {
+            servers.push_back(std::make_unique<Server>(port));
+        }
+        Multiplexer multiplexer({2});
+        CHECK(multiplexer.threadCount() == 2);
+        for (auto& server : servers) {
+            multiplexer.add(*server);
+        }
+        CHECK(multiplexer.size() == servers.size());
+        CHECK_THROWS_AS(multiplexer.add(*servers[0]), BadStatus);
+
+        Client client;
+        client.connect("opc.tcp://localhost:4857");
+        multiplexer.add(client);
+        CHECK(multiplexer.size() == servers.size() + 1);
+
+        // synchronous request of another thread, served by the multiplexed server
+        const NodeId id{0, UA_NS0ID_SERVER_SERVERSTATUS_STATE};
+        Client other;
+        other.connect("opc.tcp://localhost:4850");
+        CHECK(services::readValue(other, id).isScalar());
+        other.disconnect();
+
+        multiplexer.remove(client);
+        for (auto& server : servers) {
+            multiplexer.remove(*server);
+        }
+        CHECK(multiplexer.size() == 0);
+        client.disconnect();
+    }
+
+    SUBCASE("Start server with first iteration") {
+        Server server(4850);
+        Multiplexer multiplexer({1});
+        multiplexer.add(server);
+        multiplexer.wake(server);
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+        while (!server.isRunning() && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        CHECK(server.isRunning());
+        multiplexer.remove(server);
+        CHECK(multiplexer.size() == 0);
+    }
+
+    SUBCASE("Exceptions") {
+        Client client;  // not connected, every iteration throws
+        std::atomic<int> exceptions{0};
+        MultiplexerOptions options;
+        options.threads = 1;
+        options.maxInterval = std::chrono::milliseconds(1);
+        options.onException = [&](std::exception_ptr) { ++exceptions; };
+        Multiplexer multiplexer(options);
+        multiplexer.add(client);
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+        while (exceptions < 2 && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        CHECK(exceptions >= 2);
+        CHECK(multiplexer.size() == 1);
+    }
+}
@@ -0,0 +1,36 @@
+#include <string>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/NamespaceTable.h"
+
+using namespace opcua;
+
+TEST_CASE("NamespaceTable") {
+    const NamespaceTable table({"http://opcfoundation.org/UA/", "urn:test", "http://test.org"});
+    CHECK(table.size() == 3);
+    CHECK(table.getUri(1) == "urn:test");
+    CHECK_THROWS(table.getUri(3));
+
+    SUBCASE("Find") {
+        CHECK(table.find("http://opcfoundation.org/UA/") == 0);
+        CHECK(table.find("http://test.org") == 2);
+        CHECK_FALSE(table.find("urn:unknown").has_value());
+    }
+
+    SUBCASE("Copy") {
+        NamespaceTable copy;
+        CHECK(copy.empty());
+        copy = table;
+        CHECK(copy.getUris() == table.getUris());
+        CHECK(copy.find("urn:test") == 1);
+    }
+
+    SUBCASE("Resolve") {
+        CHECK(table.resolve(ExpandedNodeId(NodeId(0, 1000), "urn:test", 0)) == NodeId(1, 1000));
+        CHECK(table.resolve(ExpandedNodeId(NodeId(3, 1000))) == NodeId(3, 1000));
+        CHECK_FALSE(table.resolve(ExpandedNodeId(NodeId(0, 1000), "urn:unknown", 0)).has_value());
+        CHECK_FALSE(table.resolve(ExpandedNodeId(NodeId(0, 1000), "urn:test", 1)).has_value());
+    }
+}
@@ -1,6 +1,6 @@
 #include <doctest/doctest.h>
 
-#include <algorithm>  // any_of
+#include <algorithm>  // any_of, find_if
 
 #include "open62541pp/Config.h"
 #include "open62541pp/Node.h"
@@ -106,6 +106,34 @@ TEST_CASE_TEMPLATE("Node", ServerOrClient, Server, Client) {
         CHECK(std::any_of(nodes.begin(), nodes.end(), [&](auto& node) { return node == objNode; }));
     }
 
+    SUBCASE("Browse children with attributes") {
+        services::writeValue(setup.server, varId, Variant::fromScalar(11.5));
+        const auto children = objNode.browseChildrenWith(
+            {AttributeId::BrowseName, AttributeId::Value, AttributeId::AccessLevel}
+        );
+        const auto it = std::find_if(children.begin(), children.end(), [&](auto& child) {
+            return child.first == varNode;
+        });
+        REQUIRE(it != children.end());
+        const auto& attributes = it->second.attributes;
+        CHECK(attributes.nodeId == varId);
+        CHECK(attributes.nodeClass == NodeClass::Variable);
+        CHECK(attributes.browseName == QualifiedName(1, "variable"));
+        CHECK(attributes.value.template getScalarCopy<double>() == 11.5);
+        CHECK(attributes.accessLevel == uint8_t{0xFF});
+        CHECK(
+            it->second.typeDefinition.getNodeId() == NodeId(VariableTypeId::BaseDataVariableType)
+        );
+
+        const auto server = std::find_if(children.begin(), children.end(), [&](auto& child) {
+            return child.first.getNodeId() == NodeId(0, UA_NS0ID_SERVER);
+        });
+        REQUIRE(server != children.end());
+        CHECK(server->second.attributes.has(AttributeId::DisplayName));
+        CHECK(server->second.attributes.getStatus(AttributeId::Value) ==
+              UA_STATUSCODE_BADATTRIBUTEIDINVALID);
+    }
+
     SUBCASE("Browse child") {
         CHECK_THROWS_WITH(rootNode.browseChild({{0, "Invalid"}}), "BadNoMatch");
         CHECK_EQ(
@@ -150,6 +178,47 @@ TEST_CASE_TEMPLATE("Node", ServerOrClient, Server, Client) {
         CHECK_EQ(varNode.writeHistorizing(true).readHistorizing(), true);
     }
 
+    SUBCASE("Read multiple attributes") {
+        varNode.writeDisplayName({"en-US", "name"}).writeDataType(DataTypeId::Double);
+        varNode.writeValueRank(ValueRank::OneDimension).writeArrayDimensions({3});
+        varNode.writeValueArray(std::vector<double>{1.0, 2.0, 3.0});
+        const auto snapshot = varNode.readAttributes({
+            AttributeId::NodeClass,
+            AttributeId::BrowseName,
+            AttributeId::DisplayName,
+            AttributeId::Value,
+            AttributeId::DataType,
+            AttributeId::ValueRank,
+            AttributeId::ArrayDimensions,
+            AttributeId::AccessLevel,
+            AttributeId::IsAbstract,  // not defined for variables
+        });
+        CHECK(snapshot.nodeClass == NodeClass::Variable);
+        CHECK(snapshot.browseName == QualifiedName(1, "variable"));
+        CHECK(snapshot.displayName == LocalizedText("en-US", "name"));
+        CHECK(snapshot.value.template getArrayCopy<double>() == std::vector<double>{1, 2, 3});
+        CHECK(snapshot.dataType == NodeId(DataTypeId::Double));
+        CHECK(snapshot.valueRank == ValueRank::OneDimension);
+        CHECK(snapshot.arrayDimensions == std::vector<uint32_t>{3});
+        CHECK(snapshot.accessLevel == uint8_t{0xFF});
+        CHECK(snapshot.has(AttributeId::DataType));
+        CHECK(snapshot.getStatus(AttributeId::IsAbstract) == UA_STATUSCODE_BADATTRIBUTEIDINVALID);
+        CHECK(snapshot.getStatus(AttributeId::Description) == UA_STATUSCODE_BADNODATA);
+        CHECK_FALSE(snapshot.has(AttributeId::Description));
+
+        const std::vector<NodeId> ids{varId, {0, UA_NS0ID_OBJECTSFOLDER}, {1, 9999}};
+        const auto snapshots = services::readAttributes(
+            serverOrClient, ids, {AttributeId::NodeClass, AttributeId::DisplayName}
+        );
+        REQUIRE(snapshots.size() == 3);
+        CHECK(snapshots[0].nodeClass == NodeClass::Variable);
+        CHECK(snapshots[1].nodeClass == NodeClass::Object);
+        CHECK(snapshots[1].displayName.getText() == "Objects");
+        CHECK(snapshots[2].getStatus(AttributeId::NodeClass) == UA_STATUSCODE_BADNODEIDUNKNOWN);
+
+        CHECK_THROWS_AS(varNode.readAttributes({AttributeId::DataTypeDefinition}), BadStatus);
+    }
+
     SUBCASE("Read/write value") {
         SUBCASE("Try read/write node classes other than Variable") {
             CHECK_THROWS(rootNode.template readValueScalar<int>());
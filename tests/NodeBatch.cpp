@@ -0,0 +1,151 @@
+#include <algorithm>  // any_of
+#include <string>
+#include <utility>  // move
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/Client.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Node.h"
+#include "open62541pp/NodeBatch.h"
+#include "open62541pp/Server.h"
+
+#include "helper/ServerClientSetup.h"
+
+using namespace opcua;
+
+TEST_CASE("NodeBatch (server)") {
+    Server server;
+    NodeBatch batch(server);
+
+    SUBCASE("Commit nodes in any order") {
+        // children before their parents
+        batch.addVariable({1, 1002}, {1, 1003}, "Temperature")
+            .addObject({1, 1000}, {1, 1002}, "Device")
+            .addFolder(ObjectId::ObjectsFolder, {1, 1000}, "Devices")
+            .addObject(ObjectId::ObjectsFolder, {1, 1001}, "Peer")
+            .addReference({1, 1001}, {1, 1002}, ReferenceTypeId::Organizes)
+            .addReference(ObjectId::Server, {1, 1002}, ReferenceTypeId::HasNotifier);
+        CHECK(batch.nodeCount() == 4);
+        CHECK(batch.referenceCount() == 2);
+        const auto ids = batch.commit();
+        CHECK(ids == std::vector<NodeId>{{1, 1003}, {1, 1002}, {1, 1000}, {1, 1001}});
+        CHECK(batch.nodeCount() == 0);
+
+        auto devices = server.getNode({1, 1000});
+        CHECK(devices.readBrowseName() == QualifiedName(1, "Devices"));
+        CHECK(devices.browseParent().getNodeId() == NodeId(ObjectId::ObjectsFolder));
+        auto device = devices.browseChild({{1, "Device"}});
+        CHECK(device.getNodeId() == NodeId(1, 1002));
+        CHECK(device.browseChild({{1, "Temperature"}}).getNodeId() == NodeId(1, 1003));
+
+        auto peer = server.getNode({1, 1001});
+        CHECK(peer.browseChild({{1, "Device"}}).getNodeId() == NodeId(1, 1002));
+        auto serverObject = server.getNode(ObjectId::Server);
+        const auto refs =
+            serverObject.browseReferences(BrowseDirection::Forward, ReferenceTypeId::HasNotifier);
+        CHECK(std::any_of(refs.begin(), refs.end(), [](const auto& ref) {
+            return ref.getNodeId().getNodeId() == NodeId(1, 1002);
+        }));
+    }
+
+    SUBCASE("Rollback on failure") {
+        server.getObjectsNode().addObject({1, 2000}, "Existing");
+        batch.addObject(ObjectId::ObjectsFolder, {1, 1000}, "Added")
+            .addObject(ObjectId::ObjectsFolder, {1, 2000}, "Existing")
+            .addReference({1, 1000}, {1, 2000}, ReferenceTypeId::Organizes)
+            .addReference({1, 2000}, ObjectId::Server, ReferenceTypeId::HasNotifier);
+        CHECK_THROWS_AS_MESSAGE(batch.commit(), BadStatus, "BadNodeIdExists");
+        CHECK_FALSE(server.getNode({1, 1000}).exists());
+        CHECK(server.getNode({1, 2000}).exists());
+        // references added to the existing node are removed as well
+        CHECK(server.getNode({1, 2000})
+                  .browseReferences(BrowseDirection::Forward, ReferenceTypeId::HasNotifier)
+                  .empty());
+        CHECK(batch.nodeCount() == 0);
+    }
+
+    SUBCASE("Rollback on invalid reference") {
+        batch.addObject(ObjectId::ObjectsFolder, {1, 1000}, "Added")
+            .addReference(ObjectId::ObjectsFolder, {1, 9999}, ReferenceTypeId::Organizes);
+        CHECK_THROWS_AS(batch.commit(), BadStatus);
+        CHECK_FALSE(server.getNode({1, 1000}).exists());
+    }
+
+    SUBCASE("Null node id") {
+        batch.addObject(ObjectId::ObjectsFolder, {}, "Object");
+        CHECK_THROWS_AS_MESSAGE(batch.commit(), BadStatus, "BadNodeIdInvalid");
+    }
+
+    SUBCASE("Assigned node ids not supported") {
+        NodeBatch assigned(server, {true});
+        assigned.addObject(ObjectId::ObjectsFolder, {1, 1000}, "Object");
+        CHECK_THROWS_AS_MESSAGE(assigned.commit(), BadStatus, "BadNotSupported");
+    }
+}
+
+TEST_CASE("NodeBatch (client)") {
+    ServerClientSetup setup;
+    auto& server = setup.server;
+    auto& client = setup.client;
+    client.connect(setup.endpointUrl);
+
+    SUBCASE("Requested node ids") {
+        NodeBatch batch(client);
+        batch.addVariable({1, 1001}, {1, 1002}, "Temperature")
+            .addObject(ObjectId::ObjectsFolder, {1, 1001}, "Device")
+            .addObject(ObjectId::ObjectsFolder, {1, 1000}, "Peer")
+            .addReference({1, 1000}, {1, 1001}, ReferenceTypeId::Organizes);
+        const auto ids = batch.commit();
+        CHECK(ids == std::vector<NodeId>{{1, 1002}, {1, 1001}, {1, 1000}});
+        auto device = server.getNode({1, 1001});
+        CHECK(device.browseChild({{1, "Temperature"}}).getNodeId() == NodeId(1, 1002));
+        auto peer = server.getNode({1, 1000});
+        CHECK(peer.browseChild({{1, "Device"}}).getNodeId() == NodeId(1, 1001));
+    }
+
+    SUBCASE("Assigned node ids") {
+        NodeBatch batch(client, {true});
+        // local handles, the server assigns the node ids
+        batch.addObject(ObjectId::ObjectsFolder, {1, "device"}, "Device")
+            .addVariable({1, "device"}, {1, "temperature"}, "Temperature");
+        const auto ids = batch.commit();
+        REQUIRE(ids.size() == 2);
+        CHECK(ids[0] != NodeId(1, "device"));
+        CHECK(ids[1] != NodeId(1, "temperature"));
+        auto device = server.getNode(ids[0]);
+        CHECK(device.readBrowseName() == QualifiedName(1, "Device"));
+        CHECK(device.browseChild({{1, "Temperature"}}).getNodeId() == ids[1]);
+    }
+
+    SUBCASE("Async") {
+        NodeBatch batch(client);
+        batch.addObject(ObjectId::ObjectsFolder, {1, 1000}, "Parent");
+        for (uint32_t i = 0; i < 10; ++i) {
+            batch.addVariable({1, 1000}, {1, 2000 + i}, "Child" + std::to_string(i));
+        }
+        bool completed = false;
+        StatusCode status = UA_STATUSCODE_BADINTERNALERROR;
+        std::vector<NodeId> ids;
+        batch.commitAsync([&](StatusCode code, std::vector<NodeId>& added) {
+            completed = true;
+            status = code;
+            ids = std::move(added);
+        });
+        for (int i = 0; i < 100 && !completed; ++i) {
+            client.runIterate(10);
+        }
+        CHECK(completed);
+        CHECK(status.isGood());
+        CHECK(ids.size() == 11);
+        CHECK(server.getNode({1, 2009}).readBrowseName() == QualifiedName(1, "Child9"));
+    }
+
+    SUBCASE("Failure") {
+        NodeBatch batch(client);
+        batch.addObject(ObjectId::ObjectsFolder, {1, 1000}, "Object")
+            .addObject(ObjectId::ObjectsFolder, {1, 1000}, "Duplicate");
+        CHECK_THROWS_AS_MESSAGE(batch.commit(), BadStatus, "BadNodeIdExists");
+    }
+}
@@ -0,0 +1,42 @@
+#include <utility>  // move
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/detail/NodeContext.h"
+
+using namespace opcua;
+using detail::NodeContext;
+
+TEST_CASE("NodeContext") {
+    NodeContext context;
+
+    SUBCASE("Setters") {
+        ValueCallback callback;
+        callback.onBeforeRead = [](const DataValue&) {};
+        context.setValueCallback(std::move(callback));
+        REQUIRE(context.valueCallback() != nullptr);
+        CHECK(context.valueCallback()->onBeforeRead);
+        REQUIRE(context.lastRefresh() != nullptr);
+        CHECK_FALSE(context.lastRefresh()->has_value());
+
+        context.setDataSource({});
+        REQUIRE(context.dataSource() != nullptr);
+        CHECK_FALSE(context.dataSource()->read);
+    }
+
+#ifdef UAPP_LOW_MEMORY
+    SUBCASE("Accessors do not replace the stored callback") {
+        CHECK(context.valueCallback() == nullptr);
+        CHECK(context.dataSource() == nullptr);
+
+        context.setDataSource({});
+        CHECK(context.valueCallback() == nullptr);
+        CHECK(context.lastRefresh() == nullptr);
+        CHECK(context.dataSource() != nullptr);
+
+        context.setValueCallback({});
+        CHECK(context.dataSource() == nullptr);
+        CHECK(context.valueCallback() != nullptr);
+    }
+#endif
+}
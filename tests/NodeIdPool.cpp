@@ -0,0 +1,50 @@
+#include <functional>  // hash
+#include <string>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/NodeIdPool.h"
+
+using namespace opcua;
+
+TEST_CASE("NodeIdPool") {
+    NodeIdPool pool;
+    CHECK(pool.size() == 0);
+
+    SUBCASE("Intern equal NodeIds once") {
+        const auto id1 = pool.intern(2, "Line3.Cell7.Robot2.Axis4.Torque");
+        const auto id2 = pool.intern(NodeId(2, "Line3.Cell7.Robot2.Axis4.Torque"));
+        CHECK(pool.size() == 1);
+        CHECK(&id1.get() == &id2.get());
+        CHECK(id1 == id2);
+        CHECK(id1.get() == NodeId(2, "Line3.Cell7.Robot2.Axis4.Torque"));
+    }
+
+    SUBCASE("Different NodeIds") {
+        const auto id1 = pool.intern(1, "a");
+        const auto id2 = pool.intern(1, "b");
+        const auto id3 = pool.intern(NodeId(1, 1000));
+        CHECK(pool.size() == 3);
+        CHECK(id1 != id2);
+        CHECK(id1 != id3);
+    }
+
+    SUBCASE("Cached hash") {
+        const auto id = pool.intern(1, "Test123");
+        CHECK(id.hash() == NodeId(1, "Test123").hash());
+        CHECK(std::hash<InternedNodeId>{}(id) == id.hash());
+    }
+
+    SUBCASE("Handles of different pools") {
+        NodeIdPool other;
+        CHECK(pool.intern(1, "x") == other.intern(1, "x"));
+    }
+
+    SUBCASE("Handles stay valid after rehashing") {
+        const auto first = pool.intern(1, "first");
+        for (uint32_t i = 0; i < 1000; ++i) {
+            (void)pool.intern(NodeId(1, i));
+        }
+        CHECK(first.get() == NodeId(1, "first"));
+    }
+}
@@ -0,0 +1,168 @@
+#include <string_view>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Node.h"
+#include "open62541pp/NodeSetImporter.h"
+#include "open62541pp/Server.h"
+
+using namespace opcua;
+
+// nodes are listed out of dependency order on purpose
+constexpr std::string_view nodeset = R"(<?xml version="1.0" encoding="utf-8"?>
+<UANodeSet xmlns="http://opcfoundation.org/UA/2011/03/UANodeSet.xsd"
+           xmlns:uax="http://opcfoundation.org/UA/2008/02/Types.xsd">
+  <NamespaceUris>
+    <Uri>http://example.com/nodeset/</Uri>
+  </NamespaceUris>
+  <Aliases>
+    <Alias Alias="Double">i=11</Alias>
+    <Alias Alias="Int32">i=6</Alias>
+    <Alias Alias="Organizes">i=35</Alias>
+    <Alias Alias="HasComponent">i=47</Alias>
+    <Alias Alias="HasProperty">i=46</Alias>
+    <Alias Alias="HasSubtype">i=45</Alias>
+    <Alias Alias="HasTypeDefinition">i=40</Alias>
+  </Aliases>
+  <!-- variables before their parent -->
+  <UAVariable NodeId="ns=1;i=2001" BrowseName="1:Temperature" ParentNodeId="ns=1;i=2000"
+              DataType="Double" AccessLevel="3">
+    <DisplayName>Temperature</DisplayName>
+    <Description>Temperature &lt;&#176;C&gt;</Description>
+    <References>
+      <Reference ReferenceType="HasTypeDefinition">i=63</Reference>
+      <Reference ReferenceType="HasComponent" IsForward="false">ns=1;i=2000</Reference>
+    </References>
+    <Value>
+      <uax:Double>21.5</uax:Double>
+    </Value>
+  </UAVariable>
+  <UAVariable NodeId="ns=1;s=Limits" BrowseName="1:Limits" ParentNodeId="ns=1;i=2000"
+              DataType="Int32" ValueRank="1" ArrayDimensions="3">
+    <DisplayName>Limits</DisplayName>
+    <References>
+      <Reference ReferenceType="HasTypeDefinition">i=68</Reference>
+      <Reference ReferenceType="HasProperty" IsForward="false">ns=1;i=2000</Reference>
+    </References>
+    <Value>
+      <uax:ListOfInt32>
+        <uax:Int32>1</uax:Int32>
+        <uax:Int32>2</uax:Int32>
+        <uax:Int32>3</uax:Int32>
+      </uax:ListOfInt32>
+    </Value>
+  </UAVariable>
+  <UAObject NodeId="ns=1;i=2002" BrowseName="1:Peer">
+    <DisplayName>Peer</DisplayName>
+    <References>
+      <Reference ReferenceType="Organizes" IsForward="false">i=85</Reference>
+      <Reference ReferenceType="ns=1;i=3000">ns=1;i=2000</Reference>
+    </References>
+  </UAObject>
+  <UAObject NodeId="ns=1;i=2000" BrowseName="1:Device" EventNotifier="1">
+    <DisplayName>Device</DisplayName>
+    <References>
+      <Reference ReferenceType="Organizes" IsForward="false">i=85</Reference>
+      <Reference ReferenceType="HasTypeDefinition">ns=1;i=1000</Reference>
+      <Reference ReferenceType="HasComponent">ns=1;i=2001</Reference>
+      <Reference ReferenceType="HasProperty">ns=1;s=Limits</Reference>
+    </References>
+  </UAObject>
+  <UAObjectType NodeId="ns=1;i=1000" BrowseName="1:DeviceType" IsAbstract="false">
+    <DisplayName>DeviceType</DisplayName>
+    <References>
+      <Reference ReferenceType="HasSubtype" IsForward="false">i=58</Reference>
+    </References>
+  </UAObjectType>
+  <UAReferenceType NodeId="ns=1;i=3000" BrowseName="1:ConnectedTo">
+    <DisplayName>ConnectedTo</DisplayName>
+    <InverseName>ConnectedFrom</InverseName>
+    <References>
+      <Reference ReferenceType="HasSubtype" IsForward="false">i=32</Reference>
+    </References>
+  </UAReferenceType>
+</UANodeSet>
+)";
+
+TEST_CASE("NodeSetImporter") {
+    Server server;
+    const auto result = importNodeSet(server, nodeset);
+    CHECK(result.errors.empty());
+    CHECK(result.nodes == 6);
+    CHECK(result.references >= 1);
+
+    const auto ns = server.getNamespaceIndex("http://example.com/nodeset/");
+    CHECK(ns > 1);
+
+    SUBCASE("Types") {
+        auto type = server.getNode({ns, 1000});
+        CHECK(type.readNodeClass() == NodeClass::ObjectType);
+        CHECK(type.readIsAbstract() == false);
+        auto referenceType = server.getNode({ns, 3000});
+        CHECK(referenceType.readNodeClass() == NodeClass::ReferenceType);
+        CHECK(referenceType.readInverseName().getText() == "ConnectedFrom");
+    }
+
+    SUBCASE("Hierarchy") {
+        auto device = server.getNode({ns, 2000});
+        CHECK(device.readBrowseName() == QualifiedName(ns, "Device"));
+        CHECK(device.browseParent().getNodeId() == NodeId(ObjectId::ObjectsFolder));
+        CHECK(device.browseChild({{ns, "Temperature"}}).getNodeId() == NodeId(ns, 2001));
+        CHECK(device.browseChild({{ns, "Limits"}}).getNodeId() == NodeId(ns, "Limits"));
+    }
+
+    SUBCASE("Values") {
+        auto temperature = server.getNode({ns, 2001});
+        CHECK(temperature.readDisplayName().getText() == "Temperature");
+        CHECK(temperature.readDescription().getText() == "Temperature <°C>");
+        CHECK(temperature.readValueScalar<double>() == 21.5);
+        auto limits = server.getNode({ns, "Limits"});
+        CHECK(limits.readValueArray<int32_t>() == std::vector<int32_t>{1, 2, 3});
+    }
+
+    SUBCASE("Non-hierarchical references") {
+        auto peer = server.getNode({ns, 2002});
+        const auto refs = peer.browseReferences(BrowseDirection::Forward, NodeId(ns, 3000));
+        CHECK(refs.size() == 1);
+        CHECK(refs.at(0).getNodeId().getNodeId() == NodeId(ns, 2000));
+    }
+
+    SUBCASE("Existing nodes") {
+        const auto again = importNodeSet(server, nodeset);
+        CHECK(again.nodes == 0);
+        CHECK(again.errors.size() == 6);
+        for (const auto& [id, status] : again.errors) {
+            CHECK(status == UA_STATUSCODE_BADNODEIDEXISTS);
+        }
+    }
+}
+
+TEST_CASE("NodeSetImporter unsupported values") {
+    Server server;
+    const auto result = importNodeSet(server, R"(
+        <UANodeSet>
+          <UAVariable NodeId="i=70000" BrowseName="Variable" ParentNodeId="i=85">
+            <References>
+              <Reference ReferenceType="i=35" IsForward="false">i=85</Reference>
+            </References>
+            <Value><Unknown>1</Unknown></Value>
+          </UAVariable>
+        </UANodeSet>
+    )");
+    CHECK(result.nodes == 1);
+    REQUIRE(result.errors.size() == 1);
+    CHECK(result.errors[0].first == NodeId(0, 70000));
+    CHECK(result.errors[0].second == UA_STATUSCODE_BADDATAENCODINGUNSUPPORTED);
+    CHECK(server.getNode({0, 70000}).readDisplayName().getText() == "Variable");
+}
+
+TEST_CASE("NodeSetImporter malformed documents") {
+    Server server;
+    CHECK_THROWS_AS(importNodeSet(server, "no xml"), BadStatus);
+    CHECK_THROWS_AS(importNodeSet(server, "<Other/>"), BadStatus);
+    CHECK_THROWS_AS(importNodeSet(server, "<UANodeSet><UAObject NodeId=\"i=1\""), BadStatus);
+    CHECK_THROWS_AS(importNodeSet(server, "<UANodeSet><UAObject BrowseName=\"X\"/>"), BadStatus);
+    CHECK_THROWS_AS(importNodeSetFile(server, "does-not-exist.xml"), BadStatus);
+}
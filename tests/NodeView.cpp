@@ -0,0 +1,73 @@
+#include <utility>  // move
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/Config.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Node.h"
+#include "open62541pp/NodeView.h"
+#include "open62541pp/Server.h"
+
+using namespace opcua;
+
+#ifdef UAPP_HAS_BORROWED_NODESTORE
+TEST_CASE("NodeView") {
+    Server server;
+    auto objects = server.getObjectsNode();
+
+    SUBCASE("Unknown node") {
+        CHECK_THROWS_AS_MESSAGE(NodeView(server, {1, 999}), BadStatus, "BadNodeIdUnknown");
+    }
+
+    SUBCASE("Variable node") {
+        objects.addVariable(
+            {1, 1000},
+            "Variable",
+            VariableAttributes{}
+                .setDisplayName({"", "Display name"})
+                .setDescription({"", "Description"})
+                .setDataType<double>()
+                .setValueRank(ValueRank::Scalar)
+                .setValueScalar(11.11)
+                .setAccessLevel(AccessLevel::CurrentRead | AccessLevel::CurrentWrite)
+                .setMinimumSamplingInterval(100.0)
+        );
+        const NodeView view(server, {1, 1000});
+        CHECK(view.getNodeId() == NodeId(1, 1000));
+        CHECK(view.getNodeClass() == NodeClass::Variable);
+        CHECK(view.getBrowseName() == QualifiedName(1, "Variable"));
+        CHECK(view.getDisplayName().getText() == "Display name");
+        CHECK(view.getDescription().getText() == "Description");
+        CHECK(view.getDataType() == NodeId(DataTypeId::Double));
+        CHECK(view.getValueRank() == ValueRank::Scalar);
+        CHECK(view.getArrayDimensions().empty());
+        CHECK(view.getAccessLevel() == (AccessLevel::CurrentRead | AccessLevel::CurrentWrite));
+        CHECK(view.getMinimumSamplingInterval() == 100.0);
+        CHECK_FALSE(view.getHistorizing());
+        CHECK(view.getValue().getScalar<double>() == 11.11);
+        CHECK_THROWS_AS_MESSAGE(view.getIsAbstract(), BadStatus, "BadAttributeIdInvalid");
+        CHECK_THROWS_AS_MESSAGE(view.getEventNotifier(), BadStatus, "BadAttributeIdInvalid");
+    }
+
+    SUBCASE("Object and type nodes") {
+        const NodeView object(server, ObjectId::Server);
+        CHECK(object.getNodeClass() == NodeClass::Object);
+        CHECK(object.getEventNotifier() == server.getNode(ObjectId::Server).readEventNotifier());
+        CHECK_THROWS_AS_MESSAGE(object.getDataType(), BadStatus, "BadAttributeIdInvalid");
+
+        const NodeView type(server, ObjectTypeId::BaseObjectType);
+        CHECK_FALSE(type.getIsAbstract());
+        const NodeView referenceType(server, ReferenceTypeId::HierarchicalReferences);
+        CHECK(referenceType.getIsAbstract());
+        CHECK_FALSE(referenceType.getSymmetric());
+    }
+
+    SUBCASE("Move") {
+        NodeView view(server, ObjectId::ObjectsFolder);
+        NodeView moved(std::move(view));
+        CHECK(moved.getNodeId() == NodeId(ObjectId::ObjectsFolder));
+        view = std::move(moved);
+        CHECK(view.getBrowseName() == QualifiedName(0, "Objects"));
+    }
+}
+#endif
@@ -0,0 +1,109 @@
+#include <thread>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/Config.h"
+#include "open62541pp/NotificationQueue.h"
+#include "open62541pp/detail/BoundedQueue.h"
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/Variant.h"
+
+using namespace opcua;
+
+TEST_CASE("BoundedQueue") {
+    SUBCASE("Capacity is rounded up to power of two") {
+        CHECK(detail::BoundedQueue<int>(5).capacity() == 8);
+        CHECK(detail::BoundedQueue<int>(8).capacity() == 8);
+    }
+
+    SUBCASE("FIFO order and full queue") {
+        detail::BoundedQueue<int> queue(2);
+        int value = 1;
+        CHECK(queue.tryPush(value));
+        value = 2;
+        CHECK(queue.tryPush(value));
+        value = 3;
+        CHECK_FALSE(queue.tryPush(value));
+        CHECK(queue.size() == 2);
+        CHECK(queue.tryPop().value() == 1);
+        CHECK(queue.tryPop().value() == 2);
+        CHECK_FALSE(queue.tryPop().has_value());
+    }
+
+    SUBCASE("Producer and consumer threads") {
+        constexpr int count = 100000;
+        detail::BoundedQueue<int> queue(64);
+        std::thread producer([&] {
+            for (int i = 0; i < count; ++i) {
+                int value = i;
+                while (!queue.tryPush(value)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        int expected = 0;
+        while (expected < count) {
+            if (auto value = queue.tryPop()) {
+                CHECK(*value == expected);
+                ++expected;
+            }
+        }
+        producer.join();
+        CHECK_FALSE(queue.tryPop().has_value());
+    }
+}
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+static services::MonitoredItemNotification createNotification(uint32_t monId, double value) {
+    return {1U, monId, DataValue(Variant::fromScalar(value))};
+}
+
+TEST_CASE("NotificationQueue") {
+    SUBCASE("Sink moves notifications") {
+        NotificationQueue queue(4);
+        std::vector<services::MonitoredItemNotification> batch;
+        batch.push_back(createNotification(1, 11.11));
+        batch.push_back(createNotification(2, 22.22));
+        queue.sink()(1U, batch);
+        CHECK(queue.size() == 2);
+        CHECK_FALSE(batch[0].value.hasValue());  // moved
+
+        std::vector<uint32_t> monIds;
+        CHECK(queue.drain([&](auto& notification) {
+            monIds.push_back(notification.monitoredItemId);
+        }) == 2);
+        CHECK(monIds == std::vector<uint32_t>{1, 2});
+    }
+
+    SUBCASE("Drop newest") {
+        NotificationQueue queue(1, QueueOverflow::DropNewest);
+        auto first = createNotification(1, 1.0);
+        auto second = createNotification(2, 2.0);
+        CHECK(queue.push(first));
+        CHECK_FALSE(queue.push(second));
+        CHECK(queue.droppedCount() == 1);
+        CHECK(queue.pop()->monitoredItemId == 1);
+    }
+
+    SUBCASE("Drop oldest") {
+        NotificationQueue queue(1, QueueOverflow::DropOldest);
+        auto first = createNotification(1, 1.0);
+        auto second = createNotification(2, 2.0);
+        CHECK(queue.push(first));
+        CHECK_FALSE(queue.push(second));
+        CHECK(queue.droppedCount() == 1);
+        CHECK(queue.pop()->monitoredItemId == 2);
+    }
+
+    SUBCASE("Drain with limit") {
+        NotificationQueue queue(8);
+        for (uint32_t i = 0; i < 5; ++i) {
+            auto notification = createNotification(i, 0.0);
+            queue.push(notification);
+        }
+        CHECK(queue.drain([](auto&) {}, 3) == 3);
+        CHECK(queue.size() == 2);
+    }
+}
+#endif
@@ -0,0 +1,111 @@
+#include <cstdio>  // remove
+#include <fstream>
+#include <iterator>  // istreambuf_iterator
+#include <string>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/Client.h"
+#include "open62541pp/Config.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/NotificationRecorder.h"
+#include "open62541pp/types/DataValue.h"
+
+using namespace opcua;
+
+#if defined(UA_ENABLE_SUBSCRIPTIONS) && UAPP_OPEN62541_VER_GE(1, 3) && \
+    (defined(__unix__) || defined(__APPLE__))
+TEST_CASE("NotificationRecorder") {
+    const std::string path = "open62541pp_test_notifications.rec";
+    std::remove(path.c_str());
+    Client client;
+
+    SUBCASE("Record and replay") {
+        {
+            NotificationRecorder recorder(path, 256);  // small capacity to test growth
+            for (int32_t i = 0; i < 100; ++i) {
+                recorder.record(1, 10 + (i % 3), DataValue::fromScalar(i));
+            }
+            recorder.record(2, 20, DataValue::fromScalar(String(std::string(1000, 'x'))));
+            CHECK(recorder.count() == 101);
+        }
+
+        NotificationReplayer replayer(path);
+        CHECK(replayer.count() == 101);
+        std::vector<int32_t> values;
+        size_t strings = 0;
+        const auto replayed = replayer.replay(
+            client,
+            [&](const MonitoredItem<Client>& item, const DataValue& dv) {
+                CHECK(&item.getConnection() == &client);
+                if (item.getSubscriptionId() == 1) {
+                    CHECK(item.getMonitoredItemId() == 10 + (values.size() % 3));
+                    values.push_back(dv.getValue().getScalarCopy<int32_t>());
+                } else {
+                    CHECK(item.getMonitoredItemId() == 20);
+                    CHECK(dv.getValue().getScalarCopy<std::string>().size() == 1000);
+                    ++strings;
+                }
+            }
+        );
+        CHECK(replayed == 101);
+        REQUIRE(values.size() == 100);
+        CHECK(values.front() == 0);
+        CHECK(values.back() == 99);
+        CHECK(strings == 1);
+    }
+
+    SUBCASE("Wrapped callbacks and append to existing recording") {
+        {
+            NotificationRecorder recorder(path);
+            size_t forwarded = 0;
+            const auto callback = recorder.wrap(
+                [&](const MonitoredItem<Client>& /*item*/, const DataValue& /*dv*/) { ++forwarded; }
+            );
+            callback(MonitoredItem<Client>(client, 1, 1), DataValue::fromScalar(1.0));
+            CHECK(forwarded == 1);
+
+            std::vector<services::MonitoredItemNotification> notifications(2);
+            notifications[0].subscriptionId = 1;
+            notifications[0].monitoredItemId = 2;
+            notifications[0].value = DataValue::fromScalar(2.0);
+            notifications[1].subscriptionId = 1;
+            notifications[1].monitoredItemId = 3;
+            notifications[1].value = DataValue::fromScalar(3.0);
+            recorder.wrapBatch()(1, notifications);
+            CHECK(recorder.count() == 3);
+        }
+        {
+            NotificationRecorder recorder(path);  // reopen
+            CHECK(recorder.count() == 3);
+            recorder.record(1, 4, DataValue::fromScalar(4.0));
+        }
+
+        std::vector<double> values;
+        NotificationReplayer(path).replay(
+            client,
+            [&](const MonitoredItem<Client>& item, const DataValue& dv) {
+                CHECK(item.getMonitoredItemId() == values.size() + 1);
+                values.push_back(dv.getValue().getScalarCopy<double>());
+            },
+            {1000.0}  // accelerated
+        );
+        CHECK(values == std::vector<double>{1.0, 2.0, 3.0, 4.0});
+    }
+
+    SUBCASE("Invalid files") {
+        CHECK_THROWS_AS(NotificationReplayer(path), BadStatus);  // missing
+        const std::string content(130, 'x');
+        std::ofstream(path) << content;
+        CHECK_THROWS_AS(NotificationReplayer(path), BadStatus);
+        CHECK_THROWS_AS(NotificationRecorder(path), BadStatus);
+        // the invalid file is left untouched
+        std::ifstream file(path, std::ios::binary);
+        const std::string read{std::istreambuf_iterator<char>(file), {}};
+        CHECK(read == content);
+    }
+
+    std::remove(path.c_str());
+}
+#endif
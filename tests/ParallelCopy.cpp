@@ -0,0 +1,103 @@
+#include <algorithm>  // all_of
+#include <string>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/Config.h"
+#include "open62541pp/ParallelCopy.h"
+#include "open62541pp/detail/ParallelCopy.h"
+#include "open62541pp/detail/helper.h"
+#include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/Composed.h"
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/NodeId.h"
+#include "open62541pp/types/Variant.h"
+
+using namespace opcua;
+
+TEST_CASE("ParallelCopy") {
+    std::vector<String> strings;
+    for (int i = 0; i < 100; ++i) {
+        strings.emplace_back(std::to_string(i));
+    }
+
+    SUBCASE("Disabled by default") {
+        CHECK_FALSE(detail::isParallelCopyActive());
+    }
+
+    setParallelCopy(2, 10);
+    CHECK(detail::isParallelCopyActive());
+    CHECK(detail::getParallelCopyThreshold() == 10);
+
+    SUBCASE("forEachChunkParallel") {
+        std::vector<int> visited(100, 0);
+        const auto status = detail::forEachChunkParallel(visited.size(), [&](size_t b, size_t e) {
+            for (size_t i = b; i < e; ++i) {
+                ++visited[i];
+            }
+            return UA_StatusCode{UA_STATUSCODE_GOOD};
+        });
+        CHECK(status == UA_STATUSCODE_GOOD);
+        CHECK(std::all_of(visited.begin(), visited.end(), [](int n) { return n == 1; }));
+
+        CHECK(
+            detail::forEachChunkParallel(
+                100,
+                [](size_t b, size_t) {
+                    return b == 0 ? UA_StatusCode{UA_STATUSCODE_GOOD}
+                                  : UA_StatusCode{UA_STATUSCODE_BADOUTOFMEMORY};
+                }
+            ) == UA_STATUSCODE_BADOUTOFMEMORY
+        );
+    }
+
+    SUBCASE("Variant array") {
+        const auto var = Variant::fromArray(strings);
+        CHECK(var.getArrayLength() == strings.size());
+        CHECK(var.getArrayCopy<String>() == strings);
+
+        Variant copy(var);  // NOLINT(*-unnecessary-copy-initialization)
+        CHECK(copy.getArrayLength() == strings.size());
+        CHECK(copy.getArray<String>()[99] == String("99"));
+        CHECK(copy.handle()->data != var.handle()->data);
+        copy.clear();
+        CHECK(copy.isEmpty());
+    }
+
+    SUBCASE("Small arrays are copied sequentially") {
+        std::vector<NodeId> ids{{1, 1}, {1, 2}};
+        const auto var = Variant::fromArray(ids);
+        const Variant copy(var);  // NOLINT(*-unnecessary-copy-initialization)
+        CHECK(copy.getArrayCopy<NodeId>() == ids);
+    }
+
+    SUBCASE("DataValue") {
+        const DataValue dv(Variant::fromArray(strings));
+        const DataValue copy(dv);  // NOLINT(*-unnecessary-copy-initialization)
+        CHECK(copy.getValue().getArrayCopy<String>() == strings);
+    }
+
+#if UAPP_OPEN62541_VER_GE(1, 3)
+    SUBCASE("Structure members") {
+        BrowseResult result;
+        result->statusCode = UA_STATUSCODE_BADNOTHINGTODO;
+        result->referencesSize = 1000;
+        result->references = detail::allocateArray<UA_ReferenceDescription>(
+            1000, UA_TYPES[UA_TYPES_REFERENCEDESCRIPTION]
+        );
+        for (size_t i = 0; i < 1000; ++i) {
+            result->references[i].nodeId.nodeId = UA_NODEID_STRING_ALLOC(1, "node");  // NOLINT
+        }
+
+        const BrowseResult copy(result);  // NOLINT(*-unnecessary-copy-initialization)
+        CHECK(copy.getStatusCode() == UA_STATUSCODE_BADNOTHINGTODO);
+        CHECK(copy.getReferences().size() == 1000);
+        CHECK(copy.getReferences()[999].getNodeId().getNodeId() == NodeId(1, "node"));
+        CHECK(copy->references != result->references);
+    }
+#endif
+
+    setParallelCopy(0);
+    CHECK_FALSE(detail::isParallelCopyActive());
+}
@@ -0,0 +1,61 @@
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/PreparedRead.h"
+#include "open62541pp/services/services.h"
+
+#include "helper/ServerClientSetup.h"
+
+using namespace opcua;
+
+TEST_CASE("PreparedRead") {
+    ServerClientSetup setup;
+    setup.client.connect(setup.endpointUrl);
+
+    const NodeId scalarId{1, 1000};
+    const NodeId arrayId{1, 1001};
+    const NodeId objectsId{ObjectId::ObjectsFolder};
+    services::addVariable(setup.server, objectsId, scalarId, "scalar");
+    services::addVariable(setup.server, objectsId, arrayId, "array");
+    services::writeValue(setup.server, scalarId, Variant::fromScalar(1.0));
+    services::writeValue(setup.server, arrayId, Variant::fromArray(std::vector<int32_t>{1, 2, 3}));
+
+    const std::vector<ReadValueId> items{
+        {scalarId, AttributeId::Value},
+        {arrayId, AttributeId::Value},
+        {{1, 999999}, AttributeId::Value},
+    };
+    PreparedRead read(setup.client, items);
+    CHECK(read.size() == 3);
+
+    read.execute();
+    CHECK(read.getInPlaceCount() == 0);
+    CHECK(read[0].getValue().getScalar<double>() == 1.0);
+    CHECK(read[1].getValue().getArrayCopy<int32_t>() == std::vector<int32_t>{1, 2, 3});
+    CHECK(read[2].getStatus() == UA_STATUSCODE_BADNODEIDUNKNOWN);
+
+    SUBCASE("Refresh in place") {
+        const void* scalarData = read[0].getValue().data();
+        const void* arrayData = read[1].getValue().data();
+        services::writeValue(setup.server, scalarId, Variant::fromScalar(2.0));
+        services::writeValue(
+            setup.server, arrayId, Variant::fromArray(std::vector<int32_t>{4, 5, 6})
+        );
+        read.execute();
+        CHECK(read.getInPlaceCount() == 2);
+        CHECK(read[0].getValue().data() == scalarData);
+        CHECK(read[1].getValue().data() == arrayData);
+        CHECK(read[0].getValue().getScalar<double>() == 2.0);
+        CHECK(read[1].getValue().getArrayCopy<int32_t>() == std::vector<int32_t>{4, 5, 6});
+    }
+
+    SUBCASE("Refresh with changed layout") {
+        services::writeValue(
+            setup.server, arrayId, Variant::fromArray(std::vector<int32_t>{1, 2, 3, 4})
+        );
+        read.execute();
+        CHECK(read.getInPlaceCount() == 1);
+        CHECK(read[1].getValue().getArrayCopy<int32_t>() == std::vector<int32_t>{1, 2, 3, 4});
+    }
+}
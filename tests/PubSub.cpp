@@ -0,0 +1,161 @@
+#include <chrono>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/Config.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Node.h"
+#include "open62541pp/PubSub.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/ValueBackend.h"
+#include "open62541pp/ValueStore.h"
+
+using namespace opcua;
+
+#ifdef UA_ENABLE_PUBSUB
+
+TEST_CASE("PubSub publisher") {
+    Server server;
+    const NodeId positionId{1, 1000};
+    const NodeId velocityId{1, 1001};
+    server.getObjectsNode().addVariable(positionId, "position");
+    server.getObjectsNode().addVariable(velocityId, "velocity");
+
+    auto connection = server.addPubSubConnection(
+        {"Motion", PubSubTransport::UdpUadp, "opc.udp://224.0.0.22:4840/", "", 1}
+    );
+    CHECK(!connection.getId().isNull());
+
+    SUBCASE("Fixed-size layout with external values") {
+        double position = 0.0;
+        float velocity = 0.0F;
+        ValueBackendExternal positionBackend(position);
+        ValueBackendExternal velocityBackend(velocity);
+        server.setVariableNodeValueBackend(positionId, positionBackend);
+        server.setVariableNodeValueBackend(velocityId, velocityBackend);
+
+        auto group = connection.addWriterGroup({"Axes", 100, 1.0, true});
+        auto writer = group.addDataSetWriter({"Axis 1", 1, {positionId, velocityId}});
+        CHECK(!writer.getId().isNull());
+        CHECK(!writer.getPublishedDataSetId().isNull());
+
+        CHECK_NOTHROW(group.start());
+        for (int i = 0; i < 10; ++i) {
+            position = i;
+            server.runIterate();
+        }
+        CHECK_NOTHROW(group.stop());
+        CHECK_NOTHROW(writer.remove());
+        CHECK_NOTHROW(group.remove());
+    }
+
+    SUBCASE("Fixed-size layout requires external values") {
+        auto group = connection.addWriterGroup({"Axes", 100, 1.0, true});
+        CHECK_THROWS_AS(
+            {
+                group.addDataSetWriter({"Axis 1", 1, {positionId}});
+                group.start();
+            },
+            BadStatus
+        );
+    }
+
+    SUBCASE("Dynamic layout") {
+        auto group = connection.addWriterGroup({"Axes", 100, 10.0, false});
+        group.addDataSetWriter({"Axis 1", 1, {positionId, velocityId}});
+        CHECK_NOTHROW(group.start());
+        server.runIterate();
+        CHECK_NOTHROW(group.stop());
+    }
+
+    CHECK_NOTHROW(connection.remove());
+}
+
+TEST_CASE("PubSub subscriber") {
+    Server server;
+    const NodeId positionId{1, 1000};
+    const NodeId velocityId{1, 1001};
+    const NodeId mirrorId{1, 1002};
+    server.getObjectsNode().addVariable(positionId, "position");
+    server.getObjectsNode().addVariable(velocityId, "velocity");
+    server.getObjectsNode().addVariable(mirrorId, "mirror");
+
+    auto connection = server.addPubSubConnection(
+        {"Motion", PubSubTransport::UdpUadp, "opc.udp://224.0.0.22:4840/", "", 1}
+    );
+
+    SUBCASE("Field factories") {
+        double value = 0.0;
+        const auto bound = DataSetReaderField::bind(value, mirrorId);
+        CHECK(bound.dataType == &UA_TYPES[UA_TYPES_DOUBLE]);
+        CHECK(bound.target == &value);
+        CHECK(bound.slot == nullptr);
+        CHECK(bound.targetNodeId == mirrorId);
+
+        ValueStore store;
+        auto& slot = store.registerNode(server, mirrorId);
+        const auto published = DataSetReaderField::publish(UA_TYPES[UA_TYPES_DOUBLE], slot);
+        CHECK(published.target == nullptr);
+        CHECK(published.slot == &slot);
+    }
+
+    SUBCASE("Field without data type") {
+        auto readers = connection.addReaderGroup({"Axes"});
+        CHECK_THROWS_AS(readers.addDataSetReader({"Axis 1", 1, 100, 1, {{}}, {}}), BadStatus);
+    }
+
+    SUBCASE("Decode into struct") {
+        double position = 0.0;
+        float velocity = 0.0F;
+        ValueBackendExternal positionBackend(position);
+        ValueBackendExternal velocityBackend(velocity);
+        server.setVariableNodeValueBackend(positionId, positionBackend);
+        server.setVariableNodeValueBackend(velocityId, velocityBackend);
+
+        auto writers = connection.addWriterGroup({"Axes", 100, 1.0, true});
+        writers.addDataSetWriter({"Axis 1", 1, {positionId, velocityId}});
+
+        struct Axis {
+            double position;
+            float velocity;
+        } axis{};
+
+        int messages = 0;
+        auto readers = connection.addReaderGroup({"Axes"});
+        auto reader = readers.addDataSetReader(
+            {"Axis 1",
+             1,
+             100,
+             1,
+             {DataSetReaderField::bind(axis.position, mirrorId),
+              DataSetReaderField::bind(axis.velocity)},
+             [&] { ++messages; }}
+        );
+        CHECK(!reader.getId().isNull());
+
+        position = 1.5;
+        velocity = 2.5F;
+        CHECK_NOTHROW(writers.start());
+        CHECK_NOTHROW(readers.start());
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while (messages == 0 && std::chrono::steady_clock::now() < deadline) {
+            server.runIterate();
+        }
+        CHECK(messages > 0);
+        CHECK(axis.position == 1.5);
+        CHECK(axis.velocity == 2.5F);
+        CHECK(server.getNode(mirrorId).readValueScalar<double>() == 1.5);
+
+        CHECK_NOTHROW(readers.stop());
+        CHECK_NOTHROW(writers.stop());
+        CHECK_NOTHROW(reader.remove());
+        CHECK_NOTHROW(readers.remove());
+        // the value backend of the target node is reset, the node keeps working
+        CHECK_NOTHROW(server.getNode(mirrorId).writeValueScalar(3.0));
+        CHECK(server.getNode(mirrorId).readValueScalar<double>() == 3.0);
+    }
+
+    CHECK_NOTHROW(connection.remove());
+}
+
+#endif
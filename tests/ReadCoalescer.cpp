@@ -0,0 +1,96 @@
+#include <chrono>
+#include <future>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/ReadCoalescer.h"
+#include "open62541pp/Server.h"
+
+#include "helper/Runner.h"
+#include "helper/ServerClientSetup.h"
+
+using namespace opcua;
+
+template <typename T>
+static T waitFor(Client& client, std::future<T>& future) {
+    while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+        client.runIterate(10);
+    }
+    return future.get();
+}
+
+TEST_CASE("ReadCoalescer") {
+    ServerClientSetup setup;
+    setup.client.connect(setup.endpointUrl);
+    auto& client = setup.client;
+    const NodeId serverId(ObjectId::Server);
+
+    SUBCASE("Flush after window elapsed") {
+        ReadCoalescer coalescer(client, {std::chrono::milliseconds(0)});
+        auto future1 = coalescer.readAttributeAsync(serverId, AttributeId::BrowseName);
+        auto future2 = coalescer.readAttributeAsync(serverId, AttributeId::DisplayName);
+        CHECK(coalescer.pending() == 2);
+        CHECK(waitFor(client, future1).getValue().getScalar<QualifiedName>().getName() == "Server");
+        CHECK(waitFor(client, future2).getValue().getScalar<LocalizedText>().getText() == "Server");
+        CHECK(coalescer.pending() == 0);
+    }
+
+    SUBCASE("Flush if batch size is reached") {
+        ReadCoalescer coalescer(client, {std::chrono::hours(1), 2});
+        auto future1 = coalescer.readAttributeAsync(serverId, AttributeId::BrowseName);
+        CHECK(coalescer.pending() == 1);
+        auto future2 = coalescer.readAttributeAsync(serverId, AttributeId::DisplayName);
+        CHECK(coalescer.pending() == 0);
+        CHECK_NOTHROW(waitFor(client, future1));
+        CHECK_NOTHROW(waitFor(client, future2));
+    }
+
+    SUBCASE("Per-item status codes") {
+        ReadCoalescer coalescer(client, {std::chrono::hours(1)});
+        std::vector<StatusCode> codes;
+        auto handler = [&](StatusCode code, DataValue&) { codes.push_back(code); };
+        coalescer.readAttributeAsync(serverId, AttributeId::BrowseName, handler);
+        coalescer.readAttributeAsync({0, 999999}, AttributeId::BrowseName, handler);
+        coalescer.flush();
+        while (codes.size() < 2) {
+            client.runIterate(10);
+        }
+        CHECK(codes.at(0).isGood());
+        CHECK(codes.at(1) == UA_STATUSCODE_BADNODEIDUNKNOWN);
+    }
+}
+
+TEST_CASE("ReadCoalescer operation limit of server") {
+    Server server;
+    UA_Server_getConfig(server.handle())->maxNodesPerRead = 5;
+    ServerRunner serverRunner(server);
+    Client client;
+    client.connect(ServerClientSetup::endpointUrl);
+
+    ReadCoalescer coalescer(client, {std::chrono::hours(1)});
+    CHECK(coalescer.getMaxNodesPerRead() == 5);
+
+    client.setMetricsEnabled(true);
+    std::vector<StatusCode> codes;
+    for (size_t i = 0; i < 12; ++i) {
+        coalescer.readAttributeAsync(
+            ObjectId::Server,
+            AttributeId::BrowseName,
+            [&](StatusCode code, DataValue& /* unused */) { codes.push_back(code); }
+        );
+    }
+    coalescer.flush();
+    while (codes.size() < 12) {
+        client.runIterate(10);
+    }
+    for (const auto& code : codes) {
+        CHECK(code.isGood());
+    }
+
+    // 12 reads split into requests of 5, 5 and 2 nodes
+    const auto metrics = client.getMetrics();
+    REQUIRE(metrics.services.size() == 1);  // Read
+    CHECK(metrics.services[0].requests == 3);
+}
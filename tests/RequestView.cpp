@@ -0,0 +1,104 @@
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/RequestView.h"
+#include "open62541pp/services/services.h"
+
+#include "helper/ServerClientSetup.h"
+
+using namespace opcua;
+
+TEST_CASE("RequestView") {
+    ServerClientSetup setup;
+    setup.client.connect(setup.endpointUrl);
+
+    const NodeId objectsId{ObjectId::ObjectsFolder};
+    const std::vector<NodeId> ids{{1, "variable1"}, {1, "variable2"}};
+    for (const auto& id : ids) {
+        services::addVariable(
+            setup.server,
+            objectsId,
+            id,
+            "variable",
+            VariableAttributes{}.setAccessLevel(
+                AccessLevel::CurrentRead | AccessLevel::CurrentWrite
+            )
+        );
+    }
+
+    SUBCASE("Items reference the inputs") {
+        ReadRequestView view;
+        view.add(ids[0]).add(ids[1], AttributeId::BrowseName);
+        CHECK(view.size() == 2);
+        const auto& request = view.request();
+        CHECK(request->nodesToReadSize == 2);
+        CHECK(request->nodesToRead[0].nodeId.identifier.string.data ==
+              ids[0].handle()->identifier.string.data);
+        CHECK(view.items()[1].getAttributeId() == AttributeId::BrowseName);
+
+        view.clear();
+        CHECK(view.empty());
+        CHECK(view.request()->nodesToReadSize == 0);
+    }
+
+    SUBCASE("Write and read") {
+        const std::vector<Variant> values{Variant::fromScalar(1.0), Variant::fromScalar(2.0)};
+        const DataValue dataValue(values[1]);
+        WriteRequestView writeView;
+        writeView.add(ids[0], values[0]);
+        writeView.add(ids[1], AttributeId::Value, dataValue);
+        const auto writeResponse = services::write(setup.client, writeView.request());
+        for (const auto& code : writeResponse.getResults()) {
+            CHECK(code.isGood());
+        }
+
+        ReadRequestView readView(TimestampsToReturn::Both);
+        for (const auto& id : ids) {
+            readView.add(id);
+        }
+        const auto readResponse = services::read(setup.client, readView.request());
+        const auto results = readResponse.getResults();
+        CHECK(results.size() == 2);
+        CHECK(results[0].getValue().getScalar<double>() == 1.0);
+        CHECK(results[1].getValue().getScalar<double>() == 2.0);
+        CHECK(results[0].hasSourceTimestamp());
+    }
+
+    SUBCASE("Browse") {
+        BrowseRequestView view;
+        view.add(objectsId, BrowseDirection::Forward, ReferenceTypeId::Organizes);
+        const auto response = services::browse(setup.client, view.request());
+        const auto results = response.getResults();
+        CHECK(results.size() == 1);
+        CHECK(results[0].getReferences().size() >= ids.size());
+    }
+
+#ifdef UA_ENABLE_METHODCALLS
+    SUBCASE("Call") {
+        const NodeId methodId{1, 1000};
+        services::addMethod(
+            setup.server,
+            objectsId,
+            methodId,
+            "negate",
+            [](Span<const Variant> inputs, Span<Variant> outputs) {
+                outputs[0].setScalarCopy(-inputs[0].getScalarCopy<int32_t>());
+            },
+            {Argument("x", {}, DataTypeId::Int32, ValueRank::Scalar)},
+            {Argument("y", {}, DataTypeId::Int32, ValueRank::Scalar)}
+        );
+        const std::vector<Variant> inputs{
+            Variant::fromScalar(int32_t{1}), Variant::fromScalar(int32_t{2})
+        };
+        CallRequestView view;
+        view.add(objectsId, methodId, Span<const Variant>(&inputs[0], 1));
+        view.add(objectsId, methodId, Span<const Variant>(&inputs[1], 1));
+        const auto response = services::callMany(setup.client, view.items());
+        const auto results = response.getResults();
+        CHECK(results.size() == 2);
+        CHECK(results[0].getOutputArguments()[0].getScalarCopy<int32_t>() == -1);
+        CHECK(results[1].getOutputArguments()[0].getScalarCopy<int32_t>() == -2);
+    }
+#endif
+}
@@ -83,6 +83,12 @@ TEST_CASE("tryInvoke") {
         CHECK(result.code() == 0);
     }
 
+    SUBCASE("Result of noexcept function") {
+        auto result = detail::tryInvoke([]() noexcept { return 1; });
+        CHECK(result.value() == 1);
+        CHECK(detail::tryInvoke([]() noexcept {}).code() == 0);
+    }
+
     SUBCASE("BadStatus exception") {
         auto result = detail::tryInvoke([] { throw BadStatus(badCode); });
         CHECK(result.code() == badCode);
@@ -0,0 +1,94 @@
+#include <doctest/doctest.h>
+
+#include "open62541pp/Node.h"
+#include "open62541pp/RoleAccessControl.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/Session.h"
+
+#include "helper/stringify.h"
+
+using namespace opcua;
+
+TEST_CASE("RoleAccessControl") {
+    Server server;
+    constexpr RoleMask viewer = role(0);
+    constexpr RoleMask engineer = role(1);
+
+    // plant folder with a variable in namespace 1
+    Node objects(server, ObjectId::ObjectsFolder);
+    auto plant = objects.addFolder({1, 1000}, "Plant");
+    plant.addVariable({1, 1001}, "Temperature");
+    objects.addVariable({1, 1002}, "Other");
+    objects.addVariable({1, "string-id"}, "String");
+
+    RoleAccessControl ac(true, {{{"bob", "secret"}, viewer | engineer}});
+    ac.setAnonymousRoles(viewer);
+    ac.allowNamespace(viewer | engineer, 1, Permission::Browse | Permission::Read);
+    ac.allowSubtree(engineer, {1, 1000}, Permission::All);
+    ac.compile(server);
+
+    SUBCASE("Compiled permissions") {
+        CHECK(ac.getGrantedRoles({1, 1002}, Permission::Read) == (viewer | engineer));
+        CHECK(ac.getGrantedRoles({1, 1002}, Permission::Write) == 0);
+        CHECK(ac.getGrantedRoles({1, 1000}, Permission::Write) == engineer);
+        CHECK(ac.getGrantedRoles({1, 1001}, Permission::Write) == engineer);
+        CHECK(ac.getGrantedRoles({1, 1001}, Permission::Read) == (viewer | engineer));
+        CHECK(ac.getGrantedRoles({1, "string-id"}, Permission::Browse) == (viewer | engineer));
+        CHECK(ac.getGrantedRoles({0, UA_NS0ID_SERVER}, Permission::Browse) == 0);
+        CHECK(ac.getGrantedRoles({2, 1}, Permission::Read) == 0);
+    }
+
+    SUBCASE("Compile invalidates cached decisions") {
+        const auto epoch = ac.getDecisionEpoch();
+        ac.compile(server);
+        CHECK(ac.getDecisionEpoch() != epoch);
+    }
+
+    const EndpointDescription endpointDescription{};
+    const ByteString secureChannelRemoteCertificate{};
+
+    SUBCASE("Anonymous session") {
+        Session session(server, {0, 1000});
+        CHECK(
+            ac.activateSession(session, endpointDescription, secureChannelRemoteCertificate, {}) ==
+            UA_STATUSCODE_GOOD
+        );
+        CHECK(ac.getSessionRoles(session) == viewer);
+
+        CHECK(ac.allowBrowseNode(session, {1, 1001}));
+        CHECK_FALSE(ac.allowBrowseNode(session, {0, UA_NS0ID_SERVER}));
+        CHECK(
+            ac.getUserAccessLevel(session, {1, 1001}) ==
+            (AccessLevel::CurrentRead | AccessLevel::HistoryRead)
+        );
+        CHECK(ac.getUserRightsMask(session, {1, 1001}) == 0);
+        CHECK_FALSE(ac.getUserExecutable(session, {1, 1001}));
+
+        ac.closeSession(session);
+        CHECK(ac.getSessionRoles(session) == 0);
+    }
+
+    SUBCASE("User session") {
+        Session session(server, {0, 1001});
+        UserNameIdentityToken token;
+        token.getPolicyId() = String("open62541-username-policy");
+        token.getUserName() = String("bob");
+        token.getPassword() = ByteString("secret");
+        CHECK(
+            ac.activateSession(
+                session,
+                endpointDescription,
+                secureChannelRemoteCertificate,
+                ExtensionObject::fromDecoded(token)
+            ) == UA_STATUSCODE_GOOD
+        );
+        CHECK(ac.getSessionRoles(session) == (viewer | engineer));
+
+        CHECK(ac.getUserRightsMask(session, {1, 1001}) == 0xFFFFFFFF);
+        CHECK(ac.getUserRightsMask(session, {1, 1002}) == 0);
+        CHECK(ac.getUserAccessLevel(session, {1, 1001}).allOf(AccessLevel::CurrentWrite));
+        CHECK(ac.getUserExecutable(session, {1, 1001}));
+        CHECK(ac.allowDeleteNode(session, DeleteNodesItem({1, 1001}, true)));
+        CHECK_FALSE(ac.allowDeleteNode(session, DeleteNodesItem({1, 1002}, true)));
+    }
+}
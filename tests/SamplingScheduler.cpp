@@ -0,0 +1,142 @@
+#include <algorithm>  // count
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/SamplingScheduler.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/services/Attribute.h"
+#include "open62541pp/services/NodeManagement.h"
+
+using namespace opcua;
+
+TEST_CASE("SamplingScheduler") {
+    Server server;
+    const std::vector<NodeId> ids{{1, 1000}, {1, 1001}, {1, 1002}};
+    for (const auto& id : ids) {
+        services::addVariable(server, ObjectId::ObjectsFolder, id, "Variable");
+    }
+
+    SamplingScheduler scheduler(server, std::chrono::milliseconds(5), 4);
+    CHECK(scheduler.getResolution() == std::chrono::milliseconds(5));
+
+    int calls = 0;
+    const auto groupId = scheduler.addGroup(
+        std::chrono::milliseconds(12),  // rounded up to 15 ms
+        ids,
+        [&](Span<const NodeId> groupIds, Span<DataValue> values) {
+            CHECK(groupIds.size() == 3);
+            ++calls;
+            for (size_t i = 0; i < values.size(); ++i) {
+                values[i].getValue().setScalarCopy(calls * 10 + static_cast<int>(i));
+            }
+        }
+    );
+    CHECK(scheduler.size() == 1);
+
+    auto runFor = [&](std::chrono::milliseconds duration) {
+        const auto end = std::chrono::steady_clock::now() + duration;
+        while (std::chrono::steady_clock::now() < end) {
+            server.runIterate();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    };
+
+    runFor(std::chrono::milliseconds(100));
+    CHECK(calls >= 2);
+    const int value = services::readValue(server, ids[2]).getScalar<int>();
+    CHECK(value == calls * 10 + 2);
+
+    // aligned timestamps within a group
+    const auto ts0 = services::readDataValue(server, ids[0]).getSourceTimestamp();
+    const auto ts1 = services::readDataValue(server, ids[1]).getSourceTimestamp();
+    CHECK(ts0.get() == ts1.get());
+
+    scheduler.removeGroup(groupId);
+    CHECK(scheduler.size() == 0);
+    const int callsAfterRemove = calls;
+    runFor(std::chrono::milliseconds(50));
+    CHECK(calls == callsAfterRemove);
+}
+
+TEST_CASE("SamplingScheduler provider removes its group") {
+    Server server;
+    const std::vector<NodeId> ids{{1, 1000}};
+    services::addVariable(server, ObjectId::ObjectsFolder, ids[0], "Variable");
+
+    SamplingScheduler scheduler(server, std::chrono::milliseconds(5));
+    SamplingScheduler::GroupId groupId{};
+    int calls = 0;
+    groupId = scheduler.addGroup(
+        std::chrono::milliseconds(5),
+        ids,
+        [&](Span<const NodeId>, Span<DataValue> values) {
+            ++calls;
+            scheduler.removeGroup(groupId);  // deferred, the provider is still running
+            CHECK(scheduler.size() == 0);
+            values[0].getValue().setScalarCopy(11);
+        }
+    );
+
+    const auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(50);
+    while (std::chrono::steady_clock::now() < end) {
+        server.runIterate();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    CHECK(calls == 1);
+    CHECK(scheduler.size() == 0);
+    CHECK(services::readValue(server, ids[0]).getScalar<int>() == 11);
+}
+
+TEST_CASE("SamplingScheduler priorities and tick budget") {
+    Server server;
+    const NodeId lowId(1, 1000);
+    const NodeId highId(1, 1001);
+    services::addVariable(server, ObjectId::ObjectsFolder, lowId, "Low");
+    services::addVariable(server, ObjectId::ObjectsFolder, highId, "High");
+
+    SamplingScheduler scheduler(server, std::chrono::milliseconds(5));
+    CHECK(scheduler.getTickBudget().count() == 0);
+
+    std::vector<int> calls;
+    const auto addGroup = [&](const NodeId& id, int priority) {
+        scheduler.addGroup(
+            std::chrono::milliseconds(10),  // due every second tick
+            {&id, 1},
+            [&calls, priority](Span<const NodeId> /* ids */, Span<DataValue> values) {
+                calls.push_back(priority);
+                values[0].getValue().setScalarCopy(priority);
+            },
+            static_cast<uint8_t>(priority)
+        );
+    };
+    addGroup(lowId, 0);
+    addGroup(highId, 10);
+
+    auto runFor = [&](std::chrono::milliseconds duration) {
+        const auto end = std::chrono::steady_clock::now() + duration;
+        while (std::chrono::steady_clock::now() < end) {
+            server.runIterate();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    };
+
+    SUBCASE("Higher priority first") {
+        runFor(std::chrono::milliseconds(50));
+        REQUIRE(calls.size() >= 2);
+        CHECK(calls[0] == 10);
+        CHECK(calls[1] == 0);
+        CHECK(scheduler.getDeferredCount() == 0);
+    }
+
+    SUBCASE("Deferred groups") {
+        scheduler.setTickBudget(std::chrono::nanoseconds(1));  // one group per tick
+        runFor(std::chrono::milliseconds(50));
+        REQUIRE(calls.size() >= 2);
+        CHECK(calls[0] == 10);
+        CHECK(scheduler.getDeferredCount() >= 1);
+        CHECK(std::count(calls.begin(), calls.end(), 0) >= 1);  // sampled a tick later
+    }
+}
@@ -1,11 +1,15 @@
 #include <chrono>
+#include <string>
 #include <thread>
+#include <utility>  // pair
+#include <vector>
 
 #include <doctest/doctest.h>
 
 #include "open62541pp/Node.h"
 #include "open62541pp/Server.h"
 #include "open62541pp/ValueBackend.h"
+#include "open62541pp/types/Composed.h"
 #include "open62541pp/detail/helper.h"
 #include "open62541pp/types/NodeId.h"
 
@@ -50,6 +54,15 @@ TEST_CASE("Server encryption") {
 }
 #endif
 
+#ifdef UA_ENABLE_WEBSOCKET_SERVER
+TEST_CASE("Server WebSocket endpoint") {
+    Server server;
+    CHECK_NOTHROW(server.addWebSocketEndpoint(7681));
+    CHECK(server.runIterate() > 0);
+    server.stop();
+}
+#endif
+
 TEST_CASE("Server equality operators") {
     Server server;
     CHECK(server == server);
@@ -107,6 +120,23 @@ TEST_CASE("Server configuration") {
         CHECK(detail::toString(config->applicationDescription.productUri) == "http://product.com");
     }
 
+    SUBCASE("Transport settings") {
+        auto* config = UA_Server_getConfig(server.handle());
+        server.setTransportSettings({8192, 16384, 1000000, 64});
+#if UAPP_OPEN62541_VER_GE(1, 4)
+        CHECK(config->tcpBufSize == 16384);
+        CHECK(config->tcpMaxMsgSize == 1000000);
+        CHECK(config->tcpMaxChunks == 64);
+#else
+        REQUIRE(config->networkLayersSize > 0);
+        const auto& connectionConfig = config->networkLayers[0].localConnectionConfig;
+        CHECK(connectionConfig.sendBufferSize == 8192);
+        CHECK(connectionConfig.recvBufferSize == 16384);
+        CHECK(connectionConfig.localMaxMessageSize == 1000000);
+        CHECK(connectionConfig.localMaxChunkCount == 64);
+#endif
+    }
+
     SUBCASE("Namespace array") {
         const auto namespaces = server.getNamespaceArray();
         CHECK(namespaces.size() == 2);
@@ -122,6 +152,19 @@ TEST_CASE("Server configuration") {
         CHECK(server.getNamespaceArray().at(3) == "test2");
     }
 
+    SUBCASE("Namespace table") {
+        CHECK(server.getNamespaceIndex("http://opcfoundation.org/UA/") == 0);
+        CHECK_THROWS_AS(server.getNamespaceIndex("test3"), BadStatus);
+        CHECK(server.registerNamespace("test3") == 2);
+        CHECK(server.getNamespaceTable().size() == 3);
+        CHECK(server.getNamespaceIndex("test3") == 2);
+
+        const ExpandedNodeId id(NodeId(0, "Node"), "test3", 0);
+        CHECK(server.resolveNodeId(id) == NodeId(2, "Node"));
+        const ExpandedNodeId remoteId(NodeId(0, "Node"), "test3", 1);
+        CHECK_THROWS_AS(server.resolveNodeId(remoteId), BadStatus);
+    }
+
     SUBCASE("Get default nodes") {
         // clang-format off
             CHECK_EQ(server.getRootNode().getNodeId(),    NodeId{0, UA_NS0ID_ROOTFOLDER});
@@ -169,6 +212,78 @@ TEST_CASE("ValueCallback") {
     CHECK(valueAfterWrite == 2);
 }
 
+TEST_CASE("ValueCallback with onAfterWrite only") {
+    Server server;
+    NodeId id{1, 1000};
+    auto node = server.getObjectsNode().addVariable(id, "testVariable");
+
+    int valueAfterWrite = 0;
+    ValueCallback valueCallback;
+    valueCallback.onAfterWrite = [&](const DataValue& value) {
+        valueAfterWrite = value.getValue().getScalar<int>();
+    };
+    server.setVariableNodeValueCallback(id, valueCallback);
+
+    node.writeValueScalar<int>(3);
+    CHECK(node.readValueScalar<int>() == 3);
+    CHECK(valueAfterWrite == 3);
+}
+
+TEST_CASE("ValueCallback with minimum refresh period") {
+    Server server;
+    NodeId id{1, 1000};
+    auto node = server.getObjectsNode().addVariable(id, "testVariable");
+
+    int refreshes = 0;
+    ValueCallback valueCallback;
+    valueCallback.onBeforeRead = [&](const DataValue& /* value */) {
+        node.writeValueScalar<int>(++refreshes);
+    };
+    valueCallback.minRefreshPeriod = 100ms;
+    server.setVariableNodeValueCallback(id, valueCallback);
+
+    CHECK(node.readValueScalar<int>() == 1);
+    CHECK(node.readValueScalar<int>() == 1);  // stored value
+    CHECK(node.readValueScalar<int>() == 1);
+    CHECK(refreshes == 1);
+
+    std::this_thread::sleep_for(150ms);
+    CHECK(node.readValueScalar<int>() == 2);
+    CHECK(refreshes == 2);
+}
+
+TEST_CASE("Write notification callback") {
+    Server server;
+    const std::vector<NodeId> ids{{1, 1000}, {1, 1001}};
+    for (const auto& id : ids) {
+        server.getObjectsNode().addVariable(id, "testVariable");
+    }
+
+    int calls = 0;
+    std::vector<std::pair<NodeId, int>> notified;
+    server.addWriteNotificationCallback(ids, [&](Span<const WriteNotification> notifications) {
+        ++calls;
+        for (const auto& notification : notifications) {
+            notified.emplace_back(notification.id, notification.value.getValue().getScalar<int>());
+        }
+    });
+
+    Node(server, ids[0]).writeValueScalar<int>(1);
+    Node(server, ids[1]).writeValueScalar<int>(2);
+    Node(server, ids[0]).writeValueScalar<int>(3);
+    CHECK(calls == 0);  // delivered after the next iteration
+
+    server.runIterate();
+    CHECK(calls == 1);
+    REQUIRE(notified.size() == 3);
+    CHECK(notified[0] == std::pair(ids[0], 1));
+    CHECK(notified[1] == std::pair(ids[1], 2));
+    CHECK(notified[2] == std::pair(ids[0], 3));
+
+    server.runIterate();
+    CHECK(calls == 1);  // no new writes
+}
+
 TEST_CASE("DataSource") {
     Server server;
     NodeId id{1, 1000};
@@ -197,6 +312,237 @@ TEST_CASE("DataSource") {
     CHECK(data == 1);
 }
 
+#if UAPP_OPEN62541_VER_GE(1, 2)
+TEST_CASE("External value backend") {
+    Server server;
+    NodeId id{1, 1000};
+    auto node = server.getObjectsNode().addVariable(id, "testVariable");
+
+    double data = 1.0;
+    ValueBackendExternal backend(data);
+    CHECK_NOTHROW(server.setVariableNodeValueBackend(id, backend));
+    CHECK(node.readValueScalar<double>() == 1.0);
+    data = 2.0;  // no further calls
+    CHECK(node.readValueScalar<double>() == 2.0);
+}
+#endif
+
+TEST_CASE("DataSource with backend object") {
+    Server server;
+    NodeId id{1, 1000};
+    auto node = server.getObjectsNode().addVariable(id, "testVariable");
+
+    struct Backend {
+        StatusCode read(DataValue& value, Span<const NumericRangeDimension> range, bool) noexcept {
+            lastRangeSize = range.size();
+            value.getValue().setScalar(data);
+            return UA_STATUSCODE_GOOD;
+        }
+
+        StatusCode write(const DataValue& value, Span<const NumericRangeDimension>) {
+            data = value.getValue().getScalarCopy<int>();
+            return UA_STATUSCODE_GOOD;
+        }
+
+        int data = 0;
+        size_t lastRangeSize = 0;
+    };
+
+    struct ReadOnlyBackend {
+        StatusCode read(DataValue& value, Span<const NumericRangeDimension>, bool) {
+            value.getValue().setScalarCopy(11);
+            return UA_STATUSCODE_GOOD;
+        }
+    };
+
+    SUBCASE("Read and write") {
+        Backend backend;
+        server.setVariableNodeValueBackend(id, backend);
+        CHECK(node.readValueScalar<int>() == 0);
+        CHECK_NOTHROW(node.writeValueScalar<int>(1));
+        CHECK(backend.data == 1);
+        CHECK(node.readValueScalar<int>() == 1);
+        CHECK(backend.lastRangeSize == 0);
+    }
+
+    SUBCASE("Borrowed numeric range") {
+        Backend backend;
+        server.setVariableNodeValueBackend(id, backend);
+        const ReadValueId rvid(id, AttributeId::Value, "1:3");
+        DataValue result(
+            UA_Server_read(server.handle(), rvid.handle(), UA_TIMESTAMPSTORETURN_NEITHER)
+        );
+        CHECK(backend.lastRangeSize == 1);
+    }
+
+    SUBCASE("Read-only backend") {
+        ReadOnlyBackend backend;
+        server.setVariableNodeValueBackend(id, backend);
+        CHECK(node.readValueScalar<int>() == 11);
+        CHECK_THROWS(node.writeValueScalar<int>(1));
+    }
+
+    SUBCASE("Value callbacks are rejected") {
+        Backend backend;
+        backend.data = 3;
+        server.setVariableNodeValueBackend(id, backend);
+        CHECK_THROWS_WITH(server.setVariableNodeValueCallback(id, {}), "BadInvalidState");
+        CHECK_THROWS_WITH(
+            server.addWriteNotificationCallback({&id, 1}, [](auto) {}), "BadInvalidState"
+        );
+        CHECK(node.readValueScalar<int>() == 3);
+    }
+}
+
+TEST_CASE("DataSource bulk registration") {
+    Server server;
+    const std::vector<NodeId> ids{{1, 1000}, {1, 1001}, {1, 1002}};
+    for (const auto& id : ids) {
+        server.getObjectsNode().addVariable(id, "testVariable");
+    }
+
+    SUBCASE("Shared backend") {
+        int data = 7;
+        ValueBackendDataSource backend;
+        backend.read = [&](DataValue& dv, const NumericRange&, bool) {
+            dv.getValue().setScalar(data);
+            return UA_STATUSCODE_GOOD;
+        };
+        backend.write = [&](const DataValue& dv, const NumericRange&) {
+            data = dv.getValue().getScalarCopy<int>();
+            return UA_STATUSCODE_GOOD;
+        };
+        server.setVariableNodeValueBackends(ids, backend);
+        for (const auto& id : ids) {
+            CHECK(Node(server, id).readValueScalar<int>() == 7);
+        }
+        Node(server, ids[0]).writeValueScalar<int>(8);
+        CHECK(Node(server, ids[2]).readValueScalar<int>() == 8);
+    }
+
+    SUBCASE("Backend factory") {
+        server.setVariableNodeValueBackends(ids, [](const NodeId& id) {
+            ValueBackendDataSource backend;
+            backend.read = [value = id.getIdentifierAs<uint32_t>()](
+                               DataValue& dv, const NumericRange&, bool
+                           ) {
+                dv.getValue().setScalarCopy(value);
+                return UA_STATUSCODE_GOOD;
+            };
+            return backend;
+        });
+        for (const auto& id : ids) {
+            CHECK(Node(server, id).readValueScalar<uint32_t>() == id.getIdentifierAs<uint32_t>());
+        }
+    }
+
+    SUBCASE("Rebinding is rejected") {
+        server.setVariableNodeValueBackends(ids, ValueBackendDataSource{});
+        CHECK_THROWS_WITH(
+            server.setVariableNodeValueBackend(ids[0], ValueBackendDataSource{}), "BadInvalidState"
+        );
+        CHECK_THROWS_WITH(
+            server.setVariableNodeValueBackends(ids, ValueBackendDataSource{}), "BadInvalidState"
+        );
+        CHECK_THROWS_WITH(server.setVariableNodeValueCallback(ids[1], {}), "BadInvalidState");
+    }
+
+    SUBCASE("Unknown node") {
+        const std::vector<NodeId> unknown{{1, 1000}, {1, 9999}};
+        CHECK_THROWS_AS(
+            server.setVariableNodeValueBackends(unknown, ValueBackendDataSource{}), BadStatus
+        );
+    }
+}
+
+TEST_CASE("DataSource with keyed backend object") {
+    Server server;
+    const std::vector<NodeId> ids{{1, 1000}, {1, 1001}, {1, 1002}};
+    for (const auto& id : ids) {
+        server.getObjectsNode().addVariable(id, "testVariable");
+    }
+
+    struct Driver {
+        StatusCode read(uint64_t key, DataValue& value, Span<const NumericRangeDimension>, bool) {
+            value.getValue().setScalarCopy(tags.at(key));
+            return UA_STATUSCODE_GOOD;
+        }
+
+        StatusCode write(uint64_t key, const DataValue& value, Span<const NumericRangeDimension>) {
+            tags.at(key) = value.getValue().getScalarCopy<int>();
+            return UA_STATUSCODE_GOOD;
+        }
+
+        std::vector<int> tags{10, 11, 12};
+    };
+
+    Driver driver;
+    const std::vector<uint64_t> keys{2, 1, 0};
+
+    SUBCASE("Read and write") {
+        server.setVariableNodeValueBackends(ids, keys, driver);
+        CHECK(Node(server, ids[0]).readValueScalar<int>() == 12);
+        CHECK(Node(server, ids[1]).readValueScalar<int>() == 11);
+        CHECK(Node(server, ids[2]).readValueScalar<int>() == 10);
+        Node(server, ids[2]).writeValueScalar<int>(20);
+        CHECK(driver.tags[0] == 20);
+    }
+
+    SUBCASE("Size mismatch") {
+        CHECK_THROWS_AS(
+            server.setVariableNodeValueBackends(ids, {keys.data(), 1}, driver), BadStatus
+        );
+    }
+
+    SUBCASE("Value callbacks are rejected") {
+        server.setVariableNodeValueBackends(ids, keys, driver);
+        CHECK_THROWS_WITH(server.setVariableNodeValueCallback(ids[0], {}), "BadInvalidState");
+        CHECK_THROWS_WITH(server.addWriteNotificationCallback(ids, [](auto) {}), "BadInvalidState");
+        CHECK(Node(server, ids[0]).readValueScalar<int>() == 12);
+    }
+}
+
+TEST_CASE("DataSource with automatic read range") {
+    Server server;
+    NodeId id{1, 1000};
+    server.getObjectsNode().addVariable(id, "testVariable");
+
+    std::vector<int32_t> data{0, 1, 2, 3, 4};
+    ValueBackendDataSource dataSource;
+    dataSource.applyReadRange = true;
+    dataSource.read = [&](DataValue& value, const NumericRange& range, bool) {
+        CHECK(range.empty());
+        value.getValue().setArray(data);
+        return UA_STATUSCODE_GOOD;
+    };
+    server.setVariableNodeValueBackend(id, dataSource);
+
+    const ReadValueId rvid(id, AttributeId::Value, "1:3");
+    DataValue result(UA_Server_read(server.handle(), rvid.handle(), UA_TIMESTAMPSTORETURN_NEITHER));
+    CHECK(result.getStatus() == UA_STATUSCODE_GOOD);
+    CHECK(result.getValue().getArrayCopy<int32_t>() == std::vector<int32_t>{1, 2, 3});
+}
+
+TEST_CASE("DataSource with automatic source timestamp") {
+    Server server;
+    NodeId id{1, 1000};
+    server.getObjectsNode().addVariable(id, "testVariable");
+
+    ValueBackendDataSource dataSource;
+    dataSource.autoSourceTimestamp = true;
+    dataSource.read = [&](DataValue& value, const NumericRange&, bool) {
+        value.getValue().setScalarCopy(11);
+        return UA_STATUSCODE_GOOD;
+    };
+    server.setVariableNodeValueBackend(id, dataSource);
+
+    const ReadValueId rvid(id, AttributeId::Value);
+    DataValue result(UA_Server_read(server.handle(), rvid.handle(), UA_TIMESTAMPSTORETURN_SOURCE));
+    CHECK(result.getStatus() == UA_STATUSCODE_GOOD);
+    CHECK(result.hasSourceTimestamp());
+    CHECK(result.getSourceTimestamp().get() > 0);
+}
+
 TEST_CASE("DataSource with empty callbacks") {
     Server server;
     NodeId id{1, 1000};
@@ -234,3 +580,51 @@ TEST_CASE("DataSource with exception in callback") {
         CHECK_THROWS_AS_MESSAGE(node.readValue(), BadStatus, "BadInternalError");
     }
 }
+
+#if UAPP_OPEN62541_VER_GE(1, 3)
+TEST_CASE("Server address space snapshot") {
+    const auto filepath = fs::temp_directory_path() / "open62541pp_addressspace.bin";
+    const std::string uri = "http://example.com/snapshot/";
+
+    struct Driver {
+        StatusCode read(uint64_t key, DataValue& value, Span<const NumericRangeDimension>, bool) {
+            value.getValue().setScalarCopy(static_cast<int>(key));
+            return UA_STATUSCODE_GOOD;
+        }
+    };
+
+    Driver driver;
+    {
+        Server server;
+        const auto ns = server.registerNamespace(uri);
+        auto device = server.getObjectsNode().addObject({ns, 1}, "Device");
+        device.addVariable({ns, 2}, "Temperature").writeValueScalar(21.5);
+        device.addVariable({ns, "Tag"}, "Tag");
+        const std::vector<NodeId> ids{{ns, "Tag"}};
+        const std::vector<uint64_t> keys{42};
+        server.setVariableNodeValueBackends(ids, keys, driver);
+        server.saveAddressSpace(filepath);
+    }
+
+    Server server;
+    server.registerNamespace("http://example.com/other/");  // shift namespace indices
+    const auto result = server.loadAddressSpace(filepath);
+    CHECK(result.errors.empty());
+    CHECK(result.nodes == 3);
+    const auto ns = server.getNamespaceIndex(uri);
+
+    auto device = server.getNode({ns, 1});
+    CHECK(device.readBrowseName() == QualifiedName(ns, "Device"));
+    CHECK(device.browseParent().getNodeId() == NodeId(ObjectId::ObjectsFolder));
+    CHECK(device.browseChild({{ns, "Temperature"}}).readValueScalar<double>() == 21.5);
+
+    REQUIRE(result.keyedIds.size() == 1);
+    CHECK(result.keyedIds[0] == NodeId(ns, "Tag"));
+    CHECK(result.keys[0] == 42);
+    server.setVariableNodeValueBackends(result.keyedIds, result.keys, driver);
+    CHECK(server.getNode({ns, "Tag"}).readValueScalar<int>() == 42);
+
+    CHECK_THROWS_AS(server.loadAddressSpace(filepath.string() + ".missing"), BadStatus);
+    fs::remove(filepath);
+}
+#endif
@@ -0,0 +1,268 @@
+#include <algorithm>  // count_if
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/Client.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Node.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/ServerMetrics.h"
+#include "open62541pp/ValueBackend.h"
+#include "open62541pp/detail/AdmissionControl.h"
+#include "open62541pp/services/Attribute.h"
+#include "open62541pp/services/Attribute_highlevel.h"
+#include "open62541pp/services/Method.h"
+#include "open62541pp/services/View.h"
+
+#include "helper/Runner.h"
+
+#include "open62541_impl.h"
+
+using namespace opcua;
+
+constexpr std::string_view localServerUrl{"opc.tcp://localhost:4840"};
+
+TEST_CASE("ServerMetrics") {
+    Server server;
+    const NodeId id{1, 1000};
+    auto node = server.getObjectsNode().addVariable(id, "Variable");
+
+    int data = 0;
+    ValueBackendDataSource dataSource;
+    dataSource.read = [&](DataValue& value, const NumericRange&, bool) {
+        value.getValue().setScalar(data);
+        return UA_STATUSCODE_GOOD;
+    };
+    dataSource.write = [&](const DataValue& value, const NumericRange&) {
+        data = value.getValue().getScalarCopy<int>();
+        return UA_STATUSCODE_GOOD;
+    };
+    server.setVariableNodeValueBackend(id, dataSource);
+
+    SUBCASE("Disabled by default") {
+        CHECK_FALSE(server.isMetricsEnabled());
+        node.readValueScalar<int>();
+        const auto metrics = server.getMetrics();
+        CHECK(metrics.getService(MetricsService::Read).requests == 0);
+        CHECK(metrics.getCallback(MetricsCallback::DataSourceRead).count == 0);
+    }
+
+    SUBCASE("Local requests and callbacks") {
+        server.setMetricsEnabled(true);
+        CHECK(server.isMetricsEnabled());
+
+        CHECK(node.readValueScalar<int>() == 0);
+        node.writeValueScalar<int>(1);
+        CHECK(data == 1);
+        CHECK_THROWS_AS(services::readValue(server, {1, "Unknown"}), BadStatus);
+        services::browse(server, BrowseDescription(id, BrowseDirection::Both));
+
+        auto metrics = server.getMetrics();
+        const auto& read = metrics.getService(MetricsService::Read);
+        CHECK(read.requests == 2);
+        CHECK(read.errors == 1);
+        CHECK(read.latency.count == 2);
+        CHECK(read.latency.sum > 0);
+        uint64_t bucketSum = 0;
+        for (const auto count : read.latency.buckets) {
+            bucketSum += count;
+        }
+        CHECK(bucketSum == 2);
+        CHECK(metrics.getService(MetricsService::Write).requests == 1);
+        CHECK(metrics.getService(MetricsService::Write).errors == 0);
+        CHECK(metrics.getService(MetricsService::Browse).requests == 1);
+        CHECK(metrics.getCallback(MetricsCallback::DataSourceRead).count >= 1);
+        CHECK(metrics.getCallback(MetricsCallback::DataSourceWrite).count == 1);
+
+        server.resetMetrics();
+        metrics = server.getMetrics();
+        CHECK(metrics.getService(MetricsService::Read).requests == 0);
+        CHECK(metrics.getCallback(MetricsCallback::DataSourceRead).count == 0);
+
+        server.setMetricsEnabled(false);
+        node.readValueScalar<int>();
+        CHECK(server.getMetrics().getService(MetricsService::Read).requests == 0);
+    }
+
+#ifdef UA_ENABLE_METHODCALLS
+    SUBCASE("Method callbacks") {
+        server.setMetricsEnabled(true);
+        const NodeId methodId{1, 1001};
+        services::addMethod(
+            server, ObjectId::ObjectsFolder, methodId, "Method", [](auto, auto) {}, {}, {}
+        );
+        services::call(server, ObjectId::ObjectsFolder, methodId, {});
+        const auto metrics = server.getMetrics();
+        CHECK(metrics.getService(MetricsService::Call).requests == 1);
+        CHECK(metrics.getCallback(MetricsCallback::Method).count == 1);
+    }
+#endif
+
+    SUBCASE("Prometheus export") {
+        server.setMetricsEnabled(true);
+        node.readValueScalar<int>();
+        const auto text = toPrometheus(server.getMetrics());
+        const auto contains = [&](std::string_view line) {
+            return text.find(line) != std::string::npos;
+        };
+        CHECK(contains("# TYPE opcua_server_service_requests_total counter\n"));
+        CHECK(contains(R"(opcua_server_service_requests_total{service="read",origin="local"} 1)"));
+        CHECK(contains(
+            R"(opcua_server_service_duration_seconds_bucket{service="read",le="+Inf"} 1)"
+        ));
+        CHECK(contains(
+            R"(opcua_server_callback_duration_seconds_count{callback="datasource_read"} 1)"
+        ));
+    }
+}
+
+TEST_CASE("Server admission control") {
+    Server server;
+    const NodeId id{1, 1000};
+    auto node = server.getObjectsNode().addVariable(id, "Variable");
+    ValueBackendDataSource dataSource;
+    dataSource.read = [&](DataValue& value, const NumericRange&, bool) {
+        value.getValue().setScalarCopy(1);
+        return UA_STATUSCODE_GOOD;
+    };
+    server.setVariableNodeValueBackend(id, dataSource);
+
+    SUBCASE("Disabled by default") {
+        CHECK(server.getAdmissionLimits().maxOperationsPerSession == 0);
+        CHECK(server.getAdmissionLimits().maxReadsPerIteration == 0);
+        for (int i = 0; i < 10; ++i) {
+            CHECK(node.readValueScalar<int>() == 1);
+        }
+    }
+
+    SUBCASE("Reads per iteration") {
+        AdmissionLimits limits;
+        limits.maxReadsPerIteration = 2;
+        server.setAdmissionLimits(limits);
+        CHECK(server.getAdmissionLimits().maxReadsPerIteration == 2);
+
+        server.runIterate();
+        CHECK(node.readValueScalar<int>() == 1);
+        CHECK(node.readValueScalar<int>() == 1);
+        CHECK_THROWS_WITH(node.readValueScalar<int>(), "BadResourceUnavailable");
+        server.runIterate();
+        CHECK(node.readValueScalar<int>() == 1);
+
+        const auto metrics = server.getMetrics();
+        CHECK(metrics.admission.rejectedReads == 1);
+        CHECK(metrics.admission.rejectedOperations == 0);
+        CHECK(
+            toPrometheus(metrics).find(
+                R"(opcua_server_admission_rejected_total{limit="reads_per_iteration"} 1)"
+            ) != std::string::npos
+        );
+        server.resetMetrics();
+        CHECK(server.getMetrics().admission.rejectedReads == 0);
+    }
+
+    SUBCASE("Operations per session") {
+        AdmissionLimits limits;
+        limits.maxOperationsPerSession = 2;
+        server.setAdmissionLimits(limits);
+        CHECK(node.readValueScalar<int>() == 1);  // local calls are not limited
+
+        ServerRunner serverRunner(server);
+        Client client;
+        client.connect(localServerUrl);
+        const std::vector<ReadValueId> items(3, ReadValueId(id, AttributeId::Value));
+        const auto response = services::read(client, items);
+        const auto results = response.getResults();
+        REQUIRE(results.size() == 3);
+        CHECK(results[0].getStatus().isGood());
+        CHECK(results[1].getStatus().isGood());
+        CHECK(results[2].getStatus() == UA_STATUSCODE_BADTOOMANYOPERATIONS);
+        CHECK(server.getMetrics().admission.rejectedOperations == 1);
+    }
+}
+
+TEST_CASE("AdmissionController with foreign session contexts") {
+    // the default access control of open62541 stores the username in the session context
+    UA_Server* native = UA_Server_new();
+    UA_ByteString username = UA_String_fromChars("username");
+    detail::AdmissionController controller;
+    AdmissionLimits limits;
+    limits.maxOperationsPerSession = 1;
+    controller.setLimits(limits);
+    for (int i = 0; i < 3; ++i) {
+        CHECK(controller.admit(native, &username, false) == UA_STATUSCODE_GOOD);
+    }
+    CHECK(String(username) == "username");  // untouched
+    UA_ByteString_clear(&username);
+    UA_Server_delete(native);
+}
+
+TEST_CASE("Server trace callback") {
+    Server server;
+    std::vector<ServerTraceEvent> events;
+    const auto count = [&](ServerTracepoint tracepoint) {
+        return std::count_if(events.begin(), events.end(), [&](const ServerTraceEvent& event) {
+            return event.tracepoint == tracepoint;
+        });
+    };
+
+    SUBCASE("Spans") {
+        server.setTraceCallback([&](const ServerTraceEvent& event) { events.push_back(event); });
+        CHECK_FALSE(server.isMetricsEnabled());  // independent of metrics
+        server.runIterate();
+        server.runIterate();
+        CHECK(count(ServerTracepoint::Iteration) == 2);
+        CHECK(count(ServerTracepoint::NotificationDelivery) == 2);
+
+        events.clear();
+        services::readValue(server, VariableId::Server_ServerStatus_State);
+        REQUIRE(count(ServerTracepoint::Service) == 1);
+        const auto& event = events.back();
+        CHECK(event.tracepoint == ServerTracepoint::Service);
+        CHECK(event.service == MetricsService::Read);
+        CHECK(event.duration.count() >= 0);
+
+        events.clear();
+        server.setTraceCallback({});
+        server.runIterate();
+        CHECK(events.empty());
+    }
+
+    SUBCASE("Exception rethrow") {
+        bool thrown = false;
+        server.setTraceCallback([&](const ServerTraceEvent& event) {
+            events.push_back(event);
+            if (!thrown) {
+                thrown = true;
+                throw std::runtime_error("Trace");
+            }
+        });
+        CHECK_THROWS_AS_MESSAGE(server.runIterate(), std::runtime_error, "Trace");
+        CHECK(count(ServerTracepoint::ExceptionRethrow) == 1);
+    }
+}
+
+#ifdef UA_ENABLE_DIAGNOSTICS
+TEST_CASE("ServerMetrics of client sessions") {
+    Server server;
+    server.setMetricsEnabled(true);
+    ServerRunner serverRunner(server);
+    Client client;
+    client.connect(localServerUrl);
+
+    services::readValue(client, VariableId::Server_ServerStatus_State);
+    services::readValue(client, VariableId::Server_ServerStatus_State);
+
+    const auto metrics = server.getMetrics();
+    REQUIRE(metrics.sessions.size() == 1);
+    CHECK(metrics.sessions[0].requests >= 2);
+    CHECK(metrics.getService(MetricsService::Read).remoteRequests >= 2);
+    const auto text = toPrometheus(metrics);
+    CHECK(text.find("opcua_server_session_requests_total{session=") != std::string::npos);
+    CHECK(text.find("# TYPE opcua_server_service_session_requests gauge\n") != std::string::npos);
+    CHECK(text.find(R"(origin="remote")") == std::string::npos);
+}
+#endif
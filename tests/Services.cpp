@@ -1,5 +1,10 @@
+#include <algorithm>  // sort
 #include <chrono>
+#include <optional>
+#include <stdexcept>
+#include <string>
 #include <thread>
+#include <unordered_set>
 #include <variant>
 #include <vector>
 
@@ -7,7 +12,10 @@
 
 #include "open62541pp/Config.h"
 #include "open62541pp/Event.h"
+#include "open62541pp/HistoryBackend.h"
+#include "open62541pp/Node.h"
 #include "open62541pp/NodeIds.h"
+#include "open62541pp/detail/ServerContext.h"
 #include "open62541pp/services/services.h"
 #include "open62541pp/types/DateTime.h"
 #include "open62541pp/types/ExtensionObject.h"
@@ -238,6 +246,33 @@ TEST_CASE_TEMPLATE("NodeManagement service set", T, Server, Client, Async<Client
     }
 }
 
+TEST_CASE("NodeManagement service set deleteSubtree (server)") {
+    Server server;
+    const NodeId objectsId{ObjectId::ObjectsFolder};
+    services::addFolder(server, objectsId, {1, 1000}, "Line");
+    services::addObject(server, {1, 1000}, {1, 1001}, "Machine");
+    services::addVariable(server, {1, 1001}, {1, 1002}, "Speed");
+    services::addFolder(server, {1, 1000}, {1, 1003}, "Sensors", {}, ReferenceTypeId::Organizes);
+    services::addVariable(server, {1, 1003}, {1, 1004}, "Temperature");
+    services::addObject(server, objectsId, {1, 2000}, "Other");
+    // shared node of namespace zero must not be deleted
+    services::addReference(server, {1, 1003}, ObjectId::Server, ReferenceTypeId::Organizes);
+    // node shared with a parent outside of the subtree must not be deleted with its descendants
+    services::addVariable(server, {1, 1003}, {1, 1005}, "Pressure");
+    services::addProperty(server, {1, 1005}, {1, 1006}, "Unit");
+    services::addReference(server, {1, 2000}, {1, 1005}, ReferenceTypeId::Organizes);
+
+    CHECK(services::deleteSubtree(server, {1, 1000}) == 5);
+    for (uint32_t id = 1000; id <= 1004; ++id) {
+        CHECK_THROWS_WITH(services::readNodeClass(server, {1, id}), "BadNodeIdUnknown");
+    }
+    CHECK(services::readNodeClass(server, {1, 1005}) == NodeClass::Variable);
+    CHECK(services::readNodeClass(server, {1, 1006}) == NodeClass::Variable);
+    CHECK(services::readNodeClass(server, {1, 2000}) == NodeClass::Object);
+    CHECK(services::readNodeClass(server, ObjectId::Server) == NodeClass::Object);
+    CHECK_THROWS_WITH(services::deleteSubtree(server, {1, 1000}), "BadNodeIdUnknown");
+}
+
 TEST_CASE("Attribute service set (highlevel)") {
     Server server;
     const NodeId objectsId{0, UA_NS0ID_OBJECTSFOLDER};
@@ -503,6 +538,249 @@ TEST_CASE_TEMPLATE("Attribute service set write/read", T, Server, Client, Async<
     CHECK(result.getValue().getScalar<double>() == value);
 }
 
+TEST_CASE("Attribute service set async read of unknown node (client)") {
+    // the bad status is thrown by the response transform and must be caught (UAPP_LOW_MEMORY too)
+    ServerClientSetup setup;
+    setup.client.connect(setup.endpointUrl);
+    auto& client = setup.client;
+
+    SUBCASE("Future") {
+        auto future = services::readAttributeAsync(client, {1, 999999}, AttributeId::Value);
+        client.runIterate();
+        try {
+            future.get();
+            FAIL("BadStatus expected");
+        } catch (const BadStatus& e) {
+            CHECK(e.code() == UA_STATUSCODE_BADNODEIDUNKNOWN);
+        }
+    }
+
+    SUBCASE("Callback") {
+        std::optional<StatusCode> code;
+        services::readAttributeAsync(
+            client,
+            {1, 999999},
+            AttributeId::Value,
+            TimestampsToReturn::Neither,
+            [&](StatusCode result, DataValue& /* unused */) { code = result; }
+        );
+        while (!code.has_value()) {
+            client.runIterate(10);
+        }
+        CHECK(*code == UA_STATUSCODE_BADNODEIDUNKNOWN);
+    }
+}
+
+TEST_CASE_TEMPLATE("Attribute service set try functions", T, Server, Client) {
+    ServerClientSetup setup;
+    setup.client.connect(setup.endpointUrl);
+    auto& serverOrClient = setup.getInstance<T>();
+
+    const NodeId id{1, 1000};
+    services::addVariable(
+        setup.server,
+        {0, UA_NS0ID_OBJECTSFOLDER},
+        id,
+        "variable",
+        VariableAttributes{}.setAccessLevel(AccessLevel::CurrentRead | AccessLevel::CurrentWrite)
+    );
+
+    SUBCASE("Good") {
+        const auto written = services::tryWriteValue(
+            serverOrClient, id, Variant::fromScalar(11.11)
+        );
+        CHECK(written.code().isGood());
+        const auto result = services::tryReadValue(serverOrClient, id);
+        CHECK(result.code().isGood());
+        CHECK(result->getScalar<double>() == 11.11);
+        CHECK(services::tryReadDataValue(serverOrClient, id)->hasSourceTimestamp());
+    }
+
+    SUBCASE("Bad status codes are returned") {
+        const NodeId unknownId{1, 999999};
+        CHECK(services::tryReadValue(serverOrClient, unknownId).code() ==
+              UA_STATUSCODE_BADNODEIDUNKNOWN);
+        CHECK(
+            services::tryWriteValue(serverOrClient, unknownId, Variant::fromScalar(1.0)).code() ==
+            UA_STATUSCODE_BADNODEIDUNKNOWN
+        );
+        CHECK(
+            services::tryReadAttribute(serverOrClient, id, AttributeId::EventNotifier).code() ==
+            UA_STATUSCODE_BADATTRIBUTEIDINVALID
+        );
+        CHECK_THROWS_AS(services::tryReadValue(serverOrClient, unknownId).value(), BadStatus);
+    }
+}
+
+TEST_CASE("Attribute service set readValuesAs (client)") {
+    ServerClientSetup setup;
+    setup.client.connect(setup.endpointUrl);
+    auto& client = setup.client;
+
+    std::vector<NodeId> ids;
+    for (uint32_t i = 0; i < 3; ++i) {
+        const NodeId id{1, 2000 + i};
+        services::addVariable(setup.server, {0, UA_NS0ID_OBJECTSFOLDER}, id, "variable");
+        services::writeValue(setup.server, id, Variant::fromScalar(1.5 * i));
+        ids.push_back(id);
+    }
+    ids.emplace_back(0, UA_NS0ID_SERVER_NAMESPACEARRAY);  // type mismatch
+    ids.emplace_back(1, 9999);  // unknown node
+
+    const auto columns = services::readValuesAs<double>(client, ids, TimestampsToReturn::Server);
+    CHECK(columns.values.size() == ids.size());
+    CHECK(columns.statuses.size() == ids.size());
+    CHECK(columns.sourceTimestamps.empty());
+    CHECK(columns.serverTimestamps.size() == ids.size());
+    for (size_t i = 0; i < 3; ++i) {
+        CHECK(columns.statuses[i].isGood());
+        CHECK(columns.values[i] == 1.5 * i);
+    }
+    CHECK(columns.statuses[3] == UA_STATUSCODE_BADTYPEMISMATCH);
+    CHECK(columns.statuses[4] == UA_STATUSCODE_BADNODEIDUNKNOWN);
+    CHECK(columns.values[4] == 0.0);
+}
+
+TEST_CASE("Attribute service set readArrayStreaming (client)") {
+    ServerClientSetup setup;
+    setup.client.connect(setup.endpointUrl);
+    auto& client = setup.client;
+
+    const NodeId id{1, 2000};
+    std::vector<double> array(10);
+    for (size_t i = 0; i < array.size(); ++i) {
+        array[i] = 0.5 * i;
+    }
+    services::addVariable(setup.server, {0, UA_NS0ID_OBJECTSFOLDER}, id, "array");
+    services::writeValue(setup.server, id, Variant::fromArray(array));
+
+    const auto readStreaming = [&](size_t chunkElements) {
+        std::vector<double> result;
+        std::vector<size_t> chunkSizes;
+        const auto total = services::readArrayStreaming<double>(
+            client, id, chunkElements, [&](Span<const double> chunk) {
+                result.insert(result.end(), chunk.begin(), chunk.end());
+                chunkSizes.push_back(chunk.size());
+            }
+        );
+        CHECK(total == result.size());
+        CHECK(result == array);
+        return chunkSizes;
+    };
+
+    SUBCASE("Unknown array dimensions") {
+        CHECK(readStreaming(3) == std::vector<size_t>{3, 3, 3, 1});
+        CHECK(readStreaming(5) == std::vector<size_t>{5, 5});
+        CHECK(readStreaming(1).size() == 10);
+        CHECK(readStreaming(100) == std::vector<size_t>{10});
+    }
+
+    SUBCASE("Known array dimensions") {
+        services::writeValueRank(setup.server, id, ValueRank::OneDimension);
+        services::writeArrayDimensions(setup.server, id, std::vector<uint32_t>{10});
+        CHECK(readStreaming(3) == std::vector<size_t>{3, 3, 3, 1});
+        CHECK(readStreaming(5) == std::vector<size_t>{5, 5});
+    }
+
+    SUBCASE("Errors") {
+        const auto sink = [](Span<const double>) {};
+        CHECK_THROWS_WITH(
+            services::readArrayStreaming<double>(client, id, 0, sink), "BadInvalidArgument"
+        );
+        CHECK_THROWS_AS(
+            services::readArrayStreaming<int32_t>(client, id, 3, [](Span<const int32_t>) {}),
+            BadVariantAccess
+        );
+        CHECK_THROWS_WITH(
+            services::readArrayStreaming<double>(client, {1, 9999}, 3, sink),
+            "BadNodeIdUnknown"
+        );
+    }
+}
+
+TEST_CASE_TEMPLATE("Attribute service set existMany", T, Server, Client) {
+    ServerClientSetup setup;
+    setup.client.connect(setup.endpointUrl);
+    auto& serverOrClient = setup.getInstance<T>();
+
+    const NodeId id{1, 2000};
+    services::addVariable(setup.server, {0, UA_NS0ID_OBJECTSFOLDER}, id, "variable");
+    const std::vector<NodeId> ids{
+        {0, UA_NS0ID_OBJECTSFOLDER},
+        {1, 9999},  // unknown node
+        id,
+        {0, "DoesNotExist"},
+    };
+    CHECK(services::existMany(serverOrClient, ids) == std::vector<bool>{true, false, true, false});
+    CHECK(services::existMany(serverOrClient, {}).empty());
+}
+
+TEST_CASE("Attribute service set writeValues (server)") {
+    Server server;
+    std::vector<NodeId> ids;
+    std::vector<Variant> values;
+    for (uint32_t i = 0; i < 3; ++i) {
+        const NodeId id{1, 2000 + i};
+        services::addVariable(server, {0, UA_NS0ID_OBJECTSFOLDER}, id, "variable");
+        ids.push_back(id);
+        values.push_back(Variant::fromScalar(1.5 * i));
+    }
+    ids.emplace_back(1, 9999);  // unknown node
+    values.push_back(Variant::fromScalar(0.0));
+
+    SUBCASE("Variants") {
+        const auto results = services::writeValues(server, ids, values);
+        REQUIRE(results.size() == ids.size());
+        for (size_t i = 0; i < 3; ++i) {
+            CHECK(results[i].isGood());
+            CHECK(services::readValue(server, ids[i]).getScalar<double>() == 1.5 * i);
+        }
+        CHECK(results[3] == UA_STATUSCODE_BADNODEIDUNKNOWN);
+    }
+
+    SUBCASE("DataValues") {
+        std::vector<DataValue> dataValues;
+        for (const auto& value : values) {
+            dataValues.emplace_back(value);
+        }
+        dataValues[0].setSourceTimestamp(DateTime(1000));
+        const auto results = services::writeDataValues(server, ids, dataValues);
+        CHECK(results[1].isGood());
+        CHECK(services::readValue(server, ids[1]).getScalar<double>() == 1.5);
+        CHECK(services::readDataValue(server, ids[0]).getSourceTimestamp().get() == 1000);
+    }
+
+    SUBCASE("Size mismatch") {
+        CHECK_THROWS_WITH(
+            services::writeValues(server, ids, Span<const Variant>(values.data(), 1)),
+            "BadInvalidArgument"
+        );
+    }
+}
+
+TEST_CASE("Attribute service set withValue (server)") {
+    Server server;
+    const NodeId id{1, 2000};
+    services::addVariable(server, {0, UA_NS0ID_OBJECTSFOLDER}, id, "variable");
+    services::writeValue(server, id, Variant::fromArray(std::vector<int32_t>{1, 2, 3}));
+
+    int32_t sum = 0;
+    services::withValue(server, id, [&](const Variant& value) {
+        for (const auto element : value.getArray<int32_t>()) {
+            sum += element;
+        }
+    });
+    CHECK(sum == 6);
+
+    services::withDataValue(server, id, [](const DataValue& value) {
+        CHECK(value.hasValue());
+    });
+
+    CHECK_THROWS_WITH(
+        services::withValue(server, {1, 9999}, [](const Variant&) {}), "BadNodeIdUnknown"
+    );
+}
+
 TEST_CASE_TEMPLATE("View service set", T, Server, Client, Async<Client>) {
     ServerClientSetup setup;
     setup.client.connect(setup.endpointUrl);
@@ -657,6 +935,601 @@ TEST_CASE_TEMPLATE("View service set", T, Server, Client, Async<Client>) {
     }
 }
 
+TEST_CASE("View service set browse cache (server)") {
+    Server server;
+    server.setBrowseCacheEnabled(true);
+    const NodeId folderId{1, 1000};
+    services::addFolder(server, {0, UA_NS0ID_OBJECTSFOLDER}, folderId, "Folder");
+    services::addVariable(server, folderId, {1, 1001}, "Variable1");
+
+    const BrowseDescription bd(folderId, BrowseDirection::Forward);
+    const auto browseNames = [&] {
+        std::vector<std::string> names;
+        for (const auto& ref : services::browseAll(server, bd)) {
+            names.emplace_back(ref.getBrowseName().getName());
+        }
+        std::sort(names.begin(), names.end());
+        return names;
+    };
+    CHECK(browseNames() == std::vector<std::string>{"FolderType", "Variable1"});
+    CHECK(browseNames() == std::vector<std::string>{"FolderType", "Variable1"});  // cached
+
+    SUBCASE("Invalidate on addNode") {
+        services::addVariable(server, folderId, {1, 1002}, "Variable2");
+        CHECK(browseNames() == std::vector<std::string>{"FolderType", "Variable1", "Variable2"});
+    }
+
+    SUBCASE("Invalidate on deleteNode") {
+        services::deleteNode(server, {1, 1001});
+        CHECK(browseNames() == std::vector<std::string>{"FolderType"});
+    }
+
+    SUBCASE("Invalidate on addReference") {
+        services::addReference(
+            server, folderId, {0, UA_NS0ID_SERVER}, ReferenceTypeId::Organizes, true
+        );
+        CHECK(browseNames() == std::vector<std::string>{"FolderType", "Server", "Variable1"});
+    }
+
+    SUBCASE("Invalidate on browse name write") {
+        services::writeBrowseName(server, {1, 1001}, {1, "Renamed"});
+        CHECK(browseNames() == std::vector<std::string>{"FolderType", "Renamed"});
+    }
+
+    SUBCASE("Native changes require manual invalidation") {
+        UA_Server_writeBrowseName(
+            server.handle(), *NodeId(1, 1001).handle(), *QualifiedName(1, "Native").handle()
+        );
+        CHECK(browseNames() == std::vector<std::string>{"FolderType", "Variable1"});
+        server.invalidateBrowseCache();
+        CHECK(browseNames() == std::vector<std::string>{"FolderType", "Native"});
+    }
+
+    SUBCASE("Limited browse is paged from the cache") {
+        const auto result = services::browse(server, bd, 1);
+        CHECK(result.getReferences().size() == 1);
+        CHECK_FALSE(result.getContinuationPoint().empty());
+        services::browseNext(server, true, result.getContinuationPoint());
+    }
+
+    SUBCASE("Disabled") {
+        server.setBrowseCacheEnabled(false);
+        UA_Server_writeBrowseName(
+            server.handle(), *NodeId(1, 1001).handle(), *QualifiedName(1, "Native").handle()
+        );
+        CHECK(browseNames() == std::vector<std::string>{"FolderType", "Native"});
+    }
+}
+
+TEST_CASE("View service set browse cache (client changes)") {
+    ServerClientSetup setup;
+    setup.client.connect(setup.endpointUrl);
+    auto& server = setup.server;
+    auto& client = setup.client;
+    server.setBrowseCacheEnabled(true);
+    const NodeId folderId{1, 1000};
+    services::addFolder(server, {0, UA_NS0ID_OBJECTSFOLDER}, folderId, "Folder");
+    services::addVariable(server, folderId, {1, 1001}, "Variable1");
+
+    const BrowseDescription bd(folderId, BrowseDirection::Forward);
+    const auto browseNames = [&] {
+        std::vector<std::string> names;
+        for (const auto& ref : services::browseAll(server, bd)) {
+            names.emplace_back(ref.getBrowseName().getName());
+        }
+        std::sort(names.begin(), names.end());
+        return names;
+    };
+    CHECK(browseNames() == std::vector<std::string>{"FolderType", "Variable1"});  // cached
+
+    SUBCASE("Invalidate on addNodes") {
+        services::addObject(client, folderId, {1, 1002}, "Object");
+        CHECK(browseNames() == std::vector<std::string>{"FolderType", "Object", "Variable1"});
+    }
+
+    SUBCASE("Invalidate on deleteNodes") {
+        services::deleteNode(client, {1, 1001});
+        CHECK(browseNames() == std::vector<std::string>{"FolderType"});
+    }
+
+    SUBCASE("Invalidate on addReferences") {
+        services::addReference(
+            client, folderId, {0, UA_NS0ID_SERVER}, ReferenceTypeId::Organizes, true
+        );
+        CHECK(browseNames() == std::vector<std::string>{"FolderType", "Server", "Variable1"});
+    }
+}
+
+TEST_CASE("View service set continuation points (server)") {
+    Server server;
+    const NodeId folderId{1, 1000};
+    services::addFolder(server, ObjectId::ObjectsFolder, folderId, "Folder");
+    for (uint32_t i = 0; i < 10; ++i) {
+        services::addVariable(server, folderId, {1, 1001 + i}, "Variable");
+    }
+    const BrowseDescription bd(folderId, BrowseDirection::Forward);
+    const auto expected = services::browse(server, bd).getReferences().size();
+    CHECK(expected == 11);  // HasTypeDefinition + 10x HasComponent
+
+    SUBCASE("Pages") {
+        auto result = services::browse(server, bd, 4);
+        const auto continuationPoint = result.getContinuationPoint();
+        std::vector<size_t> pageSizes{result.getReferences().size()};
+        while (!result.getContinuationPoint().empty()) {
+            CHECK(result.getContinuationPoint() == continuationPoint);
+            result = services::browseNext(server, false, result.getContinuationPoint());
+            CHECK(result.getStatusCode().isGood());
+            pageSizes.push_back(result.getReferences().size());
+        }
+        CHECK(pageSizes == std::vector<size_t>{4, 4, 3});
+        CHECK(services::browseAll(server, bd, 0).size() == expected);
+
+        // exhausted continuation point
+        result = services::browseNext(server, false, continuationPoint);
+        CHECK(result.getStatusCode() == UA_STATUSCODE_BADCONTINUATIONPOINTINVALID);
+    }
+
+    SUBCASE("Complete result without continuation point") {
+        const auto result = services::browse(server, bd, 11);
+        CHECK(result.getReferences().size() == 11);
+        CHECK(result.getContinuationPoint().empty());
+    }
+
+    SUBCASE("Release") {
+        const auto first = services::browse(server, bd, 1);
+        auto result = services::browseNext(server, true, first.getContinuationPoint());
+        CHECK(result.getStatusCode().isGood());
+        CHECK(result.getReferences().empty());
+        CHECK(result.getContinuationPoint().empty());
+        result = services::browseNext(server, false, first.getContinuationPoint());
+        CHECK(result.getStatusCode() == UA_STATUSCODE_BADCONTINUATIONPOINTINVALID);
+    }
+
+    SUBCASE("Limit per session") {
+        server.setMaxBrowseContinuationPoints(2);
+        const auto first = services::browse(server, bd, 1);
+        const auto second = services::browse(server, bd, 1);
+        CHECK(first.getStatusCode().isGood());
+        CHECK(second.getStatusCode().isGood());
+        CHECK(
+            services::browse(server, bd, 1).getStatusCode() ==
+            UA_STATUSCODE_BADNOCONTINUATIONPOINTS
+        );
+        CHECK(services::browse(server, bd).getStatusCode().isGood());  // no continuation point
+
+        services::browseNext(server, true, first.getContinuationPoint());
+        CHECK(services::browse(server, bd, 1).getStatusCode().isGood());
+    }
+}
+
+struct MinimalProjection {
+    static constexpr Bitmask<BrowseResultMask> resultMask = BrowseResultMask::None;
+    std::vector<ReferenceDescription> refs;
+
+    void add(ReferenceDescription& ref) {
+        refs.push_back(std::move(ref));
+    }
+};
+
+struct ThrowingProjection {
+    static constexpr Bitmask<BrowseResultMask> resultMask = BrowseResultMask::None;
+
+    void add(ReferenceDescription& /* ref */) {
+        throw std::logic_error("projection");
+    }
+};
+
+TEST_CASE_TEMPLATE("View service set browseInto", T, Server, Client) {
+    ServerClientSetup setup;
+    setup.client.connect(setup.endpointUrl);
+    auto& server = setup.server;
+    auto& serverOrClient = setup.getInstance<T>();
+
+    // two devices with equally named children
+    const NodeId folderId{1, 1000};
+    services::addFolder(server, {0, UA_NS0ID_OBJECTSFOLDER}, folderId, "Devices");
+    for (uint32_t i = 0; i < 2; ++i) {
+        services::addVariable(server, folderId, {1, 1001 + i}, "Value");
+    }
+    const BrowseDescription bd(
+        folderId, BrowseDirection::Forward, ReferenceTypeId::HierarchicalReferences
+    );
+
+    SUBCASE("BrowseProjection") {
+        BrowseProjection projection;
+        CHECK(services::browseInto(serverOrClient, bd, projection) == 2);
+        CHECK(projection.size() == 2);
+        CHECK(projection.nodeClasses == std::vector<NodeClass>(2, NodeClass::Variable));
+        CHECK(projection.browseNames.size() == 1);  // interned
+        CHECK(projection.getBrowseName(0) == QualifiedName(0, "Value"));
+        CHECK(projection.getBrowseName(1) == QualifiedName(0, "Value"));
+        std::unordered_set<NodeId> ids(projection.nodeIds.begin(), projection.nodeIds.end());
+        CHECK(ids == std::unordered_set<NodeId>{{1, 1001}, {1, 1002}});
+
+        // append
+        CHECK(services::browseInto(serverOrClient, bd, projection) == 2);
+        CHECK(projection.size() == 4);
+        CHECK(projection.browseNames.size() == 1);
+
+        projection.clear();
+        CHECK(projection.size() == 0);
+        CHECK(projection.browseNames.empty());
+    }
+
+    SUBCASE("Custom projection with minimal result mask") {
+        MinimalProjection projection;
+        CHECK(services::browseInto(serverOrClient, bd, projection) == 2);
+        for (const auto& ref : projection.refs) {
+            CHECK(ref.getBrowseName().getName().empty());
+            CHECK(ref.getNodeClass() == NodeClass::Unspecified);
+            CHECK_FALSE(ref.getNodeId().getNodeId().isNull());
+        }
+    }
+
+    SUBCASE("Max references") {
+        BrowseProjection projection;
+        CHECK(services::browseInto(serverOrClient, bd, projection, 1) == 1);
+        CHECK(projection.size() == 1);
+    }
+
+    SUBCASE("Projection throws") {
+        if constexpr (isServer<T>) {
+            server.setMaxBrowseContinuationPoints(1);
+        }
+        ThrowingProjection projection;
+        for (int i = 0; i < 3; ++i) {
+            // continuation point of the first reference is released
+            CHECK_THROWS_AS(
+                services::browseInto(serverOrClient, bd, projection, 1), std::logic_error
+            );
+        }
+        CHECK(services::browse(serverOrClient, bd, 1).getStatusCode().isGood());
+    }
+
+    SUBCASE("Unknown node") {
+        BrowseProjection projection;
+        const BrowseDescription unknown({1, 9999}, BrowseDirection::Forward);
+        CHECK_THROWS_WITH(
+            services::browseInto(serverOrClient, unknown, projection), "BadNodeIdUnknown"
+        );
+    }
+}
+
+TEST_CASE_TEMPLATE("View service set browseRange", T, Server, Client) {
+    ServerClientSetup setup;
+    setup.client.connect(setup.endpointUrl);
+    auto& server = setup.server;
+    auto& serverOrClient = setup.getInstance<T>();
+
+    const NodeId folderId{1, 1000};
+    services::addFolder(server, ObjectId::ObjectsFolder, folderId, "Folder");
+    for (uint32_t i = 0; i < 10; ++i) {
+        services::addVariable(server, folderId, {1, 1001 + i}, "Variable" + std::to_string(i));
+    }
+    const BrowseDescription bd(folderId, BrowseDirection::Forward);
+    const auto expected = services::browseAll(serverOrClient, bd);
+
+    SUBCASE("Iterate all pages") {
+        std::vector<ExpandedNodeId> ids;
+        for (auto& ref : services::browseRange(serverOrClient, bd, 3)) {
+            ids.push_back(std::move(ref.getNodeId()));
+        }
+        REQUIRE(ids.size() == expected.size());
+        for (size_t i = 0; i < ids.size(); ++i) {
+            CHECK(ids[i] == expected[i].getNodeId());
+        }
+    }
+
+    SUBCASE("Stop early") {
+        // continuation points are released, the number of continuation points is limited
+        for (int i = 0; i < 10; ++i) {
+            auto range = services::browseRange(serverOrClient, bd, 2);
+            auto it = range.begin();
+            CHECK(it != range.end());
+            CHECK(it->getNodeId() == expected[0].getNodeId());
+            ++it;
+            CHECK(it->getNodeId() == expected[1].getNodeId());
+        }
+    }
+
+    SUBCASE("Empty") {
+        const BrowseDescription bdEmpty(
+            {1, 1001}, BrowseDirection::Forward, ReferenceTypeId::HasComponent
+        );
+        auto range = services::browseRange(serverOrClient, bdEmpty);
+        CHECK(range.begin() == range.end());
+    }
+
+    SUBCASE("Bad node") {
+        const BrowseDescription bdUnknown({1, 999}, BrowseDirection::Forward);
+        auto range = services::browseRange(serverOrClient, bdUnknown);
+        CHECK_THROWS_WITH(range.begin(), "BadNodeIdUnknown");
+    }
+}
+
+TEST_CASE("View service set browseRecursive (client)") {
+    ServerClientSetup setup;
+    setup.client.connect(setup.endpointUrl);
+
+    const BrowseDescription bd(
+        ObjectId::Server,
+        BrowseDirection::Forward,
+        ReferenceTypeId::References,
+        true,
+        UA_NODECLASS_VARIABLE
+    );
+    const auto expected = services::browseRecursive(setup.server, bd);
+
+    std::unordered_set<NodeId> found;
+    const size_t discovered = services::browseRecursive(
+        setup.client,
+        bd,
+        [&](const NodeId& /*sourceId*/, const ReferenceDescription& ref) {
+            CHECK(ref.getNodeClass() == NodeClass::Variable);
+            found.insert(ref.getNodeId().getNodeId());
+        },
+        {4, 16}
+    );
+    CHECK(discovered > found.size());
+    CHECK(found.size() == expected.size());
+    for (const auto& id : expected) {
+        CHECK(found.count(id.getNodeId()) == 1);
+    }
+}
+
+#ifdef UA_ENABLE_HISTORIZING
+TEST_CASE("History service set historyReadRaw (client)") {
+    ServerClientSetup setup;
+    setup.client.connect(setup.endpointUrl);
+    auto& server = setup.server;
+
+    HistoryBackend history;
+    const std::vector<NodeId> ids{{1, 1000}, {1, 1001}, {1, 1002}};
+    for (const auto& id : ids) {
+        services::addVariable(server, ObjectId::ObjectsFolder, id, "Variable");
+        auto& buffer = history.registerNode(server, id, {});
+        for (int64_t i = 1; i <= 10; ++i) {
+            auto dv = DataValue::fromScalar(static_cast<double>(i));
+            dv.setSourceTimestamp(DateTime::fromUnixTime(i));
+            buffer.insert(dv);
+        }
+    }
+
+    services::HistoryReadRawOptions options;
+    options.startTime = DateTime::fromUnixTime(3);
+    options.endTime = DateTime::fromUnixTime(100);
+    options.numValuesPerNode = 3;  // 8 values per node: 3 batches
+    options.maxNodesPerRequest = 2;
+
+    std::vector<std::vector<double>> values(ids.size());
+    size_t batches = 0;
+    const size_t count = services::historyReadRaw(
+        setup.client,
+        ids,
+        options,
+        [&](const services::HistoryReadBatch& batch) {
+            ++batches;
+            CHECK(batch.status.isGood());
+            CHECK(batch.values.size() == batch.sourceTimestamps.size());
+            for (const auto& value : batch.values) {
+                values.at(batch.nodeIndex).push_back(value.getScalarCopy<double>());
+            }
+            CHECK(batch.last == (values[batch.nodeIndex].size() == 8));
+        }
+    );
+    CHECK(count == 24);
+    CHECK(batches == 9);
+    for (const auto& nodeValues : values) {
+        CHECK(nodeValues == std::vector<double>{3, 4, 5, 6, 7, 8, 9, 10});
+    }
+
+    SUBCASE("Exception in callback") {
+        CHECK_THROWS_AS(
+            services::historyReadRaw(
+                setup.client,
+                ids,
+                options,
+                [](const services::HistoryReadBatch&) {
+                    throw BadStatus(UA_STATUSCODE_BADUNEXPECTEDERROR);
+                }
+            ),
+            BadStatus
+        );
+    }
+}
+#endif
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+TEST_CASE("Query service set (server)") {
+    Server server;
+    const NodeId analogItemType(VariableTypeId::AnalogItemType);
+    services::addFolder(server, ObjectId::ObjectsFolder, {1, "Line1"}, "Line1");
+    services::addFolder(server, ObjectId::ObjectsFolder, {1, "Line2"}, "Line2");
+    const auto addItem = [&](const NodeId& parentId, const NodeId& id, double value) {
+        services::addVariable(server, parentId, id, "Item", {}, analogItemType);
+        services::writeValue(server, id, Variant::fromScalar(value));
+    };
+    addItem({1, "Line1"}, {1, "Line1.A"}, 10.0);
+    addItem({1, "Line1"}, {1, "Line1.B"}, 25.0);
+    addItem({1, "Line2"}, {1, "Line2.A"}, 40.0);
+    services::addVariable(server, {1, "Line2"}, {1, "Line2.Other"}, "Other");
+
+    const std::vector<NodeTypeDescription> nodeTypes{
+        {ExpandedNodeId(analogItemType), false, {QueryDataDescription({}, AttributeId::Value)}},
+    };
+    const SimpleAttributeOperand value(analogItemType, {}, AttributeId::Value);
+    const SimpleAttributeOperand browseName(analogItemType, {}, AttributeId::BrowseName);
+    const auto makeRequest = [&](ContentFilter filter, uint32_t maxDataSets = 0) {
+        return QueryFirstRequest({}, {}, nodeTypes, std::move(filter), maxDataSets);
+    };
+    const auto queryIds = [&](const QueryFirstRequest& request) {
+        std::vector<NodeId> ids;
+        services::queryAll(server, request, [&](QueryDataSet& dataSet) {
+            ids.push_back(dataSet.getNodeId().getNodeId());
+        });
+        return ids;
+    };
+
+    SUBCASE("QueryFirst") {
+        const auto response = services::queryFirst(server, makeRequest({}));
+        CHECK(response.getResponseHeader().getServiceResult().isGood());
+        CHECK(response.getContinuationPoint().empty());
+        const auto dataSets = response.getQueryDataSets();
+        CHECK(dataSets.size() == 3);
+        CHECK(dataSets[0].getNodeId().getNodeId() == NodeId(1, "Line1.A"));
+        CHECK(dataSets[0].getTypeDefinitionNode().getNodeId() == analogItemType);
+        CHECK(dataSets[0].getValues().size() == 1);
+        CHECK(dataSets[0].getValues()[0].getScalarCopy<double>() == 10.0);
+        CHECK(dataSets[2].getValues()[0].getScalarCopy<double>() == 40.0);
+    }
+
+    SUBCASE("Filter") {
+        using Ids = std::vector<NodeId>;
+        const Ids all{{1, "Line1.A"}, {1, "Line1.B"}, {1, "Line2.A"}};
+        CHECK(
+            queryIds(makeRequest({{FilterOperator::GreaterThan, {value, LiteralOperand(20)}}})) ==
+            Ids{{1, "Line1.B"}, {1, "Line2.A"}}
+        );
+        CHECK(
+            queryIds(makeRequest(
+                {{FilterOperator::Between, {value, LiteralOperand(5), LiteralOperand(30.0)}}}
+            )) == Ids{{1, "Line1.A"}, {1, "Line1.B"}}
+        );
+        CHECK(
+            queryIds(makeRequest(
+                {{FilterOperator::InList, {value, LiteralOperand(10), LiteralOperand(40)}}}
+            )) == Ids{{1, "Line1.A"}, {1, "Line2.A"}}
+        );
+        const ContentFilterElement like(
+            FilterOperator::Like, {browseName, LiteralOperand(String("It%"))}
+        );
+        const ContentFilterElement equals(FilterOperator::Equals, {value, LiteralOperand(25)});
+        CHECK(queryIds(makeRequest(like && !equals)) == Ids{{1, "Line1.A"}, {1, "Line2.A"}});
+        const ContentFilterElement likeNone(
+            FilterOperator::Like, {browseName, LiteralOperand(String("I_e"))}
+        );
+        CHECK(queryIds(makeRequest({likeNone})).empty());
+        CHECK(
+            queryIds(makeRequest(
+                {{FilterOperator::OfType, {LiteralOperand(NodeId(VariableTypeId::DataItemType))}}}
+            )) == all
+        );
+        const std::vector<QualifiedName> missingPath{{1, "Missing"}};
+        const SimpleAttributeOperand missing(analogItemType, missingPath, AttributeId::Value);
+        CHECK(queryIds(makeRequest({{FilterOperator::IsNull, {missing}}})) == all);
+        CHECK(
+            queryIds(makeRequest({{FilterOperator::Equals, {missing, LiteralOperand(10)}}}))
+                .empty()
+        );
+    }
+
+    SUBCASE("Data to return with relative paths") {
+        const RelativePath euRange{{ReferenceTypeId::HasProperty, false, true, {0, "EURange"}}};
+        const RelativePath missing{{ReferenceTypeId::HasProperty, false, true, {1, "Missing"}}};
+        const std::vector<NodeTypeDescription> types{
+            {ExpandedNodeId(analogItemType),
+             false,
+             {QueryDataDescription(euRange, AttributeId::BrowseName),
+              QueryDataDescription(missing, AttributeId::Value)}},
+        };
+        const auto response = services::queryFirst(
+            server, QueryFirstRequest({}, {}, types, {}, 1)
+        );
+        const auto values = response.getQueryDataSets()[0].getValues();
+        CHECK(values[0].getScalarCopy<QualifiedName>() == QualifiedName(0, "EURange"));
+        CHECK(values[1].isType(UA_TYPES[UA_TYPES_STATUSCODE]));
+    }
+
+    SUBCASE("View and subtypes") {
+        const ViewDescription view({1, "Line1"}, {}, 0);
+        const std::vector<NodeTypeDescription> dataItems{
+            {ExpandedNodeId(NodeId(VariableTypeId::DataItemType)), true, {}},
+        };
+        CHECK(
+            queryIds(QueryFirstRequest({}, view, dataItems, {})) ==
+            std::vector<NodeId>{{1, "Line1.A"}, {1, "Line1.B"}}
+        );
+        const ViewDescription unknownView({1, "Unknown"}, {}, 0);
+        CHECK_THROWS_WITH(
+            queryIds(QueryFirstRequest({}, unknownView, nodeTypes, {})), "BadViewIdUnknown"
+        );
+    }
+
+    SUBCASE("QueryNext") {
+        auto response = services::queryFirst(server, makeRequest({}, 1));
+        CHECK(response.getQueryDataSets().size() == 1);
+        auto continuationPoint = response.getContinuationPoint();
+        CHECK_FALSE(continuationPoint.empty());
+
+        auto next = services::queryNext(server, QueryNextRequest({}, false, continuationPoint));
+        CHECK(next.getResponseHeader().getServiceResult().isGood());
+        CHECK(next.getQueryDataSets().size() == 1);
+        CHECK(next.getQueryDataSets()[0].getNodeId().getNodeId() == NodeId(1, "Line1.B"));
+        CHECK_FALSE(next.getRevisedContinuationPoint().empty());
+
+        // consumed by the previous request
+        next = services::queryNext(server, QueryNextRequest({}, false, continuationPoint));
+        CHECK(
+            next.getResponseHeader().getServiceResult() ==
+            UA_STATUSCODE_BADCONTINUATIONPOINTINVALID
+        );
+
+        // release
+        continuationPoint = services::queryFirst(server, makeRequest({}, 1)).getContinuationPoint();
+        next = services::queryNext(server, QueryNextRequest({}, true, continuationPoint));
+        CHECK(next.getResponseHeader().getServiceResult().isGood());
+        CHECK(next.getQueryDataSets().empty());
+
+        size_t count = 0;
+        CHECK(
+            services::queryAll(server, makeRequest({}, 1), [&](QueryDataSet&) { ++count; }) == 3
+        );
+        CHECK(count == 3);
+    }
+
+    SUBCASE("Invalid requests") {
+        const auto response = services::queryFirst(
+            server, makeRequest({{FilterOperator::Cast, {value, LiteralOperand(1)}}})
+        );
+        CHECK(
+            response.getResponseHeader().getServiceResult() == UA_STATUSCODE_BADCONTENTFILTERINVALID
+        );
+        CHECK(response->filterResult.elementResultsSize == 1);
+        CHECK(
+            response->filterResult.elementResults[0].statusCode ==
+            UA_STATUSCODE_BADFILTEROPERATORUNSUPPORTED
+        );
+        CHECK_THROWS_WITH(
+            queryIds(makeRequest({{FilterOperator::Not, {value, value}}})),
+            "BadContentFilterInvalid"
+        );
+
+        const std::vector<NodeTypeDescription> unknownType{
+            {ExpandedNodeId(NodeId(1, "UnknownType")), false, {}},
+        };
+        CHECK_THROWS_WITH(
+            queryIds(QueryFirstRequest({}, {}, unknownType, {})), "BadInvalidArgument"
+        );
+        CHECK_THROWS_WITH(queryIds(QueryFirstRequest({}, {}, {}, {})), "BadNothingToDo");
+    }
+}
+
+TEST_CASE("Query service set (client)") {
+    ServerClientSetup setup;
+    setup.client.connect(setup.endpointUrl);
+    const std::vector<NodeTypeDescription> nodeTypes{
+        {ExpandedNodeId(NodeId(VariableTypeId::AnalogItemType)), false, {}},
+    };
+    // not implemented by open62541 servers
+    CHECK_THROWS_WITH(
+        services::queryAll(
+            setup.client, QueryFirstRequest({}, {}, nodeTypes, {}), [](QueryDataSet&) {}
+        ),
+        "BadServiceUnsupported"
+    );
+}
+#endif
+
 #ifdef UA_ENABLE_METHODCALLS
 TEST_CASE_TEMPLATE("Method service set", T, Server, Client, Async<Client>) {
     ServerClientSetup setup;
@@ -760,6 +1633,153 @@ TEST_CASE_TEMPLATE("Method service set", T, Server, Client, Async<Client>) {
         );
     }
 }
+
+TEST_CASE_TEMPLATE("Method service set tryCall", T, Server, Client) {
+    ServerClientSetup setup;
+    setup.client.connect(setup.endpointUrl);
+    auto& serverOrClient = setup.getInstance<T>();
+
+    const NodeId objectsId{ObjectId::ObjectsFolder};
+    const NodeId methodId{1, 1000};
+    services::addMethod(
+        setup.server,
+        objectsId,
+        methodId,
+        "negate",
+        [](Span<const Variant> inputs, Span<Variant> outputs) {
+            outputs[0].setScalarCopy(-inputs[0].getScalarCopy<int32_t>());
+        },
+        {Argument("x", {}, DataTypeId::Int32, ValueRank::Scalar)},
+        {Argument("y", {}, DataTypeId::Int32, ValueRank::Scalar)}
+    );
+
+    const auto result = services::tryCall(
+        serverOrClient, objectsId, methodId, Span<const Variant>{Variant::fromScalar(int32_t{1})}
+    );
+    CHECK(result.code().isGood());
+    CHECK(result->at(0).getScalarCopy<int32_t>() == -1);
+
+    CHECK(
+        services::tryCall(
+            serverOrClient, objectsId, methodId, Span<const Variant>{Variant::fromScalar(true)}
+        )
+            .code() == UA_STATUSCODE_BADINVALIDARGUMENT
+    );
+    CHECK(
+        services::tryCall(serverOrClient, objectsId, methodId, Span<const Variant>{}).code() ==
+        UA_STATUSCODE_BADARGUMENTSMISSING
+    );
+}
+
+TEST_CASE_TEMPLATE("Method service set with typed callback", T, Server, Client) {
+    ServerClientSetup setup;
+    setup.client.connect(setup.endpointUrl);
+    auto& serverOrClient = setup.getInstance<T>();
+
+    const NodeId objectsId{ObjectId::ObjectsFolder};
+    const NodeId methodId{1, 1000};
+    services::addMethod<double(int32_t, std::string_view)>(
+        setup.server,
+        objectsId,
+        methodId,
+        "scale",
+        [](int32_t value, std::string_view unit) { return unit == "k" ? value * 1000.0 : value; },
+        {"value"}
+    );
+
+    SUBCASE("Generated arguments") {
+        const auto arguments = Node(setup.server, methodId)
+                                   .browseChild({{0, "InputArguments"}})
+                                   .readValueArray<Argument>();
+        REQUIRE(arguments.size() == 2);
+        CHECK(arguments[0].getName() == "value");
+        CHECK(arguments[0].getDataType() == NodeId(DataTypeId::Int32));
+        CHECK(arguments[0].getValueRank() == ValueRank::Scalar);
+        CHECK(arguments[1].getName() == "arg2");
+        CHECK(arguments[1].getDataType() == NodeId(DataTypeId::String));
+    }
+
+    SUBCASE("Check result") {
+        const auto outputs = services::call(
+            serverOrClient,
+            objectsId,
+            methodId,
+            Span<const Variant>{Variant::fromScalar(int32_t{2}), Variant::fromScalar("k")}
+        );
+        REQUIRE(outputs.size() == 1);
+        CHECK(outputs[0].getScalarCopy<double>() == 2000.0);
+    }
+
+    SUBCASE("Invalid input arguments") {
+        CHECK(
+            services::tryCall(
+                serverOrClient,
+                objectsId,
+                methodId,
+                Span<const Variant>{Variant::fromScalar(2.0), Variant::fromScalar("k")}
+            )
+                .code() == UA_STATUSCODE_BADINVALIDARGUMENT
+        );
+        CHECK(
+            services::tryCall(
+                serverOrClient,
+                objectsId,
+                methodId,
+                Span<const Variant>{Variant::fromScalar(int32_t{2})}
+            )
+                .code() == UA_STATUSCODE_BADARGUMENTSMISSING
+        );
+    }
+}
+
+TEST_CASE("Method service set callMany (client)") {
+    ServerClientSetup setup;
+    setup.client.connect(setup.endpointUrl);
+
+    const NodeId objectsId{ObjectId::ObjectsFolder};
+    const NodeId methodId{1, 1001};
+    services::addMethod(
+        setup.server,
+        objectsId,
+        methodId,
+        "increment",
+        [](Span<const Variant> inputs, Span<Variant> outputs) {
+            outputs[0].setScalarCopy(inputs[0].getScalarCopy<int32_t>() + 1);
+        },
+        {Argument("x", {}, DataTypeId::Int32, ValueRank::Scalar)},
+        {Argument("y", {}, DataTypeId::Int32, ValueRank::Scalar)}
+    );
+
+    std::vector<Variant> inputs;
+    std::vector<CallMethodRequest> methodsToCall;
+    for (int32_t i = 0; i < 10; ++i) {
+        inputs.push_back(Variant::fromScalar(i));
+    }
+    for (int32_t i = 0; i < 10; ++i) {
+        methodsToCall.emplace_back(objectsId, methodId, Span<const Variant>(&inputs[i], 1));
+    }
+    methodsToCall.emplace_back(objectsId, NodeId(1, 9999), Span<const Variant>{});
+
+    auto checkResults = [&](const CallResponse& response) {
+        const auto results = response.getResults();
+        REQUIRE(results.size() == methodsToCall.size());
+        for (int32_t i = 0; i < 10; ++i) {
+            CHECK(results[i].getStatusCode().isGood());
+            CHECK(results[i].getOutputArguments()[0].getScalarCopy<int32_t>() == i + 1);
+        }
+        CHECK(results[10].getStatusCode().isBad());
+    };
+
+    SUBCASE("Sync") {
+        checkResults(services::callMany(setup.client, methodsToCall));
+    }
+
+    SUBCASE("Async") {
+        auto future = services::callManyAsync(setup.client, methodsToCall, useFuture);
+        setup.client.runIterate();
+        checkResults(future.get());
+    }
+}
 #endif
 
 #ifdef UA_ENABLE_SUBSCRIPTIONS
@@ -993,6 +2013,60 @@ TEST_CASE("MonitoredItem service set (client)") {
         client.runIterate();
         CHECK(deleted == true);
     }
+
+    SUBCASE("Batch operations") {
+        const std::vector<ReadValueId> itemsToMonitor{
+            {id, AttributeId::Value},
+            {VariableId::Server_ServerStatus_CurrentTime, AttributeId::Value},
+            {{1, 999}, AttributeId::Value},  // unknown node
+        };
+        size_t notificationCount = 0;
+        size_t deletedCount = 0;
+        const auto created = services::createMonitoredItemsDataChange(
+            client,
+            subId,
+            itemsToMonitor,
+            MonitoringMode::Reporting,
+            monitoringParameters,
+            [&](uint32_t, uint32_t, const DataValue&) { notificationCount++; },
+            [&](uint32_t, uint32_t) { deletedCount++; }
+        );
+        REQUIRE(created.size() == 3);
+        CHECK(created[0].statusCode.isGood());
+        CHECK(created[1].statusCode.isGood());
+        CHECK(created[2].statusCode == UA_STATUSCODE_BADNODEIDUNKNOWN);
+        CHECK(created[0].clientHandle != created[1].clientHandle);
+        CHECK(created[0].clientHandle < 2);
+        CHECK(created[1].clientHandle < 2);
+        client.runIterate();
+        CHECK(notificationCount > 0);
+
+        const std::vector<uint32_t> monIds{
+            created[0].monitoredItemId, created[1].monitoredItemId, 11U
+        };
+        services::MonitoringParameters modifiedParameters{};
+        modifiedParameters.samplingInterval = 1000.0;
+        const auto modified =
+            services::modifyMonitoredItems(client, subId, monIds, modifiedParameters);
+        REQUIRE(modified.size() == 3);
+        CHECK(modified[0].statusCode.isGood());
+        CHECK(modified[0].parameters.samplingInterval == 1000.0);
+        CHECK(modified[2].statusCode == UA_STATUSCODE_BADMONITOREDITEMIDINVALID);
+
+        const auto modes =
+            services::setMonitoringMode(client, subId, monIds, MonitoringMode::Disabled);
+        REQUIRE(modes.size() == 3);
+        CHECK(modes[0].isGood());
+        CHECK(modes[2] == UA_STATUSCODE_BADMONITOREDITEMIDINVALID);
+
+        const auto deleted = services::deleteMonitoredItems(client, subId, monIds);
+        REQUIRE(deleted.size() == 3);
+        CHECK(deleted[0].isGood());
+        CHECK(deleted[1].isGood());
+        CHECK(deleted[2] == UA_STATUSCODE_BADMONITOREDITEMIDINVALID);
+        client.runIterate();
+        CHECK(deletedCount >= 2);
+    }
 }
 
 TEST_CASE("MonitoredItem service set (server)") {
@@ -1028,5 +2102,54 @@ TEST_CASE("MonitoredItem service set (server)") {
 
         CHECK_NOTHROW(services::deleteMonitoredItem(server, monId));
     }
+
+    SUBCASE("createMonitoredItemsDataChange") {
+        const std::vector<ReadValueId> items{
+            {VariableId::Server_ServerStatus_CurrentTime, AttributeId::Value},
+            {VariableId::Server_ServerStatus_State, AttributeId::Value},
+            {NodeId(0, 11111), AttributeId::Value},
+        };
+        monitoringParameters.samplingInterval = 0.0;
+        size_t batchCount = 0;
+        size_t notificationCount = 0;
+        const auto results = services::createMonitoredItemsDataChange(
+            server,
+            items,
+            MonitoringMode::Reporting,
+            monitoringParameters,
+            [&](uint32_t subId, Span<services::MonitoredItemNotification> notifications) {
+                CHECK(subId == 0U);
+                CHECK_FALSE(notifications.empty());
+                batchCount++;
+                notificationCount += notifications.size();
+            }
+        );
+        REQUIRE(results.size() == 3);
+        CHECK(results[0].statusCode.isGood());
+        CHECK(results[1].statusCode.isGood());
+        CHECK(results[2].statusCode.isBad());
+        std::this_thread::sleep_for(100ms);
+        server.runIterate();
+        CHECK(batchCount == 1);
+        CHECK(notificationCount >= 2);
+
+        // the group is removed with its last monitored item
+        const auto& groups = opcua::detail::getContext(server).dataChangeNotificationGroups;
+        CHECK(groups.size() == 1);
+        CHECK_NOTHROW(services::deleteMonitoredItem(server, results[0].monitoredItemId));
+        CHECK(groups.size() == 1);
+        CHECK_NOTHROW(services::deleteMonitoredItem(server, results[1].monitoredItemId));
+        CHECK(groups.empty());
+    }
+
+    SUBCASE("createMonitoredItemsDataChange without valid items") {
+        const std::vector<ReadValueId> items{{NodeId(0, 11111), AttributeId::Value}};
+        const auto results = services::createMonitoredItemsDataChange(
+            server, items, MonitoringMode::Reporting, monitoringParameters, {}
+        );
+        REQUIRE(results.size() == 1);
+        CHECK(results[0].statusCode.isBad());
+        CHECK(opcua::detail::getContext(server).dataChangeNotificationGroups.empty());
+    }
 }
 #endif
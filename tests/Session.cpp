@@ -1,10 +1,14 @@
 #include <doctest/doctest.h>
 
+#include <memory>
+
+#include "open62541pp/AccessControl.h"
 #include "open62541pp/Client.h"
 #include "open62541pp/Config.h"
 #include "open62541pp/Node.h"
 #include "open62541pp/Server.h"
 #include "open62541pp/Session.h"
+#include "open62541pp/ValueBackend.h"
 
 #include "helper/Runner.h"
 
@@ -60,3 +64,70 @@ TEST_CASE("Session") {
         CHECK(Session(server, {1, 1000}) != Session(server, {1, 1001}));
     }
 }
+
+TEST_CASE("Session contexts") {
+    struct UserData {
+        int value;
+    };
+
+    static const SessionSlot<UserData> slot;
+    static const SessionSlot<int> otherSlot;
+
+    class AccessControlContext : public AccessControlDefault {
+    public:
+        StatusCode activateSession(
+            Session& session,
+            const EndpointDescription& endpointDescription,
+            const ByteString& secureChannelRemoteCertificate,
+            const ExtensionObject& userIdentityToken
+        ) override {
+            session.setContext(slot, std::make_shared<UserData>(UserData{11}));
+            return AccessControlDefault::activateSession(
+                session, endpointDescription, secureChannelRemoteCertificate, userIdentityToken
+            );
+        }
+    };
+
+    Server server;
+    server.setAccessControl(std::make_unique<AccessControlContext>());
+
+    const NodeId id(1, 1000);
+    Node(server, ObjectId::ObjectsFolder).addVariable(id, "Variable");
+    int valueInCallback = 0;
+    ValueCallback callback;
+    callback.onBeforeRead = [&](const DataValue&) {
+        auto* session = server.getCurrentSession();
+        if (session != nullptr && session->getContext(slot) != nullptr) {
+            valueInCallback = session->getContext(slot)->value;
+        }
+    };
+    server.setVariableNodeValueCallback(id, callback);
+
+    CHECK(server.getCurrentSession() == nullptr);
+    CHECK_THROWS_WITH(
+        Session(server, {0, 1}).setContext(otherSlot, std::make_shared<int>(1)),
+        "BadSessionIdInvalid"
+    );
+
+    ServerRunner serverRunner(server);
+    Client client;
+    client.connect(localServerUrl);
+
+    auto session = server.getSessions().at(0);
+    REQUIRE(session.getContext(slot) != nullptr);
+    CHECK(session.getContext(slot)->value == 11);
+    CHECK(session.getContext(otherSlot) == nullptr);
+
+    Node(client, id).readValue();
+    CHECK(valueInCallback == 11);
+
+    size_t count = 0;
+    server.forEachSession([&](Session& s) {
+        CHECK(s == session);
+        ++count;
+    });
+    CHECK(count == 1);
+
+    client.disconnect();
+    CHECK(session.getContext(slot) == nullptr);
+}
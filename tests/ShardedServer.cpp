@@ -0,0 +1,91 @@
+#include <string>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/Node.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/ShardedServer.h"
+#include "open62541pp/services/Attribute_highlevel.h"
+
+using namespace opcua;
+
+TEST_CASE("ShardedServer") {
+    ShardedServer sharded({2, 4850});
+    CHECK(sharded.getShardCount() == 2);
+
+    const auto ns1 = sharded.registerNamespace("urn:shard1", 0);
+    const auto ns2 = sharded.registerNamespace("urn:shard2", 1);
+    CHECK(ns1 != ns2);
+    CHECK(sharded.getShardIndex({ns1, 1}) == 0);
+    CHECK(sharded.getShardIndex({ns2, 1}) == 1);
+    CHECK(sharded.getShardIndex({0, UA_NS0ID_SERVER}) == 0);
+    CHECK_THROWS_AS(sharded.registerNamespace("urn:invalid", 2), BadStatus);
+
+    const NodeId id1{ns1, 1};
+    const NodeId id2{ns2, 1};
+    for (const auto& id : {id1, id2}) {
+        sharded.execute(sharded.getShardIndex(id), [&](Server& server) {
+            server.getObjectsNode().addVariable(
+                id,
+                "variable",
+                VariableAttributes{}
+                    .setDataType<int32_t>()
+                    .setAccessLevel(AccessLevel::CurrentRead | AccessLevel::CurrentWrite)
+                    .setValueScalar(static_cast<int32_t>(id.getNamespaceIndex()))
+            );
+        });
+    }
+
+    SUBCASE("Execute propagates exceptions") {
+        CHECK_THROWS_AS(
+            sharded.execute(0, [](Server&) { throw BadStatus(UA_STATUSCODE_BADINTERNALERROR); }),
+            BadStatus
+        );
+    }
+
+    SUBCASE("Read and write routed by namespace") {
+        const std::vector<ReadValueId> items{
+            {id2, AttributeId::Value},
+            {id1, AttributeId::Value},
+            {NodeId(ns1, 99), AttributeId::Value},
+        };
+        auto values = sharded.read(items);
+        REQUIRE(values.size() == 3);
+        CHECK(values[0].getValue().getScalar<int32_t>() == ns2);
+        CHECK(values[1].getValue().getScalar<int32_t>() == ns1);
+        CHECK(values[2].getStatus() == UA_STATUSCODE_BADNODEIDUNKNOWN);
+
+        const std::vector<WriteValue> writes{
+            {id1, AttributeId::Value, {}, DataValue(Variant::fromScalar(int32_t{11}))},
+            {id2, AttributeId::Value, {}, DataValue(Variant::fromScalar(int32_t{22}))},
+        };
+        auto statuses = sharded.write(writes);
+        CHECK(statuses.at(0).isGood());
+        CHECK(statuses.at(1).isGood());
+        values = sharded.read(items);
+        CHECK(values[0].getValue().getScalar<int32_t>() == 22);
+        CHECK(values[1].getValue().getScalar<int32_t>() == 11);
+    }
+
+    SUBCASE("Browse") {
+        const std::vector<BrowseDescription> items{
+            {id1, BrowseDirection::Inverse},
+            {id2, BrowseDirection::Inverse},
+        };
+        const auto results = sharded.browse(items);
+        REQUIRE(results.size() == 2);
+        CHECK(results[0].getStatusCode().isGood());
+        CHECK(!results[0].getReferences().empty());
+        CHECK(!results[1].getReferences().empty());
+    }
+
+    SUBCASE("Expose at the endpoint") {
+        sharded.expose(ObjectId::ObjectsFolder, id2);
+        auto& front = sharded.getServer();
+        CHECK(services::readValue(front, id2).getScalar<int32_t>() == ns2);
+        services::writeValue(front, id2, Variant::fromScalar(int32_t{33}));
+        const std::vector<ReadValueId> items{{id2, AttributeId::Value}};
+        CHECK(sharded.read(items).at(0).getValue().getScalar<int32_t>() == 33);
+    }
+}
@@ -0,0 +1,68 @@
+#include <chrono>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/Server.h"
+#include "open62541pp/SharedSampler.h"
+#include "open62541pp/ValueBackend.h"
+#include "open62541pp/services/Attribute.h"
+#include "open62541pp/services/NodeManagement.h"
+
+using namespace opcua;
+
+TEST_CASE("SharedSampler") {
+    Server server;
+    const NodeId id{1, 1000};
+    VariableAttributes attributes;
+    attributes.setAccessLevel(AccessLevel::CurrentRead | AccessLevel::CurrentWrite);
+    services::addVariable(server, ObjectId::ObjectsFolder, id, "Variable", attributes);
+
+    std::vector<int> data{1, 2, 3, 4};
+    size_t readCount = 0;
+    ValueBackendDataSource source;
+    source.read = [&](DataValue& dv, const NumericRange& range, bool) {
+        CHECK(range.empty());
+        ++readCount;
+        dv.getValue().setArray(data);  // zero-copy
+        return StatusCode(UA_STATUSCODE_GOOD);
+    };
+    source.write = [&](const DataValue& dv, const NumericRange&) {
+        data = dv.getValue().getArrayCopy<int>();
+        return StatusCode(UA_STATUSCODE_GOOD);
+    };
+
+    SUBCASE("Share samples within the maximum age") {
+        SharedSampler sampler(std::chrono::hours(1));
+        sampler.registerNode(server, id, source);
+        CHECK(sampler.size() == 1);
+
+        const std::vector<int> expected{1, 2, 3, 4};
+        for (int i = 0; i < 3; ++i) {
+            CHECK(services::readValue(server, id).getArrayCopy<int>() == expected);
+        }
+        CHECK(readCount == 1);
+        CHECK(sampler.getSourceReads() == 1);
+        CHECK(sampler.getSharedReads() == 2);
+
+        data[0] = 0;  // shared sample is a copy
+        CHECK(services::readValue(server, id).getArrayCopy<int>() == expected);
+
+        sampler.invalidate(id);
+        CHECK(services::readValue(server, id).getArrayCopy<int>() == std::vector<int>{0, 2, 3, 4});
+        CHECK(readCount == 2);
+
+        services::writeValue(server, id, Variant::fromArray(std::vector<int>{5, 6}));
+        CHECK(services::readValue(server, id).getArrayCopy<int>() == std::vector<int>{5, 6});
+        CHECK(readCount == 3);
+    }
+
+    SUBCASE("Read from data source if expired") {
+        SharedSampler sampler(std::chrono::seconds(0));
+        sampler.registerNode(server, id, source);
+        services::readValue(server, id);
+        services::readValue(server, id);
+        CHECK(readCount == 2);
+        CHECK(sampler.getSharedReads() == 0);
+    }
+}
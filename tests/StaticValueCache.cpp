@@ -0,0 +1,56 @@
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/Config.h"
+#include "open62541pp/Encoding.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/StaticValueCache.h"
+#include "open62541pp/services/Attribute.h"
+#include "open62541pp/services/NodeManagement.h"
+
+using namespace opcua;
+
+TEST_CASE("StaticValueCache") {
+    Server server;
+    const NodeId id{1, 1000};
+    VariableAttributes attributes;
+    attributes.setAccessLevel(AccessLevel::CurrentRead | AccessLevel::CurrentWrite);
+    services::addVariable(server, ObjectId::ObjectsFolder, id, "Variable", attributes);
+    services::writeValue(server, id, Variant::fromArray(std::vector<int>{1, 2, 3, 4}));
+
+    StaticValueCache cache;
+    CHECK_THROWS_AS(cache.getValue(id), BadStatus);
+    cache.registerNode(server, id);
+    CHECK(cache.size() == 1);
+    CHECK(cache.getValue(id).getValue().getArrayCopy<int>() == std::vector<int>{1, 2, 3, 4});
+
+    SUBCASE("Read") {
+        CHECK(services::readValue(server, id).getArrayCopy<int>() == std::vector<int>{1, 2, 3, 4});
+    }
+
+    SUBCASE("Write") {
+        services::writeValue(server, id, Variant::fromArray(std::vector<int>{5, 6}));
+        CHECK(cache.getValue(id).getValue().getArrayCopy<int>() == std::vector<int>{5, 6});
+        CHECK(services::readValue(server, id).getArrayCopy<int>() == std::vector<int>{5, 6});
+
+        cache.setValue(id, DataValue::fromArray(std::vector<int>{7}));
+        CHECK(services::readValue(server, id).getArrayCopy<int>() == std::vector<int>{7});
+    }
+
+#if UAPP_OPEN62541_VER_GE(1, 3)
+    SUBCASE("Encoded value") {
+        auto toByteString = [](Span<const uint8_t> bytes) {
+            return ByteString(std::vector<uint8_t>(bytes.begin(), bytes.end()));
+        };
+        const auto encoded = cache.getEncoded(id);
+        const auto expected = encodeBinary(cache.getValue(id).getValue());
+        CHECK(toByteString(encoded) == expected);
+        CHECK(cache.getEncoded(id).data() == encoded.data());  // cached
+
+        cache.setValue(id, DataValue::fromScalar(1));
+        CHECK(toByteString(cache.getEncoded(id)) == encodeBinary(Variant::fromScalar(1)));
+    }
+#endif
+}
@@ -0,0 +1,103 @@
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/Client.h"
+#include "open62541pp/Config.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/SubscriptionGroup.h"
+#include "open62541pp/types/Composed.h"
+#include "open62541pp/types/DataValue.h"
+
+#include "helper/Runner.h"
+
+using namespace opcua;
+using namespace std::literals::chrono_literals;
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+TEST_CASE("SubscriptionGroup") {
+    Server server;
+    ServerRunner serverRunner(server);
+    Client client;
+    client.connect("opc.tcp://localhost:4840");
+
+    const ReadValueId itemToMonitor(
+        VariableId::Server_ServerStatus_CurrentTime, AttributeId::Value
+    );
+    SubscriptionGroup group(client, 2);
+    CHECK(group.size() == 0);
+    CHECK(group.getSubscriptions().empty());
+
+    SUBCASE("Shard by item limit") {
+        std::vector<uint32_t> ids;
+        for (size_t i = 0; i < 5; ++i) {
+            MonitoringParameters parameters{};
+            ids.push_back(group.subscribeDataChange(itemToMonitor, parameters, {}));
+        }
+        CHECK(group.size() == 5);
+        CHECK(group.getSubscriptions().size() == 3);
+
+        group.unsubscribe(ids[4]);
+        CHECK(group.size() == 4);
+        CHECK(group.getSubscriptions().size() == 2);
+        CHECK_THROWS_AS(group.unsubscribe(ids[4]), BadStatus);
+        CHECK_THROWS_AS(group.getMonitoredItem(ids[4]), BadStatus);
+    }
+
+    SUBCASE("Shard by sampling interval and priority") {
+        MonitoringParameters parameters{};
+        parameters.samplingInterval = 100.0;
+        const auto id1 = group.subscribeDataChange(itemToMonitor, parameters, {});
+        parameters.samplingInterval = 500.0;
+        const auto id2 = group.subscribeDataChange(itemToMonitor, parameters, {});
+        parameters.samplingInterval = 500.0;
+        const auto id3 = group.subscribeDataChange(itemToMonitor, parameters, {}, 10);
+        CHECK(group.getSubscriptions().size() == 3);
+        CHECK(
+            group.getMonitoredItem(id1).getSubscriptionId() !=
+            group.getMonitoredItem(id2).getSubscriptionId()
+        );
+        CHECK(
+            group.getMonitoredItem(id2).getSubscriptionId() !=
+            group.getMonitoredItem(id3).getSubscriptionId()
+        );
+    }
+
+    SUBCASE("Rebalance") {
+        std::vector<uint32_t> ids;
+        for (size_t i = 0; i < 6; ++i) {
+            MonitoringParameters parameters{};
+            ids.push_back(group.subscribeDataChange(itemToMonitor, parameters, {}));
+        }
+        CHECK(group.getSubscriptions().size() == 3);
+        group.unsubscribe(ids[0]);
+        group.unsubscribe(ids[2]);
+        group.unsubscribe(ids[4]);
+        CHECK(group.getSubscriptions().size() == 3);
+
+        CHECK(group.rebalance() == 1);
+        CHECK(group.size() == 3);
+        CHECK(group.getSubscriptions().size() == 2);
+        CHECK(group.rebalance() == 0);
+    }
+
+    SUBCASE("Data change notifications") {
+        MonitoringParameters parameters{};
+        parameters.samplingInterval = 0.0;
+        size_t notificationCount = 0;
+        uint32_t id = 0;
+        id = group.subscribeDataChange(
+            itemToMonitor, parameters, [&](uint32_t itemId, const DataValue&) {
+                CHECK(itemId == id);
+                notificationCount++;
+            }
+        );
+        std::this_thread::sleep_for(100ms);
+        client.runIterate();
+        CHECK(notificationCount > 0);
+    }
+}
+#endif
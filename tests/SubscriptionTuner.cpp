@@ -0,0 +1,96 @@
+#include <chrono>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/Client.h"
+#include "open62541pp/Config.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/Subscription.h"
+#include "open62541pp/SubscriptionTuner.h"
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/DateTime.h"
+#include "open62541pp/types/Variant.h"
+
+#include "helper/Runner.h"
+
+using namespace opcua;
+using namespace std::literals::chrono_literals;
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+static DataValue createValue(std::chrono::milliseconds age, StatusCode status = {}) {
+    return DataValue(
+        Variant::fromScalar(1.0),
+        std::nullopt,
+        DateTime::fromTimePoint(std::chrono::system_clock::now() - age),
+        std::nullopt,
+        std::nullopt,
+        status
+    );
+}
+
+TEST_CASE("SubscriptionTuner") {
+    Server server;
+    ServerRunner serverRunner(server);
+    Client client;
+    client.connect("opc.tcp://localhost:4840");
+
+    SubscriptionParameters parameters{};
+    parameters.publishingInterval = 400.0;
+    auto sub = client.createSubscription(parameters);
+    SubscriptionTuning tuning{};
+    tuning.targetLatency = 1000.0;
+    SubscriptionTuner tuner(sub, parameters, tuning);
+
+    SUBCASE("No notifications") {
+        CHECK_FALSE(tuner.adjust());
+        CHECK(tuner.getParameters().publishingInterval == parameters.publishingInterval);
+    }
+
+    SUBCASE("Statistics") {
+        tuner.observe(1U, createValue(100ms));
+        tuner.observe(1U, createValue(300ms));
+        const auto statistics = tuner.getStatistics();
+        CHECK(statistics.notificationCount == 2);
+        CHECK(statistics.meanLatency == doctest::Approx(200.0).epsilon(0.1));
+        CHECK(statistics.overflowCount == 0);
+    }
+
+    SUBCASE("Decrease publishing interval on high latency") {
+        tuner.observe(1U, createValue(5s));
+        CHECK(tuner.adjust());
+        CHECK(tuner.getParameters().publishingInterval < 400.0);
+        CHECK(tuner.getParameters().publishingInterval >= tuning.minPublishingInterval);
+        CHECK(tuner.getStatistics().notificationCount == 0);  // reset
+    }
+
+    SUBCASE("Increase publishing interval on low latency") {
+        tuner.observe(1U, createValue(0ms));
+        CHECK(tuner.adjust());
+        CHECK(tuner.getParameters().publishingInterval > 400.0);
+    }
+
+    SUBCASE("Increase queue size on overflow") {
+        MonitoringParameters monitoringParameters{};
+        auto mon = sub.subscribeDataChange(
+            VariableId::Server_ServerStatus_CurrentTime,
+            AttributeId::Value,
+            MonitoringMode::Reporting,
+            monitoringParameters,
+            {}
+        );
+        const auto monId = mon.getMonitoredItemId();
+        tuner.addMonitoredItem(monId, monitoringParameters);
+        CHECK(tuner.getMonitoringParameters(monId).queueSize == 1);
+
+        constexpr uint32_t overflow = 0x00000480;  // info type data value + overflow bit
+        tuner.observe(monId, createValue(200ms, overflow));
+        CHECK(tuner.getStatistics().overflowCount == 1);
+        CHECK(tuner.adjust());
+        CHECK(tuner.getMonitoringParameters(monId).queueSize == 2);
+
+        tuner.removeMonitoredItem(monId);
+        CHECK_THROWS_AS(tuner.getMonitoringParameters(monId), BadStatus);
+    }
+}
+#endif
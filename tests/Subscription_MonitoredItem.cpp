@@ -1,5 +1,7 @@
 #include <chrono>
+#include <set>
 #include <thread>
+#include <vector>
 
 #include <doctest/doctest.h>
 
@@ -7,6 +9,7 @@
 #include "open62541pp/Config.h"
 #include "open62541pp/MonitoredItem.h"
 #include "open62541pp/Server.h"
+#include "open62541pp/Span.h"
 #include "open62541pp/Subscription.h"
 #include "open62541pp/types/Composed.h"
 #include "open62541pp/types/Variant.h"
@@ -156,6 +159,132 @@ TEST_CASE("Subscription & MonitoredItem (client)") {
         CHECK(monItem2.getMonitoredItemId() == monId2);
     }
 
+    SUBCASE("Monitor data change of many items") {
+        auto sub = client.createSubscription();
+        const std::vector<ReadValueId> itemsToMonitor(
+            3, {VariableId::Server_ServerStatus_CurrentTime, AttributeId::Value}
+        );
+        std::set<uint32_t> notifiedIds;
+        const auto results = sub.subscribeDataChangeMany(
+            itemsToMonitor,
+            MonitoringMode::Reporting,
+            MonitoringParameters{},
+            [&](const auto& item, const DataValue&) {
+                CHECK(item.getNodeId() == NodeId(VariableId::Server_ServerStatus_CurrentTime));
+                notifiedIds.insert(item.getMonitoredItemId());
+            }
+        );
+        REQUIRE(results.size() == 3);
+        for (const auto& result : results) {
+            CHECK(result.statusCode.isGood());
+        }
+        CHECK(sub.getMonitoredItems().size() == 3);
+
+        client.runIterate();
+        CHECK(notifiedIds.size() == 3);
+    }
+
+    SUBCASE("Monitor data change with batched delivery") {
+        size_t batchCount = 0;
+        std::set<uint32_t> notifiedIds;
+        std::set<uint32_t> notifiedHandles;
+        SubscriptionParameters parameters{};
+        auto sub = client.createSubscription(
+            parameters,
+            [&](uint32_t subId, Span<services::MonitoredItemNotification> notifications) {
+                CHECK(subId != 0);
+                batchCount++;
+                for (const auto& notification : notifications) {
+                    CHECK(notification.value.hasValue());
+                    notifiedIds.insert(notification.monitoredItemId);
+                    notifiedHandles.insert(notification.clientHandle);
+                }
+            }
+        );
+
+        size_t itemCallbackCount = 0;
+        auto monItem1 = sub.subscribeDataChange(
+            VariableId::Server_ServerStatus_CurrentTime,
+            AttributeId::Value,
+            [&](const auto&, const DataValue&) { itemCallbackCount++; }
+        );
+        auto monItem2 = sub.subscribeDataChange(
+            VariableId::Server_ServerStatus_State,
+            AttributeId::Value,
+            [&](const auto&, const DataValue&) { itemCallbackCount++; }
+        );
+
+        client.runIterate();
+        CHECK(batchCount >= 1);
+        CHECK(itemCallbackCount == 0);
+        CHECK(notifiedIds.count(monItem1.getMonitoredItemId()) == 1);
+        CHECK(notifiedIds.count(monItem2.getMonitoredItemId()) == 1);
+        CHECK(notifiedHandles.count(monItem1.getClientHandle()) == 1);
+        CHECK(notifiedHandles.count(monItem2.getClientHandle()) == 1);
+    }
+
+    SUBCASE("Recover subscriptions") {
+        std::vector<RecoveredSubscription> recovered;
+        client.enableSubscriptionRecovery([&](Span<const RecoveredSubscription> results) {
+            recovered.assign(results.begin(), results.end());
+        });
+
+        auto sub = client.createSubscription();
+        size_t notificationCount = 0;
+        auto mon = sub.subscribeDataChange(
+            VariableId::Server_ServerStatus_CurrentTime,
+            AttributeId::Value,
+            [&](const auto&, const DataValue&) { notificationCount++; }
+        );
+
+        // subscriptions are deleted with the session, recreated after the new session is activated
+        client.disconnect();
+        CHECK(client.getSubscriptions().empty());
+        client.connect("opc.tcp://localhost:4840");
+        client.runIterate();
+
+        CHECK(client.getSubscriptions().size() == 1);
+        REQUIRE(recovered.size() == 1);
+        CHECK(recovered[0].previousSubscriptionId == sub.getSubscriptionId());
+        CHECK(recovered[0].statusCode.isGood());
+        CHECK(recovered[0].previousMonitoredItemIds.size() == 1);
+        CHECK(recovered[0].previousMonitoredItemIds.at(0) == mon.getMonitoredItemId());
+        REQUIRE(recovered[0].monitoredItems.size() == 1);
+        CHECK(recovered[0].monitoredItems[0].statusCode.isGood());
+
+        notificationCount = 0;
+        client.runIterate();
+        CHECK(notificationCount > 0);
+    }
+
+    SUBCASE("Statistics") {
+        auto sub = client.createSubscription();
+        size_t notificationCount = 0;
+        auto mon = sub.subscribeDataChange(
+            VariableId::Server_ServerStatus_CurrentTime,
+            AttributeId::Value,
+            [&](const auto&, const DataValue&) { notificationCount++; }
+        );
+        client.runIterate();
+        REQUIRE(notificationCount > 0);
+
+        const auto monStats = mon.getStatistics();
+        CHECK(monStats.notifications == notificationCount);
+        CHECK(monStats.overflows == 0);
+        CHECK(monStats.latencySum >= monStats.latencyMax);
+
+        const auto subStats = sub.getStatistics();
+        CHECK(subStats.notifications == notificationCount);
+        CHECK(subStats.overflows == 0);
+        CHECK(subStats.statusChanges == 0);
+        CHECK(subStats.latency.count == monStats.latencyCount);
+
+        mon.deleteMonitoredItem();
+        CHECK_THROWS_WITH(mon.getStatistics(), "BadMonitoredItemIdInvalid");
+        sub.deleteSubscription();
+        CHECK_THROWS_WITH(sub.getStatistics(), "BadSubscriptionIdInvalid");
+    }
+
     SUBCASE("Modify monitored item") {
         auto sub = client.createSubscription();
         auto mon = sub.subscribeDataChange(
@@ -1,10 +1,13 @@
+#include <memory_resource>
+#include <vector>
+
 #include <doctest/doctest.h>
 
 #include "open62541pp/TypeConverter.h"
 
 using namespace opcua;
 
-TEST_CASE_TEMPLATE("TypeConverter string", T, std::string, std::string_view) {
+TEST_CASE_TEMPLATE("TypeConverter string", T, std::string, std::pmr::string, std::string_view) {
     SUBCASE("fromNative") {
         const String src("Test123");
         T dst;
@@ -22,6 +25,14 @@ TEST_CASE_TEMPLATE("TypeConverter string", T, std::string, std::string_view) {
     }
 }
 
+TEST_CASE("TypeConverter std::pmr::string keeps allocator") {
+    std::pmr::monotonic_buffer_resource resource;
+    std::pmr::string dst(&resource);
+    TypeConverter<std::pmr::string>::fromNative(String("a string longer than the SSO buffer"), dst);
+    CHECK(dst == "a string longer than the SSO buffer");
+    CHECK(dst.get_allocator().resource() == &resource);
+}
+
 TEST_CASE("TypeConverter const char*") {
     SUBCASE("toNative") {
         const char* src = "Test123";
@@ -60,4 +71,25 @@ TEST_CASE("TypeConverter std::chrono::time_point") {
         TypeConverter<TimePoint>::fromNative(src, dst);
         CHECK(dst.time_since_epoch().count() == 0);
     }
+
+    SUBCASE("toNativeArray") {
+        const std::vector<TimePoint> src{TimePoint{}, TimePoint{std::chrono::seconds(1)}};
+        std::vector<DateTime> dst(src.size());
+
+        TypeConverter<TimePoint>::toNativeArray(src.data(), src.size(), dst.data());
+        CHECK(dst[0].get() == UA_DATETIME_UNIX_EPOCH);
+        CHECK(dst[1].get() == UA_DATETIME_UNIX_EPOCH + UA_DATETIME_SEC);
+    }
+
+    SUBCASE("fromNativeArray") {
+        const std::vector<DateTime> src{
+            DateTime(UA_DATETIME_UNIX_EPOCH + UA_DATETIME_SEC),
+            DateTime(0),  // before Unix epoch
+        };
+        std::vector<TimePoint> dst(src.size());
+
+        TypeConverter<TimePoint>::fromNativeArray(src.data(), src.size(), dst.data());
+        CHECK(dst[0] == TimePoint{std::chrono::seconds(1)});
+        CHECK(dst[1] == TimePoint{});
+    }
 }
@@ -35,8 +35,20 @@ TEST_CASE("TypeRegistry") {
     SUBCASE("Generated") {
         CHECK(&TypeRegistry<UA_AddNodesItem>::getDataType() == &UA_TYPES[UA_TYPES_ADDNODESITEM]);
         CHECK(&getDataType<UA_AddNodesItem>() == &UA_TYPES[UA_TYPES_ADDNODESITEM]);
+        CHECK(&getDataType<UA_ReadRequest>() == &UA_TYPES[UA_TYPES_READREQUEST]);
+        CHECK(&getDataType<UA_HistoryData>() == &UA_TYPES[UA_TYPES_HISTORYDATA]);
     }
 
+#ifndef _WIN32  // addresses of dllimport symbols are no constant expressions
+    SUBCASE("Constant expression") {
+        constexpr const UA_DataType* type = &getDataType<UA_AddNodesItem>();
+        static_assert(type == &UA_TYPES[UA_TYPES_ADDNODESITEM]);
+        using Wrapper = TypeWrapper<float, UA_TYPES_FLOAT>;
+        constexpr const UA_DataType* wrapperType = &getDataType<Wrapper>();
+        static_assert(wrapperType == &UA_TYPES[UA_TYPES_FLOAT]);
+    }
+#endif
+
     SUBCASE("TypeWrapper") {
         class Wrapper : public TypeWrapper<float, UA_TYPES_FLOAT> {};
 
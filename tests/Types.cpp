@@ -1,6 +1,11 @@
 #include <array>
+#include <chrono>
+#include <cstdlib>  // abs
+#include <list>
+#include <memory_resource>
 #include <sstream>
 #include <string>
+#include <type_traits>  // decay_t
 #include <utility>  // move
 #include <vector>
 
@@ -8,7 +13,9 @@
 
 #include "open62541pp/Common.h"
 #include "open62541pp/Config.h"
+#include "open62541pp/Encoding.h"
 #include "open62541pp/NodeIds.h"
+#include "open62541pp/VariantVisit.h"
 #include "open62541pp/detail/helper.h"  // detail::toString
 #include "open62541pp/types/Builtin.h"
 #include "open62541pp/types/Composed.h"
@@ -20,6 +27,42 @@
 
 using namespace opcua;
 
+namespace {
+/// Convertible type counting the conversions.
+struct Celsius {
+    double value;
+};
+
+struct ConversionCount {
+    static inline size_t single = 0;
+    static inline size_t bulk = 0;
+};
+}  // namespace
+
+namespace opcua {
+template <>
+struct TypeConverter<Celsius> {
+    using ValueType = Celsius;
+    using NativeType = double;
+
+    static void fromNative(const NativeType& src, ValueType& dst) {
+        dst.value = src;
+    }
+
+    static void toNative(const ValueType& src, NativeType& dst) {
+        ++ConversionCount::single;
+        dst = src.value;
+    }
+
+    static void toNativeArray(const ValueType* src, size_t size, NativeType* dst) noexcept {
+        ++ConversionCount::bulk;
+        for (size_t i = 0; i < size; ++i) {
+            dst[i] = src[i].value;  // NOLINT
+        }
+    }
+};
+}  // namespace opcua
+
 TEST_CASE("StatusCode") {
     SUBCASE("Good") {
         StatusCode code;
@@ -133,6 +176,67 @@ TEST_CASE("ByteString") {
 #endif
 }
 
+TEST_CASE_TEMPLATE("StringRef", T, StringRef, ByteStringRef) {
+    const std::string str("test123");
+    T ref(str);
+    CHECK(ref.handle()->data == reinterpret_cast<const uint8_t*>(str.data()));  // NOLINT
+    CHECK(ref.handle()->length == 7);
+    CHECK(std::string_view(ref) == "test123");
+    CHECK(sizeof(T) == sizeof(UA_String));
+    // copies would allocate characters that the reference does not own
+    CHECK_FALSE(detail::isRegisteredType<T>);
+
+    using WrapperType = std::decay_t<decltype(ref.get())>;
+
+    SUBCASE("Assign to variant without copy") {
+        Variant var;
+        var.setScalar(ref, getDataType<WrapperType>());
+        CHECK(var.getScalar<WrapperType>().handle()->data == ref.handle()->data);
+    }
+
+    SUBCASE("Copy to variant") {
+        const auto var = Variant::fromScalar(ref.get());
+        CHECK(var.getScalar<WrapperType>().handle()->data != ref.handle()->data);
+        CHECK(std::string_view(var.getScalar<WrapperType>().get()) == "test123");
+    }
+}
+
+TEST_CASE("StaticString") {
+    SUBCASE("Empty") {
+        const StaticString<8> str;
+        CHECK(str.get().empty());
+        CHECK(str.capacity() == 8);
+    }
+
+    SUBCASE("Inline storage") {
+        const StaticString<8> str("test");
+        CHECK(std::string_view(str) == "test");
+        const auto* begin = reinterpret_cast<const uint8_t*>(&str);  // NOLINT
+        CHECK(str.handle()->data >= begin);
+        CHECK(str.handle()->data < begin + sizeof(str));  // NOLINT
+    }
+
+    SUBCASE("Truncate") {
+        const StaticString<4> str("test123");
+        CHECK(std::string_view(str) == "test");
+    }
+
+    SUBCASE("Copy references own storage") {
+        const StaticString<8> str("test");
+        const StaticString<8> copy(str);  // NOLINT
+        CHECK(std::string_view(copy) == "test");
+        CHECK(copy.handle()->data != str.handle()->data);
+    }
+
+    SUBCASE("Assign to variant as StringRef") {
+        StaticString<8> str("test");
+        Variant var;
+        var.setScalar(static_cast<StringRef&>(str), getDataType<String>());
+        CHECK(var.isType(&UA_TYPES[UA_TYPES_STRING]));
+        CHECK(var.getScalar<String>() == "test");
+    }
+}
+
 TEST_CASE("Guid") {
     SUBCASE("Construct") {
         UA_UInt32 data1{11};
@@ -264,6 +368,41 @@ TEST_CASE("DateTime") {
         CHECK(zero != now);
         CHECK(zero < now);
     }
+
+    SUBCASE("Coarse clock") {
+        const auto before = DateTime::now();
+        const auto coarse = DateTime::nowCoarse();
+        // coarse resolution of a few milliseconds
+        CHECK(std::abs(coarse.get() - before.get()) < 100 * UA_DATETIME_MSEC);
+    }
+
+    SUBCASE("Monotonic clock") {
+        auto previous = DateTime::nowMonotonic();
+        for (int i = 0; i < 1000; ++i) {
+            const auto current = DateTime::nowMonotonic();
+            CHECK(current > previous);
+            previous = current;
+        }
+    }
+
+    SUBCASE("Array conversion from/to std::chrono::time_point") {
+        using namespace std::chrono;
+        const std::vector<system_clock::time_point> timePoints{
+            system_clock::time_point{}, system_clock::now()
+        };
+        std::vector<DateTime> dts(timePoints.size());
+        DateTime::fromTimePoints(Span<const system_clock::time_point>(timePoints), dts.data());
+        CHECK(dts[0] == DateTime(timePoints[0]));
+        CHECK(dts[1] == DateTime(timePoints[1]));
+
+        std::vector<system_clock::time_point> result(dts.size());
+        DateTime::toTimePoints(Span<const DateTime>(dts), result.data());
+        CHECK(result[0] == dts[0].toTimePoint<system_clock, system_clock::duration>());
+        CHECK(result[1] == dts[1].toTimePoint<system_clock, system_clock::duration>());
+        // clamped to unix epoch
+        DateTime::toTimePoints(Span<const DateTime>({DateTime(0)}), result.data());
+        CHECK(result[0] == system_clock::time_point{});
+    }
 }
 
 TEST_CASE("NodeId") {
@@ -359,12 +498,101 @@ TEST_CASE("NodeId") {
 #endif
     }
 
+    SUBCASE("toString into buffer") {
+        std::array<char, 16> buffer{};
+        const auto str = NodeId(10, 1).toString(buffer);
+        REQUIRE(str.code().isGood());
+        CHECK(*str == "ns=10;i=1");
+        CHECK(str->data() == buffer.data());
+        CHECK(NodeId(1, ByteString("test123")).toString(buffer).value() == "ns=1;b=dGVzdDEyMw==");
+        CHECK(
+            NodeId(1, "a long string identifier").toString(buffer).code() ==
+            UA_STATUSCODE_BADENCODINGLIMITSEXCEEDED
+        );
+        const std::string longId(100, 'x');
+        CHECK(NodeId(1, longId).toString() == "ns=1;s=" + longId);
+    }
+
+    SUBCASE("parse") {
+        CHECK(NodeId::parse("i=13").value() == NodeId(0, 13));
+        CHECK(NodeId::parse("ns=3;s=Line1.Motor.Speed").value() == NodeId(3, "Line1.Motor.Speed"));
+        CHECK(NodeId::parse("ns=1;s=").value() == NodeId(1, ""));
+        CHECK(NodeId::parse("ns=1;s=a;b=c").value() == NodeId(1, "a;b=c"));
+        CHECK(NodeId::parse("ns=1;b=dGVzdDEyMw==").value() == NodeId(1, ByteString("test123")));
+        const Guid guid(
+            0x72962B91, 0xFA75, 0x4AE6, {0x8D, 0x28, 0xB4, 0x04, 0xDC, 0x7D, 0xAF, 0x63}
+        );
+        CHECK(NodeId::parse("g=72962b91-fa75-4ae6-8d28-b404dc7daf63").value() == NodeId(0, guid));
+
+        for (const auto* str : {
+                 "",
+                 "i=",
+                 "i=-1",
+                 "i=4294967296",
+                 "ns=65536;i=1",
+                 "ns=1i=1",
+                 "x=1",
+                 "g=72962b91-fa75-4ae6-8d28",
+                 "b=abc",
+                 "b=ab=c",
+             }) {
+            CAPTURE(str);
+            CHECK(NodeId::parse(str).code() == UA_STATUSCODE_BADNODEIDINVALID);
+        }
+
+        // roundtrip
+        for (const NodeId& id : {NodeId(2, 10157), NodeId(1, "Hello:World"), NodeId(0, guid)}) {
+            CHECK(NodeId::parse(id.toString()).value() == id);
+        }
+    }
+
+    SUBCASE("parseMany") {
+        const std::vector<std::string_view> strings{"i=1", "invalid", "ns=2;s=name"};
+        const auto results = NodeId::parseMany(strings);
+        REQUIRE(results.size() == 3);
+        CHECK(results[0].value() == NodeId(0, 1));
+        CHECK(results[1].code() == UA_STATUSCODE_BADNODEIDINVALID);
+        CHECK(results[2].value() == NodeId(2, "name"));
+    }
+
     SUBCASE("std::hash specialization") {
         const NodeId id(1, "Test123");
         CHECK(std::hash<NodeId>{}(id) == id.hash());
     }
 }
 
+TEST_CASE("NodeIdView") {
+    SUBCASE("Numeric identifier (constexpr)") {
+        static constexpr NodeIdView view(1, 123);
+        CHECK(view.handle()->namespaceIndex == 1);
+        CHECK(view.handle()->identifier.numeric == 123);
+        CHECK(view.get() == NodeId(1, 123));
+    }
+
+    SUBCASE("From node id enum") {
+        static constexpr NodeIdView view(ObjectId::RootFolder);
+        const NodeId& id = view;
+        CHECK(id == NodeId(ObjectId::RootFolder));
+    }
+
+    SUBCASE("String identifier references data") {
+        const std::string str("Test123");
+        const NodeIdView view(2, str);
+        CHECK(view.handle()->identifier.string.data == (const UA_Byte*)str.data());  // NOLINT
+        CHECK(view.get() == NodeId(2, "Test123"));
+        const NodeId copy = view;
+        CHECK(copy == view.get());
+    }
+}
+
+TEST_CASE("QualifiedNameView") {
+    const std::string name("Test123");
+    const QualifiedNameView view(1, name);
+    CHECK(view.handle()->name.data == (const UA_Byte*)name.data());  // NOLINT
+    const QualifiedName& qn = view;
+    CHECK(qn == QualifiedName(1, "Test123"));
+}
+
 TEST_CASE("ExpandedNodeId") {
     ExpandedNodeId idLocal({1, "local"}, {}, 0);
     CHECK(idLocal.isLocal());
@@ -560,6 +788,53 @@ TEST_CASE("Variant") {
         CHECK(var.getArrayCopy<float>() == array);
     }
 
+    SUBCASE("Get array copy with allocator") {
+        std::pmr::monotonic_buffer_resource resource;
+        const auto var = Variant::fromArray(std::vector<std::string>{"a", std::string(100, 'b')});
+        const auto result = var.getArrayCopy<std::pmr::string>(
+            std::pmr::polymorphic_allocator<std::pmr::string>(&resource)
+        );
+        REQUIRE(result.size() == 2);
+        CHECK(result.get_allocator().resource() == &resource);
+        CHECK(result[0] == "a");
+        CHECK(result[1].get_allocator().resource() == &resource);
+        CHECK(result[1] == std::string(100, 'b'));
+
+        const auto scalar = Variant::fromScalar(std::string(100, 'c'))
+                                .getScalarCopy<std::pmr::string>(
+                                    std::pmr::polymorphic_allocator<char>(&resource)
+                                );
+        CHECK(scalar.get_allocator().resource() == &resource);
+        CHECK(scalar == std::string(100, 'c'));
+    }
+
+    SUBCASE("Move array out of variant") {
+        const std::vector<double> values{1.1, 2.2, 3.3};
+        auto var = Variant::fromArray(values);
+        CHECK(std::move(var).getArrayMove<double>() == values);
+        CHECK(var.isEmpty());  // NOLINT, use after move intended
+    }
+
+    SUBCASE("Move array of wrapper types out of variant") {
+        auto var = Variant::fromArray(std::vector<std::string>{"a", "b"});
+        const auto* data = static_cast<const UA_String*>(var.data())[0].data;
+        const auto result = std::move(var).getArrayMove<String>();
+        CHECK(var.isEmpty());  // NOLINT, use after move intended
+        REQUIRE(result.size() == 2);
+        CHECK(result[0]->data == data);  // element header moved, no deep copy
+        CHECK(result[0] == String("a"));
+        CHECK(result[1] == String("b"));
+    }
+
+    SUBCASE("Move array of non-owned data out of variant") {
+        std::vector<String> values{String("x")};
+        Variant var;
+        var.setArray(values);
+        const auto result = std::move(var).getArrayMove<String>();
+        CHECK(result == values);
+        CHECK(result[0]->data != values[0]->data);
+    }
+
     SUBCASE("Set array of native strings") {
         Variant var;
         std::array array{
@@ -709,6 +984,321 @@ TEST_CASE("Variant") {
     }
 }
 
+TEST_CASE("Variant bulk conversion of arrays") {
+    ConversionCount::single = 0;
+    ConversionCount::bulk = 0;
+    const std::vector<Celsius> values{{1.0}, {2.0}, {3.0}};
+
+    SUBCASE("fromArray of contiguous container") {
+        const auto var = Variant::fromArray(values);
+        CHECK(var.getArrayCopy<double>() == std::vector<double>{1.0, 2.0, 3.0});
+        CHECK(ConversionCount::bulk == 1);
+        CHECK(ConversionCount::single == 0);
+    }
+
+    SUBCASE("setArrayCopy of contiguous container") {
+        Variant var;
+        var.setArrayCopy(values);
+        CHECK(var.getArrayCopy<double>() == std::vector<double>{1.0, 2.0, 3.0});
+        CHECK(ConversionCount::bulk == 1);
+        CHECK(ConversionCount::single == 0);
+    }
+
+    SUBCASE("Non-contiguous container") {
+        const std::list<Celsius> list(values.begin(), values.end());
+        Variant var;
+        var.setArrayCopy(list);
+        CHECK(var.getArrayCopy<double>() == std::vector<double>{1.0, 2.0, 3.0});
+        CHECK(ConversionCount::bulk == 0);
+        CHECK(ConversionCount::single == 3);
+    }
+
+    SUBCASE("std::chrono::time_point") {
+        using std::chrono::system_clock;
+        const std::vector<system_clock::time_point> timePoints{
+            system_clock::time_point{}, system_clock::time_point{std::chrono::seconds(1)}
+        };
+        const auto var = Variant::fromArray(timePoints);
+        REQUIRE(var.isType<DateTime>());
+        const auto dts = var.getArray<DateTime>();
+        REQUIRE(dts.size() == 2);
+        CHECK(dts[0].get() == UA_DATETIME_UNIX_EPOCH);
+        CHECK(dts[1].get() == UA_DATETIME_UNIX_EPOCH + UA_DATETIME_SEC);
+    }
+}
+
+TEST_CASE("InlineVariant") {
+    SUBCASE("Empty") {
+        InlineVariant<> var;
+        CHECK(var.isEmpty());
+        CHECK(var.get().isEmpty());
+        CHECK_THROWS(var.getScalar<int32_t>());
+    }
+
+    SUBCASE("Scalar stored inline") {
+        InlineVariant<> var(11.11);
+        CHECK(var.get().isScalar());
+        CHECK(var.get().isType<double>());
+        CHECK(var.handle()->storageType == UA_VARIANT_DATA_NODELETE);
+        CHECK(var.handle()->data >= static_cast<const void*>(&var));
+        CHECK(var.handle()->data < static_cast<const void*>(&var + 1));
+        CHECK(var.getScalar<double>() == 11.11);
+    }
+
+    SUBCASE("Overwrite scalar with different type") {
+        InlineVariant<> var(int32_t{1});
+        var.setScalar(UA_Guid{});
+        CHECK(var.get().isType<UA_Guid>());
+    }
+
+    SUBCASE("Copy rebinds data to own buffer") {
+        InlineVariant<> var(int32_t{5});
+        InlineVariant<> copy(var);
+        CHECK(copy.handle()->data != var.handle()->data);
+        CHECK(copy.getScalar<int32_t>() == 5);
+
+        InlineVariant<> assigned;
+        assigned = var;
+        CHECK(assigned.handle()->data != var.handle()->data);
+        CHECK(assigned.getScalar<int32_t>() == 5);
+    }
+
+    SUBCASE("Implicit conversion to const Variant&") {
+        InlineVariant<> var(true);
+        const Variant& ref = var;
+        CHECK(ref.getScalarCopy<bool>() == true);
+    }
+}
+
+TEST_CASE("BorrowedVariant") {
+    SUBCASE("Scalar") {
+        const std::string value("test");
+        const auto var = BorrowedVariant::fromScalar(value);
+        CHECK(var.get().isScalar());
+        CHECK(var.get().isType<String>());
+        CHECK(var.handle()->storageType == UA_VARIANT_DATA_NODELETE);
+        const auto* str = static_cast<const UA_String*>(var.handle()->data);
+        CHECK(static_cast<const void*>(str->data) == value.data());
+        CHECK(var.get().getScalarCopy<std::string>() == "test");
+    }
+
+    SUBCASE("Array") {
+        const std::vector<std::string> values{"a", "bb", "ccc"};
+        const auto var = BorrowedVariant::fromArray(values);
+        CHECK(var.get().isArray());
+        CHECK(var.get().isType<String>());
+        CHECK(var.get().getArrayLength() == 3);
+        const auto* strings = static_cast<const UA_String*>(var.handle()->data);
+        for (size_t i = 0; i < values.size(); ++i) {
+            CHECK(static_cast<const void*>(strings[i].data) == values[i].data());  // NOLINT
+        }
+        CHECK(var.get().getArrayCopy<std::string>() == values);
+    }
+
+    SUBCASE("Copy is independent") {
+        const std::vector<std::string_view> values{"x", "y"};
+        Variant copy;
+        {
+            const auto var = BorrowedVariant::fromArray(values);
+            copy = var.get();
+        }
+        CHECK(copy->storageType == UA_VARIANT_DATA);
+        CHECK(copy.getArrayCopy<std::string>() == std::vector<std::string>{"x", "y"});
+    }
+}
+
+TEST_CASE("Variant getRange") {
+    std::vector<int32_t> values{0, 1, 2, 3, 4, 5};
+    Variant var;
+    var.setArray(values);
+
+    SUBCASE("Copy") {
+        const auto result = var.getRange(NumericRange("1:3"));
+        CHECK(result->storageType == UA_VARIANT_DATA);
+        CHECK(result.getArrayCopy<int32_t>() == std::vector<int32_t>{1, 2, 3});
+    }
+
+    SUBCASE("Reference contiguous range") {
+        const auto result = var.getRange<VariantPolicy::Reference>(NumericRange("2:4"));
+        CHECK(result->storageType == UA_VARIANT_DATA_NODELETE);
+        CHECK(result.data() == &values[2]);
+        CHECK(result.getArrayLength() == 3);
+    }
+
+    SUBCASE("Invalid range") {
+        CHECK_THROWS_AS(var.getRange(NumericRange("4:9")), BadStatus);
+        CHECK_THROWS_AS(
+            var.getRange<VariantPolicy::Reference>(NumericRange("4:9")), BadVariantAccess
+        );
+    }
+
+    SUBCASE("Multi-dimensional array") {
+        // 2x3 matrix
+        std::vector<uint32_t> dimensions{2, 3};
+        var->arrayDimensionsSize = dimensions.size();
+        var->arrayDimensions = dimensions.data();
+
+        // rows subset can not be referenced (dimensions would change)
+        CHECK_THROWS_AS(
+            var.getRange<VariantPolicy::Reference>(NumericRange("1,0:2")), BadVariantAccess
+        );
+        const auto row = var.getRange<VariantPolicy::ReferenceIfPossible>(NumericRange("1,0:2"));
+        CHECK(row->storageType == UA_VARIANT_DATA);
+        CHECK(row.getArrayCopy<int32_t>() == std::vector<int32_t>{3, 4, 5});
+
+        const auto full = var.getRange<VariantPolicy::Reference>(NumericRange("0:1,0:2"));
+        CHECK(full.data() == values.data());
+        CHECK(full.getArrayDimensions().size() == 2);
+
+        var->arrayDimensionsSize = 0;
+        var->arrayDimensions = nullptr;
+    }
+}
+
+TEST_CASE("ArrayView") {
+    // 3x4 matrix
+    std::vector<int32_t> values{0, 1, 2, 3, 10, 11, 12, 13, 20, 21, 22, 23};
+    std::vector<uint32_t> dimensions{3, 4};
+    Variant var;
+    var.setArray(values);
+    var->arrayDimensionsSize = dimensions.size();
+    var->arrayDimensions = dimensions.data();
+
+    SUBCASE("Rank mismatch") {
+        CHECK_THROWS_AS((var.getArrayView<int32_t, 1>()), BadVariantAccess);
+        CHECK_THROWS_AS((var.getArrayView<int32_t, 3>()), BadVariantAccess);
+    }
+
+    SUBCASE("One-dimensional array without dimensions") {
+        Variant flat;
+        flat.setArray(values);
+        const auto view = flat.getArrayView<int32_t, 1>();
+        CHECK(view.size() == 12);
+        CHECK(view[5] == 11);
+    }
+
+    auto view = var.getArrayView<int32_t, 2>();
+    CHECK(view.rank() == 2);
+    CHECK(view.extent(0) == 3);
+    CHECK(view.extent(1) == 4);
+    CHECK(view.stride(0) == 4);
+    CHECK(view.stride(1) == 1);
+    CHECK(view.size() == 12);
+    CHECK(view.data() == values.data());
+    CHECK(view.isContiguous());
+
+    SUBCASE("Element access") {
+        CHECK(view(0, 0) == 0);
+        CHECK(view(1, 2) == 12);
+        CHECK(view(2, 3) == 23);
+        CHECK(view[1][2] == 12);
+        view(1, 2) = 99;
+        CHECK(values[6] == 99);
+    }
+
+    SUBCASE("Const view") {
+        const Variant& constVar = var;
+        const ArrayView<const int32_t, 2> constView = constVar.getArrayView<int32_t, 2>();
+        CHECK(constView(2, 1) == 21);
+    }
+
+    SUBCASE("Slice rows") {
+        const auto rows = view.slice(0, 1, 2);
+        CHECK(rows.extent(0) == 2);
+        CHECK(rows(0, 0) == 10);
+        CHECK(rows.isContiguous());
+
+        const auto borrowed = rows.toVariant();
+        CHECK(borrowed.get().data() == &values[4]);
+        CHECK(borrowed.get().getArrayLength() == 8);
+        CHECK(borrowed.get().getArrayDimensions().size() == 2);
+        CHECK(borrowed.get().getArrayDimensions()[0] == 2);
+        CHECK(borrowed.get().getArrayDimensions()[1] == 4);
+    }
+
+    SUBCASE("Slice columns") {
+        const auto cols = view.slice(1, 1, 2);
+        CHECK(cols.extent(1) == 2);
+        CHECK(cols(0, 0) == 1);
+        CHECK(cols(2, 1) == 22);
+        CHECK_FALSE(cols.isContiguous());
+        CHECK_THROWS_AS(cols.toVariant(), BadStatus);
+    }
+
+    SUBCASE("Slice out of range") {
+        CHECK_THROWS_AS(view.slice(0, 2, 2), BadStatus);
+        CHECK_THROWS_AS(view.slice(2, 0, 1), BadStatus);
+    }
+
+    // borrowed dimensions must not be freed
+    var->arrayDimensionsSize = 0;
+    var->arrayDimensions = nullptr;
+}
+
+TEST_CASE("visit") {
+    const auto visitor = Overloaded{
+        [](std::monostate) { return std::string("empty"); },
+        [](int32_t value) { return "int32 " + std::to_string(value); },
+        [](double value) { return "double " + std::to_string(static_cast<int>(value)); },
+        [](const String& value) { return "string " + std::string(value.get()); },
+        [](Span<const int32_t> values) { return "int32[" + std::to_string(values.size()) + "]"; },
+        [](const Variant& /*unused*/) { return std::string("other"); },
+        [](const auto& /*unused*/) { return std::string("builtin"); },
+    };
+
+    CHECK(visit(Variant(), visitor) == "empty");
+    CHECK(visit(Variant::fromScalar(int32_t{11}), visitor) == "int32 11");
+    CHECK(visit(Variant::fromScalar(String("abc")), visitor) == "string abc");
+    CHECK(visit(Variant::fromScalar(NodeId(0, 1)), visitor) == "builtin");
+    CHECK(visit(Variant::fromArray(std::vector<int32_t>{1, 2, 3}), visitor) == "int32[3]");
+    CHECK(visit(Variant::fromArray(std::vector<double>{1.0}), visitor) == "builtin");
+
+    SUBCASE("Empty array") {
+        Variant var;
+        var.setArray(Span<int32_t>{});
+        CHECK(visit(var, visitor) == "int32[0]");
+    }
+
+    SUBCASE("Subtypes are visited as builtin type") {
+        const double duration = 5.0;
+        const auto var = Variant::fromScalar(duration, UA_TYPES[UA_TYPES_DURATION]);
+        CHECK(visit(var, visitor) == "double 5");
+    }
+
+    SUBCASE("Nested scalar variant") {
+        // not possible with Variant::fromScalar, but with decoded messages or the C API
+        const auto inner = Variant::fromScalar(int32_t{11});
+        Variant var;
+        REQUIRE(
+            UA_Variant_setScalarCopy(var.handle(), inner.handle(), &UA_TYPES[UA_TYPES_VARIANT]) ==
+            UA_STATUSCODE_GOOD
+        );
+        REQUIRE(var.isScalar());
+        const auto nested = visit(var, Overloaded{
+            [](Span<const Variant> values) { return values.size() == 1 ? &values[0] : nullptr; },
+            [](const auto& /*unused*/) -> const Variant* { return nullptr; },
+        });
+        REQUIRE(nested != nullptr);
+        CHECK(visit(*nested, visitor) == "int32 11");
+    }
+
+    SUBCASE("Structures are visited as variant") {
+        const auto var = Variant::fromScalar(ReadValueId(NodeId(0, 1), AttributeId::Value));
+        CHECK(visit(var, visitor) == "other");
+    }
+
+    SUBCASE("Mutable visitor") {
+        size_t elements = 0;
+        visit(Variant::fromArray(std::vector<int32_t>{1, 2}), [&](const auto& value) {
+            using T = std::decay_t<decltype(value)>;
+            if constexpr (std::is_same_v<T, Span<const int32_t>>) {
+                elements += value.size();
+            }
+        });
+        CHECK(elements == 2);
+    }
+}
+
 TEST_CASE("DataValue") {
     SUBCASE("Create from scalar") {
         CHECK(DataValue::fromScalar(5).getValue().getScalar<int>() == 5);
@@ -833,6 +1423,36 @@ TEST_CASE("DataValue") {
     }
 }
 
+TEST_CASE("SharedDataValue") {
+    const SharedDataValue shared(DataValue::fromScalar(11.11));
+    CHECK(shared.useCount() == 1);
+    CHECK(shared->getValue().getScalar<double>() == 11.11);
+
+    SUBCASE("Copies share the value") {
+        const SharedDataValue copy = shared;  // NOLINT
+        CHECK(shared.useCount() == 2);
+        CHECK(&copy.get() == &shared.get());
+        const DataValue& ref = copy;
+        CHECK(&ref == &shared.get());
+    }
+
+    SUBCASE("Copy-on-write") {
+        SharedDataValue copy = shared;  // NOLINT
+        copy.mutate().setStatus(UA_STATUSCODE_BADINTERNALERROR);
+        CHECK(&copy.get() != &shared.get());
+        CHECK(copy.useCount() == 1);
+        CHECK(shared.useCount() == 1);
+        CHECK(copy->getStatus() == UA_STATUSCODE_BADINTERNALERROR);
+        CHECK_FALSE(shared->hasStatus());
+    }
+
+    SUBCASE("Mutate unique value without copy") {
+        SharedDataValue unique(DataValue::fromScalar(1));
+        const auto* ptr = &unique.get();
+        CHECK(&unique.mutate() == ptr);
+    }
+}
+
 TEST_CASE("ExtensionObject") {
     SUBCASE("Empty") {
         ExtensionObject obj;
@@ -881,6 +1501,31 @@ TEST_CASE("ExtensionObject") {
         CHECK(obj.getDecodedData<int>() == nullptr);
         CHECK(obj.getDecodedData<double>() == &value);
     }
+
+#if UAPP_OPEN62541_VER_GE(1, 3)
+    SUBCASE("getDecodedData on demand") {
+        const ReadValueId value({1, 1000}, AttributeId::Value);
+        ByteString body = encodeBinary(value);
+
+        ExtensionObject obj;
+        obj->encoding = UA_EXTENSIONOBJECT_ENCODED_BYTESTRING;
+        obj->content.encoded.typeId = UA_TYPES[UA_TYPES_READVALUEID].binaryEncodingId;  // NOLINT
+        obj->content.encoded.body = std::exchange(*body.handle(), {});  // NOLINT
+        CHECK(obj.isEncoded());
+
+        // not decoded if the data type does not match
+        CHECK(obj.getDecodedData(UA_TYPES[UA_TYPES_BROWSEPATH]) == nullptr);
+        CHECK(obj.isEncoded());
+
+        auto* decoded = obj.getDecodedData<ReadValueId>();
+        REQUIRE(decoded != nullptr);
+        CHECK(obj.getEncoding() == ExtensionObjectEncoding::Decoded);
+        CHECK(decoded->getNodeId() == NodeId(1, 1000));
+        CHECK(decoded->getAttributeId() == AttributeId::Value);
+        // cached
+        CHECK(obj.getDecodedData<ReadValueId>() == decoded);
+    }
+#endif
 }
 
 TEST_CASE("RequestHeader") {
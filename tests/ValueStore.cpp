@@ -0,0 +1,118 @@
+#include <algorithm>  // all_of
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/Server.h"
+#include "open62541pp/ValueStore.h"
+#include "open62541pp/services/Attribute.h"
+#include "open62541pp/services/NodeManagement.h"
+
+using namespace opcua;
+
+TEST_CASE("ValueSlot") {
+    ValueSlot slot;
+    CHECK_FALSE(slot.acquire()->hasValue);
+
+    SUBCASE("Latest value") {
+        slot.publishScalar(1);
+        slot.publishScalar(2);
+        CHECK(slot.acquire().getValue().getScalar<int>() == 2);
+        CHECK(slot.acquire().getValue().getScalar<int>() == 2);  // unchanged
+        slot.publishScalar(3);
+        CHECK(slot.acquire().getValue().getScalar<int>() == 3);
+    }
+
+    SUBCASE("Concurrent producer") {
+        constexpr int count = 10000;
+        std::atomic<bool> done{false};
+        std::thread producer([&] {
+            for (int i = 1; i <= count; ++i) {
+                slot.publishScalar(i);
+            }
+            done = true;
+        });
+        int last = 0;
+        bool monotonic = true;
+        while (!done) {
+            const auto& dv = slot.acquire();
+            if (dv->hasValue) {
+                const int current = dv.getValue().getScalar<int>();
+                monotonic = monotonic && current >= last;
+                last = current;
+            }
+        }
+        producer.join();
+        CHECK(monotonic);
+        CHECK(slot.acquire().getValue().getScalar<int>() == count);
+    }
+}
+
+TEST_CASE("ValueStore") {
+    Server server;
+    const NodeId id{1, 1000};
+    VariableAttributes attributes;
+    attributes.setAccessLevel(AccessLevel::CurrentRead | AccessLevel::CurrentWrite);
+    services::addVariable(server, ObjectId::ObjectsFolder, id, "Variable", attributes);
+
+    ValueStore store;
+    auto& slot = store.registerNode(server, id);
+    CHECK(store.size() == 1);
+    CHECK(&store.getSlot(id) == &slot);
+    CHECK_THROWS(store.getSlot({1, 1001}));
+
+    SUBCASE("Read before first value") {
+        CHECK_THROWS_WITH(services::readValue(server, id), "BadWaitingForInitialData");
+    }
+
+    SUBCASE("Read published value") {
+        slot.publishScalar(11.11);
+        CHECK(services::readValue(server, id).getScalar<double>() == 11.11);
+        slot.publishScalar(22.22);
+        CHECK(services::readValue(server, id).getScalar<double>() == 22.22);
+    }
+
+    SUBCASE("Read published array") {
+        slot.publish(DataValue::fromArray(std::vector<int>{1, 2, 3, 4}));
+        CHECK(services::readValue(server, id).getArray<int>() == std::vector<int>{1, 2, 3, 4});
+    }
+
+    SUBCASE("Concurrent producer and reader") {
+        constexpr int count = 2000;
+        slot.publish(DataValue::fromArray(std::vector<int>(16, 0)));
+        std::atomic<bool> done{false};
+        std::thread producer([&] {
+            for (int i = 1; i <= count; ++i) {
+                slot.publish(DataValue::fromArray(std::vector<int>(16, i)));
+            }
+            done = true;
+        });
+        // read values are owned by the reader and stay intact after later reads
+        std::vector<Variant> values;
+        while (!done) {
+            values.push_back(services::readValue(server, id));
+        }
+        producer.join();
+        values.push_back(services::readValue(server, id));
+        bool consistent = true;
+        int last = 0;
+        for (const auto& value : values) {
+            const auto array = value.getArrayCopy<int>();
+            consistent = consistent && array.size() == 16 && array.front() >= last &&
+                         std::all_of(array.begin(), array.end(), [&](int v) {
+                             return v == array.front();
+                         });
+            last = array.empty() ? last : array.front();
+        }
+        CHECK(consistent);
+        CHECK(last == count);
+    }
+
+    SUBCASE("Write is rejected") {
+        CHECK_THROWS_WITH(
+            services::writeValue(server, id, Variant::fromScalar(1.0)), "BadNotWritable"
+        );
+    }
+}
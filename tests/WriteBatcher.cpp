@@ -0,0 +1,93 @@
+#include <chrono>
+#include <future>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/WriteBatcher.h"
+#include "open62541pp/services/Attribute.h"
+#include "open62541pp/services/NodeManagement.h"
+
+#include "helper/ServerClientSetup.h"
+
+using namespace opcua;
+
+TEST_CASE("WriteBatcher") {
+    ServerClientSetup setup;
+    setup.client.connect(setup.endpointUrl);
+    auto& client = setup.client;
+
+    const NodeId id1{1, 1000};
+    const NodeId id2{1, 1001};
+    for (const auto& id : {id1, id2}) {
+        services::addVariable(
+            setup.server,
+            {0, UA_NS0ID_OBJECTSFOLDER},
+            id,
+            "variable",
+            VariableAttributes{}.setAccessLevel(
+                AccessLevel::CurrentRead | AccessLevel::CurrentWrite
+            )
+        );
+    }
+
+    std::vector<StatusCode> codes;
+    auto handler = [&](StatusCode code) { codes.push_back(code); };
+    auto waitFor = [&](size_t count) {
+        while (codes.size() < count) {
+            client.runIterate(10);
+        }
+    };
+
+    SUBCASE("Flush after window elapsed") {
+        WriteBatcher batcher(client, {std::chrono::milliseconds(0)});
+        batcher.writeValueAsync(id1, Variant::fromScalar(1), handler);
+        batcher.writeValueAsync(id2, Variant::fromScalar(2), handler);
+        CHECK(batcher.pending() == 2);
+        waitFor(2);
+        CHECK(batcher.pending() == 0);
+        CHECK(codes.at(0).isGood());
+        CHECK(codes.at(1).isGood());
+        CHECK(services::readValue(client, id1).getScalar<int>() == 1);
+        CHECK(services::readValue(client, id2).getScalar<int>() == 2);
+    }
+
+    SUBCASE("Flush if batch size is reached") {
+        WriteBatcher batcher(client, {std::chrono::hours(1), 2});
+        batcher.writeValueAsync(id1, Variant::fromScalar(1), handler);
+        CHECK(batcher.pending() == 1);
+        batcher.writeValueAsync(id2, Variant::fromScalar(2), handler);
+        CHECK(batcher.pending() == 0);
+        waitFor(2);
+    }
+
+    SUBCASE("Deduplicate") {
+        WriteBatcher batcher(client, {std::chrono::hours(1), 0, true});
+        batcher.writeValueAsync(id1, Variant::fromScalar(1), handler);
+        batcher.writeValueAsync(id2, Variant::fromScalar(2), handler);
+        batcher.writeValueAsync(id1, Variant::fromScalar(3), handler);
+        CHECK(batcher.pending() == 2);
+        batcher.flush();
+        waitFor(3);
+        CHECK(services::readValue(client, id1).getScalar<int>() == 3);
+    }
+
+    SUBCASE("Per-item status codes") {
+        WriteBatcher batcher(client, {std::chrono::hours(1)});
+        batcher.writeValueAsync(id1, Variant::fromScalar(1), handler);
+        batcher.writeValueAsync({1, 9999}, Variant::fromScalar(1), handler);
+        batcher.flush();
+        waitFor(2);
+        CHECK(codes.at(0).isGood());
+        CHECK(codes.at(1) == UA_STATUSCODE_BADNODEIDUNKNOWN);
+    }
+
+    SUBCASE("Future") {
+        WriteBatcher batcher(client, {std::chrono::milliseconds(0)});
+        auto future = batcher.writeValueAsync(id1, Variant::fromScalar(5));
+        while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            client.runIterate(10);
+        }
+        CHECK_NOTHROW(future.get());
+    }
+}
@@ -89,3 +89,81 @@ TEST_CASE("Async (detached completion token)") {
         CHECK_NOTHROW(asyncTest(UA_STATUSCODE_BADUNEXPECTEDERROR, 11, useDetached));
     }
 }
+
+#ifdef UAPP_HAS_COROUTINES
+namespace {
+
+struct FakeClient {
+    std::function<void()> pending;
+    size_t iterations = 0;
+
+    void runIterate(uint16_t /* timeoutMilliseconds */) {
+        ++iterations;
+        if (pending) {
+            std::exchange(pending, {})();
+        }
+    }
+};
+
+template <typename CompletionToken>
+auto asyncLater(FakeClient& client, StatusCode code, int value, CompletionToken&& token) {
+    return asyncInitiate<int>(
+        [&](auto handler) {
+            client.pending = [handler, code, value]() mutable {
+                std::invoke(handler, code, value);
+            };
+        },
+        std::forward<CompletionToken>(token)
+    );
+}
+
+Task<int> awaitImmediate() {
+    co_return co_await asyncTest(UA_STATUSCODE_GOOD, 11, useAwaitable);
+}
+
+Task<int> awaitLater(FakeClient& client, StatusCode code) {
+    const int first = co_await asyncLater(client, code, 1, useAwaitable);
+    const int second = co_await asyncLater(client, code, 2, useAwaitable);
+    co_return first + second;
+}
+
+Task<int> awaitTask(FakeClient& client) {
+    co_return 10 * co_await awaitLater(client, UA_STATUSCODE_GOOD);
+}
+
+Task<> awaitVoid() {
+    co_await asyncTest(UA_STATUSCODE_GOOD, useAwaitable);
+}
+
+}  // namespace
+
+TEST_CASE("Async (awaitable completion token)") {
+    FakeClient client;
+
+    SUBCASE("Immediate completion") {
+        CHECK(runUntilComplete(client, awaitImmediate()) == 11);
+        CHECK(client.iterations == 0);
+    }
+
+    SUBCASE("Resume from completion handler") {
+        CHECK(runUntilComplete(client, awaitLater(client, UA_STATUSCODE_GOOD)) == 3);
+        CHECK(client.iterations == 2);
+    }
+
+    SUBCASE("Nested tasks") {
+        CHECK(runUntilComplete(client, awaitTask(client)) == 30);
+    }
+
+    SUBCASE("Void") {
+        CHECK_NOTHROW(runUntilComplete(client, awaitVoid()));
+    }
+
+    SUBCASE("Error") {
+        CHECK_THROWS_WITH_AS(
+            runUntilComplete(client, awaitLater(client, UA_STATUSCODE_BADUNEXPECTEDERROR)),
+            "BadUnexpectedError",
+            BadStatus
+        );
+    }
+}
+#endif
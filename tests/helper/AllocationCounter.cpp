@@ -0,0 +1,94 @@
+#include "AllocationCounter.h"
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#include "open62541pp/open62541.h"
+
+namespace {
+
+thread_local AllocationCount counter{};  // NOLINT
+
+void count(size_t bytes) noexcept {
+    ++counter.allocations;
+    counter.bytes += bytes;
+}
+
+#ifdef UA_ENABLE_MALLOC_SINGLETON
+void* countingMalloc(size_t size) {
+    count(size);
+    return std::malloc(size);  // NOLINT
+}
+
+void* countingCalloc(size_t num, size_t size) {
+    count(num * size);
+    return std::calloc(num, size);  // NOLINT
+}
+
+void* countingRealloc(void* ptr, size_t size) {
+    count(size);
+    return std::realloc(ptr, size);  // NOLINT
+}
+
+void countingFree(void* ptr) {
+    std::free(ptr);  // NOLINT
+}
+
+// install the counting allocators of open62541 before main
+[[maybe_unused]] const bool installed = [] {
+    UA_mallocSingleton = countingMalloc;
+    UA_callocSingleton = countingCalloc;
+    UA_reallocSingleton = countingRealloc;
+    UA_freeSingleton = countingFree;
+    return true;
+}();
+#endif
+
+}  // namespace
+
+AllocationCount getAllocationCount() noexcept {
+    return counter;
+}
+
+bool isNativeAllocationCounted() noexcept {
+#ifdef UA_ENABLE_MALLOC_SINGLETON
+    return true;
+#else
+    return false;
+#endif
+}
+
+/* ------------------------------------ Global operator new ------------------------------------- */
+
+// NOLINTBEGIN
+
+void* operator new(std::size_t size) {
+    count(size);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*unused*/) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t /*unused*/) noexcept {
+    std::free(ptr);
+}
+
+// NOLINTEND
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+
+/// Number of allocations and allocated bytes.
+struct AllocationCount {
+    uint64_t allocations = 0;
+    uint64_t bytes = 0;
+};
+
+/**
+ * Get the allocations of the current thread.
+ * Counted are C++ allocations (`operator new`) and native allocations of open62541
+ * (`UA_malloc`, `UA_calloc`, `UA_realloc`). Native allocations can only be counted if open62541
+ * is compiled with `UA_ENABLE_MALLOC_SINGLETON`.
+ */
+AllocationCount getAllocationCount() noexcept;
+
+/// Check if native allocations of open62541 are counted.
+bool isNativeAllocationCounted() noexcept;
+
+/**
+ * Count the allocations of the current thread within a scope, e.g. to assert allocation budgets:
+ * @code
+ * AllocationScope scope;
+ * auto value = services::readValue(server, id);
+ * const auto allocations = scope.getAllocations();  // before any other allocation (e.g. CHECK)
+ * CHECK(allocations <= 2);
+ * @endcode
+ */
+class AllocationScope {
+public:
+    AllocationScope() noexcept
+        : start_(getAllocationCount()) {}
+
+    /// Allocations since the construction of the scope.
+    uint64_t getAllocations() const noexcept {
+        return getAllocationCount().allocations - start_.allocations;
+    }
+
+    /// Allocated bytes since the construction of the scope.
+    uint64_t getBytes() const noexcept {
+        return getAllocationCount().bytes - start_.bytes;
+    }
+
+private:
+    AllocationCount start_;
+};
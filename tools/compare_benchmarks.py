@@ -0,0 +1,143 @@
+"""
+Compare benchmark results (JSON) against a baseline and flag regressions.
+
+Results are matched by their configuration (string fields and known configuration fields).
+Metrics are classified by name: throughput (`...PerSecond`, `efficiency`) is higher-is-better,
+times, bytes, allocations and requests per operation are lower-is-better.
+Exits with a non-zero status if any metric regressed by more than the threshold.
+
+Usage: python compare_benchmarks.py baseline.json result.json [--threshold 5]
+"""
+
+import argparse
+import json
+import re
+import sys
+from pathlib import Path
+
+CONFIG_FIELDS = {
+    "batchSize",
+    "clients",
+    "items",
+    "nodes",
+    "payloadBytes",
+    "threads",
+    "variables",
+}
+IGNORED_FIELDS = {
+    "connections",
+    "errors",
+    "failedItems",
+    "found",
+    "notifications",
+    "operations",
+    "requests",
+    "updates",
+}
+HIGHER_IS_BETTER = re.compile(r"(PerSecond|^efficiency)$")
+LOWER_IS_BETTER = re.compile(
+    r"(seconds|bytes|allocations|PerOperation|PerNotification|cpuCores)", re.IGNORECASE
+)
+
+
+def get_direction(field: str) -> int:
+    """Return +1 if higher is better, -1 if lower is better, 0 if not a metric."""
+    if field in CONFIG_FIELDS or field in IGNORED_FIELDS:
+        return 0
+    if HIGHER_IS_BETTER.search(field):
+        return 1
+    if LOWER_IS_BETTER.search(field):
+        return -1
+    return 0
+
+
+def get_key(section: str, entry: dict) -> tuple:
+    config = sorted(
+        (field, value)
+        for field, value in entry.items()
+        if isinstance(value, str) or field in CONFIG_FIELDS
+    )
+    return (section, *config)
+
+
+def index_results(document: dict) -> dict:
+    """Index all entries of the result lists by their configuration."""
+    indexed = {}
+    for section, entries in document.items():
+        if not isinstance(entries, list):
+            continue
+        for entry in entries:
+            if isinstance(entry, dict):
+                indexed[get_key(section, entry)] = entry
+    return indexed
+
+
+def format_key(key: tuple) -> str:
+    section, *config = key
+    return section + " " + ", ".join(f"{field}={value}" for field, value in config)
+
+
+def compare(baseline: dict, result: dict, threshold: float):
+    """Yield (key, field, baseline, result, change [%], regression) of all matching metrics."""
+    baseline_index = index_results(baseline)
+    for key, entry in index_results(result).items():
+        baseline_entry = baseline_index.get(key)
+        if baseline_entry is None:
+            continue
+        for field, value in entry.items():
+            direction = get_direction(field)
+            baseline_value = baseline_entry.get(field)
+            if direction == 0 or not isinstance(value, (int, float)):
+                continue
+            if not isinstance(baseline_value, (int, float)):
+                continue
+            if baseline_value == 0:
+                change = 0.0 if value == 0 else float("inf")
+            else:
+                change = (value - baseline_value) / abs(baseline_value) * 100
+            regression = -change * direction > threshold
+            yield key, field, baseline_value, value, change, regression
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("baseline", type=Path, help="Baseline results (JSON)")
+    parser.add_argument("result", type=Path, help="Current results (JSON)")
+    parser.add_argument(
+        "--threshold", type=float, default=5.0, help="Regression threshold in percent"
+    )
+    parser.add_argument("--verbose", action="store_true", help="Print all compared metrics")
+    args = parser.parse_args()
+
+    if not args.baseline.exists():
+        print(f"No baseline {args.baseline}, skip comparison")
+        return 0
+
+    baseline = json.loads(args.baseline.read_text())
+    result = json.loads(args.result.read_text())
+    if baseline.get("benchmark") != result.get("benchmark"):
+        print("Baseline and result are from different benchmarks")
+        return 1
+
+    print(f"Benchmark: {result.get('benchmark')}")
+    print(f"Baseline version: {baseline.get('version')}, result version: {result.get('version')}")
+    print(f"Threshold: {args.threshold}%\n")
+    print("| status | change | baseline | result | metric")
+    print("|--------|-------:|---------:|-------:|:-------")
+    regressions = 0
+    for key, field, baseline_value, value, change, regression in compare(
+        baseline, result, args.threshold
+    ):
+        regressions += regression
+        if regression or args.verbose:
+            status = "REGRESSION" if regression else "ok"
+            print(
+                f"| {status} | {change:+.1f}% | {baseline_value:g} | {value:g} | "
+                f"{format_key(key)}: {field}"
+            )
+    print(f"\n{regressions} regression(s)")
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -2,7 +2,9 @@ from pathlib import Path
 
 HERE = Path(__file__).parent
 SCHEMA_DIR = HERE.parent / "3rdparty" / "open62541" / "tools" / "schema"
-HEADER_FILE = HERE.parent / "include" / "open62541pp" / "TypeRegistryNative.h"
+INCLUDE_DIR = HERE.parent / "include" / "open62541pp"
+HEADER_FILE = INCLUDE_DIR / "TypeRegistryNative.h"
+FAMILY_DIR = INCLUDE_DIR / "typeregistry"
 
 FILES_DATATYPES = [
     SCHEMA_DIR / "datatypes_minimal.txt",
@@ -16,15 +18,26 @@ FILES_DATATYPES = [
     SCHEMA_DIR / "datatypes_dataaccess.txt",
 ]
 
-TEMPLATE_HEADER = """
+TEMPLATE_GENERATED = """
 /* ---------------------------------------------------------------------------------------------- */
 /*                                   Generated - do not modify!                                   */
 /* ---------------------------------------------------------------------------------------------- */
+""".lstrip()
+
+TEMPLATE_HEADER = """
+{generated}
+#pragma once
+
+// template specializations of TypeRegistry for the native types, grouped by type family
+{includes}
+""".lstrip()
 
+TEMPLATE_FAMILY_HEADER = """
+{generated}
 #pragma once
 
-#include "open62541pp/TypeRegistry.h"
 #include "open62541pp/open62541.h"
+#include "open62541pp/typeregistry/Builtin.h"
 
 namespace opcua {{
 
@@ -85,6 +98,63 @@ EXCLUDE_TYPES = [
     "PermissionType",  # UInt32
 ]
 
+# type families, each family is generated into a separate header to reduce the include cost
+# the first matching family is used, the remaining types are assigned to the "Core" family
+FAMILIES = {
+    "Services": lambda name: "Request" in name or "Response" in name or name == "ServiceFault",
+    "PubSub": lambda name: not name.startswith("Query")
+    and any(
+        keyword in name
+        for keyword in (
+            "Broker",
+            "ConfigurationVersion",
+            "DataSet",
+            "Datagram",
+            "FieldMetaData",
+            "FieldTargetDataType",
+            "NetworkAddress",
+            "OverrideValueHandling",
+            "PubSub",
+            "Published",
+            "ReaderGroup",
+            "TargetVariables",
+            "UABinaryFile",
+            "Uadp",
+            "WriterGroup",
+        )
+    ),
+    "History": lambda name: name.startswith("History")
+    or name.endswith("Details")
+    or name in ("ModificationInfo", "PerformUpdateType"),
+    "Core": lambda name: True,
+}
+
+
+def get_family(typename: str) -> str:
+    return next(family for family, predicate in FAMILIES.items() if predicate(typename))
+
+
+def generate(typenames):
+    families = {family: [] for family in FAMILIES}
+    for typename in sorted(typenames):
+        families[get_family(typename)].append(typename)
+
+    FAMILY_DIR.mkdir(exist_ok=True)
+    for family, names in families.items():
+        body = "\n".join(
+            TEMPLATE_MACRO.format(
+                type=f"UA_{typename}", typeindex_define=f"UA_TYPES_{typename.upper()}"
+            )
+            for typename in names
+        )
+        header = TEMPLATE_FAMILY_HEADER.format(generated=TEMPLATE_GENERATED, body=body)
+        (FAMILY_DIR / f"{family}.h").write_text(header)
+
+    includes = "\n".join(
+        f'#include "open62541pp/typeregistry/{family}.h"' for family in sorted(families)
+    )
+    HEADER_FILE.write_text(TEMPLATE_HEADER.format(generated=TEMPLATE_GENERATED, includes=includes))
+
 
 def main():
     # remove duplicates to prevent redefinitions
@@ -92,14 +162,7 @@ def main():
         *(set(f.read_text().strip().splitlines()) for f in FILES_DATATYPES)
     )
     typenames -= set(EXCLUDE_TYPES)
-    body = "\n".join(
-        TEMPLATE_MACRO.format(
-            type=f"UA_{typename}", typeindex_define=f"UA_TYPES_{typename.upper()}"
-        )
-        for typename in sorted(typenames)
-    )
-    header = TEMPLATE_HEADER.format(body=body)
-    HEADER_FILE.write_text(header)
+    generate(typenames)
 
 
 if __name__ == "__main__":